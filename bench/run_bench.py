@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+#
+# 86Box    A hypervisor and IBM PC system emulator that specializes in
+#          running old operating systems and software designed for IBM
+#          PC systems and compatibles from 1981 through fairly recent
+#          system designs based on the PCI bus.
+#
+#          This file is part of the 86Box distribution.
+#
+#          Regression benchmark runner: executes the scenarios under
+#          bench/scenarios against a build of the emulator, one instance
+#          per core, and gates the metrics from the -B benchmark report
+#          against the stored per-host baselines with statistical noise
+#          bounds. See bench/README.md for the workflow.
+#
+# Authors: Miran Grca, <mgrca8@gmail.com>
+#
+#          Copyright 2026 Miran Grca.
+#
+import argparse
+import configparser
+import hashlib
+import json
+import math
+import os
+import platform
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+from concurrent.futures import ThreadPoolExecutor
+
+# Generous: a scenario that takes 20x longer than the emulated time it
+# covers has regressed badly enough that the timeout itself is the signal.
+TIMEOUT_FACTOR = 20
+TIMEOUT_GRACE_S = 120
+
+
+class Scenario:
+    def __init__(self, path):
+        self.path = path
+        self.name = os.path.basename(path)
+        ini = configparser.ConfigParser(inline_comment_prefixes=(";",))
+        ini.read(os.path.join(path, "scenario.ini"))
+        sec = ini["scenario"]
+        self.name = sec.get("name", self.name)
+        self.config = os.path.join(path, sec.get("config", "86box.cfg"))
+        self.run_ms = sec.getint("run_ms")
+        self.repeats = sec.getint("repeats", 3)
+        self.images = dict(ini["images"]) if ini.has_section("images") else {}
+        # envelope: metric -> (relative slack, direction)
+        self.envelope = {}
+        if ini.has_section("envelope"):
+            for metric, value in ini["envelope"].items():
+                slack, direction = value.split()
+                if direction not in ("higher", "lower"):
+                    raise ValueError("%s: bad direction '%s' for %s"
+                                     % (self.name, direction, metric))
+                self.envelope[metric] = (float(slack), direction)
+
+    def baseline_path(self):
+        return os.path.join(self.path, "baseline.json")
+
+    def baseline(self):
+        try:
+            with open(self.baseline_path()) as f:
+                return json.load(f)
+        except FileNotFoundError:
+            return None
+
+
+def sha256_file(path):
+    h = hashlib.sha256()
+    with open(path, "rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            h.update(chunk)
+    return h.hexdigest()
+
+
+def copy_image(src, dst):
+    """Place a private copy of a workload image in the run directory.
+
+    Runs mutate their disk images, so the golden image is never handed to
+    the emulator directly. Use a reflink where the filesystem has them so
+    multi-gigabyte images do not cost a full copy per repetition."""
+    if os.name == "posix":
+        r = subprocess.run(["cp", "--reflink=auto", src, dst],
+                           stderr=subprocess.DEVNULL)
+        if r.returncode == 0:
+            return
+    shutil.copy(src, dst)
+
+
+def check_images(scenario, images_dir):
+    """Return (resolved image paths, reason to skip or None)."""
+    resolved = {}
+    for name, digest in scenario.images.items():
+        src = os.path.join(images_dir, name)
+        if not os.path.isfile(src):
+            return None, "missing image %s" % name
+        if digest and digest != "-":
+            actual = sha256_file(src)
+            if actual != digest:
+                return None, "image %s sha256 mismatch (got %s)" % (name, actual)
+        resolved[name] = src
+    return resolved, None
+
+
+def run_once(emulator, scenario, images, keep_dirs):
+    workdir = tempfile.mkdtemp(prefix="86bench-%s-" % scenario.name)
+    try:
+        shutil.copy(scenario.config, os.path.join(workdir, "86box.cfg"))
+        for name, src in images.items():
+            copy_image(src, os.path.join(workdir, name))
+
+        report = os.path.join(workdir, "report.json")
+        cmd = [emulator, "-P", workdir,
+               "-B", "%d,%s" % (scenario.run_ms, report)]
+        timeout = scenario.run_ms / 1000 * TIMEOUT_FACTOR + TIMEOUT_GRACE_S
+        with open(os.path.join(workdir, "run.log"), "wb") as log:
+            proc = subprocess.run(cmd, stdout=log, stderr=subprocess.STDOUT,
+                                  timeout=timeout)
+        if proc.returncode != 0:
+            raise RuntimeError("%s: emulator exited with %d (log in %s)"
+                               % (scenario.name, proc.returncode, workdir))
+        with open(report) as f:
+            return json.load(f)
+    except Exception:
+        keep_dirs.append(workdir)
+        raise
+    else:
+        shutil.rmtree(workdir, ignore_errors=True)
+
+
+def aggregate(reports):
+    metrics = {}
+    for key in reports[0]:
+        values = [r[key] for r in reports if isinstance(r.get(key), (int, float))]
+        if len(values) != len(reports):
+            continue
+        metrics[key] = {
+            "mean": statistics.fmean(values),
+            "stddev": statistics.stdev(values) if len(values) > 1 else 0.0,
+        }
+    return metrics
+
+
+def gate(scenario, metrics, baseline, noise_sigma):
+    """Compare aggregated metrics against the baseline envelope.
+
+    The allowed deviation per metric is the larger of the statistical
+    noise bound (noise_sigma times the combined standard deviation of the
+    baseline and this run) and the relative slack from the scenario
+    envelope, so neither a noisy host nor a tight envelope produces
+    false alarms on its own."""
+    failures = []
+    base = baseline["metrics"]
+    for metric, (slack, direction) in scenario.envelope.items():
+        if metric not in metrics or metric not in base:
+            continue
+        mean = metrics[metric]["mean"]
+        bmean = base[metric]["mean"]
+        noise = noise_sigma * math.hypot(metrics[metric]["stddev"],
+                                         base[metric]["stddev"])
+        allowed = max(noise, slack * abs(bmean))
+        if direction == "higher" and mean < bmean - allowed:
+            failures.append("%s: %.2f, baseline %.2f (allowed -%.2f)"
+                            % (metric, mean, bmean, allowed))
+        if direction == "lower" and mean > bmean + allowed:
+            failures.append("%s: %.2f, baseline %.2f (allowed +%.2f)"
+                            % (metric, mean, bmean, allowed))
+    return failures
+
+
+def main():
+    default_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               "scenarios")
+    ap = argparse.ArgumentParser(description="86Box regression benchmark suite")
+    ap.add_argument("scenarios", nargs="?", default=default_dir,
+                    help="directory of scenario definitions")
+    ap.add_argument("--emulator", default=os.environ.get("BENCH_EMULATOR"),
+                    help="86Box binary to benchmark (or $BENCH_EMULATOR)")
+    ap.add_argument("--images",
+                    default=os.path.join(os.path.dirname(default_dir), "images"),
+                    help="directory holding the workload images")
+    ap.add_argument("--jobs", type=int, default=os.cpu_count(),
+                    help="parallel emulator instances (default: one per core)")
+    ap.add_argument("--repeats", type=int,
+                    help="override per-scenario repetition count")
+    ap.add_argument("--noise-sigma", type=float, default=3.0,
+                    help="noise bound in combined standard deviations")
+    ap.add_argument("--only", action="append",
+                    help="run only the named scenario (repeatable)")
+    ap.add_argument("--update-baseline", action="store_true",
+                    help="record this run as the new baseline")
+    ap.add_argument("--strict", action="store_true",
+                    help="treat skipped scenarios as failures")
+    args = ap.parse_args()
+
+    if not args.emulator:
+        ap.error("--emulator (or $BENCH_EMULATOR) is required")
+
+    scenarios = []
+    for entry in sorted(os.listdir(args.scenarios)):
+        path = os.path.join(args.scenarios, entry)
+        if os.path.isfile(os.path.join(path, "scenario.ini")):
+            scenarios.append(Scenario(path))
+    if args.only:
+        scenarios = [s for s in scenarios if s.name in args.only]
+    if not scenarios:
+        print("no scenarios found in %s" % args.scenarios, file=sys.stderr)
+        return 2
+
+    skipped = []
+    failed = []
+    keep_dirs = []
+    tasks = []  # (scenario, images, repetition index)
+    for s in scenarios:
+        images, reason = check_images(s, args.images)
+        if reason is not None:
+            skipped.append((s.name, reason))
+            continue
+        for _ in range(args.repeats or s.repeats):
+            tasks.append((s, images))
+
+    results = {}
+    with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        futures = [(s, pool.submit(run_once, args.emulator, s, images,
+                                   keep_dirs))
+                   for s, images in tasks]
+        for s, future in futures:
+            try:
+                results.setdefault(s.name, []).append(future.result())
+            except Exception as e:
+                failed.append((s.name, str(e)))
+
+    for s in scenarios:
+        reports = results.get(s.name)
+        if not reports:
+            continue
+        metrics = aggregate(reports)
+        if args.update_baseline:
+            with open(s.baseline_path(), "w") as f:
+                json.dump({"host": platform.node(),
+                           "platform": platform.platform(),
+                           "samples": len(reports),
+                           "metrics": metrics}, f, indent=2)
+                f.write("\n")
+            print("%-24s baseline updated (%d samples)" % (s.name, len(reports)))
+            continue
+        baseline = s.baseline()
+        if baseline is None:
+            skipped.append((s.name, "no baseline (run with --update-baseline)"))
+            continue
+        problems = gate(s, metrics, baseline, args.noise_sigma)
+        if problems:
+            failed.append((s.name, "; ".join(problems)))
+            verdict = "FAIL"
+        else:
+            verdict = "ok"
+        line = " ".join("%s=%.2f" % (m, metrics[m]["mean"])
+                        for m in sorted(s.envelope) if m in metrics)
+        print("%-24s %-4s %s" % (s.name, verdict, line))
+
+    for name, reason in skipped:
+        print("%-24s SKIP %s" % (name, reason))
+    for name, reason in failed:
+        print("%-24s FAIL %s" % (name, reason), file=sys.stderr)
+    for d in keep_dirs:
+        print("kept failing run directory: %s" % d, file=sys.stderr)
+
+    if failed or (args.strict and skipped):
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -52,6 +52,8 @@
 #    include "codegen_public.h"
 #endif
 #include "x86_ops.h"
+#include <86box/bench.h>
+#include <86box/perfctr.h>
 #include <86box/io.h>
 #include <86box/rom.h>
 #include <86box/dma.h>
@@ -62,6 +64,9 @@
 #include <86box/pit.h>
 #include <86box/random.h>
 #include <86box/nvr.h>
+#include <86box/rewind.h>
+#include <86box/savestate.h>
+#include <86box/trace.h>
 #include <86box/machine.h>
 #include <86box/bugger.h>
 #include <86box/postcard.h>
@@ -122,6 +127,7 @@ char         emu_version[200]; /* version ID string */
 #ifdef MTR_ENABLED
 int tracing_on = 0;
 #endif
+uint32_t trace_flags = 0; /* (C) enabled trace subsystems */
 
 /* Commandline options. */
 int dump_on_exit        = 0; /* (O) dump regs on exit */
@@ -190,6 +196,14 @@ uint32_t mem_size                               = 0;              /* (C) memory
                                                                          system board)*/
 uint32_t isa_mem_size                           = 0;              /* (C) memory size (ISA Memory Cards) */
 int      cpu_use_dynarec                        = 0;              /* (C) cpu uses/needs Dyna */
+int      dynarec_cache_size                     = 0;              /* (C) dynarec code cache size (MB),
+                                                                         0 = default */
+int      dynarec_max_block_ins                  = 0;              /* (C) dynarec block instruction limit,
+                                                                         0 = default */
+int      dynarec_max_block_bytes                = 0;              /* (C) dynarec block guest byte limit,
+                                                                         0 = default */
+int      dynarec_idle_skip                      = 1;              /* (C) dynarec coasts through detected
+                                                                         idle poll loops */
 int      cpu                                    = 0;              /* (C) cpu type */
 int      fpu_type                               = 0;              /* (C) fpu type */
 int      fpu_softfloat                          = 0;              /* (C) fpu uses softfloat */
@@ -206,6 +220,12 @@ int      video_fullscreen_scale_maximized       = 0;              /* (C) Whether
                                                                          also apply when maximized. */
 int      do_auto_pause                          = 0;              /* (C) Auto-pause the emulator on focus
                                                                          loss */
+int      background_speed_cap                   = 0;              /* (C) Cap emulated speed to this percentage
+                                                                         while unfocused (0 = no cap) */
+int      background_balloon                     = 0;              /* (C) Hand cold guest RAM back to the host
+                                                                         while unfocused */
+int      pc_in_background                       = 0;              /* Set by the UI while the window is
+                                                                         unfocused */
 char     uuid[MAX_UUID_LEN]                     = { '\0' };       /* (C) UUID or machine identifier */
 
 int      other_ide_present = 0;                                   /* IDE controllers from non-IDE cards are
@@ -535,6 +555,8 @@ usage:
             printf("\nUsage: 86box [options] [cfg-file]\n\n");
             printf("Valid options are:\n\n");
             printf("-? or --help            - show this information\n");
+            printf("-A or --devaudit        - log heap allocated by each device at init\n");
+            printf("-B or --bench ms,path   - run benchmark for 'ms' msec, report to 'path'\n");
             printf("-C or --config path     - set 'path' to be config file\n");
 #ifdef _WIN32
             printf("-D or --debug           - force debug output logging\n");
@@ -690,6 +712,16 @@ usage:
             instru_enabled = 1;
             sscanf(argv[++c], "%llu", &instru_run_ms);
 #endif
+        } else if (!strcasecmp(argv[c], "--devaudit") || !strcasecmp(argv[c], "-A")) {
+            device_audit = 1;
+        } else if (!strcasecmp(argv[c], "--bench") || !strcasecmp(argv[c], "-B")) {
+            if ((c + 1) == argc)
+                goto usage;
+
+            sscanf(argv[++c], "%llu,%1023s", &bench_run_ms, bench_fn);
+            if ((bench_run_ms == 0) || (bench_fn[0] == '\0'))
+                goto usage;
+            bench_enabled = 1;
         }
 
         /* Uhm... out of options here.. */
@@ -950,20 +982,25 @@ pc_init_modules(void)
         }
     }
 
-    pc_log("Scanning for ROM images:\n");
-    c = m = 0;
-    while (machine_get_internal_name_ex(m) != NULL) {
-        c += machine_available(m);
-        m++;
-    }
-    if (c == 0) {
-        /* No usable ROMs found, aborting. */
-        return 0;
-    }
-    pc_log("A total of %d ROM sets have been loaded.\n", c);
+    /* Load the ROMs for the selected machine. If it is there, probe the
+       rest of the table on a worker thread: the results only matter to
+       the settings dialog, and scanning a network-mounted ROM set
+       serially here used to stall startup for seconds. */
+    if (machine_available(machine))
+        machine_scan_start();
+    else {
+        pc_log("Scanning for ROM images:\n");
+        c = m = 0;
+        while (machine_get_internal_name_ex(m) != NULL) {
+            c += machine_available(m);
+            m++;
+        }
+        if (c == 0) {
+            /* No usable ROMs found, aborting. */
+            return 0;
+        }
+        pc_log("A total of %d ROM sets have been loaded.\n", c);
 
-    /* Load the ROMs for the selected machine. */
-    if (!machine_available(machine)) {
         swprintf(temp, sizeof_w(temp), plat_get_string(STRING_HW_NOT_AVAILABLE_MACHINE), machine_getname());
         c       = 0;
         machine = -1;
@@ -1086,6 +1123,10 @@ pc_reset_hard_close(void)
 {
     ui_sb_set_ready(0);
 
+    /* The memory layout is about to change. */
+    savestate_invalidate();
+    rewind_reset();
+
     /* Close all the memory mappings. */
     mem_close();
 
@@ -1159,6 +1200,12 @@ pc_reset_hard_init(void)
 
     device_init();
 
+    /* Start opening and probing the configured hard disk images on a
+       worker thread; the disk controllers pick up the results when their
+       init reaches them, so the host file I/O overlaps ROM loading and
+       device setup below. */
+    hdd_image_preload_all();
+
     sound_reset();
 
     scsi_reset();
@@ -1331,9 +1378,16 @@ pc_reset_hard(void)
 void
 pc_close(UNUSED(thread_t *ptr))
 {
+    /* The availability scan may still be walking the ROM set. */
+    machine_scan_wait();
+
     /* Wait a while so things can shut down. */
     plat_delay_ms(200);
 
+    /* Leave a final counter snapshot in the log. */
+    perf_dump();
+    timer_cost_dump();
+
     /* Claim the video blitter. */
     startblit();
 
@@ -1405,6 +1459,28 @@ ack_pause(void)
     }
 }
 
+/* Scale the host elapsed time fed into the frame pacer. While this instance
+   is in the background and a cap is configured, emulation bursts are only
+   credited background_speed_cap percent of the real elapsed time, so the
+   machine runs at that fraction of full speed; the remainder accumulator
+   keeps the long-term rate exact. Accrual returns to 1:1 the moment the
+   window regains focus. */
+int
+pc_governor_elapsed(int elapsed)
+{
+    static int remainder = 0;
+
+    if (!background_speed_cap || (background_speed_cap >= 100) || !pc_in_background) {
+        remainder = 0;
+        return elapsed;
+    }
+
+    elapsed   = (elapsed * background_speed_cap) + remainder;
+    remainder = elapsed % 100;
+
+    return elapsed / 100;
+}
+
 void
 pc_run(void)
 {
@@ -1453,6 +1529,48 @@ pc_run(void)
     }
 }
 
+/* Background balloon: while this instance sits unfocused, walk guest RAM in
+   chunks and hand it back to the host with paging hints (plat_balloon_out()).
+   The host compresses or swaps the cold pages - zram/zswap on density hosts -
+   cutting the resident size of idle instances, and anything the guest still
+   touches simply faults back in, so the kernel's reference bits are the cold
+   filter. One sweep runs per backgrounding episode, starting a few seconds
+   after focus loss so brief focus changes cost nothing. */
+#define BALLOON_DELAY 5         /* seconds in background before the sweep starts */
+#define BALLOON_CHUNK (2 << 20) /* bytes advised out per one-second tick */
+
+static void
+pc_balloon_onesec(void)
+{
+    static uint64_t balloon_offs      = 0;
+    static int      balloon_countdown = BALLOON_DELAY;
+    uint64_t        total             = ((uint64_t) mem_size) << 10;
+    uint64_t        low               = (total > (1ULL << 30)) ? (1ULL << 30) : total;
+    uint64_t        chunk;
+
+    if (!background_balloon || !pc_in_background) {
+        /* Reset so the next backgrounding episode sweeps again. */
+        balloon_offs      = 0;
+        balloon_countdown = BALLOON_DELAY;
+        return;
+    }
+
+    if (balloon_countdown > 0) {
+        balloon_countdown--;
+        return;
+    }
+
+    if (balloon_offs < low) {
+        chunk = ((low - balloon_offs) < BALLOON_CHUNK) ? (low - balloon_offs) : BALLOON_CHUNK;
+        plat_balloon_out(ram + balloon_offs, (size_t) chunk);
+        balloon_offs += chunk;
+    } else if ((balloon_offs < total) && (ram2 != NULL)) {
+        chunk = ((total - balloon_offs) < BALLOON_CHUNK) ? (total - balloon_offs) : BALLOON_CHUNK;
+        plat_balloon_out(ram2 + (balloon_offs - low), (size_t) chunk);
+        balloon_offs += chunk;
+    }
+}
+
 /* Handler for the 1-second timer to refresh the window title. */
 void
 pc_onesec(void)
@@ -1460,6 +1578,8 @@ pc_onesec(void)
     fps        = framecount;
     framecount = 0;
 
+    pc_balloon_onesec();
+
     title_update = 1;
 }
 
@@ -142,7 +142,7 @@ acpi_gp_timer_update(acpi_t *dev, bool enable, int count)
         acpi_count = count;
         timer_on_auto(&dev->gp_timer, (1000000.0 / (double) ACPI_TIMER_FREQ) * ((double) count));
     } else
-        timer_stop(&dev->timer);
+        timer_stop(&dev->gp_timer);
 }
 
 void
@@ -991,12 +991,23 @@ acpi_reg_write_common_regs(UNUSED(int size), uint16_t addr, uint8_t val, void *p
             dev->regs.pmsts &= ~((val << shift16) & 0x8d31);
             if ((addr == 0x01) && (val & 0x04))
                 acpi_rtc_status = 0;
+            /* Clearing TMROF_STS while TMROF_EN is set re-arms the overflow timer. */
+            acpi_timer_update(dev, (dev->regs.pmen & TMROF_EN) && !(dev->regs.pmsts & TMROF_STS));
             acpi_update_irq(dev);
             break;
         case 0x02:
         case 0x03:
             /* PMEN - Power Management Resume Enable Register (IO) */
+            old = !!(dev->regs.pmen & PWRBTN_EN);
             dev->regs.pmen = ((dev->regs.pmen & ~(0xff << shift16)) | (val << shift16)) & 0x0521;
+            /* The power button poll and the timer overflow timer only run while
+               the guest has the matching enable bit set. */
+            if (!old && (dev->regs.pmen & PWRBTN_EN)) {
+                acpi_pwrbut_pressed = 0;
+                timer_on_auto(&dev->pwrbtn_timer, 16. * 1000.);
+            } else if (old && !(dev->regs.pmen & PWRBTN_EN))
+                timer_stop(&dev->pwrbtn_timer);
+            acpi_timer_update(dev, (dev->regs.pmen & TMROF_EN) && !(dev->regs.pmsts & TMROF_STS));
             acpi_update_irq(dev);
             break;
         case 0x04:
@@ -2273,7 +2284,8 @@ acpi_pwrbtn_timer(void *priv)
 {
     acpi_t *dev = (acpi_t *) priv;
 
-    timer_on_auto(&dev->pwrbtn_timer, 16. * 1000.);
+    if (dev->regs.pmen & PWRBTN_EN)
+        timer_on_auto(&dev->pwrbtn_timer, 16. * 1000.);
     if (acpi_pwrbut_pressed) {
         acpi_pwrbut_pressed = 0;
         if (dev->regs.pmen & PWRBTN_EN) {
@@ -2405,6 +2417,10 @@ acpi_reset(void *priv)
 
     timer_disable(&dev->per_timer);
 
+    /* The enable bits these run off were just cleared above. */
+    timer_disable(&dev->timer);
+    timer_disable(&dev->pwrbtn_timer);
+
     if ((dev->vendor == VEN_SIS_5595_1997) || (dev->vendor == VEN_SIS_5595)) {
         dev->regs.reg_13 = 0x20;
         dev->regs.gp_tmr = 0xff;
@@ -2558,8 +2574,6 @@ acpi_init(const device_t *info)
     timer_add(&dev->resume_timer, acpi_timer_resume, dev, 0);
     timer_add(&dev->pwrbtn_timer, acpi_pwrbtn_timer, dev, 0);
 
-    timer_on_auto(&dev->pwrbtn_timer, 16. * 1000.);
-
     acpi_reset(dev);
 
     acpi_enabled  = 1;
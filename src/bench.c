@@ -0,0 +1,134 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Implementation of the benchmark mode: run a fixed amount of
+ *          emulated time against a scripted config, collect throughput
+ *          counters and write them out as a JSON report that CI can
+ *          diff between builds.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <86box/86box.h>
+#include "cpu.h"
+#include <86box/bench.h>
+#include <86box/machine.h>
+#include <86box/plat.h>
+#include <86box/version.h>
+
+int      bench_enabled  = 0;
+char     bench_fn[1024] = { '\0' };
+uint64_t bench_run_ms   = 0;
+
+uint64_t bench_codegen_blocks   = 0;
+uint64_t bench_audio_underruns  = 0;
+uint64_t bench_blit_fast        = 0;
+uint64_t bench_blit_slow        = 0;
+
+static uint64_t host_start_ms = 0;
+
+/* Host-time statistics over the frames actually submitted to the blitter. */
+static uint64_t frame_count   = 0;
+static uint64_t frame_last_ms = 0;
+static uint64_t frame_sum_ms  = 0;
+static uint64_t frame_min_ms  = 0;
+static uint64_t frame_max_ms  = 0;
+
+void
+bench_start(void)
+{
+    host_start_ms = plat_get_ticks();
+
+    frame_count   = 0;
+    frame_last_ms = 0;
+    frame_sum_ms  = 0;
+    frame_min_ms  = 0;
+    frame_max_ms  = 0;
+
+    bench_codegen_blocks  = 0;
+    bench_audio_underruns = 0;
+    bench_blit_fast       = 0;
+    bench_blit_slow       = 0;
+}
+
+/* Called from the video blitter whenever monitor 0 submits a frame. */
+void
+bench_frame(void)
+{
+    uint64_t now = plat_get_ticks();
+
+    if (frame_last_ms != 0) {
+        uint64_t delta = now - frame_last_ms;
+
+        frame_sum_ms += delta;
+        if ((frame_count == 1) || (delta < frame_min_ms))
+            frame_min_ms = delta;
+        if (delta > frame_max_ms)
+            frame_max_ms = delta;
+    }
+
+    frame_last_ms = now;
+    frame_count++;
+}
+
+static void
+bench_report(uint64_t emulated_ms, uint64_t host_ms)
+{
+    FILE *fp = plat_fopen(bench_fn, "w");
+
+    if (fp == NULL) {
+        fprintf(stderr, "Benchmark: unable to open report file %s\n", bench_fn);
+        return;
+    }
+
+    if (host_ms == 0)
+        host_ms = 1;
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"version\": \"%s\",\n", EMU_VERSION_FULL);
+    fprintf(fp, "  \"machine\": \"%s\",\n", machine_get_internal_name());
+    fprintf(fp, "  \"emulated_ms\": %llu,\n", (unsigned long long) emulated_ms);
+    fprintf(fp, "  \"host_ms\": %llu,\n", (unsigned long long) host_ms);
+    fprintf(fp, "  \"speed_percent\": %.2f,\n", (double) emulated_ms * 100.0 / (double) host_ms);
+    /* There is no retired-instruction counter in either execution core, so
+       the throughput figure is emulated clock cycles per host second. */
+    fprintf(fp, "  \"emulated_mhz\": %.2f,\n", (double) tsc / ((double) host_ms * 1000.0));
+    fprintf(fp, "  \"frames\": %llu,\n", (unsigned long long) frame_count);
+    fprintf(fp, "  \"fps\": %.2f,\n", (double) frame_count * 1000.0 / (double) host_ms);
+    fprintf(fp, "  \"frame_ms_min\": %llu,\n", (unsigned long long) frame_min_ms);
+    fprintf(fp, "  \"frame_ms_avg\": %.2f,\n", (frame_count > 1) ? ((double) frame_sum_ms / (double) (frame_count - 1)) : 0.0);
+    fprintf(fp, "  \"frame_ms_max\": %llu,\n", (unsigned long long) frame_max_ms);
+    fprintf(fp, "  \"codegen_blocks\": %llu,\n", (unsigned long long) bench_codegen_blocks);
+    fprintf(fp, "  \"audio_underruns\": %llu,\n", (unsigned long long) bench_audio_underruns);
+    fprintf(fp, "  \"blit_fast_ops\": %llu,\n", (unsigned long long) bench_blit_fast);
+    fprintf(fp, "  \"blit_slow_ops\": %llu\n", (unsigned long long) bench_blit_slow);
+    fprintf(fp, "}\n");
+
+    fclose(fp);
+}
+
+/* Called from the main loop after every block of emulation; returns 1 once
+   the requested amount of emulated time has elapsed and the report has been
+   written, at which point the caller shuts the machine down. */
+int
+bench_tick(void)
+{
+    uint64_t emulated_ms = (uint64_t) ((double) tsc / cpu_s->rspeed * 1000);
+
+    if (emulated_ms < bench_run_ms)
+        return 0;
+
+    bench_report(emulated_ms, plat_get_ticks() - host_start_ms);
+
+    return 1;
+}
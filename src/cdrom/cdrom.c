@@ -16,6 +16,7 @@
  */
 #include <inttypes.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -33,6 +34,7 @@
 #include <86box/scsi.h>
 #include <86box/scsi_device.h>
 #include <86box/sound.h>
+#include <86box/thread.h>
 
 /* The addresses sent from the guest are absolute, ie. a LBA of 0 corresponds to a MSF of 00:00:00. Otherwise, the counter displayed by the guest is wrong:
    there is a seeming 2 seconds in which audio plays but counter does not move, while a data track before audio jumps to 2 seconds before the actual start
@@ -96,6 +98,37 @@ cdrom_t cdrom[CDROM_NUM];
 
 int cdrom_interface_current;
 
+/* Decode-ahead state for CD audio playback. A worker thread per drive pulls
+   audio sectors from the image backend into a lock-free single-producer/
+   single-consumer ring (same scheme as the network packet queues: the
+   producer only writes head, the consumer only writes tail, each published
+   with release ordering after the slot is filled or drained). The sound CD
+   thread then only copies sectors out of the ring, so a guest-issued seek
+   no longer stalls the mixer on image I/O - stale sectors are simply
+   dropped by their LBA tag and the worker is pointed at the new run. */
+#define PREFETCH_SECTORS 32 /* must be a power of two; ~0.85 s of audio */
+#define PREFETCH_MASK    (PREFETCH_SECTORS - 1)
+
+typedef struct prefetch_slot_t {
+    uint32_t lba;
+    int      ok;
+    int16_t  pcm[RAW_SECTOR_SIZE / 2];
+} prefetch_slot_t;
+
+typedef struct prefetch_t {
+    thread_t       *thread;
+    event_t        *wake_event;
+    mutex_t        *backend_mutex; /* serializes audio-path read_sector calls */
+    volatile int    run;
+    atomic_int      head; /* producer index */
+    atomic_int      tail; /* consumer index */
+    atomic_uint     req_pos; /* next LBA the producer should fetch */
+    atomic_uint     req_gen; /* bumped whenever req_pos is (re)posted */
+    prefetch_slot_t slots[PREFETCH_SECTORS];
+} prefetch_t;
+
+static prefetch_t cdrom_prefetch[CDROM_NUM];
+
 #ifdef ENABLE_CDROM_LOG
 int cdrom_do_log = ENABLE_CDROM_LOG;
 
@@ -114,6 +147,148 @@ cdrom_log(const char *fmt, ...)
 #    define cdrom_log(fmt, ...)
 #endif
 
+/* Point the decode-ahead worker at a new run of audio sectors. Anything
+   already in the ring keeps its old LBA tag and is dropped on the consumer
+   side, so this is all a seek has to do. */
+static void
+cdrom_prefetch_request(cdrom_t *dev, uint32_t lba)
+{
+    prefetch_t *pf = &cdrom_prefetch[dev->id];
+
+    if (pf->thread == NULL)
+        return;
+
+    atomic_store_explicit(&pf->req_pos, lba, memory_order_relaxed);
+    atomic_fetch_add_explicit(&pf->req_gen, 1, memory_order_release);
+    thread_set_event(pf->wake_event);
+}
+
+static void
+cdrom_prefetch_thread(void *param)
+{
+    cdrom_t    *dev      = (cdrom_t *) param;
+    prefetch_t *pf       = &cdrom_prefetch[dev->id];
+    uint32_t    seen_gen = 0;
+    uint32_t    gen;
+    uint32_t    fetch_pos = 0;
+    int         head;
+
+    while (pf->run) {
+        thread_wait_event(pf->wake_event, 10);
+        thread_reset_event(pf->wake_event);
+
+        if (!pf->run)
+            break;
+
+        gen = atomic_load_explicit(&pf->req_gen, memory_order_acquire);
+        if (gen != seen_gen) {
+            seen_gen  = gen;
+            fetch_pos = atomic_load_explicit(&pf->req_pos, memory_order_relaxed);
+        }
+
+        while ((dev->cd_status == CD_STATUS_PLAYING) && (dev->ops != NULL) && (fetch_pos < dev->cd_end)) {
+            head = atomic_load_explicit(&pf->head, memory_order_relaxed);
+            if (((head + 1) & PREFETCH_MASK) == (atomic_load_explicit(&pf->tail, memory_order_acquire) & PREFETCH_MASK))
+                break; /* ring full */
+
+            prefetch_slot_t *slot = &pf->slots[head & PREFETCH_MASK];
+
+            /* Re-check ops under the mutex: an eject tears the backend
+               down while holding it. */
+            thread_wait_mutex(pf->backend_mutex);
+            const cdrom_ops_t *ops = dev->ops;
+            slot->ok = (ops != NULL) ? ops->read_sector(dev, CD_READ_AUDIO, (uint8_t *) slot->pcm, fetch_pos) : 0;
+            thread_release_mutex(pf->backend_mutex);
+            slot->lba = fetch_pos;
+
+            atomic_store_explicit(&pf->head, head + 1, memory_order_release);
+            fetch_pos++;
+
+            /* A seek may have been posted while we were reading. */
+            if (atomic_load_explicit(&pf->req_gen, memory_order_acquire) != seen_gen)
+                break;
+        }
+    }
+}
+
+/* Consumer side, called from the sound CD thread. Returns the read result
+   exactly like ops->read_sector() would. Falls back to a synchronous read
+   if the worker has not caught up yet. */
+static int
+cdrom_prefetch_pull(cdrom_t *dev, uint8_t *b, uint32_t lba)
+{
+    prefetch_t *pf = &cdrom_prefetch[dev->id];
+    int         ret;
+
+    if (pf->thread == NULL)
+        return dev->ops->read_sector(dev, CD_READ_AUDIO, b, lba);
+
+    for (;;) {
+        const int tail = atomic_load_explicit(&pf->tail, memory_order_relaxed);
+        if (atomic_load_explicit(&pf->head, memory_order_acquire) == tail)
+            break; /* ring empty */
+
+        prefetch_slot_t *slot = &pf->slots[tail & PREFETCH_MASK];
+        if (slot->lba != lba) {
+            /* Stale sector from before a seek - drop it. */
+            atomic_store_explicit(&pf->tail, tail + 1, memory_order_release);
+            continue;
+        }
+
+        ret = slot->ok;
+        if (ret)
+            memcpy(b, slot->pcm, RAW_SECTOR_SIZE);
+        atomic_store_explicit(&pf->tail, tail + 1, memory_order_release);
+
+        /* Keep the worker ahead of us. */
+        thread_set_event(pf->wake_event);
+        return ret;
+    }
+
+    thread_wait_mutex(pf->backend_mutex);
+    ret = (dev->ops != NULL) ? dev->ops->read_sector(dev, CD_READ_AUDIO, b, lba) : 0;
+    thread_release_mutex(pf->backend_mutex);
+
+    cdrom_prefetch_request(dev, lba + 1);
+    return ret;
+}
+
+static void
+cdrom_prefetch_start(cdrom_t *dev)
+{
+    prefetch_t *pf = &cdrom_prefetch[dev->id];
+
+    if (pf->thread != NULL)
+        return;
+
+    pf->run           = 1;
+    pf->head          = 0;
+    pf->tail          = 0;
+    pf->req_pos       = 0;
+    pf->req_gen       = 0;
+    pf->wake_event    = thread_create_event();
+    pf->backend_mutex = thread_create_mutex();
+    pf->thread        = thread_create_named(cdrom_prefetch_thread, dev, "cdrom_prefetch");
+}
+
+static void
+cdrom_prefetch_stop(cdrom_t *dev)
+{
+    prefetch_t *pf = &cdrom_prefetch[dev->id];
+
+    if (pf->thread == NULL)
+        return;
+
+    pf->run = 0;
+    thread_set_event(pf->wake_event);
+    thread_wait(pf->thread);
+    thread_destroy_event(pf->wake_event);
+    thread_close_mutex(pf->backend_mutex);
+    pf->thread        = NULL;
+    pf->wake_event    = NULL;
+    pf->backend_mutex = NULL;
+}
+
 static const device_t cdrom_interface_none_device = {
     .name          = "None",
     .internal_name = "none",
@@ -452,8 +627,8 @@ cdrom_audio_callback(cdrom_t *dev, int16_t *output, int len)
 
     while (dev->cd_buflen < len) {
         if (dev->seek_pos < dev->cd_end) {
-            if (dev->ops->read_sector(dev, CD_READ_AUDIO, (uint8_t *) &(dev->cd_buffer[dev->cd_buflen]),
-                                      dev->seek_pos)) {
+            if (cdrom_prefetch_pull(dev, (uint8_t *) &(dev->cd_buffer[dev->cd_buflen]),
+                                    dev->seek_pos)) {
                 cdrom_log("CD-ROM %i: Read LBA %08X successful\n", dev->id, dev->seek_pos);
                 dev->seek_pos++;
                 dev->cd_buflen += (RAW_SECTOR_SIZE / 2);
@@ -570,6 +745,7 @@ cdrom_audio_play(cdrom_t *dev, uint32_t pos, uint32_t len, int ismsf)
     dev->cd_end    = len;
     dev->cd_status = CD_STATUS_PLAYING;
     dev->cd_buflen = 0;
+    cdrom_prefetch_request(dev, pos);
     return 1;
 }
 
@@ -633,6 +809,8 @@ cdrom_audio_track_search(cdrom_t *dev, uint32_t pos, int type, uint8_t playbit)
     cdrom_log("Track Search Toshiba: Muted?=%d, LBA=%08X.\n", dev->audio_muted_soft, pos);
     dev->cd_buflen = 0;
     dev->cd_status = playbit ? CD_STATUS_PLAYING : CD_STATUS_PAUSED;
+    if (playbit)
+        cdrom_prefetch_request(dev, dev->seek_pos);
     return 1;
 }
 
@@ -667,6 +845,8 @@ cdrom_audio_track_search_pioneer(cdrom_t *dev, uint32_t pos, uint8_t playbit)
 
     dev->cd_buflen = 0;
     dev->cd_status = playbit ? CD_STATUS_PLAYING : CD_STATUS_PAUSED;
+    if (playbit)
+        cdrom_prefetch_request(dev, dev->seek_pos);
     return 1;
 }
 
@@ -689,6 +869,7 @@ cdrom_audio_play_pioneer(cdrom_t *dev, uint32_t pos)
     dev->audio_muted_soft = 0;
     dev->cd_buflen = 0;
     dev->cd_status = CD_STATUS_PLAYING;
+    cdrom_prefetch_request(dev, dev->seek_pos);
     return 1;
 }
 
@@ -731,6 +912,7 @@ cdrom_audio_play_toshiba(cdrom_t *dev, uint32_t pos, int type)
     cdrom_log("Toshiba Play Audio: Muted?=%d, LBA=%08X.\n", dev->audio_muted_soft, pos);
     dev->cd_buflen = 0;
     dev->cd_status = CD_STATUS_PLAYING;
+    cdrom_prefetch_request(dev, dev->seek_pos);
     return 1;
 }
 
@@ -788,8 +970,11 @@ cdrom_audio_scan(cdrom_t *dev, uint32_t pos, int type)
 void
 cdrom_audio_pause_resume(cdrom_t *dev, uint8_t resume)
 {
-    if ((dev->cd_status == CD_STATUS_PLAYING) || (dev->cd_status == CD_STATUS_PAUSED))
+    if ((dev->cd_status == CD_STATUS_PLAYING) || (dev->cd_status == CD_STATUS_PAUSED)) {
         dev->cd_status = (dev->cd_status & 0xfe) | (resume & 0x01);
+        if (dev->cd_status == CD_STATUS_PLAYING)
+            cdrom_prefetch_request(dev, dev->seek_pos);
+    }
 }
 
 uint8_t
@@ -1389,6 +1574,7 @@ cdrom_mitsumi_audio_play(cdrom_t *dev, uint32_t pos, uint32_t len)
     dev->cd_end    = len;
     dev->cd_status = CD_STATUS_PLAYING;
     dev->cd_buflen = 0;
+    cdrom_prefetch_request(dev, pos);
 
     return 1;
 }
@@ -1917,6 +2103,44 @@ cdrom_readsector_raw(cdrom_t *dev, uint8_t *buffer, int sector, int ismsf, int c
     return 1;
 }
 
+/* Batched plain data read: the equivalent of READ (6)/(10)/(12) reading
+   count sectors of 2048 bytes of user data each. The sectors go straight
+   from the image backend into the destination buffer, skipping the raw
+   sector staging that cdrom_readsector_raw() does per sector - the backend
+   read-ahead cache turns the run into large sequential file reads. Returns
+   0 if any sector in the run is not yielding 2048 bytes of user data
+   (audio, or Mode 2 other than Form 1), like the one-at-a-time path would. */
+int
+cdrom_readsector_cooked_batch(cdrom_t *dev, uint8_t *buffer, uint32_t lba, int count)
+{
+    int track_type;
+    int mode2;
+
+    if (dev->cd_status == CD_STATUS_EMPTY)
+        return 0;
+
+    for (int i = 0; i < count; i++) {
+        track_type = dev->ops->track_type ? dev->ops->track_type(dev, lba + i) : 0;
+        mode2      = track_type & ~CD_TRACK_AUDIO;
+
+        if (track_type & CD_TRACK_AUDIO) {
+            cdrom_log("CD-ROM %i: [Any Data] Attempting to read a data sector from an audio track\n", dev->id);
+            return 0;
+        }
+        if (mode2 && ((mode2 & 0x03) != 1)) {
+            cdrom_log("CD-ROM %i: [Any Data] Attempting to read a data sector whose cooked size is not 2048 bytes\n", dev->id);
+            return 0;
+        }
+
+        /* A failed backend read comes back as a zeroed sector, the same as
+           the staging path whose buffer is cleared beforehand. */
+        if (!dev->ops->read_sector(dev, CD_READ_DATA, buffer + (((uint32_t) i) << 11), lba + i))
+            memset(buffer + (((uint32_t) i) << 11), 0x00, COOKED_SECTOR_SIZE);
+    }
+
+    return 1;
+}
+
 /* Peform a master init on the entire module. */
 void
 cdrom_global_init(void)
@@ -1976,6 +2200,8 @@ cdrom_hard_reset(void)
                 else
                     cdrom_image_open(dev, dev->image_path);
             }
+
+            cdrom_prefetch_start(dev);
         }
     }
 
@@ -1990,6 +2216,8 @@ cdrom_close(void)
     for (uint8_t i = 0; i < CDROM_NUM; i++) {
         dev = &cdrom[i];
 
+        cdrom_prefetch_stop(dev);
+
         if (dev->bus_type == CDROM_BUS_SCSI)
             memset(&scsi_devices[dev->scsi_device_id], 0x00, sizeof(scsi_device_t));
 
@@ -2030,8 +2258,14 @@ cdrom_eject(uint8_t id)
 
     strcpy(dev->prev_image_path, dev->image_path);
 
+    /* Take the audio prefetch mutex so the backend is not torn down under
+       an in-flight decode-ahead read. */
+    if (cdrom_prefetch[dev->id].thread != NULL)
+        thread_wait_mutex(cdrom_prefetch[dev->id].backend_mutex);
     dev->ops->exit(dev);
     dev->ops = NULL;
+    if (cdrom_prefetch[dev->id].thread != NULL)
+        thread_release_mutex(cdrom_prefetch[dev->id].backend_mutex);
     memset(dev->image_path, 0, sizeof(dev->image_path));
 
     cdrom_insert(id);
@@ -2052,9 +2286,13 @@ cdrom_reload(uint8_t id)
         return;
     }
 
+    if (cdrom_prefetch[dev->id].thread != NULL)
+        thread_wait_mutex(cdrom_prefetch[dev->id].backend_mutex);
     if (dev->ops && dev->ops->exit)
         dev->ops->exit(dev);
     dev->ops = NULL;
+    if (cdrom_prefetch[dev->id].thread != NULL)
+        thread_release_mutex(cdrom_prefetch[dev->id].backend_mutex);
     memset(dev->image_path, 0, sizeof(dev->image_path));
 
     if (strlen(dev->image_path) > 0) {
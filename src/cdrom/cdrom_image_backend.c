@@ -66,6 +66,10 @@ cdrom_image_backend_log(const char *fmt, ...)
 #    define cdrom_image_backend_log(fmt, ...)
 #endif
 
+/* Read-ahead cache size for the binary backend - enough for streaming
+   workloads (FMV playback) to stay out of the host I/O path. */
+#define BIN_CACHE_SIZE (2 << 20)
+
 /* Binary file functions. */
 static int
 bin_read(void *priv, uint8_t *buffer, uint64_t seek, size_t count)
@@ -78,6 +82,41 @@ bin_read(void *priv, uint8_t *buffer, uint64_t seek, size_t count)
     if ((tf = (track_file_t *) priv)->fp == NULL)
         return 0;
 
+    /* Serve the request from the read-ahead cache when it is covered. */
+    if ((tf->cache != NULL) && (seek >= tf->cache_start) && ((seek + count) <= (tf->cache_start + tf->cache_len))) {
+        memcpy(buffer, &tf->cache[seek - tf->cache_start], count);
+        tf->next_seek = seek + count;
+        return 1;
+    }
+
+    /* A request continuing where the last one ended is a sequential run -
+       read a whole cache's worth ahead of the stream in one go. */
+    if ((seek == tf->next_seek) && (count <= BIN_CACHE_SIZE)) {
+        if (tf->cache == NULL)
+            tf->cache = (uint8_t *) malloc(BIN_CACHE_SIZE);
+        if (tf->cache != NULL) {
+            if (fseeko64(tf->fp, seek, SEEK_SET) == -1) {
+#ifdef ENABLE_CDROM_IMAGE_BACKEND_LOG
+                cdrom_image_backend_log("CDROM: binary_read failed during seek!\n");
+#endif
+                return 0;
+            }
+            tf->cache_start = seek;
+            tf->cache_len   = fread(tf->cache, 1, BIN_CACHE_SIZE, tf->fp);
+            if (count > tf->cache_len) {
+#ifdef ENABLE_CDROM_IMAGE_BACKEND_LOG
+                cdrom_image_backend_log("CDROM: binary_read failed during read!\n");
+#endif
+                return 0;
+            }
+            memcpy(buffer, tf->cache, count);
+            tf->next_seek = seek + count;
+            return 1;
+        }
+    }
+
+    tf->next_seek = seek + count;
+
     if (fseeko64(tf->fp, seek, SEEK_SET) == -1) {
 #ifdef ENABLE_CDROM_IMAGE_BACKEND_LOG
         cdrom_image_backend_log("CDROM: binary_read failed during seek!\n");
@@ -125,6 +164,11 @@ bin_close(void *priv)
         tf->fp = NULL;
     }
 
+    if (tf->cache != NULL) {
+        free(tf->cache);
+        tf->cache = NULL;
+    }
+
     memset(tf->fn, 0x00, sizeof(tf->fn));
 
     free(priv);
@@ -143,6 +187,9 @@ bin_init(const char *filename, int *error)
 
     memset(tf->fn, 0x00, sizeof(tf->fn));
     strncpy(tf->fn, filename, sizeof(tf->fn) - 1);
+    tf->cache       = NULL;
+    tf->cache_start = tf->cache_len = 0;
+    tf->next_seek   = 0;
     tf->fp = plat_fopen64(tf->fn, "rb");
     cdrom_image_backend_log("CDROM: binary_open(%s) = %08lx\n", tf->fn, tf->fp);
 
@@ -241,6 +288,9 @@ cdi_set_device(cd_img_t *cdi, const char *path)
     if ((ret = cdi_load_cue(cdi, path)))
         return ret;
 
+    if ((ret = cdi_load_chd(cdi, path)))
+        return ret;
+
     if ((ret = cdi_load_iso(cdi, path)))
         return ret;
 
@@ -522,7 +572,7 @@ cdi_can_read_pvd(track_file_t *file, uint64_t sector_size, int mode2, int form)
 }
 
 /* This reallocates the array and returns the pointer to the last track. */
-static void
+void
 cdi_track_push_back(cd_img_t *cdi, track_t *trk)
 {
     /* This has to be done so situations in which realloc would misbehave
@@ -0,0 +1,1165 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          CHD (MAME Compressed Hunks of Data) CD-ROM image back-end.
+ *
+ *          Implements a self-contained reader for version 5 CD CHDs:
+ *          the Huffman-coded hunk map, the zlib and cdzl hunk codecs
+ *          (including Mode 1 sync/ECC regeneration) and the CD track
+ *          metadata. Decompressed hunks go through an LRU cache, and a
+ *          background thread decompresses the next hunk of a sequential
+ *          run ahead of the emulated drive.
+ *
+ *          CHDs using the LZMA or FLAC codecs (chdman's cdlz/cdfl)
+ *          need libraries this tree does not carry and are rejected at
+ *          mount time with a log message; such images can be recreated
+ *          with "chdman createcd -c cdzl".
+ *
+ *
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#ifndef _LARGEFILE_SOURCE
+#    define _LARGEFILE_SOURCE
+#endif
+#ifndef _LARGEFILE64_SOURCE
+#    define _LARGEFILE64_SOURCE
+#endif
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#define HAVE_STDARG_H
+#include <86box/86box.h>
+#include <86box/plat.h>
+#include <86box/thread.h>
+#include <86box/cdrom_image_backend.h>
+
+#ifdef ENABLE_CDROM_IMAGE_CHD_LOG
+int cdrom_image_chd_do_log = ENABLE_CDROM_IMAGE_CHD_LOG;
+
+static void
+cdrom_image_chd_log(const char *fmt, ...)
+{
+    va_list ap;
+
+    if (cdrom_image_chd_do_log) {
+        va_start(ap, fmt);
+        pclog_ex(fmt, ap);
+        va_end(ap);
+    }
+}
+#else
+#    define cdrom_image_chd_log(fmt, ...)
+#endif
+
+#define MAKE_TAG(a, b, c, d)  ((uint32_t) (((a) << 24) | ((b) << 16) | ((c) << 8) | (d)))
+
+#define CHD_V5_HEADER_SIZE    124
+#define CHD_CODEC_ZLIB        MAKE_TAG('z', 'l', 'i', 'b')
+#define CHD_CODEC_CDZL        MAKE_TAG('c', 'd', 'z', 'l')
+#define CHD_METADATA_CDROM2   MAKE_TAG('C', 'H', 'T', '2')
+#define CHD_METADATA_CDROM    MAKE_TAG('C', 'H', 'T', 'R')
+
+/* Compression codes in the decoded v5 map. */
+#define COMPRESSION_TYPE_0      0
+#define COMPRESSION_TYPE_3      3
+#define COMPRESSION_NONE        4
+#define COMPRESSION_SELF        5
+#define COMPRESSION_PARENT      6
+#define COMPRESSION_RLE_SMALL   7
+#define COMPRESSION_RLE_LARGE   8
+#define COMPRESSION_SELF_0      9
+#define COMPRESSION_SELF_1      10
+#define COMPRESSION_PARENT_SELF 11
+#define COMPRESSION_PARENT_0    12
+#define COMPRESSION_PARENT_1    13
+#define COMPRESSION_ZERO        0xff /* internal: unallocated hunk, reads as zero */
+
+#define CD_FRAME_SIZE           2448
+#define CD_MAX_SECTOR_DATA      2352
+#define CD_MAX_SUBCODE_DATA     96
+#define CD_TRACK_PADDING        4
+#define CHD_MAX_TRACKS          99
+
+/* Cached decompressed hunks; with chdman's default 8-frame hunks this
+   is about 1.2 MB, in line with the binary back-end's read-ahead. */
+#define CHD_CACHE_HUNKS         64
+
+typedef struct chd_track_info_t {
+    int  frames;
+    int  pregap;
+    int  postgap;
+    char type[32];
+    char subtype[32];
+    char pgtype[32];
+} chd_track_info_t;
+
+/* One run of frames belonging to a single track, mapped into the
+   virtual linear image the cd_img_t layer seeks in. */
+typedef struct chd_extent_t {
+    uint64_t virt_start;
+    uint64_t virt_len;
+    uint32_t frame_start; /* physical CHD frame of the first stored frame */
+    uint32_t sector_size; /* bytes consumed from the head of each frame */
+} chd_extent_t;
+
+typedef struct chd_cache_entry_t {
+    uint32_t hunk;
+    uint64_t age;
+    uint8_t *data;
+} chd_cache_entry_t;
+
+typedef struct chd_t {
+    track_file_t tf; /* needs to be the first member */
+    FILE        *fp;
+
+    uint32_t hunkbytes;
+    uint32_t unitbytes;
+    uint32_t hunkcount;
+    uint64_t logicalbytes;
+    uint32_t compressors[4];
+    uint8_t *rawmap; /* 12 bytes per hunk, v5 layout */
+
+    chd_extent_t extents[CHD_MAX_TRACKS];
+    int          num_extents;
+    uint64_t     virt_len;
+
+    chd_track_info_t track_info[CHD_MAX_TRACKS + 1];
+    int              num_tracks;
+
+    /* Decompression state, guarded by the mutex below. */
+    z_stream zstr;
+    int      zstr_inited;
+    uint8_t *compbuf;
+    uint8_t *framebuf;
+    uint8_t *subbuf;
+
+    chd_cache_entry_t cache[CHD_CACHE_HUNKS];
+    uint64_t          age;
+
+    /* Read-ahead: the reader posts the next hunk of a sequential run
+       and the prefetch thread decompresses it into the cache. */
+    mutex_t          *mutex;
+    thread_t         *prefetch_thread;
+    event_t          *wake_event;
+    volatile uint32_t prefetch_hunk;
+    volatile int      closing;
+} chd_t;
+
+static const uint8_t chd_sync_header[12] = { 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 };
+
+/* GF(2^8) multiply-by-2 tables for the Mode 1 ECC generator. */
+static uint8_t ecc_f_lut[256];
+static uint8_t ecc_b_lut[256];
+static int     ecc_luts_inited = 0;
+
+static uint64_t
+get_be64(const uint8_t *p)
+{
+    return ((uint64_t) p[0] << 56) | ((uint64_t) p[1] << 48) | ((uint64_t) p[2] << 40) | ((uint64_t) p[3] << 32) | ((uint64_t) p[4] << 24) | ((uint64_t) p[5] << 16) | ((uint64_t) p[6] << 8) | (uint64_t) p[7];
+}
+
+static uint64_t
+get_be48(const uint8_t *p)
+{
+    return ((uint64_t) p[0] << 40) | ((uint64_t) p[1] << 32) | ((uint64_t) p[2] << 24) | ((uint64_t) p[3] << 16) | ((uint64_t) p[4] << 8) | (uint64_t) p[5];
+}
+
+static uint32_t
+get_be32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | (uint32_t) p[3];
+}
+
+static uint16_t
+get_be16(const uint8_t *p)
+{
+    return ((uint16_t) p[0] << 8) | (uint16_t) p[1];
+}
+
+static void
+put_be48(uint8_t *p, uint64_t v)
+{
+    p[0] = (v >> 40) & 0xff;
+    p[1] = (v >> 32) & 0xff;
+    p[2] = (v >> 24) & 0xff;
+    p[3] = (v >> 16) & 0xff;
+    p[4] = (v >> 8) & 0xff;
+    p[5] = v & 0xff;
+}
+
+static void
+put_be24(uint8_t *p, uint32_t v)
+{
+    p[0] = (v >> 16) & 0xff;
+    p[1] = (v >> 8) & 0xff;
+    p[2] = v & 0xff;
+}
+
+static void
+put_be16(uint8_t *p, uint16_t v)
+{
+    p[0] = (v >> 8) & 0xff;
+    p[1] = v & 0xff;
+}
+
+/* CCITT CRC-16 used to protect the decoded v5 map. */
+static uint16_t
+chd_crc16(const uint8_t *data, uint32_t length)
+{
+    uint16_t crc = 0xffff;
+
+    while (length-- > 0) {
+        crc ^= (uint16_t) (*data++) << 8;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+    }
+
+    return crc;
+}
+
+/*
+ * Mode 1 sync/ECC regeneration (ECMA-130 Reed-Solomon product code).
+ * The cdzl codec strips the sync and ECC fields of sectors it has
+ * verified to be regenerable, so decompression has to recreate them.
+ */
+static void
+ecc_init_luts(void)
+{
+    for (int i = 0; i < 256; i++) {
+        const int j  = (i << 1) ^ ((i & 0x80) ? 0x11d : 0);
+        ecc_f_lut[i] = j & 0xff;
+        ecc_b_lut[i ^ (j & 0xff)] = i;
+    }
+    ecc_luts_inited = 1;
+}
+
+static void
+ecc_compute_block(const uint8_t *src, uint32_t major_count, uint32_t minor_count, uint32_t major_mult, uint32_t minor_inc, uint8_t *dest)
+{
+    const uint32_t size = major_count * minor_count;
+
+    for (uint32_t major = 0; major < major_count; major++) {
+        uint32_t index = (major >> 1) * major_mult + (major & 1);
+        uint8_t  ecc_a = 0;
+        uint8_t  ecc_b = 0;
+
+        for (uint32_t minor = 0; minor < minor_count; minor++) {
+            const uint8_t temp = src[index];
+            index += minor_inc;
+            if (index >= size)
+                index -= size;
+            ecc_a ^= temp;
+            ecc_b ^= temp;
+            ecc_a = ecc_f_lut[ecc_a];
+        }
+
+        ecc_a                     = ecc_b_lut[ecc_f_lut[ecc_a] ^ ecc_b];
+        dest[major]               = ecc_a;
+        dest[major + major_count] = ecc_a ^ ecc_b;
+    }
+}
+
+static void
+ecc_generate(uint8_t *sector)
+{
+    /* P parity. */
+    ecc_compute_block(sector + 0xc, 86, 24, 2, 86, sector + 0x81c);
+    /* Q parity. */
+    ecc_compute_block(sector + 0xc, 52, 43, 86, 88, sector + 0x8c8);
+}
+
+/*
+ * Minimal MSB-first bit stream and canonical Huffman decoder, just
+ * enough for the RLE-imported 16-code tree the v5 map is packed with.
+ */
+typedef struct chd_bitstream_t {
+    const uint8_t *data;
+    uint32_t       length;
+    uint32_t       offset;
+    uint64_t       buffer;
+    int            bits;
+} chd_bitstream_t;
+
+static void
+bitstream_init(chd_bitstream_t *bs, const uint8_t *data, uint32_t length)
+{
+    bs->data   = data;
+    bs->length = length;
+    bs->offset = 0;
+    bs->buffer = 0;
+    bs->bits   = 0;
+}
+
+static uint32_t
+bitstream_read(chd_bitstream_t *bs, int numbits)
+{
+    if (numbits == 0)
+        return 0;
+
+    while (bs->bits < numbits) {
+        const uint8_t b = (bs->offset < bs->length) ? bs->data[bs->offset++] : 0;
+        bs->buffer      = (bs->buffer << 8) | b;
+        bs->bits += 8;
+    }
+
+    bs->bits -= numbits;
+    return (uint32_t) (bs->buffer >> bs->bits) & ((1u << numbits) - 1);
+}
+
+#define HUFF_NUM_CODES 16
+#define HUFF_MAX_BITS  8
+
+typedef struct chd_huffman_t {
+    uint8_t  numbits[HUFF_NUM_CODES];
+    uint32_t bits[HUFF_NUM_CODES];
+    uint16_t lookup[1 << HUFF_MAX_BITS]; /* (code << 5) | length */
+} chd_huffman_t;
+
+static int
+huffman_assign_canonical_codes(chd_huffman_t *huff)
+{
+    uint32_t bithisto[HUFF_MAX_BITS + 1] = { 0 };
+    uint32_t curstart                    = 0;
+
+    for (int i = 0; i < HUFF_NUM_CODES; i++) {
+        if (huff->numbits[i] > HUFF_MAX_BITS)
+            return 0;
+        if (huff->numbits[i] > 0)
+            bithisto[huff->numbits[i]]++;
+    }
+
+    /* Work down from the longest code length, pairing off codes. */
+    for (int codelen = HUFF_MAX_BITS; codelen > 0; codelen--) {
+        const uint32_t nextstart = (curstart + bithisto[codelen]) >> 1;
+        if ((codelen != 1) && ((nextstart * 2) != (curstart + bithisto[codelen])))
+            return 0;
+        bithisto[codelen] = curstart;
+        curstart          = nextstart;
+    }
+
+    for (int i = 0; i < HUFF_NUM_CODES; i++) {
+        if (huff->numbits[i] > 0)
+            huff->bits[i] = bithisto[huff->numbits[i]]++;
+    }
+
+    /* Build the direct lookup table. */
+    memset(huff->lookup, 0x00, sizeof(huff->lookup));
+    for (int i = 0; i < HUFF_NUM_CODES; i++) {
+        if (huff->numbits[i] > 0) {
+            const int      shift = HUFF_MAX_BITS - huff->numbits[i];
+            const uint16_t value = (i << 5) | huff->numbits[i];
+            for (uint32_t fill = 0; fill < (1u << shift); fill++)
+                huff->lookup[(huff->bits[i] << shift) | fill] = value;
+        }
+    }
+
+    return 1;
+}
+
+static int
+huffman_import_tree_rle(chd_huffman_t *huff, chd_bitstream_t *bs)
+{
+    int curnode;
+
+    for (curnode = 0; curnode < HUFF_NUM_CODES;) {
+        uint32_t nodebits = bitstream_read(bs, 4);
+
+        if (nodebits != 1)
+            huff->numbits[curnode++] = nodebits;
+        else {
+            /* A one is an escape: either a true one or a repeat run. */
+            nodebits = bitstream_read(bs, 4);
+            if (nodebits == 1)
+                huff->numbits[curnode++] = 1;
+            else {
+                int repcount = bitstream_read(bs, 4) + 3;
+                if ((curnode + repcount) > HUFF_NUM_CODES)
+                    return 0;
+                while (repcount-- > 0)
+                    huff->numbits[curnode++] = nodebits;
+            }
+        }
+    }
+
+    if (curnode != HUFF_NUM_CODES)
+        return 0;
+
+    return huffman_assign_canonical_codes(huff);
+}
+
+static uint32_t
+huffman_decode_one(chd_huffman_t *huff, chd_bitstream_t *bs)
+{
+    /* Peek, look up, then drop only the consumed bits. */
+    while (bs->bits < HUFF_MAX_BITS) {
+        const uint8_t b = (bs->offset < bs->length) ? bs->data[bs->offset++] : 0;
+        bs->buffer      = (bs->buffer << 8) | b;
+        bs->bits += 8;
+    }
+
+    const uint32_t peek  = (uint32_t) (bs->buffer >> (bs->bits - HUFF_MAX_BITS)) & ((1u << HUFF_MAX_BITS) - 1);
+    const uint16_t entry = huff->lookup[peek];
+    bs->bits -= entry & 0x1f;
+    return entry >> 5;
+}
+
+/* Decode the Huffman-compressed v5 map into 12-byte-per-hunk raw form. */
+static int
+chd_decompress_map(chd_t *chd, uint64_t mapoffset)
+{
+    uint8_t       mapheader[16];
+    chd_huffman_t huff;
+
+    memset(&huff, 0x00, sizeof(huff));
+
+    if (fseeko64(chd->fp, mapoffset, SEEK_SET) == -1)
+        return 0;
+    if (fread(mapheader, 1, sizeof(mapheader), chd->fp) != sizeof(mapheader))
+        return 0;
+
+    const uint32_t mapbytes   = get_be32(&mapheader[0]);
+    const uint64_t firstoffs  = get_be48(&mapheader[4]);
+    const uint16_t mapcrc     = get_be16(&mapheader[10]);
+    const int      lengthbits = mapheader[12];
+    const int      selfbits   = mapheader[13];
+    const int      parentbits = mapheader[14];
+
+    if ((lengthbits > 32) || (selfbits > 32) || (parentbits > 32))
+        return 0;
+
+    uint8_t *compressed = (uint8_t *) malloc(mapbytes);
+    if (compressed == NULL)
+        return 0;
+    if (fread(compressed, 1, mapbytes, chd->fp) != mapbytes) {
+        free(compressed);
+        return 0;
+    }
+
+    chd_bitstream_t bs;
+    bitstream_init(&bs, compressed, mapbytes);
+
+    if (!huffman_import_tree_rle(&huff, &bs)) {
+        free(compressed);
+        return 0;
+    }
+
+    /* First pass: decode the per-hunk compression types. */
+    uint8_t lastcomp = 0;
+    int     repcount = 0;
+    for (uint32_t hunknum = 0; hunknum < chd->hunkcount; hunknum++) {
+        uint8_t *rawmap = &chd->rawmap[hunknum * 12];
+
+        if (repcount > 0) {
+            rawmap[0] = lastcomp;
+            repcount--;
+        } else {
+            const uint32_t val = huffman_decode_one(&huff, &bs);
+            if (val == COMPRESSION_RLE_SMALL) {
+                rawmap[0] = lastcomp;
+                repcount  = 2 + huffman_decode_one(&huff, &bs);
+            } else if (val == COMPRESSION_RLE_LARGE) {
+                rawmap[0] = lastcomp;
+                repcount  = 2 + 16 + (huffman_decode_one(&huff, &bs) << 4);
+                repcount += huffman_decode_one(&huff, &bs);
+            } else
+                rawmap[0] = lastcomp = val;
+        }
+    }
+
+    /* Second pass: lengths, offsets and CRCs. */
+    uint64_t curoffset   = firstoffs;
+    uint64_t last_self   = 0;
+    uint64_t last_parent = 0;
+    for (uint32_t hunknum = 0; hunknum < chd->hunkcount; hunknum++) {
+        uint8_t *rawmap = &chd->rawmap[hunknum * 12];
+        uint64_t offset = curoffset;
+        uint32_t length = 0;
+        uint16_t crc    = 0;
+
+        switch (rawmap[0]) {
+            case COMPRESSION_TYPE_0:
+            case COMPRESSION_TYPE_0 + 1:
+            case COMPRESSION_TYPE_0 + 2:
+            case COMPRESSION_TYPE_3:
+                length = bitstream_read(&bs, lengthbits);
+                curoffset += length;
+                crc = bitstream_read(&bs, 16);
+                break;
+
+            case COMPRESSION_NONE:
+                length = chd->hunkbytes;
+                curoffset += length;
+                crc = bitstream_read(&bs, 16);
+                break;
+
+            case COMPRESSION_SELF:
+                offset    = bitstream_read(&bs, selfbits);
+                last_self = offset;
+                break;
+
+            case COMPRESSION_PARENT:
+                offset      = bitstream_read(&bs, parentbits);
+                last_parent = offset;
+                break;
+
+            /* Pseudo-types, converted into the base types. */
+            case COMPRESSION_SELF_1:
+                last_self++;
+                fallthrough;
+            case COMPRESSION_SELF_0:
+                rawmap[0] = COMPRESSION_SELF;
+                offset    = last_self;
+                break;
+
+            case COMPRESSION_PARENT_SELF:
+                rawmap[0]   = COMPRESSION_PARENT;
+                last_parent = offset = (((uint64_t) hunknum) * chd->hunkbytes) / chd->unitbytes;
+                break;
+
+            case COMPRESSION_PARENT_1:
+                last_parent += chd->hunkbytes / chd->unitbytes;
+                fallthrough;
+            case COMPRESSION_PARENT_0:
+                rawmap[0] = COMPRESSION_PARENT;
+                offset    = last_parent;
+                break;
+
+            default:
+                free(compressed);
+                return 0;
+        }
+
+        put_be24(&rawmap[1], length);
+        put_be48(&rawmap[4], offset);
+        put_be16(&rawmap[10], crc);
+    }
+
+    free(compressed);
+
+    if (chd_crc16(chd->rawmap, chd->hunkcount * 12) != mapcrc) {
+        cdrom_image_chd_log("CHD: map CRC mismatch\n");
+        return 0;
+    }
+
+    return 1;
+}
+
+/* Inflate a raw deflate stream, expecting exactly destlen output bytes. */
+static int
+chd_inflate(chd_t *chd, const uint8_t *src, uint32_t srclen, uint8_t *dest, uint32_t destlen)
+{
+    z_stream *zstr = &chd->zstr;
+
+    if (inflateReset(zstr) != Z_OK)
+        return 0;
+
+    zstr->next_in   = (Bytef *) src;
+    zstr->avail_in  = srclen;
+    zstr->next_out  = dest;
+    zstr->avail_out = destlen;
+
+    const int ret = inflate(zstr, Z_FINISH);
+    return (ret == Z_STREAM_END) && (zstr->total_out == destlen);
+}
+
+/* Reassemble a hunk of CD frames from the cdzl codec's split streams. */
+static int
+chd_decompress_cdzl(chd_t *chd, const uint8_t *src, uint32_t srclen, uint8_t *dest)
+{
+    const uint32_t frames       = chd->hunkbytes / CD_FRAME_SIZE;
+    const uint32_t complen_bytes = (chd->hunkbytes < 65536) ? 2 : 3;
+    const uint32_t ecc_bytes    = (frames + 7) / 8;
+    const uint32_t header_bytes = ecc_bytes + complen_bytes;
+    uint32_t       complen_base;
+
+    if (srclen < header_bytes)
+        return 0;
+
+    complen_base = ((uint32_t) src[ecc_bytes] << 8) | src[ecc_bytes + 1];
+    if (complen_bytes > 2)
+        complen_base = (complen_base << 8) | src[ecc_bytes + 2];
+
+    if ((header_bytes + complen_base) > srclen)
+        return 0;
+
+    if (!chd_inflate(chd, &src[header_bytes], complen_base, chd->framebuf, frames * CD_MAX_SECTOR_DATA))
+        return 0;
+    if (!chd_inflate(chd, &src[header_bytes + complen_base], srclen - header_bytes - complen_base, chd->subbuf, frames * CD_MAX_SUBCODE_DATA))
+        return 0;
+
+    for (uint32_t framenum = 0; framenum < frames; framenum++) {
+        uint8_t *frame = &dest[framenum * CD_FRAME_SIZE];
+
+        memcpy(frame, &chd->framebuf[framenum * CD_MAX_SECTOR_DATA], CD_MAX_SECTOR_DATA);
+        memcpy(frame + CD_MAX_SECTOR_DATA, &chd->subbuf[framenum * CD_MAX_SUBCODE_DATA], CD_MAX_SUBCODE_DATA);
+
+        /* Marked frames had their sync and ECC stripped by the compressor. */
+        if ((src[framenum / 8] >> (framenum % 8)) & 1) {
+            memcpy(frame, chd_sync_header, sizeof(chd_sync_header));
+            ecc_generate(frame);
+        }
+    }
+
+    return 1;
+}
+
+/* Decompress hunk 'hunknum' into 'dest' (hunkbytes). Caller holds the mutex. */
+static int
+chd_read_hunk(chd_t *chd, uint32_t hunknum, uint8_t *dest)
+{
+    if (hunknum >= chd->hunkcount)
+        return 0;
+
+    const uint8_t *rawmap = &chd->rawmap[hunknum * 12];
+    const uint32_t length = (get_be32(&rawmap[0]) & 0x00ffffff);
+    const uint64_t offset = get_be48(&rawmap[4]);
+
+    switch (rawmap[0]) {
+        case COMPRESSION_TYPE_0:
+        case COMPRESSION_TYPE_0 + 1:
+        case COMPRESSION_TYPE_0 + 2:
+        case COMPRESSION_TYPE_3:
+            if (length > chd->hunkbytes)
+                return 0;
+            if (fseeko64(chd->fp, offset, SEEK_SET) == -1)
+                return 0;
+            if (fread(chd->compbuf, 1, length, chd->fp) != length)
+                return 0;
+            if (chd->compressors[rawmap[0]] == CHD_CODEC_CDZL)
+                return chd_decompress_cdzl(chd, chd->compbuf, length, dest);
+            return chd_inflate(chd, chd->compbuf, length, dest, chd->hunkbytes);
+
+        case COMPRESSION_NONE:
+            if (fseeko64(chd->fp, offset, SEEK_SET) == -1)
+                return 0;
+            return fread(dest, 1, chd->hunkbytes, chd->fp) == chd->hunkbytes;
+
+        case COMPRESSION_SELF:
+            return chd_read_hunk(chd, (uint32_t) offset, dest);
+
+        case COMPRESSION_ZERO:
+            memset(dest, 0x00, chd->hunkbytes);
+            return 1;
+
+        default:
+            return 0;
+    }
+}
+
+/* Look up a hunk in the LRU cache, decompressing on a miss. Caller
+   holds the mutex; returns NULL on decompression failure. */
+static uint8_t *
+chd_get_hunk(chd_t *chd, uint32_t hunknum)
+{
+    chd_cache_entry_t *lru = &chd->cache[0];
+
+    for (int i = 0; i < CHD_CACHE_HUNKS; i++) {
+        chd_cache_entry_t *ent = &chd->cache[i];
+
+        if ((ent->data != NULL) && (ent->hunk == hunknum)) {
+            ent->age = ++chd->age;
+            return ent->data;
+        }
+    }
+
+    /* Miss: evict the least recently used entry (empty slots first). */
+    for (int i = 0; i < CHD_CACHE_HUNKS; i++) {
+        chd_cache_entry_t *ent = &chd->cache[i];
+
+        if (ent->data == NULL) {
+            lru = ent;
+            break;
+        }
+        if (ent->age < lru->age)
+            lru = ent;
+    }
+
+    if (lru->data == NULL) {
+        lru->data = (uint8_t *) malloc(chd->hunkbytes);
+        if (lru->data == NULL)
+            return NULL;
+    }
+
+    if (!chd_read_hunk(chd, hunknum, lru->data)) {
+        cdrom_image_chd_log("CHD: failed to decompress hunk %u\n", hunknum);
+        lru->hunk = 0xffffffff;
+        lru->age  = 0;
+        return NULL;
+    }
+
+    lru->hunk = hunknum;
+    lru->age  = ++chd->age;
+    return lru->data;
+}
+
+static int
+chd_hunk_cached(chd_t *chd, uint32_t hunknum)
+{
+    for (int i = 0; i < CHD_CACHE_HUNKS; i++) {
+        if ((chd->cache[i].data != NULL) && (chd->cache[i].hunk == hunknum))
+            return 1;
+    }
+
+    return 0;
+}
+
+static void
+chd_prefetch_thread(void *priv)
+{
+    chd_t *chd = (chd_t *) priv;
+
+    while (1) {
+        thread_wait_event(chd->wake_event, -1);
+        thread_reset_event(chd->wake_event);
+
+        if (chd->closing)
+            break;
+
+        thread_wait_mutex(chd->mutex);
+        const uint32_t hunknum = chd->prefetch_hunk;
+        if ((hunknum != 0xffffffff) && !chd_hunk_cached(chd, hunknum))
+            (void) chd_get_hunk(chd, hunknum);
+        thread_release_mutex(chd->mutex);
+    }
+}
+
+/* Track file interface. */
+static int
+chd_read(void *priv, uint8_t *buffer, uint64_t seek, size_t count)
+{
+    const track_file_t *tf  = (const track_file_t *) priv;
+    chd_t              *chd = (chd_t *) tf->priv;
+    uint32_t            last_hunk = 0xffffffff;
+
+    thread_wait_mutex(chd->mutex);
+
+    while (count > 0) {
+        const chd_extent_t *ext = NULL;
+
+        for (int i = 0; i < chd->num_extents; i++) {
+            if ((seek >= chd->extents[i].virt_start) && (seek < (chd->extents[i].virt_start + chd->extents[i].virt_len))) {
+                ext = &chd->extents[i];
+                break;
+            }
+        }
+
+        if (ext == NULL) {
+            thread_release_mutex(chd->mutex);
+            return 0;
+        }
+
+        const uint64_t rel       = seek - ext->virt_start;
+        const uint64_t frame     = rel / ext->sector_size;
+        const uint32_t frame_off = (uint32_t) (rel % ext->sector_size);
+        const uint32_t physframe = ext->frame_start + (uint32_t) frame;
+        const uint32_t fph       = chd->hunkbytes / CD_FRAME_SIZE;
+        const uint32_t hunknum   = physframe / fph;
+        const uint32_t hunk_off  = ((physframe % fph) * CD_FRAME_SIZE) + frame_off;
+
+        size_t chunk = ext->sector_size - frame_off;
+        if (chunk > count)
+            chunk = count;
+        if (chunk > (size_t) ((ext->virt_start + ext->virt_len) - seek))
+            chunk = (size_t) ((ext->virt_start + ext->virt_len) - seek);
+
+        const uint8_t *hunk = chd_get_hunk(chd, hunknum);
+        if (hunk == NULL) {
+            thread_release_mutex(chd->mutex);
+            return 0;
+        }
+
+        memcpy(buffer, &hunk[hunk_off], chunk);
+        buffer += chunk;
+        seek += chunk;
+        count -= chunk;
+        last_hunk = hunknum;
+    }
+
+    /* Kick the prefetch thread at the hunk following the one we just
+       left, so sequential streams find it already decompressed. */
+    if ((last_hunk != 0xffffffff) && ((last_hunk + 1) < chd->hunkcount) && !chd_hunk_cached(chd, last_hunk + 1)) {
+        chd->prefetch_hunk = last_hunk + 1;
+        thread_release_mutex(chd->mutex);
+        thread_set_event(chd->wake_event);
+    } else
+        thread_release_mutex(chd->mutex);
+
+    return 1;
+}
+
+static uint64_t
+chd_get_length(void *priv)
+{
+    const track_file_t *tf  = (const track_file_t *) priv;
+    const chd_t        *chd = (const chd_t *) tf->priv;
+
+    return chd->virt_len;
+}
+
+static void
+chd_close(void *priv)
+{
+    track_file_t *tf  = (track_file_t *) priv;
+    chd_t        *chd = (chd_t *) tf->priv;
+
+    if (chd == NULL)
+        return;
+
+    if (chd->prefetch_thread != NULL) {
+        chd->closing = 1;
+        thread_set_event(chd->wake_event);
+        thread_wait(chd->prefetch_thread);
+        chd->prefetch_thread = NULL;
+    }
+    if (chd->wake_event != NULL) {
+        thread_destroy_event(chd->wake_event);
+        chd->wake_event = NULL;
+    }
+    if (chd->mutex != NULL) {
+        thread_close_mutex(chd->mutex);
+        chd->mutex = NULL;
+    }
+
+    for (int i = 0; i < CHD_CACHE_HUNKS; i++)
+        free(chd->cache[i].data);
+    free(chd->compbuf);
+    free(chd->framebuf);
+    free(chd->subbuf);
+    free(chd->rawmap);
+
+    if (chd->zstr_inited)
+        inflateEnd(&chd->zstr);
+
+    if (chd->fp != NULL) {
+        fclose(chd->fp);
+        chd->fp = NULL;
+    }
+
+    free(chd);
+}
+
+static int
+chd_parse_metadata(chd_t *chd, uint64_t metaoffset)
+{
+    uint8_t metaheader[16];
+    char    metadata[512];
+
+    chd->num_tracks = 0;
+
+    while (metaoffset != 0) {
+        if (fseeko64(chd->fp, metaoffset, SEEK_SET) == -1)
+            return 0;
+        if (fread(metaheader, 1, sizeof(metaheader), chd->fp) != sizeof(metaheader))
+            return 0;
+
+        const uint32_t tag    = get_be32(&metaheader[0]);
+        const uint32_t length = get_be32(&metaheader[4]) & 0x00ffffff;
+
+        if ((tag == CHD_METADATA_CDROM2) || (tag == CHD_METADATA_CDROM)) {
+            chd_track_info_t info;
+            int              track = 0;
+
+            memset(&info, 0x00, sizeof(info));
+            memset(metadata, 0x00, sizeof(metadata));
+            if (fread(metadata, 1, (length < (sizeof(metadata) - 1)) ? length : (sizeof(metadata) - 1), chd->fp) == 0)
+                return 0;
+
+            int fields;
+            if (tag == CHD_METADATA_CDROM2)
+                fields = sscanf(metadata, "TRACK:%d TYPE:%31s SUBTYPE:%31s FRAMES:%d PREGAP:%d PGTYPE:%31s PGSUB:%*s POSTGAP:%d",
+                                &track, info.type, info.subtype, &info.frames, &info.pregap, info.pgtype, &info.postgap);
+            else
+                fields = sscanf(metadata, "TRACK:%d TYPE:%31s SUBTYPE:%31s FRAMES:%d",
+                                &track, info.type, info.subtype, &info.frames);
+
+            if ((fields >= 4) && (track >= 1) && (track <= CHD_MAX_TRACKS)) {
+                chd->track_info[track] = info;
+                if (track > chd->num_tracks)
+                    chd->num_tracks = track;
+            }
+        }
+
+        metaoffset = get_be64(&metaheader[8]);
+    }
+
+    return (chd->num_tracks > 0);
+}
+
+static chd_t *
+chd_open(const char *filename, int *error)
+{
+    uint8_t header[CHD_V5_HEADER_SIZE];
+    chd_t  *chd = (chd_t *) calloc(1, sizeof(chd_t));
+
+    *error = 1;
+
+    if (chd == NULL)
+        return NULL;
+
+    if (!ecc_luts_inited)
+        ecc_init_luts();
+
+    chd->tf.priv = chd;
+
+    chd->fp = plat_fopen64(filename, "rb");
+    if (chd->fp == NULL) {
+        free(chd);
+        return NULL;
+    }
+
+    if ((fread(header, 1, sizeof(header), chd->fp) != sizeof(header)) || memcmp(header, "MComprHD", 8)) {
+        /* Not a CHD at all - fail quietly so other loaders get a shot. */
+        fclose(chd->fp);
+        free(chd);
+        return NULL;
+    }
+
+    const uint32_t version = get_be32(&header[12]);
+    if (version != 5) {
+        pclog("CHD: only version 5 images are supported (this is version %u); upgrade it with \"chdman copy\"\n", version);
+        goto fail;
+    }
+
+    for (int i = 0; i < 4; i++)
+        chd->compressors[i] = get_be32(&header[16 + (i * 4)]);
+    chd->logicalbytes      = get_be64(&header[32]);
+    const uint64_t mapoffset  = get_be64(&header[40]);
+    const uint64_t metaoffset = get_be64(&header[48]);
+    chd->hunkbytes         = get_be32(&header[56]);
+    chd->unitbytes         = get_be32(&header[60]);
+
+    /* A non-zero parent SHA-1 means a delta CHD, which we cannot serve. */
+    for (int i = 104; i < 124; i++) {
+        if (header[i] != 0x00) {
+            pclog("CHD: delta images with a parent are not supported\n");
+            goto fail;
+        }
+    }
+
+    if ((chd->unitbytes != CD_FRAME_SIZE) || (chd->hunkbytes == 0) || (chd->hunkbytes % CD_FRAME_SIZE) || (chd->logicalbytes == 0)) {
+        pclog("CHD: not a CD image (unit size %u)\n", chd->unitbytes);
+        goto fail;
+    }
+
+    chd->hunkcount = (uint32_t) ((chd->logicalbytes + chd->hunkbytes - 1) / chd->hunkbytes);
+    chd->rawmap    = (uint8_t *) calloc(chd->hunkcount, 12);
+    if (chd->rawmap == NULL)
+        goto fail;
+
+    if (chd->compressors[0] == 0) {
+        /* Uncompressed image: the map is an array of hunk indices. */
+        uint8_t entry[4];
+        if (fseeko64(chd->fp, mapoffset, SEEK_SET) == -1)
+            goto fail;
+        for (uint32_t hunknum = 0; hunknum < chd->hunkcount; hunknum++) {
+            uint8_t *rawmap = &chd->rawmap[hunknum * 12];
+            if (fread(entry, 1, 4, chd->fp) != 4)
+                goto fail;
+            const uint32_t idx = get_be32(entry);
+            if (idx == 0)
+                rawmap[0] = COMPRESSION_ZERO;
+            else {
+                rawmap[0] = COMPRESSION_NONE;
+                put_be48(&rawmap[4], (uint64_t) idx * chd->hunkbytes);
+            }
+        }
+    } else {
+        if (!chd_decompress_map(chd, mapoffset)) {
+            pclog("CHD: failed to decode the hunk map\n");
+            goto fail;
+        }
+
+        /* Make sure every codec the map actually uses is one we carry. */
+        for (uint32_t hunknum = 0; hunknum < chd->hunkcount; hunknum++) {
+            const uint8_t comp = chd->rawmap[hunknum * 12];
+            if (comp <= COMPRESSION_TYPE_3) {
+                const uint32_t codec = chd->compressors[comp];
+                if ((codec != CHD_CODEC_ZLIB) && (codec != CHD_CODEC_CDZL)) {
+                    pclog("CHD: codec '%c%c%c%c' is not supported; recreate the image with \"chdman createcd -c cdzl\"\n",
+                          (codec >> 24) & 0xff, (codec >> 16) & 0xff, (codec >> 8) & 0xff, codec & 0xff);
+                    goto fail;
+                }
+            } else if (comp == COMPRESSION_PARENT) {
+                pclog("CHD: delta images with a parent are not supported\n");
+                goto fail;
+            }
+        }
+    }
+
+    if (!chd_parse_metadata(chd, metaoffset)) {
+        pclog("CHD: no CD track metadata found\n");
+        goto fail;
+    }
+
+    const uint32_t frames = chd->hunkbytes / CD_FRAME_SIZE;
+    chd->compbuf  = (uint8_t *) malloc(chd->hunkbytes);
+    chd->framebuf = (uint8_t *) malloc(frames * CD_MAX_SECTOR_DATA);
+    chd->subbuf   = (uint8_t *) malloc(frames * CD_MAX_SUBCODE_DATA);
+    if ((chd->compbuf == NULL) || (chd->framebuf == NULL) || (chd->subbuf == NULL))
+        goto fail;
+
+    if (inflateInit2(&chd->zstr, -MAX_WBITS) != Z_OK)
+        goto fail;
+    chd->zstr_inited = 1;
+
+    chd->prefetch_hunk = 0xffffffff;
+    chd->mutex         = thread_create_mutex();
+    chd->wake_event    = thread_create_event();
+    chd->prefetch_thread = thread_create(chd_prefetch_thread, chd);
+
+    memset(chd->tf.fn, 0x00, sizeof(chd->tf.fn));
+    strncpy(chd->tf.fn, filename, sizeof(chd->tf.fn) - 1);
+    chd->tf.fp         = NULL;
+    chd->tf.priv       = chd;
+    chd->tf.read       = chd_read;
+    chd->tf.get_length = chd_get_length;
+    chd->tf.close      = chd_close;
+
+    *error = 0;
+    return chd;
+
+fail:
+    chd_close(&chd->tf);
+    return NULL;
+}
+
+/* Map a CHD track type onto the cue sheet conventions used above. */
+static void
+chd_track_mode(const chd_track_info_t *info, track_t *trk)
+{
+    trk->form  = 0;
+    trk->mode2 = 0;
+
+    if (!strcmp(info->type, "AUDIO")) {
+        trk->sector_size = RAW_SECTOR_SIZE;
+        trk->attr        = AUDIO_TRACK;
+    } else if (!strcmp(info->type, "MODE1")) {
+        trk->sector_size = COOKED_SECTOR_SIZE;
+        trk->attr        = DATA_TRACK;
+    } else if (!strcmp(info->type, "MODE1_RAW")) {
+        trk->sector_size = RAW_SECTOR_SIZE;
+        trk->attr        = DATA_TRACK;
+    } else if (!strcmp(info->type, "MODE2_FORM1")) {
+        trk->form        = 1;
+        trk->sector_size = COOKED_SECTOR_SIZE;
+        trk->attr        = DATA_TRACK;
+        trk->mode2       = 1;
+    } else if (!strcmp(info->type, "MODE2_FORM2")) {
+        trk->form        = 2;
+        trk->sector_size = 2324;
+        trk->attr        = DATA_TRACK;
+        trk->mode2       = 1;
+    } else if (!strcmp(info->type, "MODE2") || !strcmp(info->type, "MODE2_FORM_MIX")) {
+        trk->form        = 1;
+        trk->sector_size = 2336;
+        trk->attr        = DATA_TRACK;
+        trk->mode2       = 1;
+    } else if (!strcmp(info->type, "MODE2_RAW")) {
+        /* Assume this is XA Mode 2 Form 1, like MODE2/2352. */
+        trk->form        = 1;
+        trk->sector_size = RAW_SECTOR_SIZE;
+        trk->attr        = DATA_TRACK;
+        trk->mode2       = 1;
+    } else {
+        /* Unknown type: treat as raw data. */
+        trk->sector_size = RAW_SECTOR_SIZE;
+        trk->attr        = DATA_TRACK;
+    }
+
+    /* Raw tracks with stored subchannel expose the full 2448-byte frame. */
+    if ((trk->sector_size == RAW_SECTOR_SIZE) && strcmp(info->subtype, "NONE"))
+        trk->sector_size = 2448;
+}
+
+int
+cdi_load_chd(cd_img_t *cdi, const char *filename)
+{
+    int    error;
+    chd_t *chd = chd_open(filename, &error);
+
+    cdi->tracks     = NULL;
+    cdi->tracks_num = 0;
+
+    if (chd == NULL)
+        return 0;
+
+    /* Validate the metadata up front so track building cannot fail
+       halfway through with entries already pushed. */
+    for (int t = 1; t <= chd->num_tracks; t++) {
+        if (chd->track_info[t].frames <= 0) {
+            pclog("CHD: track %d missing from metadata\n", t);
+            chd_close(&chd->tf);
+            return 0;
+        }
+    }
+
+    /* Lay the tracks out the way chdman wrote them: each track's frames
+       are stored back to back, padded to a multiple of 4 frames. */
+    uint64_t lba       = 0; /* logical position on the emulated disc */
+    uint32_t chd_frame = 0; /* physical frame inside the CHD */
+    uint64_t virt      = 0; /* byte position in the virtual linear image */
+    track_t  trk;
+
+    memset(&trk, 0x00, sizeof(track_t));
+
+    for (int t = 1; t <= chd->num_tracks; t++) {
+        const chd_track_info_t *info = &chd->track_info[t];
+        chd_extent_t           *ext  = &chd->extents[chd->num_extents];
+
+        chd_track_mode(info, &trk);
+        trk.number       = t;
+        trk.track_number = t;
+        trk.pre          = 0;
+
+        ext->virt_start  = virt;
+        ext->virt_len    = (uint64_t) info->frames * trk.sector_size;
+        ext->frame_start = chd_frame;
+        ext->sector_size = trk.sector_size;
+        chd->num_extents++;
+
+        if (info->pgtype[0] == 'V') {
+            /* "V" pregaps are stored in the track's frames; skip them
+               so the track start points at index 1. */
+            trk.start = lba + info->pregap;
+            trk.skip  = virt + ((uint64_t) info->pregap * trk.sector_size);
+            lba += info->frames;
+        } else {
+            trk.start = lba + info->pregap;
+            trk.skip  = virt;
+            lba += info->pregap + info->frames;
+        }
+        trk.length = info->frames;
+        trk.file   = &chd->tf;
+        cdi_track_push_back(cdi, &trk);
+
+        lba += info->postgap;
+        virt += ext->virt_len;
+        chd_frame += (info->frames + CD_TRACK_PADDING - 1) / CD_TRACK_PADDING * CD_TRACK_PADDING;
+    }
+
+    chd->virt_len = virt;
+
+    /* Lead out track. */
+    trk.number       = chd->num_tracks + 1;
+    trk.track_number = 0xAA;
+    trk.attr         = 0x16;
+    trk.start        = lba;
+    trk.length       = 0;
+    trk.file         = NULL;
+    cdi_track_push_back(cdi, &trk);
+
+    return 1;
+}
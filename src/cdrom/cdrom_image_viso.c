@@ -847,23 +847,13 @@ viso_init(const char *dirname, int *error)
         /* Open directory for listing. */
         DIR *dirp = opendir(dir->path);
 
-        /* Iterate through this directory's children to determine the entry array size. */
-        size_t children_count = 3; /* include terminator, . and .. */
-        if (dirp) {                /* create empty directory if opendir failed */
-            while ((readdir_entry = readdir(dirp))) {
-                /* Ignore . and .. pseudo-directories. */
-                if ((readdir_entry->d_name[0] == '.') && ((readdir_entry->d_name[1] == '\0') || (*((uint16_t *) &readdir_entry->d_name[1]) == '.')))
-                    continue;
-                children_count++;
-            }
-        }
-
-        /* Grow array if needed. */
-        if (children_count > dir_entries_len) {
-            viso_entry_t **new_dir_entries = (viso_entry_t **) realloc(dir_entries, children_count * sizeof(viso_entry_t *));
+        /* Make sure the entry array can hold ., .. and the terminator. */
+        size_t children_count;
+        if (dir_entries_len < 8) {
+            viso_entry_t **new_dir_entries = (viso_entry_t **) realloc(dir_entries, 8 * sizeof(viso_entry_t *));
             if (new_dir_entries) {
                 dir_entries     = new_dir_entries;
-                dir_entries_len = children_count;
+                dir_entries_len = 8;
             } else {
                 goto next_dir;
             }
@@ -891,14 +881,22 @@ viso_init(const char *dirname, int *error)
             cdrom_image_viso_log("[%08X] %s => %s\n", entry, dir->path, entry->name_short);
         }
 
-        /* Iterate through this directory's children again, making the entries. */
-        if (dirp) {
-            rewinddir(dirp);
+        /* Iterate through this directory's children in a single pass, making the entries. */
+        if (dirp) { /* create empty directory if opendir failed */
             while ((readdir_entry = readdir(dirp))) {
                 /* Ignore . and .. pseudo-directories. */
                 if ((readdir_entry->d_name[0] == '.') && ((readdir_entry->d_name[1] == '\0') || (*((uint16_t *) &readdir_entry->d_name[1]) == '.')))
                     continue;
 
+                /* Grow array if needed, saving room for the terminator. */
+                if ((children_count + 1) >= dir_entries_len) {
+                    viso_entry_t **new_dir_entries = (viso_entry_t **) realloc(dir_entries, (dir_entries_len * 2) * sizeof(viso_entry_t *));
+                    if (!new_dir_entries)
+                        break;
+                    dir_entries = new_dir_entries;
+                    dir_entries_len *= 2;
+                }
+
                 /* Add and fill entry. */
                 entry = dir_entries[children_count++] = (viso_entry_t *) calloc(1, sizeof(viso_entry_t) + dir_path_len + strlen(readdir_entry->d_name) + 2);
                 if (!entry)
@@ -909,8 +907,13 @@ viso_init(const char *dirname, int *error)
                 entry->basename = &entry->path[dir_path_len + 1];
                 strcpy(entry->basename, readdir_entry->d_name);
 
-                /* Stat this child. */
+                /* Stat this child, relative to the open directory handle where
+                   supported, to skip resolving the full path for every child. */
+#if defined(_WIN32) || defined(__TERMUX__)
                 if (stat(entry->path, &entry->stats) != 0) {
+#else
+                if (fstatat(dirfd(dirp), readdir_entry->d_name, &entry->stats, 0) != 0) {
+#endif
                     /* Use a blank structure if stat failed. */
                     memset(&entry->stats, 0x00, sizeof(stat_t));
                 }
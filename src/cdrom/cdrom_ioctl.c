@@ -18,6 +18,7 @@
  */
 #include <inttypes.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
@@ -31,6 +32,7 @@
 #include <86box/plat_cdrom.h>
 #include <86box/scsi_device.h>
 #include <86box/cdrom.h>
+#include <86box/thread.h>
 
 #ifdef ENABLE_CDROM_IOCTL_LOG
 int cdrom_ioctl_do_log = ENABLE_CDROM_IOCTL_LOG;
@@ -55,6 +57,210 @@ cdrom_ioctl_log(const char *fmt, ...)
    of the audio while audio still plays. With an absolute conversion, the counter is fine. */
 #define MSFtoLBA(m, s, f) ((((m * 60) + s) * 75) + f)
 
+/* Host drive access runs on a worker thread: a sector the guest demands is
+   read there while the emulation thread waits on an event, and the worker
+   then keeps reading ahead into a small LRU cache on its own time. Guest
+   retries of the same sector and sequential runs are served from the cache
+   without touching hardware, so only the first sector after a physical
+   seek pays the (potentially hundreds of milliseconds) mechanical cost.
+   The plat_cdrom layer drives a single host drive, so like it, the worker
+   and cache are module-global. */
+#define IOCTL_CACHE_SECTORS 64 /* raw sectors, 147 KB */
+#define IOCTL_READAHEAD     8
+
+typedef struct ioctl_cache_t {
+    uint32_t lba;   /* 0xffffffff = empty slot */
+    int      raw;
+    int      ret;   /* host read result for this sector */
+    uint32_t stamp; /* LRU clock value of the last hit */
+    uint8_t  data[RAW_SECTOR_SIZE];
+} ioctl_cache_t;
+
+static ioctl_cache_t ioctl_cache[IOCTL_CACHE_SECTORS];
+static uint32_t      ioctl_cache_clock;
+static mutex_t      *ioctl_cache_mutex; /* guards the cache and host access */
+static mutex_t      *ioctl_req_mutex;   /* one demand read in flight at a time */
+static thread_t     *ioctl_thread;
+static event_t      *ioctl_wake;
+static event_t      *ioctl_done;
+static volatile int  ioctl_quit;
+static int           ioctl_open_count;
+
+static struct {
+    atomic_int pending;
+    uint32_t   lba;
+    int        raw;
+    int        ret;
+    uint8_t    buffer[RAW_SECTOR_SIZE];
+} ioctl_req;
+
+static void
+ioctl_cache_flush(void)
+{
+    thread_wait_mutex(ioctl_cache_mutex);
+    for (int i = 0; i < IOCTL_CACHE_SECTORS; i++)
+        ioctl_cache[i].lba = 0xffffffff;
+    thread_release_mutex(ioctl_cache_mutex);
+}
+
+/* Call with the cache mutex held. */
+static ioctl_cache_t *
+ioctl_cache_find(uint32_t lba, int raw)
+{
+    for (int i = 0; i < IOCTL_CACHE_SECTORS; i++) {
+        if ((ioctl_cache[i].lba == lba) && (ioctl_cache[i].raw == raw))
+            return &ioctl_cache[i];
+    }
+
+    return NULL;
+}
+
+/* Read one sector from the host drive into the least recently used cache
+   slot. Call with the cache mutex held. */
+static ioctl_cache_t *
+ioctl_cache_fill(uint32_t lba, int raw)
+{
+    ioctl_cache_t *ent = &ioctl_cache[0];
+
+    for (int i = 1; i < IOCTL_CACHE_SECTORS; i++) {
+        if (ioctl_cache[i].lba == 0xffffffff) {
+            ent = &ioctl_cache[i];
+            break;
+        }
+        if (ioctl_cache[i].stamp < ent->stamp)
+            ent = &ioctl_cache[i];
+    }
+
+    ent->ret   = plat_cdrom_read_sector(ent->data, raw, lba);
+    ent->lba   = lba;
+    ent->raw   = raw;
+    ent->stamp = ++ioctl_cache_clock;
+
+    return ent;
+}
+
+static void
+ioctl_thread_run(UNUSED(void *priv))
+{
+    ioctl_cache_t *ent;
+
+    while (1) {
+        thread_wait_event(ioctl_wake, -1);
+        thread_reset_event(ioctl_wake);
+
+        if (ioctl_quit)
+            break;
+
+        if (!atomic_load(&ioctl_req.pending))
+            continue;
+
+        /* The demanded sector first: the emulation thread is waiting. */
+        thread_wait_mutex(ioctl_cache_mutex);
+        ent = ioctl_cache_fill(ioctl_req.lba, ioctl_req.raw);
+        ioctl_req.ret = ent->ret;
+        memcpy(ioctl_req.buffer, ent->data, RAW_SECTOR_SIZE);
+        thread_release_mutex(ioctl_cache_mutex);
+
+        atomic_store(&ioctl_req.pending, 0);
+        thread_set_event(ioctl_done);
+
+        /* Then read ahead on our own time, bailing out as soon as another
+           demand read comes in. */
+        for (int i = 1; i <= IOCTL_READAHEAD; i++) {
+            if (ioctl_quit || atomic_load(&ioctl_req.pending))
+                break;
+
+            thread_wait_mutex(ioctl_cache_mutex);
+            if (ioctl_cache_find(ioctl_req.lba + i, ioctl_req.raw) == NULL)
+                (void) ioctl_cache_fill(ioctl_req.lba + i, ioctl_req.raw);
+            thread_release_mutex(ioctl_cache_mutex);
+        }
+    }
+}
+
+static int
+ioctl_read_sector_host(uint8_t *b, int raw, uint32_t lba)
+{
+    const int      buflen = raw ? RAW_SECTOR_SIZE : COOKED_SECTOR_SIZE;
+    ioctl_cache_t *ent;
+    int            ret;
+
+    if (ioctl_thread == NULL)
+        return plat_cdrom_read_sector(b, raw, lba);
+
+    thread_wait_mutex(ioctl_cache_mutex);
+    ent = ioctl_cache_find(lba, raw);
+    if (ent != NULL) {
+        ent->stamp = ++ioctl_cache_clock;
+        ret        = ent->ret;
+        if (ret)
+            memcpy(b, ent->data, buflen);
+        thread_release_mutex(ioctl_cache_mutex);
+        return ret;
+    }
+    thread_release_mutex(ioctl_cache_mutex);
+
+    /* Miss - hand the read to the worker. The request mutex makes sure two
+       threads (emulation and CD audio decode-ahead) do not race for the
+       one request slot. */
+    thread_wait_mutex(ioctl_req_mutex);
+
+    ioctl_req.lba = lba;
+    ioctl_req.raw = raw;
+    atomic_store(&ioctl_req.pending, 1);
+    thread_set_event(ioctl_wake);
+
+    while (atomic_load(&ioctl_req.pending))
+        thread_wait_event(ioctl_done, 10);
+
+    ret = ioctl_req.ret;
+    if (ret)
+        memcpy(b, ioctl_req.buffer, buflen);
+
+    thread_release_mutex(ioctl_req_mutex);
+
+    return ret;
+}
+
+static void
+ioctl_thread_start(void)
+{
+    ioctl_open_count++;
+
+    if (ioctl_thread != NULL)
+        return;
+
+    for (int i = 0; i < IOCTL_CACHE_SECTORS; i++)
+        ioctl_cache[i].lba = 0xffffffff;
+
+    ioctl_quit        = 0;
+    ioctl_cache_mutex = thread_create_mutex();
+    ioctl_req_mutex   = thread_create_mutex();
+    ioctl_wake        = thread_create_event();
+    ioctl_done        = thread_create_event();
+    ioctl_thread      = thread_create_named(ioctl_thread_run, NULL, "cdrom_ioctl");
+}
+
+static void
+ioctl_thread_stop(void)
+{
+    if ((ioctl_thread == NULL) || (--ioctl_open_count > 0))
+        return;
+
+    ioctl_quit = 1;
+    thread_set_event(ioctl_wake);
+    thread_wait(ioctl_thread);
+    thread_destroy_event(ioctl_wake);
+    thread_destroy_event(ioctl_done);
+    thread_close_mutex(ioctl_cache_mutex);
+    thread_close_mutex(ioctl_req_mutex);
+    ioctl_thread      = NULL;
+    ioctl_wake        = NULL;
+    ioctl_done        = NULL;
+    ioctl_cache_mutex = NULL;
+    ioctl_req_mutex   = NULL;
+}
+
 static void
 ioctl_get_tracks(UNUSED(cdrom_t *dev), int *first, int *last)
 {
@@ -156,13 +362,13 @@ ioctl_read_sector(UNUSED(cdrom_t *dev), int type, uint8_t *b, uint32_t lba)
     switch (type) {
         case CD_READ_DATA:
             cdrom_ioctl_log("cdrom_ioctl_read_sector(): Data.\n");
-            return plat_cdrom_read_sector(b, 0, lba);
+            return ioctl_read_sector_host(b, 0, lba);
         case CD_READ_AUDIO:
             cdrom_ioctl_log("cdrom_ioctl_read_sector(): Audio.\n");
-            return plat_cdrom_read_sector(b, 1, lba);
+            return ioctl_read_sector_host(b, 1, lba);
         case CD_READ_RAW:
             cdrom_ioctl_log("cdrom_ioctl_read_sector(): Raw.\n");
-            return plat_cdrom_read_sector(b, 1, lba);
+            return ioctl_read_sector_host(b, 1, lba);
         default:
             cdrom_ioctl_log("cdrom_ioctl_read_sector(): Unknown CD read type.\n");
             break;
@@ -196,8 +402,13 @@ ioctl_ext_medium_changed(cdrom_t *dev)
     if (ret == 1) {
         dev->cd_status      = CD_STATUS_STOPPED;
         dev->cdrom_capacity = ioctl_get_capacity(dev);
-    } else if (ret == -1)
+        if (ioctl_thread != NULL)
+            ioctl_cache_flush();
+    } else if (ret == -1) {
         dev->cd_status      = CD_STATUS_EMPTY;
+        if (ioctl_thread != NULL)
+            ioctl_cache_flush();
+    }
 
     return ret;
 }
@@ -208,6 +419,8 @@ ioctl_exit(cdrom_t *dev)
     cdrom_ioctl_log("CDROM: ioctl_exit(%s)\n", dev->image_path);
     dev->cd_status = CD_STATUS_EMPTY;
 
+    ioctl_thread_stop();
+
     plat_cdrom_close();
 
     dev->ops = NULL;
@@ -264,6 +477,8 @@ cdrom_ioctl_open(cdrom_t *dev, const char *drv)
     /* Attach this handler to the drive. */
     dev->ops = &cdrom_ioctl_ops;
 
+    ioctl_thread_start();
+
     return 0;
 }
 
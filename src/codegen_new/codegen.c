@@ -21,6 +21,20 @@
 
 #define MAX_INSTRUCTION_COUNT 50
 
+int codegen_block_exit_reason = BLOCK_EXIT_BRANCH;
+
+/*Effective per-block instruction limit: dynarec_max_block_ins can lower
+  it at runtime for block-size tuning, but never raise it past the
+  codegen_instructions[] capacity.*/
+static inline int
+codegen_max_ins(void)
+{
+    if ((dynarec_max_block_ins > 0) && (dynarec_max_block_ins < MAX_INSTRUCTION_COUNT))
+        return dynarec_max_block_ins;
+
+    return MAX_INSTRUCTION_COUNT;
+}
+
 static struct
 {
     uint32_t pc;
@@ -58,6 +72,9 @@ int has_ea;
 
 codeblock_t *codeblock;
 uint16_t    *codeblock_hash;
+uint16_t     codeblock_map[CODEBLOCK_MAP_SIZE];
+uint32_t     codegen_use_epoch;
+int          codegen_compile_budget;
 
 void (*codegen_timing_start)(void);
 void (*codegen_timing_prefix)(uint8_t prefix, uint32_t fetchdat);
@@ -674,8 +691,11 @@ generate_call:
 
             block->ins++;
 
-            if (block->ins >= MAX_INSTRUCTION_COUNT)
+            if (block->ins >= codegen_max_ins()) {
+                if (!cpu_block_end)
+                    codegen_block_exit_reason = BLOCK_EXIT_CAPACITY;
                 CPU_BLOCK_END();
+            }
 
             return;
         }
@@ -740,8 +760,11 @@ generate_call:
 
     block->ins++;
 
-    if (block->ins >= MAX_INSTRUCTION_COUNT)
+    if (block->ins >= codegen_max_ins()) {
+        if (!cpu_block_end)
+            codegen_block_exit_reason = BLOCK_EXIT_CAPACITY;
         CPU_BLOCK_END();
+    }
 
     codegen_endpc = (cs + cpu_state.pc) + 8;
 
@@ -38,10 +38,12 @@ typedef struct codeblock_t {
     uint16_t flags;
     uint8_t  ins;
     uint8_t  TOP;
+    /*Saturating dispatch counter driving the tiered compile policy.*/
+    uint8_t  hotness;
 
-    /*Pointers for codeblock tree, used to search for blocks when hash lookup
-      fails.*/
-    uint16_t parent, left, right;
+    /*Slot this block occupies in codeblock_map, so deletion does not have
+      to re-probe by key.*/
+    uint32_t map_slot;
 
     uint8_t *data;
 
@@ -54,6 +56,16 @@ typedef struct codeblock_t {
     uint16_t prev, next;
     uint16_t prev_2, next_2;
 
+    /*Last observed successor block, used by the dispatcher to chain
+      directly from block to block without a hash/tree lookup. This is
+      only a prediction - the dispatcher fully validates the target
+      before executing it, so a stale link is merely a miss.*/
+    uint16_t chain_block;
+
+    /*Epoch stamp of the last dispatch of this block, used to pick cold
+      blocks for eviction when the code cache fills.*/
+    uint32_t use_stamp;
+
     /*First mem_block_t used by this block. Any subsequent mem_block_ts
       will be in the list starting at head_mem_block->next.*/
     struct mem_block_t *head_mem_block;
@@ -81,6 +93,11 @@ extern uint8_t *block_write_data;
 #define CODEBLOCK_IN_DIRTY_LIST 0x40
 /*Code block is not inlining immediate parameters, parameters must be fetched from memory*/
 #define CODEBLOCK_NO_IMMEDIATES 0x80
+/*Code block has no effects beyond guest registers, lazy flags and memory
+  loads. If a dispatch of such a block branches straight back to its own
+  entry without changing any of that state, it is an idle poll loop and
+  the dispatcher may skip ahead to the next timer deadline.*/
+#define CODEBLOCK_IDLE_POLL 0x100
 
 #define BLOCK_PC_INVALID        0xffffffff
 
@@ -92,175 +109,81 @@ get_block_nr(codeblock_t *block)
     return ((uintptr_t) block - (uintptr_t) codeblock) / sizeof(codeblock_t);
 }
 
+/*Flat open-addressing hash map of all live codeblocks, keyed on physical
+  address and CS base. This replaces the old per-page binary trees, which
+  were unbalanced and could degenerate to linked lists under heavily
+  self-modifying workloads. The table is sized well above the largest
+  backend block pool so the load factor stays low and linear probing
+  terminates quickly. Blocks that share a key but were compiled under
+  different CPU status flags coexist in the same probe chain.*/
+#define CODEBLOCK_MAP_SIZE 0x20000
+#define CODEBLOCK_MAP_MASK (CODEBLOCK_MAP_SIZE - 1)
+
+extern uint16_t codeblock_map[CODEBLOCK_MAP_SIZE];
+
+static inline uint32_t
+codeblock_map_hash(uint32_t phys, uint32_t _cs)
+{
+    uint32_t hash = phys ^ (_cs >> 4);
+
+    hash ^= hash >> 13;
+    return hash & CODEBLOCK_MAP_MASK;
+}
+
 static inline codeblock_t *
-codeblock_tree_find(uint32_t phys, uint32_t _cs)
+codeblock_map_find(uint32_t phys, uint32_t _cs)
 {
-    codeblock_t *block;
-    uint64_t     a = _cs | ((uint64_t) phys << 32);
+    uint32_t slot = codeblock_map_hash(phys, _cs);
 
-    if (!pages[phys >> 12].head)
-        return NULL;
+    while (codeblock_map[slot] != BLOCK_INVALID) {
+        codeblock_t *block = &codeblock[codeblock_map[slot]];
 
-    block = &codeblock[pages[phys >> 12].head];
-    while (block) {
-        uint64_t block_cmp = block->_cs | ((uint64_t) block->phys << 32);
-        if (a == block_cmp) {
+        if ((block->phys == phys) && (block->_cs == _cs)) {
             if (!((block->status ^ cpu_cur_status) & CPU_STATUS_FLAGS) && ((block->status & cpu_cur_status & CPU_STATUS_MASK) == (cpu_cur_status & CPU_STATUS_MASK)))
-                break;
+                return block;
         }
-        if (a < block_cmp)
-            block = block->left ? &codeblock[block->left] : NULL;
-        else
-            block = block->right ? &codeblock[block->right] : NULL;
+        slot = (slot + 1) & CODEBLOCK_MAP_MASK;
     }
 
-    return block;
+    return NULL;
 }
 
 static inline void
-codeblock_tree_add(codeblock_t *new_block)
+codeblock_map_add(codeblock_t *new_block)
 {
-    codeblock_t *block = &codeblock[pages[new_block->phys >> 12].head];
-    uint64_t     a     = new_block->_cs | ((uint64_t) new_block->phys << 32);
-
-    if (!pages[new_block->phys >> 12].head) {
-        pages[new_block->phys >> 12].head = get_block_nr(new_block);
-        new_block->parent = new_block->left = new_block->right = BLOCK_INVALID;
-    } else {
-        codeblock_t *old_block     = NULL;
-        uint64_t     old_block_cmp = 0;
-
-        while (block) {
-            old_block     = block;
-            old_block_cmp = old_block->_cs | ((uint64_t) old_block->phys << 32);
-
-            if (a < old_block_cmp)
-                block = block->left ? &codeblock[block->left] : NULL;
-            else
-                block = block->right ? &codeblock[block->right] : NULL;
-        }
-
-        if (old_block != NULL) {
-            if (a < old_block_cmp)
-                old_block->left = get_block_nr(new_block);
-            else
-                old_block->right = get_block_nr(new_block);
+    uint32_t slot = codeblock_map_hash(new_block->phys, new_block->_cs);
 
-            new_block->parent = get_block_nr(old_block);
-        } else
-            new_block->parent = BLOCK_INVALID;
+    while (codeblock_map[slot] != BLOCK_INVALID)
+        slot = (slot + 1) & CODEBLOCK_MAP_MASK;
 
-        new_block->left = new_block->right = BLOCK_INVALID;
-    }
+    codeblock_map[slot] = get_block_nr(new_block);
+    new_block->map_slot = slot;
 }
 
 static inline void
-codeblock_tree_delete(codeblock_t *block)
+codeblock_map_delete(codeblock_t *block)
 {
-    uint16_t     parent_nr = block->parent;
-    codeblock_t *parent;
-
-    if (block->parent)
-        parent = &codeblock[block->parent];
-    else
-        parent = NULL;
-
-    if (!block->left && !block->right) {
-        /*Easy case - remove from parent*/
-        if (!parent)
-            pages[block->phys >> 12].head = BLOCK_INVALID;
-        else {
-            uint16_t block_nr = get_block_nr(block);
-
-            if (parent->left == block_nr)
-                parent->left = BLOCK_INVALID;
-            if (parent->right == block_nr)
-                parent->right = BLOCK_INVALID;
-        }
-        return;
-    } else if (!block->left) {
-        /*Only right node*/
-        if (!parent_nr) {
-            pages[block->phys >> 12].head                   = block->right;
-            codeblock[pages[block->phys >> 12].head].parent = BLOCK_INVALID;
-        } else {
-            uint16_t block_nr = get_block_nr(block);
-
-            if (parent->left == block_nr) {
-                parent->left                   = block->right;
-                codeblock[parent->left].parent = parent_nr;
-            }
-            if (parent->right == block_nr) {
-                parent->right                   = block->right;
-                codeblock[parent->right].parent = parent_nr;
-            }
-        }
-        return;
-    } else if (!block->right) {
-        /*Only left node*/
-        if (!parent_nr) {
-            pages[block->phys >> 12].head                   = block->left;
-            codeblock[pages[block->phys >> 12].head].parent = BLOCK_INVALID;
-        } else {
-            uint16_t block_nr = get_block_nr(block);
-
-            if (parent->left == block_nr) {
-                parent->left                   = block->left;
-                codeblock[parent->left].parent = parent_nr;
-            }
-            if (parent->right == block_nr) {
-                parent->right                   = block->left;
-                codeblock[parent->right].parent = parent_nr;
-            }
-        }
-        return;
-    } else {
-        /*Difficult case - node has two children. Walk right child to find lowest node*/
-        codeblock_t *lowest = &codeblock[block->right];
-        codeblock_t *highest;
-        codeblock_t *old_parent;
-        uint16_t     lowest_nr;
-
-        while (lowest->left)
-            lowest = &codeblock[lowest->left];
-        lowest_nr = get_block_nr(lowest);
-
-        old_parent = &codeblock[lowest->parent];
-
-        /*Replace deleted node with lowest node*/
-        if (!parent_nr)
-            pages[block->phys >> 12].head = lowest_nr;
-        else {
-            uint16_t block_nr = get_block_nr(block);
-
-            if (parent->left == block_nr)
-                parent->left = lowest_nr;
-            if (parent->right == block_nr)
-                parent->right = lowest_nr;
-        }
-
-        lowest->parent = parent_nr;
-        lowest->left   = block->left;
-        if (lowest->left)
-            codeblock[lowest->left].parent = lowest_nr;
-
-        old_parent->left = BLOCK_INVALID;
-
-        highest = &codeblock[lowest->right];
-        if (!lowest->right) {
-            if (lowest_nr != block->right) {
-                lowest->right                  = block->right;
-                codeblock[block->right].parent = lowest_nr;
-            }
-            return;
-        }
-
-        while (highest->right)
-            highest = &codeblock[highest->right];
-
-        if (block->right && block->right != lowest_nr) {
-            highest->right                 = block->right;
-            codeblock[block->right].parent = get_block_nr(highest);
+    uint32_t slot = block->map_slot;
+    uint32_t scan = slot;
+
+    codeblock_map[slot] = BLOCK_INVALID;
+
+    /*Shift the remainder of the probe cluster back so that no entry is
+      separated from its home slot by an empty slot - avoids the need for
+      tombstones, which would otherwise accumulate as blocks churn.*/
+    while (1) {
+        uint32_t home;
+
+        scan = (scan + 1) & CODEBLOCK_MAP_MASK;
+        if (codeblock_map[scan] == BLOCK_INVALID)
+            break;
+
+        home = codeblock_map_hash(codeblock[codeblock_map[scan]].phys, codeblock[codeblock_map[scan]]._cs);
+        if ((slot <= scan) ? ((home <= slot) || (home > scan)) : ((home <= slot) && (home > scan))) {
+            codeblock_map[slot]                     = codeblock_map[scan];
+            codeblock[codeblock_map[slot]].map_slot = slot;
+            codeblock_map[scan]                     = BLOCK_INVALID;
+            slot                                    = scan;
         }
     }
 }
@@ -308,13 +231,68 @@ extern void codegen_check_seg_read(codeblock_t *block, struct ir_data_t *ir, x86
 extern void codegen_check_seg_write(codeblock_t *block, struct ir_data_t *ir, x86seg *seg);
 
 extern int codegen_purge_purgable_list(void);
-/*Delete a random code block to free memory. This is obviously quite expensive, and
-  will only be called when the allocator is out of memory*/
-extern void codegen_delete_random_block(int required_mem_block);
+/*Delete a cold (least recently dispatched) code block to free memory. This is
+  obviously quite expensive, and will only be called when the allocator is out
+  of memory*/
+extern void codegen_delete_cold_block(int required_mem_block);
+
+/*Monotonic dispatch counter - every compiled block dispatched stamps itself
+  with this so eviction can approximate LRU.*/
+extern uint32_t codegen_use_epoch;
+
+/*Tiered execution thresholds. A marked block stays interpreted until its
+  hotness counter reaches DYNAREC_HOT_THRESHOLD dispatches; blocks that go
+  on to reach DYNAREC_VERY_HOT_THRESHOLD are retranslated once more with
+  the full IR optimisation pipeline. The counter halves whenever the block
+  has not been dispatched for DYNAREC_HOTNESS_DECAY epochs, so one-shot
+  code (eg. most of a guest OS boot) never pays for translation.*/
+#define DYNAREC_HOT_THRESHOLD      4
+#define DYNAREC_VERY_HOT_THRESHOLD 32
+#define DYNAREC_HOTNESS_DECAY      0x10000
+#define DYNAREC_HOTNESS_MAX        0xff
+
+/*Compiles remaining in the current timer slice. Translation happens on the
+  emulation thread (blocks are compiled by interpreting them, so it cannot
+  be handed to a worker), and a burst of new hot code - eg. a game loading
+  a level - used to spend whole slices translating, which starved the
+  device timers and caused audio underruns. The dispatch loop refills the
+  budget once per slice; blocks that go hot when it is exhausted are simply
+  interpreted once more and compile in a later slice.*/
+#define DYNAREC_COMPILE_BUDGET 8
+
+extern int codegen_compile_budget;
+
+/*Bump the hotness counter of an uncompiled block, decaying it first if the
+  block has been idle, and report whether it has earned compilation.*/
+static inline int
+codegen_block_check_hot(codeblock_t *block)
+{
+    if ((codegen_use_epoch - block->use_stamp) > DYNAREC_HOTNESS_DECAY)
+        block->hotness >>= 1;
+    block->use_stamp = ++codegen_use_epoch;
+    if (block->hotness < DYNAREC_HOTNESS_MAX)
+        block->hotness++;
+    if (block->hotness < DYNAREC_HOT_THRESHOLD)
+        return 0;
+    if (!codegen_compile_budget)
+        return 0;
+    codegen_compile_budget--;
+    return 1;
+}
 
 extern int      cpu_block_end;
 extern uint32_t codegen_endpc;
 
+/*Why the block former stopped appending instructions; the first reason
+  to end a block wins. Order matches the PERF_BLOCK_EXIT_* counters.*/
+enum {
+    BLOCK_EXIT_BRANCH = 0, /*branch/serialising op (the default)*/
+    BLOCK_EXIT_PAGE_CROSS, /*guest byte limit*/
+    BLOCK_EXIT_FLAG,       /*trap flag or pending interrupt boundary*/
+    BLOCK_EXIT_CAPACITY    /*instruction count limit*/
+};
+extern int codegen_block_exit_reason;
+
 extern int cpu_reps;
 extern int cpu_notreps;
 
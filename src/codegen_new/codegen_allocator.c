@@ -24,55 +24,119 @@ typedef struct mem_block_t {
     uint16_t code_block;
 } mem_block_t;
 
-static mem_block_t mem_blocks[MEM_BLOCK_NR];
-static uint32_t    mem_block_free_list;
-static uint8_t    *mem_block_alloc = NULL;
+static mem_block_t *mem_blocks = NULL;
+static uint32_t     mem_block_count;
+static uint32_t     mem_block_evict_hand;
+static uint32_t     mem_block_free_list;
+/*The bottom eighth of the pool is a hot zone with its own free list:
+  retranslations of very hot blocks are carved from it, so the chains that
+  dominate dispatch pack together instead of scattering across the cache
+  in allocation order. Generated code cannot be moved once emitted (blocks
+  are chained by concrete jumps), so placement at translation time is
+  where locality is won.*/
+static uint32_t     mem_block_hot_count;
+static uint32_t     mem_block_hot_free_list;
+static uint8_t     *mem_block_alloc = NULL;
 
 int codegen_allocator_usage = 0;
 
 void
 codegen_allocator_init(void)
 {
+    uint32_t new_count;
+
+    /*Size the pool from the configured cache size, staying within the
+      jump range limit documented in codegen_allocator.h.*/
+    if (dynarec_cache_size > 0) {
+        new_count = (((uint64_t) dynarec_cache_size) << 20) / MEM_BLOCK_SIZE;
+        if (new_count > MEM_BLOCK_NR)
+            new_count = MEM_BLOCK_NR;
+        if (new_count < MEM_BLOCK_MIN_NR)
+            new_count = MEM_BLOCK_MIN_NR;
+    } else
+        new_count = MEM_BLOCK_NR;
+
+    if (mem_blocks)
+        free(mem_blocks);
+
 #if defined WIN32 || defined _WIN32 || defined _WIN32
-    mem_block_alloc = VirtualAlloc(NULL, MEM_BLOCK_NR * MEM_BLOCK_SIZE, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+    if (mem_block_alloc)
+        VirtualFree(mem_block_alloc, 0, MEM_RELEASE);
+    mem_block_alloc = VirtualAlloc(NULL, new_count * MEM_BLOCK_SIZE, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
     /* TODO: check deployment target: older Intel-based versions of macOS don't play
        nice with MAP_JIT. */
 #elif defined(__APPLE__) && defined(MAP_JIT)
-    mem_block_alloc = mmap(0, MEM_BLOCK_NR * MEM_BLOCK_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_ANON | MAP_PRIVATE | MAP_JIT, -1, 0);
+    if (mem_block_alloc)
+        munmap(mem_block_alloc, mem_block_count * MEM_BLOCK_SIZE);
+    mem_block_alloc = mmap(0, new_count * MEM_BLOCK_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_ANON | MAP_PRIVATE | MAP_JIT, -1, 0);
 #else
-    mem_block_alloc = mmap(0, MEM_BLOCK_NR * MEM_BLOCK_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_ANON | MAP_PRIVATE, -1, 0);
+    if (mem_block_alloc)
+        munmap(mem_block_alloc, mem_block_count * MEM_BLOCK_SIZE);
+    mem_block_alloc = mmap(0, new_count * MEM_BLOCK_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_ANON | MAP_PRIVATE, -1, 0);
 #endif
 
-    for (uint32_t c = 0; c < MEM_BLOCK_NR; c++) {
+    mem_block_count = new_count;
+    mem_blocks      = calloc(mem_block_count, sizeof(mem_block_t));
+
+    mem_block_hot_count = mem_block_count / 8;
+
+    for (uint32_t c = 0; c < mem_block_count; c++) {
         mem_blocks[c].offset     = c * MEM_BLOCK_SIZE;
         mem_blocks[c].code_block = BLOCK_INVALID;
-        if (c < MEM_BLOCK_NR - 1)
-            mem_blocks[c].next = c + 2;
-        else
+        if ((c == (mem_block_hot_count - 1)) || (c == (mem_block_count - 1)))
             mem_blocks[c].next = 0;
+        else
+            mem_blocks[c].next = c + 2;
     }
-    mem_block_free_list = 1;
+    mem_block_hot_free_list = 1;
+    mem_block_free_list     = mem_block_hot_count + 1;
+    mem_block_evict_hand    = 0;
 }
 
 mem_block_t *
 codegen_allocator_allocate(mem_block_t *parent, int code_block)
 {
     mem_block_t *block;
+    uint32_t    *free_list;
     uint32_t     block_nr;
-
-    while (!mem_block_free_list) {
-        /*Pick a random memory block and free the owning code block*/
-        block_nr = rand() & MEM_BLOCK_MASK;
-        block    = &mem_blocks[block_nr];
-
-        if (block->code_block && block->code_block != code_block)
-            codegen_delete_block(&codeblock[block->code_block]);
+    int          hot = codeblock[code_block].hotness >= DYNAREC_VERY_HOT_THRESHOLD;
+
+    while (!mem_block_free_list && !mem_block_hot_free_list) {
+        /*Pool is full - sample a handful of in-use memory blocks and evict
+          the owning code block that was dispatched longest ago. The clock
+          hand persists between evictions so the whole pool gets visited,
+          and the use stamps steer eviction away from hot blocks, so the
+          steady state never degrades into mass retranslation.*/
+        mem_block_t *coldest    = NULL;
+        uint32_t     candidates = 0;
+        uint32_t     scanned    = 0;
+
+        while (!coldest || ((candidates < 8) && (scanned < mem_block_count))) {
+            scanned++;
+            block                = &mem_blocks[mem_block_evict_hand];
+            mem_block_evict_hand = (mem_block_evict_hand + 1) % mem_block_count;
+
+            if (block->code_block && block->code_block != code_block) {
+                if (!coldest || ((int32_t) (codeblock[coldest->code_block].use_stamp - codeblock[block->code_block].use_stamp) > 0))
+                    coldest = block;
+                candidates++;
+            }
+        }
+
+        codegen_delete_block(&codeblock[coldest->code_block]);
     }
 
-    /*Remove from free list*/
-    block_nr            = mem_block_free_list;
-    block               = &mem_blocks[block_nr - 1];
-    mem_block_free_list = block->next;
+    /*Remove from free list - very hot translations come from the hot zone
+      so they end up adjacent to each other; either list falls back to the
+      other once drained rather than evicting early.*/
+    if (hot)
+        free_list = mem_block_hot_free_list ? &mem_block_hot_free_list : &mem_block_free_list;
+    else
+        free_list = mem_block_free_list ? &mem_block_free_list : &mem_block_hot_free_list;
+
+    block_nr   = *free_list;
+    block      = &mem_blocks[block_nr - 1];
+    *free_list = block->next;
 
     block->code_block = code_block;
     if (parent) {
@@ -94,10 +158,15 @@ codegen_allocator_free(mem_block_t *block)
         int next_block_nr = block->next;
         codegen_allocator_usage--;
 
-        block->next         = mem_block_free_list;
-        block->code_block   = BLOCK_INVALID;
-        mem_block_free_list = block_nr;
-        block_nr            = next_block_nr;
+        block->code_block = BLOCK_INVALID;
+        if ((uint32_t) block_nr <= mem_block_hot_count) {
+            block->next             = mem_block_hot_free_list;
+            mem_block_hot_free_list = block_nr;
+        } else {
+            block->next         = mem_block_free_list;
+            mem_block_free_list = block_nr;
+        }
+        block_nr = next_block_nr;
 
         if (block_nr)
             block = &mem_blocks[block_nr - 1];
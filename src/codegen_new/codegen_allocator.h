@@ -12,13 +12,24 @@
 
   Due to the chaining, the total memory size is limited by the range of a jump
   instruction. ARMv7 is restricted to +/- 32 MB, ARMv8 to +/- 128 MB, x86 to
-  +/- 2GB. As a result, total memory size is limited to 32 MB on ARMv7*/
+  +/- 2GB. As a result, total memory size is limited to 32 MB on ARMv7.
+
+  The pool size defaults to MEM_BLOCK_NR blocks but can be reduced with the
+  dynarec_cache_size setting (in MB); MEM_BLOCK_NR stays the upper bound.
+
+  The bottom eighth of the pool is reserved for retranslations of very hot
+  blocks (see DYNAREC_VERY_HOT_THRESHOLD), keeping the dominant chains
+  contiguous for the host front end.*/
 #if defined __ARM_EABI__ || defined _ARM_ || defined _M_ARM
 #    define MEM_BLOCK_NR 32768
 #else
 #    define MEM_BLOCK_NR 131072
 #endif
 
+/*Lower bound on the pool, so a tiny configured cache cannot deadlock the
+  allocator - a single spanning codeblock can hold several blocks.*/
+#define MEM_BLOCK_MIN_NR 4096
+
 #define MEM_BLOCK_MASK (MEM_BLOCK_NR - 1)
 #define MEM_BLOCK_SIZE 0x3c0
 
@@ -5,6 +5,7 @@
 #include <86box/86box.h>
 #include "cpu.h"
 #include <86box/mem.h>
+#include <86box/perfctr.h>
 #include <86box/plat_unused.h>
 
 #include "x86.h"
@@ -204,7 +205,7 @@ block_free_list_get(void)
         }
         /*Free list is empty - free up a block*/
         if (!codegen_purge_purgable_list())
-            codegen_delete_random_block(0);
+            codegen_delete_cold_block(0);
     }
 
     block           = &codeblock[block_free_list];
@@ -220,6 +221,7 @@ codegen_init(void)
     codegen_allocator_init();
 
     codegen_backend_init();
+    memset(codeblock_map, 0, sizeof(codeblock_map));
     block_free_list = 0;
     for (uint32_t c = 0; c < BLOCK_SIZE; c++)
         block_free_list_add(&codeblock[c]);
@@ -247,6 +249,7 @@ codegen_reset(void)
 
     memset(codeblock, 0, BLOCK_SIZE * sizeof(codeblock_t));
     memset(codeblock_hash, 0, HASH_SIZE * sizeof(uint16_t));
+    memset(codeblock_map, 0, sizeof(codeblock_map));
     mem_reset_page_blocks();
 
     block_free_list = 0;
@@ -395,9 +398,10 @@ delete_block(codeblock_t *block)
     if (block->pc == BLOCK_PC_INVALID)
         fatal("Deleting deleted block\n");
 #endif
-    block->pc = BLOCK_PC_INVALID;
+    block->pc          = BLOCK_PC_INVALID;
+    block->chain_block = BLOCK_INVALID;
 
-    codeblock_tree_delete(block);
+    codeblock_map_delete(block);
     if (block->flags & CODEBLOCK_IN_DIRTY_LIST)
         block_dirty_list_remove(block);
     else
@@ -418,9 +422,10 @@ delete_dirty_block(codeblock_t *block)
     if (block->pc == BLOCK_PC_INVALID)
         fatal("Deleting deleted block\n");
 #endif
-    block->pc = BLOCK_PC_INVALID;
+    block->pc          = BLOCK_PC_INVALID;
+    block->chain_block = BLOCK_INVALID;
 
-    codeblock_tree_delete(block);
+    codeblock_map_delete(block);
     block_free_list_add(block);
 }
 
@@ -432,21 +437,32 @@ codegen_delete_block(codeblock_t *block)
 }
 
 void
-codegen_delete_random_block(int required_mem_block)
+codegen_delete_cold_block(int required_mem_block)
 {
-    int block_nr = rand() & BLOCK_MASK;
-
-    while (1) {
+    int          block_nr   = rand() & BLOCK_MASK;
+    codeblock_t *coldest    = NULL;
+    int          candidates = 0;
+    int          scanned    = 0;
+
+    /*Sample a handful of valid blocks starting from a random position and
+      evict the one that was dispatched longest ago. This approximates LRU
+      without having to maintain an ordered list on the dispatch fast path,
+      and avoids the retranslation stalls that evicting hot blocks caused.*/
+    while (!coldest || ((candidates < 8) && (scanned < BLOCK_SIZE))) {
+        scanned++;
         if (block_nr && block_nr != block_current) {
             codeblock_t *block = &codeblock[block_nr];
 
             if (block->pc != BLOCK_PC_INVALID && (!required_mem_block || block->head_mem_block)) {
-                delete_block(block);
-                return;
+                if (!coldest || ((int32_t) (coldest->use_stamp - block->use_stamp) > 0))
+                    coldest = block;
+                candidates++;
             }
         }
         block_nr = (block_nr + 1) & BLOCK_MASK;
     }
+
+    delete_block(coldest);
 }
 
 void
@@ -526,12 +542,15 @@ codegen_block_init(uint32_t phys_addr)
     block->dirty_mask2 = NULL;
     block->next = block->prev = BLOCK_INVALID;
     block->next_2 = block->prev_2 = BLOCK_INVALID;
+    block->chain_block            = BLOCK_INVALID;
+    block->hotness                = 0;
+    block->use_stamp              = codegen_use_epoch;
     block->page_mask = block->page_mask2 = 0;
     block->flags                         = CODEBLOCK_STATIC_TOP;
     block->status                        = cpu_cur_status;
 
     recomp_page = block->phys & ~0xfff;
-    codeblock_tree_add(block);
+    codeblock_map_add(block);
 }
 
 static ir_data_t *ir_data;
@@ -756,6 +775,53 @@ codegen_block_end(void)
     add_to_block_list(block);
 }
 
+/*uOPs whose only effects are on guest registers, the lazy flag state and
+  loads from memory. Anything else - stores, helper calls, segment loads,
+  FPU/MMX state - disqualifies a block from idle poll treatment.*/
+static int
+codegen_uop_is_pollable(uint32_t type)
+{
+    uint8_t op = type & 0xff;
+
+    if ((op == 0x15) || (op == 0x17) || (op == 0x18)) /*JMP, JMP_DEST, NOP_BARRIER*/
+        return 1;
+    if (((op >= 0x20) && (op <= 0x24)) || ((op >= 0x28) && (op <= 0x2a))) /*MOV family, integer only*/
+        return 1;
+    if ((op >= 0x30) && (op <= 0x3b)) /*integer ALU*/
+        return 1;
+    if ((op == 0x40) || (op == 0x41)) /*integer memory loads*/
+        return 1;
+    if ((op == 0x48) || (op == 0x4c) || (op == 0x4d)) /*compare-and-jump*/
+        return 1;
+    if ((op >= 0x50) && (op <= 0x59)) /*shifts and rotates*/
+        return 1;
+    if ((op >= 0x60) && (op <= 0x71)) /*conditional jumps*/
+        return 1;
+
+    return 0;
+}
+
+/*Win9x's idle loop spins on a memory read rather than halting, so it
+  defeats HLT-based idle detection. Mark blocks whose uOPs are all free of
+  side effects; the dispatcher pairs this with a run-time state fixpoint
+  check to recognise the spin and coast to the next timer deadline.*/
+static void
+codegen_block_classify_idle(codeblock_t *block, ir_data_t *ir)
+{
+    block->flags &= ~CODEBLOCK_IDLE_POLL;
+
+    if (block->flags & CODEBLOCK_HAS_FPU)
+        return;
+
+    for (int c = 0; c < ir->wr_pos; c++) {
+        if (!codegen_uop_is_pollable(ir->uops[c].type))
+            return;
+    }
+
+    block->flags |= CODEBLOCK_IDLE_POLL;
+    PERF_INC(PERF_IDLE_BLOCK);
+}
+
 void
 codegen_block_end_recompile(codeblock_t *block)
 {
@@ -775,6 +841,7 @@ codegen_block_end_recompile(codeblock_t *block)
         block->flags &= ~CODEBLOCK_STATIC_TOP;
 
     codegen_accumulate_flush(ir_data);
+    codegen_block_classify_idle(block, ir_data);
     codegen_ir_compile(ir_data, block);
 }
 
@@ -58,6 +58,192 @@ duplicate_uop(ir_data_t *ir, uop_t *uop, int offset)
     }
 }
 
+/*Constant values known per register version, for the folding pass below.
+  The epoch stamp saves clearing the whole table for every block.*/
+static uint32_t const_epoch_tbl[IREG_COUNT][256];
+static uint32_t const_val_tbl[IREG_COUNT][256];
+static uint32_t const_epoch = 0;
+
+static inline int
+const_lookup(ir_reg_t ir_reg, uint32_t *val)
+{
+    if (ir_reg_is_invalid(ir_reg) || !reg_is_native_size(ir_reg))
+        return 0;
+    if (const_epoch_tbl[IREG_GET_REG(ir_reg.reg)][ir_reg.version] != const_epoch)
+        return 0;
+    *val = const_val_tbl[IREG_GET_REG(ir_reg.reg)][ir_reg.version];
+    return 1;
+}
+
+static inline void
+const_set(ir_reg_t ir_reg, uint32_t val)
+{
+    if (ir_reg_is_invalid(ir_reg) || !reg_is_native_size(ir_reg))
+        return;
+    const_epoch_tbl[IREG_GET_REG(ir_reg.reg)][ir_reg.version] = const_epoch;
+    const_val_tbl[IREG_GET_REG(ir_reg.reg)][ir_reg.version]   = val;
+}
+
+/*Drop a source register reference from a uOP that has been folded. If this
+  was the last read of a superseded version, put it on the dead list so
+  codegen_reg_process_dead_list() can remove the defining uOP as well - this
+  is what eliminates flag-setting uOPs whose results are only consumed by
+  folded operations.*/
+static void
+const_fold_release(ir_reg_t *src)
+{
+    int            reg  = IREG_GET_REG(src->reg);
+    reg_version_t *regv = &reg_version[reg][src->version];
+
+    regv->refcount--;
+    if (!regv->refcount && (reg > IREG_EBX) && (src->version != reg_last_version[reg]) && !(regv->flags & REG_FLAGS_REQUIRED) && reg_is_native_size(*src))
+        add_to_dead_list(regv, reg, src->version);
+    *src = invalid_ir_reg;
+}
+
+static void
+const_fold_to_imm(uop_t *uop, uint32_t val)
+{
+    if (!ir_reg_is_invalid(uop->src_reg_a))
+        const_fold_release(&uop->src_reg_a);
+    if (!ir_reg_is_invalid(uop->src_reg_b))
+        const_fold_release(&uop->src_reg_b);
+    if (!ir_reg_is_invalid(uop->src_reg_c))
+        const_fold_release(&uop->src_reg_c);
+    uop->type     = UOP_MOV_IMM;
+    uop->imm_data = val;
+}
+
+/*Forward constant folding over the uOP list. Values known to be constant
+  (from UOP_MOV_IMM) are propagated through moves and ALU uOPs; a uOP whose
+  sources are all known collapses into UOP_MOV_IMM of the result. Register
+  versioning guarantees every read refers to one specific write, so no
+  control-flow analysis is needed - the same assumption the dead register
+  list already relies on. Only native-size registers are tracked, which
+  keeps partial-width writes out of the picture.*/
+static void
+codegen_ir_fold_constants(ir_data_t *ir)
+{
+    const_epoch++;
+
+    for (int c = 0; c < ir->wr_pos; c++) {
+        uop_t   *uop = &ir->uops[c];
+        uint32_t a;
+        uint32_t b;
+
+        if (ir_reg_is_invalid(uop->dest_reg_a) || !reg_is_native_size(uop->dest_reg_a))
+            continue;
+
+        switch (uop->type & ~UOP_TYPE_JUMP_DEST) {
+            case UOP_MOV_IMM:
+                const_set(uop->dest_reg_a, uop->imm_data);
+                break;
+
+            case UOP_MOV:
+                if (const_lookup(uop->src_reg_a, &a)) {
+                    const_fold_to_imm(uop, a);
+                    const_set(uop->dest_reg_a, a);
+                }
+                break;
+
+            case UOP_ADD:
+                if (const_lookup(uop->src_reg_a, &a) && const_lookup(uop->src_reg_b, &b)) {
+                    const_fold_to_imm(uop, a + b);
+                    const_set(uop->dest_reg_a, a + b);
+                }
+                break;
+            case UOP_ADD_IMM:
+                if (const_lookup(uop->src_reg_a, &a)) {
+                    const_fold_to_imm(uop, a + uop->imm_data);
+                    const_set(uop->dest_reg_a, a + uop->imm_data);
+                }
+                break;
+            case UOP_ADD_LSHIFT:
+                if (const_lookup(uop->src_reg_a, &a) && const_lookup(uop->src_reg_b, &b)) {
+                    const_fold_to_imm(uop, a + (b << uop->imm_data));
+                    const_set(uop->dest_reg_a, a + (b << uop->imm_data));
+                }
+                break;
+            case UOP_SUB:
+                if (const_lookup(uop->src_reg_a, &a) && const_lookup(uop->src_reg_b, &b)) {
+                    const_fold_to_imm(uop, a - b);
+                    const_set(uop->dest_reg_a, a - b);
+                }
+                break;
+            case UOP_SUB_IMM:
+                if (const_lookup(uop->src_reg_a, &a)) {
+                    const_fold_to_imm(uop, a - uop->imm_data);
+                    const_set(uop->dest_reg_a, a - uop->imm_data);
+                }
+                break;
+            case UOP_AND:
+                if (const_lookup(uop->src_reg_a, &a) && const_lookup(uop->src_reg_b, &b)) {
+                    const_fold_to_imm(uop, a & b);
+                    const_set(uop->dest_reg_a, a & b);
+                }
+                break;
+            case UOP_AND_IMM:
+                if (const_lookup(uop->src_reg_a, &a)) {
+                    const_fold_to_imm(uop, a & uop->imm_data);
+                    const_set(uop->dest_reg_a, a & uop->imm_data);
+                }
+                break;
+            case UOP_ANDN:
+                if (const_lookup(uop->src_reg_a, &a) && const_lookup(uop->src_reg_b, &b)) {
+                    const_fold_to_imm(uop, ~a & b);
+                    const_set(uop->dest_reg_a, ~a & b);
+                }
+                break;
+            case UOP_OR:
+                if (const_lookup(uop->src_reg_a, &a) && const_lookup(uop->src_reg_b, &b)) {
+                    const_fold_to_imm(uop, a | b);
+                    const_set(uop->dest_reg_a, a | b);
+                }
+                break;
+            case UOP_OR_IMM:
+                if (const_lookup(uop->src_reg_a, &a)) {
+                    const_fold_to_imm(uop, a | uop->imm_data);
+                    const_set(uop->dest_reg_a, a | uop->imm_data);
+                }
+                break;
+            case UOP_XOR:
+                if (const_lookup(uop->src_reg_a, &a) && const_lookup(uop->src_reg_b, &b)) {
+                    const_fold_to_imm(uop, a ^ b);
+                    const_set(uop->dest_reg_a, a ^ b);
+                }
+                break;
+            case UOP_XOR_IMM:
+                if (const_lookup(uop->src_reg_a, &a)) {
+                    const_fold_to_imm(uop, a ^ uop->imm_data);
+                    const_set(uop->dest_reg_a, a ^ uop->imm_data);
+                }
+                break;
+
+            case UOP_SHL_IMM:
+                if ((uop->imm_data < 32) && const_lookup(uop->src_reg_a, &a)) {
+                    const_fold_to_imm(uop, a << uop->imm_data);
+                    const_set(uop->dest_reg_a, a << uop->imm_data);
+                }
+                break;
+            case UOP_SHR_IMM:
+                if ((uop->imm_data < 32) && const_lookup(uop->src_reg_a, &a)) {
+                    const_fold_to_imm(uop, a >> uop->imm_data);
+                    const_set(uop->dest_reg_a, a >> uop->imm_data);
+                }
+                break;
+            case UOP_SAR_IMM:
+                if ((uop->imm_data < 32) && const_lookup(uop->src_reg_a, &a)) {
+                    const_fold_to_imm(uop, (uint32_t) ((int32_t) a >> uop->imm_data));
+                    const_set(uop->dest_reg_a, (uint32_t) ((int32_t) a >> uop->imm_data));
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
 void
 codegen_ir_compile(ir_data_t *ir, codeblock_t *block)
 {
@@ -80,6 +266,11 @@ codegen_ir_compile(ir_data_t *ir, codeblock_t *block)
         }
     }
 
+    /*The folding pass only pays for itself on blocks that execute a lot -
+      blocks in the first compiled tier skip it and get it when the
+      dispatcher forces a retranslation at the very-hot threshold.*/
+    if (block->hotness >= DYNAREC_VERY_HOT_THRESHOLD)
+        codegen_ir_fold_constants(ir);
     codegen_reg_mark_as_required();
     codegen_reg_process_dead_list(ir);
     block_write_data = codeblock_allocator_get_ptr(block->head_mem_block);
@@ -43,6 +43,8 @@
 #include <86box/cassette.h>
 #include <86box/cartridge.h>
 #include <86box/nvr.h>
+#include <86box/rewind.h>
+#include <86box/trace.h>
 #include <86box/ini.h>
 #include <86box/config.h>
 #include <86box/isamem.h>
@@ -84,6 +86,7 @@ static int   cy;
 static int   cw;
 static int   ch;
 static ini_t config;
+static ini_t config_prev = NULL; /* config_snapshot() of the running state */
 
 #ifdef ENABLE_CONFIG_LOG
 int config_do_log = ENABLE_CONFIG_LOG;
@@ -127,6 +130,12 @@ load_general(void)
     video_filter_method = ini_section_get_int(cat, "video_filter_method", 1);
 
     force_43 = !!ini_section_get_int(cat, "force_43", 0);
+
+    rewind_enabled = !!ini_section_get_int(cat, "rewind_enabled", 0);
+
+    trace_flags = ini_section_get_int(cat, "trace_flags", 0);
+
+    timer_cost_budget = ini_section_get_int(cat, "timer_cost_budget", 0);
     scale    = ini_section_get_int(cat, "scale", 1);
     if (scale > 9)
         scale = 9;
@@ -211,6 +220,12 @@ load_general(void)
 
     do_auto_pause = ini_section_get_int(cat, "do_auto_pause", 0);
 
+    background_speed_cap = ini_section_get_int(cat, "background_speed_cap", 0);
+    if ((background_speed_cap < 0) || (background_speed_cap > 100))
+        background_speed_cap = 0;
+
+    background_balloon = !!ini_section_get_int(cat, "background_balloon", 0);
+
     p = ini_section_get_string(cat, "uuid", NULL);
     if (p != NULL)
         strncpy(uuid, p, sizeof(uuid) - 1);
@@ -389,6 +404,10 @@ load_machine(void)
         mem_size = machine_get_max_ram(machine);
 
     cpu_use_dynarec = !!ini_section_get_int(cat, "cpu_use_dynarec", 0);
+    dynarec_cache_size = ini_section_get_int(cat, "dynarec_cache_size", 0);
+    dynarec_max_block_ins = ini_section_get_int(cat, "dynarec_max_block_ins", 0);
+    dynarec_max_block_bytes = ini_section_get_int(cat, "dynarec_max_block_bytes", 0);
+    dynarec_idle_skip = !!ini_section_get_int(cat, "dynarec_idle_skip", 1);
     fpu_softfloat = !!ini_section_get_int(cat, "fpu_softfloat", 0);
     if ((fpu_type != FPU_NONE) && machine_has_flags(machine, MACHINE_SOFTFLOAT_ONLY))
         fpu_softfloat = 1;
@@ -1570,6 +1589,28 @@ load_other_peripherals(void)
 }
 
 /* Load the specified or a default configuration file. */
+/* Load every section of the in-memory configuration into the emulator's
+   state.  Besides config_load() below, config_apply() uses this to
+   re-point the globals at a different configuration. */
+static void
+config_load_sections(void)
+{
+    load_general();                 /* General */
+    for (uint8_t i = 0; i < MONITORS_NUM; i++)
+        load_monitor(i);            /* Monitors */
+    load_machine();                 /* Machine */
+    load_video();                   /* Video */
+    load_input_devices();           /* Input devices */
+    load_sound();                   /* Sound */
+    load_network();                 /* Network */
+    load_ports();                   /* Ports (COM & LPT) */
+    load_storage_controllers();     /* Storage controllers */
+    load_hard_disks();              /* Hard disks */
+    load_floppy_and_cdrom_drives(); /* Floppy and CD-ROM drives */
+    load_other_removable_devices(); /* Other removable devices */
+    load_other_peripherals();       /* Other peripherals */
+}
+
 void
 config_load(void)
 {
@@ -1602,6 +1643,9 @@ config_load(void)
         dpi_scale       = 1;
         do_auto_pause   = 0;
 
+        background_speed_cap = 0;
+        background_balloon   = 0;
+
         cpu_override_interpreter = 0;
 
         fpu_type               = fpu_get_type(cpu_f, cpu, "none");
@@ -1651,20 +1695,7 @@ config_load(void)
 
         config_log("Config file not present or invalid!\n");
     } else {
-        load_general();                 /* General */
-        for (i = 0; i < MONITORS_NUM; i++)
-            load_monitor(i);            /* Monitors */
-        load_machine();                 /* Machine */
-        load_video();                   /* Video */
-        load_input_devices();           /* Input devices */
-        load_sound();                   /* Sound */
-        load_network();                 /* Network */
-        load_ports();                   /* Ports (COM & LPT) */
-        load_storage_controllers();     /* Storage controllers */
-        load_hard_disks();              /* Hard disks */
-        load_floppy_and_cdrom_drives(); /* Floppy and CD-ROM drives */
-        load_other_removable_devices(); /* Other removable devices */
-        load_other_peripherals();       /* Other peripherals */
+        config_load_sections();
 
         /* Migrate renamed device configurations. */
         c = ini_find_section(config, "MDA");
@@ -1732,6 +1763,21 @@ save_general(void)
     else
         ini_section_set_int(cat, "force_43", force_43);
 
+    if (rewind_enabled == 0)
+        ini_section_delete_var(cat, "rewind_enabled");
+    else
+        ini_section_set_int(cat, "rewind_enabled", rewind_enabled);
+
+    if (trace_flags == 0)
+        ini_section_delete_var(cat, "trace_flags");
+    else
+        ini_section_set_int(cat, "trace_flags", trace_flags);
+
+    if (timer_cost_budget == 0)
+        ini_section_delete_var(cat, "timer_cost_budget");
+    else
+        ini_section_set_int(cat, "timer_cost_budget", timer_cost_budget);
+
     if (scale == 1)
         ini_section_delete_var(cat, "scale");
     else
@@ -1863,6 +1909,16 @@ save_general(void)
     else
         ini_section_delete_var(cat, "do_auto_pause");
 
+    if (background_speed_cap)
+        ini_section_set_int(cat, "background_speed_cap", background_speed_cap);
+    else
+        ini_section_delete_var(cat, "background_speed_cap");
+
+    if (background_balloon)
+        ini_section_set_int(cat, "background_balloon", background_balloon);
+    else
+        ini_section_delete_var(cat, "background_balloon");
+
     char cpu_buf[128] = { 0 };
     plat_get_cpu_string(cpu_buf, 128);
     ini_section_set_string(cat, "host_cpu", cpu_buf);
@@ -1951,6 +2007,26 @@ save_machine(void)
     ini_section_set_int(cat, "mem_size", mem_size);
 
     ini_section_set_int(cat, "cpu_use_dynarec", cpu_use_dynarec);
+
+    if (dynarec_cache_size == 0)
+        ini_section_delete_var(cat, "dynarec_cache_size");
+    else
+        ini_section_set_int(cat, "dynarec_cache_size", dynarec_cache_size);
+
+    if (dynarec_max_block_ins == 0)
+        ini_section_delete_var(cat, "dynarec_max_block_ins");
+    else
+        ini_section_set_int(cat, "dynarec_max_block_ins", dynarec_max_block_ins);
+
+    if (dynarec_max_block_bytes == 0)
+        ini_section_delete_var(cat, "dynarec_max_block_bytes");
+    else
+        ini_section_set_int(cat, "dynarec_max_block_bytes", dynarec_max_block_bytes);
+
+    if (dynarec_idle_skip)
+        ini_section_delete_var(cat, "dynarec_idle_skip");
+    else
+        ini_section_set_int(cat, "dynarec_idle_skip", 0);
     ini_section_set_int(cat, "fpu_softfloat", fpu_softfloat);
 
     if (time_sync & TIME_SYNC_ENABLED)
@@ -2735,8 +2811,9 @@ save_other_removable_devices(void)
     ini_delete_section_if_empty(config, cat);
 }
 
-void
-config_save(void)
+/* Serialize the emulator's state into the in-memory configuration. */
+static void
+config_sync(void)
 {
     save_general();                 /* General */
     for (uint8_t i = 0; i < MONITORS_NUM; i++)
@@ -2752,10 +2829,96 @@ config_save(void)
     save_floppy_and_cdrom_drives(); /* Floppy and CD-ROM drives */
     save_other_removable_devices(); /* Other removable devices */
     save_other_peripherals();       /* Other peripherals */
+}
+
+void
+config_save(void)
+{
+    config_sync();
 
     ini_write(config, cfg_path);
 }
 
+/* Capture the running configuration ahead of the settings dialog, so
+   config_apply() can diff whatever the dialog changed against it. */
+void
+config_snapshot(void)
+{
+    config_sync();
+
+    if (config_prev != NULL)
+        ini_close(config_prev);
+    config_prev = ini_clone(config);
+}
+
+/* Classify one changed variable: returns 1 if it can be applied to the
+   running machine.  Only the host side of the network cards qualifies
+   so far - the emulated hardware must stay as the guest saw it. */
+static int
+config_change_is_hot(const char *section, const char *name, void *priv)
+{
+    uint8_t     *net_changed = (uint8_t *) priv;
+    unsigned int c           = 0;
+
+    if (!strcmp(section, "Network") && (sscanf(name, "net_%02u_", &c) == 1) && (c >= 1) && (c <= NET_CARD_MAX)) {
+        if ((strstr(name, "_net_type") != NULL) || (strstr(name, "_host_device") != NULL)) {
+            net_changed[c - 1] = 1;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* Apply what the settings dialog changed to the running machine.  When
+   everything that differs from the config_snapshot() state is hot-
+   appliable (or nothing differs at all), the affected host backends are
+   re-bound in place and the guest keeps running; otherwise the machine
+   is torn down under the configuration it was built with and brought
+   back up under the new one - the usual hard reset. */
+void
+config_apply(void)
+{
+    uint8_t net_changed[NET_CARD_MAX] = { 0 };
+    int     blocking;
+
+    config_sync();
+
+    blocking = (config_prev == NULL) ? 1 : ini_diff(config, config_prev, config_change_is_hot, net_changed);
+
+    if (blocking == 0) {
+        for (uint8_t c = 0; c < NET_CARD_MAX; c++) {
+            if (net_changed[c])
+                network_reattach(c);
+        }
+
+        /* Re-sync: a backend that failed to come up has knocked its
+           net_type back to none. */
+        config_save();
+        config_changed = 1;
+    } else {
+        ini_t pending = config;
+
+        /* Tear down under the configuration the devices were created
+           with, then bring the machine back up under the new one. */
+        if (config_prev != NULL) {
+            config = config_prev;
+            config_load_sections();
+        }
+        pc_reset_hard_close();
+
+        config = pending;
+        config_load_sections();
+        config_changed = 2;
+        pc_reset_hard_init();
+    }
+
+    if (config_prev != NULL) {
+        ini_close(config_prev);
+        config_prev = NULL;
+    }
+}
+
 ini_t
 config_get_ini(void)
 {
@@ -241,6 +241,9 @@ exec386_2386(int32_t cycs)
         x86_was_reset = 0;
         cycdiff       = 0;
         oldcyc        = cycles;
+        /*See exec386_dynarec_int() - the opcode table cannot change inside
+          the dispatch loop.*/
+        const OpFn *const opcodes = x86_2386_opcodes;
         while (cycdiff < cycle_period) {
             int ins_fetch_fault = 0;
             ins_cycles = cycles;
@@ -289,7 +292,7 @@ exec386_2386(int32_t cycs)
                 cpu_state.eflags &= ~(RF_FLAG);
                 if (opcode == 0xf0)
                     in_lock = 1;
-                x86_2386_opcodes[(opcode | cpu_state.op32) & 0x3ff](fetchdat);
+                opcodes[(opcode | cpu_state.op32) & 0x3ff](fetchdat);
                 in_lock = 0;
                 if (x86_was_reset)
                     break;
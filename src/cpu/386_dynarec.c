@@ -30,6 +30,9 @@
 #include <86box/fdc.h>
 #include <86box/machine.h>
 #include <86box/plat_fallthrough.h>
+#include <86box/bench.h>
+#include <86box/perfctr.h>
+#include <86box/trace.h>
 #include <86box/gdbstub.h>
 #ifdef USE_DYNAREC
 #    include "codegen.h"
@@ -50,6 +53,19 @@
 
 #define CPU_BLOCK_END() cpu_block_end = 1
 
+#ifdef USE_NEW_DYNAREC
+/*CPU_BLOCK_END() plus exit-reason attribution for the block former
+  survey counters; the first reason to end a block wins.*/
+#    define CPU_BLOCK_END_REASON(r)              \
+        do {                                     \
+            if (!cpu_block_end)                  \
+                codegen_block_exit_reason = (r); \
+            CPU_BLOCK_END();                     \
+        } while (0)
+#else
+#    define CPU_BLOCK_END_REASON(r) CPU_BLOCK_END()
+#endif
+
 int cpu_override_dynarec    = 0;
 int inrecomp                = 0;
 int cpu_block_end           = 0;
@@ -269,12 +285,24 @@ update_tsc(void)
     }
 }
 
+#    ifdef USE_NEW_DYNAREC
+/*Block that was executed by the previous dynarec dispatch, so the next
+  dispatch can record a chain link from it to its successor. BLOCK_INVALID
+  whenever the last dispatch did not run a compiled block straight through
+  (interpreted block, abort, or interrupt delivery in between).*/
+static uint16_t dyn_chain_from = BLOCK_INVALID;
+#    endif
+
 static __inline void
 exec386_dynarec_int(void)
 {
     cpu_block_end = 0;
     x86_was_reset = 0;
 
+#    ifdef USE_NEW_DYNAREC
+    dyn_chain_from = BLOCK_INVALID;
+#    endif
+
 #    ifdef USE_DEBUG_REGS_486
     if (trap & 2) {
 #    else
@@ -285,6 +313,11 @@ exec386_dynarec_int(void)
         goto block_ended;
     }
 
+    /*The opcode table only changes from cpu_set(), which cannot happen in
+      the middle of a block - keep the table base in a local so each
+      dispatch is one load and an indirect call instead of two loads.*/
+    const OpFn *const opcodes = x86_opcodes;
+
     while (!cpu_block_end) {
 #    ifndef USE_NEW_DYNAREC
         oldcs  = CS;
@@ -309,7 +342,7 @@ exec386_dynarec_int(void)
             x386_dynarec_log("[%04X:%08X] fetchdat = %08X\n", CS, cpu_state.pc, fetchdat);
 #    endif
 
-        if (!cpu_state.abrt) {
+        if (LIKELY(!cpu_state.abrt)) {
             opcode = fetchdat & 0xFF;
             fetchdat >>= 8;
 
@@ -323,7 +356,7 @@ exec386_dynarec_int(void)
 #    ifdef USE_DEBUG_REGS_486
             cpu_state.eflags &= ~(RF_FLAG);
 #    endif
-            x86_opcodes[(opcode | cpu_state.op32) & 0x3ff](fetchdat);
+            opcodes[(opcode | cpu_state.op32) & 0x3ff](fetchdat);
         }
 
 #    ifndef USE_NEW_DYNAREC
@@ -386,6 +419,54 @@ block_ended:
     cpu_end_block_after_ins = 0;
 }
 
+#    ifdef USE_NEW_DYNAREC
+/*Fixpoint detector for idle poll loops. Win9x's idle loop spins on a
+  memory read instead of halting, so it never trips the HLT path and pegs
+  the host. When a block compiled with CODEBLOCK_IDLE_POLL (no effects
+  beyond registers, lazy flags and loads) branches straight back to its
+  own entry twice in a row without changing any of that state, it cannot
+  make progress until a timer or interrupt changes what it is polling -
+  so hand the rest of the cycle slice back. The slice already ends at the
+  next timer deadline, which bounds the skip; pending interrupts are
+  checked after every dispatch as usual.*/
+typedef struct idle_poll_state_t {
+    uint32_t block_nr;
+    uint32_t regs[8];
+    uint32_t flags_op;
+    uint32_t flags_res;
+    uint32_t flags_op1;
+    uint32_t flags_op2;
+    uint32_t flags;
+    uint32_t eflags;
+} idle_poll_state_t;
+
+static idle_poll_state_t idle_poll;
+
+static void
+exec386_dynarec_idle_check(codeblock_t *block)
+{
+    idle_poll_state_t now;
+
+    now.block_nr = get_block_nr(block);
+    for (uint8_t c = 0; c < 8; c++)
+        now.regs[c] = cpu_state.regs[c].l;
+    now.flags_op  = cpu_state.flags_op;
+    now.flags_res = cpu_state.flags_res;
+    now.flags_op1 = cpu_state.flags_op1;
+    now.flags_op2 = cpu_state.flags_op2;
+    now.flags     = cpu_state.flags;
+    now.eflags    = cpu_state.eflags;
+
+    if (!memcmp(&now, &idle_poll, sizeof(now))) {
+        if (cycles > 0) {
+            PERF_INC(PERF_IDLE_SKIP);
+            cycles = 0;
+        }
+    } else
+        memcpy(&idle_poll, &now, sizeof(now));
+}
+#    endif
+
 static __inline void
 exec386_dynarec_dyn(void)
 {
@@ -394,6 +475,21 @@ exec386_dynarec_dyn(void)
     int      hash      = HASH(phys_addr);
 #    ifdef USE_NEW_DYNAREC
     codeblock_t *block = &codeblock[codeblock_hash[hash]];
+
+    /*If the previously executed block has chained to a successor, try that
+      first - this skips the hash lookup (and possible tree walk) on hot
+      block-to-block transitions. The chained block goes through the full
+      validation below like any hash hit, so a stale link is just a miss.*/
+    if (dyn_chain_from != BLOCK_INVALID) {
+        uint16_t chain_nr = codeblock[dyn_chain_from].chain_block;
+
+        if (chain_nr != BLOCK_INVALID) {
+            codeblock_t *chain_block = &codeblock[chain_nr];
+
+            if ((chain_block->pc == cs + cpu_state.pc) && (chain_block->_cs == cs) && (chain_block->phys == phys_addr))
+                block = chain_block;
+        }
+    }
 #    else
     codeblock_t *block = codeblock_hash[hash];
 #    endif
@@ -413,6 +509,8 @@ exec386_dynarec_dyn(void)
         valid_block = (block->pc == cs + cpu_state.pc) && (block->_cs == cs) && (block->phys == phys_addr) && !((block->status ^ cpu_cur_status) & CPU_STATUS_FLAGS) && ((block->status & cpu_cur_status & CPU_STATUS_MASK) == (cpu_cur_status & CPU_STATUS_MASK));
         if (!valid_block) {
             uint64_t mask = (uint64_t) 1 << ((phys_addr >> PAGE_MASK_SHIFT) & PAGE_MASK_MASK);
+
+            PERF_INC(PERF_BLOCK_MISS);
 #    ifdef USE_NEW_DYNAREC
             int      byte_offset = (phys_addr >> PAGE_BYTE_MASK_SHIFT) & PAGE_BYTE_MASK_OFFSET_MASK;
             uint64_t byte_mask   = 1ULL << (PAGE_BYTE_MASK_MASK & 0x3f);
@@ -423,8 +521,12 @@ exec386_dynarec_dyn(void)
             if (page->code_present_mask[(phys_addr >> PAGE_MASK_INDEX_SHIFT) & PAGE_MASK_INDEX_MASK] & mask)
 #    endif
             {
-                /* Walk page tree to see if we find the correct block */
+                /* Probe the codeblock map to see if we find the correct block */
+#    ifdef USE_NEW_DYNAREC
+                codeblock_t *new_block = codeblock_map_find(phys_addr, cs);
+#    else
                 codeblock_t *new_block = codeblock_tree_find(phys_addr, cs);
+#    endif
                 if (new_block) {
                     valid_block = (new_block->pc == cs + cpu_state.pc) && (new_block->_cs == cs) && (new_block->phys == phys_addr) && !((new_block->status ^ cpu_cur_status) & CPU_STATUS_FLAGS) && ((new_block->status & cpu_cur_status & CPU_STATUS_MASK) == (cpu_cur_status & CPU_STATUS_MASK));
                     if (valid_block) {
@@ -515,24 +617,60 @@ exec386_dynarec_dyn(void)
     {
         void (*code)(void) = (void *) &block->data[BLOCK_START];
 
-#    ifndef USE_NEW_DYNAREC
+#    ifdef USE_NEW_DYNAREC
+        /*Chain the previous block to this one, and remember this block as
+          the chain source for the next dispatch.*/
+        if (dyn_chain_from != BLOCK_INVALID)
+            codeblock[dyn_chain_from].chain_block = get_block_nr(block);
+        dyn_chain_from = get_block_nr(block);
+
+        block->use_stamp = ++codegen_use_epoch;
+        if (block->hotness < DYNAREC_HOTNESS_MAX) {
+            block->hotness++;
+            /*Crossing into the top tier forces one retranslation so the
+              block picks up the full IR optimisation pipeline.*/
+            if (block->hotness == DYNAREC_VERY_HOT_THRESHOLD)
+                block->flags &= ~CODEBLOCK_WAS_RECOMPILED;
+        }
+#    else
         codeblock_hash[hash] = block;
 #    endif
         inrecomp = 1;
+        TRACE_BEGIN(TRACE_CODEGEN, "codegen", "block_execute");
         code();
+        TRACE_END(TRACE_CODEGEN, "codegen", "block_execute");
 #    ifdef USE_ACYCS
         acycs = 0;
 #    endif
         inrecomp = 0;
 
-#    ifndef USE_NEW_DYNAREC
+#    ifdef USE_NEW_DYNAREC
+        if (dynarec_idle_skip && (block->flags & CODEBLOCK_IDLE_POLL) && ((cs + cpu_state.pc) == block->pc) && !cpu_state.abrt && !(cpu_state.flags & T_FLAG))
+            exec386_dynarec_idle_check(block);
+#    else
         if (!use32)
             cpu_state.pc &= 0xffff;
 #    endif
-    } else if (valid_block && !cpu_state.abrt) {
+    }
+#    ifdef USE_NEW_DYNAREC
+    else if (valid_block && !cpu_state.abrt && !codegen_block_check_hot(block)) {
+        /*Valid but still cold - interpret it and put off compilation until
+          the hotness counter says the block is worth the translation time.*/
+        exec386_dynarec_int();
+    }
+#    endif
+    else if (valid_block && !cpu_state.abrt) {
 #    ifdef USE_NEW_DYNAREC
-        start_pc                 = cs + cpu_state.pc;
-        const int max_block_size = (block->flags & CODEBLOCK_BYTE_MASK) ? ((128 - 25) - (start_pc & 0x3f)) : 1000;
+        start_pc           = cs + cpu_state.pc;
+        int max_block_size = (block->flags & CODEBLOCK_BYTE_MASK) ? ((128 - 25) - (start_pc & 0x3f)) : 1000;
+
+        /*The byte limit can only be lowered: blocks growing past two
+          pages would break the page mask invalidation scheme.*/
+        if ((dynarec_max_block_bytes > 0) && (dynarec_max_block_bytes < max_block_size))
+            max_block_size = dynarec_max_block_bytes;
+
+        dyn_chain_from            = BLOCK_INVALID;
+        codegen_block_exit_reason = BLOCK_EXIT_BRANCH;
 #    else
         start_pc = cpu_state.pc;
 #    endif
@@ -545,6 +683,8 @@ exec386_dynarec_dyn(void)
             pthread_jit_write_protect_np(0);
         }
 #    endif
+        bench_codegen_blocks++;
+        TRACE_BEGIN(TRACE_CODEGEN, "codegen", "block_compile");
         codegen_block_start_recompile(block);
         codegen_in_recompile = 1;
 
@@ -593,19 +733,19 @@ exec386_dynarec_dyn(void)
 #    else
             if ((cpu_state.pc - start_pc) > 1000)
 #    endif
-                CPU_BLOCK_END();
+                CPU_BLOCK_END_REASON(BLOCK_EXIT_PAGE_CROSS);
 
             if (cpu_init)
                 CPU_BLOCK_END();
 
             if ((cpu_state.flags & T_FLAG) || (trap == 2))
-                CPU_BLOCK_END();
+                CPU_BLOCK_END_REASON(BLOCK_EXIT_FLAG);
             if (smi_line)
-                CPU_BLOCK_END();
+                CPU_BLOCK_END_REASON(BLOCK_EXIT_FLAG);
             if (nmi && nmi_enable && nmi_mask)
-                CPU_BLOCK_END();
+                CPU_BLOCK_END_REASON(BLOCK_EXIT_FLAG);
             if ((cpu_state.flags & I_FLAG) && pic.int_pending && !cpu_end_block_after_ins)
-                CPU_BLOCK_END();
+                CPU_BLOCK_END_REASON(BLOCK_EXIT_FLAG);
 
             if (cpu_end_block_after_ins) {
                 cpu_end_block_after_ins--;
@@ -620,6 +760,10 @@ exec386_dynarec_dyn(void)
             }
         }
 
+#    ifdef USE_NEW_DYNAREC
+        PERF_INC(PERF_BLOCK_EXIT_BRANCH + codegen_block_exit_reason);
+#    endif
+
         cpu_end_block_after_ins = 0;
 
         if ((!cpu_state.abrt || (cpu_state.abrt & ABRT_EXPECTED)) && !x86_was_reset)
@@ -629,6 +773,7 @@ exec386_dynarec_dyn(void)
             codegen_reset();
 
         codegen_in_recompile = 0;
+        TRACE_END(TRACE_CODEGEN, "codegen", "block_compile");
 #    if defined(__APPLE__) && defined(__aarch64__)
         if (__builtin_available(macOS 11.0, *)) {
             pthread_jit_write_protect_np(1);
@@ -637,8 +782,14 @@ exec386_dynarec_dyn(void)
     } else if (!cpu_state.abrt) {
         /* Mark block but do not recompile */
 #    ifdef USE_NEW_DYNAREC
-        start_pc                 = cs + cpu_state.pc;
-        const int max_block_size = (block->flags & CODEBLOCK_BYTE_MASK) ? ((128 - 25) - (start_pc & 0x3f)) : 1000;
+        start_pc           = cs + cpu_state.pc;
+        int max_block_size = (block->flags & CODEBLOCK_BYTE_MASK) ? ((128 - 25) - (start_pc & 0x3f)) : 1000;
+
+        if ((dynarec_max_block_bytes > 0) && (dynarec_max_block_bytes < max_block_size))
+            max_block_size = dynarec_max_block_bytes;
+
+        dyn_chain_from            = BLOCK_INVALID;
+        codegen_block_exit_reason = BLOCK_EXIT_BRANCH;
 #    else
         start_pc = cpu_state.pc;
 #    endif
@@ -693,19 +844,19 @@ exec386_dynarec_dyn(void)
 #    else
             if ((cpu_state.pc - start_pc) > 1000)
 #    endif
-                CPU_BLOCK_END();
+                CPU_BLOCK_END_REASON(BLOCK_EXIT_PAGE_CROSS);
 
             if (cpu_init)
                 CPU_BLOCK_END();
 
             if (cpu_state.flags & T_FLAG)
-                CPU_BLOCK_END();
+                CPU_BLOCK_END_REASON(BLOCK_EXIT_FLAG);
             if (smi_line)
-                CPU_BLOCK_END();
+                CPU_BLOCK_END_REASON(BLOCK_EXIT_FLAG);
             if (nmi && nmi_enable && nmi_mask)
-                CPU_BLOCK_END();
+                CPU_BLOCK_END_REASON(BLOCK_EXIT_FLAG);
             if ((cpu_state.flags & I_FLAG) && pic.int_pending && !cpu_end_block_after_ins)
-                CPU_BLOCK_END();
+                CPU_BLOCK_END_REASON(BLOCK_EXIT_FLAG);
 
             if (cpu_end_block_after_ins) {
                 cpu_end_block_after_ins--;
@@ -720,6 +871,10 @@ exec386_dynarec_dyn(void)
             }
         }
 
+#    ifdef USE_NEW_DYNAREC
+        PERF_INC(PERF_BLOCK_EXIT_BRANCH + codegen_block_exit_reason);
+#    endif
+
         cpu_end_block_after_ins = 0;
 
         if ((!cpu_state.abrt || (cpu_state.abrt & ABRT_EXPECTED)) && !x86_was_reset)
@@ -745,8 +900,6 @@ exec386_dynarec(int32_t cycs)
     uint64_t oldtsc;
     uint64_t delta;
 
-    int32_t cyc_period = cycs / 2000; /*5us*/
-
 #    ifdef USE_ACYCS
     acycs = 0;
 #    endif
@@ -754,9 +907,25 @@ exec386_dynarec(int32_t cycs)
     while (cycles_main > 0) {
         int32_t cycles_start;
 
+        /*Batch up to the nearest timer deadline, as exec386() does, rather
+          than slicing at a fixed 5us. Devices keep their precision because
+          anything that needs a mid-batch event owns a timer in the queue,
+          which bounds the batch; the per-block check below still catches
+          deadlines that move closer while the batch runs.*/
+        int32_t cyc_period = (timer_target - (uint32_t) tsc) + 1;
+        if (cyc_period > cycles_main)
+            cyc_period = cycles_main;
+        if (cyc_period < 1)
+            cyc_period = 1;
+
         cycles += cyc_period;
         cycles_start = cycles;
 
+#    ifdef USE_NEW_DYNAREC
+        /*Fresh translation budget for this slice - see codegen.h.*/
+        codegen_compile_budget = DYNAREC_COMPILE_BUDGET;
+#    endif
+
         while (cycles > 0) {
 #    ifndef USE_NEW_DYNAREC
             oldcs           = CS;
@@ -783,6 +952,9 @@ exec386_dynarec(int32_t cycs)
             }
 
             if (cpu_state.abrt) {
+#    ifdef USE_NEW_DYNAREC
+                dyn_chain_from = BLOCK_INVALID;
+#    endif
                 flags_rebuild();
                 tempi          = cpu_state.abrt & ABRT_MASK;
                 cpu_state.abrt = 0;
@@ -805,6 +977,13 @@ exec386_dynarec(int32_t cycs)
                 }
             }
 
+#    ifdef USE_NEW_DYNAREC
+            /*Interrupt delivery breaks the sequential block flow - don't
+              record a chain link across it.*/
+            if (smi_line || (nmi && nmi_enable && nmi_mask) || ((cpu_state.flags & I_FLAG) && pic.int_pending))
+                dyn_chain_from = BLOCK_INVALID;
+#    endif
+
             if (smi_line)
                 enter_smm_check(0);
             else if (nmi && nmi_enable && nmi_mask) {
@@ -876,6 +1055,10 @@ exec386(int32_t cycs)
     cycles += cycs;
 
     while (cycles > 0) {
+        /*See exec386_dynarec_int() - the opcode table cannot change inside
+          the dispatch loop.*/
+        const OpFn *const opcodes = x86_opcodes;
+
         cycle_period = (timer_target - (uint32_t) tsc) + 1;
 
         x86_was_reset = 0;
@@ -907,7 +1090,7 @@ exec386(int32_t cycs)
 
             fetchdat = fastreadl_fetch(cs + cpu_state.pc);
 
-            if (!cpu_state.abrt) {
+            if (LIKELY(!cpu_state.abrt)) {
 #ifdef ENABLE_386_LOG
                 if (in_smm)
                     x386_dynarec_log("[%04X:%08X] %08X\n", CS, cpu_state.pc, fetchdat);
@@ -924,8 +1107,8 @@ exec386(int32_t cycs)
 #ifdef USE_DEBUG_REGS_486
                 cpu_state.eflags &= ~(RF_FLAG);
 #endif
-                x86_opcodes[(opcode | cpu_state.op32) & 0x3ff](fetchdat);
-                if (x86_was_reset)
+                opcodes[(opcode | cpu_state.op32) & 0x3ff](fetchdat);
+                if (UNLIKELY(x86_was_reset))
                     break;
             }
 #ifdef ENABLE_386_LOG
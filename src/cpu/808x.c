@@ -43,7 +43,10 @@ uint8_t  use_custom_nmi_vector = 0;
 uint32_t custom_nmi_vector     = 0x00000000;
 
 /* The prefetch queue (4 bytes for 8088, 6 bytes for 8086). */
-static uint8_t pfq[6];
+/* Prefetch queue ring buffer; sized to a power of two so the head can
+   wrap with a mask (the queue itself holds pfq_size bytes at most). */
+static uint8_t pfq[8];
+static int     pfq_head = 0;
 
 /* Variables to aid with the prefetch queue operation. */
 static int biu_cycles = 0, pfq_pos = 0;
@@ -152,6 +155,7 @@ x808x_log(const char *fmt, ...)
 
 static void pfq_add(int c, int add);
 static void set_pzs(int bits);
+static void build_mod_rm_table(void);
 
 uint16_t
 get_last_addr(void)
@@ -423,14 +427,15 @@ pfq_write(void)
     if (is8086 && (pfq_pos < (pfq_size - 1))) {
         /* The 8086 fetches 2 bytes at a time, and only if there's at least 2 bytes
            free in the queue. */
-        tempw                         = readmemwf(pfq_ip);
-        *(uint16_t *) &(pfq[pfq_pos]) = tempw;
+        tempw                             = readmemwf(pfq_ip);
+        pfq[(pfq_head + pfq_pos) & 7]     = tempw & 0xff;
+        pfq[(pfq_head + pfq_pos + 1) & 7] = tempw >> 8;
         pfq_ip += 2;
         pfq_pos += 2;
     } else if (!is8086 && (pfq_pos < pfq_size)) {
         /* The 8088 fetches 1 byte at a time, and only if there's at least 1 byte
            free in the queue. */
-        pfq[pfq_pos] = readmembf(pfq_ip);
+        pfq[(pfq_head + pfq_pos) & 7] = readmembf(pfq_ip);
         pfq_ip++;
         pfq_pos++;
     }
@@ -439,11 +444,10 @@ pfq_write(void)
 static uint8_t
 pfq_read(void)
 {
-    uint8_t temp, i;
+    uint8_t temp;
 
-    temp = pfq[0];
-    for (i = 0; i < (pfq_size - 1); i++)
-        pfq[i] = pfq[i + 1];
+    temp     = pfq[pfq_head];
+    pfq_head = (pfq_head + 1) & 7;
     pfq_pos--;
     cpu_state.pc = (cpu_state.pc + 1) & 0xffff;
     return temp;
@@ -505,16 +509,22 @@ pfq_fetch(void)
 static void
 pfq_add(int c, int add)
 {
-    int d;
+    int writes;
 
     if ((c <= 0) || (pfq_pos >= pfq_size))
         return;
 
-    for (d = 0; d < c; d++) {
-        biu_cycles = (biu_cycles + 1) & 0x03;
-        if (prefetching && add && (biu_cycles == 0x00))
-            pfq_write();
-    }
+    /* The BIU cycle counter wraps modulo 4 and triggers a fetch on each
+       wrap; count the wraps directly instead of stepping the counter one
+       cycle at a time. */
+    writes     = (biu_cycles + c) >> 2;
+    biu_cycles = (biu_cycles + c) & 0x03;
+
+    if (!prefetching || !add)
+        return;
+
+    while (writes-- > 0)
+        pfq_write();
 }
 
 /* Clear the prefetch queue - called on reset and on anything that affects either CS or IP. */
@@ -522,6 +532,7 @@ static void
 pfq_clear(void)
 {
     pfq_pos     = 0;
+    pfq_head    = 0;
     prefetching = 0;
 }
 
@@ -561,6 +572,8 @@ reset_808x(int hard)
         _opseg[3] = &cpu_state.seg_ds;
 
         pfq_size = (is8086) ? 6 : 4;
+
+        build_mod_rm_table();
     }
 
     pfq_clear();
@@ -613,44 +626,100 @@ sign_extend(uint8_t data)
     return data + (data < 0x80 ? 0 : 0xff00);
 }
 
+/* EA computation kinds, precomputed per ModR/M byte. */
+enum {
+    EA_KIND_REG = 0, /* mod = 3, no EA */
+    EA_KIND_DIRECT,  /* mod = 0, r/m = 6: direct address */
+    EA_KIND_NODISP,  /* base/index, no displacement */
+    EA_KIND_DISP8,   /* base/index + sign-extended byte */
+    EA_KIND_DISP16   /* base/index + word */
+};
+
+typedef struct mod_rm_dec_t {
+    uint8_t reg;     /* (rmdat >> 3) & 7 */
+    uint8_t mod;     /* (rmdat >> 6) & 3 */
+    uint8_t rm;      /* rmdat & 7 */
+    uint8_t kind;    /* EA computation kind */
+    uint8_t ea_wait; /* base/index EA cycles (0 for BP+SI/BP+DI/BX+SI/BX+DI pairs) */
+} mod_rm_dec_t;
+
+static mod_rm_dec_t mod_rm_dec[256];
+
+/* Flatten ModR/M decode into one table load per byte - the field
+   extraction and the EA kind/cycle switches only depend on the byte
+   itself. The wait() calls stay separate at run time because each one
+   interleaves with prefetch and DRAM refresh. */
+static void
+build_mod_rm_table(void)
+{
+    mod_rm_dec_t *dec;
+
+    for (uint16_t b = 0; b < 256; b++) {
+        dec      = &mod_rm_dec[b];
+        dec->reg = (b >> 3) & 7;
+        dec->mod = (b >> 6) & 3;
+        dec->rm  = b & 7;
+
+        if (dec->mod == 3)
+            dec->kind = EA_KIND_REG;
+        else if ((b & 0xc7) == 0x06)
+            dec->kind = EA_KIND_DIRECT;
+        else if (dec->mod == 1)
+            dec->kind = EA_KIND_DISP8;
+        else if (dec->mod == 2)
+            dec->kind = EA_KIND_DISP16;
+        else
+            dec->kind = EA_KIND_NODISP;
+
+        switch (dec->rm) {
+            case 0:
+            case 3:
+                dec->ea_wait = 2;
+                break;
+            case 1:
+            case 2:
+                dec->ea_wait = 3;
+                break;
+            default:
+                dec->ea_wait = 0;
+                break;
+        }
+    }
+}
+
 /* Fetches the effective address from the prefetch queue according to MOD and R/M. */
 static void
 do_mod_rm(void)
 {
+    const mod_rm_dec_t *dec;
+
     rmdat   = pfq_fetchb();
-    cpu_reg = (rmdat >> 3) & 7;
-    cpu_mod = (rmdat >> 6) & 3;
-    cpu_rm  = rmdat & 7;
+    dec     = &mod_rm_dec[rmdat & 0xff];
+    cpu_reg = dec->reg;
+    cpu_mod = dec->mod;
+    cpu_rm  = dec->rm;
 
-    if (cpu_mod == 3)
+    if (dec->kind == EA_KIND_REG)
         return;
 
     wait(1, 0);
-    if ((rmdat & 0xc7) == 0x06) {
+    if (dec->kind == EA_KIND_DIRECT) {
         wait(1, 0);
         cpu_state.eaaddr = pfq_fetchw();
         easeg            = ovr_seg ? *ovr_seg : ds;
         wait(1, 0);
         return;
-    } else
-        switch (cpu_rm) {
-            case 0:
-            case 3:
-                wait(2, 0);
-                break;
-            case 1:
-            case 2:
-                wait(3, 0);
-                break;
-        }
+    }
+    if (dec->ea_wait)
+        wait(dec->ea_wait, 0);
     cpu_state.eaaddr = (*mod1add[0][cpu_rm]) + (*mod1add[1][cpu_rm]);
     easeg            = ovr_seg ? *ovr_seg : *mod1seg[cpu_rm];
-    switch (rmdat & 0xc0) {
-        case 0x40:
+    switch (dec->kind) {
+        case EA_KIND_DISP8:
             wait(3, 0);
             cpu_state.eaaddr += sign_extend(pfq_fetchb());
             break;
-        case 0x80:
+        case EA_KIND_DISP16:
             wait(3, 0);
             cpu_state.eaaddr += pfq_fetchw();
             break;
@@ -90,8 +90,12 @@ enum {
 #    define CPUID_DE 0
 #endif
 
-/* Make sure this is as low as possible. */
-cpu_state_t cpu_state;
+/* Make sure this is as low as possible. Cache-line aligned so the hot
+   per-instruction fields deliberately packed at the front of the struct
+   (regs, flags state, pc, cycles) span exactly two lines - the same
+   region the dynarec backends reach with byte displacements off their
+   pinned cpu_state register. */
+_Alignas(64) cpu_state_t cpu_state;
 fpu_state_t fpu_state;
 
 /* Place this immediately after. */
@@ -1781,27 +1785,29 @@ cpu_set(void)
             fatal("cpu_set : unknown CPU type %" PRIu64 "\n", cpu_s->cpu_type);
     }
 
+    /* The pre-487SX FPUs run at the bus clock: fold the clock multiplier
+       into the working tables here instead of multiplying on every
+       executed FPU instruction. */
     switch (fpu_type) {
         case FPU_NONE:
             break;
 
         case FPU_8087:
-            x87_timings = x87_timings_8087;
+            x87_timings_select(&x87_timings_8087, NULL, cpu_multi);
             break;
 
         case FPU_287:
-            x87_timings = x87_timings_287;
+            x87_timings_select(&x87_timings_287, NULL, cpu_multi);
             break;
 
         case FPU_287XL:
         case FPU_387:
-            x87_timings = x87_timings_387;
+            x87_timings_select(&x87_timings_387, NULL, cpu_multi);
             break;
 
         case FPU_487SX:
         default:
-            x87_timings     = x87_timings_486;
-            x87_concurrency = x87_concurrency_486;
+            x87_timings_select(&x87_timings_486, &x87_concurrency_486, 1);
     }
 
     cpu_use_exec = 0;
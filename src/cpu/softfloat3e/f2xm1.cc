@@ -50,7 +50,7 @@ static const float128_t float128_ln2   =
 
 #define EXP_ARR_SIZE 15
 
-static float128_t exp_arr[EXP_ARR_SIZE] =
+static const float128_t exp_arr[EXP_ARR_SIZE] =
 {
     PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
     PACK_FLOAT_128(0x3ffe000000000000, 0x0000000000000000), /*  2 */
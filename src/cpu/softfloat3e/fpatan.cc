@@ -49,7 +49,7 @@ static const float128_t float128_pi4 =
 static const float128_t float128_pi6 =
         packFloat128(BX_CONST64(0x3ffe0c152382d736), BX_CONST64(0x58465BB32E0F580F));
 
-static float128_t atan_arr[FPATAN_ARR_SIZE] =
+static const float128_t atan_arr[FPATAN_ARR_SIZE] =
 {
     PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
     PACK_FLOAT_128(0xbffd555555555555, 0x5555555555555555), /*  3 */
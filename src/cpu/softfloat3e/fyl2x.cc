@@ -45,7 +45,7 @@ static const float128_t float128_ln2inv2 =
 
 #define L2_ARR_SIZE 9
 
-static float128_t ln_arr[L2_ARR_SIZE] =
+static const float128_t ln_arr[L2_ARR_SIZE] =
 {
     PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
     PACK_FLOAT_128(0x3ffd555555555555, 0x5555555555555555), /*  3 */
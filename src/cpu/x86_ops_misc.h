@@ -710,7 +710,18 @@ opHLT(uint32_t fetchdat)
     if (smi_line)
         enter_smm_check(1);
     else if (!((cpu_state.flags & I_FLAG) && pic.int_pending)) {
-        CLOCK_CYCLES_ALWAYS(100);
+        /* Halted with nothing pending: every wake source in the machine is
+           driven off the timer queue, so burn the cycles up to the next
+           deadline in one step instead of re-executing HLT 100 cycles at a
+           time. The guest clock stays exact - the slice ends on the
+           deadline, the due timer fires, and a raised interrupt resumes
+           execution here; with the emulated slice over in almost no host
+           time, the pacing loop sleeps the thread until the next one. */
+        int32_t hlt_cycles = (int32_t) (timer_target - (uint32_t) tsc);
+
+        if (hlt_cycles < 100)
+            hlt_cycles = 100;
+        CLOCK_CYCLES_ALWAYS(hlt_cycles);
         if (!((cpu_state.flags & I_FLAG) && pic.int_pending))
             cpu_state.pc--;
     } else {
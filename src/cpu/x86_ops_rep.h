@@ -2,19 +2,24 @@
     static int opREP_INSB_##size(uint32_t fetchdat)                                                               \
     {                                                                                                             \
         int reads = 0, writes = 0, total_cycles = 0;                                                              \
+        int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);                                      \
                                                                                                                   \
         addr64 = 0x00000000;                                                                                      \
                                                                                                                   \
+        if (trap)                                                                                                 \
+            cycles_end = cycles + 1; /*Force the instruction to end after only one iteration when trap flag set*/ \
         if (CNT_REG > 0) {                                                                                        \
-            uint8_t temp;                                                                                         \
-                                                                                                                  \
             SEG_CHECK_WRITE(&cpu_state.seg_es);                                                                   \
             check_io_perm(DX, 1);                                                                                 \
-            CHECK_WRITE(&cpu_state.seg_es, DEST_REG, DEST_REG);                                                   \
+        }                                                                                                         \
+        while (CNT_REG > 0) {                                                                                     \
+            uint8_t temp;                                                                                         \
+                                                                                                                  \
+            CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG);                                               \
             high_page = 0;                                                                                        \
             do_mmut_wb(es, DEST_REG, &addr64);                                                                    \
             if (cpu_state.abrt)                                                                                   \
-                return 1;                                                                                         \
+                break;                                                                                            \
             temp = inb(DX);                                                                                       \
             writememb_n(es, DEST_REG, addr64, temp);                                                              \
             if (cpu_state.abrt)                                                                                   \
@@ -29,6 +34,8 @@
             reads++;                                                                                              \
             writes++;                                                                                             \
             total_cycles += 15;                                                                                   \
+            if (cycles < cycles_end)                                                                              \
+                break;                                                                                            \
         }                                                                                                         \
         PREFETCH_RUN(total_cycles, 1, -1, reads, 0, writes, 0, 0);                                                \
         if (CNT_REG > 0) {                                                                                        \
@@ -41,19 +48,24 @@
     static int opREP_INSW_##size(uint32_t fetchdat)                                                               \
     {                                                                                                             \
         int reads = 0, writes = 0, total_cycles = 0;                                                              \
+        int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);                                      \
                                                                                                                   \
         addr64a[0] = addr64a[1] = 0x00000000;                                                                     \
                                                                                                                   \
+        if (trap)                                                                                                 \
+            cycles_end = cycles + 1; /*Force the instruction to end after only one iteration when trap flag set*/ \
         if (CNT_REG > 0) {                                                                                        \
-            uint16_t temp;                                                                                        \
-                                                                                                                  \
             SEG_CHECK_WRITE(&cpu_state.seg_es);                                                                   \
             check_io_perm(DX, 2);                                                                                 \
-            CHECK_WRITE(&cpu_state.seg_es, DEST_REG, DEST_REG + 1UL);                                             \
+        }                                                                                                         \
+        while (CNT_REG > 0) {                                                                                     \
+            uint16_t temp;                                                                                        \
+                                                                                                                  \
+            CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG + 1UL);                                         \
             high_page = 0;                                                                                        \
             do_mmut_ww(es, DEST_REG, addr64a);                                                                    \
             if (cpu_state.abrt)                                                                                   \
-                return 1;                                                                                         \
+                break;                                                                                            \
             temp = inw(DX);                                                                                       \
             writememw_n(es, DEST_REG, addr64a, temp);                                                             \
             if (cpu_state.abrt)                                                                                   \
@@ -68,6 +80,8 @@
             reads++;                                                                                              \
             writes++;                                                                                             \
             total_cycles += 15;                                                                                   \
+            if (cycles < cycles_end)                                                                              \
+                break;                                                                                            \
         }                                                                                                         \
         PREFETCH_RUN(total_cycles, 1, -1, reads, 0, writes, 0, 0);                                                \
         if (CNT_REG > 0) {                                                                                        \
@@ -80,19 +94,24 @@
     static int opREP_INSL_##size(uint32_t fetchdat)                                                               \
     {                                                                                                             \
         int reads = 0, writes = 0, total_cycles = 0;                                                              \
+        int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);                                      \
                                                                                                                   \
         addr64a[0] = addr64a[1] = addr64a[2] = addr64a[3] = 0x00000000;                                           \
                                                                                                                   \
+        if (trap)                                                                                                 \
+            cycles_end = cycles + 1; /*Force the instruction to end after only one iteration when trap flag set*/ \
         if (CNT_REG > 0) {                                                                                        \
-            uint32_t temp;                                                                                        \
-                                                                                                                  \
             SEG_CHECK_WRITE(&cpu_state.seg_es);                                                                   \
             check_io_perm(DX, 4);                                                                                 \
-            CHECK_WRITE(&cpu_state.seg_es, DEST_REG, DEST_REG + 3UL);                                             \
+        }                                                                                                         \
+        while (CNT_REG > 0) {                                                                                     \
+            uint32_t temp;                                                                                        \
+                                                                                                                  \
+            CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG + 3UL);                                         \
             high_page = 0;                                                                                        \
             do_mmut_wl(es, DEST_REG, addr64a);                                                                    \
             if (cpu_state.abrt)                                                                                   \
-                return 1;                                                                                         \
+                break;                                                                                            \
             temp = inl(DX);                                                                                       \
             writememl_n(es, DEST_REG, addr64a, temp);                                                             \
             if (cpu_state.abrt)                                                                                   \
@@ -107,6 +126,8 @@
             reads++;                                                                                              \
             writes++;                                                                                             \
             total_cycles += 15;                                                                                   \
+            if (cycles < cycles_end)                                                                              \
+                break;                                                                                            \
         }                                                                                                         \
         PREFETCH_RUN(total_cycles, 1, -1, 0, reads, 0, writes, 0);                                                \
         if (CNT_REG > 0) {                                                                                        \
@@ -120,16 +141,23 @@
     static int opREP_OUTSB_##size(uint32_t fetchdat)                                                              \
     {                                                                                                             \
         int reads = 0, writes = 0, total_cycles = 0;                                                              \
+        int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);                                      \
                                                                                                                   \
+        if (trap)                                                                                                 \
+            cycles_end = cycles + 1; /*Force the instruction to end after only one iteration when trap flag set*/ \
         if (CNT_REG > 0) {                                                                                        \
-            uint8_t temp;                                                                                         \
             SEG_CHECK_READ(cpu_state.ea_seg);                                                                     \
-            CHECK_READ(cpu_state.ea_seg, SRC_REG, SRC_REG);                                                       \
+            check_io_perm(DX, 1);                                                                                 \
+        }                                                                                                         \
+        while (CNT_REG > 0) {                                                                                     \
+            uint8_t temp;                                                                                         \
+                                                                                                                  \
+            CHECK_READ_REP(cpu_state.ea_seg, SRC_REG, SRC_REG);                                                   \
             temp = readmemb(cpu_state.ea_seg->base, SRC_REG);                                                     \
             if (cpu_state.abrt)                                                                                   \
-                return 1;                                                                                         \
-            check_io_perm(DX, 1);                                                                                 \
+                break;                                                                                            \
             outb(DX, temp);                                                                                       \
+                                                                                                                  \
             if (cpu_state.flags & D_FLAG)                                                                         \
                 SRC_REG--;                                                                                        \
             else                                                                                                  \
@@ -139,6 +167,8 @@
             reads++;                                                                                              \
             writes++;                                                                                             \
             total_cycles += 14;                                                                                   \
+            if (cycles < cycles_end)                                                                              \
+                break;                                                                                            \
         }                                                                                                         \
         PREFETCH_RUN(total_cycles, 1, -1, reads, 0, writes, 0, 0);                                                \
         if (CNT_REG > 0) {                                                                                        \
@@ -151,16 +181,23 @@
     static int opREP_OUTSW_##size(uint32_t fetchdat)                                                              \
     {                                                                                                             \
         int reads = 0, writes = 0, total_cycles = 0;                                                              \
+        int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);                                      \
                                                                                                                   \
+        if (trap)                                                                                                 \
+            cycles_end = cycles + 1; /*Force the instruction to end after only one iteration when trap flag set*/ \
         if (CNT_REG > 0) {                                                                                        \
-            uint16_t temp;                                                                                        \
             SEG_CHECK_READ(cpu_state.ea_seg);                                                                     \
-            CHECK_READ(cpu_state.ea_seg, SRC_REG, SRC_REG + 1UL);                                                 \
+            check_io_perm(DX, 2);                                                                                 \
+        }                                                                                                         \
+        while (CNT_REG > 0) {                                                                                     \
+            uint16_t temp;                                                                                        \
+                                                                                                                  \
+            CHECK_READ_REP(cpu_state.ea_seg, SRC_REG, SRC_REG + 1UL);                                             \
             temp = readmemw(cpu_state.ea_seg->base, SRC_REG);                                                     \
             if (cpu_state.abrt)                                                                                   \
-                return 1;                                                                                         \
-            check_io_perm(DX, 2);                                                                                 \
+                break;                                                                                            \
             outw(DX, temp);                                                                                       \
+                                                                                                                  \
             if (cpu_state.flags & D_FLAG)                                                                         \
                 SRC_REG -= 2;                                                                                     \
             else                                                                                                  \
@@ -170,6 +207,8 @@
             reads++;                                                                                              \
             writes++;                                                                                             \
             total_cycles += 14;                                                                                   \
+            if (cycles < cycles_end)                                                                              \
+                break;                                                                                            \
         }                                                                                                         \
         PREFETCH_RUN(total_cycles, 1, -1, reads, 0, writes, 0, 0);                                                \
         if (CNT_REG > 0) {                                                                                        \
@@ -182,16 +221,23 @@
     static int opREP_OUTSL_##size(uint32_t fetchdat)                                                              \
     {                                                                                                             \
         int reads = 0, writes = 0, total_cycles = 0;                                                              \
+        int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);                                      \
                                                                                                                   \
+        if (trap)                                                                                                 \
+            cycles_end = cycles + 1; /*Force the instruction to end after only one iteration when trap flag set*/ \
         if (CNT_REG > 0) {                                                                                        \
-            uint32_t temp;                                                                                        \
             SEG_CHECK_READ(cpu_state.ea_seg);                                                                     \
-            CHECK_READ(cpu_state.ea_seg, SRC_REG, SRC_REG + 3UL);                                                 \
+            check_io_perm(DX, 4);                                                                                 \
+        }                                                                                                         \
+        while (CNT_REG > 0) {                                                                                     \
+            uint32_t temp;                                                                                        \
+                                                                                                                  \
+            CHECK_READ_REP(cpu_state.ea_seg, SRC_REG, SRC_REG + 3UL);                                             \
             temp = readmeml(cpu_state.ea_seg->base, SRC_REG);                                                     \
             if (cpu_state.abrt)                                                                                   \
-                return 1;                                                                                         \
-            check_io_perm(DX, 4);                                                                                 \
+                break;                                                                                            \
             outl(DX, temp);                                                                                       \
+                                                                                                                  \
             if (cpu_state.flags & D_FLAG)                                                                         \
                 SRC_REG -= 4;                                                                                     \
             else                                                                                                  \
@@ -201,6 +247,8 @@
             reads++;                                                                                              \
             writes++;                                                                                             \
             total_cycles += 14;                                                                                   \
+            if (cycles < cycles_end)                                                                              \
+                break;                                                                                            \
         }                                                                                                         \
         PREFETCH_RUN(total_cycles, 1, -1, 0, reads, 0, writes, 0);                                                \
         if (CNT_REG > 0) {                                                                                        \
@@ -433,7 +433,8 @@ loadseg(uint16_t seg, x86seg *s)
         do_seg_load(s, segdat);
 
         cpl_override = 1;
-        writememw(0, addr + 4, segdat[2] | 0x100); /* Set accessed bit */
+        if (!(segdat[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+            writememw(0, addr + 4, segdat[2] | 0x100);
         cpl_override = 0;
         s->checked   = 0;
 #ifdef USE_DYNAREC
@@ -718,7 +719,8 @@ loadcsjmp(uint16_t seg, uint32_t old_pc)
                             cpu_state.pc = newpc;
 
                             cpl_override = 1;
-                            writememw(0, addr + 4, segdat[2] | 0x100); /* Set accessed bit */
+                            if (!(segdat[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+                                writememw(0, addr + 4, segdat[2] | 0x100);
                             cpl_override = 0;
                             break;
 
@@ -943,7 +945,8 @@ loadcscall(uint16_t seg)
             set_use32(segdat[3] & 0x0040);
 
             cpl_override = 1;
-            writememw(0, addr + 4, segdat[2] | 0x100); /* Set accessed bit */
+            if (!(segdat[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+                writememw(0, addr + 4, segdat[2] | 0x100);
             cpl_override = 0;
 
             /* Conforming segments don't change CPL, so preserve existing CPL */
@@ -1092,7 +1095,8 @@ loadcscall(uint16_t seg)
 
                                 x86seg_log("Set access 1\n");
                                 cpl_override = 1;
-                                writememw(0, addr + 4, segdat2[2] | 0x100); /* Set accessed bit */
+                                if (!(segdat2[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+                                    writememw(0, addr + 4, segdat2[2] | 0x100);
                                 cpl_override = 0;
 
                                 CS = seg2;
@@ -1108,7 +1112,8 @@ loadcscall(uint16_t seg)
                                 x86seg_log("Set access 2\n");
 
                                 cpl_override = 1;
-                                writememw(0, oaddr + 4, segdat[2] | 0x100); /* Set accessed bit */
+                                if (!(segdat[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+                                    writememw(0, oaddr + 4, segdat[2] | 0x100);
                                 cpl_override = 0;
 
                                 x86seg_log("Type %04X\n", type);
@@ -1188,7 +1193,8 @@ loadcscall(uint16_t seg)
                             cpu_state.pc = newpc;
 
                             cpl_override = 1;
-                            writememw(0, addr + 4, segdat[2] | 0x100); /* Set accessed bit */
+                            if (!(segdat[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+                                writememw(0, addr + 4, segdat[2] | 0x100);
                             cpl_override = 0;
                             cycles -= timing_call_pm_gate;
                             break;
@@ -1330,7 +1336,8 @@ pmoderetf(int is32, uint16_t off)
         }
 
         cpl_override = 1;
-        writememw(0, addr + 4, segdat[2] | 0x100); /* Set accessed bit */
+        if (!(segdat[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+            writememw(0, addr + 4, segdat[2] | 0x100);
         cpl_override = 0;
 
         cpu_state.pc = newpc;
@@ -1443,8 +1450,10 @@ pmoderetf(int is32, uint16_t off)
         do_seg_load(&cpu_state.seg_ss, segdat2);
 
         cpl_override = 1;
-        writememw(0, addr + 4, segdat2[2] | 0x100); /* Set accessed bit */
-        writememw(0, oaddr + 4, segdat[2] | 0x100); /* Set accessed bit */
+        if (!(segdat2[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+            writememw(0, addr + 4, segdat2[2] | 0x100);
+        if (!(segdat[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+            writememw(0, oaddr + 4, segdat[2] | 0x100);
         cpl_override = 0;
         /* Conforming segments don't change CPL, so CPL = RPL */
         if (segdat[2] & 0x0400)
@@ -1636,7 +1645,8 @@ pmodeint(int num, int soft)
                         do_seg_load(&cpu_state.seg_ss, segdat3);
 
                         cpl_override = 1;
-                        writememw(0, addr + 4, segdat3[2] | 0x100); /* Set accessed bit */
+                        if (!(segdat3[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+                            writememw(0, addr + 4, segdat3[2] | 0x100);
                         cpl_override = 0;
 
                         x86seg_log("New stack %04X:%08X\n", SS, ESP);
@@ -1725,7 +1735,8 @@ pmodeint(int num, int soft)
             set_use32(segdat2[3] & 0x40);
 
             cpl_override = 1;
-            writememw(0, oaddr + 4, segdat2[2] | 0x100); /* Set accessed bit */
+            if (!(segdat2[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+                writememw(0, oaddr + 4, segdat2[2] | 0x100);
             cpl_override = 0;
 
             cpu_state.eflags &= ~VM_FLAG;
@@ -1983,7 +1994,8 @@ pmodeiret(int is32)
         set_use32(segdat[3] & 0x0040);
 
         cpl_override = 1;
-        writememw(0, addr + 4, segdat[2] | 0x100); /* Set accessed bit */
+        if (!(segdat[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+            writememw(0, addr + 4, segdat[2] | 0x100);
         cpl_override = 0;
         cycles -= timing_iret_pm;
     } else { /* Return to outer level */
@@ -2054,8 +2066,10 @@ pmodeiret(int is32)
         do_seg_load(&cpu_state.seg_ss, segdat2);
 
         cpl_override = 1;
-        writememw(0, addr + 4, segdat2[2] | 0x100); /* Set accessed bit */
-        writememw(0, oaddr + 4, segdat[2] | 0x100); /* Set accessed bit */
+        if (!(segdat2[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+            writememw(0, addr + 4, segdat2[2] | 0x100);
+        if (!(segdat[2] & 0x100)) /* Real CPUs only write the accessed bit when clear */
+            writememw(0, oaddr + 4, segdat[2] | 0x100);
         cpl_override = 0;
         /* Conforming segments don't change CPL, so CPL = RPL */
         if (segdat[2] & 0x0400)
@@ -234,8 +234,16 @@ FPU_handle_NaN64(extFloat80_t a, float64 b, extFloat80_t *r, struct softfloat_st
 struct softfloat_status_t
 i387cw_to_softfloat_status_word(uint16_t control_word)
 {
-    struct softfloat_status_t status;
-    int                   precision = control_word & FPU_CW_PC;
+    /* Called once (or more) per x87 instruction, but a pure function of
+       the control word, which changes orders of magnitude less often -
+       memoize the last translation. The cached copy always carries
+       cleared exception flags; callers mutate their returned copy. */
+    static int32_t                   cached_cw = -1;
+    static struct softfloat_status_t status;
+    int                              precision = control_word & FPU_CW_PC;
+
+    if ((int32_t) control_word == cached_cw)
+        return status;
 
     switch (precision) {
         case FPU_PR_32_BITS:
@@ -261,6 +269,9 @@ i387cw_to_softfloat_status_word(uint16_t control_word)
     status.softfloat_suppressException          = 0;
     status.softfloat_exceptionMasks             = control_word & FPU_CW_Exceptions_Mask;
     status.softfloat_denormals_are_zeros        = 0;
+
+    cached_cw = control_word;
+
     return status;
 }
 
@@ -14,8 +14,8 @@
         if ((cpu_state.npxc >> 10) & 3)                                                                                                            \
             fesetround(FE_TONEAREST);                                                                                                              \
         FP_TAG_VALID;                                                                                                                              \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd##cycle_postfix) : ((x87_timings.fadd##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd##cycle_postfix) : ((x87_concurrency.fadd##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fadd##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fadd##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int opFCOM##name##_a##a_size(uint32_t fetchdat)                                                                                         \
@@ -29,8 +29,8 @@
             return 1;                                                                                                                              \
         cpu_state.npxs &= ~(FPU_SW_C0 | FPU_SW_C2 | FPU_SW_C3);                                                                                                         \
         cpu_state.npxs |= x87_compare(ST(0), (double) use_var);                                                                                    \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom##cycle_postfix) : ((x87_timings.fcom##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom##cycle_postfix) : ((x87_concurrency.fcom##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fcom##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fcom##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int opFCOMP##name##_a##a_size(uint32_t fetchdat)                                                                                        \
@@ -45,8 +45,8 @@
         cpu_state.npxs &= ~(FPU_SW_C0 | FPU_SW_C2 | FPU_SW_C3);                                                                                                         \
         cpu_state.npxs |= x87_compare(ST(0), (double) use_var);                                                                                    \
         x87_pop();                                                                                                                                 \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom##cycle_postfix) : ((x87_timings.fcom##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom##cycle_postfix) : ((x87_concurrency.fcom##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fcom##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fcom##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int opFDIV##name##_a##a_size(uint32_t fetchdat)                                                                                         \
@@ -60,8 +60,8 @@
             return 1;                                                                                                                              \
         x87_div(ST(0), ST(0), use_var);                                                                                                            \
         FP_TAG_VALID;                                                                                                                              \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv##cycle_postfix) : ((x87_timings.fdiv##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd##cycle_postfix) : ((x87_concurrency.fadd##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fdiv##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fadd##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int opFDIVR##name##_a##a_size(uint32_t fetchdat)                                                                                        \
@@ -75,8 +75,8 @@
             return 1;                                                                                                                              \
         x87_div(ST(0), use_var, ST(0));                                                                                                            \
         FP_TAG_VALID;                                                                                                                              \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv##cycle_postfix) : ((x87_timings.fdiv##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv##cycle_postfix) : ((x87_concurrency.fdiv##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fdiv##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fdiv##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int opFMUL##name##_a##a_size(uint32_t fetchdat)                                                                                         \
@@ -90,8 +90,8 @@
             return 1;                                                                                                                              \
         ST(0) *= use_var;                                                                                                                          \
         FP_TAG_VALID;                                                                                                                              \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fmul##cycle_postfix) : ((x87_timings.fmul##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fmul##cycle_postfix) : ((x87_concurrency.fmul##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fmul##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fmul##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int opFSUB##name##_a##a_size(uint32_t fetchdat)                                                                                         \
@@ -105,8 +105,8 @@
             return 1;                                                                                                                              \
         ST(0) -= use_var;                                                                                                                          \
         FP_TAG_VALID;                                                                                                                              \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd##cycle_postfix) : ((x87_timings.fadd##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd##cycle_postfix) : ((x87_concurrency.fadd##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fadd##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fadd##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int opFSUBR##name##_a##a_size(uint32_t fetchdat)                                                                                        \
@@ -120,8 +120,8 @@
             return 1;                                                                                                                              \
         ST(0) = use_var - ST(0);                                                                                                                   \
         FP_TAG_VALID;                                                                                                                              \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd##cycle_postfix) : ((x87_timings.fadd##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd##cycle_postfix) : ((x87_concurrency.fadd##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fadd##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fadd##cycle_postfix); \
         return 0;                                                                                                                                  \
     }
 
@@ -151,8 +151,8 @@ static int opFADD(uint32_t fetchdat)
     cpu_state.pc++;
     ST(0) = ST(0) + ST(fetchdat & 7);
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -162,8 +162,8 @@ opFADDr(uint32_t fetchdat)
     cpu_state.pc++;
     ST(fetchdat & 7) = ST(fetchdat & 7) + ST(0);
     FP_TAG_VALID_F;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -174,8 +174,8 @@ opFADDP(uint32_t fetchdat)
     ST(fetchdat & 7) = ST(fetchdat & 7) + ST(0);
     FP_TAG_VALID_F;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 
@@ -189,8 +189,8 @@ opFCOM(uint32_t fetchdat)
         cpu_state.npxs |= FPU_SW_C3;
     else if (ST(0) < ST(fetchdat & 7))
         cpu_state.npxs |= FPU_SW_C0;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom) : (x87_timings.fcom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom) : (x87_concurrency.fcom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fcom);
+    CONCURRENCY_CYCLES(x87_concurrency.fcom);
     return 0;
 }
 
@@ -202,8 +202,8 @@ opFCOMP(uint32_t fetchdat)
     cpu_state.npxs &= ~(FPU_SW_C0 | FPU_SW_C2 | FPU_SW_C3);
     cpu_state.npxs |= x87_compare(ST(0), ST(fetchdat & 7));
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom) : (x87_timings.fcom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom) : (x87_concurrency.fcom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fcom);
+    CONCURRENCY_CYCLES(x87_concurrency.fcom);
     return 0;
 }
 
@@ -223,8 +223,8 @@ opFCOMPP(uint32_t fetchdat)
 
     x87_pop();
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom) : (x87_timings.fcom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom) : (x87_concurrency.fcom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fcom);
+    CONCURRENCY_CYCLES(x87_concurrency.fcom);
     return 0;
 }
 #ifndef FPU_8087
@@ -237,8 +237,8 @@ opFUCOMPP(uint32_t fetchdat)
     cpu_state.npxs |= x87_ucompare(ST(0), ST(1));
     x87_pop();
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fucom) : (x87_timings.fucom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fucom) : (x87_concurrency.fucom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fucom);
+    CONCURRENCY_CYCLES(x87_concurrency.fucom);
     return 0;
 }
 
@@ -254,8 +254,8 @@ opFCOMI(uint32_t fetchdat)
         cpu_state.flags |= Z_FLAG;
     else if (ST(0) < ST(fetchdat & 7))
         cpu_state.flags |= C_FLAG;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom) : (x87_timings.fcom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom) : (x87_concurrency.fcom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fcom);
+    CONCURRENCY_CYCLES(x87_concurrency.fcom);
     return 0;
 }
 static int
@@ -270,8 +270,8 @@ opFCOMIP(uint32_t fetchdat)
     else if (ST(0) < ST(fetchdat & 7))
         cpu_state.flags |= C_FLAG;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom) : (x87_timings.fcom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom) : (x87_concurrency.fcom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fcom);
+    CONCURRENCY_CYCLES(x87_concurrency.fcom);
     return 0;
 }
 #    endif
@@ -284,8 +284,8 @@ opFDIV(uint32_t fetchdat)
     cpu_state.pc++;
     x87_div(ST(0), ST(0), ST(fetchdat & 7));
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 static int
@@ -295,8 +295,8 @@ opFDIVr(uint32_t fetchdat)
     cpu_state.pc++;
     x87_div(ST(fetchdat & 7), ST(fetchdat & 7), ST(0));
     FP_TAG_VALID_F;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 static int
@@ -307,8 +307,8 @@ opFDIVP(uint32_t fetchdat)
     x87_div(ST(fetchdat & 7), ST(fetchdat & 7), ST(0));
     FP_TAG_VALID_F;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 
@@ -319,8 +319,8 @@ opFDIVR(uint32_t fetchdat)
     cpu_state.pc++;
     x87_div(ST(0), ST(fetchdat & 7), ST(0));
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 static int
@@ -330,8 +330,8 @@ opFDIVRr(uint32_t fetchdat)
     cpu_state.pc++;
     x87_div(ST(fetchdat & 7), ST(0), ST(fetchdat & 7));
     FP_TAG_VALID_F;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 static int
@@ -342,8 +342,8 @@ opFDIVRP(uint32_t fetchdat)
     x87_div(ST(fetchdat & 7), ST(0), ST(fetchdat & 7));
     FP_TAG_VALID_F;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 
@@ -354,8 +354,8 @@ opFMUL(uint32_t fetchdat)
     cpu_state.pc++;
     ST(0) = ST(0) * ST(fetchdat & 7);
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fmul) : (x87_timings.fmul * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fmul) : (x87_concurrency.fmul * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fmul);
+    CONCURRENCY_CYCLES(x87_concurrency.fmul);
     return 0;
 }
 static int
@@ -365,8 +365,8 @@ opFMULr(uint32_t fetchdat)
     cpu_state.pc++;
     ST(fetchdat & 7) = ST(0) * ST(fetchdat & 7);
     FP_TAG_VALID_F;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fmul) : (x87_timings.fmul * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fmul) : (x87_concurrency.fmul * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fmul);
+    CONCURRENCY_CYCLES(x87_concurrency.fmul);
     return 0;
 }
 static int
@@ -377,8 +377,8 @@ opFMULP(uint32_t fetchdat)
     ST(fetchdat & 7) = ST(0) * ST(fetchdat & 7);
     FP_TAG_VALID_F;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fmul) : (x87_timings.fmul * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fmul) : (x87_concurrency.fmul * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fmul);
+    CONCURRENCY_CYCLES(x87_concurrency.fmul);
     return 0;
 }
 
@@ -389,8 +389,8 @@ opFSUB(uint32_t fetchdat)
     cpu_state.pc++;
     ST(0) = ST(0) - ST(fetchdat & 7);
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -400,8 +400,8 @@ opFSUBr(uint32_t fetchdat)
     cpu_state.pc++;
     ST(fetchdat & 7) = ST(fetchdat & 7) - ST(0);
     FP_TAG_VALID_F;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -412,8 +412,8 @@ opFSUBP(uint32_t fetchdat)
     ST(fetchdat & 7) = ST(fetchdat & 7) - ST(0);
     FP_TAG_VALID_F;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 
@@ -424,8 +424,8 @@ opFSUBR(uint32_t fetchdat)
     cpu_state.pc++;
     ST(0) = ST(fetchdat & 7) - ST(0);
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -435,8 +435,8 @@ opFSUBRr(uint32_t fetchdat)
     cpu_state.pc++;
     ST(fetchdat & 7) = ST(0) - ST(fetchdat & 7);
     FP_TAG_VALID_F;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -447,8 +447,8 @@ opFSUBRP(uint32_t fetchdat)
     ST(fetchdat & 7) = ST(0) - ST(fetchdat & 7);
     FP_TAG_VALID_F;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 
@@ -460,8 +460,8 @@ opFUCOM(uint32_t fetchdat)
     cpu_state.pc++;
     cpu_state.npxs &= ~(FPU_SW_C0 | FPU_SW_C2 | FPU_SW_C3);
     cpu_state.npxs |= x87_ucompare(ST(0), ST(fetchdat & 7));
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fucom) : (x87_timings.fucom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fucom) : (x87_concurrency.fucom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fucom);
+    CONCURRENCY_CYCLES(x87_concurrency.fucom);
     return 0;
 }
 
@@ -473,8 +473,8 @@ opFUCOMP(uint32_t fetchdat)
     cpu_state.npxs &= ~(FPU_SW_C0 | FPU_SW_C2 | FPU_SW_C3);
     cpu_state.npxs |= x87_ucompare(ST(0), ST(fetchdat & 7));
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fucom) : (x87_timings.fucom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fucom) : (x87_concurrency.fucom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fucom);
+    CONCURRENCY_CYCLES(x87_concurrency.fucom);
     return 0;
 }
 
@@ -490,8 +490,8 @@ opFUCOMI(uint32_t fetchdat)
         cpu_state.flags |= Z_FLAG;
     else if (ST(0) < ST(fetchdat & 7))
         cpu_state.flags |= C_FLAG;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fucom) : (x87_timings.fucom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fucom) : (x87_concurrency.fucom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fucom);
+    CONCURRENCY_CYCLES(x87_concurrency.fucom);
     return 0;
 }
 static int
@@ -506,8 +506,8 @@ opFUCOMIP(uint32_t fetchdat)
     else if (ST(0) < ST(fetchdat & 7))
         cpu_state.flags |= C_FLAG;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fucom) : (x87_timings.fucom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fucom) : (x87_concurrency.fucom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fucom);
+    CONCURRENCY_CYCLES(x87_concurrency.fucom);
     return 0;
 }
 #    endif
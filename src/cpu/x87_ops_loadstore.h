@@ -27,8 +27,8 @@ opFILDiw_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_push((double) temp);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_16) : (x87_timings.fild_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_16) : (x87_concurrency.fild_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_16);
     return 0;
 }
 #ifndef FPU_8087
@@ -43,8 +43,8 @@ opFILDiw_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_push((double) temp);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_16) : (x87_timings.fild_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_16) : (x87_concurrency.fild_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_16);
     return 0;
 }
 #endif
@@ -56,8 +56,8 @@ opFISTiw_a16(uint32_t fetchdat)
     fetch_ea_16(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteaw(x87_fround16(ST(0)));
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_16) : (x87_timings.fist_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_16) : (x87_concurrency.fist_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_16);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -68,8 +68,8 @@ opFISTiw_a32(uint32_t fetchdat)
     fetch_ea_32(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteaw(x87_fround16(ST(0)));
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_16) : (x87_timings.fist_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_16) : (x87_concurrency.fist_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_16);
     return cpu_state.abrt;
 }
 #endif
@@ -84,8 +84,8 @@ opFISTPiw_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_16) : (x87_timings.fist_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_16) : (x87_concurrency.fist_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_16);
     return 0;
 }
 #ifndef FPU_8087
@@ -99,8 +99,8 @@ opFISTPiw_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_16) : (x87_timings.fist_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_16) : (x87_concurrency.fist_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_16);
     return 0;
 }
 #endif
@@ -119,8 +119,8 @@ opFILDiq_a16(uint32_t fetchdat)
     cpu_state.MM[cpu_state.TOP & 7].q = temp64;
     FP_TAG_DEFAULT;
 
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_64) : (x87_timings.fild_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_64) : (x87_concurrency.fild_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_64);
     return 0;
 }
 #ifndef FPU_8087
@@ -138,8 +138,8 @@ opFILDiq_a32(uint32_t fetchdat)
     cpu_state.MM[cpu_state.TOP & 7].q = temp64;
     FP_TAG_DEFAULT;
 
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_64) : (x87_timings.fild_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_64) : (x87_concurrency.fild_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_64);
     return 0;
 }
 #endif
@@ -180,8 +180,8 @@ FBLD_a16(uint32_t fetchdat)
     cpu_state.MM[cpu_state.TOP & 7].q = load_val;
     FP_TAG_DEFAULT;
 
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_64) : (x87_timings.fild_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_64) : (x87_concurrency.fild_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_64);
     return 0;
 }
 #ifndef FPU_8087
@@ -221,8 +221,8 @@ FBLD_a32(uint32_t fetchdat)
     cpu_state.MM[cpu_state.TOP & 7].q = load_val;
     FP_TAG_DEFAULT;
 
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_64) : (x87_timings.fild_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_64) : (x87_concurrency.fild_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_64);
     return 0;
 }
 #endif
@@ -258,8 +258,8 @@ FBSTP_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fbstp) : (x87_timings.fbstp * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fbstp) : (x87_concurrency.fbstp * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fbstp);
+    CONCURRENCY_CYCLES(x87_concurrency.fbstp);
     return 0;
 }
 #ifndef FPU_8087
@@ -290,7 +290,7 @@ FBSTP_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fbstp) : (x87_timings.fbstp * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fbstp);
     return 0;
 }
 #endif
@@ -310,8 +310,8 @@ FISTPiq_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_64) : (x87_timings.fist_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_64) : (x87_concurrency.fist_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_64);
     return 0;
 }
 #ifndef FPU_8087
@@ -330,8 +330,8 @@ FISTPiq_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_64) : (x87_timings.fist_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_64) : (x87_concurrency.fist_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_64);
     return 0;
 }
 #endif
@@ -347,8 +347,8 @@ opFILDil_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_push((double) templ);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_32) : (x87_timings.fild_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_32) : (x87_concurrency.fild_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_32);
     return 0;
 }
 #ifndef FPU_8087
@@ -363,8 +363,8 @@ opFILDil_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_push((double) templ);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_32) : (x87_timings.fild_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_32) : (x87_concurrency.fild_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_32);
     return 0;
 }
 #endif
@@ -376,8 +376,8 @@ opFISTil_a16(uint32_t fetchdat)
     fetch_ea_16(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteal(x87_fround32(ST(0)));
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_32) : (x87_timings.fist_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_32) : (x87_concurrency.fist_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_32);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -388,8 +388,8 @@ opFISTil_a32(uint32_t fetchdat)
     fetch_ea_32(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteal(x87_fround32(ST(0)));
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_32) : (x87_timings.fist_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_32) : (x87_concurrency.fist_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_32);
     return cpu_state.abrt;
 }
 #endif
@@ -404,8 +404,8 @@ opFISTPil_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_32) : (x87_timings.fist_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_32) : (x87_concurrency.fist_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_32);
     return 0;
 }
 #ifndef FPU_8087
@@ -419,8 +419,8 @@ opFISTPil_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_32) : (x87_timings.fist_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_32) : (x87_concurrency.fist_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_32);
     return 0;
 }
 #endif
@@ -436,8 +436,8 @@ opFLDe_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_push(t);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_80) : (x87_timings.fld_80 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_80) : (x87_concurrency.fld_80 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_80);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_80);
     return 0;
 }
 #ifndef FPU_8087
@@ -452,8 +452,8 @@ opFLDe_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_push(t);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_80) : (x87_timings.fld_80 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_80) : (x87_concurrency.fld_80 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_80);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_80);
     return 0;
 }
 #endif
@@ -468,8 +468,8 @@ opFSTPe_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_80) : (x87_timings.fld_80 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_80) : (x87_concurrency.fld_80 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_80);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_80);
     return 0;
 }
 #ifndef FPU_8087
@@ -483,8 +483,8 @@ opFSTPe_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_80) : (x87_timings.fld_80 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_80) : (x87_concurrency.fld_80 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_80);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_80);
     return 0;
 }
 #endif
@@ -500,8 +500,8 @@ opFLDd_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_push(t.d);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_64) : (x87_timings.fld_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_64) : (x87_concurrency.fld_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_64);
     return 0;
 }
 #ifndef FPU_8087
@@ -516,8 +516,8 @@ opFLDd_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_push(t.d);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_64) : (x87_timings.fld_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_64) : (x87_concurrency.fld_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_64);
     return 0;
 }
 #endif
@@ -531,8 +531,8 @@ opFSTd_a16(uint32_t fetchdat)
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     t.d = ST(0);
     seteaq(t.i);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_64) : (x87_timings.fst_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_64) : (x87_concurrency.fst_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_64);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -545,8 +545,8 @@ opFSTd_a32(uint32_t fetchdat)
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     t.d = ST(0);
     seteaq(t.i);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_64) : (x87_timings.fst_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_64) : (x87_concurrency.fst_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_64);
     return cpu_state.abrt;
 }
 #endif
@@ -563,8 +563,8 @@ opFSTPd_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_64) : (x87_timings.fst_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_64) : (x87_concurrency.fst_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_64);
     return 0;
 }
 #ifndef FPU_8087
@@ -580,8 +580,8 @@ opFSTPd_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_64) : (x87_timings.fst_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_64) : (x87_concurrency.fst_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_64);
     return 0;
 }
 #endif
@@ -597,8 +597,8 @@ opFLDs_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_push((double) ts.s);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return 0;
 }
 #ifndef FPU_8087
@@ -613,8 +613,8 @@ opFLDs_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_push((double) ts.s);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return 0;
 }
 #endif
@@ -628,8 +628,8 @@ opFSTs_a16(uint32_t fetchdat)
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     ts.s = (float) ST(0);
     seteal(ts.i);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -642,8 +642,8 @@ opFSTs_a32(uint32_t fetchdat)
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     ts.s = (float) ST(0);
     seteal(ts.i);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return cpu_state.abrt;
 }
 #endif
@@ -660,8 +660,8 @@ opFSTPs_a16(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return 0;
 }
 #ifndef FPU_8087
@@ -677,8 +677,8 @@ opFSTPs_a32(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return 0;
 }
 #endif
@@ -17,8 +17,8 @@ opFSTSW_AX(uint32_t fetchdat)
     FP_ENTER();
     cpu_state.pc++;
     AX = cpu_state.npxs;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstcw_sw) : (x87_timings.fstcw_sw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstcw_sw) : (x87_concurrency.fstcw_sw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstcw_sw);
+    CONCURRENCY_CYCLES(x87_concurrency.fstcw_sw);
     return 0;
 }
 #endif
@@ -28,8 +28,8 @@ opFNOP(uint32_t fetchdat)
 {
     FP_ENTER();
     cpu_state.pc++;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fnop) : (x87_timings.fnop * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fnop) : (x87_concurrency.fnop * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fnop);
+    CONCURRENCY_CYCLES(x87_concurrency.fnop);
     return 0;
 }
 
@@ -50,8 +50,8 @@ opFXTRACT(uint32_t fetchdat)
     ST(0)       = (double) exp80final;
     FP_TAG_VALID;
     x87_push(mant);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fxtract) : (x87_timings.fxtract * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fxtract) : (x87_concurrency.fxtract * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fxtract);
+    CONCURRENCY_CYCLES(x87_concurrency.fxtract);
     return 0;
 }
 
@@ -61,8 +61,8 @@ opFCLEX(uint32_t fetchdat)
     FP_ENTER();
     cpu_state.pc++;
     cpu_state.npxs &= 0xff00;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fnop) : (x87_timings.fnop * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fnop) : (x87_concurrency.fnop * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fnop);
+    CONCURRENCY_CYCLES(x87_concurrency.fnop);
     return 0;
 }
 
@@ -87,8 +87,8 @@ opFINIT(uint32_t fetchdat)
 #endif
     cpu_state.TOP   = 0;
     cpu_state.ismmx = 0;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.finit) : (x87_timings.finit * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.finit) : (x87_concurrency.finit * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.finit);
+    CONCURRENCY_CYCLES(x87_concurrency.finit);
     CPU_BLOCK_END();
     return 0;
 }
@@ -103,8 +103,8 @@ opFFREE(uint32_t fetchdat)
 #else
     cpu_state.tag[(cpu_state.TOP + fetchdat) & 7] = 3;
 #endif
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.ffree) : (x87_timings.ffree * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.ffree) : (x87_concurrency.ffree * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.ffree);
+    CONCURRENCY_CYCLES(x87_concurrency.ffree);
     return 0;
 }
 
@@ -117,8 +117,8 @@ opFFREEP(uint32_t fetchdat)
     if (cpu_state.abrt)
         return 1;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.ffree) : (x87_timings.ffree * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.ffree) : (x87_concurrency.ffree * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.ffree);
+    CONCURRENCY_CYCLES(x87_concurrency.ffree);
     return 0;
 }
 
@@ -129,8 +129,8 @@ opFST(uint32_t fetchdat)
     cpu_state.pc++;
     ST(fetchdat & 7)                              = ST(0);
     cpu_state.tag[(cpu_state.TOP + fetchdat) & 7] = cpu_state.tag[cpu_state.TOP & 7];
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst) : (x87_timings.fst * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst) : (x87_concurrency.fst * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst);
+    CONCURRENCY_CYCLES(x87_concurrency.fst);
     return 0;
 }
 
@@ -142,8 +142,8 @@ opFSTP(uint32_t fetchdat)
     ST(fetchdat & 7)                              = ST(0);
     cpu_state.tag[(cpu_state.TOP + fetchdat) & 7] = cpu_state.tag[cpu_state.TOP & 7];
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst) : (x87_timings.fst * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst) : (x87_concurrency.fst * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst);
+    CONCURRENCY_CYCLES(x87_concurrency.fst);
     return 0;
 }
 
@@ -199,8 +199,8 @@ FSTOR(void)
 #endif
         cpu_state.ismmx = 1;
 
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.frstor) : (x87_timings.frstor * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.frstor) : (x87_concurrency.frstor * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.frstor);
+    CONCURRENCY_CYCLES(x87_concurrency.frstor);
     return cpu_state.abrt;
 }
 static int
@@ -416,8 +416,8 @@ FSAVE(void)
     cpu_state.TOP   = 0;
     cpu_state.ismmx = 0;
 
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsave) : (x87_timings.fsave * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsave) : (x87_concurrency.fsave * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsave);
+    CONCURRENCY_CYCLES(x87_concurrency.fsave);
     return cpu_state.abrt;
 }
 static int
@@ -448,8 +448,8 @@ opFSTSW_a16(uint32_t fetchdat)
     fetch_ea_16(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteaw((cpu_state.npxs & 0xC7FF) | ((cpu_state.TOP & 7) << 11));
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstcw_sw) : (x87_timings.fstcw_sw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstcw_sw) : (x87_concurrency.fstcw_sw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstcw_sw);
+    CONCURRENCY_CYCLES(x87_concurrency.fstcw_sw);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -460,8 +460,8 @@ opFSTSW_a32(uint32_t fetchdat)
     fetch_ea_32(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteaw((cpu_state.npxs & 0xC7FF) | ((cpu_state.TOP & 7) << 11));
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstcw_sw) : (x87_timings.fstcw_sw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstcw_sw) : (x87_concurrency.fstcw_sw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstcw_sw);
+    CONCURRENCY_CYCLES(x87_concurrency.fstcw_sw);
     return cpu_state.abrt;
 }
 #endif
@@ -479,8 +479,8 @@ opFLD(uint32_t fetchdat)
     x87_push(ST(fetchdat & 7));
     cpu_state.tag[cpu_state.TOP & 7]  = old_tag;
     cpu_state.MM[cpu_state.TOP & 7].q = old_i64;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld) : (x87_timings.fld * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld) : (x87_concurrency.fld * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld);
+    CONCURRENCY_CYCLES(x87_concurrency.fld);
     return 0;
 }
 
@@ -502,8 +502,8 @@ opFXCH(uint32_t fetchdat)
     cpu_state.MM[cpu_state.TOP & 7].q              = cpu_state.MM[(cpu_state.TOP + fetchdat) & 7].q;
     cpu_state.MM[(cpu_state.TOP + fetchdat) & 7].q = old_i64;
 
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fxch) : (x87_timings.fxch * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fxch) : (x87_concurrency.fxch * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fxch);
+    CONCURRENCY_CYCLES(x87_concurrency.fxch);
     return 0;
 }
 
@@ -514,8 +514,8 @@ opFCHS(uint32_t fetchdat)
     cpu_state.pc++;
     ST(0) = -ST(0);
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fchs) : (x87_timings.fchs * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fchs) : (x87_concurrency.fchs * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fchs);
+    CONCURRENCY_CYCLES(x87_concurrency.fchs);
     return 0;
 }
 
@@ -526,8 +526,8 @@ opFABS(uint32_t fetchdat)
     cpu_state.pc++;
     ST(0) = fabs(ST(0));
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fabs) : (x87_timings.fabs * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fabs) : (x87_concurrency.fabs * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fabs);
+    CONCURRENCY_CYCLES(x87_concurrency.fabs);
     return 0;
 }
 
@@ -541,8 +541,8 @@ opFTST(uint32_t fetchdat)
         cpu_state.npxs |= FPU_SW_C3;
     else if (ST(0) < 0.0)
         cpu_state.npxs |= FPU_SW_C0;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.ftst) : (x87_timings.ftst * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.ftst) : (x87_concurrency.ftst * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.ftst);
+    CONCURRENCY_CYCLES(x87_concurrency.ftst);
     return 0;
 }
 
@@ -565,8 +565,8 @@ opFXAM(uint32_t fetchdat)
         cpu_state.npxs |= FPU_SW_C2;
     if (ST(0) < 0.0)
         cpu_state.npxs |= FPU_SW_C1;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fxam) : (x87_timings.fxam * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fxam) : (x87_concurrency.fxam * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fxam);
+    CONCURRENCY_CYCLES(x87_concurrency.fxam);
     return 0;
 }
 
@@ -576,8 +576,8 @@ opFLD1(uint32_t fetchdat)
     FP_ENTER();
     cpu_state.pc++;
     x87_push(1.0);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_z1) : (x87_timings.fld_z1 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_z1) : (x87_concurrency.fld_z1 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_z1);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_z1);
     return 0;
 }
 
@@ -587,8 +587,8 @@ opFLDL2T(uint32_t fetchdat)
     FP_ENTER();
     cpu_state.pc++;
     x87_push(3.3219280948873623);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_const) : (x87_timings.fld_const * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_const) : (x87_concurrency.fld_const * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_const);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_const);
     return 0;
 }
 
@@ -598,8 +598,8 @@ opFLDL2E(uint32_t fetchdat)
     FP_ENTER();
     cpu_state.pc++;
     x87_push(1.4426950408889634);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_const) : (x87_timings.fld_const * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_const) : (x87_concurrency.fld_const * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_const);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_const);
     return 0;
 }
 
@@ -609,8 +609,8 @@ opFLDPI(uint32_t fetchdat)
     FP_ENTER();
     cpu_state.pc++;
     x87_push(3.141592653589793);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_const) : (x87_timings.fld_const * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_const) : (x87_concurrency.fld_const * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_const);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_const);
     return 0;
 }
 
@@ -620,8 +620,8 @@ opFLDEG2(uint32_t fetchdat)
     FP_ENTER();
     cpu_state.pc++;
     x87_push(0.3010299956639812);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_const) : (x87_timings.fld_const * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_const) : (x87_concurrency.fld_const * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_const);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_const);
     return 0;
 }
 
@@ -631,8 +631,8 @@ opFLDLN2(uint32_t fetchdat)
     FP_ENTER();
     cpu_state.pc++;
     x87_push_u64(0x3fe62e42fefa39f0ULL);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_const) : (x87_timings.fld_const * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_const) : (x87_concurrency.fld_const * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_const);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_const);
     return 0;
 }
 
@@ -643,8 +643,8 @@ opFLDZ(uint32_t fetchdat)
     cpu_state.pc++;
     x87_push(0.0);
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_z1) : (x87_timings.fld_z1 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_z1) : (x87_concurrency.fld_z1 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_z1);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_z1);
     return 0;
 }
 
@@ -655,8 +655,8 @@ opF2XM1(uint32_t fetchdat)
     cpu_state.pc++;
     ST(0) = pow(2.0, ST(0)) - 1.0;
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.f2xm1) : (x87_timings.f2xm1 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.f2xm1) : (x87_concurrency.f2xm1 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.f2xm1);
+    CONCURRENCY_CYCLES(x87_concurrency.f2xm1);
     return 0;
 }
 
@@ -668,8 +668,8 @@ opFYL2X(uint32_t fetchdat)
     ST(1) = ST(1) * (log(ST(0)) / log(2.0));
     FP_TAG_VALID_N;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fyl2x) : (x87_timings.fyl2x * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fyl2x) : (x87_concurrency.fyl2x * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fyl2x);
+    CONCURRENCY_CYCLES(x87_concurrency.fyl2x);
     return 0;
 }
 
@@ -681,8 +681,8 @@ opFYL2XP1(uint32_t fetchdat)
     ST(1) = ST(1) * (log1p(ST(0)) / log(2.0));
     FP_TAG_VALID_N;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fyl2xp1) : (x87_timings.fyl2xp1 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fyl2xp1) : (x87_concurrency.fyl2xp1 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fyl2xp1);
+    CONCURRENCY_CYCLES(x87_concurrency.fyl2xp1);
     return 0;
 }
 
@@ -695,8 +695,8 @@ opFPTAN(uint32_t fetchdat)
     FP_TAG_VALID;
     x87_push(1.0);
     cpu_state.npxs &= ~FPU_SW_C2;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fptan) : (x87_timings.fptan * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fptan) : (x87_concurrency.fptan * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fptan);
+    CONCURRENCY_CYCLES(x87_concurrency.fptan);
     return 0;
 }
 
@@ -708,8 +708,8 @@ opFPATAN(uint32_t fetchdat)
     ST(1) = atan2(ST(1), ST(0));
     FP_TAG_VALID_N;
     x87_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fpatan) : (x87_timings.fpatan * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fpatan) : (x87_concurrency.fpatan * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fpatan);
+    CONCURRENCY_CYCLES(x87_concurrency.fpatan);
     return 0;
 }
 
@@ -723,8 +723,8 @@ opFDECSTP(uint32_t fetchdat)
 #else
     cpu_state.TOP = (cpu_state.TOP - 1) & 7;
 #endif
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fincdecstp) : (x87_timings.fincdecstp * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fincdecstp) : (x87_concurrency.fincdecstp * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fincdecstp);
+    CONCURRENCY_CYCLES(x87_concurrency.fincdecstp);
     return 0;
 }
 
@@ -738,8 +738,8 @@ opFINCSTP(uint32_t fetchdat)
 #else
     cpu_state.TOP = (cpu_state.TOP + 1) & 7;
 #endif
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fincdecstp) : (x87_timings.fincdecstp * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fincdecstp) : (x87_concurrency.fincdecstp * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fincdecstp);
+    CONCURRENCY_CYCLES(x87_concurrency.fincdecstp);
     return 0;
 }
 
@@ -759,8 +759,8 @@ opFPREM(uint32_t fetchdat)
         cpu_state.npxs |= FPU_SW_C3;
     if (temp64 & 1)
         cpu_state.npxs |= FPU_SW_C1;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fprem) : (x87_timings.fprem * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fprem) : (x87_concurrency.fprem * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fprem);
+    CONCURRENCY_CYCLES(x87_concurrency.fprem);
     return 0;
 }
 
@@ -780,8 +780,8 @@ opFPREM1(uint32_t fetchdat)
         cpu_state.npxs |= FPU_SW_C3;
     if (temp64 & 1)
         cpu_state.npxs |= FPU_SW_C1;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fprem1) : (x87_timings.fprem1 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fprem1) : (x87_concurrency.fprem1 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fprem1);
+    CONCURRENCY_CYCLES(x87_concurrency.fprem1);
     return 0;
 }
 
@@ -792,8 +792,8 @@ opFSQRT(uint32_t fetchdat)
     cpu_state.pc++;
     ST(0) = sqrt(ST(0));
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsqrt) : (x87_timings.fsqrt * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsqrt) : (x87_concurrency.fsqrt * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsqrt);
+    CONCURRENCY_CYCLES(x87_concurrency.fsqrt);
     return 0;
 }
 
@@ -809,8 +809,8 @@ opFSINCOS(uint32_t fetchdat)
     FP_TAG_VALID;
     x87_push(cos(td));
     cpu_state.npxs &= ~FPU_SW_C2;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsincos) : (x87_timings.fsincos * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsincos) : (x87_concurrency.fsincos * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsincos);
+    CONCURRENCY_CYCLES(x87_concurrency.fsincos);
     return 0;
 }
 #endif
@@ -825,8 +825,8 @@ opFRNDINT(uint32_t fetchdat)
     dst0 = x87_fround(ST(0));
     ST(0) = (double) dst0;
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.frndint) : (x87_timings.frndint * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.frndint) : (x87_concurrency.frndint * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.frndint);
+    CONCURRENCY_CYCLES(x87_concurrency.frndint);
     return 0;
 }
 
@@ -840,8 +840,8 @@ opFSCALE(uint32_t fetchdat)
     if (ST(0) != 0.0)
         ST(0) = ST(0) * pow(2.0, (double) temp64);
     FP_TAG_VALID;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fscale) : (x87_timings.fscale * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fscale) : (x87_concurrency.fscale * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fscale);
+    CONCURRENCY_CYCLES(x87_concurrency.fscale);
     return 0;
 }
 
@@ -854,8 +854,8 @@ opFSIN(uint32_t fetchdat)
     ST(0) = sin(ST(0));
     FP_TAG_VALID;
     cpu_state.npxs &= ~FPU_SW_C2;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsin_cos) : (x87_timings.fsin_cos * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsin_cos) : (x87_concurrency.fsin_cos * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsin_cos);
+    CONCURRENCY_CYCLES(x87_concurrency.fsin_cos);
     return 0;
 }
 
@@ -867,8 +867,8 @@ opFCOS(uint32_t fetchdat)
     ST(0) = cos(ST(0));
     FP_TAG_VALID;
     cpu_state.npxs &= ~FPU_SW_C2;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsin_cos) : (x87_timings.fsin_cos * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsin_cos) : (x87_concurrency.fsin_cos * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsin_cos);
+    CONCURRENCY_CYCLES(x87_concurrency.fsin_cos);
     return 0;
 }
 #endif
@@ -895,8 +895,8 @@ FLDENV(void)
             cpu_state.TOP = (cpu_state.npxs >> 11) & 7;
             break;
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fldenv) : (x87_timings.fldenv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fldenv) : (x87_concurrency.fldenv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fldenv);
+    CONCURRENCY_CYCLES(x87_concurrency.fldenv);
     return cpu_state.abrt;
 }
 
@@ -933,8 +933,8 @@ opFLDCW_a16(uint32_t fetchdat)
         return 1;
     cpu_state.npxc = tempw;
     codegen_set_rounding_mode((cpu_state.npxc >> 10) & 3);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fldcw) : (x87_timings.fldcw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fldcw) : (x87_concurrency.fldcw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fldcw);
+    CONCURRENCY_CYCLES(x87_concurrency.fldcw);
     return 0;
 }
 #ifndef FPU_8087
@@ -950,8 +950,8 @@ opFLDCW_a32(uint32_t fetchdat)
         return 1;
     cpu_state.npxc = tempw;
     codegen_set_rounding_mode((cpu_state.npxc >> 10) & 3);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fldcw) : (x87_timings.fldcw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fldcw) : (x87_concurrency.fldcw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fldcw);
+    CONCURRENCY_CYCLES(x87_concurrency.fldcw);
     return 0;
 }
 #endif
@@ -997,8 +997,8 @@ FSTENV(void)
             writememl(easeg, cpu_state.eaaddr + 24, x87_op_seg);
             break;
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstenv) : (x87_timings.fstenv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstenv) : (x87_concurrency.fstenv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstenv);
+    CONCURRENCY_CYCLES(x87_concurrency.fstenv);
     return cpu_state.abrt;
 }
 
@@ -1030,8 +1030,8 @@ opFSTCW_a16(uint32_t fetchdat)
     fetch_ea_16(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteaw(cpu_state.npxc);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstcw_sw) : (x87_timings.fstcw_sw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstenv) : (x87_concurrency.fstenv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstcw_sw);
+    CONCURRENCY_CYCLES(x87_concurrency.fstenv);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -1042,8 +1042,8 @@ opFSTCW_a32(uint32_t fetchdat)
     fetch_ea_32(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteaw(cpu_state.npxc);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstcw_sw) : (x87_timings.fstcw_sw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstcw_sw) : (x87_concurrency.fstcw_sw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstcw_sw);
+    CONCURRENCY_CYCLES(x87_concurrency.fstcw_sw);
     return cpu_state.abrt;
 }
 #endif
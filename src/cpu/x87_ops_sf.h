@@ -255,8 +255,8 @@ sf_FLDCW_a16(uint32_t fetchdat)
         /* clear the B and ES bits in the status-word */
         fpu_state.swd &= ~(FPU_SW_Summary | FPU_SW_Backward);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fldcw) : (x87_timings.fldcw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fldcw) : (x87_concurrency.fldcw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fldcw);
+    CONCURRENCY_CYCLES(x87_concurrency.fldcw);
     return 0;
 }
 #ifndef FPU_8087
@@ -281,8 +281,8 @@ sf_FLDCW_a32(uint32_t fetchdat)
         /* clear the B and ES bits in the status-word */
         fpu_state.swd &= ~(FPU_SW_Summary | FPU_SW_Backward);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fldcw) : (x87_timings.fldcw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fldcw) : (x87_concurrency.fldcw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fldcw);
+    CONCURRENCY_CYCLES(x87_concurrency.fldcw);
     return 0;
 }
 #endif
@@ -296,8 +296,8 @@ sf_FNSTCW_a16(uint32_t fetchdat)
     fetch_ea_16(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteaw(cwd);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstcw_sw) : (x87_timings.fstcw_sw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstenv) : (x87_concurrency.fstenv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstcw_sw);
+    CONCURRENCY_CYCLES(x87_concurrency.fstenv);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -310,8 +310,8 @@ sf_FNSTCW_a32(uint32_t fetchdat)
     fetch_ea_32(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteaw(cwd);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstcw_sw) : (x87_timings.fstcw_sw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstcw_sw) : (x87_concurrency.fstcw_sw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstcw_sw);
+    CONCURRENCY_CYCLES(x87_concurrency.fstcw_sw);
     return cpu_state.abrt;
 }
 #endif
@@ -325,8 +325,8 @@ sf_FNSTSW_a16(uint32_t fetchdat)
     fetch_ea_16(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteaw(swd);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstcw_sw) : (x87_timings.fstcw_sw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstcw_sw) : (x87_concurrency.fstcw_sw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstcw_sw);
+    CONCURRENCY_CYCLES(x87_concurrency.fstcw_sw);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -339,8 +339,8 @@ sf_FNSTSW_a32(uint32_t fetchdat)
     fetch_ea_32(fetchdat);
     SEG_CHECK_WRITE(cpu_state.ea_seg);
     seteaw(swd);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstcw_sw) : (x87_timings.fstcw_sw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstcw_sw) : (x87_concurrency.fstcw_sw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstcw_sw);
+    CONCURRENCY_CYCLES(x87_concurrency.fstcw_sw);
     return cpu_state.abrt;
 }
 #endif
@@ -364,8 +364,8 @@ sf_FNSTSW_AX(uint32_t fetchdat)
     FP_ENTER();
     cpu_state.pc++;
     AX = i387_get_status_word();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstcw_sw) : (x87_timings.fstcw_sw * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstcw_sw) : (x87_concurrency.fstcw_sw * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstcw_sw);
+    CONCURRENCY_CYCLES(x87_concurrency.fstcw_sw);
     return 0;
 }
 #endif
@@ -386,8 +386,8 @@ sf_FRSTOR_a16(uint32_t fetchdat)
         tmp.signExp = readmemw(easeg, offset + (n * 10) + 8);
         FPU_save_regi_tag(tmp, IS_TAG_EMPTY(n) ? X87_TAG_EMPTY : FPU_tagof(tmp), n);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.frstor) : (x87_timings.frstor * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.frstor) : (x87_concurrency.frstor * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.frstor);
+    CONCURRENCY_CYCLES(x87_concurrency.frstor);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -407,8 +407,8 @@ sf_FRSTOR_a32(uint32_t fetchdat)
         tmp.signExp  = readmemw(easeg, offset + (n * 10) + 8);
         FPU_save_regi_tag(tmp, IS_TAG_EMPTY(n) ? X87_TAG_EMPTY : FPU_tagof(tmp), n);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.frstor) : (x87_timings.frstor * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.frstor) : (x87_concurrency.frstor * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.frstor);
+    CONCURRENCY_CYCLES(x87_concurrency.frstor);
     return cpu_state.abrt;
 }
 #endif
@@ -444,8 +444,8 @@ sf_FNSAVE_a16(uint32_t fetchdat)
     fpu_state.fdp   = 0;
     fpu_state.fcs   = 0;
     fpu_state.fip   = 0;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsave) : (x87_timings.fsave * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsave) : (x87_concurrency.fsave * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsave);
+    CONCURRENCY_CYCLES(x87_concurrency.fsave);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -480,8 +480,8 @@ sf_FNSAVE_a32(uint32_t fetchdat)
     fpu_state.fdp   = 0;
     fpu_state.fcs   = 0;
     fpu_state.fip   = 0;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsave) : (x87_timings.fsave * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsave) : (x87_concurrency.fsave * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsave);
+    CONCURRENCY_CYCLES(x87_concurrency.fsave);
     return cpu_state.abrt;
 }
 #endif
@@ -492,8 +492,8 @@ sf_FNCLEX(uint32_t fetchdat)
     FP_ENTER();
     cpu_state.pc++;
     fpu_state.swd &= ~(FPU_SW_Backward | FPU_SW_Summary | FPU_SW_Stack_Fault | FPU_SW_Precision | FPU_SW_Underflow | FPU_SW_Overflow | FPU_SW_Zero_Div | FPU_SW_Denormal_Op | FPU_SW_Invalid);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fnop) : (x87_timings.fnop * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fnop) : (x87_concurrency.fnop * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fnop);
+    CONCURRENCY_CYCLES(x87_concurrency.fnop);
     return 0;
 }
 
@@ -516,8 +516,8 @@ sf_FNINIT(uint32_t fetchdat)
     fpu_state.fcs   = 0;
     fpu_state.fip   = 0;
     cpu_state.ismmx = 0;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.finit) : (x87_timings.finit * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.finit) : (x87_concurrency.finit * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.finit);
+    CONCURRENCY_CYCLES(x87_concurrency.finit);
     CPU_BLOCK_END();
     return 0;
 }
@@ -540,8 +540,8 @@ sf_FLDENV_a16(uint32_t fetchdat)
             FPU_settagi(tag, n);
         }
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fldenv) : (x87_timings.fldenv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fldenv) : (x87_concurrency.fldenv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fldenv);
+    CONCURRENCY_CYCLES(x87_concurrency.fldenv);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -563,8 +563,8 @@ sf_FLDENV_a32(uint32_t fetchdat)
             FPU_settagi(tag, n);
         }
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fldenv) : (x87_timings.fldenv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fldenv) : (x87_concurrency.fldenv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fldenv);
+    CONCURRENCY_CYCLES(x87_concurrency.fldenv);
     return cpu_state.abrt;
 }
 #endif
@@ -580,8 +580,8 @@ sf_FNSTENV_a16(uint32_t fetchdat)
     fpu_state.cwd |= FPU_CW_Exceptions_Mask;
     /* clear the B and ES bits in the status word */
     fpu_state.swd &= ~(FPU_SW_Backward | FPU_SW_Summary);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstenv) : (x87_timings.fstenv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstenv) : (x87_concurrency.fstenv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstenv);
+    CONCURRENCY_CYCLES(x87_concurrency.fstenv);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -596,8 +596,8 @@ sf_FNSTENV_a32(uint32_t fetchdat)
     fpu_state.cwd |= FPU_CW_Exceptions_Mask;
     /* clear the B and ES bits in the status word */
     fpu_state.swd &= ~(FPU_SW_Backward | FPU_SW_Summary);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fstenv) : (x87_timings.fstenv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fstenv) : (x87_concurrency.fstenv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fstenv);
+    CONCURRENCY_CYCLES(x87_concurrency.fstenv);
     return cpu_state.abrt;
 }
 #endif
@@ -609,7 +609,7 @@ sf_FNOP(uint32_t fetchdat)
     pclog("FNOP.\n");
     FPU_check_pending_exceptions();
     cpu_state.pc++;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fnop) : (x87_timings.fnop * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fnop) : (x87_concurrency.fnop * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fnop);
+    CONCURRENCY_CYCLES(x87_concurrency.fnop);
     return 0;
 }
@@ -1,3 +1,140 @@
+/*Host-FPU fast path. On x86 hosts (GCC/Clang), long double is the same
+  80-bit extended format that softfloat3e emulates, so add/sub/mul/div of
+  two normal finite values under round-to-nearest, 80-bit precision and
+  fully masked exceptions produces bit-identical results on the host FPU
+  at a fraction of the cost. The inexact sticky bit comes from the host
+  status flags, and the C1 (round-up) bit from comparing against a
+  truncated recomputation. Special operands, directed rounding, reduced
+  precision and unmasked exceptions all take the softfloat3e path.*/
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#    define X87_HOST_FAST_PATH
+
+enum {
+    X87_HOST_ADD,
+    X87_HOST_SUB,
+    X87_HOST_MUL,
+    X87_HOST_DIV
+};
+
+typedef union {
+    long double ld;
+    floatx80    f;
+} x87_host_reg_t;
+
+static __inline int
+x87_host_reg_ok(floatx80 x)
+{
+    int exp = x.signExp & 0x7fff;
+
+    /*Normal finite values only - zeroes, denormals, pseudo-denormals,
+      unnormals, infinities and NaNs fall back to softfloat3e.*/
+    return exp && (exp != 0x7fff) && (x.signif >> 63);
+}
+
+static __inline int
+x87_host_fast_ok(const struct softfloat_status_t *status, floatx80 a, floatx80 b)
+{
+    if ((status->softfloat_roundingMode != softfloat_round_near_even)
+        || (status->extF80_roundingPrecision != 80)
+        || ((i387_get_control_word() & FPU_CW_Exceptions_Mask) != FPU_CW_Exceptions_Mask))
+        return 0;
+    return x87_host_reg_ok(a) && x87_host_reg_ok(b);
+}
+
+static __inline long double
+x87_host_op(int op, long double a, long double b)
+{
+    switch (op) {
+        case X87_HOST_ADD:
+            return a + b;
+        case X87_HOST_SUB:
+            return a - b;
+        case X87_HOST_MUL:
+            return a * b;
+        default:
+            return a / b;
+    }
+}
+
+static __inline int
+x87_host_arith(int op, floatx80 a, floatx80 b, floatx80 *result, struct softfloat_status_t *status)
+{
+    x87_host_reg_t ua;
+    x87_host_reg_t ub;
+    x87_host_reg_t ur;
+    x87_host_reg_t ut;
+
+    ua.f = a;
+    ub.f = b;
+    feclearexcept(FE_INEXACT);
+    ur.ld = x87_host_op(op, ua.ld, ub.ld);
+    /*Overflow, underflow and exact zeroes take the softfloat3e path so
+      the masked responses and sticky bits come out right.*/
+    if (!x87_host_reg_ok(ur.f))
+        return 0;
+    if (fetestexcept(FE_INEXACT)) {
+        status->softfloat_exceptionFlags |= softfloat_flag_inexact;
+        /*C1 is set if rounding to nearest incremented the significand -
+          ie. the truncated result differs from the one we got.*/
+        fesetround(FE_TOWARDZERO);
+        ut.ld = x87_host_op(op, ua.ld, ub.ld);
+        fesetround(FE_TONEAREST);
+        if ((ut.f.signif != ur.f.signif) || (ut.f.signExp != ur.f.signExp))
+            status->softfloat_exceptionFlags |= RAISE_SW_C1;
+    }
+    *result = ur.f;
+    return 1;
+}
+#endif
+
+static __inline floatx80
+sf_extF80_add(floatx80 a, floatx80 b, struct softfloat_status_t *status)
+{
+#ifdef X87_HOST_FAST_PATH
+    floatx80 result;
+
+    if (x87_host_fast_ok(status, a, b) && x87_host_arith(X87_HOST_ADD, a, b, &result, status))
+        return result;
+#endif
+    return extF80_add(a, b, status);
+}
+
+static __inline floatx80
+sf_extF80_sub(floatx80 a, floatx80 b, struct softfloat_status_t *status)
+{
+#ifdef X87_HOST_FAST_PATH
+    floatx80 result;
+
+    if (x87_host_fast_ok(status, a, b) && x87_host_arith(X87_HOST_SUB, a, b, &result, status))
+        return result;
+#endif
+    return extF80_sub(a, b, status);
+}
+
+static __inline floatx80
+sf_extF80_mul(floatx80 a, floatx80 b, struct softfloat_status_t *status)
+{
+#ifdef X87_HOST_FAST_PATH
+    floatx80 result;
+
+    if (x87_host_fast_ok(status, a, b) && x87_host_arith(X87_HOST_MUL, a, b, &result, status))
+        return result;
+#endif
+    return extF80_mul(a, b, status);
+}
+
+static __inline floatx80
+sf_extF80_div(floatx80 a, floatx80 b, struct softfloat_status_t *status)
+{
+#ifdef X87_HOST_FAST_PATH
+    floatx80 result;
+
+    if (x87_host_fast_ok(status, a, b) && x87_host_arith(X87_HOST_DIV, a, b, &result, status))
+        return result;
+#endif
+    return extF80_div(a, b, status);
+}
+
 #define sf_FPU(name, optype, a_size, load_var, rw, use_var, is_nan, cycle_postfix)                                                                 \
     static int sf_FADD##name##_a##a_size(uint32_t fetchdat)                                                                                        \
     {                                                                                                                                              \
@@ -19,14 +156,14 @@
         status = i387cw_to_softfloat_status_word(i387_get_control_word());                                                                         \
         a      = FPU_read_regi(0);                                                                                                                 \
         if (!is_nan)                                                                                                                               \
-            result = extF80_add(a, use_var, &status);                                                                                              \
+            result = sf_extF80_add(a, use_var, &status);                                                                                              \
                                                                                                                                                    \
         if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))                                                                          \
             FPU_save_regi(result, 0);                                                                                                              \
                                                                                                                                                    \
 next_ins:                                                                                                                                          \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd##cycle_postfix) : ((x87_timings.fadd##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd##cycle_postfix) : ((x87_concurrency.fadd##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fadd##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fadd##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int sf_FDIV##name##_a##a_size(uint32_t fetchdat)                                                                                        \
@@ -49,14 +186,14 @@ next_ins:
         status = i387cw_to_softfloat_status_word(i387_get_control_word());                                                                         \
         a      = FPU_read_regi(0);                                                                                                                 \
         if (!is_nan) {                                                                                                                             \
-            result = extF80_div(a, use_var, &status);                                                                                              \
+            result = sf_extF80_div(a, use_var, &status);                                                                                              \
         }                                                                                                                                          \
         if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))                                                                          \
             FPU_save_regi(result, 0);                                                                                                              \
                                                                                                                                                    \
 next_ins:                                                                                                                                          \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv##cycle_postfix) : ((x87_timings.fdiv##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd##cycle_postfix) : ((x87_concurrency.fadd##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fdiv##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fadd##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int sf_FDIVR##name##_a##a_size(uint32_t fetchdat)                                                                                       \
@@ -79,14 +216,14 @@ next_ins:
         status = i387cw_to_softfloat_status_word(i387_get_control_word());                                                                         \
         a      = FPU_read_regi(0);                                                                                                                 \
         if (!is_nan) {                                                                                                                             \
-            result = extF80_div(use_var, a, &status);                                                                                              \
+            result = sf_extF80_div(use_var, a, &status);                                                                                              \
         }                                                                                                                                          \
         if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))                                                                          \
             FPU_save_regi(result, 0);                                                                                                              \
                                                                                                                                                    \
 next_ins:                                                                                                                                          \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv##cycle_postfix) : ((x87_timings.fdiv##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv##cycle_postfix) : ((x87_concurrency.fdiv##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fdiv##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fdiv##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int sf_FMUL##name##_a##a_size(uint32_t fetchdat)                                                                                        \
@@ -109,14 +246,14 @@ next_ins:
         status = i387cw_to_softfloat_status_word(i387_get_control_word());                                                                         \
         a      = FPU_read_regi(0);                                                                                                                 \
         if (!is_nan) {                                                                                                                             \
-            result = extF80_mul(a, use_var, &status);                                                                                              \
+            result = sf_extF80_mul(a, use_var, &status);                                                                                              \
         }                                                                                                                                          \
         if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))                                                                          \
             FPU_save_regi(result, 0);                                                                                                              \
                                                                                                                                                    \
 next_ins:                                                                                                                                          \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fmul##cycle_postfix) : ((x87_timings.fmul##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fmul##cycle_postfix) : ((x87_concurrency.fmul##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fmul##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fmul##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int sf_FSUB##name##_a##a_size(uint32_t fetchdat)                                                                                        \
@@ -139,14 +276,14 @@ next_ins:
         status = i387cw_to_softfloat_status_word(i387_get_control_word());                                                                         \
         a      = FPU_read_regi(0);                                                                                                                 \
         if (!is_nan)                                                                                                                               \
-            result = extF80_sub(a, use_var, &status);                                                                                              \
+            result = sf_extF80_sub(a, use_var, &status);                                                                                              \
                                                                                                                                                    \
         if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))                                                                          \
             FPU_save_regi(result, 0);                                                                                                              \
                                                                                                                                                    \
 next_ins:                                                                                                                                          \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd##cycle_postfix) : ((x87_timings.fadd##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd##cycle_postfix) : ((x87_concurrency.fadd##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fadd##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fadd##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int sf_FSUBR##name##_a##a_size(uint32_t fetchdat)                                                                                       \
@@ -169,14 +306,14 @@ next_ins:
         status = i387cw_to_softfloat_status_word(i387_get_control_word());                                                                         \
         a      = FPU_read_regi(0);                                                                                                                 \
         if (!is_nan)                                                                                                                               \
-            result = extF80_sub(use_var, a, &status);                                                                                              \
+            result = sf_extF80_sub(use_var, a, &status);                                                                                              \
                                                                                                                                                    \
         if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))                                                                          \
             FPU_save_regi(result, 0);                                                                                                              \
                                                                                                                                                    \
 next_ins:                                                                                                                                          \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd##cycle_postfix) : ((x87_timings.fadd##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd##cycle_postfix) : ((x87_concurrency.fadd##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fadd##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fadd##cycle_postfix); \
         return 0;                                                                                                                                  \
     }
 
@@ -218,14 +355,14 @@ static int sf_FADD_st0_stj(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(0);
     b      = FPU_read_regi(fetchdat & 7);
-    result = extF80_add(a, b, &status);
+    result = sf_extF80_add(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))
         FPU_save_regi(result, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -247,14 +384,14 @@ sf_FADD_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(fetchdat & 7);
     b      = FPU_read_regi(0);
-    result = extF80_add(a, b, &status);
+    result = sf_extF80_add(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))
         FPU_save_regi(result, fetchdat & 7);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 
@@ -277,7 +414,7 @@ sf_FADDP_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(fetchdat & 7);
     b      = FPU_read_regi(0);
-    result = extF80_add(a, b, &status);
+    result = sf_extF80_add(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, fetchdat & 7);
@@ -285,8 +422,8 @@ sf_FADDP_sti_st0(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 
@@ -309,14 +446,14 @@ sf_FDIV_st0_stj(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(0);
     b      = FPU_read_regi(fetchdat & 7);
-    result = extF80_div(a, b, &status);
+    result = sf_extF80_div(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))
         FPU_save_regi(result, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 
@@ -339,14 +476,14 @@ sf_FDIV_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(fetchdat & 7);
     b      = FPU_read_regi(0);
-    result = extF80_div(a, b, &status);
+    result = sf_extF80_div(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))
         FPU_save_regi(result, fetchdat & 7);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 static int
@@ -368,7 +505,7 @@ sf_FDIVP_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(fetchdat & 7);
     b      = FPU_read_regi(0);
-    result = extF80_div(a, b, &status);
+    result = sf_extF80_div(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, fetchdat & 7);
@@ -376,8 +513,8 @@ sf_FDIVP_sti_st0(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 
@@ -400,14 +537,14 @@ sf_FDIVR_st0_stj(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(fetchdat & 7);
     b      = FPU_read_regi(0);
-    result = extF80_div(a, b, &status);
+    result = sf_extF80_div(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))
         FPU_save_regi(result, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 static int
@@ -429,14 +566,14 @@ sf_FDIVR_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(0);
     b      = FPU_read_regi(fetchdat & 7);
-    result = extF80_div(a, b, &status);
+    result = sf_extF80_div(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0))
         FPU_save_regi(result, fetchdat & 7);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 static int
@@ -458,7 +595,7 @@ sf_FDIVRP_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(0);
     b      = FPU_read_regi(fetchdat & 7);
-    result = extF80_div(a, b, &status);
+    result = sf_extF80_div(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, fetchdat & 7);
@@ -466,8 +603,8 @@ sf_FDIVRP_sti_st0(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fdiv) : (x87_timings.fdiv * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fdiv) : (x87_concurrency.fdiv * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fdiv);
+    CONCURRENCY_CYCLES(x87_concurrency.fdiv);
     return 0;
 }
 
@@ -490,15 +627,15 @@ sf_FMUL_st0_stj(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(0);
     b      = FPU_read_regi(fetchdat & 7);
-    result = extF80_mul(a, b, &status);
+    result = sf_extF80_mul(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, 0);
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fmul) : (x87_timings.fmul * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fmul) : (x87_concurrency.fmul * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fmul);
+    CONCURRENCY_CYCLES(x87_concurrency.fmul);
     return 0;
 }
 static int
@@ -520,15 +657,15 @@ sf_FMUL_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(0);
     b      = FPU_read_regi(fetchdat & 7);
-    result = extF80_mul(a, b, &status);
+    result = sf_extF80_mul(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, fetchdat & 7);
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fmul) : (x87_timings.fmul * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fmul) : (x87_concurrency.fmul * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fmul);
+    CONCURRENCY_CYCLES(x87_concurrency.fmul);
     return 0;
 }
 static int
@@ -550,7 +687,7 @@ sf_FMULP_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(fetchdat & 7);
     b      = FPU_read_regi(0);
-    result = extF80_mul(a, b, &status);
+    result = sf_extF80_mul(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, fetchdat & 7);
@@ -558,8 +695,8 @@ sf_FMULP_sti_st0(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fmul) : (x87_timings.fmul * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fmul) : (x87_concurrency.fmul * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fmul);
+    CONCURRENCY_CYCLES(x87_concurrency.fmul);
     return 0;
 }
 
@@ -582,15 +719,15 @@ sf_FSUB_st0_stj(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(0);
     b      = FPU_read_regi(fetchdat & 7);
-    result = extF80_sub(a, b, &status);
+    result = sf_extF80_sub(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, 0);
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -612,15 +749,15 @@ sf_FSUB_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(fetchdat & 7);
     b      = FPU_read_regi(0);
-    result = extF80_sub(a, b, &status);
+    result = sf_extF80_sub(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, fetchdat & 7);
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -642,7 +779,7 @@ sf_FSUBP_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(fetchdat & 7);
     b      = FPU_read_regi(0);
-    result = extF80_sub(a, b, &status);
+    result = sf_extF80_sub(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, fetchdat & 7);
@@ -650,8 +787,8 @@ sf_FSUBP_sti_st0(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 
@@ -674,15 +811,15 @@ sf_FSUBR_st0_stj(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(fetchdat & 7);
     b      = FPU_read_regi(0);
-    result = extF80_sub(a, b, &status);
+    result = sf_extF80_sub(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, 0);
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -704,15 +841,15 @@ sf_FSUBR_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(0);
     b      = FPU_read_regi(fetchdat & 7);
-    result = extF80_sub(a, b, &status);
+    result = sf_extF80_sub(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, fetchdat & 7);
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 static int
@@ -734,7 +871,7 @@ sf_FSUBRP_sti_st0(uint32_t fetchdat)
     status = i387cw_to_softfloat_status_word(i387_get_control_word());
     a      = FPU_read_regi(0);
     b      = FPU_read_regi(fetchdat & 7);
-    result = extF80_sub(a, b, &status);
+    result = sf_extF80_sub(a, b, &status);
 
     if (!FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0)) {
         FPU_save_regi(result, fetchdat & 7);
@@ -742,8 +879,8 @@ sf_FSUBRP_sti_st0(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fadd) : (x87_timings.fadd * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fadd) : (x87_concurrency.fadd * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fadd);
+    CONCURRENCY_CYCLES(x87_concurrency.fadd);
     return 0;
 }
 
@@ -769,8 +906,8 @@ sf_FSQRT(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsqrt) : (x87_timings.fsqrt * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsqrt) : (x87_concurrency.fsqrt * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsqrt);
+    CONCURRENCY_CYCLES(x87_concurrency.fsqrt);
     return 0;
 }
 
@@ -796,7 +933,7 @@ sf_FRNDINT(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.frndint) : (x87_timings.frndint * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.frndint) : (x87_concurrency.frndint * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.frndint);
+    CONCURRENCY_CYCLES(x87_concurrency.frndint);
     return 0;
 }
@@ -30,8 +30,8 @@
         FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0);                                                                               \
                                                                                                                                                    \
 next_ins:                                                                                                                                          \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom##cycle_postfix) : ((x87_timings.fcom##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom##cycle_postfix) : ((x87_concurrency.fcom##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fcom##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fcom##cycle_postfix); \
         return 0;                                                                                                                                  \
     }                                                                                                                                              \
     static int sf_FCOMP##name##_a##a_size(uint32_t fetchdat)                                                                                       \
@@ -69,8 +69,8 @@ next_ins:
             FPU_pop();                                                                                                                             \
                                                                                                                                                    \
 next_ins:                                                                                                                                          \
-        CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom##cycle_postfix) : ((x87_timings.fcom##cycle_postfix) * cpu_multi));           \
-        CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom##cycle_postfix) : ((x87_concurrency.fcom##cycle_postfix) * cpu_multi)); \
+        CLOCK_CYCLES_FPU(x87_timings.fcom##cycle_postfix);           \
+        CONCURRENCY_CYCLES(x87_concurrency.fcom##cycle_postfix); \
         return 0;                                                                                                                                  \
     }
 
@@ -119,8 +119,8 @@ sf_FCOM_sti(uint32_t fetchdat)
     FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom) : (x87_timings.fcom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom) : (x87_concurrency.fcom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fcom);
+    CONCURRENCY_CYCLES(x87_concurrency.fcom);
     return 0;
 }
 
@@ -154,8 +154,8 @@ sf_FCOMP_sti(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom) : (x87_timings.fcom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom) : (x87_concurrency.fcom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fcom);
+    CONCURRENCY_CYCLES(x87_concurrency.fcom);
     return 0;
 }
 
@@ -191,8 +191,8 @@ sf_FCOMPP(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom) : (x87_timings.fcom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom) : (x87_concurrency.fcom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fcom);
+    CONCURRENCY_CYCLES(x87_concurrency.fcom);
     return 0;
 }
 
@@ -229,8 +229,8 @@ sf_FUCOMPP(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fucom) : (x87_timings.fucom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fucom) : (x87_concurrency.fucom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fucom);
+    CONCURRENCY_CYCLES(x87_concurrency.fucom);
     return 0;
 }
 
@@ -261,8 +261,8 @@ sf_FCOMI_st0_stj(uint32_t fetchdat)
     FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom) : (x87_timings.fcom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom) : (x87_concurrency.fcom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fcom);
+    CONCURRENCY_CYCLES(x87_concurrency.fcom);
     return 0;
 }
 static int
@@ -296,8 +296,8 @@ sf_FCOMIP_st0_stj(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fcom) : (x87_timings.fcom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fcom) : (x87_concurrency.fcom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fcom);
+    CONCURRENCY_CYCLES(x87_concurrency.fcom);
     return 0;
 }
 #endif
@@ -327,8 +327,8 @@ sf_FUCOM_sti(uint32_t fetchdat)
     FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fucom) : (x87_timings.fucom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fucom) : (x87_concurrency.fucom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fucom);
+    CONCURRENCY_CYCLES(x87_concurrency.fucom);
     return 0;
 }
 
@@ -361,8 +361,8 @@ sf_FUCOMP_sti(uint32_t fetchdat)
         FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fucom) : (x87_timings.fucom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fucom) : (x87_concurrency.fucom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fucom);
+    CONCURRENCY_CYCLES(x87_concurrency.fucom);
     return 0;
 }
 
@@ -393,8 +393,8 @@ sf_FUCOMI_st0_stj(uint32_t fetchdat)
     FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fucom) : (x87_timings.fucom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fucom) : (x87_concurrency.fucom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fucom);
+    CONCURRENCY_CYCLES(x87_concurrency.fucom);
     return 0;
 }
 static int
@@ -427,8 +427,8 @@ sf_FUCOMIP_st0_stj(uint32_t fetchdat)
         FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fucom) : (x87_timings.fucom * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fucom) : (x87_concurrency.fucom * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fucom);
+    CONCURRENCY_CYCLES(x87_concurrency.fucom);
     return 0;
 }
 #endif
@@ -454,8 +454,8 @@ sf_FTST(uint32_t fetchdat)
         setcc(FPU_status_word_flags_fpu_compare(rc));
         FPU_exception(fetchdat, status.softfloat_exceptionFlags, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.ftst) : (x87_timings.ftst * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.ftst) : (x87_concurrency.ftst * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.ftst);
+    CONCURRENCY_CYCLES(x87_concurrency.ftst);
     return 0;
 }
 
@@ -511,7 +511,7 @@ sf_FXAM(uint32_t fetchdat)
     if (!sign)
         clear_C1();
 
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fxam) : (x87_timings.fxam * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fxam) : (x87_concurrency.fxam * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fxam);
+    CONCURRENCY_CYCLES(x87_concurrency.fxam);
     return 0;
 }
@@ -16,8 +16,8 @@ sf_FLDL2T(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(FPU_round_const(Const_L2T, (fpu_state.cwd & FPU_CW_RC) == FPU_RC_UP), 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_const) : (x87_timings.fld_const * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_const) : (x87_concurrency.fld_const * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_const);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_const);
     return 0;
 }
 
@@ -34,8 +34,8 @@ sf_FLDL2E(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(FPU_round_const(Const_L2E, DOWN_OR_CHOP() ? -1 : 0), 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_const) : (x87_timings.fld_const * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_const) : (x87_concurrency.fld_const * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_const);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_const);
     return 0;
 }
 
@@ -52,8 +52,8 @@ sf_FLDPI(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(FPU_round_const(Const_PI, DOWN_OR_CHOP() ? -1 : 0), 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_const) : (x87_timings.fld_const * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_const) : (x87_concurrency.fld_const * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_const);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_const);
     return 0;
 }
 
@@ -70,8 +70,8 @@ sf_FLDEG2(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(FPU_round_const(Const_LG2, DOWN_OR_CHOP() ? -1 : 0), 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_const) : (x87_timings.fld_const * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_const) : (x87_concurrency.fld_const * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_const);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_const);
     return 0;
 }
 
@@ -88,8 +88,8 @@ sf_FLDLN2(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(FPU_round_const(Const_LN2, DOWN_OR_CHOP() ? -1 : 0), 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_const) : (x87_timings.fld_const * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_const) : (x87_concurrency.fld_const * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_const);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_const);
     return 0;
 }
 
@@ -106,8 +106,8 @@ sf_FLD1(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(Const_1, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_z1) : (x87_timings.fld_z1 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_z1) : (x87_concurrency.fld_z1 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_z1);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_z1);
     return 0;
 }
 
@@ -124,7 +124,7 @@ sf_FLDZ(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(Const_Z, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_z1) : (x87_timings.fld_z1 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_z1) : (x87_concurrency.fld_z1 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_z1);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_z1);
     return 0;
 }
@@ -45,8 +45,8 @@ sf_FILDiw_a16(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_16) : (x87_timings.fild_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_16) : (x87_concurrency.fild_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_16);
     return 0;
 }
 #ifndef FPU_8087
@@ -71,8 +71,8 @@ sf_FILDiw_a32(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_16) : (x87_timings.fild_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_16) : (x87_concurrency.fild_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_16);
     return 0;
 }
 #endif
@@ -98,8 +98,8 @@ sf_FILDil_a16(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_32) : (x87_timings.fild_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_32) : (x87_concurrency.fild_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_32);
     return 0;
 }
 #ifndef FPU_8087
@@ -124,8 +124,8 @@ sf_FILDil_a32(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_32) : (x87_timings.fild_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_32) : (x87_concurrency.fild_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_32);
     return 0;
 }
 #endif
@@ -151,8 +151,8 @@ sf_FILDiq_a16(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_64) : (x87_timings.fild_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_64) : (x87_concurrency.fild_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_64);
     return 0;
 }
 #ifndef FPU_8087
@@ -177,8 +177,8 @@ sf_FILDiq_a32(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_64) : (x87_timings.fild_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_64) : (x87_concurrency.fild_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_64);
     return 0;
 }
 #endif
@@ -220,8 +220,8 @@ sf_FBLD_PACKED_BCD_a16(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_64) : (x87_timings.fild_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_64) : (x87_concurrency.fild_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_64);
     return 0;
 }
 #ifndef FPU_8087
@@ -262,8 +262,8 @@ sf_FBLD_PACKED_BCD_a32(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fild_64) : (x87_timings.fild_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fild_64) : (x87_concurrency.fild_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fild_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fild_64);
     return 0;
 }
 #endif
@@ -297,8 +297,8 @@ sf_FLDs_a16(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return 0;
 }
 #ifndef FPU_8087
@@ -331,8 +331,8 @@ sf_FLDs_a32(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return 0;
 }
 #endif
@@ -366,8 +366,8 @@ sf_FLDd_a16(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_64) : (x87_timings.fld_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_64) : (x87_concurrency.fld_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_64);
     return 0;
 }
 #ifndef FPU_8087
@@ -400,8 +400,8 @@ sf_FLDd_a32(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_64) : (x87_timings.fld_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_64) : (x87_concurrency.fld_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_64);
     return 0;
 }
 #endif
@@ -427,8 +427,8 @@ sf_FLDe_a16(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_80) : (x87_timings.fld_80 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_80) : (x87_concurrency.fld_80 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_80);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_80);
     return 0;
 }
 #ifndef FPU_8087
@@ -453,8 +453,8 @@ sf_FLDe_a32(uint32_t fetchdat)
         FPU_push();
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld_80) : (x87_timings.fld_80 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld_80) : (x87_concurrency.fld_80 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld_80);
+    CONCURRENCY_CYCLES(x87_concurrency.fld_80);
     return 0;
 }
 #endif
@@ -485,8 +485,8 @@ sf_FLD_sti(uint32_t fetchdat)
     FPU_save_regi(sti_reg, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fld) : (x87_timings.fld * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fld) : (x87_concurrency.fld * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fld);
+    CONCURRENCY_CYCLES(x87_concurrency.fld);
     return 0;
 }
 
@@ -520,8 +520,8 @@ sf_FISTiw_a16(uint32_t fetchdat)
     fpu_state.swd = sw;
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_16) : (x87_timings.fist_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_16) : (x87_concurrency.fist_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_16);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -553,8 +553,8 @@ sf_FISTiw_a32(uint32_t fetchdat)
     fpu_state.swd = sw;
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_16) : (x87_timings.fist_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_16) : (x87_concurrency.fist_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_16);
     return cpu_state.abrt;
 }
 #endif
@@ -591,8 +591,8 @@ sf_FISTPiw_a16(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_16) : (x87_timings.fist_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_16) : (x87_concurrency.fist_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_16);
     return 0;
 }
 #ifndef FPU_8087
@@ -627,8 +627,8 @@ sf_FISTPiw_a32(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_16) : (x87_timings.fist_16 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_16) : (x87_concurrency.fist_16 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_16);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_16);
     return 0;
 }
 #endif
@@ -662,8 +662,8 @@ sf_FISTil_a16(uint32_t fetchdat)
     fpu_state.swd = sw;
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_32) : (x87_timings.fist_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_32) : (x87_concurrency.fist_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_32);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -695,8 +695,8 @@ sf_FISTil_a32(uint32_t fetchdat)
     fpu_state.swd = sw;
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_32) : (x87_timings.fist_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_32) : (x87_concurrency.fist_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_32);
     return cpu_state.abrt;
 }
 #endif
@@ -733,8 +733,8 @@ sf_FISTPil_a16(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_32) : (x87_timings.fist_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_32) : (x87_concurrency.fist_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_32);
     return 0;
 }
 #ifndef FPU_8087
@@ -769,8 +769,8 @@ sf_FISTPil_a32(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_32) : (x87_timings.fist_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_32) : (x87_concurrency.fist_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_32);
     return 0;
 }
 #endif
@@ -807,8 +807,8 @@ sf_FISTPiq_a16(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_64) : (x87_timings.fist_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_64) : (x87_concurrency.fist_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_64);
     return 0;
 }
 #ifndef FPU_8087
@@ -843,8 +843,8 @@ sf_FISTPiq_a32(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fist_64) : (x87_timings.fist_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fist_64) : (x87_concurrency.fist_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fist_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fist_64);
     return 0;
 }
 #endif
@@ -908,8 +908,8 @@ sf_FBSTP_PACKED_BCD_a16(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fbstp) : (x87_timings.fbstp * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fbstp) : (x87_concurrency.fbstp * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fbstp);
+    CONCURRENCY_CYCLES(x87_concurrency.fbstp);
     return 0;
 }
 #ifndef FPU_8087
@@ -972,8 +972,8 @@ sf_FBSTP_PACKED_BCD_a32(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fbstp) : (x87_timings.fbstp * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fbstp) : (x87_concurrency.fbstp * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fbstp);
+    CONCURRENCY_CYCLES(x87_concurrency.fbstp);
     return 0;
 }
 #endif
@@ -1007,8 +1007,8 @@ sf_FSTs_a16(uint32_t fetchdat)
     fpu_state.swd = sw;
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -1040,8 +1040,8 @@ sf_FSTs_a32(uint32_t fetchdat)
     fpu_state.swd = sw;
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return cpu_state.abrt;
 }
 #endif
@@ -1079,8 +1079,8 @@ sf_FSTPs_a16(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return 0;
 }
 #ifndef FPU_8087
@@ -1116,8 +1116,8 @@ sf_FSTPs_a32(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_32) : (x87_timings.fst_32 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_32) : (x87_concurrency.fst_32 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_32);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_32);
     return 0;
 }
 #endif
@@ -1151,8 +1151,8 @@ sf_FSTd_a16(uint32_t fetchdat)
     fpu_state.swd = sw;
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_64) : (x87_timings.fst_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_64) : (x87_concurrency.fst_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_64);
     return cpu_state.abrt;
 }
 #ifndef FPU_8087
@@ -1184,8 +1184,8 @@ sf_FSTd_a32(uint32_t fetchdat)
     fpu_state.swd = sw;
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_64) : (x87_timings.fst_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_64) : (x87_concurrency.fst_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_64);
     return cpu_state.abrt;
 }
 #endif
@@ -1224,8 +1224,8 @@ sf_FSTPd_a16(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_64) : (x87_timings.fst_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_64) : (x87_concurrency.fst_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_64);
     return 0;
 }
 #ifndef FPU_8087
@@ -1261,8 +1261,8 @@ sf_FSTPd_a32(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_64) : (x87_timings.fst_64 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_64) : (x87_concurrency.fst_64 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_64);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_64);
     return 0;
 }
 #endif
@@ -1294,8 +1294,8 @@ sf_FSTPe_a16(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_80) : (x87_timings.fst_80 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_80) : (x87_concurrency.fst_80 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_80);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_80);
     return 0;
 }
 #ifndef FPU_8087
@@ -1325,8 +1325,8 @@ sf_FSTPe_a32(uint32_t fetchdat)
     FPU_pop();
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst_80) : (x87_timings.fst_80 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst_80) : (x87_concurrency.fst_80 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst_80);
+    CONCURRENCY_CYCLES(x87_concurrency.fst_80);
     return 0;
 }
 #endif
@@ -1346,8 +1346,8 @@ sf_FST_sti(uint32_t fetchdat)
         st0_reg = FPU_read_regi(0);
         FPU_save_regi(st0_reg, fetchdat & 7);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst) : (x87_timings.fst * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst) : (x87_concurrency.fst * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst);
+    CONCURRENCY_CYCLES(x87_concurrency.fst);
     return 0;
 }
 
@@ -1367,8 +1367,8 @@ sf_FSTP_sti(uint32_t fetchdat)
         FPU_save_regi(st0_reg, fetchdat & 7);
         FPU_pop();
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fst) : (x87_timings.fst * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fst) : (x87_concurrency.fst * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fst);
+    CONCURRENCY_CYCLES(x87_concurrency.fst);
     return 0;
 }
 
@@ -31,8 +31,8 @@ sf_FXCH_sti(uint32_t fetchdat)
     FPU_save_regi(sti_reg, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fxch) : (x87_timings.fxch * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fxch) : (x87_concurrency.fxch * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fxch);
+    CONCURRENCY_CYCLES(x87_concurrency.fxch);
     return 0;
 }
 
@@ -53,8 +53,8 @@ sf_FCHS(uint32_t fetchdat)
         result  = floatx80_chs(st0_reg);
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fchs) : (x87_timings.fchs * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fchs) : (x87_concurrency.fchs * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fchs);
+    CONCURRENCY_CYCLES(x87_concurrency.fchs);
     return 0;
 }
 
@@ -75,8 +75,8 @@ sf_FABS(uint32_t fetchdat)
         result  = floatx80_abs(st0_reg);
         FPU_save_regi(result, 0);
     }
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fabs) : (x87_timings.fabs * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fabs) : (x87_concurrency.fabs * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fabs);
+    CONCURRENCY_CYCLES(x87_concurrency.fabs);
     return 0;
 }
 
@@ -88,8 +88,8 @@ sf_FDECSTP(uint32_t fetchdat)
     cpu_state.pc++;
     clear_C1();
     fpu_state.tos = (fpu_state.tos - 1) & 7;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fincdecstp) : (x87_timings.fincdecstp * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fincdecstp) : (x87_concurrency.fincdecstp * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fincdecstp);
+    CONCURRENCY_CYCLES(x87_concurrency.fincdecstp);
     return 0;
 }
 
@@ -101,8 +101,8 @@ sf_FINCSTP(uint32_t fetchdat)
     cpu_state.pc++;
     clear_C1();
     fpu_state.tos = (fpu_state.tos + 1) & 7;
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fincdecstp) : (x87_timings.fincdecstp * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fincdecstp) : (x87_concurrency.fincdecstp * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fincdecstp);
+    CONCURRENCY_CYCLES(x87_concurrency.fincdecstp);
     return 0;
 }
 
@@ -114,8 +114,8 @@ sf_FFREE_sti(uint32_t fetchdat)
     cpu_state.pc++;
     clear_C1();
     FPU_settagi(X87_TAG_EMPTY, fetchdat & 7);
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.ffree) : (x87_timings.ffree * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.ffree) : (x87_concurrency.ffree * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.ffree);
+    CONCURRENCY_CYCLES(x87_concurrency.ffree);
     return 0;
 }
 
@@ -131,7 +131,7 @@ sf_FFREEP_sti(uint32_t fetchdat)
         return 1;
 
     FPU_pop();
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.ffree) : (x87_timings.ffree * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.ffree) : (x87_concurrency.ffree * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.ffree);
+    CONCURRENCY_CYCLES(x87_concurrency.ffree);
     return 0;
 }
@@ -18,8 +18,8 @@ sf_F2XM1(uint32_t fetchdat)
         FPU_save_regi(result, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.f2xm1) : (x87_timings.f2xm1 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.f2xm1) : (x87_concurrency.f2xm1 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.f2xm1);
+    CONCURRENCY_CYCLES(x87_concurrency.f2xm1);
     return 0;
 }
 
@@ -45,8 +45,8 @@ sf_FYL2X(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fyl2x) : (x87_timings.fyl2x * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fyl2x) : (x87_concurrency.fyl2x * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fyl2x);
+    CONCURRENCY_CYCLES(x87_concurrency.fyl2x);
     return 0;
 }
 
@@ -99,8 +99,8 @@ sf_FPTAN(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fptan) : (x87_timings.fptan * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fptan) : (x87_concurrency.fptan * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fptan);
+    CONCURRENCY_CYCLES(x87_concurrency.fptan);
     return 0;
 }
 
@@ -129,8 +129,8 @@ sf_FPATAN(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fpatan) : (x87_timings.fpatan * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fpatan) : (x87_concurrency.fpatan * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fpatan);
+    CONCURRENCY_CYCLES(x87_concurrency.fpatan);
     return 0;
 }
 
@@ -178,8 +178,8 @@ sf_FXTRACT(uint32_t fetchdat)
 #if 0 // TODO.
 next_ins:
 #endif
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fxtract) : (x87_timings.fxtract * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fxtract) : (x87_concurrency.fxtract * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fxtract);
+    CONCURRENCY_CYCLES(x87_concurrency.fxtract);
     return 0;
 }
 
@@ -226,8 +226,8 @@ sf_FPREM1(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fprem1) : (x87_timings.fprem1 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fprem1) : (x87_concurrency.fprem1 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fprem1);
+    CONCURRENCY_CYCLES(x87_concurrency.fprem1);
     return 0;
 }
 
@@ -275,8 +275,8 @@ sf_FPREM(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fprem) : (x87_timings.fprem * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fprem) : (x87_concurrency.fprem * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fprem);
+    CONCURRENCY_CYCLES(x87_concurrency.fprem);
     return 0;
 }
 
@@ -302,8 +302,8 @@ sf_FYL2XP1(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fyl2xp1) : (x87_timings.fyl2xp1 * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fyl2xp1) : (x87_concurrency.fyl2xp1 * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fyl2xp1);
+    CONCURRENCY_CYCLES(x87_concurrency.fyl2xp1);
     return 0;
 }
 
@@ -349,8 +349,8 @@ sf_FSINCOS(uint32_t fetchdat)
     }
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsincos) : (x87_timings.fsincos * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsincos) : (x87_concurrency.fsincos * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsincos);
+    CONCURRENCY_CYCLES(x87_concurrency.fsincos);
     return 0;
 }
 #endif
@@ -375,8 +375,8 @@ sf_FSCALE(uint32_t fetchdat)
         FPU_save_regi(result, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fscale) : (x87_timings.fscale * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fscale) : (x87_concurrency.fscale * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fscale);
+    CONCURRENCY_CYCLES(x87_concurrency.fscale);
     return 0;
 }
 
@@ -406,8 +406,8 @@ sf_FSIN(uint32_t fetchdat)
         FPU_save_regi(y, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsin_cos) : (x87_timings.fsin_cos * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsin_cos) : (x87_concurrency.fsin_cos * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsin_cos);
+    CONCURRENCY_CYCLES(x87_concurrency.fsin_cos);
     return 0;
 }
 
@@ -436,8 +436,8 @@ sf_FCOS(uint32_t fetchdat)
         FPU_save_regi(y, 0);
 
 next_ins:
-    CLOCK_CYCLES_FPU((fpu_type >= FPU_487SX) ? (x87_timings.fsin_cos) : (x87_timings.fsin_cos * cpu_multi));
-    CONCURRENCY_CYCLES((fpu_type >= FPU_487SX) ? (x87_concurrency.fsin_cos) : (x87_concurrency.fsin_cos * cpu_multi));
+    CLOCK_CYCLES_FPU(x87_timings.fsin_cos);
+    CONCURRENCY_CYCLES(x87_concurrency.fsin_cos);
     return 0;
 }
 #endif
@@ -537,3 +537,32 @@ const x87_timings_t x87_concurrency_486 = {
     .fyl2x      = 13,
     .fyl2xp1    = 13,
 };
+
+/* Install the working timing tables for the selected FPU. The pre-487SX
+   parts run at the bus clock, which the cycle macros used to model by
+   multiplying every looked-up value by cpu_multi per executed instruction;
+   the multiplier is constant per CPU model, so it is folded into the
+   working copies here once and the hot path reads a single value. Both
+   structs are plain int cycle counts, so the scaling walks them as int
+   arrays. */
+void
+x87_timings_select(const x87_timings_t *timings, const x87_timings_t *concurrency, int multi)
+{
+    const int n = (int) (sizeof(x87_timings_t) / sizeof(int));
+    int      *p;
+
+    x87_timings = *timings;
+    if (concurrency != NULL)
+        x87_concurrency = *concurrency;
+    else
+        memset(&x87_concurrency, 0x00, sizeof(x87_concurrency));
+
+    if (multi > 1) {
+        p = (int *) &x87_timings;
+        for (int i = 0; i < n; i++)
+            p[i] *= multi;
+        p = (int *) &x87_concurrency;
+        for (int i = 0; i < n; i++)
+            p[i] *= multi;
+    }
+}
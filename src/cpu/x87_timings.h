@@ -58,3 +58,7 @@ extern const x87_timings_t x87_concurrency_486;
 
 extern x87_timings_t x87_timings;
 extern x87_timings_t x87_concurrency;
+
+/* Install the working tables, folding the per-model clock multiplier into
+   the cycle counts so the per-instruction macros read them directly. */
+extern void x87_timings_select(const x87_timings_t *timings, const x87_timings_t *concurrency, int multi);
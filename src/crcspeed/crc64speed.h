@@ -17,4 +17,8 @@ uint64_t crc64speed_big(uint64_t crc, const void *s, const uint64_t l);
 
 bool crc64speed_init_native(void);
 uint64_t crc64speed_native(uint64_t crc, const void *s, const uint64_t l);
+
+/* Runtime-dispatched fastest path (crc64speed_x86.c); _init is optional. */
+bool crc64speed_auto_init(void);
+uint64_t crc64speed_auto(uint64_t crc, const void *s, const uint64_t l);
 #endif
@@ -0,0 +1,98 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Hardware-accelerated CRC-64 with runtime dispatch. On x86
+ *          with PCLMULQDQ the bulk of the buffer is folded 128 bits at
+ *          a time with carry-less multiplies; everywhere else (and for
+ *          short buffers) this falls through to the vendored slice-by-8
+ *          code in crc64speed.c.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#include "crc64speed.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    define CRC64_HAVE_CLMUL 1
+#    include <emmintrin.h>
+#    include <wmmintrin.h>
+#endif
+
+static crcfn64 crc64_auto_fn = NULL;
+
+#ifdef CRC64_HAVE_CLMUL
+/* Folding constants for the 0xad93d23594c935a9 (Jones) polynomial in the
+   reflected domain, chosen so that for any 128-bit state S
+       crc64(S_bytes || 16 zero bytes) == crc64(clmul(S.lo, K1) ^ clmul(S.hi, K2))
+   which is exactly the invariant the fold loop below maintains. */
+#    define CRC64_FOLD_K1 UINT64_C(0xd9d7be7d505da32c)
+#    define CRC64_FOLD_K2 UINT64_C(0x381d0015c96f4444)
+
+__attribute__((target("pclmul,sse2"))) static uint64_t
+crc64speed_clmul(uint64_t crc, const void *in_data, const uint64_t len)
+{
+    const uint8_t *data = (const uint8_t *) in_data;
+    uint64_t       left = len;
+    uint8_t        final[16];
+    __m128i        state;
+    const __m128i  fold = _mm_set_epi64x(CRC64_FOLD_K2, CRC64_FOLD_K1);
+
+    /* Need one full block to seed the state and at least one more to fold. */
+    if (left < 32)
+        return crc64speed(crc, in_data, len);
+
+    /* The running CRC folds into the low bits of the first block. */
+    state = _mm_xor_si128(_mm_loadu_si128((const __m128i *) data),
+                          _mm_set_epi64x(0, crc));
+    data += 16;
+    left -= 16;
+
+    while (left >= 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *) data);
+        __m128i lo    = _mm_clmulepi64_si128(state, fold, 0x00);
+        __m128i hi    = _mm_clmulepi64_si128(state, fold, 0x11);
+
+        state = _mm_xor_si128(_mm_xor_si128(lo, hi), block);
+        data += 16;
+        left -= 16;
+    }
+
+    /* Reduce the 128-bit state and the sub-block tail through the tables. */
+    _mm_storeu_si128((__m128i *) final, state);
+    crc = crc64speed(0, final, 16);
+    if (left)
+        crc = crc64speed(crc, data, left);
+
+    return crc;
+}
+#endif
+
+/* Picks the fastest CRC-64 the host supports; also initializes the
+   slice-by-8 tables, so callers need no separate crc64speed_init(). */
+bool crc64speed_auto_init(void)
+{
+    crc64speed_init();
+
+#ifdef CRC64_HAVE_CLMUL
+    if (__builtin_cpu_supports("pclmul"))
+        crc64_auto_fn = crc64speed_clmul;
+    else
+#endif
+        crc64_auto_fn = crc64speed;
+
+    return true;
+}
+
+uint64_t crc64speed_auto(uint64_t crc, const void *s, const uint64_t l)
+{
+    if (crc64_auto_fn == NULL)
+        crc64speed_auto_init();
+
+    return crc64_auto_fn(crc, s, l);
+}
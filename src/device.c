@@ -63,6 +63,20 @@ static device_context_t device_current;
 static device_context_t device_prev;
 static void            *device_common_priv;
 
+/* Allocation audit mode (-A): log how much heap each device's init grabs,
+   for tracking cold start regressions between builds. Heap usage is sampled
+   through mallinfo2(), so the numbers are only available on glibc hosts -
+   the option is accepted but reports nothing elsewhere. */
+int device_audit = 0;
+
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+#    include <malloc.h>
+#    define DEVICE_AUDIT_MALLINFO
+static int64_t device_audit_child_bytes = 0;
+static int64_t device_audit_total_bytes = 0;
+static int     device_audit_devices     = 0;
+#endif
+
 #ifdef ENABLE_DEVICE_LOG
 int device_do_log = ENABLE_DEVICE_LOG;
 
@@ -140,6 +154,10 @@ device_add_common(const device_t *dev, void *p, void *params, int inst)
     device_t *init_dev = NULL;
     void     *priv     = NULL;
     int       c;
+#ifdef DEVICE_AUDIT_MALLINFO
+    int64_t audit_before      = 0;
+    int64_t audit_child_saved = 0;
+#endif
 
     if (params != NULL) {
         init_dev = calloc(1, sizeof(device_t));
@@ -172,9 +190,33 @@ device_add_common(const device_t *dev, void *p, void *params, int inst)
         device_set_context(&device_current, dev, inst);
 
         if (dev->init != NULL) {
+#ifdef DEVICE_AUDIT_MALLINFO
+            if (device_audit) {
+                audit_before      = (int64_t) mallinfo2().uordblks;
+                audit_child_saved = device_audit_child_bytes;
+                /* Chained device_add calls report their own allocations, so
+                   zero the child accumulator and charge only the remainder
+                   to this device. */
+                device_audit_child_bytes = 0;
+            }
+#endif
+
             /* Give it our temporary device in case we have dynamically changed info->local. */
             priv = dev->init(init_dev);
 
+#ifdef DEVICE_AUDIT_MALLINFO
+            if (device_audit) {
+                int64_t audit_total = ((int64_t) mallinfo2().uordblks) - audit_before;
+                int64_t audit_self  = audit_total - device_audit_child_bytes;
+
+                pclog("AUDIT: %-40s %10" PRId64 " bytes (%" PRId64 " including sub-devices)\n",
+                      dev->name ? dev->name : "(unnamed)", audit_self, audit_total);
+                device_audit_total_bytes += audit_self;
+                device_audit_devices++;
+                device_audit_child_bytes = audit_child_saved + audit_total;
+            }
+#endif
+
             if (priv == NULL) {
 #ifdef ENABLE_DEVICE_LOG
                 if (dev->name)
@@ -299,6 +341,16 @@ device_close_all(void)
             devices[c] = device_priv[c] = NULL;
         }
     }
+
+#ifdef DEVICE_AUDIT_MALLINFO
+    if (device_audit && (device_audit_devices > 0)) {
+        pclog("AUDIT: %i devices allocated %" PRId64 " bytes at init\n",
+              device_audit_devices, device_audit_total_bytes);
+        device_audit_child_bytes = 0;
+        device_audit_total_bytes = 0;
+        device_audit_devices     = 0;
+    }
+#endif
 }
 
 void
@@ -578,6 +630,68 @@ device_force_redraw(void)
     }
 }
 
+/* Write one savestate chunk per device that implements save_state:
+   "DEV " tag, payload length, slot index, fixed-size name (used to
+   verify the configuration matches on load), then the device payload. */
+int
+device_state_save_all(FILE *fp)
+{
+    for (uint16_t c = 0; c < DEVICE_MAX; c++) {
+        uint32_t len;
+        uint32_t index = c;
+        long     len_pos;
+        long     end_pos;
+        char     name[64] = { 0 };
+
+        if ((devices[c] == NULL) || (devices[c]->save_state == NULL))
+            continue;
+
+        fwrite("DEV ", 1, 4, fp);
+        len_pos = ftell(fp);
+        len     = 0;
+        fwrite(&len, sizeof(len), 1, fp);
+        fwrite(&index, sizeof(index), 1, fp);
+        strncpy(name, devices[c]->name, sizeof(name) - 1);
+        fwrite(name, 1, sizeof(name), fp);
+
+        if (!devices[c]->save_state(device_priv[c], fp))
+            return 0;
+
+        /* Back-patch the payload length now that we know it. */
+        end_pos = ftell(fp);
+        len     = (uint32_t) (end_pos - len_pos - sizeof(len));
+        fseek(fp, len_pos, SEEK_SET);
+        fwrite(&len, sizeof(len), 1, fp);
+        fseek(fp, end_pos, SEEK_SET);
+    }
+
+    return 1;
+}
+
+/* Load one device chunk written by device_state_save_all(); the stream
+   is positioned just past the chunk length. */
+int
+device_state_load(FILE *fp)
+{
+    uint32_t index;
+    char     name[64];
+
+    if (fread(&index, sizeof(index), 1, fp) != 1)
+        return 0;
+    if (fread(name, 1, sizeof(name), fp) != sizeof(name))
+        return 0;
+    name[sizeof(name) - 1] = '\0';
+
+    if ((index >= DEVICE_MAX) || (devices[index] == NULL))
+        return 0;
+    if (strncmp(devices[index]->name, name, sizeof(name) - 1))
+        return 0;
+    if (devices[index]->load_state == NULL)
+        return 0;
+
+    return devices[index]->load_state(device_priv[index], fp);
+}
+
 int
 device_get_instance(void)
 {
@@ -116,10 +116,54 @@ typedef struct {
 
     isapnp_card_t   *first_card;
     isapnp_card_t   *isolated_card;
+    isapnp_card_t   *config_card;
     isapnp_card_t   *current_ld_card;
     isapnp_device_t *current_ld;
+    uint8_t          config_card_dirty;
 } isapnp_t;
 
+/* Compute the LFSR checksum over the 64-bit vendor/serial ID in one go, so
+   the isolation read path doesn't have to run the shift register per bit. */
+static uint8_t
+isapnp_serial_checksum(const isapnp_card_t *card)
+{
+    uint8_t checksum = isapnp_init_key[0];
+    uint8_t bit;
+    uint8_t next_shift;
+
+    for (uint8_t i = 0; i < 64; i++) {
+        bit        = (card->rom[i >> 3] >> (i & 0x7)) & 0x01;
+        next_shift = (!!(checksum & 0x02) ^ !!(checksum & 0x01) ^ bit) & 0x01;
+        checksum >>= 1;
+        checksum |= (next_shift << 7);
+    }
+
+    return checksum;
+}
+
+/* Cached lookup of the card in CONFIG state, re-walking the card list only
+   after something that can change a card's state or enable. */
+static isapnp_card_t *
+isapnp_find_config_card(isapnp_t *dev)
+{
+    isapnp_card_t *card;
+
+    if (!dev->config_card_dirty)
+        return dev->config_card;
+
+    card = dev->first_card;
+    while (card) {
+        if (card->enable && (card->state == PNP_STATE_CONFIG))
+            break;
+        card = card->next;
+    }
+
+    dev->config_card       = card;
+    dev->config_card_dirty = 0;
+
+    return card;
+}
+
 static void
 isapnp_device_config_changed(isapnp_card_t *card, isapnp_device_t *ld)
 {
@@ -262,34 +306,32 @@ isapnp_read_common(isapnp_t *dev, isapnp_card_t *card, isapnp_device_t *ld, uint
 {
     uint8_t ret = 0xff;
     uint8_t bit;
-    uint8_t next_shift;
 
     switch (reg) {
         case 0x01: /* Serial Isolation */
-            card = dev->first_card;
-            while (card) {
-                if (card->enable && card->rom && (card->state == PNP_STATE_ISOLATION))
-                    break;
-                card = card->next;
+            /* Re-walk the card list only if the previously isolated card is
+               gone; it is invalidated on Wake, CSN assignment and disable. */
+            card = dev->isolated_card;
+            if (!card || !card->enable || !card->rom || (card->state != PNP_STATE_ISOLATION)) {
+                card = dev->first_card;
+                while (card) {
+                    if (card->enable && card->rom && (card->state == PNP_STATE_ISOLATION))
+                        break;
+                    card = card->next;
+                }
+                dev->isolated_card = card;
             }
-            dev->isolated_card = card;
 
             if (card) {
                 if (card->serial_read_pair) { /* second byte (aa/00) */
                     card->serial_read <<= 1;
                     if (!card->serial_read_pos)
                         card->rom_pos = 0x09;
-                } else {                              /* first byte (55/00) */
-                    if (card->serial_read_pos < 64) { /* reading 64-bit vendor/serial */
-                        bit        = (card->rom[card->serial_read_pos >> 3] >> (card->serial_read_pos & 0x7)) & 0x01;
-                        next_shift = (!!(card->id_checksum & 0x02) ^ !!(card->id_checksum & 0x01) ^ bit) & 0x01;
-                        card->id_checksum >>= 1;
-                        card->id_checksum |= (next_shift << 7);
-                    } else {                             /* reading 8-bit checksum */
-                        if (card->serial_read_pos == 64) /* populate ID checksum in ROM */
-                            card->rom[0x08] = card->id_checksum;
+                } else {                             /* first byte (55/00) */
+                    if (card->serial_read_pos < 64) /* reading 64-bit vendor/serial */
+                        bit = (card->rom[card->serial_read_pos >> 3] >> (card->serial_read_pos & 0x7)) & 0x01;
+                    else /* reading 8-bit checksum, precomputed on Wake[0] */
                         bit = (card->id_checksum >> (card->serial_read_pos & 0x7)) & 0x01;
-                    }
                     isapnp_log("ISAPnP: Read bit %d of byte %02X (%02X) = %d\n", card->serial_read_pos & 0x7, card->serial_read_pos >> 3, card->rom[card->serial_read_pos >> 3], bit);
                     card->serial_read     = bit ? 0x55 : 0x00;
                     card->serial_read_pos = (card->serial_read_pos + 1) % 72;
@@ -368,12 +410,7 @@ static uint8_t
 isapnp_read_data(UNUSED(uint16_t addr), void *priv)
 {
     isapnp_t      *dev  = (isapnp_t *) priv;
-    isapnp_card_t *card = dev->first_card;
-    while (card) {
-        if (card->enable && (card->state == PNP_STATE_CONFIG))
-            break;
-        card = card->next;
-    }
+    isapnp_card_t *card = isapnp_find_config_card(dev);
 
     isapnp_log("ISAPnP: read_data() => ");
     return isapnp_read_common(dev, card, dev->current_ld, dev->reg);
@@ -414,6 +451,7 @@ isapnp_write_addr(UNUSED(uint16_t addr), uint8_t val, void *priv)
             dev->key_pos++;
             if (!dev->key_pos) {
                 isapnp_log("ISAPnP: Key unlocked, putting cards to SLEEP\n");
+                dev->config_card_dirty = 1;
                 while (card) {
                     if (card->enable && (card->enable != ISAPNP_CARD_NO_KEY) && (card->state == PNP_STATE_WAIT_FOR_KEY))
                         card->state = PNP_STATE_SLEEP;
@@ -466,6 +504,7 @@ isapnp_write_common(isapnp_t *dev, isapnp_card_t *card, isapnp_device_t *ld, uin
             }
             if (val & 0x02) {
                 isapnp_log("ISAPnP: Return to WAIT_FOR_KEY\n");
+                dev->config_card_dirty = 1;
                 card = dev->first_card;
                 while (card) {
                     card->state = PNP_STATE_WAIT_FOR_KEY;
@@ -484,6 +523,8 @@ isapnp_write_common(isapnp_t *dev, isapnp_card_t *card, isapnp_device_t *ld, uin
 
         case 0x03: /* Wake[CSN] */
             isapnp_log("ISAPnP: Wake[%02X]\n", val);
+            dev->isolated_card     = NULL;
+            dev->config_card_dirty = 1;
             card = dev->first_card;
             while (card) {
                 if (card->csn == val) {
@@ -491,6 +532,10 @@ isapnp_write_common(isapnp_t *dev, isapnp_card_t *card, isapnp_device_t *ld, uin
                     card->id_checksum = isapnp_init_key[0];
                     if (card->state == PNP_STATE_SLEEP)
                         card->state = (val == 0) ? PNP_STATE_ISOLATION : PNP_STATE_CONFIG;
+                    /* Precompute the serial checksum for the entire isolation
+                       pass instead of clocking the LFSR on every bit read. */
+                    if ((card->state == PNP_STATE_ISOLATION) && card->rom)
+                        card->rom[0x08] = card->id_checksum = isapnp_serial_checksum(card);
                 } else {
                     card->state = PNP_STATE_SLEEP;
                 }
@@ -505,6 +550,7 @@ isapnp_write_common(isapnp_t *dev, isapnp_card_t *card, isapnp_device_t *ld, uin
                 isapnp_set_csn(dev->isolated_card, val);
                 dev->isolated_card->state = PNP_STATE_CONFIG;
                 dev->isolated_card        = NULL;
+                dev->config_card_dirty    = 1;
             } else {
                 isapnp_log("ISAPnP: Set CSN %02X but no card is isolated\n", val);
             }
@@ -632,15 +678,7 @@ static void
 isapnp_write_data(UNUSED(uint16_t addr), uint8_t val, void *priv)
 {
     isapnp_t      *dev  = (isapnp_t *) priv;
-    isapnp_card_t *card = NULL;
-    if (!card) {
-        card = dev->first_card;
-        while (card) {
-            if (card->enable && (card->state == PNP_STATE_CONFIG))
-                break;
-            card = card->next;
-        }
-    }
+    isapnp_card_t *card = isapnp_find_config_card(dev);
 
     isapnp_log("ISAPnP: write_data(%02X) => ", val);
     isapnp_write_common(dev, card, dev->current_ld, dev->reg, val);
@@ -652,6 +690,8 @@ isapnp_init(UNUSED(const device_t *info))
     isapnp_t *dev = (isapnp_t *) malloc(sizeof(isapnp_t));
     memset(dev, 0, sizeof(isapnp_t));
 
+    dev->config_card_dirty = 1;
+
     io_sethandler(0x279, 1, NULL, NULL, NULL, isapnp_write_addr, NULL, NULL, dev);
     io_sethandler(0xa79, 1, NULL, NULL, NULL, isapnp_write_data, NULL, NULL, dev);
 
@@ -716,6 +756,7 @@ isapnp_add_card(uint8_t *rom, uint16_t rom_size,
             prev_card = prev_card->next;
         prev_card->next = card;
     }
+    dev->config_card_dirty = 1;
 
     if (rom && rom_size)
         isapnp_update_card_rom(card, rom, rom_size);
@@ -1069,7 +1110,8 @@ isapnp_enable_card(void *priv, uint8_t enable)
             /* Enable or disable the card. */
             if (!!enable ^ !!card->enable)
                 card->state = (enable == ISAPNP_CARD_FORCE_CONFIG) ? PNP_STATE_CONFIG : PNP_STATE_WAIT_FOR_KEY;
-            card->enable = enable;
+            card->enable           = enable;
+            dev->config_card_dirty = 1;
 
             /* Invalidate other references if we're disabling this card. */
             if (!card->enable) {
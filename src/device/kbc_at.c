@@ -766,6 +766,34 @@ kbc_at_dev_poll(void *priv)
         kbc_at_ports[1]->poll(kbc_at_ports[1]->priv);
 }
 
+/* Run the controller and device state machines back to back until the current
+   exchange settles, so command/response traffic with no guest-visible timing
+   dependency completes in-line with the port access instead of serializing on
+   100 us poll ticks. Neither state machine models wall-clock delays - they
+   are purely tick-paced - so this only compresses dead time between steps.
+   Machines whose BIOSes depend on timed delivery opt out of the fast path
+   with MACHINE_BUS_KBC_TIMED in machine_table.c. */
+static void
+kbc_at_fast_advance(atkbc_t *dev)
+{
+    if (machines[machine].bus_flags & MACHINE_BUS_KBC_TIMED)
+        return;
+
+    for (uint8_t steps = 0; steps < 24; steps++) {
+        /* Output buffer full: the rest of the exchange waits for the host. */
+        if (dev->status & STAT_OFULL)
+            break;
+
+        kbc_at_do_poll(dev);
+
+        if ((kbc_at_ports[0] != NULL) && (kbc_at_ports[0]->priv != NULL))
+            kbc_at_ports[0]->poll(kbc_at_ports[0]->priv);
+
+        if ((kbc_at_ports[1] != NULL) && (kbc_at_ports[1]->priv != NULL))
+            kbc_at_ports[1]->poll(kbc_at_ports[1]->priv);
+    }
+}
+
 static void
 write_p2(atkbc_t *dev, uint8_t val)
 {
@@ -2113,6 +2141,8 @@ kbc_at_write(uint16_t port, uint8_t val, void *priv)
 
     dev->ib = val;
     dev->status |= STAT_IFULL;
+
+    kbc_at_fast_advance(dev);
 }
 
 static uint8_t
@@ -2134,6 +2164,8 @@ kbc_at_read(uint16_t port, void *priv)
                 picintclevel(1 << 1, &dev->irq_state);
             if ((strstr(machine_get_internal_name(), "pb41") != NULL) && (cpu_override_dynarec == 1))
                 cpu_override_dynarec = 0;
+            /* Pull in the next byte of a multi-byte response right away. */
+            kbc_at_fast_advance(dev);
             break;
 
         case 0x64:
@@ -108,6 +108,18 @@ static _Atomic double  mouse_y;
 static atomic_int      mouse_z;
 static atomic_int      mouse_buttons;
 
+/* Queue of host button transitions, so a press and release landing
+   between two guest polls are not collapsed into nothing: the guest
+   driver samples one transition per poll, in order. Single producer
+   (the host input thread), single consumer (mouse_process()); on
+   overflow the newest entry is dropped, and mouse_buttons still
+   carries the final state. */
+#define MOUSE_BTN_QUEUE_SIZE 16 /* power of two */
+static atomic_int      mouse_btn_queue[MOUSE_BTN_QUEUE_SIZE];
+static atomic_uint     mouse_btn_head;
+static atomic_uint     mouse_btn_tail;
+static atomic_int      mouse_sampled_b;
+
 static int             mouse_delta_b;
 static int             mouse_old_b;
 
@@ -162,10 +174,13 @@ mouse_clear_coords(void)
 void
 mouse_clear_buttons(void)
 {
-    mouse_buttons  = 0x00;
-    mouse_old_b    = 0x00;
+    mouse_buttons   = 0x00;
+    mouse_old_b     = 0x00;
+
+    mouse_delta_b   = 0x00;
 
-    mouse_delta_b  = 0x00;
+    mouse_sampled_b = 0x00;
+    atomic_store(&mouse_btn_tail, atomic_load(&mouse_btn_head));
 }
 
 static double
@@ -376,7 +391,7 @@ mouse_state_changed(void)
     int wheel     = (mouse_nbut >= 4);
     int ret;
 
-    b = atomic_load(&mouse_buttons);
+    b = atomic_load(&mouse_sampled_b);
     mouse_delta_b = (b ^ mouse_old_b);
     mouse_old_b   = b;
 
@@ -499,13 +514,24 @@ mouse_subtract_z(int *delta_z, int min, int max, int invert)
 void
 mouse_set_buttons_ex(int b)
 {
+    uint32_t head = atomic_load(&mouse_btn_head);
+    uint32_t tail = atomic_load(&mouse_btn_tail);
+
+    if (b == atomic_load(&mouse_buttons))
+        return;
+
     atomic_store(&mouse_buttons, b);
+
+    if ((head - tail) < MOUSE_BTN_QUEUE_SIZE) {
+        atomic_store(&mouse_btn_queue[head & (MOUSE_BTN_QUEUE_SIZE - 1)], b);
+        atomic_store(&mouse_btn_head, head + 1);
+    }
 }
 
 int
 mouse_get_buttons_ex(void)
 {
-    return atomic_load(&mouse_buttons);
+    return atomic_load(&mouse_sampled_b);
 }
 
 void
@@ -537,9 +563,20 @@ mouse_get_abs_coords(double *x_abs, double *y_abs)
 void
 mouse_process(void)
 {
+    uint32_t tail = atomic_load(&mouse_btn_tail);
+
     if (mouse_curr == NULL)
         return;
 
+    /* Advance the button sample by one queued transition per poll, so
+       the guest driver sees every edge in order; once the queue is
+       drained the sample tracks the live state. */
+    if (tail != atomic_load(&mouse_btn_head)) {
+        atomic_store(&mouse_sampled_b, atomic_load(&mouse_btn_queue[tail & (MOUSE_BTN_QUEUE_SIZE - 1)]));
+        atomic_store(&mouse_btn_tail, tail + 1);
+    } else
+        atomic_store(&mouse_sampled_b, atomic_load(&mouse_buttons));
+
     if ((mouse_input_mode >= 1) && mouse_poll_ex)
         mouse_poll_ex();
     else if ((mouse_input_mode == 0) && ((mouse_dev_poll != NULL) || (mouse_curr->poll != NULL))) {
@@ -32,6 +32,9 @@
 #include <86box/plat_serial_passthrough.h>
 #include <86box/plat_unused.h>
 
+/* Size of the batching buffers between the UART and the host fd. */
+#define SERPT_BATCH_LEN 256
+
 #define ENABLE_SERIAL_PASSTHROUGH_LOG 1
 #ifdef ENABLE_SERIAL_PASSTHROUGH_LOG
 int serial_passthrough_do_log = ENABLE_SERIAL_PASSTHROUGH_LOG;
@@ -62,10 +65,38 @@ serial_passthrough_init(void)
     }
 }
 
+static void
+serial_to_host_flush(serial_passthrough_t *dev)
+{
+    uint8_t  buf[SERPT_BATCH_LEN];
+    uint32_t num;
+
+    timer_stop(&dev->serial_to_host_timer);
+
+    num = fifo8_pop_all(&dev->serial_to_host_fifo, buf, sizeof(buf));
+    if (num > 0)
+        plat_serpt_write_bulk(dev, buf, num);
+}
+
+static void
+serial_to_host_cb(void *priv)
+{
+    serial_to_host_flush((serial_passthrough_t *) priv);
+}
+
 static void
 serial_passthrough_write(UNUSED(serial_t *s), void *priv, uint8_t val)
 {
-    plat_serpt_write(priv, val);
+    serial_passthrough_t *dev = (serial_passthrough_t *) priv;
+
+    /* Bytes arrive here one per THR load at the emulated baud rate; a
+     * write() syscall for each is wasteful. Batch them up and flush with
+     * a single write() once the transmitter has been idle for two byte
+     * periods (end of the transmit window) or the buffer fills up. */
+    if (fifo8_is_full(&dev->serial_to_host_fifo))
+        serial_to_host_flush(dev);
+    fifo8_push(&dev->serial_to_host_fifo, val);
+    timer_on_auto(&dev->serial_to_host_timer, (1000000.0 / dev->baudrate) * (double) dev->bits * 2.0);
 }
 
 static void
@@ -73,7 +104,9 @@ host_to_serial_cb(void *priv)
 {
     serial_passthrough_t *dev = (serial_passthrough_t *) priv;
 
-    uint8_t byte;
+    uint8_t chunk[SERPT_BATCH_LEN];
+    int     max;
+    int     num;
 
     /* write_fifo has no failure indication, but if we write to fast, the host
      * can never fetch the bytes in time, so check if the fifo is full if in
@@ -87,11 +120,22 @@ host_to_serial_cb(void *priv)
             goto no_write_to_machine;
         }
     }
-    if (plat_serpt_read(dev, &byte)) {
-#if 0
-        printf("got byte %02X\n", byte);
-#endif
-        serial_write_fifo(dev->serial, byte);
+    /* Refill the batching buffer with one read() sized by the guest's
+     * receive trigger level - anything past it would only sit in the UART
+     * FIFO anyway - then drain it one byte per poll at the baud rate. */
+    if (fifo8_is_empty(&dev->host_to_serial_fifo)) {
+        max = 1;
+        if ((dev->serial->type >= SERIAL_16550) && dev->serial->fifo_enabled) {
+            max = fifo_get_trigger_len(dev->serial->rcvr_fifo);
+            if ((max < 1) || (max > SERPT_BATCH_LEN))
+                max = 1;
+        }
+        num = plat_serpt_read_bulk(dev, chunk, max);
+        if (num > 0)
+            fifo8_push_all(&dev->host_to_serial_fifo, chunk, num);
+    }
+    if (!fifo8_is_empty(&dev->host_to_serial_fifo)) {
+        serial_write_fifo(dev->serial, fifo8_pop(&dev->host_to_serial_fifo));
 #if 0
         serial_set_dsr(dev->serial, 1);
 #endif
@@ -142,6 +186,10 @@ serial_passthrough_dev_close(void *priv)
     if (dev->serial && dev->serial->sd)
         memset(dev->serial->sd, 0, sizeof(serial_device_t));
 
+    serial_to_host_flush(dev);
+    fifo8_destroy(&dev->host_to_serial_fifo);
+    fifo8_destroy(&dev->serial_to_host_fifo);
+
     plat_serpt_close(dev);
     free(dev);
 }
@@ -211,6 +259,10 @@ serial_passthrough_dev_init(const device_t *info)
 
     memset(&dev->host_to_serial_timer, 0, sizeof(pc_timer_t));
     timer_add(&dev->host_to_serial_timer, host_to_serial_cb, dev, 1);
+    memset(&dev->serial_to_host_timer, 0, sizeof(pc_timer_t));
+    timer_add(&dev->serial_to_host_timer, serial_to_host_cb, dev, 0);
+    fifo8_create(&dev->host_to_serial_fifo, SERPT_BATCH_LEN);
+    fifo8_create(&dev->serial_to_host_fifo, SERPT_BATCH_LEN);
     serial_set_cts(dev->serial, 1);
     serial_set_dsr(dev->serial, 1);
     serial_set_dcd(dev->serial, 1);
@@ -15,6 +15,7 @@
  *          Copyright 2019 David Hrdlička.
  */
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -27,6 +28,8 @@
 #include <86box/machine.h>
 #include <86box/plat.h>
 #include <86box/plat_dynld.h>
+#include <86box/thread.h>
+#include <86box/plat_unused.h>
 #include <discord_game_sdk.h>
 
 #ifdef _WIN32
@@ -50,6 +53,17 @@ static dllimp_t discord_imports[] = {
     { NULL,           NULL           }
 };
 
+/* All Game SDK calls run on a worker thread: the IPC socket to the
+   Discord client can stall for hundreds of milliseconds, and doing
+   that from the main timer path caused visible frame hitches. The
+   public entry points only post state to the worker - the desired
+   presence state through discord_want and activity snapshots through
+   an atomic pointer - and never block. */
+static thread_t                *discord_thread = NULL;
+static event_t                 *discord_wake   = NULL;
+static atomic_int               discord_want; /* 1 = presence on, 0 = off */
+static struct DiscordActivity *_Atomic discord_pending_activity;
+
 #ifdef ENABLE_DISCORD_LOG
 int discord_do_log = 1;
 
@@ -71,16 +85,20 @@ discord_log(const char *fmt, ...)
 void
 discord_update_activity(int paused)
 {
-    struct DiscordActivity activity;
-    char                   cpufamily[1024];
-    char                  *paren;
+    struct DiscordActivity *activity;
+    struct DiscordActivity *stale;
+    char                    cpufamily[1024];
+    char                   *paren;
 
-    if (discord_activities == NULL)
+    if (!atomic_load(&discord_want))
         return;
 
     discord_log("discord: discord_update_activity(paused=%d)\n", paused);
 
-    memset(&activity, 0x00, sizeof(activity));
+    /* Snapshot the machine state here, on the calling thread - the
+       worker must not touch cpu_f/vm_name while the emulation runs. */
+    activity = (struct DiscordActivity *) malloc(sizeof(struct DiscordActivity));
+    memset(activity, 0x00, sizeof(struct DiscordActivity));
 
     strncpy(cpufamily, cpu_f->name, sizeof(cpufamily) - 1);
     paren = strchr(cpufamily, '(');
@@ -92,72 +110,67 @@ discord_update_activity(int paused)
 #    pragma GCC diagnostic ignored "-Wformat-truncation"
 #endif
     if (strlen(vm_name) < 100) {
-        snprintf(activity.details, sizeof(activity.details), "Running \"%s\"", vm_name);
-        snprintf(activity.state, sizeof(activity.state), "%s (%s/%s)", strchr(machine_getname(), ']') + 2, cpufamily, cpu_s->name);
+        snprintf(activity->details, sizeof(activity->details), "Running \"%s\"", vm_name);
+        snprintf(activity->state, sizeof(activity->state), "%s (%s/%s)", strchr(machine_getname(), ']') + 2, cpufamily, cpu_s->name);
     } else {
-        strncpy(activity.details, strchr(machine_getname(), ']') + 2, sizeof(activity.details) - 1);
-        snprintf(activity.state, sizeof(activity.state), "%s/%s", cpufamily, cpu_s->name);
+        strncpy(activity->details, strchr(machine_getname(), ']') + 2, sizeof(activity->details) - 1);
+        snprintf(activity->state, sizeof(activity->state), "%s/%s", cpufamily, cpu_s->name);
     }
 #pragma GCC diagnostic pop
 
-    activity.timestamps.start = time(NULL);
+    activity->timestamps.start = time(NULL);
 
     /* Icon choosing for Discord based on 86Box.rc */
 
 #ifdef RELEASE_BUILD
     /* Icon by OBattler and laciba96 (green for release builds)*/
-    strcpy(activity.assets.large_image, "86box-green");
+    strcpy(activity->assets.large_image, "86box-green");
 #elif BETA_BUILD
     /* Icon by OBattler and laciba96 (yellow for beta builds done by Jenkins)*/
-    strcpy(activity.assets.large_image, "86box-yellow");
+    strcpy(activity->assets.large_image, "86box-yellow");
 #elif ALPHA_BUILD
     /* Icon by OBattler and laciba96 (red for alpha builds done by Jenkins)*/
-    strcpy(activity.assets.large_image, "86box-red");
+    strcpy(activity->assets.large_image, "86box-red");
 #else
     /* Icon by OBattler and laciba96 (gray for builds of branches and from the git master)*/
-    strcpy(activity.assets.large_image, "86box");
+    strcpy(activity->assets.large_image, "86box");
 #endif
 
     /* End of icon choosing */
 
     if (paused) {
-        strcpy(activity.assets.small_image, "status-paused");
-        strcpy(activity.assets.small_text, "Paused");
+        strcpy(activity->assets.small_image, "status-paused");
+        strcpy(activity->assets.small_text, "Paused");
     } else {
-        strcpy(activity.assets.small_image, "status-running");
-        strcpy(activity.assets.small_text, "Running");
+        strcpy(activity->assets.small_image, "status-running");
+        strcpy(activity->assets.small_text, "Running");
     }
 
-    discord_activities->update_activity(discord_activities, &activity, NULL, NULL);
+    /* Publish the snapshot; an unconsumed older one is superseded. */
+    stale = atomic_exchange(&discord_pending_activity, activity);
+    free(stale);
+
+    if (discord_wake != NULL)
+        thread_set_event(discord_wake);
 }
 
-int
-discord_load(void)
+static void
+discord_close_core(void)
 {
-    if (discord_handle != NULL)
-        return 1;
-
-    // Try to load the DLL
-    discord_handle = dynld_module(PATH_DISCORD_DLL, discord_imports);
-
-    if (discord_handle == NULL) {
-        discord_log("discord: couldn't load " PATH_DISCORD_DLL "\n");
-        discord_close();
-
-        return 0;
-    }
+    if (discord_core != NULL)
+        discord_core->destroy(discord_core);
 
-    discord_loaded = 1;
-    return 1;
+    discord_core       = NULL;
+    discord_activities = NULL;
 }
 
-void
-discord_init(void)
+static void
+discord_init_core(void)
 {
     enum EDiscordResult        result;
     struct DiscordCreateParams params;
 
-    if (discord_handle == NULL)
+    if ((discord_handle == NULL) || (discord_core != NULL))
         return;
 
     DiscordCreateParamsSetDefault(&params);
@@ -167,30 +180,78 @@ discord_init(void)
     result = discord_create(DISCORD_VERSION, &params, &discord_core);
     if (result != DiscordResult_Ok) {
         discord_log("discord: DiscordCreate returned %d\n", result);
-        discord_close();
+        discord_close_core();
         return;
     }
 
     discord_activities = discord_core->get_activity_manager(discord_core);
+}
 
-    return;
+static void
+discord_thread_fn(UNUSED(void *priv))
+{
+    struct DiscordActivity *activity;
+
+    for (;;) {
+        /* Wake up for posted work, or once a second for callbacks. */
+        thread_wait_event(discord_wake, 1000);
+        thread_reset_event(discord_wake);
+
+        if (atomic_load(&discord_want)) {
+            if (discord_core == NULL)
+                discord_init_core();
+        } else if (discord_core != NULL)
+            discord_close_core();
+
+        activity = atomic_exchange(&discord_pending_activity, NULL);
+        if (activity != NULL) {
+            if (discord_activities != NULL)
+                discord_activities->update_activity(discord_activities, activity, NULL, NULL);
+            free(activity);
+        }
+
+        if (discord_core != NULL)
+            discord_core->run_callbacks(discord_core);
+    }
+}
+
+int
+discord_load(void)
+{
+    if (discord_handle != NULL)
+        return 1;
+
+    // Try to load the DLL
+    discord_handle = dynld_module(PATH_DISCORD_DLL, discord_imports);
+
+    if (discord_handle == NULL) {
+        discord_log("discord: couldn't load " PATH_DISCORD_DLL "\n");
+        return 0;
+    }
+
+    discord_wake   = thread_create_event();
+    discord_thread = thread_create_named(discord_thread_fn, NULL, "discord presence");
+
+    discord_loaded = 1;
+    return 1;
 }
 
 void
-discord_close(void)
+discord_init(void)
 {
-    if (discord_core != NULL)
-        discord_core->destroy(discord_core);
+    if (discord_handle == NULL)
+        return;
 
-    discord_core       = NULL;
-    discord_activities = NULL;
+    atomic_store(&discord_want, 1);
+    thread_set_event(discord_wake);
 }
 
 void
-discord_run_callbacks(void)
+discord_close(void)
 {
-    if (discord_core == NULL)
+    if (discord_handle == NULL)
         return;
 
-    discord_core->run_callbacks(discord_core);
+    atomic_store(&discord_want, 0);
+    thread_set_event(discord_wake);
 }
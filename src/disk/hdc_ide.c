@@ -18,6 +18,7 @@
  *          Copyright 2016-2020 Miran Grca.
  */
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdint.h>
@@ -42,6 +43,7 @@
 #include <86box/isapnp.h>
 #include <86box/cdrom.h>
 #include <86box/plat.h>
+#include <86box/thread.h>
 #include <86box/ui.h>
 #include <86box/hdc.h>
 #include <86box/hdc_ide.h>
@@ -235,6 +237,20 @@ static uint8_t ide_qua_pnp_rom[] = {
 };
 
 ide_t *ide_drives[IDE_NUM];
+
+typedef struct ide_io_req_t {
+    atomic_int pending;
+    uint8_t    id;
+    uint32_t   sector;
+    uint32_t   count;
+    uint8_t   *buffer;
+} ide_io_req_t;
+
+static ide_io_req_t ide_io_req[IDE_NUM];
+static thread_t    *ide_io_thread;
+static event_t     *ide_io_wake;
+static event_t     *ide_io_idle;
+static volatile int ide_io_quit;
 int    ide_ter_enabled = 0;
 int    ide_qua_enabled = 0;
 
@@ -743,6 +759,69 @@ ide_get_sector(ide_t *ide)
     }
 }
 
+/* Host image I/O worker. Sector reads are queued here when the read
+   command is issued, so a slow host file system (network-backed image
+   stores in particular) stalls only the drive waiting on it instead of
+   the whole machine. Completion still fires from the drive timer
+   callback, which re-arms itself until the host I/O is done, so on a
+   fast host the guest-visible latency model is unchanged. */
+static void
+ide_io_thread_run(UNUSED(void *priv))
+{
+    while (1) {
+        thread_wait_event(ide_io_wake, -1);
+        thread_reset_event(ide_io_wake);
+
+        if (ide_io_quit)
+            break;
+
+        for (uint8_t d = 0; d < IDE_NUM; d++) {
+            ide_io_req_t *req = &ide_io_req[d];
+
+            if (atomic_load(&req->pending)) {
+                hdd_image_read(req->id, req->sector, req->count, req->buffer);
+                atomic_store(&req->pending, 0);
+                thread_set_event(ide_io_idle);
+            }
+        }
+    }
+}
+
+static void
+ide_io_queue_read(ide_t *ide, uint32_t count)
+{
+    ide_io_req_t *req = &ide_io_req[ide->channel];
+
+    if (ide_io_thread == NULL) {
+        ide_io_wake   = thread_create_event();
+        ide_io_idle   = thread_create_event();
+        ide_io_thread = thread_create(ide_io_thread_run, NULL);
+    }
+
+    req->id     = ide->hdd_num;
+    req->sector = (uint32_t) ide_get_sector(ide);
+    req->count  = count;
+    req->buffer = ide->sector_buffer;
+
+    atomic_store(&req->pending, 1);
+    thread_set_event(ide_io_wake);
+}
+
+static int
+ide_io_read_pending(const ide_t *ide)
+{
+    return atomic_load(&ide_io_req[ide->channel].pending);
+}
+
+/* Wait out any host I/O still in flight for a channel, so that its sector
+   buffer and image can be taken down safely. */
+static void
+ide_io_drain(int channel)
+{
+    while (atomic_load(&ide_io_req[channel].pending))
+        thread_wait_event(ide_io_idle, 10);
+}
+
 static off64_t
 ide_get_sector_format(ide_t *ide)
 {
@@ -1670,6 +1749,11 @@ ide_writeb(uint16_t addr, uint8_t val, void *priv)
                             wait_time        = seek_time + xfer_time;
                         }
                         ide_set_callback(ide, wait_time);
+                        /* Kick off the host read right away; the callback
+                           waits for it if the host is slower than the
+                           modeled seek and transfer time. */
+                        if ((val != WIN_READ_MULTIPLE) || (ide->blocksize > 0))
+                            ide_io_queue_read(ide, ide->tf->secount ? ide->tf->secount : 256);
                     } else
                         ide_set_callback(ide, 200.0 * IDE_TIME);
                     ide->do_initial_read = 1;
@@ -2180,12 +2264,17 @@ ide_callback(void *priv)
         case WIN_STANDBYNOW1:
         case WIN_IDLENOW1:
         case WIN_SETIDLE1:
+            /* Standby parks the drive, so its cache must be on disk. */
+            if ((ide->command == WIN_STANDBYNOW1) && (ide->type == IDE_HDD))
+                hdd_image_flush(ide->hdd_num);
             ide->tf->atastat = DRDY_STAT | DSC_STAT;
             ide_irq_raise(ide);
             break;
 
         case WIN_CHECKPOWERMODE1:
         case WIN_SLEEP1:
+            if ((ide->command == WIN_SLEEP1) && (ide->type == IDE_HDD))
+                hdd_image_flush(ide->hdd_num);
             ide->tf->secount = 0xff;
             ide->tf->atastat = DRDY_STAT | DSC_STAT;
             ide_irq_raise(ide);
@@ -2200,10 +2289,14 @@ ide_callback(void *priv)
                 err = IDNF_ERR;
             else {
                 if (ide->do_initial_read) {
+                    if (ide_io_read_pending(ide)) {
+                        /* The host read has not caught up with the modeled
+                           latency yet. */
+                        ide_set_callback(ide, 6.0 * IDE_TIME);
+                        return;
+                    }
                     ide->do_initial_read = 0;
                     ide->sector_pos      = 0;
-                    hdd_image_read(ide->hdd_num, ide_get_sector(ide),
-                                   ide->tf->secount ? ide->tf->secount : 256, ide->sector_buffer);
                 }
 
                 memcpy(ide->buffer, &ide->sector_buffer[ide->sector_pos * 512], 512);
@@ -2233,7 +2326,12 @@ ide_callback(void *priv)
                     ide->sector_pos = ide->tf->secount;
                 else
                     ide->sector_pos = 256;
-                hdd_image_read(ide->hdd_num, ide_get_sector(ide), ide->sector_pos, ide->sector_buffer);
+                if (ide_io_read_pending(ide)) {
+                    /* The host read has not caught up with the modeled
+                       latency yet. */
+                    ide_set_callback(ide, 6.0 * IDE_TIME);
+                    return;
+                }
 
                 ide->tf->pos = 0;
 
@@ -2278,10 +2376,14 @@ ide_callback(void *priv)
                 err = IDNF_ERR;
             else {
                 if (ide->do_initial_read) {
+                    if (ide_io_read_pending(ide)) {
+                        /* The host read has not caught up with the modeled
+                           latency yet. */
+                        ide_set_callback(ide, 6.0 * IDE_TIME);
+                        return;
+                    }
                     ide->do_initial_read = 0;
                     ide->sector_pos      = 0;
-                    hdd_image_read(ide->hdd_num, ide_get_sector(ide),
-                                   ide->tf->secount ? ide->tf->secount : 256, ide->sector_buffer);
                 }
 
                 memcpy(ide->buffer, &ide->sector_buffer[ide->sector_pos * 512], 512);
@@ -2675,6 +2777,8 @@ ide_board_close(int board)
         dev = ide_drives[c];
 
         if (dev != NULL) {
+            ide_io_drain(c);
+
             if ((dev->type == IDE_HDD) && (dev->hdd_num != -1))
                 hdd_image_close(dev->hdd_num);
 
@@ -2702,6 +2806,24 @@ ide_board_close(int board)
 
     free(ide_boards[board]);
     ide_boards[board] = NULL;
+
+    /* Take the I/O worker down with the last board. */
+    if (ide_io_thread != NULL) {
+        for (uint8_t i = 0; i < IDE_BUS_MAX; i++) {
+            if (ide_boards[i] != NULL)
+                return;
+        }
+
+        ide_io_quit = 1;
+        thread_set_event(ide_io_wake);
+        thread_wait(ide_io_thread);
+        thread_destroy_event(ide_io_wake);
+        thread_destroy_event(ide_io_idle);
+        ide_io_thread = NULL;
+        ide_io_wake   = NULL;
+        ide_io_idle   = NULL;
+        ide_io_quit   = 0;
+    }
 }
 
 static void
@@ -18,6 +18,7 @@
  */
 #define _GNU_SOURCE
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -31,6 +32,8 @@
 #include <86box/path.h>
 #include <86box/plat.h>
 #include <86box/random.h>
+#include <86box/thread.h>
+#include <86box/trace.h>
 #include <86box/hdd.h>
 #include "minivhd/minivhd.h"
 #include "minivhd/internal.h"
@@ -40,9 +43,25 @@
 #define HDD_IMAGE_HDX 2
 #define HDD_IMAGE_VHD 3
 
+/* One write-back cluster of 512-byte sectors (64 KB). */
+#define WCACHE_SECTORS 128
+
+/* Write overlay magic ('86OV') and header size. */
+#define OVL_MAGIC       0x564f3638
+#define OVL_HEADER_SIZE 16
+
 typedef struct hdd_image_t {
     FILE     *file; /* Used for HDD_IMAGE_RAW, HDD_IMAGE_HDI, and HDD_IMAGE_HDX. */
     MVHDMeta *vhd;  /* Used for HDD_IMAGE_VHD. */
+    uint8_t  *map;  /* Mapping of the file, when the host can provide one. */
+    uint64_t  map_size;
+    uint8_t  *wcache;          /* Write-back cluster for unmapped images. */
+    uint64_t  wcache_dirty[2]; /* One bit per sector of the cluster. */
+    uint32_t  wcache_sector;   /* First sector of the cached cluster. */
+    FILE     *overlay;         /* Per-instance write overlay for a read-only base. */
+    uint64_t *ovl_bitmap;      /* One bit per sector: the sector lives in the overlay. */
+    uint64_t  ovl_base;        /* File offset of the overlay's data region. */
+    uint8_t   ovl_dirty;       /* The bitmap has bits not yet written back. */
     uint32_t  base;
     uint32_t  pos;
     uint32_t  last_sector;
@@ -55,6 +74,73 @@ hdd_image_t hdd_images[HDD_NUM];
 static char  empty_sector[512];
 static char *empty_sector_1mb;
 
+/* Boot-time image preload: opening and probing every configured image is
+   pure host file I/O with no ordering dependency on the rest of machine
+   init, so a hard reset queues the loads to a worker thread up front and
+   the disk controllers consume the results when their init reaches them.
+   The worker walks the drives one at a time - the overlap that matters is
+   with ROM loading and device setup, and keeping the loads serial among
+   themselves avoids any sharing inside the load path (the image creation
+   scratch buffer in particular). */
+enum {
+    PRELOAD_NONE = 0,
+    PRELOAD_QUEUED,
+    PRELOAD_DONE
+};
+
+static atomic_int preload_state[HDD_NUM];
+static int        preload_ret[HDD_NUM];
+static thread_t  *preload_thread;
+static event_t   *preload_done_event;
+
+static int hdd_image_load_real(int id);
+
+static void
+hdd_image_preload_run(UNUSED(void *priv))
+{
+    for (uint8_t i = 0; i < HDD_NUM; i++) {
+        if (atomic_load(&preload_state[i]) == PRELOAD_QUEUED) {
+            preload_ret[i] = hdd_image_load_real(i);
+            atomic_store(&preload_state[i], PRELOAD_DONE);
+            thread_set_event(preload_done_event);
+        }
+    }
+}
+
+void
+hdd_image_preload_all(void)
+{
+    int queued = 0;
+
+    /* Wait out a previous run and close any image it opened that no
+       controller ever claimed. */
+    if (preload_thread != NULL) {
+        thread_wait(preload_thread);
+        preload_thread = NULL;
+
+        for (uint8_t i = 0; i < HDD_NUM; i++) {
+            if (atomic_load(&preload_state[i]) == PRELOAD_DONE) {
+                if (preload_ret[i])
+                    hdd_image_close(i);
+                atomic_store(&preload_state[i], PRELOAD_NONE);
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < HDD_NUM; i++) {
+        if ((hdd[i].bus != HDD_BUS_DISABLED) && (strlen(hdd[i].fn) > 0)) {
+            atomic_store(&preload_state[i], PRELOAD_QUEUED);
+            queued++;
+        }
+    }
+
+    if (queued > 0) {
+        if (preload_done_event == NULL)
+            preload_done_event = thread_create_event();
+        preload_thread = thread_create_named(hdd_image_preload_run, NULL, "hdd_image_preload");
+    }
+}
+
 #ifdef ENABLE_HDD_IMAGE_LOG
 int hdd_image_do_log = ENABLE_HDD_IMAGE_LOG;
 
@@ -117,6 +203,27 @@ image_is_hdx(const char *s, int check_signature)
         return 0;
 }
 
+/* Unsupported copy-on-write formats, detected by signature so they do not
+   fall through to the raw path and get overwritten. */
+static int
+image_is_qcow(const char *s)
+{
+    FILE   *fp;
+    uint8_t magic[4];
+
+    fp = plat_fopen(s, "rb");
+    if (!fp)
+        return 0;
+    if (fread(magic, 1, 4, fp) != 4) {
+        fclose(fp);
+        return 0;
+    }
+    fclose(fp);
+
+    /* "QFI\xfb" - common to QCOW, QCOW2 and QCOW3. */
+    return (magic[0] == 'Q') && (magic[1] == 'F') && (magic[2] == 'I') && (magic[3] == 0xfb);
+}
+
 int
 image_is_vhd(const char *s, int check_signature)
 {
@@ -186,6 +293,17 @@ prepare_new_hard_disk(uint8_t id, uint64_t full_size)
     uint32_t size;
     uint32_t t;
 
+    /* Let the filesystem provide the zeroes instead of writing them all
+       out: growing the file sparsely makes creation instant regardless
+       of the image size. Hosts that cannot fall back to the loop. */
+    if (plat_fextend(hdd_images[id].file, full_size + hdd_images[id].base)) {
+        hdd_images[id].last_sector = (uint32_t) (full_size >> 9) - 1;
+
+        hdd_images[id].loaded = 1;
+
+        return 1;
+    }
+
     t    = (uint32_t) (target_size >> 20);     /* Amount of 1 MB blocks. */
     size = (uint32_t) (target_size & 0xfffff); /* 1 MB mask. */
 
@@ -225,6 +343,254 @@ prepare_new_hard_disk(uint8_t id, uint64_t full_size)
     return 1;
 }
 
+/* Map the image file so that sector access becomes a plain memcpy instead
+   of an fseeko64+fread/fwrite round trip on the emulation thread. Failure
+   is fine - the stdio path below keeps working. Images too large for the
+   address space of a 32-bit host are left to stdio. */
+static void
+hdd_image_map(uint8_t id, uint64_t full_size, uint8_t readonly)
+{
+    uint64_t map_size = full_size + hdd_images[id].base;
+
+    if ((sizeof(void *) < 8) && (map_size > (256 << 20)))
+        return;
+
+    hdd_images[id].map = (uint8_t *) plat_mmap_file(hdd_images[id].file, map_size, readonly);
+    if (hdd_images[id].map != NULL)
+        hdd_images[id].map_size = map_size;
+}
+
+static void
+hdd_image_unmap(uint8_t id)
+{
+    if (hdd_images[id].map != NULL) {
+        plat_msync_file(hdd_images[id].map, hdd_images[id].map_size);
+        plat_munmap_file(hdd_images[id].map, hdd_images[id].map_size);
+        hdd_images[id].map      = NULL;
+        hdd_images[id].map_size = 0;
+    }
+}
+
+/* Coalesce guest writes to unmapped images into one aligned cluster so
+   that swap file style workloads (streams of single-sector writes) do not
+   turn into one host seek+write round trip each. Only the sectors the
+   guest actually wrote are flushed, as one write per contiguous dirty
+   run. */
+static void
+hdd_image_wcache_flush(uint8_t id)
+{
+    hdd_image_t *img = &hdd_images[id];
+
+    if ((img->wcache_dirty[0] | img->wcache_dirty[1]) == 0)
+        return;
+
+    for (uint32_t s = 0; s < WCACHE_SECTORS;) {
+        if (!(img->wcache_dirty[s >> 6] & (1ULL << (s & 63)))) {
+            s++;
+            continue;
+        }
+        uint32_t e = s + 1;
+        while ((e < WCACHE_SECTORS) && (img->wcache_dirty[e >> 6] & (1ULL << (e & 63))))
+            e++;
+        if (fseeko64(img->file, (((uint64_t) (img->wcache_sector + s)) << 9LL) + img->base, SEEK_SET) == -1) {
+            fatal("Hard disk image %i: Cache flush error during seek\n", id);
+            return;
+        }
+        fwrite(&img->wcache[s << 9], 512, e - s, img->file);
+        s = e;
+    }
+
+    img->wcache_dirty[0] = img->wcache_dirty[1] = 0;
+}
+
+/* Do any dirty cached sectors overlap the given range? */
+static int
+hdd_image_wcache_hit(uint8_t id, uint32_t sector, uint32_t count)
+{
+    const hdd_image_t *img = &hdd_images[id];
+
+    if ((img->wcache_dirty[0] | img->wcache_dirty[1]) == 0)
+        return 0;
+
+    return (sector < (img->wcache_sector + WCACHE_SECTORS)) && ((sector + count) > img->wcache_sector);
+}
+
+static void
+hdd_image_wcache_close(uint8_t id)
+{
+    if (hdd_images[id].wcache != NULL) {
+        hdd_image_wcache_flush(id);
+        free(hdd_images[id].wcache);
+        hdd_images[id].wcache = NULL;
+    }
+    hdd_images[id].wcache_dirty[0] = hdd_images[id].wcache_dirty[1] = 0;
+}
+
+/* Write overlay for read-only base images: when the image file itself is
+   not writable (typically one shared read-only master on an image farm),
+   the base is opened read-only - so every instance booting it shares the
+   host page cache - and guest writes land in a per-instance overlay file
+   next to the image. The overlay is a small header, a one-bit-per-sector
+   bitmap, and a sparse data region laid out like the raw image, so only
+   the sectors the guest actually wrote take up space. */
+
+static int
+hdd_image_overlay_open(uint8_t id, uint64_t full_size)
+{
+    hdd_image_t *img     = &hdd_images[id];
+    uint32_t     sectors = (uint32_t) (full_size >> 9);
+    uint32_t     words   = (sectors + 63) / 64;
+    uint32_t     magic   = OVL_MAGIC;
+    uint32_t     version = 1;
+    uint32_t     zero    = 0;
+    uint32_t     hdr[4]  = { 0, 0, 0, 0 };
+    char         ovl_fn[sizeof(hdd[id].fn) + 8];
+
+    snprintf(ovl_fn, sizeof(ovl_fn), "%s.ovl", hdd[id].fn);
+
+    img->ovl_base   = (OVL_HEADER_SIZE + (((uint64_t) words) << 3) + 511ULL) & ~511ULL;
+    img->ovl_bitmap = (uint64_t *) calloc(words, sizeof(uint64_t));
+
+    img->overlay = plat_fopen(ovl_fn, "rb+");
+    if (img->overlay != NULL) {
+        if ((fread(hdr, 4, 4, img->overlay) != 4) || (hdr[0] != magic) || (hdr[1] != version) || (hdr[2] != sectors) || (fread(img->ovl_bitmap, 8, words, img->overlay) != words)) {
+            /* Stale or mismatched overlay - start it over. */
+            hdd_image_log("Hard disk image %i: Discarding unusable overlay '%s'\n", id, ovl_fn);
+            fclose(img->overlay);
+            img->overlay = NULL;
+            memset(img->ovl_bitmap, 0, ((size_t) words) << 3);
+        }
+    }
+
+    if (img->overlay == NULL) {
+        img->overlay = plat_fopen(ovl_fn, "wb+");
+        if (img->overlay == NULL) {
+            free(img->ovl_bitmap);
+            img->ovl_bitmap = NULL;
+            return 0;
+        }
+        fwrite(&magic, 1, 4, img->overlay);
+        fwrite(&version, 1, 4, img->overlay);
+        fwrite(&sectors, 1, 4, img->overlay);
+        fwrite(&zero, 1, 4, img->overlay);
+        fwrite(img->ovl_bitmap, 8, words, img->overlay);
+    }
+
+    img->ovl_dirty = 0;
+    return 1;
+}
+
+static void
+hdd_image_overlay_flush(uint8_t id)
+{
+    hdd_image_t *img = &hdd_images[id];
+
+    if (img->ovl_dirty) {
+        uint32_t words = ((img->last_sector + 1) + 63) / 64;
+
+        if (fseeko64(img->overlay, OVL_HEADER_SIZE, SEEK_SET) == -1) {
+            fatal("Hard disk image %i: Overlay bitmap error during seek\n", id);
+            return;
+        }
+        fwrite(img->ovl_bitmap, 8, words, img->overlay);
+        img->ovl_dirty = 0;
+    }
+    fflush(img->overlay);
+}
+
+static void
+hdd_image_overlay_close(uint8_t id)
+{
+    if (hdd_images[id].overlay != NULL) {
+        hdd_image_overlay_flush(id);
+        fclose(hdd_images[id].overlay);
+        hdd_images[id].overlay = NULL;
+    }
+    free(hdd_images[id].ovl_bitmap);
+    hdd_images[id].ovl_bitmap = NULL;
+}
+
+/* Serve each contiguous run of sectors from where it lives: overlaid
+   sectors from the overlay's data region, the rest from the (mapped when
+   possible) shared base. */
+static void
+hdd_image_overlay_read(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
+{
+    hdd_image_t *img = &hdd_images[id];
+
+    while (count > 0) {
+        int      in_ovl = (img->ovl_bitmap[sector >> 6] >> (sector & 63)) & 1;
+        uint32_t run    = 1;
+        size_t   num_read;
+
+        while ((run < count) && ((int) ((img->ovl_bitmap[(sector + run) >> 6] >> ((sector + run) & 63)) & 1) == in_ovl))
+            run++;
+
+        if (in_ovl) {
+            if (fseeko64(img->overlay, img->ovl_base + (((uint64_t) sector) << 9LL), SEEK_SET) == -1) {
+                fatal("Hard disk image %i: Overlay read error during seek\n", id);
+                return;
+            }
+            /* Sectors zeroed by hole punching may lie past the overlay's
+               end of file - they read back as zeroes. */
+            num_read = fread(buffer, 512, run, img->overlay);
+            if (num_read < run)
+                memset(buffer + (num_read << 9), 0x00, ((size_t) (run - num_read)) << 9);
+        } else if (img->map != NULL) {
+            memcpy(buffer, &img->map[(((uint64_t) sector) << 9LL) + img->base], ((size_t) run) << 9);
+        } else {
+            if (fseeko64(img->file, (((uint64_t) sector) << 9LL) + img->base, SEEK_SET) == -1) {
+                fatal("Hard disk image %i: Read error during seek\n", id);
+                return;
+            }
+            num_read = fread(buffer, 512, run, img->file);
+            if (num_read < run)
+                memset(buffer + (num_read << 9), 0x00, ((size_t) (run - num_read)) << 9);
+        }
+
+        sector += run;
+        buffer += ((size_t) run) << 9;
+        count -= run;
+    }
+}
+
+static void
+hdd_image_overlay_write(uint8_t id, uint32_t sector, uint32_t count, const uint8_t *buffer)
+{
+    hdd_image_t *img = &hdd_images[id];
+
+    if (fseeko64(img->overlay, img->ovl_base + (((uint64_t) sector) << 9LL), SEEK_SET) == -1) {
+        fatal("Hard disk image %i: Overlay write error during seek\n", id);
+        return;
+    }
+    fwrite(buffer, 512, count, img->overlay);
+
+    for (uint32_t i = sector; i < (sector + count); i++)
+        img->ovl_bitmap[i >> 6] |= 1ULL << (i & 63);
+    img->ovl_dirty = 1;
+}
+
+static void
+hdd_image_overlay_zero(uint8_t id, uint32_t sector, uint32_t count)
+{
+    hdd_image_t *img = &hdd_images[id];
+
+    /* Punch a hole where possible, like the regular zero path does. */
+    if ((count < WCACHE_SECTORS) || !plat_fpunch(img->overlay, img->ovl_base + (((uint64_t) sector) << 9LL), ((uint64_t) count) << 9LL)) {
+        memset(empty_sector, 0, 512);
+        if (fseeko64(img->overlay, img->ovl_base + (((uint64_t) sector) << 9LL), SEEK_SET) == -1) {
+            fatal("Hard disk image %i: Overlay zero error during seek\n", id);
+            return;
+        }
+        for (uint32_t i = 0; i < count; i++)
+            fwrite(empty_sector, 512, 1, img->overlay);
+    }
+
+    for (uint32_t i = sector; i < (sector + count); i++)
+        img->ovl_bitmap[i >> 6] |= 1ULL << (i & 63);
+    img->ovl_dirty = 1;
+}
+
 void
 hdd_image_init(void)
 {
@@ -234,6 +600,26 @@ hdd_image_init(void)
 
 int
 hdd_image_load(int id)
+{
+    int state = atomic_load(&preload_state[id]);
+
+    /* Consume the boot-time preload result if there is one, waiting it out
+       if the worker has not reached this drive yet. */
+    while (state == PRELOAD_QUEUED) {
+        thread_wait_event(preload_done_event, 10);
+        state = atomic_load(&preload_state[id]);
+    }
+
+    if (state == PRELOAD_DONE) {
+        atomic_store(&preload_state[id], PRELOAD_NONE);
+        return preload_ret[id];
+    }
+
+    return hdd_image_load_real(id);
+}
+
+static int
+hdd_image_load_real(int id)
 {
     uint32_t sector_size = 512;
     uint32_t zero        = 0;
@@ -248,6 +634,7 @@ hdd_image_load(int id)
     int      is_hdx[2] = { 0, 0 };
     int      is_vhd[2] = { 0, 0 };
     int      vhd_error = 0;
+    int      read_only = 0;
 
     memset(empty_sector, 0, sizeof(empty_sector));
     if (fn) {
@@ -258,6 +645,9 @@ hdd_image_load(int id)
 
     if (hdd_images[id].loaded) {
         if (hdd_images[id].file) {
+            hdd_image_wcache_close(id);
+            hdd_image_overlay_close(id);
+            hdd_image_unmap(id);
             fclose(hdd_images[id].file);
             hdd_images[id].file = NULL;
         } else if (hdd_images[id].vhd) {
@@ -282,6 +672,14 @@ hdd_image_load(int id)
         return 0;
     }
     hdd_images[id].file = plat_fopen(fn, "rb+");
+    if ((hdd_images[id].file == NULL) && (errno != ENOENT)) {
+        /* The image exists but cannot be opened for writing - typically a
+           shared read-only master on an image farm. Open the base
+           read-only and route guest writes to a per-instance overlay. */
+        hdd_images[id].file = plat_fopen(fn, "rb");
+        if (hdd_images[id].file != NULL)
+            read_only = 1;
+    }
     if (hdd_images[id].file == NULL) {
         /* Failed to open existing hard disk image */
         if (errno == ENOENT) {
@@ -373,6 +771,8 @@ retry_vhd:
             s = full_size = ((uint64_t) hdd[id].spt) * ((uint64_t) hdd[id].hpc) * ((uint64_t) hdd[id].tracks) << 9LL;
 
             ret = prepare_new_hard_disk(id, full_size);
+            if (ret)
+                hdd_image_map(id, full_size, 0);
             return ret;
         } else {
             /* Failed for another reason */
@@ -441,6 +841,15 @@ retry_vhd:
             hdd[id].tracks      = tracks;
             hdd_images[id].type = HDD_IMAGE_HDX;
         } else if (is_vhd[1]) {
+            if (read_only) {
+                /* minivhd needs write access; a differencing child VHD on
+                   top of the read-only parent gives the same workflow. */
+                pclog("hdd_image_load(): VHD: Image is read-only, use a differencing VHD on top of it\n");
+                fclose(hdd_images[id].file);
+                hdd_images[id].file = NULL;
+                memset(hdd[id].fn, 0, sizeof(hdd[id].fn));
+                return 0;
+            }
             fclose(hdd_images[id].file);
             hdd_images[id].file = NULL;
             hdd_images[id].vhd  = mvhd_open(fn, (bool) 0, &vhd_error);
@@ -468,6 +877,15 @@ retry_vhd:
             hdd_images[id].loaded      = 1;
             return 1;
         } else {
+            if (image_is_qcow(fn)) {
+                /* Opening a QCOW image as raw would trash its metadata. A
+                   differencing VHD provides the same overlay workflow. */
+                pclog("hdd_image_load(): QCOW images are not supported, use a (differencing) VHD\n");
+                fclose(hdd_images[id].file);
+                hdd_images[id].file = NULL;
+                memset(hdd[id].fn, 0, sizeof(hdd[id].fn));
+                return 0;
+            }
             full_size           = ((uint64_t) hdd[id].spt) * ((uint64_t) hdd[id].hpc) * ((uint64_t) hdd[id].tracks) << 9LL;
             hdd_images[id].type = HDD_IMAGE_RAW;
         }
@@ -476,14 +894,34 @@ retry_vhd:
     if (fseeko64(hdd_images[id].file, 0, SEEK_END) == -1)
         fatal("hdd_image_load(): Error seeking to the end of file\n");
     s = ftello64(hdd_images[id].file);
-    if (s < (full_size + hdd_images[id].base))
+    if (s < (full_size + hdd_images[id].base)) {
+        if (read_only) {
+            /* A read-only base cannot be grown to the configured size. */
+            hdd_image_log("Hard disk image %i: Read-only image is too small\n", id);
+            fclose(hdd_images[id].file);
+            hdd_images[id].file = NULL;
+            memset(hdd[id].fn, 0, sizeof(hdd[id].fn));
+            return 0;
+        }
         ret = prepare_new_hard_disk(id, full_size);
-    else {
+    } else {
         hdd_images[id].last_sector = (uint32_t) (full_size >> 9) - 1;
         hdd_images[id].loaded      = 1;
         ret                        = 1;
     }
 
+    if (ret) {
+        if (read_only && !hdd_image_overlay_open(id, full_size)) {
+            hdd_image_log("Hard disk image %i: Unable to open the write overlay\n", id);
+            fclose(hdd_images[id].file);
+            hdd_images[id].file   = NULL;
+            hdd_images[id].loaded = 0;
+            memset(hdd[id].fn, 0, sizeof(hdd[id].fn));
+            return 0;
+        }
+        hdd_image_map(id, full_size, read_only);
+    }
+
     return ret;
 }
 
@@ -494,7 +932,7 @@ hdd_image_seek(uint8_t id, uint32_t sector)
     addr         = (uint64_t) sector << 9LL;
 
     hdd_images[id].pos = sector;
-    if (hdd_images[id].type != HDD_IMAGE_VHD) {
+    if ((hdd_images[id].type != HDD_IMAGE_VHD) && (hdd_images[id].map == NULL)) {
         if (fseeko64(hdd_images[id].file, addr + hdd_images[id].base, SEEK_SET) == -1)
             fatal("hdd_image_seek(): Error seeking\n");
     }
@@ -506,10 +944,27 @@ hdd_image_read(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
     int    non_transferred_sectors;
     size_t num_read;
 
+    TRACE_BEGIN(TRACE_DISK, "disk", "hdd_image_read");
+
     if (hdd_images[id].type == HDD_IMAGE_VHD) {
         non_transferred_sectors = mvhd_read_sectors(hdd_images[id].vhd, sector, count, buffer);
         hdd_images[id].pos      = sector + count - non_transferred_sectors - 1;
+    } else if (hdd_images[id].overlay != NULL) {
+        if (((uint64_t) sector + count) > ((uint64_t) hdd_images[id].last_sector + 1))
+            count = (sector <= hdd_images[id].last_sector) ? (hdd_images[id].last_sector + 1 - sector) : 0;
+
+        hdd_image_overlay_read(id, sector, count, buffer);
+        hdd_images[id].pos = sector + count;
+    } else if (hdd_images[id].map != NULL) {
+        if (((uint64_t) sector + count) > ((uint64_t) hdd_images[id].last_sector + 1))
+            count = (sector <= hdd_images[id].last_sector) ? (hdd_images[id].last_sector + 1 - sector) : 0;
+
+        memcpy(buffer, &hdd_images[id].map[(((uint64_t) sector) << 9LL) + hdd_images[id].base], ((size_t) count) << 9);
+        hdd_images[id].pos = sector + count;
     } else {
+        if (hdd_image_wcache_hit(id, sector, count))
+            hdd_image_wcache_flush(id);
+
         if (fseeko64(hdd_images[id].file, ((uint64_t) (sector) << 9LL) + hdd_images[id].base, SEEK_SET) == -1) {
             fatal("Hard disk image %i: Read error during seek\n", id);
             return;
@@ -518,6 +973,8 @@ hdd_image_read(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
         num_read           = fread(buffer, 512, count, hdd_images[id].file);
         hdd_images[id].pos = sector + num_read;
     }
+
+    TRACE_END(TRACE_DISK, "disk", "hdd_image_read");
 }
 
 uint32_t
@@ -554,10 +1011,48 @@ hdd_image_write(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
     int    non_transferred_sectors;
     size_t num_write;
 
+    TRACE_BEGIN(TRACE_DISK, "disk", "hdd_image_write");
+
     if (hdd_images[id].type == HDD_IMAGE_VHD) {
         non_transferred_sectors = mvhd_write_sectors(hdd_images[id].vhd, sector, count, buffer);
         hdd_images[id].pos      = sector + count - non_transferred_sectors - 1;
+    } else if (hdd_images[id].overlay != NULL) {
+        if (((uint64_t) sector + count) > ((uint64_t) hdd_images[id].last_sector + 1))
+            count = (sector <= hdd_images[id].last_sector) ? (hdd_images[id].last_sector + 1 - sector) : 0;
+
+        hdd_image_overlay_write(id, sector, count, buffer);
+        hdd_images[id].pos = sector + count;
+    } else if (hdd_images[id].map != NULL) {
+        if (((uint64_t) sector + count) > ((uint64_t) hdd_images[id].last_sector + 1))
+            count = (sector <= hdd_images[id].last_sector) ? (hdd_images[id].last_sector + 1 - sector) : 0;
+
+        /* The dirty pages are written back by the host; a final flush
+           happens when the image is closed. */
+        memcpy(&hdd_images[id].map[(((uint64_t) sector) << 9LL) + hdd_images[id].base], buffer, ((size_t) count) << 9);
+        hdd_images[id].pos = sector + count;
     } else {
+        const uint32_t cluster = sector & ~(WCACHE_SECTORS - 1);
+
+        if (count && (((sector + count - 1) & ~(WCACHE_SECTORS - 1)) == cluster)) {
+            /* The write fits in one cluster - coalesce it. */
+            if (hdd_images[id].wcache == NULL)
+                hdd_images[id].wcache = (uint8_t *) malloc(WCACHE_SECTORS << 9);
+            if (hdd_images[id].wcache_sector != cluster) {
+                hdd_image_wcache_flush(id);
+                hdd_images[id].wcache_sector = cluster;
+            }
+            memcpy(&hdd_images[id].wcache[(sector - cluster) << 9], buffer, ((size_t) count) << 9);
+            for (uint32_t i = sector - cluster; i < (sector - cluster + count); i++)
+                hdd_images[id].wcache_dirty[i >> 6] |= 1ULL << (i & 63);
+            hdd_images[id].pos = sector + count;
+            TRACE_END(TRACE_DISK, "disk", "hdd_image_write");
+            return;
+        }
+
+        /* Cluster-crossing write - keep ordering with whatever is cached. */
+        if (hdd_image_wcache_hit(id, sector, count))
+            hdd_image_wcache_flush(id);
+
         if (fseeko64(hdd_images[id].file, ((uint64_t) (sector) << 9LL) + hdd_images[id].base, SEEK_SET) == -1) {
             fatal("Hard disk image %i: Write error during seek\n", id);
             return;
@@ -566,6 +1061,8 @@ hdd_image_write(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
         num_write          = fwrite(buffer, 512, count, hdd_images[id].file);
         hdd_images[id].pos = sector + num_write;
     }
+
+    TRACE_END(TRACE_DISK, "disk", "hdd_image_write");
 }
 
 int
@@ -590,9 +1087,32 @@ hdd_image_zero(uint8_t id, uint32_t sector, uint32_t count)
     if (hdd_images[id].type == HDD_IMAGE_VHD) {
         int non_transferred_sectors = mvhd_format_sectors(hdd_images[id].vhd, sector, count);
         hdd_images[id].pos          = sector + count - non_transferred_sectors - 1;
+    } else if (hdd_images[id].overlay != NULL) {
+        if (((uint64_t) sector + count) > ((uint64_t) hdd_images[id].last_sector + 1))
+            count = (sector <= hdd_images[id].last_sector) ? (hdd_images[id].last_sector + 1 - sector) : 0;
+
+        hdd_image_overlay_zero(id, sector, count);
+        hdd_images[id].pos = count ? (sector + count - 1) : sector;
+    } else if (hdd_images[id].map != NULL) {
+        if (((uint64_t) sector + count) > ((uint64_t) hdd_images[id].last_sector + 1))
+            count = (sector <= hdd_images[id].last_sector) ? (hdd_images[id].last_sector + 1 - sector) : 0;
+
+        memset(&hdd_images[id].map[(((uint64_t) sector) << 9LL) + hdd_images[id].base], 0x00, ((size_t) count) << 9);
+        hdd_images[id].pos = count ? (sector + count - 1) : sector;
     } else {
         memset(empty_sector, 0, 512);
 
+        if (hdd_image_wcache_hit(id, sector, count))
+            hdd_image_wcache_flush(id);
+
+        /* Punch a hole for large runs so the zeroed range stops taking up
+           space in the image; small runs and hosts without hole punching
+           fall through to writing the zeroes out. */
+        if ((count >= WCACHE_SECTORS) && plat_fpunch(hdd_images[id].file, (((uint64_t) sector) << 9LL) + hdd_images[id].base, ((uint64_t) count) << 9LL)) {
+            hdd_images[id].pos = sector + count - 1;
+            return;
+        }
+
         if (fseeko64(hdd_images[id].file, ((uint64_t) (sector) << 9LL) + hdd_images[id].base, SEEK_SET) == -1) {
             fatal("Hard disk image %i: Zero error during seek\n", id);
             return;
@@ -624,6 +1144,24 @@ hdd_image_zero_ex(uint8_t id, uint32_t sector, uint32_t count)
     return 0;
 }
 
+/* Push any buffered writes out to the host - the guest issued a flush
+   command or the image is about to go away. */
+void
+hdd_image_flush(uint8_t id)
+{
+    if (!hdd_images[id].loaded)
+        return;
+
+    if (hdd_images[id].overlay != NULL)
+        hdd_image_overlay_flush(id);
+    else if (hdd_images[id].map != NULL)
+        plat_msync_file(hdd_images[id].map, hdd_images[id].map_size);
+    else if (hdd_images[id].file != NULL) {
+        hdd_image_wcache_flush(id);
+        fflush(hdd_images[id].file);
+    }
+}
+
 uint32_t
 hdd_image_get_pos(uint8_t id)
 {
@@ -644,6 +1182,9 @@ hdd_image_unload(uint8_t id, UNUSED(int fn_preserve))
 
     if (hdd_images[id].loaded) {
         if (hdd_images[id].file != NULL) {
+            hdd_image_wcache_close(id);
+            hdd_image_overlay_close(id);
+            hdd_image_unmap(id);
             fclose(hdd_images[id].file);
             hdd_images[id].file = NULL;
         } else if (hdd_images[id].vhd != NULL) {
@@ -667,6 +1208,9 @@ hdd_image_close(uint8_t id)
         return;
 
     if (hdd_images[id].file != NULL) {
+        hdd_image_wcache_close(id);
+        hdd_image_overlay_close(id);
+        hdd_image_unmap(id);
         fclose(hdd_images[id].file);
         hdd_images[id].file = NULL;
     } else if (hdd_images[id].vhd != NULL) {
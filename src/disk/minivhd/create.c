@@ -275,10 +275,19 @@ mvhd_create_fixed_raw(const char* path, FILE* raw_img, uint64_t size_in_bytes, M
         }
     } else {
         gen_footer(&vhdm->footer, size_in_bytes, geom, MVHD_TYPE_FIXED, 0);
-        for (s = 0; s < size_sectors; s++) {
-            fwrite(img_data, sizeof img_data, 1, fp);
+        /* The data area is all zeroes, so extend the file to its final size
+           and let the filesystem allocate it lazily rather than writing
+           every sector out. Hosts that cannot keep the write-out loop. */
+        if (mvhd_ftruncate64(fp, (int64_t)size_in_bytes) == 0) {
+            mvhd_fseeko64(fp, (int64_t)size_in_bytes, SEEK_SET);
             if (progress_callback)
-                progress_callback(s + 1, size_sectors);
+                progress_callback(size_sectors, size_sectors);
+        } else {
+            for (s = 0; s < size_sectors; s++) {
+                fwrite(img_data, sizeof img_data, 1, fp);
+                if (progress_callback)
+                    progress_callback(s + 1, size_sectors);
+            }
         }
     }
     mvhd_footer_to_buffer(&vhdm->footer, footer_buff);
@@ -235,6 +235,14 @@ int64_t mvhd_ftello64(FILE* stream);
  */
 int mvhd_fseeko64(FILE* stream, int64_t offset, int origin);
 
+/**
+ * \brief Change the size of a file stream
+ *
+ * This is a portable version of the POSIX ftruncate(). Grown ranges are
+ * allocated lazily where the host filesystem allows it.
+ */
+int mvhd_ftruncate64(FILE* stream, int64_t length);
+
 /**
  * \brief Calculate the CRC32 of a data buffer.
  * 
@@ -221,40 +221,79 @@ mvhd_sparse_read(MVHDMeta *vhdm, uint32_t offset, int num_sectors, void *out_buf
 
     uint8_t* buff = (uint8_t*)out_buff;
     int64_t addr = 0ULL;
-    uint32_t s = 0;
-    uint32_t ls = 0;
+    uint32_t s = offset;
+    uint32_t ls = offset + transfer_sectors;
+    uint32_t blk_end = 0;
     int blk = 0;
-    int prev_blk = -1;
     int sib = 0;
-    ls = offset + transfer_sectors;
+    int run = 0;
+    int present = 0;
 
-    for (s = offset; s < ls; s++) {
+    while (s < ls) {
         blk = s / vhdm->sect_per_block;
         sib = s % vhdm->sect_per_block;
-        if (blk != prev_blk) {
-            prev_blk = blk;
-            if (vhdm->bitmap.curr_block != blk) {
-                read_sect_bitmap(vhdm, blk);
-                mvhd_fseeko64(vhdm->f, (uint64_t)sib * MVHD_SECTOR_SIZE, SEEK_CUR);
-            } else {
+        blk_end = s + (vhdm->sect_per_block - sib);
+        if (blk_end > ls)
+            blk_end = ls;
+
+        if (vhdm->bitmap.curr_block != blk)
+            read_sect_bitmap(vhdm, blk);
+
+        /* Transfer runs of sectors sharing the same allocation state with
+           a single fread() or memset() rather than one call per sector. */
+        while (s < blk_end) {
+            present = VHD_TESTBIT(vhdm->bitmap.curr_bitmap, sib) != 0;
+            run = 1;
+            while (((s + run) < blk_end) &&
+                   ((VHD_TESTBIT(vhdm->bitmap.curr_bitmap, sib + run) != 0) == present))
+                run++;
+
+            if (present) {
                 addr = (((int64_t) vhdm->block_offset[blk]) + vhdm->bitmap.sector_count + sib) *
                        MVHD_SECTOR_SIZE;
                 mvhd_fseeko64(vhdm->f, addr, SEEK_SET);
-            }
-        }
+                (void) !fread(buff, (size_t)run * MVHD_SECTOR_SIZE, 1, vhdm->f);
+            } else
+                memset(buff, 0, (size_t)run * MVHD_SECTOR_SIZE);
 
-        if (VHD_TESTBIT(vhdm->bitmap.curr_bitmap, sib))
-            (void) !fread(buff, MVHD_SECTOR_SIZE, 1, vhdm->f);
-        else {
-            memset(buff, 0, MVHD_SECTOR_SIZE);
-            mvhd_fseeko64(vhdm->f, MVHD_SECTOR_SIZE, SEEK_CUR);
+            buff += (size_t)run * MVHD_SECTOR_SIZE;
+            s += run;
+            sib += run;
         }
-        buff += MVHD_SECTOR_SIZE;
     }
 
     return truncated_sectors;
 }
 
+/**
+ * \brief Find the image in a differencing chain which holds a sector
+ *
+ * \param [in] vhdm MiniVHD data structure of the child image
+ * \param [in] s The sector to look for
+ *
+ * \return The first image in the chain which has the sector allocated,
+ * or the end of the chain if no image does
+ */
+static MVHDMeta*
+diff_find_sector(MVHDMeta *vhdm, uint32_t s)
+{
+    int blk = 0;
+    int sib = 0;
+
+    while (vhdm->footer.disk_type == MVHD_TYPE_DIFF) {
+        blk = s / vhdm->sect_per_block;
+        sib = s % vhdm->sect_per_block;
+        if (vhdm->bitmap.curr_block != blk) {
+            read_sect_bitmap(vhdm, blk);
+        }
+        if (VHD_TESTBIT(vhdm->bitmap.curr_bitmap, sib))
+            break;
+        vhdm = vhdm->parent;
+    }
+
+    return vhdm;
+}
+
 int
 mvhd_diff_read(MVHDMeta *vhdm, uint32_t offset, int num_sectors, void *out_buff)
 {
@@ -265,35 +304,29 @@ mvhd_diff_read(MVHDMeta *vhdm, uint32_t offset, int num_sectors, void *out_buff)
     check_sectors(offset, num_sectors, total_sectors, &transfer_sectors, &truncated_sectors);
 
     uint8_t *buff = (uint8_t*)out_buff;
-    MVHDMeta *curr_vhdm = vhdm;
-    uint32_t s = 0;
-    uint32_t ls = 0;
-    int blk = 0;
-    int sib = 0;
-    ls = offset + transfer_sectors;
-
-    for (s = offset; s < ls; s++) {
-        while (curr_vhdm->footer.disk_type == MVHD_TYPE_DIFF) {
-            blk = s / curr_vhdm->sect_per_block;
-            sib = s % curr_vhdm->sect_per_block;
-            if (curr_vhdm->bitmap.curr_block != blk) {
-                read_sect_bitmap(curr_vhdm, blk);
-            }
-            if (!VHD_TESTBIT(curr_vhdm->bitmap.curr_bitmap, sib)) {
-                curr_vhdm = curr_vhdm->parent;
-            } else { break; }
-        }
+    MVHDMeta *curr_vhdm = NULL;
+    uint32_t s = offset;
+    uint32_t ls = offset + transfer_sectors;
+    uint32_t e = 0;
+
+    while (s < ls) {
+        /* Coalesce a run of sectors served by the same image in the chain
+           into one read, instead of one call per sector. */
+        curr_vhdm = diff_find_sector(vhdm, s);
+        e = s + 1;
+        while ((e < ls) && (diff_find_sector(vhdm, e) == curr_vhdm))
+            e++;
 
         /* We handle actual sector reading using the fixed or sparse functions,
            as a differencing VHD is also a sparse VHD */
         if ((curr_vhdm->footer.disk_type == MVHD_TYPE_DIFF) ||
             (curr_vhdm->footer.disk_type == MVHD_TYPE_DYNAMIC))
-            mvhd_sparse_read(curr_vhdm, s, 1, buff);
+            mvhd_sparse_read(curr_vhdm, s, e - s, buff);
         else
-            mvhd_fixed_read(curr_vhdm, s, 1, buff);
+            mvhd_fixed_read(curr_vhdm, s, e - s, buff);
 
-        curr_vhdm = vhdm;
-        buff += MVHD_SECTOR_SIZE;
+        buff += (size_t)(e - s) * MVHD_SECTOR_SIZE;
+        s = e;
     }
 
     return truncated_sectors;
@@ -327,16 +360,22 @@ mvhd_sparse_diff_write(MVHDMeta *vhdm, uint32_t offset, int num_sectors, void *i
 
     uint8_t* buff = (uint8_t *) in_buff;
     int64_t addr = 0ULL;
-    uint32_t s = 0;
-    uint32_t ls = 0;
+    uint32_t s = offset;
+    uint32_t ls = offset + transfer_sectors;
+    uint32_t blk_end = 0;
     int blk = 0;
     int prev_blk = -1;
     int sib = 0;
-    ls = offset + transfer_sectors;
+    int run = 0;
 
-    for (s = offset; s < ls; s++) {
+    while (s < ls) {
         blk = s / vhdm->sect_per_block;
         sib = s % vhdm->sect_per_block;
+        blk_end = s + (vhdm->sect_per_block - sib);
+        if (blk_end > ls)
+            blk_end = ls;
+        run = (int)(blk_end - s);
+
         if (vhdm->bitmap.curr_block != blk && prev_blk >= 0) {
             /* Write the sector bitmap for the previous block, before we replace it. */
             write_curr_sect_bitmap(vhdm);
@@ -349,21 +388,20 @@ mvhd_sparse_diff_write(MVHDMeta *vhdm, uint32_t offset, int num_sectors, void *i
             create_block(vhdm, blk);
         }
 
-        if (blk != prev_blk) {
-            if (vhdm->bitmap.curr_block != blk) {
-                read_sect_bitmap(vhdm, blk);
-                mvhd_fseeko64(vhdm->f, (uint64_t)sib * MVHD_SECTOR_SIZE, SEEK_CUR);
-            } else {
-                addr = (((int64_t) vhdm->block_offset[blk]) + vhdm->bitmap.sector_count + sib) *
-                       MVHD_SECTOR_SIZE;
-                mvhd_fseeko64(vhdm->f, addr, SEEK_SET);
-            }
-            prev_blk = blk;
-        }
-
-        fwrite(buff, MVHD_SECTOR_SIZE, 1, vhdm->f);
-        VHD_SETBIT(vhdm->bitmap.curr_bitmap, sib);
-        buff += MVHD_SECTOR_SIZE;
+        if (vhdm->bitmap.curr_block != blk)
+            read_sect_bitmap(vhdm, blk);
+        prev_blk = blk;
+
+        /* Write everything landing in this block as a single fwrite(). */
+        addr = (((int64_t) vhdm->block_offset[blk]) + vhdm->bitmap.sector_count + sib) *
+               MVHD_SECTOR_SIZE;
+        mvhd_fseeko64(vhdm->f, addr, SEEK_SET);
+        fwrite(buff, (size_t)run * MVHD_SECTOR_SIZE, 1, vhdm->f);
+        for (int i = 0; i < run; i++)
+            VHD_SETBIT(vhdm->bitmap.curr_bitmap, sib + i);
+
+        buff += (size_t)run * MVHD_SECTOR_SIZE;
+        s = blk_end;
     }
 
     /* And write the sector bitmap for the last block we visited to disk */
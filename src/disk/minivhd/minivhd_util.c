@@ -46,6 +46,13 @@
 #include <time.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 #include "minivhd.h"
 #include "internal.h"
 #include "xml2_encoding.h"
@@ -430,6 +437,24 @@ mvhd_fseeko64(FILE* stream, int64_t offset, int origin)
 }
 
 
+int
+mvhd_ftruncate64(FILE* stream, int64_t length)
+{
+    if (fflush(stream) != 0)
+        return -1;
+#ifdef _WIN32
+    HANDLE h = (HANDLE)_get_osfhandle(_fileno(stream));
+    DWORD bytes = 0;
+    /* Mark the file sparse so extending it does not force the filesystem
+       to materialise the intervening zeroes. */
+    DeviceIoControl(h, FSCTL_SET_SPARSE, NULL, 0, NULL, 0, &bytes, NULL);
+    return _chsize_s(_fileno(stream), length);
+#else
+    return ftruncate(fileno(stream), (off_t)length);
+#endif
+}
+
+
 uint32_t
 mvhd_crc32_for_byte(uint32_t r)
 {
@@ -336,6 +336,29 @@ image_is_mdi(const char *s)
         return 0;
 }
 
+/* Map the medium so that sector access becomes a plain memcpy instead of
+   an fseek+fread/fwrite round trip, the same way hdd_image.c treats raw
+   hard disk images. Failure is fine - the stdio path below keeps working. */
+static void
+mo_image_map(mo_drive_t *drv, uint64_t size)
+{
+    drv->map = (uint8_t *) plat_mmap_file(drv->fp, size, drv->read_only);
+    if (drv->map != NULL)
+        drv->map_size = size;
+}
+
+static void
+mo_image_unmap(mo_drive_t *drv)
+{
+    if (drv->map != NULL) {
+        if (!drv->read_only)
+            plat_msync_file(drv->map, drv->map_size);
+        plat_munmap_file(drv->map, drv->map_size);
+        drv->map      = NULL;
+        drv->map_size = 0;
+    }
+}
+
 int
 mo_load(mo_t *dev, char *fn)
 {
@@ -386,6 +409,8 @@ mo_load(mo_t *dev, char *fn)
     if (fseek(dev->drv->fp, dev->drv->base, SEEK_SET) == -1)
         fatal("mo_load(): Error seeking to the beginning of the file\n");
 
+    mo_image_map(dev->drv, (uint64_t) size + dev->drv->base);
+
     strncpy(dev->drv->image_path, fn, sizeof(dev->drv->image_path) - 1);
 
     return 1;
@@ -409,6 +434,7 @@ void
 mo_disk_unload(mo_t *dev)
 {
     if (dev->drv && dev->drv->fp) {
+        mo_image_unmap(dev->drv);
         fclose(dev->drv->fp);
         dev->drv->fp = NULL;
     }
@@ -942,19 +968,32 @@ mo_blocks(mo_t *dev, int32_t *len, UNUSED(int first_batch), int out)
 
     *len = dev->requested_blocks * dev->drv->sector_size;
 
-    for (int i = 0; i < dev->requested_blocks; i++) {
-        if (fseek(dev->drv->fp, dev->drv->base + (dev->sector_pos * dev->drv->sector_size) + (i * dev->drv->sector_size), SEEK_SET) == 1)
-            break;
+    if (dev->drv->map != NULL) {
+        uint64_t addr   = dev->drv->base + ((uint64_t) dev->sector_pos * dev->drv->sector_size);
+        uint32_t blocks = dev->requested_blocks;
 
-        if (feof(dev->drv->fp))
-            break;
+        if ((dev->sector_pos + blocks) > dev->drv->medium_size)
+            blocks = dev->drv->medium_size - dev->sector_pos;
 
-        if (out) {
-            if (fwrite(dev->buffer + (i * dev->drv->sector_size), 1, dev->drv->sector_size, dev->drv->fp) != dev->drv->sector_size)
-                fatal("mo_blocks(): Error writing data\n");
-        } else {
-            if (fread(dev->buffer + (i * dev->drv->sector_size), 1, dev->drv->sector_size, dev->drv->fp) != dev->drv->sector_size)
-                fatal("mo_blocks(): Error reading data\n");
+        if (out)
+            memcpy(&dev->drv->map[addr], dev->buffer, (size_t) blocks * dev->drv->sector_size);
+        else
+            memcpy(dev->buffer, &dev->drv->map[addr], (size_t) blocks * dev->drv->sector_size);
+    } else {
+        for (int i = 0; i < dev->requested_blocks; i++) {
+            if (fseek(dev->drv->fp, dev->drv->base + (dev->sector_pos * dev->drv->sector_size) + (i * dev->drv->sector_size), SEEK_SET) == 1)
+                break;
+
+            if (feof(dev->drv->fp))
+                break;
+
+            if (out) {
+                if (fwrite(dev->buffer + (i * dev->drv->sector_size), 1, dev->drv->sector_size, dev->drv->fp) != dev->drv->sector_size)
+                    fatal("mo_blocks(): Error writing data\n");
+            } else {
+                if (fread(dev->buffer + (i * dev->drv->sector_size), 1, dev->drv->sector_size, dev->drv->fp) != dev->drv->sector_size)
+                    fatal("mo_blocks(): Error reading data\n");
+            }
         }
     }
 
@@ -981,6 +1020,13 @@ mo_format(mo_t *dev)
 
     mo_log("MO %i: Formatting media...\n", dev->id);
 
+    if (dev->drv->map != NULL) {
+        /* Truncating under an active mapping is not portable - zero the
+           mapped image in place instead. */
+        memset(dev->drv->map, 0, dev->drv->map_size);
+        return;
+    }
+
     fseek(dev->drv->fp, 0, SEEK_END);
     size = ftell(dev->drv->fp);
 
@@ -1061,13 +1107,23 @@ mo_erase(mo_t *dev)
     mo_buf_alloc(dev, dev->drv->sector_size);
     memset(dev->buffer, 0, dev->drv->sector_size);
 
-    fseek(dev->drv->fp, dev->drv->base + (dev->sector_pos * dev->drv->sector_size), SEEK_SET);
+    if (dev->drv->map != NULL) {
+        uint32_t blocks = dev->requested_blocks;
 
-    for (i = 0; i < dev->requested_blocks; i++) {
-        if (feof(dev->drv->fp))
-            break;
+        if ((dev->sector_pos + blocks) > dev->drv->medium_size)
+            blocks = dev->drv->medium_size - dev->sector_pos;
+        memset(&dev->drv->map[dev->drv->base + ((uint64_t) dev->sector_pos * dev->drv->sector_size)], 0,
+               (size_t) blocks * dev->drv->sector_size);
+        i = blocks;
+    } else {
+        fseek(dev->drv->fp, dev->drv->base + (dev->sector_pos * dev->drv->sector_size), SEEK_SET);
 
-        fwrite(dev->buffer, 1, dev->drv->sector_size, dev->drv->fp);
+        for (i = 0; i < dev->requested_blocks; i++) {
+            if (feof(dev->drv->fp))
+                break;
+
+            fwrite(dev->buffer, 1, dev->drv->sector_size, dev->drv->fp);
+        }
     }
 
     mo_log("MO %i: Erased %i bytes of blocks...\n", dev->id, i * dev->drv->sector_size);
@@ -480,6 +480,29 @@ zip_load_abort(zip_t *dev)
     return 0;
 }
 
+/* Map the medium so that sector access becomes a plain memcpy instead of
+   an fseek+fread/fwrite round trip, the same way hdd_image.c treats raw
+   hard disk images. Failure is fine - the stdio path below keeps working. */
+static void
+zip_image_map(zip_drive_t *drv, uint64_t size)
+{
+    drv->map = (uint8_t *) plat_mmap_file(drv->fp, size, drv->read_only);
+    if (drv->map != NULL)
+        drv->map_size = size;
+}
+
+static void
+zip_image_unmap(zip_drive_t *drv)
+{
+    if (drv->map != NULL) {
+        if (!drv->read_only)
+            plat_msync_file(drv->map, drv->map_size);
+        plat_munmap_file(drv->map, drv->map_size);
+        drv->map      = NULL;
+        drv->map_size = 0;
+    }
+}
+
 int
 zip_load(zip_t *dev, char *fn)
 {
@@ -531,6 +554,8 @@ zip_load(zip_t *dev, char *fn)
     if (fseek(dev->drv->fp, dev->drv->base, SEEK_SET) == -1)
         fatal("zip_load(): Error seeking to the beginning of the file\n");
 
+    zip_image_map(dev->drv, (uint64_t) size + dev->drv->base);
+
     strncpy(dev->drv->image_path, fn, sizeof(dev->drv->image_path) - 1);
     // After using strncpy, dev->drv->image_path needs to be explicitly null terminated to make gcc happy.
     // In the event strlen(dev->drv->image_path) == sizeof(dev->drv->image_path) (no null terminator)
@@ -559,6 +584,7 @@ void
 zip_disk_unload(zip_t *dev)
 {
     if (dev->drv && dev->drv->fp) {
+        zip_image_unmap(dev->drv);
         fclose(dev->drv->fp);
         dev->drv->fp = NULL;
     }
@@ -1125,19 +1151,31 @@ zip_blocks(zip_t *dev, int32_t *len, UNUSED(int first_batch), int out)
 
     *len = dev->requested_blocks << 9;
 
-    for (int i = 0; i < dev->requested_blocks; i++) {
-        if (fseek(dev->drv->fp, dev->drv->base + (dev->sector_pos << 9) + (i << 9), SEEK_SET) == 1)
-            break;
+    if (dev->drv->map != NULL) {
+        uint32_t blocks = dev->requested_blocks;
 
-        if (feof(dev->drv->fp))
-            break;
+        if ((dev->sector_pos + blocks) > dev->drv->medium_size)
+            blocks = dev->drv->medium_size - dev->sector_pos;
 
-        if (out) {
-            if (fwrite(dev->buffer + (i << 9), 1, 512, dev->drv->fp) != 512)
-                fatal("zip_blocks(): Error writing data\n");
-        } else {
-            if (fread(dev->buffer + (i << 9), 1, 512, dev->drv->fp) != 512)
-                fatal("zip_blocks(): Error reading data\n");
+        if (out)
+            memcpy(&dev->drv->map[dev->drv->base + ((uint64_t) dev->sector_pos << 9)], dev->buffer, ((size_t) blocks) << 9);
+        else
+            memcpy(dev->buffer, &dev->drv->map[dev->drv->base + ((uint64_t) dev->sector_pos << 9)], ((size_t) blocks) << 9);
+    } else {
+        for (int i = 0; i < dev->requested_blocks; i++) {
+            if (fseek(dev->drv->fp, dev->drv->base + (dev->sector_pos << 9) + (i << 9), SEEK_SET) == 1)
+                break;
+
+            if (feof(dev->drv->fp))
+                break;
+
+            if (out) {
+                if (fwrite(dev->buffer + (i << 9), 1, 512, dev->drv->fp) != 512)
+                    fatal("zip_blocks(): Error writing data\n");
+            } else {
+                if (fread(dev->buffer + (i << 9), 1, 512, dev->drv->fp) != 512)
+                    fatal("zip_blocks(): Error reading data\n");
+            }
         }
     }
 
@@ -2121,10 +2159,14 @@ zip_phase_data_out(scsi_common_t *sc)
                     dev->buffer[6] = (s >> 8) & 0xff;
                     dev->buffer[7] = s & 0xff;
                 }
-                if (fseek(dev->drv->fp, dev->drv->base + (i << 9), SEEK_SET) == -1)
-                    fatal("zip_phase_data_out(): Error seeking\n");
-                if (fwrite(dev->buffer, 1, 512, dev->drv->fp) != 512)
-                    fatal("zip_phase_data_out(): Error writing data\n");
+                if (dev->drv->map != NULL)
+                    memcpy(&dev->drv->map[dev->drv->base + ((uint64_t) i << 9)], dev->buffer, 512);
+                else {
+                    if (fseek(dev->drv->fp, dev->drv->base + (i << 9), SEEK_SET) == -1)
+                        fatal("zip_phase_data_out(): Error seeking\n");
+                    if (fwrite(dev->buffer, 1, 512, dev->drv->fp) != 512)
+                        fatal("zip_phase_data_out(): Error writing data\n");
+                }
             }
             break;
         case GPCMD_MODE_SELECT_6:
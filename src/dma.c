@@ -1562,11 +1562,19 @@ dma_channel_advance(int channel)
     return tc;
 }
 
+/* Transfer up to num units (bytes on an 8-bit channel, little endian words
+   on a 16-bit one) into buf, validating the channel state once. A run of
+   ascending transfers to plain RAM is copied in one go; anything else
+   (scatter/gather, PS/2, decrement mode, MMIO) falls back to the per-unit
+   path. The run stops early at terminal count, flagged with DMA_OVER in the
+   return value. Returns the number of units transferred, or DMA_NODATA if
+   the channel cannot currently supply data. */
 int
-dma_channel_read(int channel)
+dma_channel_read_block(int channel, uint8_t *buf, int num)
 {
     dma_t   *dma_c = &dma[channel];
     uint16_t temp;
+    int      done = 0;
     int      tc = 0;
 
     if (channel < 4) {
@@ -1587,80 +1595,140 @@ dma_channel_read(int channel)
     if (dma_stat_adv_pend & (1 << channel))
         dma_channel_advance(channel);
 
-    if (!dma_at && !channel)
-        refreshread();
+    while ((done < num) && !tc) {
+        if ((dma_at || channel) && !dma_ps2.is_ps2 && !dma_advanced && !(dma_c->mode & 0x20)) {
+            const uint8_t *p;
+            const int      us  = dma_c->size ? 2 : 1;
+            int            run = num - done;
+            int            bound;
+
+            if (run > (dma_c->cc + 1))
+                run = dma_c->cc + 1;
+            bound = (dma_c->size ? (0x20000 - (int) (dma_c->ac & 0x1ffff)) : (0x10000 - (int) (dma_c->ac & 0xffff))) / us;
+            if (run > bound)
+                run = bound;
+            bound = (MEM_GRANULARITY_SIZE - (int) (dma_c->ac & MEM_GRANULARITY_MASK)) / us;
+            if (run > bound)
+                run = bound;
+
+            if ((run > 0) && ((p = mem_read_phys_ptr(dma_c->ac, run * us)) != NULL)) {
+                memcpy(buf + (done * us), p, run * us);
+                if (dma_c->size)
+                    dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac + (run * 2)) & 0x1ffff);
+                else
+                    dma_c->ac = (dma_c->ac & 0xffff0000 & dma_mask) | ((dma_c->ac + run) & 0xffff);
+                done += run;
+                dma_c->cc -= run;
+                if (dma_c->cc < 0) {
+                    tc = 1;
+                    if (dma_c->mode & 0x10) { /*Auto-init*/
+                        dma_c->cc = dma_c->cb;
+                        dma_c->ac = dma_c->ab;
+                    } else
+                        dma_m |= (1 << channel);
+                    dma_stat |= (1 << channel);
+                }
+                continue;
+            }
+        }
 
-    if (!dma_c->size) {
-        temp = _dma_read(dma_c->ac, dma_c);
+        if (!dma_at && !channel)
+            refreshread();
 
-        if (dma_c->mode & 0x20) {
-            if (dma_ps2.is_ps2)
-                dma_c->ac--;
-            else if (dma_advanced)
-                dma_retreat(dma_c);
-            else
-                dma_c->ac = (dma_c->ac & 0xffff0000 & dma_mask) | ((dma_c->ac - 1) & 0xffff);
+        if (!dma_c->size) {
+            temp      = _dma_read(dma_c->ac, dma_c);
+            buf[done] = temp & 0xff;
+
+            if (dma_c->mode & 0x20) {
+                if (dma_ps2.is_ps2)
+                    dma_c->ac--;
+                else if (dma_advanced)
+                    dma_retreat(dma_c);
+                else
+                    dma_c->ac = (dma_c->ac & 0xffff0000 & dma_mask) | ((dma_c->ac - 1) & 0xffff);
+            } else {
+                if (dma_ps2.is_ps2)
+                    dma_c->ac++;
+                else if (dma_advanced)
+                    dma_advance(dma_c);
+                else
+                    dma_c->ac = (dma_c->ac & 0xffff0000 & dma_mask) | ((dma_c->ac + 1) & 0xffff);
+            }
         } else {
-            if (dma_ps2.is_ps2)
-                dma_c->ac++;
-            else if (dma_advanced)
-                dma_advance(dma_c);
-            else
-                dma_c->ac = (dma_c->ac & 0xffff0000 & dma_mask) | ((dma_c->ac + 1) & 0xffff);
+            temp                = _dma_readw(dma_c->ac, dma_c);
+            buf[done * 2]       = temp & 0xff;
+            buf[(done * 2) + 1] = temp >> 8;
+
+            if (dma_c->mode & 0x20) {
+                if (dma_ps2.is_ps2)
+                    dma_c->ac -= 2;
+                else if (dma_advanced)
+                    dma_retreat(dma_c);
+                else
+                    dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac - 2) & 0x1ffff);
+            } else {
+                if (dma_ps2.is_ps2)
+                    dma_c->ac += 2;
+                else if (dma_advanced)
+                    dma_advance(dma_c);
+                else
+                    dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac + 2) & 0x1ffff);
+            }
         }
-    } else {
-        temp = _dma_readw(dma_c->ac, dma_c);
+        done++;
 
-        if (dma_c->mode & 0x20) {
-            if (dma_ps2.is_ps2)
-                dma_c->ac -= 2;
-            else if (dma_advanced)
-                dma_retreat(dma_c);
-            else
-                dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac - 2) & 0x1ffff);
-        } else {
-            if (dma_ps2.is_ps2)
-                dma_c->ac += 2;
-            else if (dma_advanced)
-                dma_advance(dma_c);
-            else
-                dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac + 2) & 0x1ffff);
+        dma_c->cc--;
+        if (dma_c->cc < 0) {
+            if (dma_advanced && (dma_c->sg_status & 1) && !(dma_c->sg_status & 6))
+                dma_sg_next_addr(dma_c);
+            else {
+                tc = 1;
+                if (dma_c->mode & 0x10) { /*Auto-init*/
+                    dma_c->cc = dma_c->cb;
+                    dma_c->ac = dma_c->ab;
+                } else
+                    dma_m |= (1 << channel);
+                dma_stat |= (1 << channel);
+            }
+        }
+
+        if (tc) {
+            if (dma_advanced && (dma_c->sg_status & 1) && ((dma_c->sg_command & 0xc0) == 0x40)) {
+                picint(1 << 13);
+                dma_c->sg_status |= 8;
+            }
         }
     }
 
     dma_stat_rq |= (1 << channel);
 
-    dma_c->cc--;
-    if (dma_c->cc < 0) {
-        if (dma_advanced && (dma_c->sg_status & 1) && !(dma_c->sg_status & 6))
-            dma_sg_next_addr(dma_c);
-        else {
-            tc = 1;
-            if (dma_c->mode & 0x10) { /*Auto-init*/
-                dma_c->cc = dma_c->cb;
-                dma_c->ac = dma_c->ab;
-            } else
-                dma_m |= (1 << channel);
-            dma_stat |= (1 << channel);
-        }
-    }
+    return done | (tc ? DMA_OVER : 0);
+}
 
-    if (tc) {
-        if (dma_advanced && (dma_c->sg_status & 1) && ((dma_c->sg_command & 0xc0) == 0x40)) {
-            picint(1 << 13);
-            dma_c->sg_status |= 8;
-        }
+int
+dma_channel_read(int channel)
+{
+    uint8_t   unit[2] = { 0, 0 };
+    const int ret     = dma_channel_read_block(channel, unit, 1);
 
-        return (temp | DMA_OVER);
-    }
+    if (ret == DMA_NODATA)
+        return (DMA_NODATA);
 
-    return temp;
+    if (!dma[channel].size)
+        return unit[0] | (ret & DMA_OVER);
+
+    return unit[0] | (unit[1] << 8) | (ret & DMA_OVER);
 }
 
+/* Write-side counterpart of dma_channel_read_block, taking num units from
+   buf. The run stops early at terminal count; DMA_OVER is set in the return
+   value when the channel ended up masked. */
 int
-dma_channel_write(int channel, uint16_t val)
+dma_channel_write_block(int channel, const uint8_t *buf, int num)
 {
     dma_t *dma_c = &dma[channel];
+    int    done = 0;
+    int    tc = 0;
 
     if (channel < 4) {
         if (dma_command[0] & 0x04)
@@ -1677,42 +1745,98 @@ dma_channel_write(int channel, uint16_t val)
     if ((dma_c->mode & 0xC) != 4)
         return (DMA_NODATA);
 
-    if (!dma_c->size) {
-        _dma_write(dma_c->ac, val & 0xff, dma_c);
+    while ((done < num) && !tc) {
+        if ((dma_at || channel) && !dma_ps2.is_ps2 && !dma_advanced && !(dma_c->mode & 0x20)) {
+            uint8_t  *p;
+            const int us  = dma_c->size ? 2 : 1;
+            int       run = num - done;
+            int       bound;
+
+            if (run > (dma_c->cc + 1))
+                run = dma_c->cc + 1;
+            bound = (dma_c->size ? (0x20000 - (int) (dma_c->ac & 0x1ffff)) : (0x10000 - (int) (dma_c->ac & 0xffff))) / us;
+            if (run > bound)
+                run = bound;
+            bound = (MEM_GRANULARITY_SIZE - (int) (dma_c->ac & MEM_GRANULARITY_MASK)) / us;
+            if (run > bound)
+                run = bound;
+
+            if ((run > 0) && ((p = mem_write_phys_ptr(dma_c->ac, run * us)) != NULL)) {
+                memcpy(p, buf + (done * us), run * us);
+                if (dma_at)
+                    mem_invalidate_range(dma_c->ac, dma_c->ac + (run * us) - 1);
+                if (dma_c->size)
+                    dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac + (run * 2)) & 0x1ffff);
+                else
+                    dma_c->ac = (dma_c->ac & 0xffff0000 & dma_mask) | ((dma_c->ac + run) & 0xffff);
+                done += run;
+                dma_c->cc -= run;
+                if (dma_c->cc < 0) {
+                    tc = 1;
+                    if (dma_c->mode & 0x10) { /*Auto-init*/
+                        dma_c->cc = dma_c->cb;
+                        dma_c->ac = dma_c->ab;
+                    } else
+                        dma_m |= (1 << channel);
+                    dma_stat |= (1 << channel);
+                }
+                continue;
+            }
+        }
 
-        if (dma_c->mode & 0x20) {
-            if (dma_ps2.is_ps2)
-                dma_c->ac--;
-            else if (dma_advanced)
-                dma_retreat(dma_c);
-            else
-                dma_c->ac = (dma_c->ac & 0xffff0000 & dma_mask) | ((dma_c->ac - 1) & 0xffff);
+        if (!dma_c->size) {
+            _dma_write(dma_c->ac, buf[done], dma_c);
+
+            if (dma_c->mode & 0x20) {
+                if (dma_ps2.is_ps2)
+                    dma_c->ac--;
+                else if (dma_advanced)
+                    dma_retreat(dma_c);
+                else
+                    dma_c->ac = (dma_c->ac & 0xffff0000 & dma_mask) | ((dma_c->ac - 1) & 0xffff);
+            } else {
+                if (dma_ps2.is_ps2)
+                    dma_c->ac++;
+                else if (dma_advanced)
+                    dma_advance(dma_c);
+                else
+                    dma_c->ac = (dma_c->ac & 0xffff0000 & dma_mask) | ((dma_c->ac + 1) & 0xffff);
+            }
         } else {
-            if (dma_ps2.is_ps2)
-                dma_c->ac++;
-            else if (dma_advanced)
-                dma_advance(dma_c);
-            else
-                dma_c->ac = (dma_c->ac & 0xffff0000 & dma_mask) | ((dma_c->ac + 1) & 0xffff);
-        }
-    } else {
-        _dma_writew(dma_c->ac, val, dma_c);
+            _dma_writew(dma_c->ac, buf[done * 2] | (buf[(done * 2) + 1] << 8), dma_c);
 
-        if (dma_c->mode & 0x20) {
-            if (dma_ps2.is_ps2)
-                dma_c->ac -= 2;
-            else if (dma_advanced)
-                dma_retreat(dma_c);
-            else
+            if (dma_c->mode & 0x20) {
+                if (dma_ps2.is_ps2)
+                    dma_c->ac -= 2;
+                else if (dma_advanced)
+                    dma_retreat(dma_c);
+                else
+                    dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac - 2) & 0x1ffff);
                 dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac - 2) & 0x1ffff);
-            dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac - 2) & 0x1ffff);
-        } else {
-            if (dma_ps2.is_ps2)
-                dma_c->ac += 2;
-            else if (dma_advanced)
-                dma_advance(dma_c);
-            else
-                dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac + 2) & 0x1ffff);
+            } else {
+                if (dma_ps2.is_ps2)
+                    dma_c->ac += 2;
+                else if (dma_advanced)
+                    dma_advance(dma_c);
+                else
+                    dma_c->ac = (dma_c->ac & 0xfffe0000 & dma_mask) | ((dma_c->ac + 2) & 0x1ffff);
+            }
+        }
+        done++;
+
+        dma_c->cc--;
+        if (dma_c->cc < 0) {
+            if (dma_advanced && (dma_c->sg_status & 1) && !(dma_c->sg_status & 6))
+                dma_sg_next_addr(dma_c);
+            else {
+                tc = 1;
+                if (dma_c->mode & 0x10) { /*Auto-init*/
+                    dma_c->cc = dma_c->cb;
+                    dma_c->ac = dma_c->ab;
+                } else
+                    dma_m |= (1 << channel);
+                dma_stat |= (1 << channel);
+            }
         }
     }
 
@@ -1720,30 +1844,28 @@ dma_channel_write(int channel, uint16_t val)
 
     dma_stat_adv_pend &= ~(1 << channel);
 
-    dma_c->cc--;
-    if (dma_c->cc < 0) {
-        if (dma_advanced && (dma_c->sg_status & 1) && !(dma_c->sg_status & 6))
-            dma_sg_next_addr(dma_c);
-        else {
-            if (dma_c->mode & 0x10) { /*Auto-init*/
-                dma_c->cc = dma_c->cb;
-                dma_c->ac = dma_c->ab;
-            } else
-                dma_m |= (1 << channel);
-            dma_stat |= (1 << channel);
-        }
-    }
-
     if (dma_m & (1 << channel)) {
         if (dma_advanced && (dma_c->sg_status & 1) && ((dma_c->sg_command & 0xc0) == 0x40)) {
             picint(1 << 13);
             dma_c->sg_status |= 8;
         }
 
-        return DMA_OVER;
+        return done | DMA_OVER;
     }
 
-    return 0;
+    return done;
+}
+
+int
+dma_channel_write(int channel, uint16_t val)
+{
+    const uint8_t unit[2] = { val & 0xff, (val >> 8) & 0xff };
+    const int     ret     = dma_channel_write_block(channel, unit, 1);
+
+    if (ret == DMA_NODATA)
+        return (DMA_NODATA);
+
+    return (ret & DMA_OVER) ? DMA_OVER : 0;
 }
 
 static void
@@ -1846,15 +1968,30 @@ dma_bm_read(uint32_t PhysAddress, uint8_t *DataRead, uint32_t TotalSize, int Tra
 {
     uint32_t n;
     uint32_t n2;
+    uint32_t i = 0;
+    uint32_t run;
+    uint8_t *p;
     uint8_t  bytes[4] = { 0, 0, 0, 0 };
 
     n  = TotalSize & ~(TransferSize - 1);
     n2 = TotalSize - n;
 
     /* Do the divisible block, if there is one. */
-    if (n) {
-        for (uint32_t i = 0; i < n; i += TransferSize)
+    while (i < n) {
+        /* Copy through the exec pointer one granularity block at a time;
+           MMIO and other special mappings fall back to per-unit accesses. */
+        run = MEM_GRANULARITY_SIZE - ((PhysAddress + i) & MEM_GRANULARITY_MASK);
+        if (run > (n - i))
+            run = n - i;
+        run &= ~((uint32_t) TransferSize - 1);
+        p = (run >= (uint32_t) TransferSize) ? mem_read_phys_ptr(PhysAddress + i, run) : NULL;
+        if (p != NULL) {
+            memcpy(&(DataRead[i]), p, run);
+            i += run;
+        } else {
             mem_read_phys((void *) &(DataRead[i]), PhysAddress + i, TransferSize);
+            i += TransferSize;
+        }
     }
 
     /* Do the non-divisible block, if there is one. */
@@ -1869,15 +2006,28 @@ dma_bm_write(uint32_t PhysAddress, const uint8_t *DataWrite, uint32_t TotalSize,
 {
     uint32_t n;
     uint32_t n2;
+    uint32_t i = 0;
+    uint32_t run;
+    uint8_t *p;
     uint8_t  bytes[4] = { 0, 0, 0, 0 };
 
     n  = TotalSize & ~(TransferSize - 1);
     n2 = TotalSize - n;
 
     /* Do the divisible block, if there is one. */
-    if (n) {
-        for (uint32_t i = 0; i < n; i += TransferSize)
+    while (i < n) {
+        run = MEM_GRANULARITY_SIZE - ((PhysAddress + i) & MEM_GRANULARITY_MASK);
+        if (run > (n - i))
+            run = n - i;
+        run &= ~((uint32_t) TransferSize - 1);
+        p = (run >= (uint32_t) TransferSize) ? mem_write_phys_ptr(PhysAddress + i, run) : NULL;
+        if (p != NULL) {
+            memcpy(p, &(DataWrite[i]), run);
+            i += run;
+        } else {
             mem_write_phys((void *) &(DataWrite[i]), PhysAddress + i, TransferSize);
+            i += TransferSize;
+        }
     }
 
     /* Do the non-divisible block, if there is one. */
@@ -24,9 +24,15 @@
 void
 fifo8_create(Fifo8 *fifo, uint32_t capacity)
 {
+    /* Round up to a power of two so that the wrap points become a mask
+       instead of a divide; every FIFO in the tree is one already. */
+    while (capacity & (capacity - 1))
+        capacity += capacity & ~(capacity - 1);
+
     fifo->data = (uint8_t *) malloc(capacity);
     memset(fifo->data, 0, capacity);
     fifo->capacity = capacity;
+    fifo->mask     = capacity - 1;
     fifo->head     = 0;
     fifo->num      = 0;
 }
@@ -44,7 +50,7 @@ void
 fifo8_push(Fifo8 *fifo, uint8_t data)
 {
     assert(fifo->num < fifo->capacity);
-    fifo->data[(fifo->head + fifo->num) % fifo->capacity] = data;
+    fifo->data[(fifo->head + fifo->num) & fifo->mask] = data;
     fifo->num++;
 }
 
@@ -56,7 +62,7 @@ fifo8_push_all(Fifo8 *fifo, const uint8_t *data, uint32_t num)
 
     assert(fifo->num + num <= fifo->capacity);
 
-    start = (fifo->head + fifo->num) % fifo->capacity;
+    start = (fifo->head + fifo->num) & fifo->mask;
 
     if (start + num <= fifo->capacity) {
         memcpy(&fifo->data[start], data, num);
@@ -76,11 +82,32 @@ fifo8_pop(Fifo8 *fifo)
 
     assert(fifo->num > 0);
     ret = fifo->data[fifo->head++];
-    fifo->head %= fifo->capacity;
+    fifo->head &= fifo->mask;
     fifo->num--;
     return ret;
 }
 
+uint32_t
+fifo8_pop_all(Fifo8 *fifo, uint8_t *data, uint32_t num)
+{
+    uint32_t avail;
+
+    if (num > fifo->num)
+        num = fifo->num;
+
+    avail = fifo->capacity - fifo->head;
+    if (num <= avail) {
+        memcpy(data, &fifo->data[fifo->head], num);
+    } else {
+        memcpy(data, &fifo->data[fifo->head], avail);
+        memcpy(&data[avail], &fifo->data[0], num - avail);
+    }
+
+    fifo->head = (fifo->head + num) & fifo->mask;
+    fifo->num -= num;
+    return num;
+}
+
 const uint8_t *
 fifo8_pop_buf(Fifo8 *fifo, uint32_t max, uint32_t *num)
 {
@@ -90,11 +117,27 @@ fifo8_pop_buf(Fifo8 *fifo, uint32_t max, uint32_t *num)
     *num = MIN(fifo->capacity - fifo->head, max);
     ret  = &fifo->data[fifo->head];
     fifo->head += *num;
-    fifo->head %= fifo->capacity;
+    fifo->head &= fifo->mask;
     fifo->num -= *num;
     return ret;
 }
 
+const uint8_t *
+fifo8_peek_buf(Fifo8 *fifo, uint32_t max, uint32_t *num)
+{
+    assert(max > 0 && max <= fifo->num);
+    *num = MIN(fifo->capacity - fifo->head, max);
+    return &fifo->data[fifo->head];
+}
+
+void
+fifo8_drop(Fifo8 *fifo, uint32_t num)
+{
+    assert(num <= fifo->num);
+    fifo->head = (fifo->head + num) & fifo->mask;
+    fifo->num -= num;
+}
+
 void
 fifo8_reset(Fifo8 *fifo)
 {
@@ -1936,6 +1936,12 @@ fdc_is_verify(fdc_t *fdc)
     return (fdc->deleted & 2) ? 1 : 0;
 }
 
+int
+fdc_is_dma(fdc_t *fdc)
+{
+    return !(fdc->flags & FDC_FLAG_PCJR) && fdc->dma;
+}
+
 int
 fdc_data(fdc_t *fdc, uint8_t data, int last)
 {
@@ -521,6 +521,16 @@ fdd_byteperiod(int drive)
         return 32ULL * TIMER_USEC;
 }
 
+/* Bill extra byte slots consumed by a media backend that transferred a
+   whole burst within a single poll, so the next poll lands after the
+   aggregate time of the burst. */
+void
+fdd_poll_advance(int drive, uint32_t bytes)
+{
+    if (bytes > 1)
+        timer_advance_u64(&fdd_poll_time[drive], (bytes - 1) * fdd_byteperiod(drive));
+}
+
 void
 fdd_set_motor_enable(int drive, int motor_enable)
 {
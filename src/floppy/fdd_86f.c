@@ -201,6 +201,9 @@ typedef struct d86f_t {
     uint16_t  current_byte[2];
     uint16_t  current_bit[2];
     uint16_t  last_word[2];
+    uint16_t  bit_cache_data[2];    /* decoded word cache for d86f_get_bit() */
+    uint16_t  bit_cache_surface[2];
+    uint32_t  bit_cache_word[2];
 #ifdef D86F_COMPRESS
     int is_compressed;
 #endif
@@ -1086,30 +1089,44 @@ d86f_get_bit(int drive, int side)
     /* We need to make sure we read the bits from MSB to LSB. */
     track_bit = 15 - (dev->track_pos & 15);
 
-    if (d86f_reverse_bytes(drive)) {
-        /* Image is in reverse endianness, read the data as is. */
-        encoded_data = d86f_handler[drive].encoded_data(drive, side)[track_word];
-    } else {
-        /* We store the words as big endian, so we need to convert them to little endian when reading. */
-        encoded_data = (d86f_handler[drive].encoded_data(drive, side)[track_word] & 0xFF) << 8;
-        encoded_data |= (d86f_handler[drive].encoded_data(drive, side)[track_word] >> 8);
-    }
-
-    /* In some cases, misindentification occurs so we need to make sure the surface data array is not
-       not NULL. */
-    if (d86f_has_surface_desc(drive) && dev->track_surface_data[side]) {
+    /* Decode the current data and surface words once per 16 bit cells; re-reading
+       them through the handler and byte swapping them again for every single bit
+       cell dominates the poll callback otherwise. */
+    if (track_word != dev->bit_cache_word[side]) {
         if (d86f_reverse_bytes(drive)) {
-            surface_data = dev->track_surface_data[side][track_word] & 0xFF;
+            /* Image is in reverse endianness, read the data as is. */
+            encoded_data = d86f_handler[drive].encoded_data(drive, side)[track_word];
         } else {
-            surface_data = (dev->track_surface_data[side][track_word] & 0xFF) << 8;
-            surface_data |= (dev->track_surface_data[side][track_word] >> 8);
+            /* We store the words as big endian, so we need to convert them to little endian when reading. */
+            encoded_data = (d86f_handler[drive].encoded_data(drive, side)[track_word] & 0xFF) << 8;
+            encoded_data |= (d86f_handler[drive].encoded_data(drive, side)[track_word] >> 8);
         }
+
+        /* In some cases, misindentification occurs so we need to make sure the surface data array is not
+           not NULL. */
+        if (d86f_has_surface_desc(drive) && dev->track_surface_data[side]) {
+            if (d86f_reverse_bytes(drive)) {
+                surface_data = dev->track_surface_data[side][track_word] & 0xFF;
+            } else {
+                surface_data = (dev->track_surface_data[side][track_word] & 0xFF) << 8;
+                surface_data |= (dev->track_surface_data[side][track_word] >> 8);
+            }
+        }
+
+        dev->bit_cache_data[side]    = encoded_data;
+        dev->bit_cache_surface[side] = surface_data;
+        dev->bit_cache_word[side]    = track_word;
+    } else {
+        encoded_data = dev->bit_cache_data[side];
+        surface_data = dev->bit_cache_surface[side];
     }
 
     current_bit = (encoded_data >> track_bit) & 1;
     dev->last_word[side] <<= 1;
 
-    if (d86f_has_surface_desc(drive) && dev->track_surface_data[side]) {
+    /* A zero surface word means no fuzzy or hole bits in this region, so the
+       plain path below applies even if the image has a surface descriptor. */
+    if (surface_data) {
         surface_bit = (surface_data >> track_bit) & 1;
         if (!surface_bit)
             dev->last_word[side] |= current_bit;
@@ -1197,6 +1214,9 @@ d86f_put_bit(int drive, int side, int bit)
         d86f_handler[drive].encoded_data(drive, side)[track_word] = (encoded_data & 0xFF) << 8;
         d86f_handler[drive].encoded_data(drive, side)[track_word] |= (encoded_data >> 8);
     }
+
+    /* Force d86f_get_bit() to re-decode the modified word. */
+    dev->bit_cache_word[side] = 0xFFFFFFFF;
 }
 
 static uint8_t
@@ -1859,6 +1879,9 @@ d86f_write_direct_common(int drive, int side, uint16_t byte, uint8_t type, uint3
 
     dev->track_encoded_data[side][pos] = encoded_byte;
     dev->last_word[side]               = encoded_byte;
+
+    /* Force d86f_get_bit() to re-decode the modified word. */
+    dev->bit_cache_word[side] = 0xFFFFFFFF;
 }
 
 void
@@ -2400,12 +2423,35 @@ d86f_turbo_poll(int drive, int side)
         case STATE_0C_READ_DATA:
         case STATE_11_SCAN_DATA:
         case STATE_16_VERIFY_DATA:
-            d86f_turbo_read(drive, side);
+            /* With DMA (or on a pure verify) the guest is not involved
+               between bytes, so drain the whole sector in this poll and
+               bill its aggregate time to the poll timer in one go. */
+            if (fdc_is_dma(d86f_fdc) || (dev->state == STATE_16_VERIFY_DATA)) {
+                const int old_state = dev->state;
+                uint32_t  burst     = 0;
+
+                while (dev->state == old_state) {
+                    d86f_turbo_read(drive, side);
+                    burst++;
+                }
+                fdd_poll_advance(drive, burst);
+            } else
+                d86f_turbo_read(drive, side);
             break;
 
         case STATE_05_WRITE_DATA:
         case STATE_09_WRITE_DATA:
-            d86f_turbo_write(drive, side);
+            if (fdc_is_dma(d86f_fdc)) {
+                const int old_state = dev->state;
+                uint32_t  burst     = 0;
+
+                while (dev->state == old_state) {
+                    d86f_turbo_write(drive, side);
+                    burst++;
+                }
+                fdd_poll_advance(drive, burst);
+            } else
+                d86f_turbo_write(drive, side);
             break;
 
         case STATE_0D_FORMAT_TRACK:
@@ -2645,6 +2691,14 @@ d86f_prepare_pretrack(int drive, int side, int iso)
 
     d86f_destroy_linked_lists(drive, side);
 
+    /* In turbo mode the encoded bit cells are never read - sectors resolve
+       through the map rebuilt by d86f_prepare_sector() - so skip the encode
+       and only advance the position by the pre-track area's length. */
+    if (fdd_get_turbo(drive) && (dev->version == 0x0063)) {
+        pos = iso ? 0 : ((real_gap0_len + sync_len + (mfm ? 3 : 0) + 1) % raw_size);
+        return (pos + real_gap1_len) % raw_size;
+    }
+
     for (uint32_t i = 0; i < raw_size; i++)
         d86f_write_direct_common(drive, side, gap_fill, 0, i);
 
@@ -2725,6 +2779,20 @@ d86f_prepare_sector(int drive, int side, int prev_pos, uint8_t *id_buf, uint8_t
 
     sync_len = mfm ? 12 : 6;
 
+    /* In turbo mode the turbo poll resolves this sector through the map built
+       above and never reads the encoded bit cells, so skip the expensive
+       encode and only advance the position by the sector's on-track length. */
+    if (fdd_get_turbo(drive) && (dev->version == 0x0063)) {
+        if (!(flags & SECTOR_NO_ID))
+            pos = (pos + sync_len + (mfm ? 3 : 0) + 1 + 4 + 2 + real_gap2_len) % raw_size;
+        if (!(flags & SECTOR_NO_DATA)) {
+            pos = (pos + sync_len + (mfm ? 3 : 0) + 1) % raw_size;
+            if (data_len > 0)
+                pos = (pos + data_len + ((flags & SECTOR_CRC_ERROR) ? 0 : 2) + real_gap3_len) % raw_size;
+        }
+        return pos;
+    }
+
     if (!(flags & SECTOR_NO_ID)) {
         for (i = 0; i < sync_len; i++) {
             d86f_write_direct_common(drive, side, 0, 0, pos);
@@ -2986,6 +3054,8 @@ d86f_zero_track(int drive)
             memset(dev->track_surface_data[side], 0, 106096);
         memset(dev->track_encoded_data[side], 0, 106096);
     }
+
+    dev->bit_cache_word[0] = dev->bit_cache_word[1] = 0xFFFFFFFF;
 }
 
 void
@@ -3067,6 +3137,9 @@ d86f_set_cur_track(int drive, int track)
     d86f_t *dev = d86f[drive];
 
     dev->cur_track = track;
+
+    /* The handler's track buffers are about to be reloaded. */
+    dev->bit_cache_word[0] = dev->bit_cache_word[1] = 0xFFFFFFFF;
 }
 
 void
@@ -3894,6 +3967,8 @@ d86f_setup(int drive)
     dev->last_side_sector[0] = NULL;
     dev->last_side_sector[1] = NULL;
 
+    dev->bit_cache_word[0] = dev->bit_cache_word[1] = 0xFFFFFFFF;
+
     /* Set the drive as active. */
     d86f[drive] = dev;
 }
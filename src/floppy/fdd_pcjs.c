@@ -30,6 +30,9 @@
 #include <86box/fdd_common.h>
 #include <86box/fdd_pcjs.h>
 #include <cJSON.h>
+#include "../crcspeed/crc64speed.h"
+
+#define PCJS_CACHE_MAGIC 0x43534a50UL /* "PJSC" */
 
 static pcjs_t *images[FDD_NUM];
 static pcjs_error_t pcjs_error = E_SUCCESS;
@@ -256,6 +259,8 @@ int parse_file_table(pcjs_t *dev, const cJSON *parsed_json)
 fail:
     /* Deallocate the array */
     free(dev->file_table.entries);
+    dev->file_table.entries     = NULL;
+    dev->file_table.num_entries = 0;
     return 1;
 }
 
@@ -583,9 +588,161 @@ pcjs_seek(int drive, int track)
     }
 }
 
+/* Calculate the CRC64 of the json source file, which keys the sidecar cache
+   of the parsed sector data. */
+static uint64_t
+pcjs_calc_crc64(FILE *fp)
+{
+    uint8_t  buf[4096];
+    uint64_t crc = 0x0000000000000000ULL;
+    size_t   n;
+
+    fseek(fp, 0L, SEEK_SET);
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+        crc = crc64speed_auto(crc, buf, n);
+    fseek(fp, 0L, SEEK_SET);
+
+    return crc;
+}
+
+/* Read the parsed sector data back from the sidecar cache, if one exists and
+   matches the json source. Returns 1 on a hit, 0 on a miss. */
+static int
+pcjs_cache_load(int drive, pcjs_t *dev, uint64_t crc)
+{
+    char    cache_fn[1040];
+    uint8_t header[24];
+    FILE   *fp;
+
+    snprintf(cache_fn, sizeof(cache_fn), "%sc", floppyfns[drive]);
+    fp = plat_fopen(cache_fn, "rb");
+    if (fp == NULL)
+        return 0;
+
+    if ((fread(header, 1, 24, fp) != 24) || (*(uint32_t *) &header[0] != PCJS_CACHE_MAGIC) || (*(uint64_t *) &header[8] != crc)) {
+        fclose(fp);
+        return 0;
+    }
+
+    dev->file_table.num_entries = *(uint16_t *) &header[4];
+    dev->total_tracks           = header[16];
+    dev->total_sides            = header[17];
+    dev->total_sectors          = *(uint16_t *) &header[18];
+    dev->calc_total_tracks      = header[20];
+    dev->calc_total_sides       = header[21];
+    dev->calc_total_sectors     = *(uint16_t *) &header[22];
+
+    if ((dev->calc_total_sides > PCJS_MAX_SIDES)
+        || (fread(&dev->image_info, 1, sizeof(dev->image_info), fp) != sizeof(dev->image_info))
+        || (fread(dev->spt, 1, sizeof(dev->spt), fp) != sizeof(dev->spt)))
+        goto bad;
+
+    if (dev->file_table.num_entries > 0) {
+        dev->file_table.entries = (pcjs_file_table_entry_t *) calloc(dev->file_table.num_entries, sizeof(pcjs_file_table_entry_t));
+        if ((dev->file_table.entries == NULL)
+            || (fread(dev->file_table.entries, sizeof(pcjs_file_table_entry_t), dev->file_table.num_entries, fp) != dev->file_table.num_entries))
+            goto bad;
+    }
+
+    for (uint16_t c = 0; c < dev->calc_total_tracks; c++) {
+        for (uint8_t h = 0; h < dev->calc_total_sides; h++) {
+            for (uint16_t s = 0; s < dev->spt[c][h]; s++) {
+                pcjs_sector_t *sector = &dev->sectors[c][h][s];
+
+                /* The record carries the struct's stale data pointer - it is
+                   replaced before anything can dereference it. */
+                if (fread(sector, 1, sizeof(pcjs_sector_t), fp) != sizeof(pcjs_sector_t)) {
+                    sector->data = NULL;
+                    goto bad;
+                }
+                sector->data = (uint8_t *) calloc(1, sector->size);
+                if ((sector->data == NULL) || (fread(sector->data, 1, sector->size, fp) != sector->size))
+                    goto bad;
+            }
+        }
+    }
+
+    fclose(fp);
+    pcjs_log("PCJS: Loaded parsed sector data from cache\n");
+    return 1;
+
+bad:
+    /* A stale or truncated cache is not an error - fall back to the parser. */
+    fclose(fp);
+    for (int c = 0; c < PCJS_MAX_TRACKS; c++) {
+        for (int h = 0; h < PCJS_MAX_SIDES; h++) {
+            for (uint16_t s = 0; s < PCJS_MAX_SECTORS; s++) {
+                free(dev->sectors[c][h][s].data);
+                dev->sectors[c][h][s].data = NULL;
+            }
+        }
+    }
+    free(dev->file_table.entries);
+    dev->file_table.entries     = NULL;
+    dev->file_table.num_entries = 0;
+    memset(dev->spt, 0x00, sizeof(dev->spt));
+    return 0;
+}
+
+/* Save the freshly parsed sector data to the sidecar cache. Failure is not
+   an error - the image may simply live on read-only media. */
+static void
+pcjs_cache_save(int drive, const pcjs_t *dev, uint64_t crc)
+{
+    char     cache_fn[1040];
+    uint8_t  header[24];
+    uint16_t num_entries = (dev->file_table.entries != NULL) ? dev->file_table.num_entries : 0;
+    FILE    *fp;
+
+    snprintf(cache_fn, sizeof(cache_fn), "%sc", floppyfns[drive]);
+    fp = plat_fopen(cache_fn, "wb");
+    if (fp == NULL)
+        return;
+
+    *(uint32_t *) &header[0]  = PCJS_CACHE_MAGIC;
+    *(uint16_t *) &header[4]  = num_entries;
+    *(uint16_t *) &header[6]  = 0x0000;
+    *(uint64_t *) &header[8]  = crc;
+    header[16]                = dev->total_tracks;
+    header[17]                = dev->total_sides;
+    *(uint16_t *) &header[18] = dev->total_sectors;
+    header[20]                = dev->calc_total_tracks;
+    header[21]                = dev->calc_total_sides;
+    *(uint16_t *) &header[22] = dev->calc_total_sectors;
+
+    if ((fwrite(header, 1, 24, fp) != 24)
+        || (fwrite(&dev->image_info, 1, sizeof(dev->image_info), fp) != sizeof(dev->image_info))
+        || (fwrite(dev->spt, 1, sizeof(dev->spt), fp) != sizeof(dev->spt))
+        || ((num_entries > 0) && (fwrite(dev->file_table.entries, sizeof(pcjs_file_table_entry_t), num_entries, fp) != num_entries))) {
+        pcjs_log("PCJS: Failed to write cache file\n");
+        fclose(fp);
+        return;
+    }
+
+    for (uint16_t c = 0; c < dev->calc_total_tracks; c++) {
+        for (uint8_t h = 0; h < dev->calc_total_sides; h++) {
+            for (uint16_t s = 0; s < dev->spt[c][h]; s++) {
+                const pcjs_sector_t *sector = &dev->sectors[c][h][s];
+
+                if ((fwrite(sector, 1, sizeof(pcjs_sector_t), fp) != sizeof(pcjs_sector_t))
+                    || (fwrite(sector->data, 1, sector->size, fp) != sector->size)) {
+                    pcjs_log("PCJS: Failed to write cache file\n");
+                    fclose(fp);
+                    return;
+                }
+            }
+        }
+    }
+
+    fclose(fp);
+}
+
 static int
-pcjs_load_image(pcjs_t *dev)
+pcjs_load_image(int drive, pcjs_t *dev)
 {
+    uint64_t crc;
+    int      ret;
+
     if (dev->fp == NULL) {
         pcjs_log("No file loaded!\n");
         return 1;
@@ -599,7 +756,17 @@ pcjs_load_image(pcjs_t *dev)
     dev->current_track = 0;
     dev->current_side = 0;
 
-    return json_parse(dev);
+    /* A cache hit replaces the json parse - the expensive part of the
+       mount - with one sequential read of the sidecar file. */
+    crc = pcjs_calc_crc64(dev->fp);
+    if (pcjs_cache_load(drive, dev, crc))
+        return 0;
+
+    ret = json_parse(dev);
+    if (ret == 0)
+        pcjs_cache_save(drive, dev, crc);
+
+    return ret;
 }
 
 void
@@ -633,7 +800,7 @@ pcjs_load(int drive, char *fn)
     images[drive] = dev;
 
     /* Parse and load the information from the json file */
-    if (pcjs_load_image(dev)) {
+    if (pcjs_load_image(drive, dev)) {
         pcjs_log("Failed to initialize: %s\n", pcjs_errmsg());
         (void) fclose(dev->fp);
         free(dev);
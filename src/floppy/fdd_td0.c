@@ -42,9 +42,11 @@
 #include <86box/fdd_86f.h>
 #include <86box/fdd_td0.h>
 #include <86box/fdc.h>
+#include "../crcspeed/crc64speed.h"
 
-#define BUFSZ         512 /* new input buffer */
-#define TD0_MAX_BUFSZ (1024UL * 1024UL * 4UL)
+#define BUFSZ           512 /* new input buffer */
+#define TD0_MAX_BUFSZ   (1024UL * 1024UL * 4UL)
+#define TD0_CACHE_MAGIC 0x43304454UL /* "TD0C" */
 
 /* LZSS Parameters */
 #define N         4096 /* Size of string buffer */
@@ -592,6 +594,84 @@ get_raw_tsize(int side_flags, int slower_rpm)
     return size;
 }
 
+/* Calculate the CRC64 of the compressed source file, which keys the sidecar
+   cache of decompressed data. */
+static uint64_t
+td0_calc_crc64(FILE *fp, uint32_t file_size)
+{
+    uint8_t  buf[4096];
+    uint64_t crc = 0x0000000000000000ULL;
+    size_t   n;
+
+    fseek(fp, 0, SEEK_SET);
+    while (file_size > 0) {
+        n = (file_size > sizeof(buf)) ? sizeof(buf) : file_size;
+        if (fread(buf, 1, n, fp) != n)
+            break;
+        crc = crc64speed_auto(crc, buf, n);
+        file_size -= n;
+    }
+
+    return crc;
+}
+
+/* Read the decompressed image data back from the sidecar cache, if one exists
+   and matches the source file. Returns the data length on a hit, 0 on a miss. */
+static uint32_t
+td0_cache_load(int drive, uint64_t crc)
+{
+    td0_t   *dev = td0[drive];
+    char     cache_fn[1040];
+    uint8_t  header[16];
+    uint32_t len;
+    FILE    *fp;
+
+    snprintf(cache_fn, sizeof(cache_fn), "%sc", floppyfns[drive]);
+    fp = plat_fopen(cache_fn, "rb");
+    if (fp == NULL)
+        return 0;
+
+    if ((fread(header, 1, 16, fp) != 16) || (*(uint32_t *) &header[0] != TD0_CACHE_MAGIC) || (*(uint64_t *) &header[8] != crc)) {
+        fclose(fp);
+        return 0;
+    }
+
+    len = *(uint32_t *) &header[4];
+    if ((len > TD0_MAX_BUFSZ) || (fread(dev->imagebuf, 1, len, fp) != len)) {
+        fclose(fp);
+        return 0;
+    }
+
+    fclose(fp);
+    td0_log("TD0: Loaded decompressed data from cache\n");
+    return len;
+}
+
+/* Save the freshly decompressed image data to the sidecar cache. Failure is
+   not an error - the image may simply live on read-only media. */
+static void
+td0_cache_save(int drive, uint64_t crc, uint32_t len)
+{
+    const td0_t *dev = td0[drive];
+    char         cache_fn[1040];
+    uint8_t      header[16];
+    FILE        *fp;
+
+    snprintf(cache_fn, sizeof(cache_fn), "%sc", floppyfns[drive]);
+    fp = plat_fopen(cache_fn, "wb");
+    if (fp == NULL)
+        return;
+
+    *(uint32_t *) &header[0] = TD0_CACHE_MAGIC;
+    *(uint32_t *) &header[4] = len;
+    *(uint64_t *) &header[8] = crc;
+
+    if ((fwrite(header, 1, 16, fp) != 16) || (fwrite(dev->imagebuf, 1, len, fp) != len))
+        td0_log("TD0: Failed to write cache file\n");
+
+    fclose(fp);
+}
+
 static int
 td0_initialize(int drive)
 {
@@ -651,10 +731,15 @@ td0_initialize(int drive)
 
     if (header[0] == 't') {
         td0_log("TD0: File is compressed\n");
-        disk_decode.fdd_file = dev->fp;
-        state_init_Decode(&disk_decode);
-        disk_decode.fdd_file_offset = 12;
-        state_Decode(&disk_decode, dev->imagebuf, TD0_MAX_BUFSZ);
+        /* Decompression dominates the mount time, so the decompressed data is
+           kept in a sidecar cache keyed by the source file's CRC64. */
+        uint64_t crc = td0_calc_crc64(dev->fp, file_size);
+        if (!td0_cache_load(drive, crc)) {
+            disk_decode.fdd_file = dev->fp;
+            state_init_Decode(&disk_decode);
+            disk_decode.fdd_file_offset = 12;
+            td0_cache_save(drive, crc, state_Decode(&disk_decode, dev->imagebuf, TD0_MAX_BUFSZ));
+        }
     } else {
         td0_log("TD0: File is uncompressed\n");
         if (fseek(dev->fp, 12, SEEK_SET) == -1)
@@ -33,6 +33,7 @@
 #else
 #    include <unistd.h>
 #    include <arpa/inet.h>
+#    include <netinet/tcp.h>
 #    include <sys/socket.h>
 #    include <errno.h>
 #endif
@@ -122,11 +123,12 @@ typedef struct _gdbstub_client_ {
     int                socket;
     struct sockaddr_in addr;
 
-    char    packet[16384], response[16384];
+    char    packet[16384], response[16384], sendbuf[16384 + 8];
     uint8_t has_packet : 1;
     uint8_t first_packet_received : 1;
     uint8_t ida_mode : 1;
     uint8_t waiting_stop : 1;
+    uint8_t no_ack_mode : 1;
     int     packet_pos;
     int     response_pos;
 
@@ -636,10 +638,18 @@ gdbstub_client_respond(gdbstub_client_t *client)
     gdbstub_log("GDB Stub: Sending response: %s\n", client->response);
     client->response[994] = i;
 #endif
-    send(client->socket, "$", 1, 0);
-    send(client->socket, client->response, client->response_pos, 0);
-    char response_cksum[3] = { '#', gdbstub_hex_encode((checksum >> 4) & 0x0f), gdbstub_hex_encode(checksum & 0x0f) };
-    send(client->socket, response_cksum, sizeof(response_cksum), 0);
+    /* Assemble the whole response and send it in a single call, so it
+       goes out as one segment instead of three. */
+    client->sendbuf[0] = '$';
+    memcpy(&client->sendbuf[1], client->response, client->response_pos);
+    client->sendbuf[client->response_pos + 1] = '#';
+    client->sendbuf[client->response_pos + 2] = gdbstub_hex_encode((checksum >> 4) & 0x0f);
+    client->sendbuf[client->response_pos + 3] = gdbstub_hex_encode(checksum & 0x0f);
+    send(client->socket, client->sendbuf, client->response_pos + 4, 0);
+
+    /* No acknowledgement will come in no-ack mode; allow the next response right away. */
+    if (client->no_ack_mode)
+        thread_set_event(client->response_event);
 }
 
 static void
@@ -787,7 +797,8 @@ gdbstub_client_packet(gdbstub_client_t *client)
     gdbstub_log("GDB Stub: Received packet: %s\n", client->packet);
     client->packet[996] = i;
 #endif
-    send(client->socket, "+", 1, 0);
+    if (!client->no_ack_mode)
+        send(client->socket, "+", 1, 0);
 
     /* Block other responses from being written while this one (if any is produced) isn't acknowledged. */
     if ((client->packet[0] != 'c') && (client->packet[0] != 's') && (client->packet[0] != 'v')) {
@@ -997,6 +1008,15 @@ e14:
             /* Respond positively. */
             goto ok;
 
+        case 'Q': /* set */
+            /* Drop the per-packet acknowledgement round trip once this
+               response has gone out; the TCP layer is reliable enough. */
+            if (!strcmp(client->packet, "QStartNoAckMode")) {
+                client->no_ack_mode = 1;
+                goto ok;
+            }
+            break;
+
         case 'q': /* query */
             /* Erase response, as we'll use it as a scratch buffer. */
             memset(client->response, 0, sizeof(client->response));
@@ -1024,7 +1044,7 @@ e14:
                 /* Add our supported features to the end. */
                 if (client->response_pos < (sizeof(client->response) - 1))
                     client->response_pos += snprintf(&client->response[client->response_pos], sizeof(client->response) - client->response_pos,
-                                                     "PacketSize=%X;swbreak+;hwbreak+;qXfer:features:read+", (int) (sizeof(client->packet) - 1));
+                                                     "PacketSize=%X;swbreak+;hwbreak+;qXfer:features:read+;QStartNoAckMode+", (int) (sizeof(client->packet) - 1));
                 break;
             } else if (!strcmp(client->response, "Xfer")) {
                 /* Read the transfer object. */
@@ -1541,32 +1561,58 @@ gdbstub_client_thread(void *priv)
                     gdbstub_break();
                     break;
 
-                default:
+                default: {
                     /* Wait for any existing packets to be processed, just in case. */
                     thread_wait_event(client->processed_event, -1);
 
-                    if (client->packet_pos < (sizeof(client->packet) - 1)) {
-                        /* Append byte to the packet. */
-                        client->packet[client->packet_pos++] = buf[i];
+                    /* Gather the longest run of payload bytes so they can be appended
+                       in one go; control bytes take the cases above on the next pass. */
+                    ssize_t run = i + 1;
+                    while ((run < bytes_read) && (buf[run] != '$') && (buf[run] != '-') && (buf[run] != '+') && (buf[run] != 0x03))
+                        run++;
+
+                    int chunk = run - i;
+                    int space = (int) (sizeof(client->packet) - 1) - client->packet_pos;
+                    if (chunk > space)
+                        chunk = space;
+
+                    if (chunk > 0) {
+                        /* Append the run to the packet. */
+                        int prev_pos = client->packet_pos;
+                        memcpy(&client->packet[client->packet_pos], &buf[i], chunk);
+                        client->packet_pos += chunk;
+
+                        /* Check if we're at the end of a packet. Nothing but control
+                           bytes can follow a checksum, so the terminator can only sit
+                           at the end of the run. */
+                        int pp = (prev_pos > 2) ? (prev_pos + 1) : 3;
+                        for (; pp <= client->packet_pos; pp++) {
+                            if (client->packet[pp - 3] != '#') /* packet checksum start */
+                                continue;
+                            client->packet_pos = pp;
 
-                        /* Check if we're at the end of a packet. */
-                        if ((client->packet_pos >= 3) && (client->packet[client->packet_pos - 3] == '#')) { /* packet checksum start */
                             /* Small hack to speed up IDA instruction trace mode. */
                             if (*((uint32_t *) client->packet) == ('H' | ('c' << 8) | ('1' << 16) | ('#' << 24))) {
                                 /* Send pre-computed response. */
-                                send(client->socket, "+$OK#9A", 7, 0);
-
-                                /* Skip processing. */
-                                continue;
+                                if (client->no_ack_mode)
+                                    send(client->socket, "$OK#9a", 6, 0);
+                                else
+                                    send(client->socket, "+$OK#9A", 7, 0);
+                                break;
                             }
 
                             /* Flag that a packet should be processed. */
                             client->packet[client->packet_pos] = '\0';
                             thread_reset_event(client->processed_event);
                             gdbstub_next_asap = client->has_packet = 1;
+                            break;
                         }
                     }
+
+                    /* The loop increment brings us to the next control byte. */
+                    i = run - 1;
                     break;
+                }
             }
         }
     }
@@ -1632,6 +1678,10 @@ gdbstub_server_thread(void *priv)
         if (client->socket < 0)
             break;
 
+        /* Disable Nagle so small responses and acknowledgements go out immediately. */
+        int nodelay = 1;
+        setsockopt(client->socket, IPPROTO_TCP, TCP_NODELAY, (char *) &nodelay, sizeof(nodelay));
+
         /* Add to client list. */
         thread_wait_mutex(client_list_mutex);
         if (first_client) {
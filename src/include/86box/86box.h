@@ -140,6 +140,10 @@ extern uint32_t mem_size;                   /* (C) memory size (Installed on sys
 extern uint32_t isa_mem_size;               /* (C) memory size (ISA Memory Cards) */
 extern int      cpu;                        /* (C) cpu type */
 extern int      cpu_use_dynarec;            /* (C) cpu uses/needs Dyna */
+extern int      dynarec_cache_size;         /* (C) dynarec code cache size (MB), 0 = default */
+extern int      dynarec_max_block_ins;      /* (C) dynarec block instruction limit, 0 = default */
+extern int      dynarec_max_block_bytes;    /* (C) dynarec block guest byte limit, 0 = default */
+extern int      dynarec_idle_skip;          /* (C) dynarec coasts through detected idle poll loops */
 extern int      fpu_type;                   /* (C) fpu type */
 extern int      fpu_softfloat;              /* (C) fpu uses softfloat */
 extern int      time_sync;                  /* (C) enable time sync */
@@ -156,6 +160,9 @@ extern int    fixed_size_x;
 extern int    fixed_size_y;
 extern int    do_auto_pause;                /* (C) Auto-pause the emulator on focus loss */
 extern int    auto_paused;
+extern int    background_speed_cap;         /* (C) Cap emulated speed to this percentage while unfocused */
+extern int    background_balloon;           /* (C) Hand cold guest RAM back to the host while unfocused */
+extern int    pc_in_background;
 extern double mouse_sensitivity;            /* (C) Mouse sensitivity scale */
 #ifdef _Atomic
 extern _Atomic double mouse_x_error;        /* Mouse error accumulator - Y */
@@ -210,6 +217,7 @@ extern void pc_speed_changed(void);
 extern void pc_send_cad(void);
 extern void pc_send_cae(void);
 extern void pc_send_cab(void);
+extern int  pc_governor_elapsed(int elapsed);
 extern void pc_run(void);
 extern void pc_start(void);
 extern void pc_onesec(void);
@@ -0,0 +1,40 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Definitions for the benchmark mode.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#ifndef EMU_BENCH_H
+#define EMU_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int      bench_enabled; /* (O) benchmark mode is active */
+extern char     bench_fn[1024]; /* (O) benchmark report file */
+extern uint64_t bench_run_ms;  /* (O) emulated time to run for */
+
+/* Counters bumped from the subsystems under measurement. */
+extern uint64_t bench_codegen_blocks;
+extern uint64_t bench_audio_underruns;
+extern uint64_t bench_blit_fast;
+extern uint64_t bench_blit_slow;
+
+extern void bench_start(void);
+extern void bench_frame(void);
+extern int  bench_tick(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*EMU_BENCH_H*/
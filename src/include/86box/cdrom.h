@@ -293,6 +293,7 @@ extern void    cdrom_get_q(cdrom_t *dev, uint8_t *buf, int *curtoctrk, uint8_t m
 extern uint8_t cdrom_mitsumi_audio_play(cdrom_t *dev, uint32_t pos, uint32_t len);
 extern int     cdrom_readsector_raw(cdrom_t *dev, uint8_t *buffer, int sector, int ismsf,
                                     int cdrom_sector_type, int cdrom_sector_flags, int *len, uint8_t vendor_type);
+extern int     cdrom_readsector_cooked_batch(cdrom_t *dev, uint8_t *buffer, uint32_t lba, int count);
 extern uint8_t cdrom_read_disc_info_toc(cdrom_t *dev, unsigned char *b, unsigned char track, int type);
 
 extern void cdrom_seek(cdrom_t *dev, uint32_t pos, uint8_t vendor_type);
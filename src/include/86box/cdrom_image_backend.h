@@ -53,6 +53,12 @@ typedef struct track_file_t {
     char  fn[260];
     FILE *fp;
     void *priv;
+
+    /* Read-ahead cache, filled by the binary backend on sequential runs. */
+    uint8_t *cache;
+    uint64_t cache_start;
+    uint64_t cache_len;
+    uint64_t next_seek;
 } track_file_t;
 
 typedef struct track_t {
@@ -95,6 +101,10 @@ extern int  cdi_load_iso(cd_img_t *cdi, const char *filename);
 extern int  cdi_load_cue(cd_img_t *cdi, const char *cuefile);
 extern int  cdi_has_data_track(cd_img_t *cdi);
 extern int  cdi_has_audio_track(cd_img_t *cdi);
+extern void cdi_track_push_back(cd_img_t *cdi, track_t *trk);
+
+/* CHD functions. */
+extern int cdi_load_chd(cd_img_t *cdi, const char *filename);
 
 /* Virtual ISO functions. */
 extern int           viso_read(void *priv, uint8_t *buffer, uint64_t seek, size_t count);
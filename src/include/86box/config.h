@@ -136,6 +136,8 @@ typedef struct config_t {
 
 extern void config_load(void);
 extern void config_save(void);
+extern void config_snapshot(void);
+extern void config_apply(void);
 
 #ifdef EMU_INI_H
 extern ini_t config_get_ini(void);
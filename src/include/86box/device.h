@@ -182,6 +182,11 @@ typedef struct _device_ {
     void (*speed_changed)(void *priv);
     void (*force_redraw)(void *priv);
 
+    /* Savestate support; optional. Both write/read the device's state
+       to/from the stream and return 1 on success, 0 on failure. */
+    int (*save_state)(void *priv, FILE *fp);
+    int (*load_state)(void *priv, FILE *fp);
+
     const device_config_t *config;
 } device_t;
 
@@ -195,6 +200,8 @@ typedef struct device_context_t {
 extern "C" {
 #endif
 
+extern int device_audit;
+
 extern void  device_init(void);
 extern void  device_set_context(device_context_t *c, const device_t *dev, int inst);
 extern void  device_context(const device_t *dev);
@@ -218,6 +225,8 @@ extern int   device_available(const device_t *dev);
 extern int   device_poll(const device_t *dev);
 extern void  device_speed_changed(void);
 extern void  device_force_redraw(void);
+extern int   device_state_save_all(FILE *fp);
+extern int   device_state_load(FILE *fp);
 extern void  device_get_name(const device_t *dev, int bus, char *name);
 extern int   device_has_config(const device_t *dev);
 extern const char *device_get_bios_file(const device_t *dev, const char *internal_name, int file_no);
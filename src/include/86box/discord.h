@@ -27,7 +27,6 @@ extern int  discord_load(void);
 extern void discord_init(void);
 extern void discord_close(void);
 extern void discord_update_activity(int paused);
-extern void discord_run_callbacks(void);
 
 #ifdef __cplusplus
 }
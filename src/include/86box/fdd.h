@@ -32,6 +32,7 @@ extern "C" {
 extern int fdd_swap;
 
 extern void fdd_set_motor_enable(int drive, int motor_enable);
+extern void fdd_poll_advance(int drive, uint32_t bytes);
 extern void fdd_do_seek(int drive, int track);
 extern void fdd_forced_seek(int drive, int track_diff);
 extern void fdd_seek(int drive, int track_diff);
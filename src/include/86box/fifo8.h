@@ -5,6 +5,7 @@ typedef struct Fifo8 {
     /* All fields are private */
     uint8_t *data;
     uint32_t capacity;
+    uint32_t mask;
     uint32_t head;
     uint32_t num;
 } Fifo8;
@@ -16,6 +17,9 @@ typedef struct Fifo8 {
  *
  * Create a FIFO of the specified size. Clients should call fifo8_destroy()
  * when finished using the fifo. The FIFO is initially empty.
+ *
+ * The capacity is rounded up to the next power of two so the ring indices
+ * can be masked rather than divided.
  */
 
 extern void fifo8_create(Fifo8 *fifo, uint32_t capacity);
@@ -92,6 +96,46 @@ extern uint8_t fifo8_pop(Fifo8 *fifo);
  */
 extern const uint8_t *fifo8_pop_buf(Fifo8 *fifo, uint32_t max, uint32_t *num);
 
+/**
+ * fifo8_pop_all:
+ * @fifo: FIFO to pop from
+ * @data: buffer to store popped data
+ * @num: maximum number of bytes to pop
+ *
+ * Pop up to num bytes from the FIFO into the caller's buffer, handling the
+ * ring wrap with at most two memcpys. Unlike fifo8_pop_buf() this always
+ * drains the requested amount when it is available.
+ *
+ * Returns: The number of bytes popped.
+ */
+extern uint32_t fifo8_pop_all(Fifo8 *fifo, uint8_t *data, uint32_t num);
+
+/**
+ * fifo8_peek_buf:
+ * @fifo: FIFO to peek into
+ * @max: maximum number of bytes to peek at
+ * @num: actual number of returned bytes
+ *
+ * Same contract as fifo8_pop_buf() - a pointer to a contiguous run of up to
+ * max bytes directly inside the FIFO backing store - but without consuming
+ * the data. Consumers that hand the run to an interface which may accept
+ * fewer bytes (such as write()) should follow up with fifo8_drop() for the
+ * amount actually taken.
+ *
+ * Returns: A pointer to the peeked data.
+ */
+extern const uint8_t *fifo8_peek_buf(Fifo8 *fifo, uint32_t max, uint32_t *num);
+
+/**
+ * fifo8_drop:
+ * @fifo: FIFO to drop from
+ * @num: number of bytes to drop
+ *
+ * Discard num bytes from the front of the FIFO without copying them. num
+ * must not be greater than the number of bytes in the FIFO.
+ */
+extern void fifo8_drop(Fifo8 *fifo, uint32_t num);
+
 /**
  * fifo8_reset:
  * @fifo: FIFO to reset
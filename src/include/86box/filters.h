@@ -1,146 +1,152 @@
 #ifndef EMU_FILTERS_H
 #define EMU_FILTERS_H
 
+/* The IIR helpers below keep their delay lines in explicit xm1/xm2/ym1/ym2
+   state instead of shifting a sample array on every call, and evaluate
+   the biquad in the same term order as the old shift-register loop so
+   the output is bit-identical.  Coefficients are static const so they
+   live in rodata instead of being rebuilt on the stack per sample. */
+
 #define NCoef 2
 
 /* fc=150Hz */
 static inline float
 adgold_highpass_iir(int c, int i, float NewSample)
 {
-    float ACoef[NCoef + 1] = {
+    static const float ACoef[NCoef + 1] = {
         0.98657437157334349000,
         -1.97314874314668700000,
         0.98657437157334349000
     };
 
-    float BCoef[NCoef + 1] = {
+    static const float BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -1.97223372919758360000,
         0.97261396931534050000
     };
 
-    static float y[2][2][NCoef + 1]; /* output samples */
-    static float x[2][2][NCoef + 1]; /* input samples */
-    int          n;
-
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[c][i][n] = x[c][i][n - 1];
-        y[c][i][n] = y[c][i][n - 1];
-    }
+    static float xm1[2][2];
+    static float xm2[2][2];
+    static float ym1[2][2];
+    static float ym2[2][2];
+    float        out;
 
     /* Calculate the new output */
-    x[c][i][0] = NewSample;
-    y[c][i][0] = ACoef[0] * x[c][i][0];
-    for (n = 1; n <= NCoef; n++)
-        y[c][i][0] += ACoef[n] * x[c][i][n] - BCoef[n] * y[c][i][n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1[c][i] - BCoef[1] * ym1[c][i];
+    out += ACoef[2] * xm2[c][i] - BCoef[2] * ym2[c][i];
 
-    return y[c][i][0];
+    xm2[c][i] = xm1[c][i];
+    xm1[c][i] = NewSample;
+    ym2[c][i] = ym1[c][i];
+    ym1[c][i] = out;
+
+    return out;
 }
 
 /* fc=150Hz */
 static inline float
 adgold_lowpass_iir(int c, int i, float NewSample)
 {
-    float ACoef[NCoef + 1] = {
+    static const float ACoef[NCoef + 1] = {
         0.00009159473951071446,
         0.00018318947902142891,
         0.00009159473951071446
     };
 
-    float BCoef[NCoef + 1] = {
+    static const float BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -1.97223372919526560000,
         0.97261396931306277000
     };
 
-    static float y[2][2][NCoef + 1]; /* output samples */
-    static float x[2][2][NCoef + 1]; /* input samples */
-    int          n;
-
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[c][i][n] = x[c][i][n - 1];
-        y[c][i][n] = y[c][i][n - 1];
-    }
+    static float xm1[2][2];
+    static float xm2[2][2];
+    static float ym1[2][2];
+    static float ym2[2][2];
+    float        out;
 
     /* Calculate the new output */
-    x[c][i][0] = NewSample;
-    y[c][i][0] = ACoef[0] * x[c][i][0];
-    for (n = 1; n <= NCoef; n++)
-        y[c][i][0] += ACoef[n] * x[c][i][n] - BCoef[n] * y[c][i][n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1[c][i] - BCoef[1] * ym1[c][i];
+    out += ACoef[2] * xm2[c][i] - BCoef[2] * ym2[c][i];
+
+    xm2[c][i] = xm1[c][i];
+    xm1[c][i] = NewSample;
+    ym2[c][i] = ym1[c][i];
+    ym1[c][i] = out;
 
-    return y[c][i][0];
+    return out;
 }
 
 /* fc=56Hz */
 static inline float
 adgold_pseudo_stereo_iir(float NewSample)
 {
-    float ACoef[NCoef + 1] = {
+    static const float ACoef[NCoef + 1] = {
         0.00001409030866231767,
         0.00002818061732463533,
         0.00001409030866231767
     };
 
-    float BCoef[NCoef + 1] = {
+    static const float BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -1.98733021473466760000,
         0.98738361004063568000
     };
 
-    static float y[NCoef + 1]; /* output samples */
-    static float x[NCoef + 1]; /* input samples */
-    int          n;
-
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[n] = x[n - 1];
-        y[n] = y[n - 1];
-    }
+    static float xm1;
+    static float xm2;
+    static float ym1;
+    static float ym2;
+    float        out;
 
     /* Calculate the new output */
-    x[0] = NewSample;
-    y[0] = ACoef[0] * x[0];
-    for (n = 1; n <= NCoef; n++)
-        y[0] += ACoef[n] * x[n] - BCoef[n] * y[n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1 - BCoef[1] * ym1;
+    out += ACoef[2] * xm2 - BCoef[2] * ym2;
+
+    xm2 = xm1;
+    xm1 = NewSample;
+    ym2 = ym1;
+    ym1 = out;
 
-    return y[0];
+    return out;
 }
 
 /* fc=3.2kHz - probably incorrect */
 static inline float
 dss_iir(float NewSample)
 {
-    float ACoef[NCoef + 1] = {
+    static const float ACoef[NCoef + 1] = {
         0.03356837051492005100,
         0.06713674102984010200,
         0.03356837051492005100
     };
 
-    float BCoef[NCoef + 1] = {
+    static const float BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -1.41898265221812010000,
         0.55326988968868285000
     };
 
-    static float y[NCoef + 1]; /* output samples */
-    static float x[NCoef + 1]; /* input samples */
-    int          n;
-
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[n] = x[n - 1];
-        y[n] = y[n - 1];
-    }
+    static float xm1;
+    static float xm2;
+    static float ym1;
+    static float ym2;
+    float        out;
 
     /* Calculate the new output */
-    x[0] = NewSample;
-    y[0] = ACoef[0] * x[0];
-    for (n = 1; n <= NCoef; n++)
-        y[0] += ACoef[n] * x[n] - BCoef[n] * y[n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1 - BCoef[1] * ym1;
+    out += ACoef[2] * xm2 - BCoef[2] * ym2;
 
-    return y[0];
+    xm2 = xm1;
+    xm1 = NewSample;
+    ym2 = ym1;
+    ym1 = out;
+
+    return out;
 }
 
 #undef NCoef
@@ -149,33 +155,28 @@ dss_iir(float NewSample)
 static inline float
 dac_iir(int i, float NewSample)
 {
-    float ACoef[NCoef + 1] = {
+    static const float ACoef[NCoef + 1] = {
         0.99901119820285345000,
         -0.99901119820285345000
     };
 
-    float BCoef[NCoef + 1] = {
+    static const float BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -0.99869185905052738000
     };
 
-    static float y[2][NCoef + 1]; /* output samples */
-    static float x[2][NCoef + 1]; /* input samples */
-    int          n;
-
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[i][n] = x[i][n - 1];
-        y[i][n] = y[i][n - 1];
-    }
+    static float xm1[2];
+    static float ym1[2];
+    float        out;
 
     /* Calculate the new output */
-    x[i][0] = NewSample;
-    y[i][0] = ACoef[0] * x[i][0];
-    for (n = 1; n <= NCoef; n++)
-        y[i][0] += ACoef[n] * x[i][n] - BCoef[n] * y[i][n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1[i] - BCoef[1] * ym1[i];
+
+    xm1[i] = NewSample;
+    ym1[i] = out;
 
-    return y[i][0];
+    return out;
 }
 
 #undef NCoef
@@ -185,172 +186,175 @@ dac_iir(int i, float NewSample)
 static inline double
 low_iir(int c, int i, double NewSample)
 {
-    double ACoef[NCoef + 1] = {
+    static const double ACoef[NCoef + 1] = {
         0.00049713569693400649,
         0.00099427139386801299,
         0.00049713569693400649
     };
 
-    double BCoef[NCoef + 1] = {
+    static const double BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -1.93522955470669530000,
         0.93726236021404663000
     };
 
-    static double y[5][2][NCoef + 1]; /* output samples */
-    static double x[5][2][NCoef + 1]; /* input samples */
-    int           n;
-
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[c][i][n] = x[c][i][n - 1];
-        y[c][i][n] = y[c][i][n - 1];
-    }
+    static double xm1[5][2];
+    static double xm2[5][2];
+    static double ym1[5][2];
+    static double ym2[5][2];
+    double        out;
 
     /* Calculate the new output */
-    x[c][i][0] = NewSample;
-    y[c][i][0] = ACoef[0] * x[c][i][0];
-    for (n = 1; n <= NCoef; n++)
-        y[c][i][0] += ACoef[n] * x[c][i][n] - BCoef[n] * y[c][i][n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1[c][i] - BCoef[1] * ym1[c][i];
+    out += ACoef[2] * xm2[c][i] - BCoef[2] * ym2[c][i];
 
-    return y[c][i][0];
+    xm2[c][i] = xm1[c][i];
+    xm1[c][i] = NewSample;
+    ym2[c][i] = ym1[c][i];
+    ym1[c][i] = out;
+
+    return out;
 }
 
 /* fc=350Hz */
 static inline double
 low_cut_iir(int c, int i, double NewSample)
 {
-    double ACoef[NCoef + 1] = {
+    static const double ACoef[NCoef + 1] = {
         0.96839970114733542000,
         -1.93679940229467080000,
         0.96839970114733542000
     };
 
-    double BCoef[NCoef + 1] = {
+    static const double BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -1.93522955471202770000,
         0.93726236021916731000
     };
 
-    static double y[5][2][NCoef + 1]; /* output samples */
-    static double x[5][2][NCoef + 1]; /* input samples */
-    int           n;
-
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[c][i][n] = x[c][i][n - 1];
-        y[c][i][n] = y[c][i][n - 1];
-    }
+    static double xm1[5][2];
+    static double xm2[5][2];
+    static double ym1[5][2];
+    static double ym2[5][2];
+    double        out;
 
     /* Calculate the new output */
-    x[c][i][0] = NewSample;
-    y[c][i][0] = ACoef[0] * x[c][i][0];
-    for (n = 1; n <= NCoef; n++)
-        y[c][i][0] += ACoef[n] * x[c][i][n] - BCoef[n] * y[c][i][n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1[c][i] - BCoef[1] * ym1[c][i];
+    out += ACoef[2] * xm2[c][i] - BCoef[2] * ym2[c][i];
+
+    xm2[c][i] = xm1[c][i];
+    xm1[c][i] = NewSample;
+    ym2[c][i] = ym1[c][i];
+    ym1[c][i] = out;
 
-    return y[c][i][0];
+    return out;
 }
 
 /* fc=3.5kHz */
 static inline double
 high_iir(int c, int i, double NewSample)
 {
-    double ACoef[NCoef + 1] = {
+    static const double ACoef[NCoef + 1] = {
         0.72248704753064896000,
         -1.44497409506129790000,
         0.72248704753064896000
     };
 
-    double BCoef[NCoef + 1] = {
+    static const double BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -1.36640781670578510000,
         0.52352474706139873000
     };
-    static double y[5][2][NCoef + 1]; /* output samples */
-    static double x[5][2][NCoef + 1]; /* input samples */
-    int           n;
 
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[c][i][n] = x[c][i][n - 1];
-        y[c][i][n] = y[c][i][n - 1];
-    }
+    static double xm1[5][2];
+    static double xm2[5][2];
+    static double ym1[5][2];
+    static double ym2[5][2];
+    double        out;
 
     /* Calculate the new output */
-    x[c][i][0] = NewSample;
-    y[c][i][0] = ACoef[0] * x[c][i][0];
-    for (n = 1; n <= NCoef; n++)
-        y[c][i][0] += ACoef[n] * x[c][i][n] - BCoef[n] * y[c][i][n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1[c][i] - BCoef[1] * ym1[c][i];
+    out += ACoef[2] * xm2[c][i] - BCoef[2] * ym2[c][i];
 
-    return y[c][i][0];
+    xm2[c][i] = xm1[c][i];
+    xm1[c][i] = NewSample;
+    ym2[c][i] = ym1[c][i];
+    ym1[c][i] = out;
+
+    return out;
 }
 
 /* fc=3.5kHz */
 static inline double
 high_cut_iir(int c, int i, double NewSample)
 {
-    double ACoef[NCoef + 1] = {
+    static const double ACoef[NCoef + 1] = {
         0.03927726802250377400,
         0.07855453604500754700,
         0.03927726802250377400
     };
 
-    double BCoef[NCoef + 1] = {
+    static const double BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -1.36640781666419950000,
         0.52352474703279628000
     };
-    static double y[5][2][NCoef + 1]; /* output samples */
-    static double x[5][2][NCoef + 1]; /* input samples */
-    int           n;
 
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[c][i][n] = x[c][i][n - 1];
-        y[c][i][n] = y[c][i][n - 1];
-    }
+    static double xm1[5][2];
+    static double xm2[5][2];
+    static double ym1[5][2];
+    static double ym2[5][2];
+    double        out;
 
     /* Calculate the new output */
-    x[c][i][0] = NewSample;
-    y[c][i][0] = ACoef[0] * x[c][i][0];
-    for (n = 1; n <= NCoef; n++)
-        y[c][i][0] += ACoef[n] * x[c][i][n] - BCoef[n] * y[c][i][n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1[c][i] - BCoef[1] * ym1[c][i];
+    out += ACoef[2] * xm2[c][i] - BCoef[2] * ym2[c][i];
+
+    xm2[c][i] = xm1[c][i];
+    xm1[c][i] = NewSample;
+    ym2[c][i] = ym1[c][i];
+    ym1[c][i] = out;
 
-    return y[c][i][0];
+    return out;
 }
 
 /* fc=5.283kHz, gain=-9.477dB, width=0.4845 */
 static inline double
 deemph_iir(int i, double NewSample)
 {
-    double ACoef[NCoef + 1] = {
+    static const double ACoef[NCoef + 1] = {
         0.46035077886318842566,
         -0.28440821191249848754,
         0.03388877229118691936
     };
 
-    double BCoef[NCoef + 1] = {
+    static const double BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -1.05429146278569141337,
         0.26412280202756849290
     };
-    static double y[5][NCoef + 1]; /* output samples */
-    static double x[5][NCoef + 1]; /* input samples */
-    int           n;
 
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[i][n] = x[i][n - 1];
-        y[i][n] = y[i][n - 1];
-    }
+    static double xm1[5];
+    static double xm2[5];
+    static double ym1[5];
+    static double ym2[5];
+    double        out;
 
     /* Calculate the new output */
-    x[i][0] = NewSample;
-    y[i][0] = ACoef[0] * x[i][0];
-    for (n = 1; n <= NCoef; n++)
-        y[i][0] += ACoef[n] * x[i][n] - BCoef[n] * y[i][n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1[i] - BCoef[1] * ym1[i];
+    out += ACoef[2] * xm2[i] - BCoef[2] * ym2[i];
+
+    xm2[i] = xm1[i];
+    xm1[i] = NewSample;
+    ym2[i] = ym1[i];
+    ym1[i] = out;
 
-    return y[i][0];
+    return out;
 }
 
 #undef NCoef
@@ -360,35 +364,35 @@ deemph_iir(int i, double NewSample)
 static inline double
 sb_iir(int c, int i, double NewSample)
 {
-    double ACoef[NCoef + 1] = {
+    static const double ACoef[NCoef + 1] = {
         0.03356837051492005100,
         0.06713674102984010200,
         0.03356837051492005100
     };
 
-    double BCoef[NCoef + 1] = {
+    static const double BCoef[NCoef + 1] = {
         1.00000000000000000000,
         -1.41898265221812010000,
         0.55326988968868285000
     };
 
-    static double y[5][2][NCoef + 1]; /* output samples */
-    static double x[5][2][NCoef + 1]; /* input samples */
-    int           n;
-
-    /* shift the old samples */
-    for (n = NCoef; n > 0; n--) {
-        x[c][i][n] = x[c][i][n - 1];
-        y[c][i][n] = y[c][i][n - 1];
-    }
+    static double xm1[5][2];
+    static double xm2[5][2];
+    static double ym1[5][2];
+    static double ym2[5][2];
+    double        out;
 
     /* Calculate the new output */
-    x[c][i][0] = NewSample;
-    y[c][i][0] = ACoef[0] * x[c][i][0];
-    for (n = 1; n <= NCoef; n++)
-        y[c][i][0] += ACoef[n] * x[c][i][n] - BCoef[n] * y[c][i][n];
+    out = ACoef[0] * NewSample;
+    out += ACoef[1] * xm1[c][i] - BCoef[1] * ym1[c][i];
+    out += ACoef[2] * xm2[c][i] - BCoef[2] * ym2[c][i];
+
+    xm2[c][i] = xm1[c][i];
+    xm1[c][i] = NewSample;
+    ym2[c][i] = ym1[c][i];
+    ym1[c][i] = out;
 
-    return y[c][i][0];
+    return out;
 }
 
 #undef NCoef
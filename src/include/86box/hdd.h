@@ -197,6 +197,7 @@ extern int   hdd_is_valid(int c);
 
 extern void     hdd_image_init(void);
 extern int      hdd_image_load(int id);
+extern void     hdd_image_preload_all(void);
 extern void     hdd_image_seek(uint8_t id, uint32_t sector);
 extern void     hdd_image_read(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer);
 extern int      hdd_image_read_ex(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer);
@@ -204,6 +205,7 @@ extern void     hdd_image_write(uint8_t id, uint32_t sector, uint32_t count, uin
 extern int      hdd_image_write_ex(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer);
 extern void     hdd_image_zero(uint8_t id, uint32_t sector, uint32_t count);
 extern int      hdd_image_zero_ex(uint8_t id, uint32_t sector, uint32_t count);
+extern void     hdd_image_flush(uint8_t id);
 extern uint32_t hdd_image_get_last_sector(uint8_t id);
 extern uint32_t hdd_image_get_pos(uint8_t id);
 extern uint8_t  hdd_image_get_type(uint8_t id);
@@ -48,6 +48,8 @@
 #define MACHINE_BUS_USB       0x00040000 /* sys has USB bus */
 #define MACHINE_BUS_AGP       0x00080000 /* sys has AGP bus */
 #define MACHINE_BUS_AC97      0x00100000 /* sys has AC97 bus (ACR/AMR/CNR slot) */
+#define MACHINE_BUS_KBC_TIMED 0x00200000 /* system BIOS depends on timed keyboard
+                                            controller command delivery */
 /* Aliases. */
 #define MACHINE_CASSETTE    (MACHINE_BUS_CASSETTE)  /* sys has cassette port */
 #define MACHINE_CARTRIDGE   (MACHINE_BUS_CARTRIDGE) /* sys has two cartridge bays */
@@ -351,6 +353,8 @@ extern void *                 machine_snd;
 /* Core functions. */
 extern int         machine_count(void);
 extern int         machine_available(int m);
+extern void        machine_scan_start(void);
+extern void        machine_scan_wait(void);
 extern const char *machine_getname(void);
 extern const char *machine_getname_ex(int m);
 extern const char *machine_get_internal_name(void);
@@ -4,10 +4,14 @@
 typedef struct dev_status_empty_active_t {
     atomic_bool_t empty;
     atomic_bool_t active;
+    /* Latched by every activity pulse and consumed by the UI poll, so
+       activity shorter than the poll interval still blinks the icon. */
+    atomic_bool_t was_active;
 } dev_status_empty_active_t;
 
 typedef struct dev_status_active_t {
     atomic_bool_t active;
+    atomic_bool_t was_active;
 } dev_status_active_t;
 
 typedef struct dev_status_empty_t {
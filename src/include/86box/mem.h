@@ -215,9 +215,6 @@ typedef struct page_t {
 
     uint16_t block, block_2;
 
-    /*Head of codeblock tree associated with this page*/
-    uint16_t head;
-
     uint64_t code_present_mask;
     uint64_t dirty_mask;
 
@@ -408,10 +405,24 @@ extern uint8_t  mem_readb_phys(uint32_t addr);
 extern uint16_t mem_readw_phys(uint32_t addr);
 extern uint32_t mem_readl_phys(uint32_t addr);
 extern void     mem_read_phys(void *dest, uint32_t addr, int tranfer_size);
+/* Host pointer for a [addr, addr+len) physical range with a direct exec
+   mapping, or NULL when the range crosses a granularity block or is backed
+   by MMIO; callers must fall back to the per-unit accessors on NULL. */
+extern uint8_t *mem_read_phys_ptr(uint32_t addr, uint32_t len);
+/* Copy an arbitrary [addr, addr+len) physical range into dest, resolving
+   the mapping once per granularity block and falling back to per-byte
+   accesses over MMIO. */
+extern void     mem_read_phys_buf(void *dest, uint32_t addr, uint32_t len);
 extern void     mem_writeb_phys(uint32_t addr, uint8_t val);
 extern void     mem_writew_phys(uint32_t addr, uint16_t val);
 extern void     mem_writel_phys(uint32_t addr, uint32_t val);
 extern void     mem_write_phys(void *src, uint32_t addr, int tranfer_size);
+/* Write-side counterpart of mem_read_phys_ptr; the caller is responsible
+   for invalidating the written range. */
+extern uint8_t *mem_write_phys_ptr(uint32_t addr, uint32_t len);
+/* Block counterpart of mem_writeb_phys; like it, leaves any invalidation
+   of the written range to the caller. */
+extern void     mem_write_phys_buf(const void *src, uint32_t addr, uint32_t len);
 
 extern uint8_t  mem_read_ram(uint32_t addr, void *priv);
 extern uint16_t mem_read_ramw(uint32_t addr, void *priv);
@@ -436,6 +447,21 @@ extern void mem_invalidate_range(uint32_t start_addr, uint32_t end_addr);
 extern void mem_write_ramb_page(uint32_t addr, uint8_t val, page_t *page);
 extern void mem_write_ramw_page(uint32_t addr, uint16_t val, page_t *page);
 extern void mem_write_raml_page(uint32_t addr, uint32_t val, page_t *page);
+
+/*Dirty-page tracking over emulated RAM, built on the same write paths the
+  dynarec uses for self-modifying code detection. A registered client gets
+  every RAM page recorded the first time it is written after the client
+  last collected, so consumers (savestate diffing, incremental memory
+  inspectors) visit O(dirty) pages instead of scanning all of RAM.
+  mem_dirty_get() hands back the accumulated page list and rearms the
+  tracking; the list is only valid until emulation resumes. Register after
+  machine init; a hard reset reallocates RAM and resets the tracking, so
+  callers must treat it as everything-dirty.*/
+#define MEM_DIRTY_MAX_CLIENTS 8
+
+extern int      mem_dirty_register(void);
+extern void     mem_dirty_unregister(int client);
+extern uint32_t mem_dirty_get(int client, const uint32_t **dirty_pages);
 extern void mem_flush_write_page(uint32_t addr, uint32_t virt);
 
 extern void mem_reset_page_blocks(void);
@@ -458,6 +484,27 @@ extern void umc_smram_recalc(uint32_t start, int set);
 extern mem_mapping_t *read_mapping[MEM_MAPPINGS_NO];
 extern mem_mapping_t *write_mapping[MEM_MAPPINGS_NO];
 
+/*Flattened per-page dispatch tables: the handlers and priv of the mapping
+  that owns each 4K page, kept contiguous so the CPU access paths resolve
+  with one indexed load instead of chasing through mem_mapping_t. Rebuilt
+  by mem_mapping_recalc() alongside read_mapping[]/write_mapping[].*/
+typedef struct mem_page_read_t {
+    uint8_t (*read_b)(uint32_t addr, void *priv);
+    uint16_t (*read_w)(uint32_t addr, void *priv);
+    uint32_t (*read_l)(uint32_t addr, void *priv);
+    void *priv;
+} mem_page_read_t;
+
+typedef struct mem_page_write_t {
+    void (*write_b)(uint32_t addr, uint8_t val, void *priv);
+    void (*write_w)(uint32_t addr, uint16_t val, void *priv);
+    void (*write_l)(uint32_t addr, uint32_t val, void *priv);
+    void *priv;
+} mem_page_write_t;
+
+extern mem_page_read_t  read_page_ops[MEM_MAPPINGS_NO];
+extern mem_page_write_t write_page_ops[MEM_MAPPINGS_NO];
+
 #ifdef EMU_CPU_H
 static __inline uint32_t
 get_phys(uint32_t addr)
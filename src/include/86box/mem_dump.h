@@ -0,0 +1,41 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Definitions for the online guest RAM dump facility.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#ifndef EMU_MEM_DUMP_H
+#define EMU_MEM_DUMP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Non-zero while a dump is streaming in the background. Read lock-free
+   on the memory write path; only mem_dump.c writes it. */
+extern int mem_dump_active;
+
+/* Start a background dump of the emulated address space to a gzip file.
+   Call with the emulated machine paused; emulation can be resumed as
+   soon as this returns. fn may be NULL for a timestamped file in
+   usr_path. Returns 0 on success, -1 if a dump is already running or
+   the output file cannot be created. */
+extern int mem_dump_start(const char *fn);
+
+/* Called from mem.c's write funnel before a store lands on a page, to
+   let an in-flight dump copy the page's pre-write contents. */
+extern void mem_dump_cow(uint32_t page);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*EMU_MEM_DUMP_H*/
@@ -112,6 +112,9 @@ typedef struct mo_drive_t {
     FILE *fp;
     void *priv;
 
+    uint8_t *map; /* Mapping of the image, when the host can provide one. */
+    uint64_t map_size;
+
     char image_path[1024];
     char prev_image_path[1024];
 
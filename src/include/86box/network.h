@@ -47,6 +47,14 @@
 #define EMU_NETWORK_H
 #include <stdint.h>
 
+#ifdef __cplusplus
+#include <atomic>
+using atomic_int  = std::atomic_int;
+using atomic_uint = std::atomic_uint;
+#else
+#include <stdatomic.h>
+#endif
+
 /* Network provider types. */
 #define NET_TYPE_NONE  0 /* use the null network driver */
 #define NET_TYPE_SLIRP 1 /* use the SLiRP port forwarder */
@@ -107,10 +115,13 @@ typedef struct netpkt {
     int      len;
 } netpkt_t;
 
+/* Lock-free single-producer/single-consumer ring: the producer only writes
+   head, the consumer only writes tail. */
 typedef struct netqueue_t {
-    netpkt_t packets[NET_QUEUE_LEN];
-    int      head;
-    int      tail;
+    netpkt_t    packets[NET_QUEUE_LEN];
+    atomic_int  head;
+    atomic_int  tail;
+    atomic_uint dropped;
 } netqueue_t;
 
 typedef struct _netcard_t netcard_t;
@@ -130,13 +141,12 @@ extern const netdrv_t net_null_drv;
 struct _netcard_t {
     const device_t *device;
     void           *card_drv;
+    const uint8_t  *mac;
     struct netdrv_t host_drv;
     NETRXCB         rx;
     NETSETLINKSTATE set_link_state;
     netqueue_t      queues[NET_QUEUE_COUNT];
     netpkt_t        queued_pkt;
-    mutex_t        *tx_mutex;
-    mutex_t        *rx_mutex;
     pc_timer_t      timer;
     uint16_t        card_num;
     double          byte_period;
@@ -177,6 +187,7 @@ extern netcard_t *network_attach(void *card_drv, uint8_t *mac, NETRXCB rx, NETSE
 extern void       netcard_close(netcard_t *card);
 extern void       network_close(void);
 extern void       network_reset(void);
+extern void       network_reattach(int id);
 extern int        network_available(void);
 extern void       network_tx(netcard_t *card, uint8_t *, int);
 
@@ -201,6 +212,14 @@ extern int network_tx_popv(netcard_t *card, netpkt_t *pkt_vec, int vec_size);
 extern int network_rx_put(netcard_t *card, uint8_t *bufp, int len);
 extern int network_rx_put_pkt(netcard_t *card, netpkt_t *pkt);
 
+extern uint32_t network_queue_depth(netqueue_t *queue);
+extern uint32_t network_queue_dropped(netqueue_t *queue);
+
+/* Shared frame buffer pool; buffers up to NET_MAX_FRAME are cache-line
+   aligned, recycled and interchangeable with the queue slot buffers. */
+extern uint8_t *netbuf_alloc(int len);
+extern void     netbuf_free(uint8_t *buf);
+
 #ifdef EMU_DEVICE_H
 /* 3Com Etherlink */
 extern const device_t threec501_device;
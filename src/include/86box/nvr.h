@@ -110,6 +110,7 @@ extern int   nvr_load(void);
 extern void  nvr_close(void);
 extern void  nvr_set_ven_save(void (*ven_save)(void));
 extern int   nvr_save(void);
+extern void  nvr_save_async(void);
 
 extern int  nvr_is_leap(int year);
 extern int  nvr_get_days(int month, int year);
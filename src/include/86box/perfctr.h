@@ -0,0 +1,65 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Definitions for the always-on performance counters.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#ifndef EMU_PERFCTR_H
+#define EMU_PERFCTR_H
+
+enum {
+    PERF_MMU_FLUSH = 0,   /* mem.c: MMU lookup cache flushes */
+    PERF_MMU_LOOKUP_FILL, /* mem.c: lookup fills, i.e. fast-path misses */
+    PERF_BLOCK_MISS,      /* 386_dynarec.c: codeblock hash misses */
+    /* Block former exit survey; the next four stay in BLOCK_EXIT_* order
+       so 386_dynarec.c can index them with the exit reason. */
+    PERF_BLOCK_EXIT_BRANCH,     /* blocks ended by a branch/serialising op */
+    PERF_BLOCK_EXIT_PAGE_CROSS, /* blocks ended at the guest byte limit */
+    PERF_BLOCK_EXIT_FLAG,       /* blocks ended at a trap/interrupt boundary */
+    PERF_BLOCK_EXIT_CAPACITY,   /* blocks ended at the instruction count limit */
+    PERF_IDLE_BLOCK,      /* codegen_block.c: blocks classified as idle polls */
+    PERF_IDLE_SKIP,       /* 386_dynarec.c: slices coasted in an idle poll */
+    PERF_TIMER_DEPTH,     /* timer.c: current timer queue depth (gauge) */
+    PERF_FIFO_STALL,      /* vid_voodoo_fifo.c: CPU stalls on a full FIFO */
+    PERF_NET_DROP,        /* network.c: packets dropped on a full queue */
+    PERF_BLIT_SPAN,       /* vid_mga.c: blit rows done as batched spans */
+    PERF_BLIT_PIXEL,      /* vid_mga.c: blit rows done per pixel */
+    PERF_MAX
+};
+
+#ifndef __cplusplus
+/* Each cell is padded out to its own cache line and written by the one
+   thread that owns the hot path it instruments; readers take unfenced
+   snapshots, which is fine for monitoring. */
+typedef struct perf_counter_t {
+    uint64_t val;
+    uint8_t  pad[56];
+} perf_counter_t;
+
+extern perf_counter_t perf_counters[PERF_MAX];
+
+#    define PERF_INC(i)    perf_counters[i].val++
+#    define PERF_SET(i, v) perf_counters[i].val = (v)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint64_t    perf_read(int i);
+extern const char *perf_label(int i);
+extern void        perf_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*EMU_PERFCTR_H*/
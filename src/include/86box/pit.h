@@ -68,6 +68,11 @@ typedef struct PIT {
     int        clock;
     pc_timer_t callback_timer;
 
+    /* Fast-forward window over steady counter stretches - see pit.c. */
+    int      skip_active;
+    uint32_t skip_total;
+    uint32_t skip_done;
+
     ctr_t counters[3];
 
     uint8_t ctrl;
@@ -148,6 +148,29 @@ extern int      plat_dir_check(char *path);
 extern int      plat_dir_create(char *path);
 extern void    *plat_mmap(size_t size, uint8_t executable);
 extern void     plat_munmap(void *ptr, size_t size);
+/* Shared mapping of the first size bytes of an open file, or NULL if the
+   host cannot map it; flushes are asynchronous. */
+extern void    *plat_mmap_file(FILE *fp, uint64_t size, uint8_t readonly);
+extern void     plat_msync_file(void *ptr, uint64_t size);
+extern void     plat_munmap_file(void *ptr, uint64_t size);
+/* Deallocate a range of an open file so it reads back as zeroes; returns
+   0 if the host cannot, in which case the caller must write zeroes. */
+extern int      plat_fpunch(FILE *fp, uint64_t offset, uint64_t size);
+/* Grow an open file to size bytes without writing the intervening
+   zeroes; returns 0 if the host cannot, in which case the caller must
+   write them out. */
+extern int      plat_fextend(FILE *fp, uint64_t size);
+/* Hint the host to reclaim a cold anonymous range; contents are preserved
+   and fault back in on access. No-op where the host cannot. */
+extern void     plat_balloon_out(void *ptr, size_t size);
+/* Host-wide read-mostly data cache keyed by content hash: the first
+   instance to map a key gets a writable view back with *fill set and must
+   call plat_shared_seal() once the data is in place; later instances get
+   a copy-on-write view of the already filled object. Returns NULL if the
+   host cannot share, in which case the caller keeps a private buffer. */
+extern void    *plat_shared_map(uint64_t key, uint64_t size, int *fill);
+extern void    *plat_shared_seal(void *ptr, uint64_t size);
+extern void     plat_shared_unmap(void *ptr, uint64_t size);
 extern uint64_t plat_timer_read(void);
 extern uint32_t plat_get_ticks(void);
 extern void     plat_delay_ms(uint32_t count);
@@ -160,6 +183,7 @@ extern void     plat_resize_request(int x, int y, int monitor_index);
 extern uint32_t plat_language_code(char *langcode);
 extern void     plat_language_code_r(uint32_t lcid, char *outbuf, int len);
 extern void     plat_get_cpu_string(char *outbuf, uint8_t len);
+extern int      plat_get_cpu_count(void);
 extern void     plat_set_thread_name(void *thread, const char *name);
 
 /* Resource management. */
@@ -27,6 +27,10 @@ extern "C" {
 
 extern void plat_serpt_write(void *priv, uint8_t data);
 extern int  plat_serpt_read(void *priv, uint8_t *data);
+/* Bulk variants: one host I/O call for a whole batch of bytes.
+   plat_serpt_read_bulk() returns the number of bytes actually read. */
+extern void plat_serpt_write_bulk(void *priv, const uint8_t *data, int len);
+extern int  plat_serpt_read_bulk(void *priv, uint8_t *data, int max);
 extern int  plat_serpt_open_device(void *priv);
 extern void plat_serpt_close(void *priv);
 extern void plat_serpt_set_params(void *priv);
@@ -0,0 +1,43 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Definitions for the rewind subsystem.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#ifndef EMU_REWIND_H
+#define EMU_REWIND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int rewind_enabled; /* (C) continuous checkpointing on/off */
+
+/* Called from the main loop once per emulated 10 ms block; takes a
+   checkpoint every few seconds while enabled. */
+extern void rewind_tick(void);
+
+/* How many checkpoints are available to go back to. */
+extern int rewind_steps_available(void);
+
+/* Restore the machine to the state it was in the given number of
+   checkpoints ago; returns 1 on success. */
+extern int rewind_back(int steps);
+
+/* Drop all checkpoints; must be called whenever the machine or the
+   memory layout changes under the ring (hard reset, state load). */
+extern void rewind_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*EMU_REWIND_H*/
@@ -36,6 +36,7 @@ typedef struct rom_t {
     uint8_t      *rom;
     int           sz;
     uint32_t      mask;
+    uint8_t       shared; /* rom points into the host's shared image cache */
     mem_mapping_t mapping;
 } rom_t;
 
@@ -56,6 +57,8 @@ extern FILE *rom_fopen(const char *fn, char *mode);
 extern int   rom_getfile(char *fn, char *s, int size);
 extern int   rom_present(const char *fn);
 
+extern uint8_t *rom_load_shared(FILE *fp, int off, int sz, uint8_t *shared);
+
 extern int rom_load_linear_oddeven(const char *fn, uint32_t addr, int sz,
                                    int off, uint8_t *ptr);
 extern int rom_load_linear(const char *fn, uint32_t addr, int sz,
@@ -87,4 +90,6 @@ extern int rom_init_interleaved(rom_t *rom, const char *fn_low,
                                 int size, int mask, int file_offset,
                                 uint32_t flags);
 
+extern void rom_dispose(rom_t *rom);
+
 #endif /*EMU_ROM_H*/
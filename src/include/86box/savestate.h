@@ -0,0 +1,42 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Definitions for the savestate subsystem.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#ifndef EMU_SAVESTATE_H
+#define EMU_SAVESTATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Both must be called with emulation stopped (dopause or the config
+   paths); they return 1 on success, 0 on failure. Saving repeatedly to
+   the same file only rewrites the guest RAM pages that changed since
+   the previous save. */
+extern int savestate_save(const char *fn);
+extern int savestate_load(const char *fn);
+
+/* Invalidate the incremental baseline; must be called whenever the
+   machine or the memory layout changes (hard reset). */
+extern void savestate_invalidate(void);
+
+/* Shared with the rewind subsystem. */
+extern int      savestate_write_chunks(FILE *fp);
+extern int      savestate_read_chunks(FILE *fp);
+extern uint8_t *savestate_ram_ptr(uint64_t addr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*EMU_SAVESTATE_H*/
@@ -469,9 +469,10 @@ typedef struct x54x_t {
     /* 8 bytes */
     uint64_t temp_period;
 
-    /* 16 bytes */
+    /* 24 bytes */
     double media_period;
-    double ha_bps; /* bytes per second */
+    double ha_bps;       /* bytes per second */
+    double idle_period;  /* poll interval back-off while no mailbox is armed */
 
     /* 8 bytes */
     char *bios_path;  /* path to BIOS image file */
@@ -24,6 +24,7 @@
 
 #include <86box/86box.h>
 #include <86box/device.h>
+#include <86box/fifo8.h>
 #include <86box/timer.h>
 #include <86box/serial.h>
 
@@ -53,6 +54,10 @@ typedef struct serial_passthrough_s {
     char  host_serial_path[1024];              /* Path to TTY/host serial port on the host */
     char  named_pipe[1024];                    /* (Windows only) Name of the pipe. */
     void *backend_priv;                        /* Private platform backend data */
+    Fifo8 host_to_serial_fifo;                 /* Bytes read from the host in bulk, drained
+                                                * into the UART at the emulated baud rate */
+    Fifo8 serial_to_host_fifo;                 /* Guest transmit bytes batched up and written
+                                                * to the host once per transmit window */
 } serial_passthrough_t;
 
 extern bool           serial_passthrough_enabled[SERIAL_MAX];
@@ -397,6 +397,16 @@ typedef struct emu8k_t {
     int     pos;
     int32_t buffer[WTBUFLEN * 2];
 
+    /* Effects worker: reverb/chorus run as a pipeline stage overlapping
+       voice mixing (see emu8k_update()). thread_t/event_t are void. */
+    void        *fx_thread_h;
+    void        *fx_wake_event;
+    void        *fx_done_event;
+    int          fx_start;
+    int          fx_end;
+    volatile int fx_busy;
+    volatile int fx_closing;
+
     uint16_t addr;
 } emu8k_t;
 
@@ -405,6 +415,8 @@ void emu8k_init(emu8k_t *emu8k, uint16_t emu_addr, int onboard_ram);
 void emu8k_close(emu8k_t *emu8k);
 
 void emu8k_update(emu8k_t *emu8k);
+/* Wait for the effects worker; required before reading the rendered buffer. */
+void emu8k_fx_sync(emu8k_t *emu8k);
 
 #define EMU8K_ROM_PATH "roms/sound/creative/awe32.raw"
 
@@ -43,6 +43,7 @@ typedef struct fm_drv_t {
 } fm_drv_t;
 
 extern uint8_t fm_driver_get(int chip_id, fm_drv_t *drv);
+extern uint8_t fm_driver_get_ex(int chip_id, fm_drv_t *drv, int driver);
 
 extern const fm_drv_t nuked_opl_drv;
 extern const fm_drv_t ymfm_drv;
@@ -50,8 +50,14 @@ typedef struct pc_timer_t {
     void (*callback)(void *priv);
     void *priv;
 
-    struct pc_timer_t *prev;
-    struct pc_timer_t *next;
+    uint32_t qidx; /* 1-based index in the timer queue heap, 0 = not enqueued */
+
+    /* Cost accounting (timer_cost_budget > 0): owning device name and
+       callback cost statistics in host ticks. */
+    const char *dev_name;
+    double      cost_avg; /* exponentially decayed average */
+    double      cost_max;
+    uint32_t    cost_calls;
 } pc_timer_t;
 
 #ifdef __cplusplus
@@ -78,6 +84,14 @@ extern void timer_init(void);
   timestamp - this is useful for permanently enabled timers*/
 extern void timer_add(pc_timer_t *timer, void (*callback)(void *priv), void *priv, int start_timer);
 
+/*Per-callback cost budget in host microseconds; 0 disables the cost
+  accounting altogether. Callbacks exceeding the budget emit a
+  TRACE_TIMER instant event.*/
+extern uint32_t timer_cost_budget;
+
+/*Log the cost table for the currently enabled timers*/
+extern void timer_cost_dump(void);
+
 /*1us in 32:32 format*/
 extern uint64_t TIMER_USEC;
 
@@ -0,0 +1,64 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Runtime-toggleable subsystem tracing on top of minitrace.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#ifndef EMU_TRACE_H
+#define EMU_TRACE_H
+
+#ifdef MTR_ENABLED
+#    include <minitrace/minitrace.h>
+#endif
+
+/* Per-subsystem enable bits; settable at runtime through the
+   "trace_flags" variable in the General config section. */
+#define TRACE_TIMER   0x01
+#define TRACE_CODEGEN 0x02
+#define TRACE_VIDEO   0x04
+#define TRACE_DISK    0x08
+#define TRACE_NET     0x10
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint32_t trace_flags; /* (C) enabled trace subsystems */
+
+#ifdef __cplusplus
+}
+#endif
+
+/* In builds without minitrace these cost nothing; with minitrace
+   compiled in but the subsystem bit clear, a single predicted branch. */
+#ifdef MTR_ENABLED
+#    define TRACE_BEGIN(flag, c, n)        \
+        do {                               \
+            if (trace_flags & (flag))      \
+                MTR_BEGIN(c, n);           \
+        } while (0)
+#    define TRACE_END(flag, c, n)          \
+        do {                               \
+            if (trace_flags & (flag))      \
+                MTR_END(c, n);             \
+        } while (0)
+#    define TRACE_INSTANT(flag, c, n)      \
+        do {                               \
+            if (trace_flags & (flag))      \
+                MTR_INSTANT(c, n);         \
+        } while (0)
+#else
+#    define TRACE_BEGIN(flag, c, n)
+#    define TRACE_END(flag, c, n)
+#    define TRACE_INSTANT(flag, c, n)
+#endif
+
+#endif /*EMU_TRACE_H*/
@@ -30,6 +30,10 @@ typedef struct usb_t {
     int           ohci_enable;
     uint32_t      ohci_mem_base;
     mem_mapping_t ohci_mmio_mapping;
+    uint64_t      uhci_frame_tsc;  /* TSC when the frame counter was (re)based */
+    uint64_t      ohci_frame_tsc;
+    uint16_t      uhci_frame_base; /* frame number at that point */
+    uint16_t      ohci_frame_base;
 } usb_t;
 
 /* Global variables. */
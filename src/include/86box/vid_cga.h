@@ -67,6 +67,11 @@ typedef struct cga_t {
     int snow_enabled;
     int rgb_type;
     int double_type;
+
+    /* Per-scanline snapshot cache; only the standalone device allocates it -
+       cards embedding cga_t switch render paths behind cga_poll's back and
+       must keep rendering every line. */
+    linecache_t *linecache;
 } cga_t;
 
 void    cga_init(cga_t *cga);
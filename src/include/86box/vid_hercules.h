@@ -22,6 +22,10 @@
 #ifndef VIDEO_HERCULES_H
 #define VIDEO_HERCULES_H
 
+/* Per-scanline snapshot bounds - lines outside them always render. */
+#define HERC_SNAP_LINES 512
+#define HERC_SNAP_COLS  128
+
 typedef struct {
     mem_mapping_t mapping;
 
@@ -59,6 +63,16 @@ typedef struct {
 
     int cols[256][2][2];
 
+    /* Snapshot of everything each rendered scanline's pixels derive from,
+       so lines whose inputs match the previous frame can be skipped - the
+       target buffer still holds their final (palette-converted, blended)
+       pixels.  line_gen covers inputs outside the per-cell tuples. */
+    uint32_t line_cells[HERC_SNAP_LINES][HERC_SNAP_COLS];
+    uint32_t line_key[HERC_SNAP_LINES];
+    uint32_t line_vgen[HERC_SNAP_LINES];
+    uint32_t line_gen;
+    int      render_dirty;
+
     uint8_t *vram;
     int      monitor_index;
     int      prev_monitor_index;
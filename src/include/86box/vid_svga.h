@@ -53,6 +53,24 @@ typedef union {
     uint8_t  b[8];
 } latch_t;
 
+/* Per-cell snapshot of everything that determined a text character's pixels
+   on one scanline - used by the text renderers to skip cells whose output
+   cannot have changed since the previous frame. */
+#define SVGA_TEXT_CACHE_COLS  256
+#define SVGA_TEXT_CACHE_LINES 1024
+
+/* Worst case scanlines both hardware cursors can cover in one frame (the
+   largest cursor is the ET4000/W32's 128-line one). */
+#define SVGA_CURSOR_SAVE_LINES 256
+
+typedef struct svga_text_cell_t {
+    uint32_t fg;
+    uint32_t bg;
+    uint8_t  chr;
+    uint8_t  dat;
+    uint8_t  gen;
+} svga_text_cell_t;
+
 typedef struct svga_t {
     mem_mapping_t mapping;
 
@@ -114,6 +132,11 @@ typedef struct svga_t {
     int lastline_draw;
     int displine;
     int fullchange;
+    int frame_unchanged;
+    int text_render_active;
+    int text_render_changed;
+    int render_skipped;
+    int render_skip_count;
     int x_add;
     int y_add;
     int pan;
@@ -161,6 +184,8 @@ typedef struct svga_t {
     uint32_t  overscan_color;
     uint32_t *map8;
     uint32_t  pallook[512];
+    uint8_t   pallook_dirty[256];
+    int       pallook_dirty_count;
 
     PALETTE vgapal;
 
@@ -199,6 +224,18 @@ typedef struct svga_t {
     void (*vblank_start)(struct svga_t *svga);
 
     void (*ven_write)(struct svga_t *svga, uint8_t val, uint32_t addr);
+
+    /* Planar write pipeline for write modes 0-3, installed by
+       svga_recalc_write_handler() whenever a register selecting the
+       write mode, ALU function, bit mask or set/reset state changes -
+       the same pattern the render handler above uses. */
+    void (*plane_write)(struct svga_t *svga, uint32_t addr, uint8_t val, uint32_t writemask2, uint8_t count);
+    void (*plane_alu)(struct svga_t *svga, uint32_t addr, const latch_t *vall, uint32_t writemask2, uint8_t count);
+    /* Address map stage of the write path: one handler per (map, data
+       path) combination, expanded from vid_svga_write.h and installed
+       together with plane_write above. */
+    void (*write_map)(struct svga_t *svga, uint32_t addr, uint8_t val, uint32_t writemask2, uint8_t linear);
+
     float (*getclock)(int clock, void *priv);
     float (*getclock8514)(int clock, void *priv);
 
@@ -224,6 +261,17 @@ typedef struct svga_t {
     uint8_t *vram;
     uint8_t *changedvram;
 
+    svga_text_cell_t *text_cache;
+    uint32_t          text_cache_key;
+    uint8_t           text_cache_gen;
+
+    /* Target buffer pixels saved from under the hardware cursors so the
+       composition can be undone at the start of the next frame instead of
+       forcing the covered lines to re-render. */
+    uint32_t *cursor_save;
+    uint16_t  cursor_save_line[SVGA_CURSOR_SAVE_LINES];
+    uint16_t  cursor_save_count;
+
     uint8_t crtcreg;
     uint8_t gdcaddr;
     uint8_t attrff;
@@ -328,6 +376,8 @@ extern int  svga_init(const device_t *info, svga_t *svga, void *priv, int memsiz
                       void (*hwcursor_draw)(struct svga_t *svga, int displine),
                       void (*overlay_draw)(struct svga_t *svga, int displine));
 extern void svga_recalctimings(svga_t *svga);
+extern void svga_recalc_write_handler(svga_t *svga);
+extern void svga_pallook_flush(svga_t *svga);
 extern void svga_close(svga_t *svga);
 
 uint8_t  svga_read(uint32_t addr, void *priv);
@@ -369,6 +419,7 @@ enum {
 };
 
 uint32_t svga_lookup_lut_ram(svga_t* svga, uint32_t val);
+uint32_t svga_conv_16to32(struct svga_t *svga, uint16_t color, uint8_t bpp);
 
 /* We need a way to add a device with a pointer to a parent device so it can attach itself to it, and
    possibly also a second ATi 68860 RAM DAC type that auto-sets SVGA render on RAM DAC render change. */
@@ -96,6 +96,8 @@ enum {
     FIFO_WRITEL_2DREG = (0x05 << 24)
 };
 
+#define MAX_RENDER_THREADS 8
+
 #define PARAM_SIZE       1024
 #define PARAM_MASK       (PARAM_SIZE - 1)
 #define PARAM_ENTRY_SIZE (1 << 31)
@@ -234,7 +236,7 @@ typedef struct texture_t {
     uint32_t   base;
     uint32_t   tLOD;
     atomic_int refcount;
-    atomic_int refcount_r[4];
+    atomic_int refcount_r[MAX_RENDER_THREADS];
     int        is16;
     uint32_t   palette_checksum;
     uint32_t   addr_start[4];
@@ -362,29 +364,34 @@ typedef struct voodoo_t {
     int    ncc_dirty[2];
 
     thread_t *fifo_thread;
-    thread_t *render_thread[4];
+    thread_t *render_thread[MAX_RENDER_THREADS];
     event_t  *wake_fifo_thread;
     event_t  *wake_main_thread;
     event_t  *fifo_not_full_event;
-    event_t  *render_not_full_event[4];
-    event_t  *wake_render_thread[4];
+    event_t  *render_not_full_event[MAX_RENDER_THREADS];
+    event_t  *wake_render_thread[MAX_RENDER_THREADS];
 
     int voodoo_busy;
-    int render_voodoo_busy[4];
+    int render_voodoo_busy[MAX_RENDER_THREADS];
 
     int render_threads;
     int odd_even_mask;
 
-    int pixel_count[4];
-    int texel_count[4];
+    int pixel_count[MAX_RENDER_THREADS];
+    int texel_count[MAX_RENDER_THREADS];
     int tri_count;
     int frame_count;
-    int pixel_count_old[4];
-    int texel_count_old[4];
+    int pixel_count_old[MAX_RENDER_THREADS];
+    int texel_count_old[MAX_RENDER_THREADS];
     int wr_count;
     int rd_count;
     int tex_count;
 
+    /* Decoded texture cache residency statistics - see voodoo_use_texture(). */
+    int tex_cache_hit[2];
+    int tex_cache_miss[2];
+    int tex_cache_evict[2];
+
     int      retrace_count;
     int      swap_interval;
     uint32_t swap_offset;
@@ -410,7 +417,7 @@ typedef struct voodoo_t {
     atomic_int   cmd_written_fifo;
 
     voodoo_params_t params_buffer[PARAM_SIZE];
-    atomic_int      params_read_idx[4];
+    atomic_int      params_read_idx[MAX_RENDER_THREADS];
     atomic_int      params_write_idx;
 
     uint32_t   cmdfifo_base;
@@ -425,6 +432,8 @@ typedef struct voodoo_t {
     uint32_t   cmdfifo_amin;
     uint32_t   cmdfifo_amax;
     int        cmdfifo_holecount;
+    uint32_t  *cmdfifo_bounce;
+    int        cmdfifo_bounce_size;
 
     atomic_uint cmd_status;
 
@@ -650,7 +659,7 @@ typedef struct voodoo_t {
     int      palette_dirty[2];
 
     uint64_t time;
-    int      render_time[4];
+    int      render_time[MAX_RENDER_THREADS];
 
     int      force_blit_count;
     int      can_blit;
@@ -662,7 +671,7 @@ typedef struct voodoo_t {
     struct voodoo_set_t *set;
 
     uint8_t fifo_thread_run;
-    uint8_t render_thread_run[4];
+    uint8_t render_thread_run[MAX_RENDER_THREADS];
 
     uint8_t *vram;
     uint8_t *changedvram;
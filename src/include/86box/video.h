@@ -123,6 +123,7 @@ typedef struct monitor_t {
     int                      mon_fullchange;
     int                      mon_changeframecount;
     atomic_int               mon_screenshots;
+    atomic_int               mon_frames_skipped; /* Frames dropped because the blitter was still busy. */
     uint32_t                *mon_pal_lookup;
     int                     *mon_cga_palette;
     int                      mon_pal_lookup_static;  /* Whether it should not be freed by the API. */
@@ -247,12 +248,36 @@ extern int         video_is_xga(void);
 extern void        video_inform_monitor(int type, const video_timings_t *ptr, int monitor_index);
 extern int         video_get_type_monitor(int monitor_index);
 
+/* Shared per-scanline snapshot cache for the fixed-function (CGA-class)
+   renderers.  Each rendered line gets a snapshot of everything its pixels
+   derive from: an arbitrary key word plus one tuple per character/byte cell;
+   gen covers inputs outside the per-line snapshots (fonts, palettes, modes).
+   Lines whose snapshot matches the previous frame can be skipped - the
+   target buffer still holds their final pixels. */
+#define LINECACHE_LINES 512
+#define LINECACHE_COLS  128
+
+typedef struct linecache_t {
+    uint32_t cells[LINECACHE_LINES][LINECACHE_COLS];
+    uint32_t key[LINECACHE_LINES];
+    uint32_t vgen[LINECACHE_LINES];
+    uint16_t ncells[LINECACHE_LINES];
+    uint32_t gen;
+    int      dirty; /* at least one line of the current frame was rendered */
+} linecache_t;
+
+extern linecache_t *linecache_alloc(void);
+extern void         linecache_free(linecache_t *lc);
+extern void         linecache_invalidate(linecache_t *lc);
+extern int          linecache_line_changed(linecache_t *lc, int line, uint32_t key, const uint32_t *cells, int ncells);
+
 extern void video_setblit(void (*blit)(int, int, int, int, int));
 extern void video_blend(int x, int y);
 extern void video_blit_memtoscreen_8(int x, int y, int w, int h);
 extern void video_blend_monitor(int x, int y, int monitor_index);
 extern void video_process_8_monitor(int x, int y, int monitor_index);
 extern void video_blit_memtoscreen_monitor(int x, int y, int w, int h, int monitor_index);
+extern int  video_get_render_skip_monitor(int monitor_index);
 extern void video_blit_complete_monitor(int monitor_index);
 extern void video_wait_for_blit_monitor(int monitor_index);
 extern void video_wait_for_buffer_monitor(int monitor_index);
@@ -288,6 +313,7 @@ extern uint32_t video_color_transform(uint32_t color);
 #define video_get_type()                      video_get_type_monitor(0)
 #define video_blend(x, y)                     video_blend_monitor(x, y, monitor_index_global)
 #define video_blit_memtoscreen(x, y, w, h)    video_blit_memtoscreen_monitor(x, y, w, h, monitor_index_global)
+#define video_get_render_skip()               video_get_render_skip_monitor(monitor_index_global)
 #define video_process_8(x, y)                 video_process_8_monitor(x, y, monitor_index_global)
 #define video_blit_complete()                 video_blit_complete_monitor(monitor_index_global)
 #define video_wait_for_blit()                 video_wait_for_blit_monitor(monitor_index_global)
@@ -42,21 +42,40 @@ typedef struct _list_ {
     struct _list_ *next;
 } list_t;
 
+#define SECTION_HASH_SIZE 64
+#define ENTRY_HASH_SIZE   32
+
+typedef struct entry_t {
+    list_t list;
+
+    char     name[128];
+    uint32_t name_hash;
+    char     data[512];
+    wchar_t  wdata[512];
+
+    struct entry_t *hash_next;
+} entry_t;
+
 typedef struct section_t {
     list_t list;
 
-    char name[128];
+    char     name[128];
+    uint32_t name_hash;
 
     list_t entry_head;
+
+    /* Hash index over the lists: the list links keep the write-out
+       order, the buckets make name lookup constant-time. */
+    struct section_t  *hash_next;
+    struct ini_head_t *head;
+    entry_t           *ent_hash[ENTRY_HASH_SIZE];
 } section_t;
 
-typedef struct entry_t {
+typedef struct ini_head_t {
     list_t list;
 
-    char    name[128];
-    char    data[512];
-    wchar_t wdata[512];
-} entry_t;
+    section_t *sec_hash[SECTION_HASH_SIZE];
+} ini_head_t;
 
 #define list_add(new, head)        \
     {                              \
@@ -100,20 +119,81 @@ ini_log(const char *fmt, ...)
 #    define ini_log(fmt, ...)
 #endif
 
+/* FNV-1a hash of a name, stored alongside it so failed lookups compare
+   an integer instead of up to 128 characters. */
+static uint32_t
+hash_name(const char *name)
+{
+    uint32_t hash = 0x811c9dc5;
+
+    while (*name) {
+        hash ^= (uint8_t) *name++;
+        hash *= 0x01000193;
+    }
+
+    return hash;
+}
+
+static void
+section_hash_add(ini_head_t *h, section_t *sec)
+{
+    section_t **bucket = &h->sec_hash[sec->name_hash & (SECTION_HASH_SIZE - 1)];
+
+    sec->hash_next = *bucket;
+    *bucket        = sec;
+}
+
+static void
+section_hash_del(ini_head_t *h, section_t *sec)
+{
+    section_t **bucket = &h->sec_hash[sec->name_hash & (SECTION_HASH_SIZE - 1)];
+
+    while (*bucket && (*bucket != sec))
+        bucket = &(*bucket)->hash_next;
+    if (*bucket)
+        *bucket = sec->hash_next;
+    sec->hash_next = NULL;
+}
+
+static void
+entry_hash_add(section_t *section, entry_t *ent)
+{
+    entry_t **bucket = &section->ent_hash[ent->name_hash & (ENTRY_HASH_SIZE - 1)];
+
+    ent->hash_next = *bucket;
+    *bucket        = ent;
+}
+
+static void
+entry_hash_del(section_t *section, entry_t *ent)
+{
+    entry_t **bucket = &section->ent_hash[ent->name_hash & (ENTRY_HASH_SIZE - 1)];
+
+    while (*bucket && (*bucket != ent))
+        bucket = &(*bucket)->hash_next;
+    if (*bucket)
+        *bucket = ent->hash_next;
+    ent->hash_next = NULL;
+}
+
 static section_t *
 find_section(list_t *head, const char *name)
 {
-    section_t *sec     = (section_t *) head->next;
-    const char blank[] = "";
+    const ini_head_t *h       = (const ini_head_t *) head;
+    const char        blank[] = "";
+    section_t        *sec;
+    uint32_t          hash;
 
     if (name == NULL)
         name = blank;
+    hash = hash_name(name);
 
+    sec = h->sec_hash[hash & (SECTION_HASH_SIZE - 1)];
     while (sec != NULL) {
-        if (!strncmp(sec->name, name, sizeof(sec->name)))
+        if ((sec->name_hash == hash) && !strncmp(sec->name, name, sizeof(sec->name)))
             return sec;
 
-        sec = (section_t *) sec->list.next;
+        sec = sec->hash_next;
     }
 
     return NULL;
@@ -136,22 +216,26 @@ ini_rename_section(ini_section_t section, const char *name)
     if (sec == NULL)
         return;
 
+    section_hash_del(sec->head, sec);
     memset(sec->name, 0x00, sizeof(sec->name));
     memcpy(sec->name, name, MIN(128, strlen(name) + 1));
+    sec->name_hash = hash_name(sec->name);
+    section_hash_add(sec->head, sec);
 }
 
 static entry_t *
 find_entry(section_t *section, const char *name)
 {
     entry_t *ent;
+    uint32_t hash = hash_name(name);
 
-    ent = (entry_t *) section->entry_head.next;
+    ent = section->ent_hash[hash & (ENTRY_HASH_SIZE - 1)];
 
     while (ent != NULL) {
-        if (!strncmp(ent->name, name, sizeof(ent->name)))
+        if ((ent->name_hash == hash) && !strncmp(ent->name, name, sizeof(ent->name)))
             return ent;
 
-        ent = (entry_t *) ent->list.next;
+        ent = ent->hash_next;
     }
 
     return (NULL);
@@ -183,6 +267,7 @@ delete_section_if_empty(list_t *head, section_t *section)
 
     if (entries_num(section) == 0) {
         list_delete(&section->list, head);
+        section_hash_del((ini_head_t *) head, section);
         free(section);
     }
 }
@@ -203,7 +288,10 @@ create_section(list_t *head, const char *name)
 
     memset(ns, 0x00, sizeof(section_t));
     memcpy(ns->name, name, strlen(name) + 1);
+    ns->name_hash = hash_name(ns->name);
+    ns->head      = (ini_head_t *) head;
     list_add(&ns->list, head);
+    section_hash_add(ns->head, ns);
 
     return ns;
 }
@@ -228,7 +316,9 @@ create_entry(section_t *section, const char *name)
 
     memset(ne, 0x00, sizeof(entry_t));
     memcpy(ne->name, name, strlen(name) + 1);
+    ne->name_hash = hash_name(ne->name);
     list_add(&ne->list, &section->entry_head);
+    entry_hash_add(section, ne);
 
     return ne;
 }
@@ -335,13 +425,16 @@ ini_read(const char *fn)
     if (fp == NULL)
         return NULL;
 
-    head = malloc(sizeof(list_t));
-    memset(head, 0x00, sizeof(list_t));
+    head = malloc(sizeof(ini_head_t));
+    memset(head, 0x00, sizeof(ini_head_t));
 
     sec = malloc(sizeof(section_t));
     memset(sec, 0x00, sizeof(section_t));
+    sec->name_hash = hash_name(sec->name);
+    sec->head      = (ini_head_t *) head;
 
     list_add(&sec->list, head);
+    section_hash_add(sec->head, sec);
     if (bom)
         fseek(fp, 3, SEEK_SET);
 
@@ -391,7 +484,10 @@ ini_read(const char *fn)
             ns = malloc(sizeof(section_t));
             memset(ns, 0x00, sizeof(section_t));
             memcpy(ns->name, sname, 128);
+            ns->name_hash = hash_name(ns->name);
+            ns->head      = (ini_head_t *) head;
             list_add(&ns->list, head);
+            section_hash_add(ns->head, ns);
 
             /* New section is now the current one. */
             sec = ns;
@@ -423,6 +519,8 @@ ini_read(const char *fn)
         ne = malloc(sizeof(entry_t));
         memset(ne, 0x00, sizeof(entry_t));
         memcpy(ne->name, ename, 128);
+        ne->name_hash = hash_name(ne->name);
+        entry_hash_add(sec, ne);
         wcsncpy(ne->wdata, &buff[d], sizeof_w(ne->wdata) - 1);
         ne->wdata[sizeof_w(ne->wdata) - 1] = L'\0';
 #ifdef _WIN32 /* Make sure the string is converted to UTF-8 rather than a legacy codepage */
@@ -499,11 +597,101 @@ ini_write(ini_t ini, const char *fn)
 ini_t
 ini_new(void)
 {
-    ini_t ini = malloc(sizeof(list_t));
-    memset(ini, 0, sizeof(list_t));
+    ini_t ini = malloc(sizeof(ini_head_t));
+    memset(ini, 0, sizeof(ini_head_t));
     return ini;
 }
 
+/* Deep copy, preserving section and entry order. */
+ini_t
+ini_clone(ini_t ini)
+{
+    const list_t *list = (const list_t *) ini;
+    ini_t         copy;
+    section_t    *sec;
+
+    if (list == NULL)
+        return NULL;
+
+    copy = ini_new();
+
+    sec = (section_t *) list->next;
+    while (sec != NULL) {
+        section_t *nsec = create_section((list_t *) copy, sec->name);
+        entry_t   *ent  = (entry_t *) sec->entry_head.next;
+
+        while (ent != NULL) {
+            entry_t *nent = create_entry(nsec, ent->name);
+
+            memcpy(nent->data, ent->data, sizeof(nent->data));
+            memcpy(nent->wdata, ent->wdata, sizeof(nent->wdata));
+
+            ent = (entry_t *) ent->list.next;
+        }
+
+        sec = (section_t *) sec->list.next;
+    }
+
+    return copy;
+}
+
+/* Compare two configurations variable by variable.  cb is invoked once
+   for every variable whose value differs between the two (including
+   variables present on only one side); the return value is the number
+   of differences for which cb returned zero, or of all differences when
+   cb is NULL. */
+int
+ini_diff(ini_t ini, ini_t other, int (*cb)(const char *section, const char *name, void *priv), void *priv)
+{
+    section_t *sec;
+    int        count = 0;
+
+    if ((ini == NULL) || (other == NULL))
+        return 0;
+
+    /* Variables changed on, or missing from, the other side. */
+    sec = (section_t *) ((list_t *) ini)->next;
+    while (sec != NULL) {
+        section_t *osec = find_section((list_t *) other, sec->name);
+        entry_t   *ent  = (entry_t *) sec->entry_head.next;
+
+        while (ent != NULL) {
+            if (ent->name[0] != '\0') {
+                const entry_t *oent = (osec == NULL) ? NULL : find_entry(osec, ent->name);
+
+                if ((oent == NULL) || strcmp(ent->data, oent->data)) {
+                    if ((cb == NULL) || !cb(sec->name, ent->name, priv))
+                        count++;
+                }
+            }
+
+            ent = (entry_t *) ent->list.next;
+        }
+
+        sec = (section_t *) sec->list.next;
+    }
+
+    /* Variables only present on the other side. */
+    sec = (section_t *) ((list_t *) other)->next;
+    while (sec != NULL) {
+        section_t *osec = find_section((list_t *) ini, sec->name);
+        entry_t   *ent  = (entry_t *) sec->entry_head.next;
+
+        while (ent != NULL) {
+            if ((ent->name[0] != '\0') && ((osec == NULL) || (find_entry(osec, ent->name) == NULL))) {
+                if ((cb == NULL) || !cb(sec->name, ent->name, priv))
+                    count++;
+            }
+
+            ent = (entry_t *) ent->list.next;
+        }
+
+        sec = (section_t *) sec->list.next;
+    }
+
+    return count;
+}
+
 void
 ini_dump(ini_t ini)
 {
@@ -537,6 +725,7 @@ ini_section_delete_var(ini_section_t self, const char *name)
     entry = find_entry(section, name);
     if (entry != NULL) {
         list_delete(&entry->list, &section->entry_head);
+        entry_hash_del(section, entry);
         free(entry);
     }
 }
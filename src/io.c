@@ -59,6 +59,27 @@ int   initialized = 0;
 io_t *io[NPORTS];
 io_t *io_last[NPORTS];
 
+/* Per-port summary of the handler chain, rebuilt whenever a handler is set
+   or removed, so the dispatchers below can tell without walking any chains
+   whether the flattened single-handler path is safe to take. */
+#define IO_FLAG_MULTI 0x01 /* port has more than one handler */
+#define IO_FLAG_INBO  0x02 /* port has a byte-only in handler */
+#define IO_FLAG_INWO  0x04 /* port has a word-only in handler */
+#define IO_FLAG_OUTBO 0x08 /* port has a byte-only out handler */
+#define IO_FLAG_OUTWO 0x10 /* port has a word-only out handler */
+#define IO_FLAG_TRAP  0x20 /* port has at least one enabled I/O trap */
+uint8_t io_flags[NPORTS];
+
+/* I/O traps are kept out of the handler chains in a table of their own, so
+   a trapped port keeps its flattened dispatch path: the dispatchers consult
+   this table only when the port's IO_FLAG_TRAP bit is set. */
+typedef struct _io_trap_link_ {
+    io_trap_t             *trap;
+    struct _io_trap_link_ *next;
+} io_trap_link_t;
+
+static io_trap_link_t *io_traps[NPORTS];
+
 #ifdef ENABLE_IO_LOG
 int io_do_log = ENABLE_IO_LOG;
 
@@ -80,9 +101,10 @@ io_log(const char *fmt, ...)
 void
 io_init(void)
 {
-    int   c;
-    io_t *p;
-    io_t *q;
+    int             c;
+    io_t           *p;
+    io_t           *q;
+    io_trap_link_t *t;
 
     if (!initialized) {
         for (c = 0; c < NPORTS; c++)
@@ -103,9 +125,58 @@ io_init(void)
             p = NULL;
         }
 
+        /* Free any trap links left behind by their owners. */
+        while (io_traps[c] != NULL) {
+            t = io_traps[c]->next;
+            free(io_traps[c]);
+            io_traps[c] = t;
+        }
+
         /* io[c] should be NULL. */
         io[c] = io_last[c] = NULL;
+        io_flags[c]        = 0;
+    }
+}
+
+static void
+io_update_flags(uint16_t port)
+{
+    const io_t *p     = io[port];
+    uint8_t     flags = 0;
+
+    if (p && p->next)
+        flags |= IO_FLAG_MULTI;
+    while (p) {
+        if (p->inb && !p->inw)
+            flags |= IO_FLAG_INBO;
+        if (p->inw && !p->inl)
+            flags |= IO_FLAG_INWO;
+        if (p->outb && !p->outw)
+            flags |= IO_FLAG_OUTBO;
+        if (p->outw && !p->outl)
+            flags |= IO_FLAG_OUTWO;
+        p = p->next;
+    }
+    if (io_traps[port])
+        flags |= IO_FLAG_TRAP;
+    io_flags[port] = flags;
+}
+
+/* Fire every trap registered on a port, in most-recently-added order.
+   Returns the access size so the caller can mark the port as found. */
+static int
+io_trap_fire(uint16_t port, int size, uint8_t write, uint8_t val)
+{
+    const io_trap_link_t *link = io_traps[port];
+    const io_trap_link_t *next;
+
+    while (link != NULL) {
+        next = link->next;
+        link->trap->func(size, port, write, val, link->trap->priv);
+        link = next;
     }
+
+    return size;
 }
 
 void
@@ -145,6 +216,8 @@ io_sethandler_common(uint16_t base, int size,
         q->next = NULL;
 
         io_last[base + c] = q;
+
+        io_update_flags(base + c);
     }
 }
 
@@ -182,6 +255,8 @@ io_removehandler_common(uint16_t base, int size,
             }
             p = q;
         }
+
+        io_update_flags(base + c);
     }
 }
 
@@ -359,6 +434,9 @@ inb(uint16_t port)
         qfound = 1;
 #endif
     } else {
+        if (io_flags[port] & IO_FLAG_TRAP)
+            found |= io_trap_fire(port, 1, 0, 0);
+
         p = io[port];
         while (p) {
             q = p->next;
@@ -423,6 +501,9 @@ outb(uint16_t port, uint8_t val)
         qfound = 1;
 #endif
     } else {
+        if (io_flags[port] & IO_FLAG_TRAP)
+            found |= io_trap_fire(port, 1, 1, val);
+
         p = io[port];
         while (p) {
             q = p->next;
@@ -477,8 +558,21 @@ inw(uint16_t port)
         found = 2;
 #ifdef ENABLE_IO_LOG
         qfound = 1;
+#endif
+    } else if (((p = io[port]) != NULL) && !(io_flags[port] & IO_FLAG_MULTI) && p->inw && !(io_flags[(port + 1) & 0xffff] & IO_FLAG_INBO)) {
+        /* Flattened path: the port's only handler covers the full width and
+           no byte handler overlaps, so the fallback passes cannot match. */
+        if (io_flags[port] & IO_FLAG_TRAP)
+            io_trap_fire(port, 2, 0, 0);
+        ret   = p->inw(port, p->priv);
+        found = 2;
+#ifdef ENABLE_IO_LOG
+        qfound = 1;
 #endif
     } else {
+        if (io_flags[port] & IO_FLAG_TRAP)
+            found |= io_trap_fire(port, 2, 0, 0);
+
         p = io[port];
         while (p) {
             q = p->next;
@@ -553,8 +647,20 @@ outw(uint16_t port, uint16_t val)
         found = 2;
 #ifdef ENABLE_IO_LOG
         qfound = 1;
+#endif
+    } else if (((p = io[port]) != NULL) && !(io_flags[port] & IO_FLAG_MULTI) && p->outw && !(io_flags[(port + 1) & 0xffff] & IO_FLAG_OUTBO)) {
+        /* Flattened path: see inw(). */
+        if (io_flags[port] & IO_FLAG_TRAP)
+            io_trap_fire(port, 2, 1, val & 0xff);
+        p->outw(port, val, p->priv);
+        found = 2;
+#ifdef ENABLE_IO_LOG
+        qfound = 1;
 #endif
     } else {
+        if (io_flags[port] & IO_FLAG_TRAP)
+            found |= io_trap_fire(port, 2, 1, val & 0xff);
+
         p = io[port];
         while (p) {
             q = p->next;
@@ -625,8 +731,20 @@ inl(uint16_t port)
         found = 4;
 #ifdef ENABLE_IO_LOG
         qfound = 1;
+#endif
+    } else if (((p = io[port]) != NULL) && !(io_flags[port] & IO_FLAG_MULTI) && p->inl && !(io_flags[(port + 1) & 0xffff] & IO_FLAG_INBO) && !(io_flags[(port + 2) & 0xffff] & (IO_FLAG_INBO | IO_FLAG_INWO)) && !(io_flags[(port + 3) & 0xffff] & IO_FLAG_INBO)) {
+        /* Flattened path: see inw(). */
+        if (io_flags[port] & IO_FLAG_TRAP)
+            io_trap_fire(port, 4, 0, 0);
+        ret   = p->inl(port, p->priv);
+        found = 4;
+#ifdef ENABLE_IO_LOG
+        qfound = 1;
 #endif
     } else {
+        if (io_flags[port] & IO_FLAG_TRAP)
+            found |= io_trap_fire(port, 4, 0, 0);
+
         p = io[port];
         while (p) {
             q = p->next;
@@ -733,8 +851,20 @@ outl(uint16_t port, uint32_t val)
         found = 4;
 #ifdef ENABLE_IO_LOG
         qfound = 1;
+#endif
+    } else if (((p = io[port]) != NULL) && !(io_flags[port] & IO_FLAG_MULTI) && p->outl && !(io_flags[(port + 1) & 0xffff] & IO_FLAG_OUTBO) && !(io_flags[(port + 2) & 0xffff] & (IO_FLAG_OUTBO | IO_FLAG_OUTWO)) && !(io_flags[(port + 3) & 0xffff] & IO_FLAG_OUTBO)) {
+        /* Flattened path: see inw(). */
+        if (io_flags[port] & IO_FLAG_TRAP)
+            io_trap_fire(port, 4, 1, val & 0xff);
+        p->outl(port, val, p->priv);
+        found = 4;
+#ifdef ENABLE_IO_LOG
+        qfound = 1;
 #endif
     } else {
+        if (io_flags[port] & IO_FLAG_TRAP)
+            found |= io_trap_fire(port, 4, 1, val & 0xff);
+
         p = io[port];
         if (p) {
             while (p) {
@@ -794,49 +924,43 @@ outl(uint16_t port, uint32_t val)
     return;
 }
 
-static uint8_t
-io_trap_readb(uint16_t addr, void *priv)
-{
-    io_trap_t *trap = (io_trap_t *) priv;
-    trap->func(1, addr, 0, 0, trap->priv);
-    return 0xff;
-}
-
-static uint16_t
-io_trap_readw(uint16_t addr, void *priv)
-{
-    io_trap_t *trap = (io_trap_t *) priv;
-    trap->func(2, addr, 0, 0, trap->priv);
-    return 0xffff;
-}
-
-static uint32_t
-io_trap_readl(uint16_t addr, void *priv)
-{
-    io_trap_t *trap = (io_trap_t *) priv;
-    trap->func(4, addr, 0, 0, trap->priv);
-    return 0xffffffff;
-}
-
+/* Link a trap into the dedicated trap table for every port it covers and
+   flag those ports, so the dispatchers know to look at the table at all. */
 static void
-io_trap_writeb(uint16_t addr, uint8_t val, void *priv)
+io_trap_map(io_trap_t *trap)
 {
-    io_trap_t *trap = (io_trap_t *) priv;
-    trap->func(1, addr, 1, val, trap->priv);
+    for (uint32_t c = 0; c < trap->size; c++) {
+        uint16_t        port = (trap->base + c) & 0xffff;
+        io_trap_link_t *link = (io_trap_link_t *) malloc(sizeof(io_trap_link_t));
+
+        link->trap     = trap;
+        link->next     = io_traps[port];
+        io_traps[port] = link;
+        io_flags[port] |= IO_FLAG_TRAP;
+    }
 }
 
 static void
-io_trap_writew(uint16_t addr, uint16_t val, void *priv)
+io_trap_unmap(io_trap_t *trap)
 {
-    io_trap_t *trap = (io_trap_t *) priv;
-    trap->func(2, addr, 1, val, trap->priv);
-}
+    for (uint32_t c = 0; c < trap->size; c++) {
+        uint16_t         port = (trap->base + c) & 0xffff;
+        io_trap_link_t **link = &io_traps[port];
 
-static void
-io_trap_writel(uint16_t addr, uint32_t val, void *priv)
-{
-    io_trap_t *trap = (io_trap_t *) priv;
-    trap->func(4, addr, 1, val, trap->priv);
+        while (*link != NULL) {
+            if ((*link)->trap == trap) {
+                io_trap_link_t *old = *link;
+
+                *link = old->next;
+                free(old);
+                break;
+            }
+            link = &(*link)->next;
+        }
+
+        if (io_traps[port] == NULL)
+            io_flags[port] &= ~IO_FLAG_TRAP;
+    }
 }
 
 void *
@@ -864,12 +988,8 @@ io_trap_remap(void *handle, int enable, uint16_t addr, uint16_t size)
            trap->base, trap->base + trap->size - 1, trap->enable, addr, addr + size - 1, enable);
 
     /* Remove old I/O mapping. */
-    if (trap->enable && trap->size) {
-        io_removehandler(trap->base, trap->size,
-                         io_trap_readb, io_trap_readw, io_trap_readl,
-                         io_trap_writeb, io_trap_writew, io_trap_writel,
-                         trap);
-    }
+    if (trap->enable && trap->size)
+        io_trap_unmap(trap);
 
     /* Set trap enable flag, base address and size. */
     trap->enable = !!enable;
@@ -877,12 +997,8 @@ io_trap_remap(void *handle, int enable, uint16_t addr, uint16_t size)
     trap->size   = size;
 
     /* Add new I/O mapping. */
-    if (trap->enable && trap->size) {
-        io_sethandler(trap->base, trap->size,
-                      io_trap_readb, io_trap_readw, io_trap_readl,
-                      io_trap_writeb, io_trap_writew, io_trap_writel,
-                      trap);
-    }
+    if (trap->enable && trap->size)
+        io_trap_map(trap);
 }
 
 void
@@ -18,6 +18,7 @@
  */
 #include <inttypes.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -31,6 +32,7 @@
 #include <86box/mem.h>
 #include "cpu.h"
 #include <86box/plat.h>
+#include <86box/thread.h>
 #include <86box/version.h>
 #include <86box/log.h>
 
@@ -44,6 +46,91 @@ typedef struct log_t {
 
 extern FILE *stdlog; /* file to log output to */
 
+/* Asynchronous back end: log_out() deposits finished lines into this
+   ring and a consumer thread does the file I/O, so an enabled log
+   domain only costs the formatting on the emulation thread instead of
+   a write plus flush per line. Records are self-contained strings, so
+   a log_t can be closed while its lines are still in flight. */
+#define LOG_RING_SIZE 512 /* must be a power of two */
+
+typedef struct log_rec_t {
+    atomic_int ready;
+    char       text[1024];
+} log_rec_t;
+
+static log_rec_t   log_ring[LOG_RING_SIZE];
+static atomic_uint log_ring_head;    /* next slot to claim (producers) */
+static atomic_uint log_ring_tail;    /* next slot to write out (consumer) */
+static atomic_uint log_ring_dropped; /* lines lost to a full ring */
+static thread_t   *log_thread = NULL;
+static event_t    *log_wake   = NULL;
+
+/* The log consumer thread. */
+static void
+log_write_thread(UNUSED(void *priv))
+{
+    unsigned int dropped;
+
+    while (1) {
+        thread_wait_event(log_wake, -1);
+        thread_reset_event(log_wake);
+
+        while (1) {
+            unsigned int tail = atomic_load(&log_ring_tail);
+            log_rec_t   *rec  = &log_ring[tail & (LOG_RING_SIZE - 1)];
+
+            if (!atomic_load(&rec->ready)) {
+                dropped = atomic_exchange(&log_ring_dropped, 0);
+                if (dropped)
+                    fprintf(stdlog, "*** %u lines dropped ***\n", dropped);
+                fflush(stdlog);
+                break;
+            }
+
+            fprintf(stdlog, "%s", rec->text);
+            atomic_store(&rec->ready, 0);
+            atomic_store(&log_ring_tail, tail + 1);
+        }
+    }
+}
+
+/* Queue one finished line for the consumer thread, dropping it if the
+   consumer has fallen a whole ring behind. */
+static void
+log_enqueue(const char *text)
+{
+    unsigned int head;
+    log_rec_t   *rec;
+
+    do {
+        head = atomic_load(&log_ring_head);
+        if ((head - atomic_load(&log_ring_tail)) >= LOG_RING_SIZE) {
+            atomic_fetch_add(&log_ring_dropped, 1);
+            return;
+        }
+    } while (!atomic_compare_exchange_weak(&log_ring_head, &head, head + 1));
+
+    rec = &log_ring[head & (LOG_RING_SIZE - 1)];
+    strcpy(rec->text, text);
+    atomic_store(&rec->ready, 1);
+
+    thread_set_event(log_wake);
+}
+
+/* Wait for the consumer to catch up, so the log is complete before a
+   fatal error report or an exit. */
+static void
+log_drain(void)
+{
+    int timeout = 100;
+
+    if (log_thread == NULL)
+        return;
+
+    while ((atomic_load(&log_ring_tail) != atomic_load(&log_ring_head)) && (timeout-- > 0))
+        plat_delay_ms(1);
+}
+
 void
 log_set_suppr_seen(void *priv, int suppr_seen)
 {
@@ -100,21 +187,27 @@ log_out(void *priv, const char *fmt, va_list ap)
             stdlog = stdout;
     }
 
+    if (log_thread == NULL) {
+        log_wake   = thread_create_event();
+        log_thread = thread_create(log_write_thread, NULL);
+    }
+
     vsprintf(temp, fmt, ap);
     if (log->suppr_seen && !strcmp(log->buff, temp))
         log->seen++;
     else {
         if (log->suppr_seen && log->seen) {
+            char repeats[1024];
+
             log_copy(log, fmt2, "*** %d repeats ***\n", 1024);
-            fprintf(stdlog, fmt2, log->seen);
+            snprintf(repeats, sizeof(repeats), fmt2, log->seen);
+            log_enqueue(repeats);
         }
         log->seen = 0;
         strcpy(log->buff, temp);
         log_copy(log, fmt2, temp, 1024);
-        fprintf(stdlog, fmt2, ap);
+        log_enqueue(fmt2);
     }
-
-    fflush(stdlog);
 }
 
 void
@@ -131,6 +224,7 @@ log_fatal(void *priv, const char *fmt, ...)
     va_start(ap, fmt);
     log_copy(log, fmt2, fmt, 1024);
     vsprintf(temp, fmt2, ap);
+    log_drain();
     fatal_ex(fmt2, ap);
     va_end(ap);
     exit(-1);
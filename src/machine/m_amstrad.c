@@ -134,6 +134,8 @@ typedef struct amsvid_t {
     int        lastline;
     uint8_t   *vram;
     void      *ams;
+
+    linecache_t *linecache; /* 1512; per-scanline snapshot cache (see video.h) */
 } amsvid_t;
 
 typedef struct amstrad_t {
@@ -239,6 +241,8 @@ vid_out_1512(uint16_t addr, uint8_t val, void *priv)
                 if (vid->crtcreg < 0xe || vid->crtcreg > 0x10) {
                     vid->fullchange = changeframecount;
                     recalc_timings_1512(vid);
+                    if (vid->linecache)
+                        linecache_invalidate(vid->linecache);
                 }
             }
             return;
@@ -249,10 +253,14 @@ vid_out_1512(uint16_t addr, uint8_t val, void *priv)
                 vid->plane_read  = 0;
             }
             vid->cgamode = val;
+            if (vid->linecache)
+                linecache_invalidate(vid->linecache);
             return;
 
         case 0x03d9:
             vid->cgacol = val;
+            if (vid->linecache)
+                linecache_invalidate(vid->linecache);
             return;
 
         case 0x03dd:
@@ -265,6 +273,8 @@ vid_out_1512(uint16_t addr, uint8_t val, void *priv)
 
         case 0x03df:
             vid->border = val;
+            if (vid->linecache)
+                linecache_invalidate(vid->linecache);
             return;
 
         default:
@@ -336,6 +346,69 @@ vid_read_1512(uint32_t addr, void *priv)
     return (vid->vram[addr]);
 }
 
+/* Snapshot everything this scanline's pixels derive from and compare against
+   the previous frame; mode, colour and border writes bump the cache generation
+   in vid_out_1512, so only the VRAM contents and cursor/blink state need to go
+   into the per-cell tuples. */
+static int
+vid_line_changed_1512(amsvid_t *vid)
+{
+    uint32_t cells[LINECACHE_COLS];
+    uint16_t ca     = (vid->crtc[15] | (vid->crtc[14] << 8)) & 0x3fff;
+    uint16_t ma     = vid->ma;
+    uint16_t addr;
+    uint32_t key;
+    int      ncells = 0;
+    uint8_t  chr;
+    uint8_t  attr;
+
+    if (!vid->linecache)
+        return 1;
+
+    key = (vid->sc & 31) | ((!!vid->dispon) << 8);
+
+    if (vid->dispon) {
+        if (vid->cgamode & 1) { /*80 column text*/
+            ncells = 80;
+            for (int x = 0; x < ncells; x++) {
+                chr      = vid->vram[(ma << 1) & 0x3fff];
+                attr     = vid->vram[((ma << 1) + 1) & 0x3fff];
+                cells[x] = chr | (attr << 8)
+                    | (((ma == ca) && vid->con && vid->cursoron) ? (1 << 16) : 0)
+                    | (((vid->blink & 16) && (vid->cgamode & 0x20) && (attr & 0x80)) ? (1 << 17) : 0);
+                ma++;
+            }
+        } else if (!(vid->cgamode & 2)) { /*40 column text*/
+            ncells = 40;
+            for (int x = 0; x < ncells; x++) {
+                chr      = vid->vram[(ma << 1) & 0x3fff];
+                attr     = vid->vram[((ma << 1) + 1) & 0x3fff];
+                cells[x] = chr | (attr << 8)
+                    | (((ma == ca) && vid->con && vid->cursoron) ? (1 << 16) : 0)
+                    | (((vid->blink & 16) && (vid->cgamode & 0x20) && (attr & 0x80)) ? (1 << 17) : 0);
+                ma++;
+            }
+        } else if (!(vid->cgamode & 16)) { /*320x200x4*/
+            ncells = 40;
+            for (int x = 0; x < ncells; x++) {
+                cells[x] = (vid->vram[((ma << 1) & 0x1fff) + ((vid->sc & 1) * 0x2000)] << 8) | vid->vram[((ma << 1) & 0x1fff) + ((vid->sc & 1) * 0x2000) + 1];
+                ma++;
+            }
+        } else { /*640x200x16 - two cells per character, one word per plane pair*/
+            ncells = 80;
+            for (int x = 0; x < 40; x++) {
+                addr                 = ((ma << 1) & 0x1fff) + ((vid->sc & 1) * 0x2000);
+                cells[x << 1]        = (vid->vram[addr] << 8) | vid->vram[addr + 1] | (((vid->vram[addr + 0x4000] << 8) | vid->vram[addr + 0x4001]) << 16);
+                cells[(x << 1) + 1]  = (vid->vram[addr + 0x8000] << 8) | vid->vram[addr + 0x8001] | (((vid->vram[addr + 0xc000] << 8) | vid->vram[addr + 0xc001]) << 16);
+                ma++;
+            }
+        }
+    } else
+        cells[ncells++] = vid->crtc[1]; /* border width of the blank line */
+
+    return linecache_line_changed(vid->linecache, vid->displine, key, cells, ncells);
+}
+
 static void
 vid_poll_1512(void *priv)
 {
@@ -355,18 +428,26 @@ vid_poll_1512(void *priv)
     int       cols[4];
     int       col;
     int       oldsc;
+    int       line_changed;
 
     if (!vid->linepos) {
         timer_advance_u64(&vid->timer, vid->dispofftime);
         vid->stat |= 1;
         vid->linepos = 1;
         oldsc        = vid->sc;
+        line_changed = vid_line_changed_1512(vid);
         if (vid->dispon) {
             if (vid->displine < vid->firstline) {
                 vid->firstline = vid->displine;
                 video_wait_for_buffer();
             }
             vid->lastline = vid->displine;
+            if (!line_changed) {
+                /* The target buffer still holds this line's final pixels;
+                   advance ma exactly as the render below would. */
+                vid->ma += (vid->cgamode & 1) ? 80 : 40;
+                goto line_done;
+            }
             for (c = 0; c < 8; c++) {
                 if ((vid->cgamode & 0x12) == 0x12) {
                     buffer32->line[vid->displine << 1][c] = buffer32->line[(vid->displine << 1) + 1][c] = (vid->border & 15) + 16;
@@ -476,7 +557,7 @@ vid_poll_1512(void *priv)
                     }
                 }
             }
-        } else {
+        } else if (line_changed) {
             cols[0] = ((vid->cgamode & 0x12) == 0x12) ? 0 : (vid->cgacol & 15) + 16;
             if (vid->cgamode & 1) {
                 hline(buffer32, 0, (vid->displine << 1), (vid->crtc[1] << 3) + 16, cols[0]);
@@ -487,14 +568,17 @@ vid_poll_1512(void *priv)
             }
         }
 
-        if (vid->cgamode & 1)
-            x = (vid->crtc[1] << 3) + 16;
-        else
-            x = (vid->crtc[1] << 4) + 16;
+        if (line_changed) {
+            if (vid->cgamode & 1)
+                x = (vid->crtc[1] << 3) + 16;
+            else
+                x = (vid->crtc[1] << 4) + 16;
 
-        video_process_8(x, vid->displine << 1);
-        video_process_8(x, (vid->displine << 1) + 1);
+            video_process_8(x, vid->displine << 1);
+            video_process_8(x, (vid->displine << 1) + 1);
+        }
 
+line_done:
         vid->sc = oldsc;
         if (vid->vsynctime)
             vid->stat |= 8;
@@ -571,8 +655,16 @@ vid_poll_1512(void *priv)
 
                         if (video_force_resize_get())
                             video_force_resize_set(0);
+
+                        if (vid->linecache) {
+                            linecache_invalidate(vid->linecache);
+                            vid->linecache->dirty = 1;
+                        }
                     }
 
+                    if (vid->linecache && !vid->linecache->dirty && !monitors[monitor_index_global].mon_screenshots)
+                        goto blit_skipped;
+
                     if (enable_overscan) {
                         video_blit_memtoscreen(0, (vid->firstline - 4) << 1,
                                                xsize, ((vid->lastline - vid->firstline) + 8) << 1);
@@ -580,6 +672,9 @@ vid_poll_1512(void *priv)
                         video_blit_memtoscreen(8, vid->firstline << 1,
                                                xsize, (vid->lastline - vid->firstline) << 1);
                     }
+blit_skipped:
+                    if (vid->linecache)
+                        vid->linecache->dirty = 0;
                 }
 
                 video_res_x = xsize;
@@ -624,9 +719,10 @@ vid_init_1512(amstrad_t *ams)
 
     video_inform(VIDEO_FLAG_TYPE_CGA, &timing_pc1512);
 
-    vid->vram    = malloc(0x10000);
-    vid->cgacol  = 7;
-    vid->cgamode = 0x12;
+    vid->vram      = malloc(0x10000);
+    vid->cgacol    = 7;
+    vid->cgamode   = 0x12;
+    vid->linecache = linecache_alloc();
 
     timer_add(&vid->timer, vid_poll_1512, vid, 1);
     mem_mapping_add(&vid->cga.mapping, 0xb8000, 0x08000,
@@ -650,6 +746,7 @@ vid_close_1512(void *priv)
 {
     amsvid_t *vid = (amsvid_t *) priv;
 
+    linecache_free(vid->linecache);
     free(vid->vram);
 
     free(vid);
@@ -97,6 +97,9 @@ typedef struct pcjr_t {
     int           lastline;
     int           composite;
 
+    /* Per-scanline snapshot cache (see video.h). */
+    linecache_t *linecache;
+
     /* Keyboard Controller stuff. */
     int        latched;
     int        data;
@@ -185,6 +188,8 @@ vid_out(uint16_t addr, uint8_t val, void *priv)
                 if (pcjr->crtcreg < 0xe || pcjr->crtcreg > 0x10) {
                     pcjr->fullchange = changeframecount;
                     recalc_timings(pcjr);
+                    if (pcjr->linecache)
+                        linecache_invalidate(pcjr->linecache);
                 }
             }
             return;
@@ -198,6 +203,8 @@ vid_out(uint16_t addr, uint8_t val, void *priv)
                 pcjr->array[pcjr->array_index & 0x1f] = val;
                 if (!(pcjr->array_index & 0x1f))
                     update_cga16_color(val);
+                if (pcjr->linecache)
+                    linecache_invalidate(pcjr->linecache);
             }
             pcjr->array_ff = !pcjr->array_ff;
             break;
@@ -210,6 +217,8 @@ vid_out(uint16_t addr, uint8_t val, void *priv)
                                       128k or more RAM). */
             pcjr->addr_mode = val >> 6;
             recalc_address(pcjr);
+            if (pcjr->linecache)
+                linecache_invalidate(pcjr->linecache);
             break;
 
         default:
@@ -273,6 +282,76 @@ vid_read(uint32_t addr, void *priv)
     return (pcjr->b8000[addr & 0x3fff]);
 }
 
+/* Snapshot everything this scanline's pixels derive from and compare against
+   the previous frame; register state (CRTC, array palette, memory control) is
+   covered by generation bumps in vid_out, so only the per-cell VRAM contents
+   and cursor/blink state go into the tuples. */
+static int
+vid_line_changed(pcjr_t *pcjr)
+{
+    uint32_t cells[LINECACHE_COLS];
+    uint16_t ca     = (pcjr->crtc[15] | (pcjr->crtc[14] << 8)) & 0x3fff;
+    uint16_t ma     = pcjr->ma;
+    uint16_t offset = 0;
+    uint16_t mask   = 0x1fff;
+    uint32_t key;
+    int      ncells = 0;
+    uint8_t  chr;
+    uint8_t  attr;
+
+    /* Composite output is processed outside our view - always render. */
+    if (!pcjr->linecache || pcjr->composite)
+        return 1;
+
+    key = (pcjr->sc & 31) | ((!!pcjr->dispon) << 8);
+
+    if (pcjr->dispon) {
+        if (pcjr->crtc[1] > LINECACHE_COLS) {
+            pcjr->linecache->dirty = 1;
+            return 1;
+        }
+        ncells = pcjr->crtc[1];
+        switch (pcjr->addr_mode) {
+            case 0: /*Alpha*/
+                offset = 0;
+                mask   = 0x3fff;
+                break;
+            case 1: /*Low resolution graphics*/
+                offset = (pcjr->sc & 1) * 0x2000;
+                break;
+            case 3: /*High resolution graphics*/
+                offset = (pcjr->sc & 3) * 0x2000;
+                break;
+
+            default:
+                break;
+        }
+        switch ((pcjr->array[0] & 0x13) | ((pcjr->array[3] & 0x08) << 5)) {
+            case 0x01: /*80 column text*/
+            case 0x00: /*40 column text*/
+                for (int x = 0; x < ncells; x++) {
+                    chr      = pcjr->vram[((ma << 1) & mask) + offset];
+                    attr     = pcjr->vram[((ma << 1) & mask) + offset + 1];
+                    cells[x] = chr | (attr << 8)
+                        | (((ma == ca) && pcjr->con && pcjr->cursoron) ? (1 << 16) : 0)
+                        | (((pcjr->blink & 16) && (pcjr->array[3] & 4) && (attr & 0x80)) ? (1 << 17) : 0);
+                    ma++;
+                }
+                break;
+            default: /*graphics*/
+                for (int x = 0; x < ncells; x++) {
+                    cells[x] = (pcjr->vram[((ma << 1) & mask) + offset] << 8)
+                        | pcjr->vram[((ma << 1) & mask) + offset + 1];
+                    ma++;
+                }
+                break;
+        }
+    } else
+        cells[ncells++] = pcjr->crtc[1]; /* border width of the blank line */
+
+    return linecache_line_changed(pcjr->linecache, pcjr->displine, key, cells, ncells);
+}
+
 static void
 vid_poll(void *priv)
 {
@@ -288,6 +367,7 @@ vid_poll(void *priv)
     uint16_t dat;
     int      cols[4];
     int      oldsc;
+    int      line_changed;
 
     if (!pcjr->linepos) {
         timer_advance_u64(&pcjr->timer, pcjr->dispofftime);
@@ -296,6 +376,7 @@ vid_poll(void *priv)
         oldsc         = pcjr->sc;
         if ((pcjr->crtc[8] & 3) == 3)
             pcjr->sc = (pcjr->sc << 1) & 7;
+        line_changed = vid_line_changed(pcjr);
         if (pcjr->dispon) {
             uint16_t offset = 0;
             uint16_t mask   = 0x1fff;
@@ -305,6 +386,12 @@ vid_poll(void *priv)
                 video_wait_for_buffer();
             }
             pcjr->lastline = pcjr->displine;
+            if (!line_changed) {
+                /* The target buffer still holds this line's final pixels;
+                   advance ma exactly as the render below would. */
+                pcjr->ma += pcjr->crtc[1];
+                goto line_done;
+            }
             cols[0]        = (pcjr->array[2] & 0xf) + 16;
             for (uint8_t c = 0; c < 8; c++) {
                 (buffer32->line[pcjr->displine])[c] = cols[0];
@@ -457,7 +544,7 @@ vid_poll(void *priv)
                 default:
                     break;
             }
-        } else {
+        } else if (line_changed) {
             if (pcjr->array[3] & 4) {
                 if (pcjr->array[0] & 1) {
                     hline(buffer32, 0, (pcjr->displine << 1), (pcjr->crtc[1] << 3) + 16, (pcjr->array[2] & 0xf) + 16);
@@ -477,17 +564,20 @@ vid_poll(void *priv)
                 }
             }
         }
-        if (pcjr->array[0] & 1)
-            x = (pcjr->crtc[1] << 3) + 16;
-        else
-            x = (pcjr->crtc[1] << 4) + 16;
-        if (pcjr->composite) {
-            Composite_Process(pcjr->array[0], 0, x >> 2, buffer32->line[pcjr->displine << 1]);
-            Composite_Process(pcjr->array[0], 0, x >> 2, buffer32->line[(pcjr->displine << 1) + 1]);
-        } else {
-            video_process_8(x, pcjr->displine << 1);
-            video_process_8(x, (pcjr->displine << 1) + 1);
+        if (line_changed) {
+            if (pcjr->array[0] & 1)
+                x = (pcjr->crtc[1] << 3) + 16;
+            else
+                x = (pcjr->crtc[1] << 4) + 16;
+            if (pcjr->composite) {
+                Composite_Process(pcjr->array[0], 0, x >> 2, buffer32->line[pcjr->displine << 1]);
+                Composite_Process(pcjr->array[0], 0, x >> 2, buffer32->line[(pcjr->displine << 1) + 1]);
+            } else {
+                video_process_8(x, pcjr->displine << 1);
+                video_process_8(x, (pcjr->displine << 1) + 1);
+            }
         }
+line_done:
         pcjr->sc = oldsc;
         if (pcjr->vc == pcjr->crtc[7] && !pcjr->sc) {
             pcjr->stat |= 8;
@@ -570,8 +660,16 @@ vid_poll(void *priv)
 
                             if (video_force_resize_get())
                                 video_force_resize_set(0);
+
+                            if (pcjr->linecache) {
+                                linecache_invalidate(pcjr->linecache);
+                                pcjr->linecache->dirty = 1;
+                            }
                         }
 
+                        if (pcjr->linecache && !pcjr->linecache->dirty && !monitors[monitor_index_global].mon_screenshots)
+                            goto blit_skipped;
+
                         if (enable_overscan) {
                             video_blit_memtoscreen(0, (pcjr->firstline - 4) << 1,
                                                    xsize, ((pcjr->lastline - pcjr->firstline) + 8) << 1);
@@ -579,6 +677,9 @@ vid_poll(void *priv)
                             video_blit_memtoscreen(8, pcjr->firstline << 1,
                                                    xsize, (pcjr->lastline - pcjr->firstline) << 1);
                         }
+blit_skipped:
+                        if (pcjr->linecache)
+                            pcjr->linecache->dirty = 0;
                     }
 
                     frames++;
@@ -838,6 +939,7 @@ machine_pcjr_init(UNUSED(const machine_t *model))
         pcjr->memctrl &= ~0x24;
     display_type    = machine_get_config_int("display_type");
     pcjr->composite = (display_type != PCJR_RGB);
+    pcjr->linecache = linecache_alloc();
 
     pic_init_pcjr();
     pit_common_init(0, pit_irq0_timer_pcjr, NULL);
@@ -105,6 +105,8 @@ typedef struct t1kvid_t {
     int        lastline;
 
     int composite;
+
+    linecache_t *linecache; /* Per-scanline snapshot cache (see video.h). */
 } t1kvid_t;
 
 typedef struct t1keep_t {
@@ -792,6 +794,8 @@ vid_out(uint16_t addr, uint8_t val, void *priv)
                 if (vid->crtcreg < 0xe || vid->crtcreg > 0x10) {
                     vid->fullchange = changeframecount;
                     recalc_timings(dev);
+                    if (vid->linecache)
+                        linecache_invalidate(vid->linecache);
                 }
             }
             break;
@@ -800,10 +804,14 @@ vid_out(uint16_t addr, uint8_t val, void *priv)
             vid->mode = val;
             if (!dev->is_sl2)
                 update_cga16_color(vid->mode);
+            if (vid->linecache)
+                linecache_invalidate(vid->linecache);
             break;
 
         case 0x03d9:
             vid->col = val;
+            if (vid->linecache)
+                linecache_invalidate(vid->linecache);
             break;
 
         case 0x03da:
@@ -820,6 +828,8 @@ vid_out(uint16_t addr, uint8_t val, void *priv)
                     recalc_address_sl(dev);
                 }
             }
+            if (vid->linecache)
+                linecache_invalidate(vid->linecache);
             break;
 
         case 0x03df:
@@ -828,6 +838,8 @@ vid_out(uint16_t addr, uint8_t val, void *priv)
                 recalc_address_sl(dev);
             else
                 recalc_address(dev);
+            if (vid->linecache)
+                linecache_invalidate(vid->linecache);
             break;
 
         case 0x0065:
@@ -835,6 +847,8 @@ vid_out(uint16_t addr, uint8_t val, void *priv)
                 return; /*Hack*/
             vid->planar_ctrl = val;
             recalc_mapping(dev);
+            if (vid->linecache)
+                linecache_invalidate(vid->linecache);
             break;
 
         default:
@@ -914,6 +928,76 @@ vid_read(uint32_t addr, void *priv)
     }
 }
 
+/* Snapshot everything this scanline's pixels derive from and compare against
+   the previous frame; mode, colour, array and memory control changes bump the
+   cache generation in vid_out, so only the VRAM contents and cursor/blink
+   state need to go into the per-cell tuples. */
+static int
+vid_line_changed(tandy_t *dev)
+{
+    t1kvid_t *vid = dev->vid;
+    uint32_t  cells[LINECACHE_COLS];
+    uint16_t  ca     = (vid->crtc[15] | (vid->crtc[14] << 8)) & 0x3fff;
+    uint16_t  ma     = vid->ma;
+    uint32_t  key;
+    int       ncells = 0;
+    uint8_t   chr;
+    uint8_t   attr;
+
+    /* Composite output is processed outside our view - always render. */
+    if (!vid->linecache || (!dev->is_sl2 && vid->composite))
+        return 1;
+
+    key = (vid->sc & 31) | ((!!vid->dispon) << 8);
+
+    if (vid->dispon) {
+        if (vid->crtc[1] > LINECACHE_COLS) {
+            vid->linecache->dirty = 1;
+            return 1;
+        }
+        ncells = vid->crtc[1];
+        if (dev->is_sl2 && (vid->array[5] & 1)) { /*640x200x16*/
+            ncells = vid->crtc[1] * 2;
+            if (ncells > LINECACHE_COLS) {
+                vid->linecache->dirty = 1;
+                return 1;
+            }
+            for (int x = 0; x < ncells; x++) {
+                cells[x] = (vid->vram[(ma << 1) & 0xffff] << 8) | vid->vram[((ma << 1) + 1) & 0xffff];
+                ma++;
+            }
+        } else if (vid->array[3] & 0x18) { /*16-colour and 640x200x4 modes*/
+            uint16_t offset;
+
+            if (dev->is_sl2 && (vid->array[3] & 0x10) && !(vid->mode & 1))
+                offset = (vid->sc & 1) * 0x2000; /*160x200x16*/
+            else
+                offset = (vid->sc & 3) * 0x2000;
+            for (int x = 0; x < ncells; x++) {
+                cells[x] = (vid->vram[((ma << 1) & 0x1fff) + offset] << 8) | vid->vram[((ma << 1) & 0x1fff) + offset + 1];
+                ma++;
+            }
+        } else if ((vid->mode & 1) || !(vid->mode & 2)) { /*text*/
+            for (int x = 0; x < ncells; x++) {
+                chr      = vid->vram[(ma << 1) & 0x3fff];
+                attr     = vid->vram[((ma << 1) + 1) & 0x3fff];
+                cells[x] = chr | (attr << 8)
+                    | (((ma == ca) && vid->con && vid->cursoron) ? (1 << 16) : 0)
+                    | (((vid->blink & 16) && (vid->mode & 0x20) && (attr & 0x80)) ? (1 << 17) : 0);
+                ma++;
+            }
+        } else { /*2bpp and 1bpp graphics*/
+            for (int x = 0; x < ncells; x++) {
+                cells[x] = (vid->vram[((ma << 1) & 0x1fff) + ((vid->sc & 1) * 0x2000)] << 8) | vid->vram[((ma << 1) & 0x1fff) + ((vid->sc & 1) * 0x2000) + 1];
+                ma++;
+            }
+        }
+    } else
+        cells[ncells++] = vid->crtc[1]; /* border width of the blank line */
+
+    return linecache_line_changed(vid->linecache, vid->displine, key, cells, ncells);
+}
+
 static void
 vid_poll(void *priv)
 {
@@ -932,6 +1016,7 @@ vid_poll(void *priv)
     int       cols[4];
     int       col;
     int       oldsc;
+    int       line_changed;
 
     if (!vid->linepos) {
         timer_advance_u64(&vid->timer, vid->dispofftime);
@@ -940,12 +1025,22 @@ vid_poll(void *priv)
         oldsc        = vid->sc;
         if ((vid->crtc[8] & 3) == 3)
             vid->sc = (vid->sc << 1) & 7;
+        line_changed = vid_line_changed(dev);
         if (vid->dispon) {
             if (vid->displine < vid->firstline) {
                 vid->firstline = vid->displine;
                 video_wait_for_buffer();
             }
             vid->lastline = vid->displine;
+            if (!line_changed) {
+                /* The target buffer still holds this line's final pixels;
+                   advance ma exactly as the render below would. */
+                if (dev->is_sl2 && (vid->array[5] & 1))
+                    vid->ma += vid->crtc[1] * 2;
+                else
+                    vid->ma += vid->crtc[1];
+                goto line_done;
+            }
             cols[0]       = (vid->array[2] & 0xf) + 16;
             for (c = 0; c < 8; c++) {
                 if (vid->array[3] & 4) {
@@ -1122,7 +1217,7 @@ vid_poll(void *priv)
                     }
                 }
             }
-        } else {
+        } else if (line_changed) {
             if (vid->array[3] & 4) {
                 if (vid->mode & 1) {
                     hline(buffer32, 0, (vid->displine << 1), (vid->crtc[1] << 3) + 16, (vid->array[2] & 0xf) + 16);
@@ -1143,17 +1238,20 @@ vid_poll(void *priv)
             }
         }
 
-        if (vid->mode & 1)
-            x = (vid->crtc[1] << 3) + 16;
-        else
-            x = (vid->crtc[1] << 4) + 16;
-        if (!dev->is_sl2 && vid->composite) {
-            Composite_Process(vid->mode, 0, x >> 2, buffer32->line[vid->displine << 1]);
-            Composite_Process(vid->mode, 0, x >> 2, buffer32->line[(vid->displine << 1) + 1]);
-        } else {
-            video_process_8(x, vid->displine << 1);
-            video_process_8(x, (vid->displine << 1) + 1);
+        if (line_changed) {
+            if (vid->mode & 1)
+                x = (vid->crtc[1] << 3) + 16;
+            else
+                x = (vid->crtc[1] << 4) + 16;
+            if (!dev->is_sl2 && vid->composite) {
+                Composite_Process(vid->mode, 0, x >> 2, buffer32->line[vid->displine << 1]);
+                Composite_Process(vid->mode, 0, x >> 2, buffer32->line[(vid->displine << 1) + 1]);
+            } else {
+                video_process_8(x, vid->displine << 1);
+                video_process_8(x, (vid->displine << 1) + 1);
+            }
         }
+line_done:
         vid->sc = oldsc;
         if (vid->vc == vid->crtc[7] && !vid->sc)
             vid->stat |= 8;
@@ -1243,8 +1341,16 @@ vid_poll(void *priv)
 
                             if (video_force_resize_get())
                                 video_force_resize_set(0);
+
+                            if (vid->linecache) {
+                                linecache_invalidate(vid->linecache);
+                                vid->linecache->dirty = 1;
+                            }
                         }
 
+                        if (vid->linecache && !vid->linecache->dirty && !monitors[monitor_index_global].mon_screenshots)
+                            goto blit_skipped;
+
                         if (enable_overscan) {
                             video_blit_memtoscreen(0, (vid->firstline - 4) << 1,
                                                    xsize, ((vid->lastline - vid->firstline) + 8) << 1);
@@ -1252,6 +1358,9 @@ vid_poll(void *priv)
                             video_blit_memtoscreen(8, vid->firstline << 1,
                                                    xsize, (vid->lastline - vid->firstline) << 1);
                         }
+blit_skipped:
+                        if (vid->linecache)
+                            vid->linecache->dirty = 0;
                     }
 
                     frames++;
@@ -1308,6 +1417,7 @@ vid_close(void *priv)
 {
     tandy_t *dev = (tandy_t *) priv;
 
+    linecache_free(dev->vid->linecache);
     free(dev->vid);
     dev->vid = NULL;
 }
@@ -1327,6 +1437,7 @@ vid_init(tandy_t *dev)
 
     display_type   = machine_get_config_int("display_type");
     vid->composite = (display_type != TANDY_RGB);
+    vid->linecache = linecache_alloc();
 
     cga_comp_init(1);
 
@@ -19,6 +19,7 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <wchar.h>
 #define HAVE_STDARG_H
@@ -40,12 +41,22 @@
 #include <86box/machine.h>
 #include <86box/isamem.h>
 #include <86box/pci.h>
+#include <86box/thread.h>
 #include <86box/plat_unused.h>
 
 int bios_only = 0;
 int machine;
 // int AT, PCI;
 
+/* Availability cache: -1 = not yet probed. Probes open every ROM image
+   of a machine, which is slow on network-mounted ROM sets, so each
+   machine is only ever probed once per run; the scan thread started by
+   machine_scan_start() fills the cache in the background so the
+   settings dialog finds it ready. */
+static int8_t   *machine_avail       = NULL;
+static mutex_t  *machine_avail_mutex = NULL;
+static thread_t *machine_scan_thread = NULL;
+
 #ifdef ENABLE_MACHINE_LOG
 int machine_do_log = ENABLE_MACHINE_LOG;
 
@@ -132,27 +143,95 @@ machine_init_ex(int m)
 void
 machine_init(void)
 {
+    /* Do not boot while the scan thread has a probe in flight - the
+       probes flip bios_only. */
+    if (machine_avail_mutex != NULL)
+        thread_wait_mutex(machine_avail_mutex);
+
     bios_only = 0;
     (void) machine_init_ex(machine);
+
+    if (machine_avail_mutex != NULL)
+        thread_release_mutex(machine_avail_mutex);
 }
 
 int
 machine_available(int m)
 {
     int             ret;
-    const device_t *dev = machine_get_device(m);
+    const device_t *dev;
+
+    if (machine_avail == NULL) {
+        machine_avail = (int8_t *) malloc(machine_count());
+        memset(machine_avail, -1, machine_count());
+    }
 
-    bios_only = 1;
+    /* Results are stable for the life of the process, and the bytes only
+       ever go from -1 to their final value, so the unlocked fast path is
+       safe; a miss is re-checked under the lock. */
+    if (machine_avail[m] >= 0)
+        return machine_avail[m];
 
-    ret = device_available(dev);
-    /* Do not check via machine_init_ex() if the device is not NULL and
-       it has a CONFIG_BIOS field. */
-    if ((dev == NULL) || (ret != -1))
-        ret = machine_init_ex(m);
+    if (machine_avail_mutex != NULL)
+        thread_wait_mutex(machine_avail_mutex);
 
-    bios_only = 0;
+    if (machine_avail[m] < 0) {
+        dev = machine_get_device(m);
+
+        bios_only = 1;
+
+        ret = device_available(dev);
+        /* Do not check via machine_init_ex() if the device is not NULL and
+           it has a CONFIG_BIOS field. */
+        if ((dev == NULL) || (ret != -1))
+            ret = machine_init_ex(m);
+
+        bios_only = 0;
+
+        machine_avail[m] = !!ret;
+    }
+
+    ret = machine_avail[m];
+
+    if (machine_avail_mutex != NULL)
+        thread_release_mutex(machine_avail_mutex);
+
+    return ret;
+}
+
+static void
+machine_scan_thread_fn(UNUSED(void *priv))
+{
+    const int count = machine_count();
+
+    for (int m = 0; m < count; m++)
+        (void) machine_available(m);
+
+    machine_log("Machine availability scan complete.\n");
+}
+
+void
+machine_scan_start(void)
+{
+    if (machine_scan_thread != NULL)
+        return;
+
+    /* The cache and its lock must exist before the thread does. */
+    (void) machine_available(machine);
+    if (machine_avail_mutex == NULL)
+        machine_avail_mutex = thread_create_mutex();
+
+    machine_scan_thread = thread_create_named(machine_scan_thread_fn, NULL, "machine scan");
+}
+
+void
+machine_scan_wait(void)
+{
+    if (machine_scan_thread == NULL)
+        return;
 
-    return !!ret;
+    thread_wait(machine_scan_thread);
+    machine_scan_thread = NULL;
 }
 
 void
@@ -30,29 +30,35 @@ machine_status_init(void)
 {
     for (size_t i = 0; i < FDD_NUM; ++i) {
         machine_status.fdd[i].empty  = (strlen(floppyfns[i]) == 0);
-        machine_status.fdd[i].active = false;
+        machine_status.fdd[i].active     = false;
+        machine_status.fdd[i].was_active = false;
     }
     for (size_t i = 0; i < CDROM_NUM; ++i) {
         machine_status.cdrom[i].empty  = (strlen(cdrom[i].image_path) == 0);
-        machine_status.cdrom[i].active = false;
+        machine_status.cdrom[i].active     = false;
+        machine_status.cdrom[i].was_active = false;
     }
     for (size_t i = 0; i < ZIP_NUM; i++) {
         machine_status.zip[i].empty  = (strlen(zip_drives[i].image_path) == 0);
-        machine_status.zip[i].active = false;
+        machine_status.zip[i].active     = false;
+        machine_status.zip[i].was_active = false;
     }
     for (size_t i = 0; i < MO_NUM; i++) {
         machine_status.mo[i].empty  = (strlen(mo_drives[i].image_path) == 0);
-        machine_status.mo[i].active = false;
+        machine_status.mo[i].active     = false;
+        machine_status.mo[i].was_active = false;
     }
 
     machine_status.cassette.empty = (strlen(cassette_fname) == 0);
 
     for (size_t i = 0; i < HDD_BUS_USB; i++) {
-        machine_status.hdd[i].active = false;
+        machine_status.hdd[i].active     = false;
+        machine_status.hdd[i].was_active = false;
     }
 
     for (size_t i = 0; i < NET_CARD_MAX; i++) {
-        machine_status.net[i].active = false;
+        machine_status.net[i].active     = false;
+        machine_status.net[i].was_active = false;
         machine_status.net[i].empty  = !network_is_connected(i);
     }
 }
@@ -35,6 +35,8 @@
 #include <86box/config.h>
 #include <86box/io.h>
 #include <86box/mem.h>
+#include <86box/mem_dump.h>
+#include <86box/perfctr.h>
 #include <86box/plat.h>
 #include <86box/rom.h>
 #include <86box/gdbstub.h>
@@ -66,38 +68,77 @@ mem_mapping_t ram_split_mapping;
 mem_mapping_t bios_mapping;
 mem_mapping_t bios_high_mapping;
 
-page_t  *pages;       /* RAM page table */
-page_t **page_lookup; /* pagetable lookup */
-uint32_t pages_sz;    /* #pages in table */
+/* The globals consulted on every memory reference - the TLB-style
+   lookup table pointers, the code fetch cache and the RAM mask - are
+   kept adjacent on one cache line of their own, so the per-instruction
+   working set does not drag in the cold configuration globals around
+   them. */
+_Alignas(64) page_t **page_lookup; /* pagetable lookup */
+uintptr_t *readlookup2;
+uintptr_t *writelookup2;
+uint8_t   *pccache2;
+uint32_t   pccache;
+uint32_t   rammask;
+uint32_t   mem_logical_addr;
+
+page_t  *pages;    /* RAM page table */
+uint32_t pages_sz; /* #pages in table */
 
 uint8_t *ram;  /* the virtual RAM */
 uint8_t *ram2; /* the virtual RAM */
 uint8_t  page_ff[4096];
-uint32_t rammask;
 uint32_t addr_space_size;
 
 uint8_t *rom; /* the virtual ROM */
 uint32_t biosmask;
 uint32_t biosaddr;
 
-uint32_t pccache;
-uint8_t *pccache2;
+/* Stash of the most recently evicted code page. Straight-line code that
+   straddles a page boundary alternates fetches between two pages; keeping
+   the outgoing page preresolved turns those crossings into tag swaps
+   instead of fresh MMU walks. Invalidated together with pccache. */
+static uint32_t pccache_stash_tag = 0xffffffff;
+static uint8_t *pccache_stash;
+static int      pccache_stash_prefetch;
 
 int        readlnext;
 int        readlookup[256];
-uintptr_t *readlookup2;
 uintptr_t  old_rl2;
 uint8_t    uncached = 0;
 int        writelnext;
 int        writelookup[256];
-uintptr_t *writelookup2;
-
-uint32_t mem_logical_addr;
 
 int shadowbios = 0;
 int shadowbios_write;
-int readlnum  = 0;
-int writelnum = 0;
+/*Paging-structure cache for the PAE walk, mirroring the PDE caches of
+  real CPUs: a TLB miss whose 2 MB region has a cached page directory
+  entry only probes the page table instead of walking down from CR3. The
+  invalidation rules are the architectural ones, so flushing the TLB
+  (CR3/CR0/CR4 writes, INVLPG) flushes this too; guests that modify a PDE
+  must do that anyway. Direct mapped on address bits 26:21.*/
+#define PDE_CACHE_SIZE 64
+
+static struct {
+    uint32_t tag; /*addr >> 21, 0xffffffff = empty*/
+    uint64_t pde;
+} pde_cache[PDE_CACHE_SIZE];
+
+static void
+pde_cache_flush(void)
+{
+    for (int c = 0; c < PDE_CACHE_SIZE; c++)
+        pde_cache[c].tag = 0xffffffff;
+}
+
+/*Lookup ring entries filled since the last MMU flush, and the ring
+  positions the current window started at. The rings fill sequentially,
+  so a flush only has to visit the slots actually used since the previous
+  one - guests that reload CR3 constantly (Win9x task switches) flush
+  near-empty rings most of the time.*/
+int        readlnum  = 0;
+int        writelnum = 0;
+static int readlstart  = 0;
+static int writelstart = 0;
 int cachesize = 256;
 
 uint32_t get_phys_virt;
@@ -123,12 +164,27 @@ uint8_t high_page = 0; /* if a high (> 4 gb) page was detected */
 mem_mapping_t        *read_mapping[MEM_MAPPINGS_NO];
 mem_mapping_t        *write_mapping[MEM_MAPPINGS_NO];
 
+mem_page_read_t       read_page_ops[MEM_MAPPINGS_NO];
+mem_page_write_t      write_page_ops[MEM_MAPPINGS_NO];
+
 uint8_t              *_mem_exec[MEM_MAPPINGS_NO];
 
+/*TLB permission metadata, one record per virtual page: the mmu_perm
+  bytes for the read lookup, the write lookup and the page_lookup write
+  path sit in the same word, so a TLB fill writes one spot and the
+  mmu_perm reload on a later hit reads the line the fill wrote instead
+  of three scattered byte arrays. The pointer-sized readlookup2 /
+  writelookup2 / page_lookup tables have to stay flat arrays - the
+  dynarec backends emit code that indexes them directly.*/
+typedef struct mmu_perm_rec_t {
+    uint8_t readp;  /* read lookup mmu_perm */
+    uint8_t writep; /* write lookup mmu_perm */
+    uint8_t pagep;  /* page_lookup write mmu_perm */
+    uint8_t pad;
+} mmu_perm_rec_t;
+
 /* FIXME: re-do this with a 'mem_ops' struct. */
-static uint8_t       *page_lookupp; /* pagetable mmu_perm lookup */
-static uint8_t       *readlookupp;
-static uint8_t       *writelookupp;
+static mmu_perm_rec_t *mmu_perm_recs; /* pagetable mmu_perm lookup */
 static mem_mapping_t *base_mapping;
 static mem_mapping_t *last_mapping;
 static mem_mapping_t *read_mapping_bus[MEM_MAPPINGS_NO];
@@ -187,38 +243,57 @@ resetreadlookup(void)
 
     /* Initialize the tables for high (> 1024K) RAM. */
     memset(readlookup2, 0xff, (1 << 20) * sizeof(uintptr_t));
-    memset(readlookupp, 0x04, (1 << 20) * sizeof(uint8_t));
-
     memset(writelookup2, 0xff, (1 << 20) * sizeof(uintptr_t));
-    memset(writelookupp, 0x04, (1 << 20) * sizeof(uint8_t));
 
-    readlnext  = 0;
-    writelnext = 0;
-    pccache    = 0xffffffff;
-    high_page  = 0;
+    memset(mmu_perm_recs, 0x04, (1 << 20) * sizeof(mmu_perm_rec_t));
+
+    readlnext   = 0;
+    writelnext  = 0;
+    readlnum    = 0;
+    writelnum   = 0;
+    readlstart  = 0;
+    writelstart = 0;
+    pde_cache_flush();
+    pccache           = 0xffffffff;
+    pccache_stash_tag = 0xffffffff;
+    high_page         = 0;
 }
 
 void
 flushmmucache(void)
 {
-    for (uint16_t c = 0; c < 256; c++) {
+    PERF_INC(PERF_MMU_FLUSH);
+
+    for (int i = 0; i < readlnum; i++) {
+        int c = (readlstart + i) & (cachesize - 1);
+
         if (readlookup[c] != (int) 0xffffffff) {
-            readlookup2[readlookup[c]] = LOOKUP_INV;
-            readlookupp[readlookup[c]] = 4;
-            readlookup[c]              = 0xffffffff;
+            readlookup2[readlookup[c]]         = LOOKUP_INV;
+            mmu_perm_recs[readlookup[c]].readp = 4;
+            readlookup[c]                      = 0xffffffff;
         }
+    }
+    for (int i = 0; i < writelnum; i++) {
+        int c = (writelstart + i) & (cachesize - 1);
+
         if (writelookup[c] != (int) 0xffffffff) {
-            page_lookup[writelookup[c]]  = NULL;
-            page_lookupp[writelookup[c]] = 4;
-            writelookup2[writelookup[c]] = LOOKUP_INV;
-            writelookupp[writelookup[c]] = 4;
-            writelookup[c]               = 0xffffffff;
+            page_lookup[writelookup[c]]          = NULL;
+            writelookup2[writelookup[c]]         = LOOKUP_INV;
+            mmu_perm_recs[writelookup[c]].writep = 4;
+            mmu_perm_recs[writelookup[c]].pagep  = 4;
+            writelookup[c]                       = 0xffffffff;
         }
     }
+    readlstart  = readlnext;
+    writelstart = writelnext;
+    readlnum    = 0;
+    writelnum   = 0;
+    pde_cache_flush();
     mmuflush++;
 
-    pccache  = (uint32_t) 0xffffffff;
-    pccache2 = (uint8_t *) 0xffffffff;
+    pccache           = (uint32_t) 0xffffffff;
+    pccache2          = (uint8_t *) 0xffffffff;
+    pccache_stash_tag = 0xffffffff;
 
 #ifdef USE_DYNAREC
     codegen_flush();
@@ -228,20 +303,33 @@ flushmmucache(void)
 void
 flushmmucache_nopc(void)
 {
-    for (uint16_t c = 0; c < 256; c++) {
+    PERF_INC(PERF_MMU_FLUSH);
+
+    for (int i = 0; i < readlnum; i++) {
+        int c = (readlstart + i) & (cachesize - 1);
+
         if (readlookup[c] != (int) 0xffffffff) {
-            readlookup2[readlookup[c]] = LOOKUP_INV;
-            readlookupp[readlookup[c]] = 4;
-            readlookup[c]              = 0xffffffff;
+            readlookup2[readlookup[c]]         = LOOKUP_INV;
+            mmu_perm_recs[readlookup[c]].readp = 4;
+            readlookup[c]                      = 0xffffffff;
         }
+    }
+    for (int i = 0; i < writelnum; i++) {
+        int c = (writelstart + i) & (cachesize - 1);
+
         if (writelookup[c] != (int) 0xffffffff) {
-            page_lookup[writelookup[c]]  = NULL;
-            page_lookupp[writelookup[c]] = 4;
-            writelookup2[writelookup[c]] = LOOKUP_INV;
-            writelookupp[writelookup[c]] = 4;
-            writelookup[c]               = 0xffffffff;
+            page_lookup[writelookup[c]]          = NULL;
+            writelookup2[writelookup[c]]         = LOOKUP_INV;
+            mmu_perm_recs[writelookup[c]].writep = 4;
+            mmu_perm_recs[writelookup[c]].pagep  = 4;
+            writelookup[c]                       = 0xffffffff;
         }
     }
+    readlstart  = readlnext;
+    writelstart = writelnext;
+    readlnum    = 0;
+    writelnum   = 0;
+    pde_cache_flush();
 }
 
 void
@@ -361,6 +449,33 @@ mmutranslatereal_pae(uint32_t addr, int rw)
     if (cpu_state.abrt)
         return 0xffffffffffffffffULL;
 
+    if (pde_cache[(addr >> 21) & (PDE_CACHE_SIZE - 1)].tag == (addr >> 21)) {
+        /*PDE hit - only the page table entry has to be probed. The
+          permission check below uses PTE & PDE bits, as the full walk
+          does, and the accessed bits of the upper levels were set when
+          the entry was cached.*/
+        temp4 = pde_cache[(addr >> 21) & (PDE_CACHE_SIZE - 1)].pde;
+        addr4 = (temp4 & ~0xfffULL) + ((addr >> 9) & 0xff8);
+        temp  = rammap64(addr4) & 0x000000ffffffffffULL;
+        temp3 = temp & temp4;
+        if (!(temp & 1) || ((CPL == 3) && !(temp3 & 4) && !cpl_override) || (rw && !(temp3 & 2) && (((CPL == 3) && !cpl_override) || (cr0 & WP_FLAG)))) {
+            cr2 = addr;
+            temp &= 1;
+            if (CPL == 3)
+                temp |= 4;
+            if (rw)
+                temp |= 2;
+            cpu_state.abrt = ABRT_PF;
+            abrt_error     = temp;
+            return 0xffffffffffffffffULL;
+        }
+
+        mmu_perm = temp & 4;
+        rammap64(addr4) |= (rw ? 0x60 : 0x20);
+
+        return ((temp & ~0xfffULL) + ((uint64_t) (addr & 0xfff))) & 0x000000ffffffffffULL;
+    }
+
     addr2 = (cr3 & ~0x1f) + ((addr >> 27) & 0x18);
     temp = temp2 = rammap64(addr2) & 0x000000ffffffffffULL;
     if (!(temp & 1)) {
@@ -429,6 +544,9 @@ mmutranslatereal_pae(uint32_t addr, int rw)
     rammap64(addr3) |= 0x20;
     rammap64(addr4) |= (rw ? 0x60 : 0x20);
 
+    pde_cache[(addr >> 21) & (PDE_CACHE_SIZE - 1)].tag = addr >> 21;
+    pde_cache[(addr >> 21) & (PDE_CACHE_SIZE - 1)].pde = temp4;
+
     return ((temp & ~0xfffULL) + ((uint64_t) (addr & 0xfff))) & 0x000000ffffffffffULL;
 }
 
@@ -568,6 +686,44 @@ mem_addr_translate(uint32_t addr, uint32_t chunk_start, uint32_t len)
     return chunk_start + (addr & mask);
 }
 
+/*Dirty-page tracking state - see mem.h. mem_dirty_flags holds one bit per
+  client per RAM page so a page is appended to each client's list at most
+  once per collection window; the windows are rearmed by flushing the
+  write lookup ring, which funnels the next write to every page back
+  through addwritelookup().*/
+typedef struct mem_dirty_client_t {
+    uint32_t *dirty_pages;
+    uint32_t  num;
+} mem_dirty_client_t;
+
+static mem_dirty_client_t mem_dirty_client[MEM_DIRTY_MAX_CLIENTS];
+static uint8_t           *mem_dirty_flags   = NULL;
+static uint8_t            mem_dirty_clients = 0;
+
+static void
+mem_dirty_mark(uint32_t page)
+{
+    uint8_t todo;
+
+    if (page >= pages_sz)
+        return;
+
+    /* Let an in-flight RAM dump copy the page before the store that
+       funneled us here lands on it. */
+    if (mem_dump_active)
+        mem_dump_cow(page);
+
+    todo = mem_dirty_clients & ~mem_dirty_flags[page];
+    if (!todo)
+        return;
+
+    mem_dirty_flags[page] |= todo;
+    for (uint8_t c = 0; todo; c++, todo >>= 1) {
+        if (todo & 1)
+            mem_dirty_client[c].dirty_pages[mem_dirty_client[c].num++] = page;
+    }
+}
+
 void
 addreadlookup(uint32_t virt, uint32_t phys)
 {
@@ -597,10 +753,14 @@ addreadlookup(uint32_t virt, uint32_t phys)
     else
         readlookup2[virt >> 12] = (uintptr_t) &ram[a];
 #endif
-    readlookupp[virt >> 12] = mmu_perm;
+    mmu_perm_recs[virt >> 12].readp = mmu_perm;
 
     readlookup[readlnext++] = virt >> 12;
     readlnext &= (cachesize - 1);
+    if (readlnum < cachesize)
+        readlnum++;
+
+    PERF_INC(PERF_MMU_LOOKUP_FILL);
 
     cycles -= 9;
 }
@@ -636,8 +796,8 @@ addwritelookup(uint32_t virt, uint32_t phys)
     if (pages[phys >> 12].block[0] || pages[phys >> 12].block[1] || pages[phys >> 12].block[2] || pages[phys >> 12].block[3]) {
 #    endif
 #endif
-        page_lookup[virt >> 12]  = &pages[phys >> 12];
-        page_lookupp[virt >> 12] = mmu_perm;
+        page_lookup[virt >> 12]         = &pages[phys >> 12];
+        mmu_perm_recs[virt >> 12].pagep = mmu_perm;
     } else {
 #if (defined __amd64__ || defined _M_X64 || defined __aarch64__ || defined _M_ARM64)
         writelookup2[virt >> 12] = (uintptr_t) &ram[(uintptr_t) (phys & ~0xFFF) - (uintptr_t) (virt & ~0xfff)];
@@ -650,10 +810,17 @@ addwritelookup(uint32_t virt, uint32_t phys)
             writelookup2[virt >> 12] = (uintptr_t) &ram[a];
 #endif
     }
-    writelookupp[virt >> 12] = mmu_perm;
+    mmu_perm_recs[virt >> 12].writep = mmu_perm;
+
+    if (mem_dirty_clients)
+        mem_dirty_mark(phys >> 12);
 
     writelookup[writelnext++] = virt >> 12;
     writelnext &= (cachesize - 1);
+    if (writelnum < cachesize)
+        writelnum++;
+
+    PERF_INC(PERF_MMU_LOOKUP_FILL);
 
     cycles -= 9;
 }
@@ -666,6 +833,21 @@ getpccache(uint32_t a)
     uint8_t *p;
 #endif
     uint32_t a2;
+    uint8_t *ret;
+
+    /* Promote the stashed page on a hit, demoting the outgoing one; the
+       caller updates pccache/pccache2 with the returned mapping. */
+    if ((a >> 12) == pccache_stash_tag) {
+        ret               = pccache_stash;
+        pccache_stash_tag = pccache;
+        pccache_stash     = pccache2;
+        if (is286) {
+            int cyc                = pccache_stash_prefetch;
+            pccache_stash_prefetch = cpu_prefetch_cycles;
+            cpu_prefetch_cycles    = cyc;
+        }
+        return ret;
+    }
 
     a2 = a;
 
@@ -678,6 +860,14 @@ getpccache(uint32_t a)
     a64 &= rammask;
 
     if (_mem_exec[a64 >> MEM_GRANULARITY_BITS]) {
+        /* Demote the outgoing page into the stash before the prefetch
+           timing below is recomputed for the incoming one. */
+        if (pccache != 0xffffffff) {
+            pccache_stash_tag      = pccache;
+            pccache_stash          = pccache2;
+            pccache_stash_prefetch = cpu_prefetch_cycles;
+        }
+
         if (is286) {
             if (read_mapping[a64 >> MEM_GRANULARITY_BITS] && (read_mapping[a64 >> MEM_GRANULARITY_BITS]->flags & MEM_MAPPING_ROM_WS))
                 cpu_prefetch_cycles = cpu_rom_prefetch_cycles;
@@ -701,16 +891,16 @@ getpccache(uint32_t a)
 uint8_t
 read_mem_b(uint32_t addr)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
     uint8_t        ret        = 0xff;
     int            old_cycles = cycles;
 
     mem_logical_addr = addr;
     addr &= rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->read_b)
-        ret = map->read_b(addr, map->priv);
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (rops->read_b)
+        ret = rops->read_b(addr, rops->priv);
 
     resub_cycles(old_cycles);
 
@@ -720,7 +910,7 @@ read_mem_b(uint32_t addr)
 uint16_t
 read_mem_w(uint32_t addr)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
     uint16_t       ret        = 0xffff;
     int            old_cycles = cycles;
 
@@ -730,12 +920,12 @@ read_mem_w(uint32_t addr)
     if (addr & 1)
         ret = read_mem_b(addr) | (read_mem_b(addr + 1) << 8);
     else {
-        map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+        rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-        if (map && map->read_w)
-            ret = map->read_w(addr, map->priv);
-        else if (map && map->read_b)
-            ret = map->read_b(addr, map->priv) | (map->read_b(addr + 1, map->priv) << 8);
+        if (rops->read_w)
+            ret = rops->read_w(addr, rops->priv);
+        else if (rops->read_b)
+            ret = rops->read_b(addr, rops->priv) | (rops->read_b(addr + 1, rops->priv) << 8);
     }
 
     resub_cycles(old_cycles);
@@ -746,15 +936,15 @@ read_mem_w(uint32_t addr)
 void
 write_mem_b(uint32_t addr, uint8_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
     int            old_cycles = cycles;
 
     mem_logical_addr = addr;
     addr &= rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->write_b)
-        map->write_b(addr, val, map->priv);
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (wops->write_b)
+        wops->write_b(addr, val, wops->priv);
 
     resub_cycles(old_cycles);
 }
@@ -762,7 +952,7 @@ write_mem_b(uint32_t addr, uint8_t val)
 void
 write_mem_w(uint32_t addr, uint16_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
     int            old_cycles = cycles;
 
     mem_logical_addr = addr;
@@ -772,14 +962,12 @@ write_mem_w(uint32_t addr, uint16_t val)
         write_mem_b(addr, val);
         write_mem_b(addr + 1, val >> 8);
     } else {
-        map = write_mapping[addr >> MEM_GRANULARITY_BITS];
-        if (map) {
-            if (map->write_w)
-                map->write_w(addr, val, map->priv);
-            else if (map->write_b) {
-                map->write_b(addr, val, map->priv);
-                map->write_b(addr + 1, val >> 8, map->priv);
-            }
+        wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
+        if (wops->write_w)
+            wops->write_w(addr, val, wops->priv);
+        else if (wops->write_b) {
+            wops->write_b(addr, val, wops->priv);
+            wops->write_b(addr + 1, val >> 8, wops->priv);
         }
     }
 
@@ -789,7 +977,7 @@ write_mem_w(uint32_t addr, uint16_t val)
 uint8_t
 readmembl(uint32_t addr)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
     uint64_t       a;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_READ, 1);
@@ -811,9 +999,9 @@ readmembl(uint32_t addr)
     }
     addr = (uint32_t) (addr64 & rammask);
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->read_b)
-        return map->read_b(addr, map->priv);
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (rops->read_b)
+        return rops->read_b(addr, rops->priv);
 
     return 0xff;
 }
@@ -821,7 +1009,7 @@ readmembl(uint32_t addr)
 void
 writemembl(uint32_t addr, uint8_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
     uint64_t       a;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_WRITE, 1);
@@ -848,16 +1036,16 @@ writemembl(uint32_t addr, uint8_t val)
     }
     addr = (uint32_t) (addr64 & rammask);
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->write_b)
-        map->write_b(addr, val, map->priv);
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (wops->write_b)
+        wops->write_b(addr, val, wops->priv);
 }
 
 /* Read a byte from memory without MMU translation - result of previous MMU translation passed as value. */
 uint8_t
 readmembl_no_mmut(uint32_t addr, uint32_t a64)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_READ, 1);
 
@@ -871,9 +1059,9 @@ readmembl_no_mmut(uint32_t addr, uint32_t a64)
     } else
         addr &= rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->read_b)
-        return map->read_b(addr, map->priv);
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (rops->read_b)
+        return rops->read_b(addr, rops->priv);
 
     return 0xff;
 }
@@ -882,7 +1070,7 @@ readmembl_no_mmut(uint32_t addr, uint32_t a64)
 void
 writemembl_no_mmut(uint32_t addr, uint32_t a64, uint8_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_WRITE, 1);
 
@@ -901,15 +1089,15 @@ writemembl_no_mmut(uint32_t addr, uint32_t a64, uint8_t val)
     } else
         addr &= rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->write_b)
-        map->write_b(addr, val, map->priv);
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (wops->write_b)
+        wops->write_b(addr, val, wops->priv);
 }
 
 uint16_t
 readmemwl(uint32_t addr)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
     uint64_t       a;
 
     addr64a[0] = addr;
@@ -940,7 +1128,7 @@ readmemwl(uint32_t addr)
 
             return readmembl_no_mmut(addr, addr64a[0]) | (((uint16_t) readmembl_no_mmut(addr + 1, addr64a[1])) << 8);
         } else if (readlookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
-            mmu_perm = readlookupp[addr >> 12];
+            mmu_perm = mmu_perm_recs[addr >> 12].readp;
             return *(uint16_t *) (readlookup2[addr >> 12] + addr);
         }
     }
@@ -956,13 +1144,13 @@ readmemwl(uint32_t addr)
 
     addr = addr64a[0] & rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->read_w)
-        return map->read_w(addr, map->priv);
+    if (rops->read_w)
+        return rops->read_w(addr, rops->priv);
 
-    if (map && map->read_b) {
-        return map->read_b(addr, map->priv) | ((uint16_t) (map->read_b(addr + 1, map->priv)) << 8);
+    if (rops->read_b) {
+        return rops->read_b(addr, rops->priv) | ((uint16_t) (rops->read_b(addr + 1, rops->priv)) << 8);
     }
 
     return 0xffff;
@@ -971,7 +1159,7 @@ readmemwl(uint32_t addr)
 void
 writememwl(uint32_t addr, uint16_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
     uint64_t       a;
 
     addr64a[0] = addr;
@@ -1010,7 +1198,7 @@ writememwl(uint32_t addr, uint16_t val)
             writemembl_no_mmut(addr + 1, addr64a[1], val >> 8);
             return;
         } else if (writelookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
-            mmu_perm                                        = writelookupp[addr >> 12];
+            mmu_perm                                        = mmu_perm_recs[addr >> 12].writep;
             *(uint16_t *) (writelookup2[addr >> 12] + addr) = val;
             return;
         }
@@ -1018,7 +1206,7 @@ writememwl(uint32_t addr, uint16_t val)
 
     if (page_lookup[addr >> 12] && page_lookup[addr >> 12]->write_w) {
         page_lookup[addr >> 12]->write_w(addr, val, page_lookup[addr >> 12]);
-        mmu_perm = page_lookupp[addr >> 12];
+        mmu_perm = mmu_perm_recs[addr >> 12].pagep;
         return;
     }
 
@@ -1032,16 +1220,16 @@ writememwl(uint32_t addr, uint16_t val)
 
     addr = addr64a[0] & rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->write_w) {
-        map->write_w(addr, val, map->priv);
+    if (wops->write_w) {
+        wops->write_w(addr, val, wops->priv);
         return;
     }
 
-    if (map && map->write_b) {
-        map->write_b(addr, val, map->priv);
-        map->write_b(addr + 1, val >> 8, map->priv);
+    if (wops->write_b) {
+        wops->write_b(addr, val, wops->priv);
+        wops->write_b(addr + 1, val >> 8, wops->priv);
         return;
     }
 }
@@ -1050,7 +1238,7 @@ writememwl(uint32_t addr, uint16_t val)
 uint16_t
 readmemwl_no_mmut(uint32_t addr, uint32_t *a64)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_READ, 2);
 
@@ -1067,7 +1255,7 @@ readmemwl_no_mmut(uint32_t addr, uint32_t *a64)
 
             return readmembl_no_mmut(addr, a64[0]) | (((uint16_t) readmembl_no_mmut(addr + 1, a64[1])) << 8);
         } else if (readlookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
-            mmu_perm = readlookupp[addr >> 12];
+            mmu_perm = mmu_perm_recs[addr >> 12].readp;
             return *(uint16_t *) (readlookup2[addr >> 12] + addr);
         }
     }
@@ -1080,13 +1268,13 @@ readmemwl_no_mmut(uint32_t addr, uint32_t *a64)
     } else
         addr &= rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->read_w)
-        return map->read_w(addr, map->priv);
+    if (rops->read_w)
+        return rops->read_w(addr, rops->priv);
 
-    if (map && map->read_b) {
-        return map->read_b(addr, map->priv) | ((uint16_t) (map->read_b(addr + 1, map->priv)) << 8);
+    if (rops->read_b) {
+        return rops->read_b(addr, rops->priv) | ((uint16_t) (rops->read_b(addr + 1, rops->priv)) << 8);
     }
 
     return 0xffff;
@@ -1096,7 +1284,7 @@ readmemwl_no_mmut(uint32_t addr, uint32_t *a64)
 void
 writememwl_no_mmut(uint32_t addr, uint32_t *a64, uint16_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_WRITE, 2);
 
@@ -1115,14 +1303,14 @@ writememwl_no_mmut(uint32_t addr, uint32_t *a64, uint16_t val)
             writemembl_no_mmut(addr + 1, a64[1], val >> 8);
             return;
         } else if (writelookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
-            mmu_perm                                        = writelookupp[addr >> 12];
+            mmu_perm                                        = mmu_perm_recs[addr >> 12].writep;
             *(uint16_t *) (writelookup2[addr >> 12] + addr) = val;
             return;
         }
     }
 
     if (page_lookup[addr >> 12] && page_lookup[addr >> 12]->write_w) {
-        mmu_perm = page_lookupp[addr >> 12];
+        mmu_perm = mmu_perm_recs[addr >> 12].pagep;
         page_lookup[addr >> 12]->write_w(addr, val, page_lookup[addr >> 12]);
         return;
     }
@@ -1135,16 +1323,16 @@ writememwl_no_mmut(uint32_t addr, uint32_t *a64, uint16_t val)
     } else
         addr &= rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->write_w) {
-        map->write_w(addr, val, map->priv);
+    if (wops->write_w) {
+        wops->write_w(addr, val, wops->priv);
         return;
     }
 
-    if (map && map->write_b) {
-        map->write_b(addr, val, map->priv);
-        map->write_b(addr + 1, val >> 8, map->priv);
+    if (wops->write_b) {
+        wops->write_b(addr, val, wops->priv);
+        wops->write_b(addr + 1, val >> 8, wops->priv);
         return;
     }
 }
@@ -1152,7 +1340,7 @@ writememwl_no_mmut(uint32_t addr, uint32_t *a64, uint16_t val)
 uint32_t
 readmemll(uint32_t addr)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
     int            i;
     uint64_t       a = 0x0000000000000000ULL;
 
@@ -1198,7 +1386,7 @@ readmemll(uint32_t addr)
                their result as a parameter to be used if needed. */
             return readmemwl_no_mmut(addr, addr64a) | (((uint32_t) readmemwl_no_mmut(addr + 2, &(addr64a[2]))) << 16);
         } else if (readlookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
-            mmu_perm = readlookupp[addr >> 12];
+            mmu_perm = mmu_perm_recs[addr >> 12].readp;
             return *(uint32_t *) (readlookup2[addr >> 12] + addr);
         }
     }
@@ -1213,16 +1401,16 @@ readmemll(uint32_t addr)
 
     addr = addr64a[0] & rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->read_l)
-        return map->read_l(addr, map->priv);
+    if (rops->read_l)
+        return rops->read_l(addr, rops->priv);
 
-    if (map && map->read_w)
-        return map->read_w(addr, map->priv) | ((uint32_t) (map->read_w(addr + 2, map->priv)) << 16);
+    if (rops->read_w)
+        return rops->read_w(addr, rops->priv) | ((uint32_t) (rops->read_w(addr + 2, rops->priv)) << 16);
 
-    if (map && map->read_b)
-        return map->read_b(addr, map->priv) | ((uint32_t) (map->read_b(addr + 1, map->priv)) << 8) | ((uint32_t) (map->read_b(addr + 2, map->priv)) << 16) | ((uint32_t) (map->read_b(addr + 3, map->priv)) << 24);
+    if (rops->read_b)
+        return rops->read_b(addr, rops->priv) | ((uint32_t) (rops->read_b(addr + 1, rops->priv)) << 8) | ((uint32_t) (rops->read_b(addr + 2, rops->priv)) << 16) | ((uint32_t) (rops->read_b(addr + 3, rops->priv)) << 24);
 
     return 0xffffffff;
 }
@@ -1230,7 +1418,7 @@ readmemll(uint32_t addr)
 void
 writememll(uint32_t addr, uint32_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
     int            i;
     uint64_t       a = 0x0000000000000000ULL;
 
@@ -1282,14 +1470,14 @@ writememll(uint32_t addr, uint32_t val)
             writememwl_no_mmut(addr + 2, &(addr64a[2]), val >> 16);
             return;
         } else if (writelookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
-            mmu_perm                                        = writelookupp[addr >> 12];
+            mmu_perm                                        = mmu_perm_recs[addr >> 12].writep;
             *(uint32_t *) (writelookup2[addr >> 12] + addr) = val;
             return;
         }
     }
 
     if (page_lookup[addr >> 12] && page_lookup[addr >> 12]->write_l) {
-        mmu_perm = page_lookupp[addr >> 12];
+        mmu_perm = mmu_perm_recs[addr >> 12].pagep;
         page_lookup[addr >> 12]->write_l(addr, val, page_lookup[addr >> 12]);
         return;
     }
@@ -1304,22 +1492,22 @@ writememll(uint32_t addr, uint32_t val)
 
     addr = addr64a[0] & rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->write_l) {
-        map->write_l(addr, val, map->priv);
+    if (wops->write_l) {
+        wops->write_l(addr, val, wops->priv);
         return;
     }
-    if (map && map->write_w) {
-        map->write_w(addr, val, map->priv);
-        map->write_w(addr + 2, val >> 16, map->priv);
+    if (wops->write_w) {
+        wops->write_w(addr, val, wops->priv);
+        wops->write_w(addr + 2, val >> 16, wops->priv);
         return;
     }
-    if (map && map->write_b) {
-        map->write_b(addr, val, map->priv);
-        map->write_b(addr + 1, val >> 8, map->priv);
-        map->write_b(addr + 2, val >> 16, map->priv);
-        map->write_b(addr + 3, val >> 24, map->priv);
+    if (wops->write_b) {
+        wops->write_b(addr, val, wops->priv);
+        wops->write_b(addr + 1, val >> 8, wops->priv);
+        wops->write_b(addr + 2, val >> 16, wops->priv);
+        wops->write_b(addr + 3, val >> 24, wops->priv);
         return;
     }
 }
@@ -1328,7 +1516,7 @@ writememll(uint32_t addr, uint32_t val)
 uint32_t
 readmemll_no_mmut(uint32_t addr, uint32_t *a64)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_READ, 4);
 
@@ -1345,7 +1533,7 @@ readmemll_no_mmut(uint32_t addr, uint32_t *a64)
 
             return readmemwl_no_mmut(addr, a64) | ((uint32_t) (readmemwl_no_mmut(addr + 2, &(a64[2]))) << 16);
         } else if (readlookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
-            mmu_perm = readlookupp[addr >> 12];
+            mmu_perm = mmu_perm_recs[addr >> 12].readp;
             return *(uint32_t *) (readlookup2[addr >> 12] + addr);
         }
     }
@@ -1358,16 +1546,16 @@ readmemll_no_mmut(uint32_t addr, uint32_t *a64)
     } else
         addr &= rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->read_l)
-        return map->read_l(addr, map->priv);
+    if (rops->read_l)
+        return rops->read_l(addr, rops->priv);
 
-    if (map && map->read_w)
-        return map->read_w(addr, map->priv) | ((uint32_t) (map->read_w(addr + 2, map->priv)) << 16);
+    if (rops->read_w)
+        return rops->read_w(addr, rops->priv) | ((uint32_t) (rops->read_w(addr + 2, rops->priv)) << 16);
 
-    if (map && map->read_b)
-        return map->read_b(addr, map->priv) | ((uint32_t) (map->read_b(addr + 1, map->priv)) << 8) | ((uint32_t) (map->read_b(addr + 2, map->priv)) << 16) | ((uint32_t) (map->read_b(addr + 3, map->priv)) << 24);
+    if (rops->read_b)
+        return rops->read_b(addr, rops->priv) | ((uint32_t) (rops->read_b(addr + 1, rops->priv)) << 8) | ((uint32_t) (rops->read_b(addr + 2, rops->priv)) << 16) | ((uint32_t) (rops->read_b(addr + 3, rops->priv)) << 24);
 
     return 0xffffffff;
 }
@@ -1376,7 +1564,7 @@ readmemll_no_mmut(uint32_t addr, uint32_t *a64)
 void
 writememll_no_mmut(uint32_t addr, uint32_t *a64, uint32_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_WRITE, 4);
 
@@ -1395,14 +1583,14 @@ writememll_no_mmut(uint32_t addr, uint32_t *a64, uint32_t val)
             writememwl_no_mmut(addr + 2, &(a64[2]), val >> 16);
             return;
         } else if (writelookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
-            mmu_perm                                        = writelookupp[addr >> 12];
+            mmu_perm                                        = mmu_perm_recs[addr >> 12].writep;
             *(uint32_t *) (writelookup2[addr >> 12] + addr) = val;
             return;
         }
     }
 
     if (page_lookup[addr >> 12] && page_lookup[addr >> 12]->write_l) {
-        mmu_perm = page_lookupp[addr >> 12];
+        mmu_perm = mmu_perm_recs[addr >> 12].pagep;
         page_lookup[addr >> 12]->write_l(addr, val, page_lookup[addr >> 12]);
         return;
     }
@@ -1415,22 +1603,22 @@ writememll_no_mmut(uint32_t addr, uint32_t *a64, uint32_t val)
     } else
         addr &= rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->write_l) {
-        map->write_l(addr, val, map->priv);
+    if (wops->write_l) {
+        wops->write_l(addr, val, wops->priv);
         return;
     }
-    if (map && map->write_w) {
-        map->write_w(addr, val, map->priv);
-        map->write_w(addr + 2, val >> 16, map->priv);
+    if (wops->write_w) {
+        wops->write_w(addr, val, wops->priv);
+        wops->write_w(addr + 2, val >> 16, wops->priv);
         return;
     }
-    if (map && map->write_b) {
-        map->write_b(addr, val, map->priv);
-        map->write_b(addr + 1, val >> 8, map->priv);
-        map->write_b(addr + 2, val >> 16, map->priv);
-        map->write_b(addr + 3, val >> 24, map->priv);
+    if (wops->write_b) {
+        wops->write_b(addr, val, wops->priv);
+        wops->write_b(addr + 1, val >> 8, wops->priv);
+        wops->write_b(addr + 2, val >> 16, wops->priv);
+        wops->write_b(addr + 3, val >> 24, wops->priv);
         return;
     }
 }
@@ -1438,7 +1626,7 @@ writememll_no_mmut(uint32_t addr, uint32_t *a64, uint32_t val)
 uint64_t
 readmemql(uint32_t addr)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
     int            i;
     uint64_t       a = 0x0000000000000000ULL;
 
@@ -1483,7 +1671,7 @@ readmemql(uint32_t addr)
                their result as a parameter to be used if needed. */
             return readmemll_no_mmut(addr, addr64a) | (((uint64_t) readmemll_no_mmut(addr + 4, &(addr64a[4]))) << 32);
         } else if (readlookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
-            mmu_perm = readlookupp[addr >> 12];
+            mmu_perm = mmu_perm_recs[addr >> 12].readp;
             return *(uint64_t *) (readlookup2[addr >> 12] + addr);
         }
     }
@@ -1498,9 +1686,9 @@ readmemql(uint32_t addr)
 
     addr = addr64a[0] & rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->read_l)
-        return map->read_l(addr, map->priv) | ((uint64_t) map->read_l(addr + 4, map->priv) << 32);
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (rops->read_l)
+        return rops->read_l(addr, rops->priv) | ((uint64_t) rops->read_l(addr + 4, rops->priv) << 32);
 
     return readmemll(addr) | ((uint64_t) readmemll(addr + 4) << 32);
 }
@@ -1508,7 +1696,7 @@ readmemql(uint32_t addr)
 void
 writememql(uint32_t addr, uint64_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
     int            i;
     uint64_t       a = 0x0000000000000000ULL;
 
@@ -1559,14 +1747,14 @@ writememql(uint32_t addr, uint64_t val)
             writememll_no_mmut(addr + 4, &(addr64a[4]), val >> 32);
             return;
         } else if (writelookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
-            mmu_perm                                        = writelookupp[addr >> 12];
+            mmu_perm                                        = mmu_perm_recs[addr >> 12].writep;
             *(uint64_t *) (writelookup2[addr >> 12] + addr) = val;
             return;
         }
     }
 
     if (page_lookup[addr >> 12] && page_lookup[addr >> 12]->write_l) {
-        mmu_perm = page_lookupp[addr >> 12];
+        mmu_perm = mmu_perm_recs[addr >> 12].pagep;
         page_lookup[addr >> 12]->write_l(addr, val, page_lookup[addr >> 12]);
         page_lookup[addr >> 12]->write_l(addr + 4, val >> 32, page_lookup[addr >> 12]);
         return;
@@ -1580,29 +1768,29 @@ writememql(uint32_t addr, uint64_t val)
 
     addr = addr64a[0] & rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->write_l) {
-        map->write_l(addr, val, map->priv);
-        map->write_l(addr + 4, val >> 32, map->priv);
+    if (wops->write_l) {
+        wops->write_l(addr, val, wops->priv);
+        wops->write_l(addr + 4, val >> 32, wops->priv);
         return;
     }
-    if (map && map->write_w) {
-        map->write_w(addr, val, map->priv);
-        map->write_w(addr + 2, val >> 16, map->priv);
-        map->write_w(addr + 4, val >> 32, map->priv);
-        map->write_w(addr + 6, val >> 48, map->priv);
+    if (wops->write_w) {
+        wops->write_w(addr, val, wops->priv);
+        wops->write_w(addr + 2, val >> 16, wops->priv);
+        wops->write_w(addr + 4, val >> 32, wops->priv);
+        wops->write_w(addr + 6, val >> 48, wops->priv);
         return;
     }
-    if (map && map->write_b) {
-        map->write_b(addr, val, map->priv);
-        map->write_b(addr + 1, val >> 8, map->priv);
-        map->write_b(addr + 2, val >> 16, map->priv);
-        map->write_b(addr + 3, val >> 24, map->priv);
-        map->write_b(addr + 4, val >> 32, map->priv);
-        map->write_b(addr + 5, val >> 40, map->priv);
-        map->write_b(addr + 6, val >> 48, map->priv);
-        map->write_b(addr + 7, val >> 56, map->priv);
+    if (wops->write_b) {
+        wops->write_b(addr, val, wops->priv);
+        wops->write_b(addr + 1, val >> 8, wops->priv);
+        wops->write_b(addr + 2, val >> 16, wops->priv);
+        wops->write_b(addr + 3, val >> 24, wops->priv);
+        wops->write_b(addr + 4, val >> 32, wops->priv);
+        wops->write_b(addr + 5, val >> 40, wops->priv);
+        wops->write_b(addr + 6, val >> 48, wops->priv);
+        wops->write_b(addr + 7, val >> 56, wops->priv);
         return;
     }
 }
@@ -1651,7 +1839,7 @@ do_mmutranslate(uint32_t addr, uint32_t *a64, int num, int write)
                 a64[i] = (uint32_t) a;
             }
         } else
-            mmu_perm = page_lookupp[addr >> 12];
+            mmu_perm = mmu_perm_recs[addr >> 12].pagep;
 
         addr++;
     }
@@ -1738,6 +1926,20 @@ mem_read_phys(void *dest, uint32_t addr, int transfer_size)
     }
 }
 
+uint8_t *
+mem_read_phys_ptr(uint32_t addr, uint32_t len)
+{
+    mem_mapping_t *map = read_mapping_bus[addr >> MEM_GRANULARITY_BITS];
+
+    if ((len == 0) || (((addr & MEM_GRANULARITY_MASK) + len) > MEM_GRANULARITY_SIZE))
+        return NULL;
+
+    if (!cpu_use_exec || (map == NULL) || (map->exec == NULL))
+        return NULL;
+
+    return &map->exec[(addr - map->base) & map->mask];
+}
+
 void
 mem_writeb_phys(uint32_t addr, uint8_t val)
 {
@@ -1810,6 +2012,78 @@ mem_write_phys(void *src, uint32_t addr, int transfer_size)
     }
 }
 
+uint8_t *
+mem_write_phys_ptr(uint32_t addr, uint32_t len)
+{
+    mem_mapping_t *map = write_mapping_bus[addr >> MEM_GRANULARITY_BITS];
+
+    if ((len == 0) || (((addr & MEM_GRANULARITY_MASK) + len) > MEM_GRANULARITY_SIZE))
+        return NULL;
+
+    if (!cpu_use_exec || (map == NULL) || (map->exec == NULL))
+        return NULL;
+
+    mem_logical_addr = 0xffffffff;
+
+    return &map->exec[(addr - map->base) & map->mask];
+}
+
+void
+mem_read_phys_buf(void *dest, uint32_t addr, uint32_t len)
+{
+    uint8_t       *p = (uint8_t *) dest;
+    const uint8_t *src;
+    uint32_t       run;
+
+    while (len > 0) {
+        /* Resolve the mapping once per granularity block run. */
+        run = MEM_GRANULARITY_SIZE - (addr & MEM_GRANULARITY_MASK);
+        if (run > len)
+            run = len;
+
+        src = mem_read_phys_ptr(addr, run);
+        if (src != NULL)
+            memcpy(p, src, run);
+        else {
+            /* MMIO or unmapped range: fall back to per-byte accesses. */
+            for (uint32_t i = 0; i < run; i++)
+                p[i] = mem_readb_phys(addr + i);
+        }
+
+        p += run;
+        addr += run;
+        len -= run;
+    }
+}
+
+void
+mem_write_phys_buf(const void *src, uint32_t addr, uint32_t len)
+{
+    const uint8_t *p = (const uint8_t *) src;
+    uint8_t       *dest;
+    uint32_t       run;
+
+    while (len > 0) {
+        /* Resolve the mapping once per granularity block run. */
+        run = MEM_GRANULARITY_SIZE - (addr & MEM_GRANULARITY_MASK);
+        if (run > len)
+            run = len;
+
+        dest = mem_write_phys_ptr(addr, run);
+        if (dest != NULL)
+            memcpy(dest, p, run);
+        else {
+            /* MMIO or unmapped range: fall back to per-byte accesses. */
+            for (uint32_t i = 0; i < run; i++)
+                mem_writeb_phys(addr + i, p[i]);
+        }
+
+        p += run;
+        addr += run;
+        len -= run;
+    }
+}
+
 uint8_t
 mem_read_ram(uint32_t addr, UNUSED(void *priv))
 {
@@ -1929,6 +2203,21 @@ mem_write_ramb_page(uint32_t addr, uint8_t val, page_t *page)
     if (page == NULL)
         return;
 
+    if (mem_dirty_clients)
+        mem_dirty_mark(addr >> 12);
+
+    /* A page with no code on it needs none of the invalidation
+       bookkeeping below - store straight through, the same test
+       addwritelookup() uses to pick the fast write path. */
+#    ifdef USE_DYNAREC
+    if (!page->block && !codegen_in_recompile) {
+#    else
+    if (!page->block) {
+#    endif
+        page->mem[addr & 0xfff] = val;
+        return;
+    }
+
 #    ifdef USE_DYNAREC
     if ((page->mem == NULL) || (page->mem == page_ff) || (val != page->mem[addr & 0xfff]) || codegen_in_recompile) {
 #    else
@@ -1954,6 +2243,18 @@ mem_write_ramw_page(uint32_t addr, uint16_t val, page_t *page)
     if (page == NULL)
         return;
 
+    if (mem_dirty_clients)
+        mem_dirty_mark(addr >> 12);
+
+#    ifdef USE_DYNAREC
+    if (!page->block && !codegen_in_recompile) {
+#    else
+    if (!page->block) {
+#    endif
+        *(uint16_t *) &page->mem[addr & 0xfff] = val;
+        return;
+    }
+
 #    ifdef USE_DYNAREC
     if ((page->mem == NULL) || (page->mem == page_ff) || (val != *(uint16_t *) &page->mem[addr & 0xfff]) || codegen_in_recompile) {
 #    else
@@ -1989,6 +2290,18 @@ mem_write_raml_page(uint32_t addr, uint32_t val, page_t *page)
     if (page == NULL)
         return;
 
+    if (mem_dirty_clients)
+        mem_dirty_mark(addr >> 12);
+
+#    ifdef USE_DYNAREC
+    if (!page->block && !codegen_in_recompile) {
+#    else
+    if (!page->block) {
+#    endif
+        *(uint32_t *) &page->mem[addr & 0xfff] = val;
+        return;
+    }
+
 #    ifdef USE_DYNAREC
     if ((page->mem == NULL) || (page->mem == page_ff) || (val != *(uint32_t *) &page->mem[addr & 0xfff]) || codegen_in_recompile) {
 #    else
@@ -2021,6 +2334,21 @@ mem_write_ramb_page(uint32_t addr, uint8_t val, page_t *page)
     if (page == NULL)
         return;
 
+    if (mem_dirty_clients)
+        mem_dirty_mark(addr >> 12);
+
+    /* A page with no code on it needs none of the invalidation
+       bookkeeping below - store straight through, the same test
+       addwritelookup() uses to pick the fast write path. */
+#    ifdef USE_DYNAREC
+    if (!page->block[0] && !page->block[1] && !page->block[2] && !page->block[3] && !codegen_in_recompile) {
+#    else
+    if (!page->block[0] && !page->block[1] && !page->block[2] && !page->block[3]) {
+#    endif
+        page->mem[addr & 0xfff] = val;
+        return;
+    }
+
 #    ifdef USE_DYNAREC
     if ((page->mem == NULL) || (page->mem == page_ff) || (val != page->mem[addr & 0xfff]) || codegen_in_recompile) {
 #    else
@@ -2038,6 +2366,18 @@ mem_write_ramw_page(uint32_t addr, uint16_t val, page_t *page)
     if (page == NULL)
         return;
 
+    if (mem_dirty_clients)
+        mem_dirty_mark(addr >> 12);
+
+#    ifdef USE_DYNAREC
+    if (!page->block[0] && !page->block[1] && !page->block[2] && !page->block[3] && !codegen_in_recompile) {
+#    else
+    if (!page->block[0] && !page->block[1] && !page->block[2] && !page->block[3]) {
+#    endif
+        *(uint16_t *) &page->mem[addr & 0xfff] = val;
+        return;
+    }
+
 #    ifdef USE_DYNAREC
     if ((page->mem == NULL) || (page->mem == page_ff) || (val != *(uint16_t *) &page->mem[addr & 0xfff]) || codegen_in_recompile) {
 #    else
@@ -2057,6 +2397,18 @@ mem_write_raml_page(uint32_t addr, uint32_t val, page_t *page)
     if (page == NULL)
         return;
 
+    if (mem_dirty_clients)
+        mem_dirty_mark(addr >> 12);
+
+#    ifdef USE_DYNAREC
+    if (!page->block[0] && !page->block[1] && !page->block[2] && !page->block[3] && !codegen_in_recompile) {
+#    else
+    if (!page->block[0] && !page->block[1] && !page->block[2] && !page->block[3]) {
+#    endif
+        *(uint32_t *) &page->mem[addr & 0xfff] = val;
+        return;
+    }
+
 #    ifdef USE_DYNAREC
     if ((page->mem == NULL) || (page->mem == page_ff) || (val != *(uint32_t *) &page->mem[addr & 0xfff]) || codegen_in_recompile) {
 #    else
@@ -2239,6 +2591,70 @@ mem_write_remappedl2(uint32_t addr, uint32_t val, UNUSED(void *priv))
         *(uint32_t *) &ram[addr] = val;
 }
 
+int
+mem_dirty_register(void)
+{
+    for (uint8_t c = 0; c < MEM_DIRTY_MAX_CLIENTS; c++) {
+        if (!(mem_dirty_clients & (1 << c))) {
+            mem_dirty_client[c].dirty_pages = (uint32_t *) malloc(pages_sz * sizeof(uint32_t));
+            mem_dirty_client[c].num         = 0;
+            if (mem_dirty_flags == NULL) {
+                mem_dirty_flags = (uint8_t *) malloc(pages_sz);
+                memset(mem_dirty_flags, 0x00, pages_sz);
+            }
+            mem_dirty_clients |= (1 << c);
+            /*Force the first write to every page back through
+              addwritelookup() so it is seen by the new client.*/
+            flushmmucache_nopc();
+            return c;
+        }
+    }
+
+    return -1;
+}
+
+void
+mem_dirty_unregister(int client)
+{
+    mem_dirty_client_t *cl = &mem_dirty_client[client];
+
+    if (!(mem_dirty_clients & (1 << client)))
+        return;
+
+    for (uint32_t i = 0; i < cl->num; i++)
+        mem_dirty_flags[cl->dirty_pages[i]] &= ~(1 << client);
+    free(cl->dirty_pages);
+    cl->dirty_pages = NULL;
+    cl->num         = 0;
+
+    mem_dirty_clients &= ~(1 << client);
+    if (!mem_dirty_clients) {
+        free(mem_dirty_flags);
+        mem_dirty_flags = NULL;
+    }
+}
+
+uint32_t
+mem_dirty_get(int client, const uint32_t **dirty_pages)
+{
+    mem_dirty_client_t *cl  = &mem_dirty_client[client];
+    uint32_t            num = cl->num;
+
+    if (!(mem_dirty_clients & (1 << client)))
+        return 0;
+
+    *dirty_pages = cl->dirty_pages;
+
+    /*Rearm the window: forget the collected pages and flush the write
+      lookup ring so the next write to each page is tracked again.*/
+    for (uint32_t i = 0; i < num; i++)
+        mem_dirty_flags[cl->dirty_pages[i]] &= ~(1 << client);
+    cl->num = 0;
+    flushmmucache_nopc();
+
+    return num;
+}
+
 void
 mem_invalidate_range(uint32_t start_addr, uint32_t end_addr)
 {
@@ -2329,6 +2745,8 @@ mem_mapping_recalc(uint64_t base, uint64_t size)
         _mem_exec[c >> MEM_GRANULARITY_BITS]         = NULL;
         write_mapping[c >> MEM_GRANULARITY_BITS]     = NULL;
         read_mapping[c >> MEM_GRANULARITY_BITS]      = NULL;
+        memset(&read_page_ops[c >> MEM_GRANULARITY_BITS], 0x00, sizeof(mem_page_read_t));
+        memset(&write_page_ops[c >> MEM_GRANULARITY_BITS], 0x00, sizeof(mem_page_write_t));
         write_mapping_bus[c >> MEM_GRANULARITY_BITS] = NULL;
         read_mapping_bus[c >> MEM_GRANULARITY_BITS]  = NULL;
     }
@@ -2354,12 +2772,22 @@ mem_mapping_recalc(uint64_t base, uint64_t size)
                     _mem_exec[c >> MEM_GRANULARITY_BITS] = map->exec + (c - map->base);
                 if (!wp && (map->write_b || map->write_w || map->write_l) &&
                     mem_mapping_access_allowed(map->flags,
-                                               _mem_state[c >> MEM_GRANULARITY_BITS].states[n].w))
-                    write_mapping[c >> MEM_GRANULARITY_BITS] = map;
+                                               _mem_state[c >> MEM_GRANULARITY_BITS].states[n].w)) {
+                    write_mapping[c >> MEM_GRANULARITY_BITS]           = map;
+                    write_page_ops[c >> MEM_GRANULARITY_BITS].write_b  = map->write_b;
+                    write_page_ops[c >> MEM_GRANULARITY_BITS].write_w  = map->write_w;
+                    write_page_ops[c >> MEM_GRANULARITY_BITS].write_l  = map->write_l;
+                    write_page_ops[c >> MEM_GRANULARITY_BITS].priv     = map->priv;
+                }
                 if ((map->read_b || map->read_w || map->read_l) &&
                     mem_mapping_access_allowed(map->flags,
-                                               _mem_state[c >> MEM_GRANULARITY_BITS].states[n].r))
-                    read_mapping[c >> MEM_GRANULARITY_BITS] = map;
+                                               _mem_state[c >> MEM_GRANULARITY_BITS].states[n].r)) {
+                    read_mapping[c >> MEM_GRANULARITY_BITS]        = map;
+                    read_page_ops[c >> MEM_GRANULARITY_BITS].read_b = map->read_b;
+                    read_page_ops[c >> MEM_GRANULARITY_BITS].read_w = map->read_w;
+                    read_page_ops[c >> MEM_GRANULARITY_BITS].read_l = map->read_l;
+                    read_page_ops[c >> MEM_GRANULARITY_BITS].priv   = map->priv;
+                }
 
                 /* Bus */
                 n |= STATE_BUS;
@@ -2591,6 +3019,9 @@ void
 mem_mapping_set_p(mem_mapping_t *map, void *priv)
 {
     map->priv = priv;
+
+    /* priv is cached in the flat dispatch tables. */
+    mem_mapping_recalc(map->base, map->size);
 }
 
 void
@@ -2816,7 +3247,8 @@ mem_reset(void)
     pages    = (page_t *) malloc(m * sizeof(page_t));
 
     memset(page_lookup, 0x00, (1 << 20) * sizeof(page_t *));
-    memset(page_lookupp, 0x04, (1 << 20) * sizeof(uint8_t));
+    for (uint32_t c = 0; c < (1 << 20); c++)
+        mmu_perm_recs[c].pagep = 4;
 
     memset(pages, 0x00, pages_sz * sizeof(page_t));
 
@@ -2828,6 +3260,21 @@ mem_reset(void)
     memset(byte_code_present_mask, 0, (mem_size * 1024) / 8);
 #endif
 
+    /* The dirty-page tracking buffers are sized to the page table; after a
+       hard reset everything starts out clean. */
+    if (mem_dirty_flags != NULL) {
+        free(mem_dirty_flags);
+        mem_dirty_flags = (uint8_t *) malloc(pages_sz);
+        memset(mem_dirty_flags, 0x00, pages_sz);
+        for (uint8_t c = 0; c < MEM_DIRTY_MAX_CLIENTS; c++) {
+            if (mem_dirty_clients & (1 << c)) {
+                free(mem_dirty_client[c].dirty_pages);
+                mem_dirty_client[c].dirty_pages = (uint32_t *) malloc(pages_sz * sizeof(uint32_t));
+                mem_dirty_client[c].num         = 0;
+            }
+        }
+    }
+
     for (uint32_t c = 0; c < pages_sz; c++) {
         if ((c << 12) >= (mem_size << 10))
             pages[c].mem = page_ff;
@@ -2930,12 +3377,10 @@ mem_init(void)
     pages     = NULL;
 
     /* Allocate the lookup tables. */
-    page_lookup  = (page_t **) malloc((1 << 20) * sizeof(page_t *));
-    page_lookupp = (uint8_t *) malloc((1 << 20) * sizeof(uint8_t));
-    readlookup2  = malloc((1 << 20) * sizeof(uintptr_t));
-    readlookupp  = malloc((1 << 20) * sizeof(uint8_t));
-    writelookup2 = malloc((1 << 20) * sizeof(uintptr_t));
-    writelookupp = malloc((1 << 20) * sizeof(uint8_t));
+    page_lookup   = (page_t **) malloc((1 << 20) * sizeof(page_t *));
+    readlookup2   = malloc((1 << 20) * sizeof(uintptr_t));
+    writelookup2  = malloc((1 << 20) * sizeof(uintptr_t));
+    mmu_perm_recs = malloc((1 << 20) * sizeof(mmu_perm_rec_t));
 }
 
 static void
@@ -3110,7 +3555,6 @@ mem_reset_page_blocks(void)
 #ifdef USE_NEW_DYNAREC
         pages[c].block   = BLOCK_INVALID;
         pages[c].block_2 = BLOCK_INVALID;
-        pages[c].head    = BLOCK_INVALID;
 #else
         pages[c].block[0] = pages[c].block[1] = pages[c].block[2] = pages[c].block[3] = NULL;
         pages[c].block_2[0] = pages[c].block_2[1] = pages[c].block_2[2] = pages[c].block_2[3] = NULL;
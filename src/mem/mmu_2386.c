@@ -80,13 +80,13 @@ mem_debug_check_addr(uint32_t addr, int flags)
 uint8_t
 mem_readb_map(uint32_t addr)
 {
-    mem_mapping_t *map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    const mem_page_read_t *rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
     uint8_t        ret = 0xff;
 
     mem_logical_addr = 0xffffffff;
 
-    if (map && map->read_b)
-        ret = map->read_b(addr, map->priv);
+    if (rops->read_b)
+        ret = rops->read_b(addr, rops->priv);
 
     return ret;
 }
@@ -94,13 +94,13 @@ mem_readb_map(uint32_t addr)
 uint16_t
 mem_readw_map(uint32_t addr)
 {
-    mem_mapping_t  *map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    const mem_page_read_t *rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
     uint16_t        ret;
 
     mem_logical_addr = 0xffffffff;
 
-    if (((addr & MEM_GRANULARITY_MASK) <= MEM_GRANULARITY_HBOUND) && (map && map->read_w))
-        ret = map->read_w(addr, map->priv);
+    if (((addr & MEM_GRANULARITY_MASK) <= MEM_GRANULARITY_HBOUND) && (rops->read_w))
+        ret = rops->read_w(addr, rops->priv);
     else {
         ret = mem_readb_phys(addr + 1) << 8;
         ret |= mem_readb_phys(addr);
@@ -112,13 +112,13 @@ mem_readw_map(uint32_t addr)
 uint32_t
 mem_readl_map(uint32_t addr)
 {
-    mem_mapping_t  *map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    const mem_page_read_t *rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
     uint32_t        ret;
 
     mem_logical_addr = 0xffffffff;
 
-    if (!cpu_16bitbus && ((addr & MEM_GRANULARITY_MASK) <= MEM_GRANULARITY_QBOUND) && (map && map->read_l))
-        ret = map->read_l(addr, map->priv);
+    if (!cpu_16bitbus && ((addr & MEM_GRANULARITY_MASK) <= MEM_GRANULARITY_QBOUND) && (rops->read_l))
+        ret = rops->read_l(addr, rops->priv);
     else {
         ret = mem_readw_phys(addr + 2) << 16;
         ret |= mem_readw_phys(addr);
@@ -276,7 +276,7 @@ mmutranslate_noabrt_2386(uint32_t addr, int rw)
 uint8_t
 readmembl_2386(uint32_t addr)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
     uint64_t       a;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_READ, 1);
@@ -296,9 +296,9 @@ readmembl_2386(uint32_t addr)
     }
     addr = (uint32_t) (addr64 & rammask);
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->read_b)
-        return map->read_b(addr, map->priv);
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (rops->read_b)
+        return rops->read_b(addr, rops->priv);
 
     return 0xff;
 }
@@ -306,7 +306,7 @@ readmembl_2386(uint32_t addr)
 void
 writemembl_2386(uint32_t addr, uint8_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
     uint64_t       a;
 
     mem_debug_check_addr(addr, 2);
@@ -326,16 +326,16 @@ writemembl_2386(uint32_t addr, uint8_t val)
     }
     addr = (uint32_t) (addr64 & rammask);
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->write_b)
-        map->write_b(addr, val, map->priv);
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (wops->write_b)
+        wops->write_b(addr, val, wops->priv);
 }
 
 /* Read a byte from memory without MMU translation - result of previous MMU translation passed as value. */
 uint8_t
 readmembl_no_mmut_2386(uint32_t addr, uint32_t a64)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_READ, 1);
 
@@ -349,9 +349,9 @@ readmembl_no_mmut_2386(uint32_t addr, uint32_t a64)
     } else
         addr &= rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->read_b)
-        return map->read_b(addr, map->priv);
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (rops->read_b)
+        return rops->read_b(addr, rops->priv);
 
     return 0xff;
 }
@@ -360,7 +360,7 @@ readmembl_no_mmut_2386(uint32_t addr, uint32_t a64)
 void
 writemembl_no_mmut_2386(uint32_t addr, uint32_t a64, uint8_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_WRITE, 1);
 
@@ -374,15 +374,15 @@ writemembl_no_mmut_2386(uint32_t addr, uint32_t a64, uint8_t val)
     } else
         addr &= rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->write_b)
-        map->write_b(addr, val, map->priv);
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (wops->write_b)
+        wops->write_b(addr, val, wops->priv);
 }
 
 uint16_t
 readmemwl_2386(uint32_t addr)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
     uint64_t       a;
 
     addr64a[0] = addr;
@@ -425,13 +425,13 @@ readmemwl_2386(uint32_t addr)
 
     addr = addr64a[0] & rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->read_w)
-        return map->read_w(addr, map->priv);
+    if (rops->read_w)
+        return rops->read_w(addr, rops->priv);
 
-    if (map && map->read_b) {
-        return map->read_b(addr, map->priv) | ((uint16_t) (map->read_b(addr + 1, map->priv)) << 8);
+    if (rops->read_b) {
+        return rops->read_b(addr, rops->priv) | ((uint16_t) (rops->read_b(addr + 1, rops->priv)) << 8);
     }
 
     return 0xffff;
@@ -440,7 +440,7 @@ readmemwl_2386(uint32_t addr)
 void
 writememwl_2386(uint32_t addr, uint16_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
     uint64_t       a;
 
     addr64a[0] = addr;
@@ -489,16 +489,16 @@ writememwl_2386(uint32_t addr, uint16_t val)
 
     addr = addr64a[0] & rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->write_w) {
-        map->write_w(addr, val, map->priv);
+    if (wops->write_w) {
+        wops->write_w(addr, val, wops->priv);
         return;
     }
 
-    if (map && map->write_b) {
-        map->write_b(addr, val, map->priv);
-        map->write_b(addr + 1, val >> 8, map->priv);
+    if (wops->write_b) {
+        wops->write_b(addr, val, wops->priv);
+        wops->write_b(addr + 1, val >> 8, wops->priv);
         return;
     }
 }
@@ -507,7 +507,7 @@ writememwl_2386(uint32_t addr, uint16_t val)
 uint16_t
 readmemwl_no_mmut_2386(uint32_t addr, uint32_t *a64)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_READ, 2);
 
@@ -535,13 +535,13 @@ readmemwl_no_mmut_2386(uint32_t addr, uint32_t *a64)
     } else
         addr &= rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->read_w)
-        return map->read_w(addr, map->priv);
+    if (rops->read_w)
+        return rops->read_w(addr, rops->priv);
 
-    if (map && map->read_b) {
-        return map->read_b(addr, map->priv) | ((uint16_t) (map->read_b(addr + 1, map->priv)) << 8);
+    if (rops->read_b) {
+        return rops->read_b(addr, rops->priv) | ((uint16_t) (rops->read_b(addr + 1, rops->priv)) << 8);
     }
 
     return 0xffff;
@@ -551,7 +551,7 @@ readmemwl_no_mmut_2386(uint32_t addr, uint32_t *a64)
 void
 writememwl_no_mmut_2386(uint32_t addr, uint32_t *a64, uint16_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_WRITE, 2);
 
@@ -580,16 +580,16 @@ writememwl_no_mmut_2386(uint32_t addr, uint32_t *a64, uint16_t val)
     } else
         addr &= rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->write_w) {
-        map->write_w(addr, val, map->priv);
+    if (wops->write_w) {
+        wops->write_w(addr, val, wops->priv);
         return;
     }
 
-    if (map && map->write_b) {
-        map->write_b(addr, val, map->priv);
-        map->write_b(addr + 1, val >> 8, map->priv);
+    if (wops->write_b) {
+        wops->write_b(addr, val, wops->priv);
+        wops->write_b(addr + 1, val >> 8, wops->priv);
         return;
     }
 }
@@ -597,7 +597,7 @@ writememwl_no_mmut_2386(uint32_t addr, uint32_t *a64, uint16_t val)
 uint32_t
 readmemll_2386(uint32_t addr)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
     int            i;
     uint64_t       a = 0x0000000000000000ULL;
 
@@ -654,16 +654,16 @@ readmemll_2386(uint32_t addr)
 
     addr = addr64a[0] & rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->read_l)
-        return map->read_l(addr, map->priv);
+    if (rops->read_l)
+        return rops->read_l(addr, rops->priv);
 
-    if (map && map->read_w)
-        return map->read_w(addr, map->priv) | ((uint32_t) (map->read_w(addr + 2, map->priv)) << 16);
+    if (rops->read_w)
+        return rops->read_w(addr, rops->priv) | ((uint32_t) (rops->read_w(addr + 2, rops->priv)) << 16);
 
-    if (map && map->read_b)
-        return map->read_b(addr, map->priv) | ((uint32_t) (map->read_b(addr + 1, map->priv)) << 8) | ((uint32_t) (map->read_b(addr + 2, map->priv)) << 16) | ((uint32_t) (map->read_b(addr + 3, map->priv)) << 24);
+    if (rops->read_b)
+        return rops->read_b(addr, rops->priv) | ((uint32_t) (rops->read_b(addr + 1, rops->priv)) << 8) | ((uint32_t) (rops->read_b(addr + 2, rops->priv)) << 16) | ((uint32_t) (rops->read_b(addr + 3, rops->priv)) << 24);
 
     return 0xffffffff;
 }
@@ -671,7 +671,7 @@ readmemll_2386(uint32_t addr)
 void
 writememll_2386(uint32_t addr, uint32_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
     int            i;
     uint64_t       a = 0x0000000000000000ULL;
 
@@ -733,22 +733,22 @@ writememll_2386(uint32_t addr, uint32_t val)
 
     addr = addr64a[0] & rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->write_l) {
-        map->write_l(addr, val, map->priv);
+    if (wops->write_l) {
+        wops->write_l(addr, val, wops->priv);
         return;
     }
-    if (map && map->write_w) {
-        map->write_w(addr, val, map->priv);
-        map->write_w(addr + 2, val >> 16, map->priv);
+    if (wops->write_w) {
+        wops->write_w(addr, val, wops->priv);
+        wops->write_w(addr + 2, val >> 16, wops->priv);
         return;
     }
-    if (map && map->write_b) {
-        map->write_b(addr, val, map->priv);
-        map->write_b(addr + 1, val >> 8, map->priv);
-        map->write_b(addr + 2, val >> 16, map->priv);
-        map->write_b(addr + 3, val >> 24, map->priv);
+    if (wops->write_b) {
+        wops->write_b(addr, val, wops->priv);
+        wops->write_b(addr + 1, val >> 8, wops->priv);
+        wops->write_b(addr + 2, val >> 16, wops->priv);
+        wops->write_b(addr + 3, val >> 24, wops->priv);
         return;
     }
 }
@@ -757,7 +757,7 @@ writememll_2386(uint32_t addr, uint32_t val)
 uint32_t
 readmemll_no_mmut_2386(uint32_t addr, uint32_t *a64)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_READ, 4);
 
@@ -785,16 +785,16 @@ readmemll_no_mmut_2386(uint32_t addr, uint32_t *a64)
     } else
         addr &= rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->read_l)
-        return map->read_l(addr, map->priv);
+    if (rops->read_l)
+        return rops->read_l(addr, rops->priv);
 
-    if (map && map->read_w)
-        return map->read_w(addr, map->priv) | ((uint32_t) (map->read_w(addr + 2, map->priv)) << 16);
+    if (rops->read_w)
+        return rops->read_w(addr, rops->priv) | ((uint32_t) (rops->read_w(addr + 2, rops->priv)) << 16);
 
-    if (map && map->read_b)
-        return map->read_b(addr, map->priv) | ((uint32_t) (map->read_b(addr + 1, map->priv)) << 8) | ((uint32_t) (map->read_b(addr + 2, map->priv)) << 16) | ((uint32_t) (map->read_b(addr + 3, map->priv)) << 24);
+    if (rops->read_b)
+        return rops->read_b(addr, rops->priv) | ((uint32_t) (rops->read_b(addr + 1, rops->priv)) << 8) | ((uint32_t) (rops->read_b(addr + 2, rops->priv)) << 16) | ((uint32_t) (rops->read_b(addr + 3, rops->priv)) << 24);
 
     return 0xffffffff;
 }
@@ -803,7 +803,7 @@ readmemll_no_mmut_2386(uint32_t addr, uint32_t *a64)
 void
 writememll_no_mmut_2386(uint32_t addr, uint32_t *a64, uint32_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
 
     GDBSTUB_MEM_ACCESS(addr, GDBSTUB_MEM_WRITE, 4);
 
@@ -832,22 +832,22 @@ writememll_no_mmut_2386(uint32_t addr, uint32_t *a64, uint32_t val)
     } else
         addr &= rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->write_l) {
-        map->write_l(addr, val, map->priv);
+    if (wops->write_l) {
+        wops->write_l(addr, val, wops->priv);
         return;
     }
-    if (map && map->write_w) {
-        map->write_w(addr, val, map->priv);
-        map->write_w(addr + 2, val >> 16, map->priv);
+    if (wops->write_w) {
+        wops->write_w(addr, val, wops->priv);
+        wops->write_w(addr + 2, val >> 16, wops->priv);
         return;
     }
-    if (map && map->write_b) {
-        map->write_b(addr, val, map->priv);
-        map->write_b(addr + 1, val >> 8, map->priv);
-        map->write_b(addr + 2, val >> 16, map->priv);
-        map->write_b(addr + 3, val >> 24, map->priv);
+    if (wops->write_b) {
+        wops->write_b(addr, val, wops->priv);
+        wops->write_b(addr + 1, val >> 8, wops->priv);
+        wops->write_b(addr + 2, val >> 16, wops->priv);
+        wops->write_b(addr + 3, val >> 24, wops->priv);
         return;
     }
 }
@@ -855,7 +855,7 @@ writememll_no_mmut_2386(uint32_t addr, uint32_t *a64, uint32_t val)
 uint64_t
 readmemql_2386(uint32_t addr)
 {
-    mem_mapping_t *map;
+    const mem_page_read_t *rops;
     int            i;
     uint64_t       a = 0x0000000000000000ULL;
 
@@ -911,9 +911,9 @@ readmemql_2386(uint32_t addr)
 
     addr = addr64a[0] & rammask;
 
-    map = read_mapping[addr >> MEM_GRANULARITY_BITS];
-    if (map && map->read_l)
-        return map->read_l(addr, map->priv) | ((uint64_t) map->read_l(addr + 4, map->priv) << 32);
+    rops = &read_page_ops[addr >> MEM_GRANULARITY_BITS];
+    if (rops->read_l)
+        return rops->read_l(addr, rops->priv) | ((uint64_t) rops->read_l(addr + 4, rops->priv) << 32);
 
     return readmemll(addr) | ((uint64_t) readmemll(addr + 4) << 32);
 }
@@ -921,7 +921,7 @@ readmemql_2386(uint32_t addr)
 void
 writememql_2386(uint32_t addr, uint64_t val)
 {
-    mem_mapping_t *map;
+    const mem_page_write_t *wops;
     int            i;
     uint64_t       a = 0x0000000000000000ULL;
 
@@ -980,29 +980,29 @@ writememql_2386(uint32_t addr, uint64_t val)
 
     addr = addr64a[0] & rammask;
 
-    map = write_mapping[addr >> MEM_GRANULARITY_BITS];
+    wops = &write_page_ops[addr >> MEM_GRANULARITY_BITS];
 
-    if (map && map->write_l) {
-        map->write_l(addr, val, map->priv);
-        map->write_l(addr + 4, val >> 32, map->priv);
+    if (wops->write_l) {
+        wops->write_l(addr, val, wops->priv);
+        wops->write_l(addr + 4, val >> 32, wops->priv);
         return;
     }
-    if (map && map->write_w) {
-        map->write_w(addr, val, map->priv);
-        map->write_w(addr + 2, val >> 16, map->priv);
-        map->write_w(addr + 4, val >> 32, map->priv);
-        map->write_w(addr + 6, val >> 48, map->priv);
+    if (wops->write_w) {
+        wops->write_w(addr, val, wops->priv);
+        wops->write_w(addr + 2, val >> 16, wops->priv);
+        wops->write_w(addr + 4, val >> 32, wops->priv);
+        wops->write_w(addr + 6, val >> 48, wops->priv);
         return;
     }
-    if (map && map->write_b) {
-        map->write_b(addr, val, map->priv);
-        map->write_b(addr + 1, val >> 8, map->priv);
-        map->write_b(addr + 2, val >> 16, map->priv);
-        map->write_b(addr + 3, val >> 24, map->priv);
-        map->write_b(addr + 4, val >> 32, map->priv);
-        map->write_b(addr + 5, val >> 40, map->priv);
-        map->write_b(addr + 6, val >> 48, map->priv);
-        map->write_b(addr + 7, val >> 56, map->priv);
+    if (wops->write_b) {
+        wops->write_b(addr, val, wops->priv);
+        wops->write_b(addr + 1, val >> 8, wops->priv);
+        wops->write_b(addr + 2, val >> 16, wops->priv);
+        wops->write_b(addr + 3, val >> 24, wops->priv);
+        wops->write_b(addr + 4, val >> 32, wops->priv);
+        wops->write_b(addr + 5, val >> 40, wops->priv);
+        wops->write_b(addr + 6, val >> 48, wops->priv);
+        wops->write_b(addr + 7, val >> 56, wops->priv);
         return;
     }
 }
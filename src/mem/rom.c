@@ -37,6 +37,8 @@
 #include <86box/plat.h>
 #include <86box/machine.h>
 #include <86box/m_xt_xi8088.h>
+#include <86box/thread.h>
+#include "../crcspeed/crc64speed.h"
 
 #ifdef ENABLE_ROM_LOG
 int rom_do_log = ENABLE_ROM_LOG;
@@ -56,6 +58,11 @@ rom_log(const char *fmt, ...)
 #    define rom_log(fmt, ...)
 #endif
 
+/* Serializes the resolution cache below between the main thread and the
+   machine availability scan thread. Created here because paths are added
+   before any other thread can resolve ROM names. */
+static mutex_t *rom_cache_mutex = NULL;
+
 void
 rom_add_path(const char *path)
 {
@@ -63,6 +70,9 @@ rom_add_path(const char *path)
 
     rom_path_t *rom_path = &rom_paths;
 
+    if (rom_cache_mutex == NULL)
+        rom_cache_mutex = thread_create_mutex();
+
     if (rom_paths.path[0] != '\0') {
         // Iterate to the end of the list.
         while (rom_path->next != NULL) {
@@ -86,6 +96,79 @@ rom_add_path(const char *path)
     path_slash(rom_path->path);
 }
 
+/* Cache of relative ROM names already resolved against the ROM path list.
+   Availability probes run over hundreds of images (machine and device
+   available() callbacks, then the actual BIOS load opens the same files
+   again), and every unresolved name costs one open attempt per ROM path;
+   on a network-mounted ROM set that adds up to seconds of startup time.
+   Only successful resolutions are cached, so images added while the
+   emulator is running are still picked up by the normal path scan. */
+#define ROM_CACHE_BUCKETS 256
+
+typedef struct rom_cache_t {
+    char                fn[1024];
+    char                path[1024];
+    uint32_t            fn_hash;
+    struct rom_cache_t *next;
+} rom_cache_t;
+
+static rom_cache_t *rom_cache[ROM_CACHE_BUCKETS];
+
+static uint32_t
+rom_cache_hash(const char *fn)
+{
+    uint32_t hash = 0x811c9dc5;
+
+    while (*fn != '\0') {
+        hash ^= (uint8_t) *fn++;
+        hash *= 0x01000193;
+    }
+
+    return hash;
+}
+
+static rom_cache_t *
+rom_cache_find(const char *fn, uint32_t hash)
+{
+    rom_cache_t *ent = rom_cache[hash & (ROM_CACHE_BUCKETS - 1)];
+
+    while (ent != NULL) {
+        if ((ent->fn_hash == hash) && !strncmp(ent->fn, fn, sizeof(ent->fn)))
+            return ent;
+        ent = ent->next;
+    }
+
+    return NULL;
+}
+
+static void
+rom_cache_add(const char *fn, uint32_t hash, const char *path)
+{
+    rom_cache_t *ent = calloc(1, sizeof(rom_cache_t));
+
+    snprintf(ent->fn, sizeof(ent->fn), "%s", fn);
+    snprintf(ent->path, sizeof(ent->path), "%s", path);
+    ent->fn_hash = hash;
+
+    ent->next                             = rom_cache[hash & (ROM_CACHE_BUCKETS - 1)];
+    rom_cache[hash & (ROM_CACHE_BUCKETS - 1)] = ent;
+}
+
+static void
+rom_cache_remove(rom_cache_t *ent)
+{
+    rom_cache_t **bucket = &rom_cache[ent->fn_hash & (ROM_CACHE_BUCKETS - 1)];
+
+    while (*bucket != NULL) {
+        if (*bucket == ent) {
+            *bucket = ent->next;
+            free(ent);
+            return;
+        }
+        bucket = &(*bucket)->next;
+    }
+}
+
 FILE *
 rom_fopen(const char *fn, char *mode)
 {
@@ -94,14 +177,33 @@ rom_fopen(const char *fn, char *mode)
 
     if (strstr(fn, "roms/") == fn) {
         /* Relative path */
-        for (rom_path_t *rom_path = &rom_paths; rom_path != NULL; rom_path = rom_path->next) {
-            path_append_filename(temp, rom_path->path, fn + 5);
+        uint32_t     hash = rom_cache_hash(fn);
+        rom_cache_t *cached;
+
+        if (rom_cache_mutex != NULL)
+            thread_wait_mutex(rom_cache_mutex);
+
+        cached = rom_cache_find(fn, hash);
+        if (cached != NULL) {
+            /* If the image went away, drop the stale entry and probe again. */
+            if ((fp = plat_fopen(cached->path, mode)) == NULL)
+                rom_cache_remove(cached);
+        }
 
-            if ((fp = plat_fopen(temp, mode)) != NULL) {
-                return fp;
+        if (fp == NULL) {
+            for (rom_path_t *rom_path = &rom_paths; rom_path != NULL; rom_path = rom_path->next) {
+                path_append_filename(temp, rom_path->path, fn + 5);
+
+                if ((fp = plat_fopen(temp, mode)) != NULL) {
+                    rom_cache_add(fn, hash, temp);
+                    break;
+                }
             }
         }
 
+        if (rom_cache_mutex != NULL)
+            thread_release_mutex(rom_cache_mutex);
+
         return fp;
     } else {
         /* Absolute path */
@@ -116,16 +218,41 @@ rom_getfile(char *fn, char *s, int size)
 
     if (strstr(fn, "roms/") == fn) {
         /* Relative path */
-        for (rom_path_t *rom_path = &rom_paths; rom_path != NULL; rom_path = rom_path->next) {
-            path_append_filename(temp, rom_path->path, fn + 5);
+        uint32_t     hash = rom_cache_hash(fn);
+        rom_cache_t *cached;
+        int          ret  = 0;
+
+        if (rom_cache_mutex != NULL)
+            thread_wait_mutex(rom_cache_mutex);
+
+        cached = rom_cache_find(fn, hash);
+        if (cached != NULL) {
+            if (rom_present(cached->path)) {
+                strncpy(s, cached->path, size);
+                ret = 1;
+            } else {
+                /* The image went away; drop the stale entry and probe again. */
+                rom_cache_remove(cached);
+            }
+        }
 
-            if (rom_present(temp)) {
-                strncpy(s, temp, size);
-                return 1;
+        if (!ret) {
+            for (rom_path_t *rom_path = &rom_paths; rom_path != NULL; rom_path = rom_path->next) {
+                path_append_filename(temp, rom_path->path, fn + 5);
+
+                if (rom_present(temp)) {
+                    rom_cache_add(fn, hash, temp);
+                    strncpy(s, temp, size);
+                    ret = 1;
+                    break;
+                }
             }
         }
 
-        return 0;
+        if (rom_cache_mutex != NULL)
+            thread_release_mutex(rom_cache_mutex);
+
+        return ret;
     } else {
         /* Absolute path */
         if (rom_present(fn)) {
@@ -202,6 +329,54 @@ rom_readl(uint32_t addr, void *priv)
     return (*(uint32_t *) &rom->rom[(addr - rom->mapping.base) & rom->mask]);
 }
 
+/* Load sz bytes at offset off of an open image through the host's shared
+   content cache, so identical images loaded by several instances occupy
+   physical memory once per host. Returns a buffer holding the data either
+   way: a copy-on-write view of the shared object with *shared set, or a
+   plain private allocation when the host cannot share. Only verbatim
+   loads can come through here; the interleaved and inverted loaders
+   transform the data while reading and keep their private buffers. */
+uint8_t *
+rom_load_shared(FILE *fp, int off, int sz, uint8_t *shared)
+{
+    uint8_t *data;
+    uint8_t *map;
+    uint64_t crc;
+    long     fsize;
+    int      fill;
+
+    *shared = 0;
+
+    if (fseek(fp, 0, SEEK_END) || ((fsize = ftell(fp)) < ((long) off + sz)) || fseek(fp, off, SEEK_SET))
+        return NULL;
+
+    data = (uint8_t *) malloc(sz);
+    if (fread(data, 1, sz, fp) != (size_t) sz) {
+        free(data);
+        return NULL;
+    }
+
+    crc = crc64speed_auto(0, data, sz);
+    map = (uint8_t *) plat_shared_map(crc, sz, &fill);
+    if (map == NULL)
+        return data;
+
+    if (fill) {
+        memcpy(map, data, sz);
+        map = (uint8_t *) plat_shared_seal(map, sz);
+        if (map == NULL)
+            return data;
+    } else if (crc64speed_auto(0, map, sz) != crc) {
+        /* Stale object from an instance that died mid-fill. */
+        plat_shared_unmap(map, sz);
+        return data;
+    }
+
+    free(data);
+    *shared = 1;
+    return map;
+}
+
 int
 rom_load_linear_oddeven(const char *fn, uint32_t addr, int sz, int off, uint8_t *ptr)
 {
@@ -574,16 +749,34 @@ rom_init(rom_t *rom, const char *fn, uint32_t addr, int sz, int mask, int off, u
 {
     rom_log("rom_init(%08X, %s, %08X, %08X, %08X, %08X, %08X)\n", rom, fn, addr, sz, mask, off, flags);
 
-    /* Allocate a buffer for the image. */
-    rom->rom = malloc(sz);
-    memset(rom->rom, 0xff, sz);
+    rom->rom    = NULL;
+    rom->shared = 0;
 
-    /* Load the image file into the buffer. */
-    if (!rom_load_linear(fn, addr, sz, off, rom->rom)) {
-        /* Nope.. clean up. */
-        free(rom->rom);
-        rom->rom = NULL;
-        return (-1);
+    /* Linear loads that fill the buffer from its start are verbatim file
+       content, so those can go through the shared image cache. Loads into
+       the middle of the buffer or from short images take the private path
+       below, which pads with 0xff. */
+    if (((addr >= 0x40000) ? 0 : (addr & 0x03ffff)) == 0) {
+        FILE *fp = rom_fopen(fn, "rb");
+
+        if (fp != NULL) {
+            rom->rom = rom_load_shared(fp, off, sz, &rom->shared);
+            (void) fclose(fp);
+        }
+    }
+
+    if (rom->rom == NULL) {
+        /* Allocate a buffer for the image. */
+        rom->rom = malloc(sz);
+        memset(rom->rom, 0xff, sz);
+
+        /* Load the image file into the buffer. */
+        if (!rom_load_linear(fn, addr, sz, off, rom->rom)) {
+            /* Nope.. clean up. */
+            free(rom->rom);
+            rom->rom = NULL;
+            return (-1);
+        }
     }
 
     rom->sz   = sz;
@@ -604,7 +797,8 @@ rom_init_oddeven(rom_t *rom, const char *fn, uint32_t addr, int sz, int mask, in
     rom_log("rom_init(%08X, %08X, %08X, %08X, %08X, %08X, %08X)\n", rom, fn, addr, sz, mask, off, flags);
 
     /* Allocate a buffer for the image. */
-    rom->rom = malloc(sz);
+    rom->rom    = malloc(sz);
+    rom->shared = 0;
     memset(rom->rom, 0xff, sz);
 
     /* Load the image file into the buffer. */
@@ -631,7 +825,8 @@ int
 rom_init_interleaved(rom_t *rom, const char *fnl, const char *fnh, uint32_t addr, int sz, int mask, int off, uint32_t flags)
 {
     /* Allocate a buffer for the image. */
-    rom->rom = malloc(sz);
+    rom->rom    = malloc(sz);
+    rom->shared = 0;
     memset(rom->rom, 0xff, sz);
 
     /* Load the image file into the buffer. */
@@ -653,3 +848,18 @@ rom_init_interleaved(rom_t *rom, const char *fnl, const char *fnh, uint32_t addr
 
     return 0;
 }
+
+/* Release a buffer obtained from one of the rom_init() variants. */
+void
+rom_dispose(rom_t *rom)
+{
+    if (rom->rom == NULL)
+        return;
+
+    if (rom->shared)
+        plat_shared_unmap(rom->rom, rom->sz);
+    else
+        free(rom->rom);
+
+    rom->rom = NULL;
+}
@@ -53,12 +53,24 @@ smram_log(const char *fmt, ...)
 #    define smram_log(fmt, ...)
 #endif
 
+#ifdef ENABLE_SMRAM_LOG
+/* Counts accesses that still go through the rebasing trampolines below.
+   Identity-aliased ranges dispatch straight to the RAM handlers, so on
+   chipsets like the 440BX this should stay flat while SMM code runs. */
+static uint64_t smram_slow_accesses;
+#    define smram_count_slow() smram_slow_accesses++
+#else
+#    define smram_count_slow()
+#endif
+
 static uint8_t
 smram_read(uint32_t addr, void *priv)
 {
     const smram_t *dev      = (smram_t *) priv;
     uint32_t       new_addr = addr - dev->host_base + dev->ram_base;
 
+    smram_count_slow();
+
     if (new_addr >= (1 << 30))
         return mem_read_ram_2gb(new_addr, priv);
     else if (!use_separate_smram || (new_addr >= 0xa0000))
@@ -73,6 +85,8 @@ smram_readw(uint32_t addr, void *priv)
     smram_t *dev      = (smram_t *) priv;
     uint32_t new_addr = addr - dev->host_base + dev->ram_base;
 
+    smram_count_slow();
+
     if (new_addr >= (1 << 30))
         return mem_read_ram_2gbw(new_addr, priv);
     else if (!use_separate_smram || (new_addr >= 0xa0000))
@@ -87,6 +101,8 @@ smram_readl(uint32_t addr, void *priv)
     smram_t *dev      = (smram_t *) priv;
     uint32_t new_addr = addr - dev->host_base + dev->ram_base;
 
+    smram_count_slow();
+
     if (new_addr >= (1 << 30))
         return mem_read_ram_2gbl(new_addr, priv);
     else if (!use_separate_smram || (new_addr >= 0xa0000))
@@ -101,6 +117,8 @@ smram_write(uint32_t addr, uint8_t val, void *priv)
     smram_t *dev      = (smram_t *) priv;
     uint32_t new_addr = addr - dev->host_base + dev->ram_base;
 
+    smram_count_slow();
+
     if (!use_separate_smram || (new_addr >= 0xa0000))
         mem_write_ram(new_addr, val, priv);
     else
@@ -113,6 +131,8 @@ smram_writew(uint32_t addr, uint16_t val, void *priv)
     smram_t *dev      = (smram_t *) priv;
     uint32_t new_addr = addr - dev->host_base + dev->ram_base;
 
+    smram_count_slow();
+
     if (!use_separate_smram || (new_addr >= 0xa0000))
         mem_write_ramw(new_addr, val, priv);
     else
@@ -125,6 +145,8 @@ smram_writel(uint32_t addr, uint32_t val, void *priv)
     smram_t *dev      = (smram_t *) priv;
     uint32_t new_addr = addr - dev->host_base + dev->ram_base;
 
+    smram_count_slow();
+
     if (!use_separate_smram || (new_addr >= 0xa0000))
         mem_write_raml(new_addr, val, priv);
     else
@@ -180,6 +202,10 @@ smram_recalc_all(int ret)
     }
 
     flushmmucache();
+
+#ifdef ENABLE_SMRAM_LOG
+    smram_log("SMRAM: %" PRIu64 " trampoline accesses so far\n", smram_slow_accesses);
+#endif
 }
 
 /* Delete a SMRAM mapping. */
@@ -347,6 +373,21 @@ smram_enable_ex(smram_t *smr, uint32_t host_base, uint32_t ram_base, uint32_t si
         smr->size      = size;
 
         mem_mapping_set_addr(&(smr->mapping), smr->host_base, smr->size);
+
+        /* An identity alias into low RAM (440BX-style A/B segment SMRAM) needs
+           no address rebasing, so fold the plain RAM handlers into the flat
+           page tables here instead of bouncing every access through the
+           trampolines above. Relocated and separate-SMRAM ranges keep them. */
+        if (!use_separate_smram && (smr->host_base == smr->ram_base) &&
+            ((smr->ram_base + smr->size) <= (1 << 30)))
+            mem_mapping_set_handler(&(smr->mapping),
+                                    mem_read_ram, mem_read_ramw, mem_read_raml,
+                                    mem_write_ram, mem_write_ramw, mem_write_raml);
+        else
+            mem_mapping_set_handler(&(smr->mapping),
+                                    smram_read, smram_readw, smram_readl,
+                                    smram_write, smram_writew, smram_writel);
+
         if (!use_separate_smram || (smr->ram_base >= 0x000a0000)) {
             if (smr->ram_base < (1 << 30))
                 mem_mapping_set_exec(&(smr->mapping), ram + smr->ram_base);
@@ -135,6 +135,7 @@ typedef struct modem_t {
     bool     tcpIpMode, tcpIpConnInProgress;
     bool     cooldown;
     bool     telnet_mode;
+    bool     throughput_mode;
     bool     dtrstate;
     uint32_t tcpIpConnCounter;
 
@@ -355,7 +356,7 @@ process_tx_packet(modem_t *modem, uint8_t *p, uint32_t len)
 {
     int      received            = 0;
     uint32_t pos                 = 0;
-    uint8_t *processed_tx_packet = calloc(len, 1);
+    uint8_t *processed_tx_packet = netbuf_alloc(len);
     uint8_t  c                   = 0;
 
     modem_log("Processing SLIP packet of %u bytes\n", len);
@@ -394,16 +395,16 @@ process_tx_packet(modem_t *modem, uint8_t *p, uint32_t len)
 
 send_tx_packet:
     if (received) {
-        uint8_t *buf = calloc(received + 14, 1);
+        uint8_t *buf = netbuf_alloc(received + 14);
         buf[0] = buf[1] = buf[2] = buf[3] = buf[4] = buf[5] = 0xFF;
         buf[6] = buf[7] = buf[8] = buf[9] = buf[10] = buf[11] = 0xFC;
         buf[12]                                               = 0x08;
         buf[13]                                               = 0x00;
         memcpy(buf + 14, processed_tx_packet, received);
         network_tx(modem->card, buf, received + 14);
-        free(buf);
+        netbuf_free(buf);
     }
-    free(processed_tx_packet);
+    netbuf_free(processed_tx_packet);
     return;
 }
 
@@ -451,6 +452,14 @@ host_to_modem_cb(void *priv)
 
     if (modem->mode == MODEM_MODE_DATA && fifo8_num_used(&modem->rx_data) && !modem->cooldown) {
         serial_write_fifo(modem->serial, fifo8_pop(&modem->rx_data));
+        /* Throughput pacing: top up the receive FIFO in the same timer
+           event instead of trickling one byte per period. Command mode
+           responses still go through data_pending below at byte pace, so
+           guest-visible handshake timing is unchanged. */
+        if (modem->throughput_mode && (modem->serial->type >= SERIAL_16550) && modem->serial->fifo_enabled) {
+            while (fifo8_num_used(&modem->rx_data) && !fifo_get_full(modem->serial->rcvr_fifo))
+                serial_write_fifo(modem->serial, fifo8_pop(&modem->rx_data));
+        }
     } else if (fifo8_num_used(&modem->data_pending)) {
         uint8_t val = fifo8_pop(&modem->data_pending);
         serial_write_fifo(modem->serial, val);
@@ -1144,7 +1153,6 @@ modem_dtr_callback(serial_t *serial, int status, void *priv)
 static void
 fifo8_resize_2x(Fifo8 *fifo)
 {
-    uint32_t pos  = 0;
     uint32_t size = fifo->capacity * 2;
     uint32_t used = fifo8_num_used(fifo);
     if (!used)
@@ -1154,11 +1162,7 @@ fifo8_resize_2x(Fifo8 *fifo)
     if (!temp_buf) {
         fatal("net_modem: Out Of Memory!\n");
     }
-    while (!fifo8_is_empty(fifo)) {
-        temp_buf[pos] = fifo8_pop(fifo);
-        pos++;
-    }
-    pos = 0;
+    fifo8_pop_all(fifo, temp_buf, used);
     fifo8_destroy(fifo);
     fifo8_create(fifo, size);
     fifo8_push_all(fifo, temp_buf, used);
@@ -1484,10 +1488,11 @@ modem_init(const device_t *info)
     const char *phonebook_file = NULL;
     memset(modem->mac, 0xfc, 6);
 
-    modem->port        = device_get_config_int("port");
-    modem->baudrate    = device_get_config_int("baudrate");
-    modem->listen_port = device_get_config_int("listen_port");
-    modem->telnet_mode = device_get_config_int("telnet_mode");
+    modem->port            = device_get_config_int("port");
+    modem->baudrate        = device_get_config_int("baudrate");
+    modem->listen_port     = device_get_config_int("listen_port");
+    modem->telnet_mode     = device_get_config_int("telnet_mode");
+    modem->throughput_mode = device_get_config_int("throughput_mode");
 
     modem->clientsocket = modem->serversocket = modem->waitingclientsocket = -1;
 
@@ -1591,6 +1596,13 @@ static const device_config_t modem_config[] = {
         .default_string = "",
         .default_int = 0
     },
+    {
+        .name = "throughput_mode",
+        .description = "Throughput mode (burst data delivery)",
+        .type = CONFIG_BINARY,
+        .default_string = "",
+        .default_int = 0
+    },
     { .name = "", .description = "", .type = CONFIG_END }
 };
 // clang-format on
@@ -42,6 +42,9 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING  IN ANY  WAY OUT OF THE USE
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
+#ifdef __linux__
+#    define _GNU_SOURCE /* for sendmmsg() */
+#endif
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -58,6 +61,9 @@
 #    include <unistd.h>
 #    include <fcntl.h>
 #    include <sys/select.h>
+#    ifdef __linux__
+#        include <sys/socket.h>
+#    endif
 #endif
 
 #define HAVE_STDARG_H
@@ -335,9 +341,31 @@ net_pcap_thread(void *priv)
             net_event_clear(&pcap->tx_event);
 
             int packets = network_tx_popv(pcap->card, pcap->pktv, PCAP_PKT_BATCH);
+#ifdef __linux__
+            /* The selectable fd is the AF_PACKET socket pcap_sendpacket()
+               itself injects on, so the whole batch can be submitted with one
+               sendmmsg() call instead of one syscall per frame. */
+            struct mmsghdr msgv[PCAP_PKT_BATCH];
+            struct iovec   iov[PCAP_PKT_BATCH];
+            memset(msgv, 0x00, packets * sizeof(struct mmsghdr));
             for (int i = 0; i < packets; i++) {
+                iov[i].iov_base            = pcap->pktv[i].data;
+                iov[i].iov_len             = pcap->pktv[i].len;
+                msgv[i].msg_hdr.msg_iov    = &iov[i];
+                msgv[i].msg_hdr.msg_iovlen = 1;
+            }
+            int sent = (packets > 0) ? sendmmsg(pfd[NET_EVENT_RX].fd, msgv, packets, 0) : 0;
+            if (sent < 0)
+                sent = 0;
+            /* Fall back to per-frame injection for whatever was not sent. */
+            for (int i = sent; i < packets; i++) {
                 net_pcap_in(pcap->pcap, pcap->pktv[i].data, pcap->pktv[i].len);
             }
+#else
+            for (int i = 0; i < packets; i++) {
+                net_pcap_in(pcap->pcap, pcap->pktv[i].data, pcap->pktv[i].len);
+            }
+#endif
         }
 
         if (pfd[NET_EVENT_RX].revents & POLLIN) {
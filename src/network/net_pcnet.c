@@ -262,6 +262,8 @@ typedef struct {
     int        transfer_size;
     uint8_t    maclocal[6]; /* configured MAC (local) address */
     pc_timer_t timer, timer_soft_int, timer_restore;
+    /** Poll timer interval in microseconds, backed off while the rings are idle. */
+    uint64_t   uPollPeriod;
     netcard_t *netcard;
 } nic_t;
 
@@ -1693,9 +1695,8 @@ pcnetPollRxTx(nic_t *dev)
 static void
 pcnetPollTimer(void *priv)
 {
-    nic_t *dev = (nic_t *) priv;
-
-    timer_advance_u64(&dev->timer, 2000 * TIMER_USEC);
+    nic_t   *dev      = (nic_t *) priv;
+    uint16_t csr0_old = dev->aCSR[0];
 
     if (CSR_TDMD(dev))
         pcnetAsyncTransmit(dev);
@@ -1704,6 +1705,15 @@ pcnetPollTimer(void *priv)
 
     if (!CSR_STOP(dev) && !CSR_SPND(dev) && (!CSR_DPOLL(dev) || dev->fMaybeOutOfSpace))
         pcnetPollRxTx(dev);
+
+    /* Back off exponentially while the rings are idle; any descriptor
+       activity or CSR access snaps the interval back to 2 ms. */
+    if ((dev->aCSR[0] != csr0_old) || CSR_TDMD(dev) || dev->fMaybeOutOfSpace || (dev->uPollPeriod == 0))
+        dev->uPollPeriod = 2000;
+    else if (dev->uPollPeriod < 32000)
+        dev->uPollPeriod <<= 1;
+
+    timer_advance_u64(&dev->timer, dev->uPollPeriod * TIMER_USEC);
 }
 
 static void
@@ -1739,6 +1749,8 @@ pcnetHardReset(nic_t *dev)
     /* Reset the error counter. */
     dev->uCntBadRMD = 0;
 
+    dev->uPollPeriod = 2000;
+
     pcnetSoftReset(dev);
 }
 
@@ -1746,6 +1758,10 @@ static void
 pcnet_csr_writew(nic_t *dev, uint16_t rap, uint16_t val)
 {
     pcnet_log(1, "%s: pcnet_csr_writew: rap=%d val=%#06x\n", dev->name, rap, val);
+
+    /* The driver is talking to us, so drop the poll timer back to full rate. */
+    dev->uPollPeriod = 2000;
+
     switch (rap) {
         case 0:
             {
@@ -115,11 +115,11 @@ timeout_timer(void *priv)
     dev->status = 0x80;
 
     if (dev->tx_pkt) {
-        free(dev->tx_pkt);
+        netbuf_free(dev->tx_pkt);
         dev->tx_pkt = NULL;
     }
     if (dev->rx_pkt) {
-        free(dev->rx_pkt);
+        netbuf_free(dev->rx_pkt);
         dev->rx_pkt = NULL;
     }
 
@@ -177,8 +177,7 @@ plip_write_data(uint8_t val, void *priv)
             plip_log(2, "PLIP: tx_len = %04X (4/4)\n", dev->tx_len);
 
             /* We have the length, allocate a packet. */
-            if (!(dev->tx_pkt = malloc(dev->tx_len))) /* unlikely */
-                fatal("PLIP: unable to allocate tx_pkt\n");
+            dev->tx_pkt = netbuf_alloc(dev->tx_len);
             dev->tx_ptr           = 0;
             dev->tx_checksum_calc = 0;
 
@@ -238,7 +237,7 @@ plip_write_data(uint8_t val, void *priv)
             }
 
             /* We're done with this packet. */
-            free(dev->tx_pkt);
+            netbuf_free(dev->tx_pkt);
             dev->tx_pkt = NULL;
             dev->tx_len = 0;
 
@@ -322,7 +321,7 @@ plip_write_data(uint8_t val, void *priv)
             dev->status |= 0x80;
 
             /* We're done with this packet. */
-            free(dev->rx_pkt);
+            netbuf_free(dev->rx_pkt);
             dev->rx_pkt = NULL;
             dev->rx_len = 0;
 
@@ -429,8 +428,7 @@ plip_rx(void *priv, uint8_t *buf, int io_len)
         return 0;
     }
 
-    if (!(dev->rx_pkt = malloc(io_len))) /* unlikely */
-        fatal("PLIP: unable to allocate rx_pkt\n");
+    dev->rx_pkt = netbuf_alloc(io_len);
 
     /* Copy this packet to our buffer. */
     dev->rx_len = io_len;
@@ -613,26 +613,27 @@ net_crc32(const uint8_t *p, int len)
     return crc;
 }
 
+/* Table-driven FCS: this runs over the full frame for every received
+   packet, unlike net_crc32() above which only hashes 6 address bytes. */
 uint32_t
 net_crc32_le(const uint8_t *p, int len)
 {
-    uint32_t crc;
-    int      carry;
-    uint8_t  b;
+    static uint32_t crc_table[256];
+    uint32_t        crc;
 
-    crc = 0xffffffff;
-    for (int i = 0; i < len; i++) {
-        b = *p++;
-        for (uint8_t j = 0; j < 8; j++) {
-            carry = (crc & 0x1) ^ (b & 0x01);
-            crc >>= 1;
-            b >>= 1;
-            if (carry) {
-                crc ^= 0xedb88320;
-            }
+    if (!crc_table[1]) {
+        for (int n = 0; n < 256; n++) {
+            crc = n;
+            for (uint8_t j = 0; j < 8; j++)
+                crc = (crc >> 1) ^ ((crc & 0x1) ? 0xedb88320 : 0);
+            crc_table[n] = crc;
         }
     }
 
+    crc = 0xffffffff;
+    for (int i = 0; i < len; i++)
+        crc = (crc >> 8) ^ crc_table[(crc ^ p[i]) & 0xff];
+
     return crc;
 }
 
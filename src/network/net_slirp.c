@@ -348,9 +348,13 @@ net_slirp_thread(void *priv)
 
             case NET_EVENT_TX:
                 {
-                    int packets = network_tx_popv(slirp->card, slirp->pkt_tx_v, SLIRP_PKT_BATCH);
-                    for (int i = 0; i < packets; i++) {
-                        net_slirp_in(slirp, slirp->pkt_tx_v[i].data, slirp->pkt_tx_v[i].len);
+                    /* Keep draining: packets queued while the batch was being
+                       submitted are picked up without another poll cycle. */
+                    int packets;
+                    while ((packets = network_tx_popv(slirp->card, slirp->pkt_tx_v, SLIRP_PKT_BATCH)) > 0) {
+                        for (int i = 0; i < packets; i++) {
+                            net_slirp_in(slirp, slirp->pkt_tx_v[i].data, slirp->pkt_tx_v[i].len);
+                        }
                     }
                 }
                 break;
@@ -394,9 +398,13 @@ net_slirp_thread(void *priv)
         if (slirp->pfd[NET_EVENT_TX].revents & POLLIN) {
             net_event_clear(&slirp->tx_event);
 
-            int packets = network_tx_popv(slirp->card, slirp->pkt_tx_v, SLIRP_PKT_BATCH);
-            for (int i = 0; i < packets; i++) {
-                net_slirp_in(slirp, slirp->pkt_tx_v[i].data, slirp->pkt_tx_v[i].len);
+            /* Keep draining: packets queued while the batch was being
+               submitted are picked up without another poll cycle. */
+            int packets;
+            while ((packets = network_tx_popv(slirp->card, slirp->pkt_tx_v, SLIRP_PKT_BATCH)) > 0) {
+                for (int i = 0; i < packets; i++) {
+                    net_slirp_in(slirp, slirp->pkt_tx_v[i].data, slirp->pkt_tx_v[i].len);
+                }
             }
         }
     }
@@ -471,9 +479,9 @@ net_slirp_init(const netcard_t *card, const uint8_t *mac_addr, UNUSED(void *priv
     }
 
     for (int i = 0; i < SLIRP_PKT_BATCH; i++) {
-        slirp->pkt_tx_v[i].data = calloc(1, NET_MAX_FRAME);
+        slirp->pkt_tx_v[i].data = netbuf_alloc(NET_MAX_FRAME);
     }
-    slirp->pkt.data = calloc(1, NET_MAX_FRAME);
+    slirp->pkt.data = netbuf_alloc(NET_MAX_FRAME);
     net_event_init(&slirp->tx_event);
     net_event_init(&slirp->stop_event);
 #ifdef _WIN32
@@ -532,9 +540,9 @@ net_slirp_close(void *priv)
     net_event_close(&slirp->stop_event);
     slirp_cleanup(slirp->slirp);
     for (int i = 0; i < SLIRP_PKT_BATCH; i++) {
-        free(slirp->pkt_tx_v[i].data);
+        netbuf_free(slirp->pkt_tx_v[i].data);
     }
-    free(slirp->pkt.data);
+    netbuf_free(slirp->pkt.data);
     free(slirp);
     slirp_card_num--;
 }
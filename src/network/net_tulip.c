@@ -346,10 +346,7 @@ static void
 tulip_desc_read(TULIPState *s, uint32_t p,
                 struct tulip_descriptor *desc)
 {
-    desc->status    = mem_readl_phys(p);
-    desc->control   = mem_readl_phys(p + 4);
-    desc->buf_addr1 = mem_readl_phys(p + 8);
-    desc->buf_addr2 = mem_readl_phys(p + 12);
+    mem_read_phys_buf(desc, p, sizeof(*desc));
 
     if (s->csr[0] & CSR0_DBO) {
         bswap32s(&desc->status);
@@ -364,15 +361,15 @@ tulip_desc_write(TULIPState *s, uint32_t p,
                  struct tulip_descriptor *desc)
 {
     if (s->csr[0] & CSR0_DBO) {
-        mem_writel_phys(p, bswap32(desc->status));
-        mem_writel_phys(p + 4, bswap32(desc->control));
-        mem_writel_phys(p + 8, bswap32(desc->buf_addr1));
-        mem_writel_phys(p + 12, bswap32(desc->buf_addr2));
+        struct tulip_descriptor swapped = {
+            .status    = bswap32(desc->status),
+            .control   = bswap32(desc->control),
+            .buf_addr1 = bswap32(desc->buf_addr1),
+            .buf_addr2 = bswap32(desc->buf_addr2)
+        };
+        mem_write_phys_buf(&swapped, p, sizeof(swapped));
     } else {
-        mem_writel_phys(p, desc->status);
-        mem_writel_phys(p + 4, desc->control);
-        mem_writel_phys(p + 8, desc->buf_addr1);
-        mem_writel_phys(p + 12, desc->buf_addr2);
+        mem_write_phys_buf(desc, p, sizeof(*desc));
     }
 }
 
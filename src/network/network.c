@@ -62,8 +62,10 @@
 #include <86box/86box.h>
 #include <86box/device.h>
 #include <86box/timer.h>
+#include <86box/perfctr.h>
 #include <86box/plat.h>
 #include <86box/thread.h>
+#include <86box/trace.h>
 #include <86box/ui.h>
 #include <86box/timer.h>
 #include <86box/network.h>
@@ -149,6 +151,7 @@ int  network_ndev;
 netdev_t network_devs[NET_HOST_INTF_MAX];
 
 /* Local variables. */
+static netcard_t *net_cards_active[NET_CARD_MAX];
 
 #if defined     ENABLE_NETWORK_LOG && !defined(_WIN32)
 int             network_do_log = ENABLE_NETWORK_LOG;
@@ -212,6 +215,101 @@ network_winsock_clean(void)
 }
 #endif
 
+/* Shared pool of frame buffers. Every queue slot, staging packet and
+   backend scratch frame is NET_MAX_FRAME bytes, so a single size class
+   covers all of them: blocks are cache-line aligned and recycled through
+   a free list under a mutex, keeping the per-packet paths (PLIP, the
+   SLIP modem) off the host allocator. Since all pooled buffers are the
+   same size, the swap-based queue handoff below stays valid no matter
+   where a buffer came from. Oversized requests fall through to plain
+   malloc and are freed directly. */
+#define NETBUF_ALIGN 64
+
+typedef struct netbuf_hdr_t {
+    void                *raw;    /* malloc'd block, for the final free */
+    uint8_t             *data;   /* aligned payload */
+    struct netbuf_hdr_t *next;   /* free-list link */
+    int                  pooled; /* 0 = oversized one-off */
+} netbuf_hdr_t;
+
+static netbuf_hdr_t *netbuf_free_list = NULL;
+static mutex_t      *netbuf_mutex     = NULL;
+
+static netbuf_hdr_t *
+netbuf_new(int len, int pooled)
+{
+    uint8_t      *raw = malloc(sizeof(netbuf_hdr_t) + sizeof(netbuf_hdr_t *) + NETBUF_ALIGN + len);
+    netbuf_hdr_t *hdr = (netbuf_hdr_t *) raw;
+    uintptr_t     addr;
+
+    if (raw == NULL)
+        fatal("netbuf_new - out of memory\n");
+
+    addr = (uintptr_t) (raw + sizeof(netbuf_hdr_t) + sizeof(netbuf_hdr_t *));
+    addr = (addr + (NETBUF_ALIGN - 1)) & ~((uintptr_t) (NETBUF_ALIGN - 1));
+
+    hdr->raw    = raw;
+    hdr->data   = (uint8_t *) addr;
+    hdr->next   = NULL;
+    hdr->pooled = pooled;
+    /* Back pointer right below the payload, for netbuf_free(). */
+    ((netbuf_hdr_t **) addr)[-1] = hdr;
+
+    return hdr;
+}
+
+uint8_t *
+netbuf_alloc(int len)
+{
+    netbuf_hdr_t *hdr = NULL;
+
+    if (len <= NET_MAX_FRAME) {
+        thread_wait_mutex(netbuf_mutex);
+        hdr = netbuf_free_list;
+        if (hdr != NULL)
+            netbuf_free_list = hdr->next;
+        thread_release_mutex(netbuf_mutex);
+
+        if (hdr == NULL)
+            hdr = netbuf_new(NET_MAX_FRAME, 1);
+    } else
+        hdr = netbuf_new(len, 0);
+
+    return hdr->data;
+}
+
+void
+netbuf_free(uint8_t *buf)
+{
+    netbuf_hdr_t *hdr;
+
+    if (buf == NULL)
+        return;
+
+    hdr = ((netbuf_hdr_t **) buf)[-1];
+    if (hdr->pooled) {
+        thread_wait_mutex(netbuf_mutex);
+        hdr->next        = netbuf_free_list;
+        netbuf_free_list = hdr;
+        thread_release_mutex(netbuf_mutex);
+    } else
+        free(hdr->raw);
+}
+
+static void
+netbuf_pool_close(void)
+{
+    while (netbuf_free_list != NULL) {
+        netbuf_hdr_t *hdr = netbuf_free_list;
+
+        netbuf_free_list = hdr->next;
+        free(hdr->raw);
+    }
+
+    thread_close_mutex(netbuf_mutex);
+    netbuf_mutex = NULL;
+}
+
 /*
  * Initialize the configured network cards.
  *
@@ -230,6 +328,8 @@ network_init(void)
     atexit(network_winsock_clean);
 #endif
 
+    netbuf_mutex = thread_create_mutex();
+
     /* Create a first device entry that's always there, as needed by UI. */
     strcpy(network_devs[0].device, "none");
     strcpy(network_devs[0].description, "None");
@@ -271,26 +371,34 @@ network_init(void)
 #endif
 }
 
+/* The queues are lock-free single-producer/single-consumer rings: only the
+   producer writes head and only the consumer writes tail, each with release
+   ordering after the slot's packet has been filled or drained, so the other
+   side always observes a consistent slot behind an index it acquires. */
 void
 network_queue_init(netqueue_t *queue)
 {
-    queue->head = queue->tail = 0;
+    queue->head    = 0;
+    queue->tail    = 0;
+    queue->dropped = 0;
     for (int i = 0; i < NET_QUEUE_LEN; i++) {
-        queue->packets[i].data = calloc(1, NET_MAX_FRAME);
+        queue->packets[i].data = netbuf_alloc(NET_MAX_FRAME);
         queue->packets[i].len  = 0;
     }
 }
 
+/* Producer side. */
 static bool
 network_queue_full(netqueue_t *queue)
 {
-    return ((queue->head + 1) & NET_QUEUE_LEN_MASK) == queue->tail;
+    return ((atomic_load_explicit(&queue->head, memory_order_relaxed) + 1) & NET_QUEUE_LEN_MASK) == atomic_load_explicit(&queue->tail, memory_order_acquire);
 }
 
+/* Consumer side. */
 static bool
 network_queue_empty(netqueue_t *queue)
 {
-    return (queue->head == queue->tail);
+    return atomic_load_explicit(&queue->head, memory_order_acquire) == atomic_load_explicit(&queue->tail, memory_order_relaxed);
 }
 
 static inline void
@@ -304,14 +412,22 @@ network_swap_packet(netpkt_t *pkt1, netpkt_t *pkt2)
 int
 network_queue_put(netqueue_t *queue, uint8_t *data, int len)
 {
-    if (len == 0 || len > NET_MAX_FRAME || network_queue_full(queue)) {
+    if (len == 0 || len > NET_MAX_FRAME) {
+        return 0;
+    }
+
+    if (network_queue_full(queue)) {
+        atomic_fetch_add_explicit(&queue->dropped, 1, memory_order_relaxed);
+        PERF_INC(PERF_NET_DROP);
         return 0;
     }
 
-    netpkt_t *pkt = &queue->packets[queue->head];
+    int       head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    netpkt_t *pkt  = &queue->packets[head];
     memcpy(pkt->data, data, len);
-    pkt->len    = len;
-    queue->head = (queue->head + 1) & NET_QUEUE_LEN_MASK;
+    pkt->len = len;
+    atomic_store_explicit(&queue->head, (head + 1) & NET_QUEUE_LEN_MASK, memory_order_release);
+    TRACE_INSTANT(TRACE_NET, "net", "queue_put");
     return 1;
 }
 
@@ -330,13 +446,19 @@ network_queue_put_swap(netqueue_t *queue, netpkt_t *src_pkt)
             network_dump_packet(src_pkt);
         }
 #endif
+        if ((src_pkt->len > 0) && (src_pkt->len <= NET_MAX_FRAME)) {
+            atomic_fetch_add_explicit(&queue->dropped, 1, memory_order_relaxed);
+            PERF_INC(PERF_NET_DROP);
+        }
         return 0;
     }
 
-    netpkt_t *dst_pkt = &queue->packets[queue->head];
+    int       head    = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    netpkt_t *dst_pkt = &queue->packets[head];
     network_swap_packet(src_pkt, dst_pkt);
 
-    queue->head = (queue->head + 1) & NET_QUEUE_LEN_MASK;
+    atomic_store_explicit(&queue->head, (head + 1) & NET_QUEUE_LEN_MASK, memory_order_release);
+    TRACE_INSTANT(TRACE_NET, "net", "queue_put_swap");
     return 1;
 }
 
@@ -346,9 +468,11 @@ network_queue_get_swap(netqueue_t *queue, netpkt_t *dst_pkt)
     if (network_queue_empty(queue))
         return 0;
 
-    netpkt_t *src_pkt = &queue->packets[queue->tail];
+    int       tail    = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    netpkt_t *src_pkt = &queue->packets[tail];
     network_swap_packet(src_pkt, dst_pkt);
-    queue->tail = (queue->tail + 1) & NET_QUEUE_LEN_MASK;
+    atomic_store_explicit(&queue->tail, (tail + 1) & NET_QUEUE_LEN_MASK, memory_order_release);
+    TRACE_INSTANT(TRACE_NET, "net", "queue_get_swap");
     return 1;
 }
 
@@ -362,21 +486,40 @@ network_queue_move(netqueue_t *dst_q, netqueue_t *src_q)
         return 0;
     }
 
-    netpkt_t *src_pkt = &src_q->packets[src_q->tail];
-    netpkt_t *dst_pkt = &dst_q->packets[dst_q->head];
+    int src_tail = atomic_load_explicit(&src_q->tail, memory_order_relaxed);
+    int dst_head = atomic_load_explicit(&dst_q->head, memory_order_relaxed);
+
+    netpkt_t *src_pkt = &src_q->packets[src_tail];
+    netpkt_t *dst_pkt = &dst_q->packets[dst_head];
 
     network_swap_packet(src_pkt, dst_pkt);
-    dst_q->head = (dst_q->head + 1) & NET_QUEUE_LEN_MASK;
-    src_q->tail = (src_q->tail + 1) & NET_QUEUE_LEN_MASK;
 
-    return dst_pkt->len;
+    /* Capture the length before publishing: once head is stored, the consumer
+       may pop and recycle the slot at any moment. */
+    int len = dst_pkt->len;
+    atomic_store_explicit(&dst_q->head, (dst_head + 1) & NET_QUEUE_LEN_MASK, memory_order_release);
+    atomic_store_explicit(&src_q->tail, (src_tail + 1) & NET_QUEUE_LEN_MASK, memory_order_release);
+
+    return len;
+}
+
+uint32_t
+network_queue_depth(netqueue_t *queue)
+{
+    return (atomic_load_explicit(&queue->head, memory_order_relaxed) - atomic_load_explicit(&queue->tail, memory_order_relaxed)) & NET_QUEUE_LEN_MASK;
+}
+
+uint32_t
+network_queue_dropped(netqueue_t *queue)
+{
+    return atomic_load_explicit(&queue->dropped, memory_order_relaxed);
 }
 
 void
 network_queue_clear(netqueue_t *queue)
 {
     for (int i = 0; i < NET_QUEUE_LEN; i++) {
-        free(queue->packets[i].data);
+        netbuf_free(queue->packets[i].data);
         queue->packets[i].len = 0;
     }
     queue->tail = queue->head = 0;
@@ -397,10 +540,7 @@ network_rx_queue(void *priv)
     uint32_t rx_bytes = 0;
     for (int i = 0; i < NET_QUEUE_LEN; i++) {
         if (card->queued_pkt.len == 0) {
-            thread_wait_mutex(card->rx_mutex);
-            int res = network_queue_get_swap(&card->queues[NET_QUEUE_RX], &card->queued_pkt);
-            thread_release_mutex(card->rx_mutex);
-            if (!res)
+            if (!network_queue_get_swap(&card->queues[NET_QUEUE_RX], &card->queued_pkt))
                 break;
         }
 
@@ -414,14 +554,12 @@ network_rx_queue(void *priv)
 
     /* Transmission. */
     uint32_t tx_bytes = 0;
-    thread_wait_mutex(card->tx_mutex);
     for (int i = 0; i < NET_QUEUE_LEN; i++) {
         uint32_t bytes = network_queue_move(&card->queues[NET_QUEUE_TX_HOST], &card->queues[NET_QUEUE_TX_VM]);
         if (!bytes)
             break;
         tx_bytes += bytes;
     }
-    thread_release_mutex(card->tx_mutex);
     if (tx_bytes) {
         /* Notify host that a packet is available in the TX queue */
         card->host_drv.notify_in(card->host_drv.priv);
@@ -450,28 +588,19 @@ network_rx_queue(void *priv)
  * finished initializing itself, to link itself to the platform support
  * modules.
  */
-netcard_t *
-network_attach(void *card_drv, uint8_t *mac, NETRXCB rx, NETSETLINKSTATE set_link_state)
+/* Bind the host side of a card to whatever backend net_cards_conf
+   selects for it, falling back to the null driver (with the same user
+   notification as at startup) when that backend cannot be brought up. */
+static void
+network_host_attach(netcard_t *card)
 {
-    netcard_t *card       = calloc(1, sizeof(netcard_t));
-    int net_type          = net_cards_conf[net_card_current].net_type;
-    card->queued_pkt.data = calloc(1, NET_MAX_FRAME);
-    card->card_drv        = card_drv;
-    card->rx              = rx;
-    card->set_link_state  = set_link_state;
-    card->tx_mutex        = thread_create_mutex();
-    card->rx_mutex        = thread_create_mutex();
-    card->card_num        = net_card_current;
-    card->byte_period     = NET_PERIOD_10M;
+    netcard_conf_t *nc       = &net_cards_conf[card->card_num];
+    int             net_type = nc->net_type;
 
     char net_drv_error[NET_DRV_ERRBUF_SIZE];
     wchar_t tempmsg[NET_DRV_ERRBUF_SIZE * 2];
 
-    for (int i = 0; i < NET_QUEUE_COUNT; i++) {
-        network_queue_init(&card->queues[i]);
-    }
-
-    if (!strcmp(network_card_get_internal_name(net_cards_conf[net_card_current].device_num), "modem") && net_type >= NET_TYPE_PCAP) {
+    if (!strcmp(network_card_get_internal_name(nc->device_num), "modem") && net_type >= NET_TYPE_PCAP) {
         /* Force SLiRP here. Modem only operates on non-Ethernet frames. */
         net_type = NET_TYPE_SLIRP;
     }
@@ -479,17 +608,17 @@ network_attach(void *card_drv, uint8_t *mac, NETRXCB rx, NETSETLINKSTATE set_lin
     switch (net_type) {
         case NET_TYPE_SLIRP:
             card->host_drv      = net_slirp_drv;
-            card->host_drv.priv = card->host_drv.init(card, mac, NULL, net_drv_error);
+            card->host_drv.priv = card->host_drv.init(card, card->mac, NULL, net_drv_error);
             break;
 
         case NET_TYPE_PCAP:
             card->host_drv      = net_pcap_drv;
-            card->host_drv.priv = card->host_drv.init(card, mac, net_cards_conf[net_card_current].host_dev_name, net_drv_error);
+            card->host_drv.priv = card->host_drv.init(card, card->mac, nc->host_dev_name, net_drv_error);
             break;
 #ifdef HAS_VDE
         case NET_TYPE_VDE:
             card->host_drv      = net_vde_drv;
-            card->host_drv.priv = card->host_drv.init(card, mac, net_cards_conf[net_card_current].host_dev_name, net_drv_error);
+            card->host_drv.priv = card->host_drv.init(card, card->mac, nc->host_dev_name, net_drv_error);
             break;
 #endif
         default:
@@ -502,57 +631,97 @@ network_attach(void *card_drv, uint8_t *mac, NETRXCB rx, NETSETLINKSTATE set_lin
     // * Failure to init a specific driver (in which case card->host_drv.priv is null)
     if (!card->host_drv.priv) {
 
-        if(net_cards_conf[net_card_current].net_type != NET_TYPE_NONE) {
+        if(nc->net_type != NET_TYPE_NONE) {
             // We're here because of a failure
             swprintf(tempmsg, sizeof_w(tempmsg), L"%ls:<br /><br />%s<br /><br />%ls", plat_get_string(STRING_NET_ERROR), net_drv_error, plat_get_string(STRING_NET_ERROR_DESC));
             ui_msgbox(MBX_ERROR, tempmsg);
-            net_cards_conf[net_card_current].net_type = NET_TYPE_NONE;
+            nc->net_type = NET_TYPE_NONE;
         }
 
         // Init null driver
         card->host_drv      = net_null_drv;
-        card->host_drv.priv = card->host_drv.init(card, mac, NULL, net_drv_error);
+        card->host_drv.priv = card->host_drv.init(card, card->mac, NULL, net_drv_error);
         // Set link state to disconnected by default
         network_connect(card->card_num, 0);
         ui_sb_update_icon_state(SB_NETWORK | card->card_num, 1);
+    }
+}
+
+netcard_t *
+network_attach(void *card_drv, uint8_t *mac, NETRXCB rx, NETSETLINKSTATE set_link_state)
+{
+    netcard_t *card       = calloc(1, sizeof(netcard_t));
+    card->queued_pkt.data = netbuf_alloc(NET_MAX_FRAME);
+    card->card_drv        = card_drv;
+    card->mac             = mac;
+    card->rx              = rx;
+    card->set_link_state  = set_link_state;
+    card->card_num        = net_card_current;
+    card->byte_period     = NET_PERIOD_10M;
+
+    for (int i = 0; i < NET_QUEUE_COUNT; i++) {
+        network_queue_init(&card->queues[i]);
+    }
+
+    network_host_attach(card);
 
-        // If null fails, something is very wrong
-        // Clean up and fatal
-        if(!card->host_drv.priv) {
-            thread_close_mutex(card->tx_mutex);
-            thread_close_mutex(card->rx_mutex);
-            for (int i = 0; i < NET_QUEUE_COUNT; i++) {
-                network_queue_clear(&card->queues[i]);
-            }
-
-            free(card->queued_pkt.data);
-            free(card);
-            // Placeholder - insert the error message
-            fatal("Error initializing the network device: Null driver initialization failed");
-            return NULL;
+    // If null fails, something is very wrong
+    // Clean up and fatal
+    if(!card->host_drv.priv) {
+        for (int i = 0; i < NET_QUEUE_COUNT; i++) {
+            network_queue_clear(&card->queues[i]);
         }
 
+        netbuf_free(card->queued_pkt.data);
+        free(card);
+        // Placeholder - insert the error message
+        fatal("Error initializing the network device: Null driver initialization failed");
+        return NULL;
     }
 
+    net_cards_active[card->card_num] = card;
+
     timer_add(&card->timer, network_rx_queue, card, 0);
     timer_on_auto(&card->timer, 100);
 
     return card;
 }
 
+/* Swap the host backend of a live card to whatever net_cards_conf now
+   selects, leaving the emulated side untouched.  Called with the
+   emulator paused, so the card is not mid-transfer. */
+void
+network_reattach(int id)
+{
+    netcard_t *card = net_cards_active[id];
+
+    if (card == NULL)
+        return;
+
+    card->host_drv.close(card->host_drv.priv);
+
+    network_host_attach(card);
+
+    if (!card->host_drv.priv)
+        fatal("Error reattaching the network device: Null driver initialization failed");
+
+    ui_sb_update_icon_state(SB_NETWORK | id, net_cards_conf[id].net_type == NET_TYPE_NONE);
+}
+
 void
 netcard_close(netcard_t *card)
 {
+    if (net_cards_active[card->card_num] == card)
+        net_cards_active[card->card_num] = NULL;
+
     timer_stop(&card->timer);
     card->host_drv.close(card->host_drv.priv);
 
-    thread_close_mutex(card->tx_mutex);
-    thread_close_mutex(card->rx_mutex);
     for (int i = 0; i < NET_QUEUE_COUNT; i++) {
         network_queue_clear(&card->queues[i]);
     }
 
-    free(card->queued_pkt.data);
+    netbuf_free(card->queued_pkt.data);
     free(card);
 }
 
@@ -565,6 +734,8 @@ network_close(void)
     network_dump_mutex = NULL;
 #endif
 
+    netbuf_pool_close();
+
     network_log("NETWORK: closed.\n");
 }
 
@@ -606,13 +777,7 @@ network_tx(netcard_t *card, uint8_t *bufp, int len)
 int
 network_tx_pop(netcard_t *card, netpkt_t *out_pkt)
 {
-    int ret = 0;
-
-    thread_wait_mutex(card->tx_mutex);
-    ret = network_queue_get_swap(&card->queues[NET_QUEUE_TX_HOST], out_pkt);
-    thread_release_mutex(card->tx_mutex);
-
-    return ret;
+    return network_queue_get_swap(&card->queues[NET_QUEUE_TX_HOST], out_pkt);
 }
 
 int
@@ -621,14 +786,12 @@ network_tx_popv(netcard_t *card, netpkt_t *pkt_vec, int vec_size)
     int pkt_count = 0;
 
     netqueue_t *queue = &card->queues[NET_QUEUE_TX_HOST];
-    thread_wait_mutex(card->tx_mutex);
     for (int i = 0; i < vec_size; i++) {
         if (!network_queue_get_swap(queue, pkt_vec))
             break;
         pkt_count++;
         pkt_vec++;
     }
-    thread_release_mutex(card->tx_mutex);
 
     return pkt_count;
 }
@@ -636,25 +799,13 @@ network_tx_popv(netcard_t *card, netpkt_t *pkt_vec, int vec_size)
 int
 network_rx_put(netcard_t *card, uint8_t *bufp, int len)
 {
-    int ret = 0;
-
-    thread_wait_mutex(card->rx_mutex);
-    ret = network_queue_put(&card->queues[NET_QUEUE_RX], bufp, len);
-    thread_release_mutex(card->rx_mutex);
-
-    return ret;
+    return network_queue_put(&card->queues[NET_QUEUE_RX], bufp, len);
 }
 
 int
 network_rx_put_pkt(netcard_t *card, netpkt_t *pkt)
 {
-    int ret = 0;
-
-    thread_wait_mutex(card->rx_mutex);
-    ret = network_queue_put_swap(&card->queues[NET_QUEUE_RX], pkt);
-    thread_release_mutex(card->rx_mutex);
-
-    return ret;
+    return network_queue_put_swap(&card->queues[NET_QUEUE_RX], pkt);
 }
 
 void
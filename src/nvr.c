@@ -58,6 +58,7 @@
 #include <86box/timer.h>
 #include <86box/path.h>
 #include <86box/plat.h>
+#include <86box/thread.h>
 #include <86box/nvr.h>
 
 int nvr_dosave; /* NVR is dirty, needs saved */
@@ -66,6 +67,18 @@ static int8_t    days_in_month[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 3
 static struct tm intclk;
 static nvr_t    *saved_nvr = NULL;
 
+/* Worker thread that does the actual file writes, so that flushing a
+   dirty NVR never blocks the emulation thread on disk I/O. The buffers
+   hold the pending image, guarded by the mutex; a new request simply
+   overwrites a not-yet-written one. */
+static thread_t    *save_thread = NULL;
+static event_t     *save_wake   = NULL;
+static mutex_t     *save_mutex  = NULL;
+static volatile int save_pending = 0;
+static char         save_path[1024];
+static uint8_t      save_regs[NVR_MAXSIZE];
+static int          save_size = 0;
+
 #ifdef ENABLE_NVR_LOG
 int nvr_do_log = ENABLE_NVR_LOG;
 
@@ -270,12 +283,86 @@ nvr_set_ven_save(void (*ven_save)(void))
     saved_nvr->ven_save = ven_save;
 }
 
+/* Write an NVR image out atomically: write a temporary file first, then
+   move it over the old one, so an interrupted write can never leave a
+   truncated NVR behind. */
+static void
+nvr_write_file(const char *path, const uint8_t *regs, int size)
+{
+    char  temp[1040];
+    FILE *fp;
+
+    snprintf(temp, sizeof(temp), "%s.tmp", path);
+    fp = plat_fopen(temp, "wb");
+    if (fp == NULL)
+        return;
+
+    /* Save NVR contents to file. */
+    (void) fwrite(regs, size, 1, fp);
+    fclose(fp);
+
+    plat_remove((char *) path);
+    (void) rename(temp, path);
+}
+
+/* The NVR save worker thread. */
+static void
+nvr_save_thread(UNUSED(void *priv))
+{
+    while (1) {
+        thread_wait_event(save_wake, -1);
+        thread_reset_event(save_wake);
+
+        while (save_pending) {
+            thread_wait_mutex(save_mutex);
+            if (save_pending) {
+                nvr_log("NVR: saving to '%s' (worker)\n", save_path);
+                nvr_write_file(save_path, save_regs, save_size);
+                save_pending = 0;
+            }
+            thread_release_mutex(save_mutex);
+        }
+    }
+}
+
+/* Queue the current NVR for saving on the worker thread. */
+void
+nvr_save_async(void)
+{
+    /* Make sure we have been initialized. */
+    if (saved_nvr == NULL)
+        return;
+
+    if (saved_nvr->size != 0) {
+        if (save_thread == NULL) {
+            save_mutex  = thread_create_mutex();
+            save_wake   = thread_create_event();
+            save_thread = thread_create(nvr_save_thread, NULL);
+        }
+
+        thread_wait_mutex(save_mutex);
+        strncpy(save_path, nvr_path(saved_nvr->fn), sizeof(save_path) - 1);
+        memcpy(save_regs, saved_nvr->regs, saved_nvr->size);
+        save_size    = saved_nvr->size;
+        save_pending = 1;
+        thread_release_mutex(save_mutex);
+        thread_set_event(save_wake);
+    }
+
+    /* Vendor saves serialize live device state, so they must stay on
+       the calling thread. */
+    if (saved_nvr->ven_save)
+        saved_nvr->ven_save();
+
+    /* Device is clean again. */
+    nvr_dosave = 0;
+}
+
 /* Save the current NVR to a file. */
 int
 nvr_save(void)
 {
     const char *path;
-    FILE       *fp;
 
     /* Make sure we have been initialized. */
     if (saved_nvr == NULL)
@@ -284,12 +371,13 @@ nvr_save(void)
     if (saved_nvr->size != 0) {
         path = nvr_path(saved_nvr->fn);
         nvr_log("NVR: saving to '%s'\n", path);
-        fp = plat_fopen(path, "wb");
-        if (fp != NULL) {
-            /* Save NVR contents to file. */
-            (void) fwrite(saved_nvr->regs, saved_nvr->size, 1, fp);
-            fclose(fp);
-        }
+        if (save_mutex != NULL)
+            thread_wait_mutex(save_mutex);
+        /* This write supersedes any image still queued for the worker. */
+        save_pending = 0;
+        nvr_write_file(path, saved_nvr->regs, saved_nvr->size);
+        if (save_mutex != NULL)
+            thread_release_mutex(save_mutex);
     }
 
     if (saved_nvr->ven_save)
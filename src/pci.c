@@ -578,6 +578,32 @@ pci_reg_read(uint16_t port)
     return ret;
 }
 
+/* Aligned word/dword read: resolve the slot mapping once and read all the
+   bytes through the card's handler, instead of re-deriving the target per
+   byte through pci_read(). */
+static uint32_t
+pci_reg_read_multi(uint16_t port, int len)
+{
+    uint8_t  slot;
+    uint32_t ret = 0xffffffff;
+
+    if (port >= 0xc000) {
+        pci_card  = (port >> 8) & 0xf;
+        pci_index = port & 0xfc;
+    }
+
+    slot = pci_card_to_slot_mapping[pci_bus_number_to_index_mapping[pci_bus]][pci_card];
+    if ((slot != PCI_CARD_INVALID) && pci_cards[slot].read) {
+        ret = 0x00000000;
+        for (int i = 0; i < len; i++)
+            ret |= ((uint32_t) pci_cards[slot].read(pci_func, pci_index | ((port + i) & 0x03), pci_cards[slot].priv)) << (i << 3);
+    }
+    pci_log("PCI: [R%d] Mechanism #%i, slot %02X, card %02X:%02X, function %02X, index %02X = %08X\n",
+            len, (port >= 0xc000) ? 2 : 1, slot, pci_card, pci_bus, pci_func, pci_index | (port & 0x03), ret);
+
+    return ret;
+}
+
 uint8_t
 pci_read(uint16_t port, UNUSED(void *priv))
 {
@@ -637,13 +663,22 @@ pci_readw(uint16_t port, UNUSED(void *priv))
         ret = pci_read(port, priv);
         ret |= ((uint16_t) pci_read(port + 1, priv)) << 8;
     } else {
-        /* Aligned access, still split because we cheat. */
+        /* Aligned access, slot resolved once for both bytes. */
         switch (port) {
             case 0xcfc:
             case 0xcfe:
-            case 0xc000 ... 0xcffe:
-                ret = pci_read(port, priv);
-                ret |= ((uint16_t) pci_read(port + 1, priv)) << 8;
+                if ((pci_flags & FLAG_MECHANISM_1) && (pci_flags & FLAG_CONFIG_M1_IO_ON))
+                    ret = pci_reg_read_multi(port, 2);
+                break;
+
+            case 0xc000 ... 0xc0fe:
+                if ((pci_flags & FLAG_MECHANISM_2) && (pci_flags & (FLAG_CONFIG_IO_ON | FLAG_CONFIG_DEV0_IO_ON)))
+                    ret = pci_reg_read_multi(port, 2);
+                break;
+
+            case 0xc100 ... 0xcffe:
+                if ((pci_flags & FLAG_MECHANISM_2) && (pci_flags & FLAG_CONFIG_IO_ON))
+                    ret = pci_reg_read_multi(port, 2);
                 break;
 
             default:
@@ -679,10 +714,18 @@ pci_readl(uint16_t port, UNUSED(void *priv))
                 }
                 break;
             case 0xcfc:
-            case 0xc000 ... 0xcffc:
-                /* Still split because we cheat. */
-                ret = pci_readw(port, priv);
-                ret |= ((uint32_t) pci_readw(port + 2, priv)) << 16;
+                if ((pci_flags & FLAG_MECHANISM_1) && (pci_flags & FLAG_CONFIG_M1_IO_ON))
+                    ret = pci_reg_read_multi(port, 4);
+                break;
+
+            case 0xc000 ... 0xc0fc:
+                if ((pci_flags & FLAG_MECHANISM_2) && (pci_flags & (FLAG_CONFIG_IO_ON | FLAG_CONFIG_DEV0_IO_ON)))
+                    ret = pci_reg_read_multi(port, 4);
+                break;
+
+            case 0xc100 ... 0xcffc:
+                if ((pci_flags & FLAG_MECHANISM_2) && (pci_flags & FLAG_CONFIG_IO_ON))
+                    ret = pci_reg_read_multi(port, 4);
                 break;
         }
     }
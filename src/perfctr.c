@@ -0,0 +1,65 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Implementation of the always-on performance counters: a fixed
+ *          set of cache-line padded cells bumped from the hot paths and
+ *          read on demand by the status dialog and the log dump.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <86box/86box.h>
+#include <86box/perfctr.h>
+
+perf_counter_t perf_counters[PERF_MAX];
+
+static const char *perf_labels[PERF_MAX] = {
+    [PERF_MMU_FLUSH]             = "MMU lookup flushes",
+    [PERF_MMU_LOOKUP_FILL]       = "MMU lookup fills",
+    [PERF_BLOCK_MISS]            = "Codeblock hash misses",
+    [PERF_BLOCK_EXIT_BRANCH]     = "Block exits: branch",
+    [PERF_BLOCK_EXIT_PAGE_CROSS] = "Block exits: byte limit",
+    [PERF_BLOCK_EXIT_FLAG]       = "Block exits: trap/intr",
+    [PERF_BLOCK_EXIT_CAPACITY]   = "Block exits: ins limit",
+    [PERF_IDLE_BLOCK]            = "Idle poll blocks",
+    [PERF_IDLE_SKIP]             = "Idle poll skips",
+    [PERF_TIMER_DEPTH]           = "Timer queue depth",
+    [PERF_FIFO_STALL]            = "Voodoo FIFO stalls",
+    [PERF_NET_DROP]              = "Network queue drops",
+    [PERF_BLIT_SPAN]             = "Blit rows: span path",
+    [PERF_BLIT_PIXEL]            = "Blit rows: per pixel"
+};
+
+uint64_t
+perf_read(int i)
+{
+    if ((i < 0) || (i >= PERF_MAX))
+        return 0;
+
+    return perf_counters[i].val;
+}
+
+const char *
+perf_label(int i)
+{
+    if ((i < 0) || (i >= PERF_MAX))
+        return "";
+
+    return perf_labels[i];
+}
+
+void
+perf_dump(void)
+{
+    pclog("Performance counters:\n");
+    for (int i = 0; i < PERF_MAX; i++)
+        pclog("    %-22s %llu\n", perf_labels[i], (unsigned long long) perf_counters[i].val);
+}
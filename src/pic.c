@@ -186,24 +186,31 @@ pic_slave_on(pic_t *dev, int channel)
     return pic_cascade_mode(dev) && (dev->is_master || ((dev->icw4 & 0x0c) == 0x0c)) && (dev->icw3 & (1 << channel));
 }
 
+/* Rotate an 8-bit mask right so that the current priority base lands on
+   bit 0, putting the lines in priority order for the bit scans below. */
+static __inline uint8_t
+pic_rotate(uint8_t mask, uint8_t priority)
+{
+    return (uint8_t) ((mask >> priority) | (mask << (8 - priority)));
+}
+
 static __inline int
 find_best_interrupt(pic_t *dev)
 {
-    uint8_t b;
+    uint8_t req  = (dev->state == 0) ? (dev->irr & ~dev->imr) : 0x00;
+    uint8_t line = dev->isr | req;
     uint8_t intr;
     uint8_t j;
     int8_t  ret = -1;
 
-    for (uint8_t i = 0; i < 8; i++) {
-        j = (i + dev->priority) & 7;
-        b = 1 << j;
+    /* One bit scan resolves the whole priority order: the first bit set
+       in either register decides, and it wins only if it is a request
+       rather than an interrupt already in service. */
+    if (line != 0x00) {
+        j = (__builtin_ctz(pic_rotate(line, dev->priority)) + dev->priority) & 7;
 
-        if (dev->isr & b)
-            break;
-        else if ((dev->state == 0) && ((dev->irr & ~dev->imr) & b)) {
+        if (req & ~dev->isr & (1 << j))
             ret = j;
-            break;
-        }
     }
 
     intr = dev->interrupt = (ret == -1) ? 0x17 : ret;
@@ -328,19 +335,11 @@ pic_acknowledge(pic_t *dev)
 static uint8_t
 pic_non_specific_find(pic_t *dev)
 {
-    uint8_t j;
-    uint8_t b;
-    uint8_t irq = 0xff;
-
-    for (uint8_t i = 0; i < 8; i++) {
-        j = (i + dev->priority) & 7;
-        b = (1 << j);
+    uint8_t line = dev->isr & (dev->special_mask_mode ? ~dev->imr : 0xff);
+    uint8_t irq  = 0xff;
 
-        if ((dev->isr & b) && (!dev->special_mask_mode || !(dev->imr & b))) {
-            irq = j;
-            break;
-        }
-    }
+    if (line != 0x00)
+        irq = (__builtin_ctz(pic_rotate(line, dev->priority)) + dev->priority) & 7;
 
     return irq;
 }
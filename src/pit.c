@@ -154,6 +154,8 @@ ctr_load_count(ctr_t *ctr)
     ctr->incomplete = !!(ctr->wm & 0x80);
 }
 
+static void pit_skip_catch_up(pit_t *dev);
+
 static void
 ctr_tick(ctr_t *ctr, void *priv)
 {
@@ -319,6 +321,8 @@ ctr_clock(void *data, int counter_id)
     pit_t *pit = (pit_t *) data;
     ctr_t *ctr = &pit->counters[counter_id];
 
+    pit_skip_catch_up(pit);
+
     /* FIXME: Is this even needed? */
     if ((ctr->state == 3) && (ctr->m != 2) && (ctr->m != 3))
         return;
@@ -406,9 +410,11 @@ ctr_latch_count(ctr_t *ctr)
 uint16_t
 pit_ctr_get_count(void *data, int counter_id)
 {
-    const pit_t *pit = (pit_t *) data;
+    pit_t       *pit = (pit_t *) data;
     const ctr_t *ctr = &pit->counters[counter_id];
 
+    pit_skip_catch_up(pit);
+
     return (uint16_t) ctr->l;
 }
 
@@ -442,6 +448,8 @@ pit_ctr_set_gate(void *data, int counter_id, int gate)
     pit_t *pit = (pit_t *) data;
     ctr_t *ctr = &pit->counters[counter_id];
 
+    pit_skip_catch_up(pit);
+
     int     old  = ctr->gate;
     uint8_t mode = ctr->m & 3;
 
@@ -514,21 +522,196 @@ pit_ctr_set_using_timer(void *data, int counter_id, int using_timer)
 {
     if (tsc > 0)
         timer_process();
-    pit_t *pit       = (pit_t *) data;
-    ctr_t *ctr       = &pit->counters[counter_id];
+    pit_t *pit = (pit_t *) data;
+    ctr_t *ctr = &pit->counters[counter_id];
+
+    pit_skip_catch_up(pit);
     ctr->using_timer = using_timer;
 }
 
+/*Most guests leave the counters in plain rate-generator or square-wave
+  stretches where every half-clock callback just decrements a count. The
+  functions below let pit_timer_over() fast-forward such stretches: a
+  steady counter reports how many whole PIT clocks can pass before its
+  next state change, the skipped clocks are applied as pure arithmetic,
+  and any port access, gate change or reprogramming first catches the
+  counts up from the timer position so nothing observable is lost.*/
+#define PIT_SKIP_MAX     4096
+#define PIT_SKIP_FOREVER 0xffffffff
+
+static uint32_t
+ctr_steady_clocks(const ctr_t *ctr)
+{
+    if (!ctr->using_timer)
+        return PIT_SKIP_FOREVER;
+
+    if (ctr->latch || ctr->bcd || ctr->newcount || (ctr->state == 1) || ctr->s1_det)
+        return 0;
+
+    switch (ctr->m & 0x07) {
+        case 0:
+        case 1:
+            if (ctr->state == 2) {
+                if ((ctr->m & 0x07) == 0 && !ctr->gate)
+                    return PIT_SKIP_FOREVER;
+                if (ctr->count < 1)
+                    return PIT_SKIP_FOREVER;
+                return (ctr->count >= 2) ? (uint32_t) (ctr->count - 1) : 0;
+            }
+            return PIT_SKIP_FOREVER;
+        case 2:
+        case 6:
+            if (ctr->state == 3)
+                return 0;
+            if (ctr->state == 2) {
+                if (!ctr->gate || (ctr->count < 2))
+                    return PIT_SKIP_FOREVER;
+                return (ctr->count >= 3) ? (uint32_t) (ctr->count - 2) : 0;
+            }
+            return PIT_SKIP_FOREVER;
+        case 3:
+        case 7:
+            if ((ctr->state == 2) || (ctr->state == 3)) {
+                if (!ctr->gate || (ctr->count < 0))
+                    return PIT_SKIP_FOREVER;
+                return (ctr->count >= 2) ? (uint32_t) (ctr->count >> 1) : 0;
+            }
+            return PIT_SKIP_FOREVER;
+        case 4:
+        case 5:
+            if ((ctr->gate == 0) && (ctr->m == 4))
+                return PIT_SKIP_FOREVER;
+            if (ctr->state == 3)
+                return 0;
+            if (ctr->state == 2) {
+                if (ctr->count < 1)
+                    return PIT_SKIP_FOREVER;
+                return (ctr->count >= 2) ? (uint32_t) (ctr->count - 1) : 0;
+            }
+            return PIT_SKIP_FOREVER;
+        default:
+            return 0;
+    }
+}
+
+/*Apply n skipped whole clocks to a counter - the exact arithmetic the
+  per-clock ticks would have done, minus the state changes the steady
+  check ruled out.*/
+static void
+ctr_skip_clocks(ctr_t *ctr, uint32_t n)
+{
+    if (!ctr->using_timer || ctr->latch)
+        return;
+
+    switch (ctr->m & 0x07) {
+        case 0:
+            if (((ctr->state == 2) && ctr->gate && (ctr->count >= 1)) || (ctr->state == 3))
+                ctr->count -= n;
+            break;
+        case 1:
+            if (((ctr->state == 2) && (ctr->count >= 1)) || (ctr->state == 3) || (ctr->state == 6))
+                ctr->count -= n;
+            break;
+        case 2:
+        case 6:
+            if ((ctr->state == 2) && ctr->gate && (ctr->count >= 2))
+                ctr->count -= n;
+            break;
+        case 3:
+        case 7:
+            if (((ctr->state == 2) || (ctr->state == 3)) && ctr->gate && (ctr->count >= 0))
+                ctr->count -= 2 * n;
+            break;
+        case 4:
+        case 5:
+            if ((ctr->gate != 0) || (ctr->m != 4)) {
+                if ((ctr->state == 0) || (ctr->state == 6) || ((ctr->state == 2) && (ctr->count >= 1)))
+                    ctr->count -= n;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void
+pit_skip_apply(pit_t *dev, uint32_t elapsed)
+{
+    uint32_t delta = elapsed - dev->skip_done;
+
+    if (!delta)
+        return;
+
+    for (uint8_t i = 0; i < 3; i++)
+        ctr_skip_clocks(&dev->counters[i], delta);
+
+    dev->skip_done = elapsed;
+}
+
+/*Bring the counters current before anything observes or reprograms them,
+  and fall back to edge stepping from the next falling edge on.*/
+static void
+pit_skip_catch_up(pit_t *dev)
+{
+    uint64_t remaining;
+    uint32_t clocks_left;
+
+    if (!dev->skip_active)
+        return;
+
+    remaining   = timer_get_remaining_u64(&dev->callback_timer);
+    clocks_left = (uint32_t) (remaining / dev->pit_const);
+    if (clocks_left > dev->skip_total)
+        clocks_left = dev->skip_total;
+
+    pit_skip_apply(dev, dev->skip_total - clocks_left);
+    dev->skip_total = dev->skip_done;
+
+    timer_disable(&dev->callback_timer);
+    timer_set_delay_u64(&dev->callback_timer, remaining % dev->pit_const);
+}
+
 static void
 pit_timer_over(void *priv)
 {
-    pit_t *dev = (pit_t *) priv;
+    pit_t   *dev = (pit_t *) priv;
+    uint32_t skip;
+
+    if (dev->skip_active) {
+        pit_skip_apply(dev, dev->skip_total);
+        dev->skip_active = 0;
+    }
 
     dev->clock ^= 1;
 
     for (uint8_t i = 0; i < 3; i++)
         pit_ctr_set_clock_common(&dev->counters[i], dev->clock, dev);
 
+    if (!dev->clock) {
+        skip = ctr_steady_clocks(&dev->counters[0]);
+        for (uint8_t i = 1; skip && (i < 3); i++) {
+            uint32_t c = ctr_steady_clocks(&dev->counters[i]);
+
+            if (c < skip)
+                skip = c;
+        }
+        if (skip > PIT_SKIP_MAX)
+            skip = PIT_SKIP_MAX;
+
+        if (skip >= 2) {
+            dev->skip_active = 1;
+            dev->skip_total  = skip - 1;
+            dev->skip_done   = 0;
+            /*Pretend the intervening rising edge already happened - it is
+              a no-op for every counter the steady check lets through.*/
+            dev->clock = 1;
+            for (uint8_t i = 0; i < 3; i++)
+                dev->counters[i].clock = 1;
+            timer_advance_u64(&dev->callback_timer, dev->pit_const * (uint64_t) skip);
+            return;
+        }
+    }
+
     timer_advance_u64(&dev->callback_timer, dev->pit_const >> 1ULL);
 }
 
@@ -539,6 +722,8 @@ pit_write(uint16_t addr, uint8_t val, void *priv)
     int    t   = (addr & 3);
     ctr_t *ctr;
 
+    pit_skip_catch_up(dev);
+
     if ((dev->flags & (PIT_8254 | PIT_EXT_IO))) {
         pit_log("[%04X:%08X] pit_write(%04X, %02X, %08X)\n", CS, cpu_state.pc, addr, val, priv);
     }
@@ -720,6 +905,8 @@ pit_read(uint16_t addr, void *priv)
     int     t = (addr & 3);
     ctr_t  *ctr;
 
+    pit_skip_catch_up(dev);
+
     switch (addr & 3) {
         case 3: /* Control. */
             /* This is 8254-only, 8253 returns 0x00. */
@@ -872,6 +1059,8 @@ ctr_reset(ctr_t *ctr)
 void
 pit_device_reset(pit_t *dev)
 {
+    pit_skip_catch_up(dev);
+
     dev->clock = 0;
 
     for (uint8_t i = 0; i < 3; i++)
@@ -903,6 +1092,7 @@ pit_set_pit_const(void *data, uint64_t pit_const)
 {
     pit_t *pit = (pit_t *) data;
 
+    pit_skip_catch_up(pit);
     pit->pit_const = pit_const;
 }
 
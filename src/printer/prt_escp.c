@@ -67,6 +67,7 @@
 #include <86box/plat.h>
 #include <86box/ui.h>
 #include <86box/lpt.h>
+#include <86box/thread.h>
 #include <86box/video.h>
 #include <86box/png_struct.h>
 #include <86box/printer.h>
@@ -251,6 +252,20 @@ typedef struct escp_t {
     uint8_t ctrl;
 
     PALETTE palcol;
+
+    /* Asynchronous page encoder: finished pages are handed to a worker
+       thread for the PNG encode, which takes long enough on a 360 dpi
+       page to visibly stall the guest when done inline. The emulated
+       printer keeps rasterizing into a spare surface meanwhile; the two
+       pixel buffers ping-pong between the threads. */
+    thread_t *enc_thread;
+    event_t  *enc_wake;
+    event_t  *enc_done;
+    uint8_t  *enc_pixels;
+    char      enc_path[1024];
+    PALETTE   enc_palcol;
+    int8_t    enc_pending;
+    int8_t    enc_exit;
 } escp_t;
 
 static void
@@ -346,15 +361,50 @@ escp_log(const char *fmt, ...)
 #    define escp_log(fmt, ...)
 #endif
 
+/* Worker thread encoding finished pages; one job in flight at a time. */
+static void
+page_encoder_thread(void *priv)
+{
+    escp_t *dev = (escp_t *) priv;
+
+    for (;;) {
+        thread_wait_event(dev->enc_wake, -1);
+        thread_reset_event(dev->enc_wake);
+
+        if (dev->enc_pending) {
+            dev->enc_pending = 0;
+            png_write_rgb(dev->enc_path, dev->enc_pixels, dev->page->w, dev->page->h, dev->page->pitch, dev->enc_palcol);
+            pclog("ESC/P: saved page to %s\n", dev->enc_path);
+            thread_set_event(dev->enc_done);
+        }
+
+        if (dev->enc_exit)
+            break;
+    }
+}
+
 /* Dump the current page into a formatted file. */
 static void
 dump_page(escp_t *dev)
 {
-    char path[1024];
+    uint8_t *spare;
+
+    /* Wait for the previous page to finish encoding, then trade surfaces
+       with the worker and keep rasterizing into the one it just freed up.
+       The palette can change mid-job, so the job carries its own copy. */
+    thread_wait_event(dev->enc_done, -1);
+    thread_reset_event(dev->enc_done);
 
-    strcpy(path, dev->pagepath);
-    strcat(path, dev->page_fn);
-    png_write_rgb(path, dev->page->pixels, dev->page->w, dev->page->h, dev->page->pitch, dev->palcol);
+    spare             = dev->enc_pixels;
+    dev->enc_pixels   = dev->page->pixels;
+    dev->page->pixels = spare;
+
+    strcpy(dev->enc_path, dev->pagepath);
+    strcat(dev->enc_path, dev->page_fn);
+    memcpy(dev->enc_palcol, dev->palcol, sizeof(PALETTE));
+    dev->enc_pending = 1;
+
+    thread_set_event(dev->enc_wake);
 }
 
 static void
@@ -1997,6 +2047,13 @@ escp_init(void *lpt)
     dev->page->pixels = (uint8_t *) malloc((size_t) dev->page->pitch * dev->page->h);
     memset(dev->page->pixels, 0x00, (size_t) dev->page->pitch * dev->page->h);
 
+    /* Spare surface and worker thread for the asynchronous page encode. */
+    dev->enc_pixels = (uint8_t *) malloc((size_t) dev->page->pitch * dev->page->h);
+    dev->enc_wake   = thread_create_event();
+    dev->enc_done   = thread_create_event();
+    thread_set_event(dev->enc_done); /* no job outstanding */
+    dev->enc_thread = thread_create_named(page_encoder_thread, dev, "ESC/P page encoder");
+
     /* Initialize parameters. */
     for (uint8_t i = 0; i < 32; i++) {
         dev->palcol[i].r = 255;
@@ -2049,6 +2106,14 @@ escp_close(void *priv)
         if (dev->page->dirty)
             dump_page(dev);
 
+        /* Let the worker finish the last job before tearing down. */
+        dev->enc_exit = 1;
+        thread_set_event(dev->enc_wake);
+        thread_wait(dev->enc_thread);
+        thread_destroy_event(dev->enc_wake);
+        thread_destroy_event(dev->enc_done);
+        free(dev->enc_pixels);
+
         if (dev->page->pixels != NULL)
             free(dev->page->pixels);
         free(dev->page);
@@ -32,6 +32,7 @@
 #include <86box/path.h>
 #include <86box/plat.h>
 #include <86box/plat_dynld.h>
+#include <86box/thread.h>
 #include <86box/ui.h>
 #include <86box/prt_devs.h>
 
@@ -91,6 +92,18 @@ typedef struct ps_t {
 
     char   buffer[POSTSCRIPT_BUFFER_LENGTH];
     size_t buffer_pos;
+
+    /* Finished documents are converted to PDF on a worker thread, so a
+       long Ghostscript run does not stall the emulation thread while
+       the guest keeps feeding the port. cvt_filename hands the job
+       over; cvt_done throttles back-to-back documents to a single
+       conversion in flight. */
+    thread_t *cvt_thread;
+    event_t  *cvt_wake;
+    event_t  *cvt_done;
+    char      cvt_filename[260];
+    bool      cvt_pending;
+    bool      cvt_exit;
 } ps_t;
 
 typedef struct gsapi_revision_s {
@@ -150,7 +163,7 @@ pulse_timer(void *priv)
 }
 
 static int
-convert_to_pdf(ps_t *dev)
+convert_to_pdf(ps_t *dev, const char *filename)
 {
     volatile int code, arg = 0;
     void        *instance = NULL;
@@ -160,7 +173,7 @@ convert_to_pdf(ps_t *dev)
 
     strcpy(input_fn, dev->printer_path);
     path_slash(input_fn);
-    strcat(input_fn, dev->filename);
+    strcat(input_fn, filename);
 
     strcpy(output_fn, input_fn);
     strcpy(output_fn + strlen(output_fn) - (dev->pcl ? 4 : 3), ".pdf");
@@ -203,6 +216,29 @@ convert_to_pdf(ps_t *dev)
     return code;
 }
 
+static void
+convert_thread(void *priv)
+{
+    ps_t *dev = (ps_t *) priv;
+
+    for (;;) {
+        thread_wait_event(dev->cvt_wake, -1);
+        thread_reset_event(dev->cvt_wake);
+
+        if (dev->cvt_pending) {
+            dev->cvt_pending = false;
+            if (convert_to_pdf(dev, dev->cvt_filename) == 0)
+                pclog("Finished print job %s\n", dev->cvt_filename);
+            thread_set_event(dev->cvt_done);
+        }
+
+        /* The pending job is always picked up before exiting, so the
+           last document of a session is never dropped. */
+        if (dev->cvt_exit)
+            break;
+    }
+}
+
 static void
 write_buffer(ps_t *dev, bool finish)
 {
@@ -236,8 +272,16 @@ write_buffer(ps_t *dev, bool finish)
     dev->buffer_pos = 0;
 
     if (finish) {
-        if (ghostscript_handle != NULL)
-            convert_to_pdf(dev);
+        if (ghostscript_handle != NULL) {
+            /* Hand the finished document off to the conversion thread;
+               waiting here only blocks if the previous document is
+               still being converted. */
+            thread_wait_event(dev->cvt_done, -1);
+            thread_reset_event(dev->cvt_done);
+            strcpy(dev->cvt_filename, dev->filename);
+            dev->cvt_pending = true;
+            thread_set_event(dev->cvt_wake);
+        }
 
         dev->filename[0] = 0;
     }
@@ -408,6 +452,11 @@ ps_init(void *lpt)
 
     reset_ps(dev);
 
+    dev->cvt_wake = thread_create_event();
+    dev->cvt_done = thread_create_event();
+    thread_set_event(dev->cvt_done);
+    dev->cvt_thread = thread_create_named(convert_thread, dev, "printer PDF converter");
+
     return dev;
 }
 
@@ -457,6 +506,11 @@ pcl_init(void *lpt)
 
     reset_ps(dev);
 
+    dev->cvt_wake = thread_create_event();
+    dev->cvt_done = thread_create_event();
+    thread_set_event(dev->cvt_done);
+    dev->cvt_thread = thread_create_named(convert_thread, dev, "printer PDF converter");
+
     return dev;
 }
 
@@ -471,6 +525,14 @@ ps_close(void *priv)
     if (dev->buffer[0] != 0)
         write_buffer(dev, true);
 
+    /* Stop the conversion thread before the Ghostscript handle goes
+       away underneath it. */
+    dev->cvt_exit = true;
+    thread_set_event(dev->cvt_wake);
+    thread_wait(dev->cvt_thread);
+    thread_destroy_event(dev->cvt_wake);
+    thread_destroy_event(dev->cvt_done);
+
     if (ghostscript_handle != NULL) {
         dynld_close(ghostscript_handle);
         ghostscript_handle = NULL;
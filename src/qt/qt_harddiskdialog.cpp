@@ -450,6 +450,14 @@ HarddiskDialog::onCreateNewFile()
     connect(this, &HarddiskDialog::fileProgress, this, [this](int value) { ui->progressBar->setValue(value); QApplication::processEvents(); });
     ui->progressBar->setVisible(true);
     [size, &file, this] {
+        // Let the filesystem provide the zeroes: resizing the file to its
+        // final length allocates lazily on hosts with sparse file support,
+        // making creation instant. Hosts that cannot keep the loop below.
+        if (file.flush() && file.resize(file.pos() + size)) {
+            emit fileProgress(100);
+            return;
+        }
+
         QDataStream stream(&file);
         stream.setByteOrder(QDataStream::LittleEndian);
 
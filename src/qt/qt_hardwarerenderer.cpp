@@ -33,6 +33,14 @@ extern "C" {
 #include <86box/video.h>
 }
 
+#ifndef GL_MAP_PERSISTENT_BIT
+#    define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+
+#ifndef GL_MAP_COHERENT_BIT
+#    define GL_MAP_COHERENT_BIT 0x0080
+#endif
+
 void
 HardwareRenderer::resizeGL(int w, int h)
 {
@@ -130,10 +138,36 @@ HardwareRenderer::initializeGL()
     pclog("OpenGL renderer: %s\n", glGetString(GL_RENDERER));
     pclog("OpenGL version: %s\n", glGetString(GL_VERSION));
     pclog("OpenGL shader language version: %s\n", glGetString(GL_SHADING_LANGUAGE_VERSION));
+
+#ifndef NO_BUFFER_STORAGE
+    /* Persistent-mapped pixel unpack buffer: the blit thread writes frames
+       directly into driver-visible memory and the upload becomes a DMA from
+       the buffer, with no per-frame allocation or client-memory copy. */
+    if (m_context->hasExtension("GL_ARB_buffer_storage") || m_context->hasExtension("GL_EXT_buffer_storage")) {
+        glBufferStorage = (PFNGLBUFFERSTORAGEEXTPROC_LOCAL) m_context->getProcAddress(m_context->hasExtension("GL_EXT_buffer_storage") ? "glBufferStorageEXT" : "glBufferStorage");
+        if (!glBufferStorage)
+            glBufferStorage = (PFNGLBUFFERSTORAGEEXTPROC_LOCAL) m_context->getProcAddress("glBufferStorage");
+    }
+
+    if (glBufferStorage) {
+        glGenBuffers(1, &m_unpackBufferID);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_unpackBufferID);
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, BUFFERBYTES * 2, NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+        m_unpackBuffer = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, BUFFERBYTES * 2, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        if (m_unpackBuffer != nullptr)
+            m_hasBufferStorage = true;
+        else
+            glDeleteBuffers(1, &m_unpackBufferID);
+    }
+#endif
+
     glClearColor(0, 0, 0, 1);
     m_texture->setWrapMode(QOpenGLTexture::ClampToEdge);
     glClear(GL_COLOR_BUFFER_BIT);
     m_context->swapBuffers(this);
+
+    emit initialized();
 }
 
 void
@@ -141,28 +175,39 @@ HardwareRenderer::paintGL()
 {
     m_context->makeCurrent(this);
     glClear(GL_COLOR_BUFFER_BIT);
-    QVector<QVector2D> verts;
-    QVector<QVector2D> texcoords;
-    QMatrix4x4         mat;
-    mat.setToIdentity();
-    mat.ortho(QRectF(0, 0, (qreal) width(), (qreal) height()));
-    verts.push_back(QVector2D((float) destination.x(), (float) destination.y()));
-    verts.push_back(QVector2D((float) destination.x(), (float) destination.y() + (float) destination.height()));
-    verts.push_back(QVector2D((float) destination.x() + (float) destination.width(), (float) destination.y() + (float) destination.height()));
-    verts.push_back(QVector2D((float) destination.x() + (float) destination.width(), (float) destination.y()));
-    texcoords.push_back(QVector2D((float) source.x() / 2048.f, (float) (source.y()) / 2048.f));
-    texcoords.push_back(QVector2D((float) source.x() / 2048.f, (float) (source.y() + source.height()) / 2048.f));
-    texcoords.push_back(QVector2D((float) (source.x() + source.width()) / 2048.f, (float) (source.y() + source.height()) / 2048.f));
-    texcoords.push_back(QVector2D((float) (source.x() + source.width()) / 2048.f, (float) (source.y()) / 2048.f));
 
-    m_vbo[PROGRAM_VERTEX_ATTRIBUTE].bind();
-    m_vbo[PROGRAM_VERTEX_ATTRIBUTE].write(0, verts.data(), sizeof(QVector2D) * 4);
-    m_vbo[PROGRAM_VERTEX_ATTRIBUTE].release();
-    m_vbo[PROGRAM_TEXCOORD_ATTRIBUTE].bind();
-    m_vbo[PROGRAM_TEXCOORD_ATTRIBUTE].write(0, texcoords.data(), sizeof(QVector2D) * 4);
-    m_vbo[PROGRAM_TEXCOORD_ATTRIBUTE].release();
+    /* Only rebuild the geometry and projection when the blit rectangles or
+       the window actually changed - in the common case this repaint is just
+       a texture update over the same quad. */
+    if ((source != m_lastSource) || (destination != m_lastDestination) || (size() != m_lastSize)) {
+        QVector2D  verts[4];
+        QVector2D  texcoords[4];
+        QMatrix4x4 mat;
+
+        mat.setToIdentity();
+        mat.ortho(QRectF(0, 0, (qreal) width(), (qreal) height()));
+        verts[0] = QVector2D((float) destination.x(), (float) destination.y());
+        verts[1] = QVector2D((float) destination.x(), (float) destination.y() + (float) destination.height());
+        verts[2] = QVector2D((float) destination.x() + (float) destination.width(), (float) destination.y() + (float) destination.height());
+        verts[3] = QVector2D((float) destination.x() + (float) destination.width(), (float) destination.y());
+        texcoords[0] = QVector2D((float) source.x() / 2048.f, (float) (source.y()) / 2048.f);
+        texcoords[1] = QVector2D((float) source.x() / 2048.f, (float) (source.y() + source.height()) / 2048.f);
+        texcoords[2] = QVector2D((float) (source.x() + source.width()) / 2048.f, (float) (source.y() + source.height()) / 2048.f);
+        texcoords[3] = QVector2D((float) (source.x() + source.width()) / 2048.f, (float) (source.y()) / 2048.f);
+
+        m_vbo[PROGRAM_VERTEX_ATTRIBUTE].bind();
+        m_vbo[PROGRAM_VERTEX_ATTRIBUTE].write(0, verts, sizeof(QVector2D) * 4);
+        m_vbo[PROGRAM_VERTEX_ATTRIBUTE].release();
+        m_vbo[PROGRAM_TEXCOORD_ATTRIBUTE].bind();
+        m_vbo[PROGRAM_TEXCOORD_ATTRIBUTE].write(0, texcoords, sizeof(QVector2D) * 4);
+        m_vbo[PROGRAM_TEXCOORD_ATTRIBUTE].release();
 
-    m_prog->setUniformValue("MVPMatrix", mat);
+        m_prog->setUniformValue("MVPMatrix", mat);
+
+        m_lastSource      = source;
+        m_lastDestination = destination;
+        m_lastSize        = size();
+    }
     m_prog->enableAttributeArray(PROGRAM_VERTEX_ATTRIBUTE);
     m_prog->enableAttributeArray(PROGRAM_TEXCOORD_ATTRIBUTE);
 
@@ -210,14 +255,29 @@ HardwareRenderer::onBlit(int buf_idx, int x, int y, int w, int h)
         return;
     }
     m_context->makeCurrent(this);
+    if (m_hasBufferStorage) {
+        /* The frame already sits in the mapped buffer; source the upload
+           from there by offset instead of from client memory. */
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_unpackBufferID);
+        m_texture->bind();
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 2048);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, QOpenGLTexture::PixelFormat::RGBA, QOpenGLTexture::PixelType::UInt8, (const void *) ((uintptr_t) BUFFERBYTES * buf_idx + (uintptr_t) (2048 * 4 * y + x * 4)));
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        m_texture->release();
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        /* Coherent mapping: wait for the transfer before the blit thread
+           is allowed to overwrite this buffer. */
+        glFinish();
+    } else {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-    m_texture->setData(x, y, 0, w, h, 0, QOpenGLTexture::PixelFormat::RGBA, QOpenGLTexture::PixelType::UInt8, (const void *) ((uintptr_t) imagebufs[buf_idx].get() + (uintptr_t) (2048 * 4 * y + x * 4)), &m_transferOptions);
+        m_texture->setData(x, y, 0, w, h, 0, QOpenGLTexture::PixelFormat::RGBA, QOpenGLTexture::PixelType::UInt8, (const void *) ((uintptr_t) imagebufs[buf_idx].get() + (uintptr_t) (2048 * 4 * y + x * 4)), &m_transferOptions);
 #else
-    m_texture->bind();
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, 2048);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, QOpenGLTexture::PixelFormat::RGBA, QOpenGLTexture::PixelType::UInt8, (const void *) ((uintptr_t) imagebufs[buf_idx].get() + (uintptr_t) (2048 * 4 * y + x * 4)));
-    m_texture->release();
+        m_texture->bind();
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 2048);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, QOpenGLTexture::PixelFormat::RGBA, QOpenGLTexture::PixelType::UInt8, (const void *) ((uintptr_t) imagebufs[buf_idx].get() + (uintptr_t) (2048 * 4 * y + x * 4)));
+        m_texture->release();
 #endif
+    }
     buf_usage[buf_idx].clear();
     source.setRect(x, y, w, h);
     if (origSource != source)
@@ -247,8 +307,13 @@ HardwareRenderer::getBuffers()
 {
     std::vector<std::tuple<uint8_t *, std::atomic_flag *>> buffers;
 
-    buffers.push_back(std::make_tuple(imagebufs[0].get(), &buf_usage[0]));
-    buffers.push_back(std::make_tuple(imagebufs[1].get(), &buf_usage[1]));
+    if (m_hasBufferStorage) {
+        buffers.push_back(std::make_tuple((uint8_t *) m_unpackBuffer, &buf_usage[0]));
+        buffers.push_back(std::make_tuple((uint8_t *) m_unpackBuffer + BUFFERBYTES, &buf_usage[1]));
+    } else {
+        buffers.push_back(std::make_tuple(imagebufs[0].get(), &buf_usage[0]));
+        buffers.push_back(std::make_tuple(imagebufs[1].get(), &buf_usage[1]));
+    }
 
     return buffers;
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <QOpenGLFunctions>
+#include <QOpenGLExtraFunctions>
 #include <QOpenGLBuffer>
 #include <QOpenGLWindow>
 #include <QOpenGLVertexArrayObject>
@@ -27,10 +27,24 @@
 #    include "wl_mouse.hpp"
 #endif
 
-class HardwareRenderer : public QOpenGLWindow, protected QOpenGLFunctions, public RendererCommon {
+#if defined Q_OS_MACOS || __arm__
+#    ifndef NO_BUFFER_STORAGE
+#        define NO_BUFFER_STORAGE
+#    endif
+#endif
+
+#ifndef GL_PIXEL_UNPACK_BUFFER
+#    define GL_PIXEL_UNPACK_BUFFER 0x88EC
+#endif
+
+typedef void(QOPENGLF_APIENTRYP PFNGLBUFFERSTORAGEEXTPROC_LOCAL)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+
+class HardwareRenderer : public QOpenGLWindow, protected QOpenGLExtraFunctions, public RendererCommon {
     Q_OBJECT
 
 private:
+    static constexpr int BUFFERBYTES = 2048 * 2048 * 4;
+
     bool                        wayland = false;
     QOpenGLContext             *m_context;
     QOpenGLTexture             *m_texture { nullptr };
@@ -39,6 +53,20 @@ private:
     QOpenGLBuffer               m_vbo[2];
     QOpenGLVertexArrayObject    m_vao;
     QOpenGLPixelTransferOptions m_transferOptions;
+    QRect                       m_lastSource;
+    QRect                       m_lastDestination;
+    QSize                       m_lastSize;
+
+    /* Persistent-mapped pixel unpack buffer; the blit thread writes frames
+       straight into the mapped region, so presentation allocates nothing
+       and skips the client-memory copy. Falls back to the malloc'd image
+       buffers when GL_ARB/EXT_buffer_storage is unavailable. */
+    bool   m_hasBufferStorage = false;
+    GLuint m_unpackBufferID   = 0;
+    void  *m_unpackBuffer     = nullptr;
+#ifndef NO_BUFFER_STORAGE
+    PFNGLBUFFERSTORAGEEXTPROC_LOCAL glBufferStorage = nullptr;
+#endif
 
 public:
     enum class RenderType {
@@ -57,7 +85,7 @@ public:
     std::vector<std::tuple<uint8_t *, std::atomic_flag *>> getBuffers() override;
     HardwareRenderer(QWidget *parent = nullptr, RenderType rtype = RenderType::OpenGL)
         : QOpenGLWindow(QOpenGLWindow::NoPartialUpdate, parent->windowHandle())
-        , QOpenGLFunctions()
+        , QOpenGLExtraFunctions()
     {
         imagebufs[0] = std::unique_ptr<uint8_t>(new uint8_t[2048 * 2048 * 4]);
         imagebufs[1] = std::unique_ptr<uint8_t>(new uint8_t[2048 * 2048 * 4]);
@@ -81,6 +109,12 @@ public:
     ~HardwareRenderer()
     {
         m_context->makeCurrent(this);
+        if (m_hasBufferStorage) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_unpackBufferID);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            glDeleteBuffers(1, &m_unpackBufferID);
+        }
         if (m_blt)
             m_blt->destroy();
         m_prog->release();
@@ -92,6 +126,9 @@ public:
 
     void setRenderType(RenderType type);
 
+signals:
+    void initialized();
+
 public slots:
     void onBlit(int buf_idx, int x, int y, int w, int h);
 
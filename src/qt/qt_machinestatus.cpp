@@ -258,7 +258,9 @@ MachineStatus::MachineStatus(QObject *parent)
 {
     d = std::make_unique<MachineStatus::States>(this);
     connect(refreshTimer, &QTimer::timeout, this, &MachineStatus::refreshIcons);
-    refreshTimer->start(75);
+    /* 30 Hz: fast enough for activity to read as a blink, and the poll
+       only repaints icons whose state actually changed. */
+    refreshTimer->start(33);
 }
 
 MachineStatus::~MachineStatus() = default;
@@ -387,31 +389,33 @@ MachineStatus::refreshIcons()
     if (!update_icons)
         return;
 
+    /* Consume the activity latches along with the live state, so any
+       activity pulse since the last poll shows for at least one tick. */
     for (size_t i = 0; i < FDD_NUM; ++i) {
-        d->fdd[i].setActive(machine_status.fdd[i].active);
+        d->fdd[i].setActive(machine_status.fdd[i].active || machine_status.fdd[i].was_active.exchange(false));
         d->fdd[i].setEmpty(machine_status.fdd[i].empty);
     }
     for (size_t i = 0; i < CDROM_NUM; ++i) {
-        d->cdrom[i].setActive(machine_status.cdrom[i].active);
+        d->cdrom[i].setActive(machine_status.cdrom[i].active || machine_status.cdrom[i].was_active.exchange(false));
         d->cdrom[i].setEmpty(machine_status.cdrom[i].empty);
     }
     for (size_t i = 0; i < ZIP_NUM; i++) {
-        d->zip[i].setActive(machine_status.zip[i].active);
+        d->zip[i].setActive(machine_status.zip[i].active || machine_status.zip[i].was_active.exchange(false));
         d->zip[i].setEmpty(machine_status.zip[i].empty);
     }
     for (size_t i = 0; i < MO_NUM; i++) {
-        d->mo[i].setActive(machine_status.mo[i].active);
+        d->mo[i].setActive(machine_status.mo[i].active || machine_status.mo[i].was_active.exchange(false));
         d->mo[i].setEmpty(machine_status.mo[i].empty);
     }
 
     d->cassette.setEmpty(machine_status.cassette.empty);
 
     for (size_t i = 0; i < HDD_BUS_USB; i++) {
-        d->hdds[i].setActive(machine_status.hdd[i].active);
+        d->hdds[i].setActive(machine_status.hdd[i].active || machine_status.hdd[i].was_active.exchange(false));
     }
 
     for (size_t i = 0; i < NET_CARD_MAX; i++) {
-        d->net[i].setActive(machine_status.net[i].active);
+        d->net[i].setActive(machine_status.net[i].active || machine_status.net[i].was_active.exchange(false));
         d->net[i].setEmpty(machine_status.net[i].empty);
     }
 
@@ -435,6 +439,21 @@ MachineStatus::clearActivity()
         hdd.setActive(false);
     for (auto &net : d->net)
         net.setActive(false);
+
+    /* Drop any pending latches as well, so stale activity from before
+       the clear does not blink an icon on the next poll. */
+    for (auto &fdd : machine_status.fdd)
+        fdd.was_active = false;
+    for (auto &cdrom : machine_status.cdrom)
+        cdrom.was_active = false;
+    for (auto &zip : machine_status.zip)
+        zip.was_active = false;
+    for (auto &mo : machine_status.mo)
+        mo.was_active = false;
+    for (auto &hdd : machine_status.hdd)
+        hdd.was_active = false;
+    for (auto &net : machine_status.net)
+        net.was_active = false;
 }
 
 void
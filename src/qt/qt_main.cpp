@@ -83,7 +83,8 @@ extern MainWindow   *main_window;
 extern "C" {
 #include <86box/timer.h>
 #include <86box/nvr.h>
-extern int qt_nvr_save(void);
+#include <86box/bench.h>
+#include <86box/rewind.h>
 }
 
 void qt_set_sequence_auto_mnemonic(bool b);
@@ -99,6 +100,8 @@ main_thread_fn()
     // title_update = 1;
     uint64_t old_time = elapsed_timer.elapsed();
     int drawits = frames = 0;
+    if (bench_enabled)
+        bench_start();
     while (!is_quit && cpu_thread_run) {
         /* See if it is time to run a frame of code. */
         const uint64_t new_time = elapsed_timer.elapsed();
@@ -107,7 +110,7 @@ main_thread_fn()
             drawits = 10;
         else
 #endif
-            drawits += static_cast<int>(new_time - old_time);
+            drawits += pc_governor_elapsed(static_cast<int>(new_time - old_time));
         old_time = new_time;
         if (drawits > 0 && !dopause) {
             /* Yes, so do one frame now. */
@@ -130,11 +133,17 @@ main_thread_fn()
                     break;
             }
 #endif
+            /* End a benchmark run once the emulated deadline has passed. */
+            if (bench_enabled && bench_tick())
+                break;
+
+            /* Take a rewind checkpoint every few seconds. */
+            rewind_tick();
+
             /* Every 200 frames we save the machine status. */
             if (++frames >= 200 && nvr_dosave) {
-                qt_nvr_save();
-                nvr_dosave = 0;
-                frames     = 0;
+                nvr_save_async();
+                frames = 0;
             }
         } else {
             /* Just so we dont overload the host OS. */
@@ -362,7 +371,8 @@ main(int argc, char *argv[])
     onesec.start(1000);
 
 #ifdef DISCORD
-    QTimer discordupdate;
+    /* The presence worker inside discord.c runs the SDK callbacks on
+       its own; nothing to pump from the main loop. */
     if (discord_loaded) {
         QTimer::singleShot(1000, &app, [] {
             if (enable_discord) {
@@ -371,10 +381,6 @@ main(int argc, char *argv[])
             } else
                 discord_close();
         });
-        QObject::connect(&discordupdate, &QTimer::timeout, &app, [] {
-            discord_run_callbacks();
-        });
-        discordupdate.start(1000);
     }
 #endif
 
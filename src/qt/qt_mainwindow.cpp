@@ -46,6 +46,8 @@ extern "C" {
 #include <86box/video.h>
 #include <86box/mouse.h>
 #include <86box/machine.h>
+#include <86box/mem_dump.h>
+#include <86box/perfctr.h>
 #include <86box/vid_ega.h>
 #include <86box/version.h>
 #if 0
@@ -72,6 +74,9 @@ extern int qt_nvr_save(void);
 #include <QKeyEvent>
 #include <QShortcut>
 #include <QMessageBox>
+#include <QDialog>
+#include <QPlainTextEdit>
+#include <QVBoxLayout>
 #include <QFocusEvent>
 #include <QApplication>
 #include <QPushButton>
@@ -269,11 +274,13 @@ MainWindow::MainWindow(QWidget *parent)
 
     connect(qApp, &QGuiApplication::applicationStateChanged, [this](Qt::ApplicationState state) {
         if (state == Qt::ApplicationState::ApplicationActive) {
+            pc_in_background = 0;
             if (auto_paused) {
                 plat_pause(0);
                 auto_paused = 0;
             }
         } else {
+            pc_in_background = 1;
             if (mouse_capture)
                 emit setMouseCapture(false);
 
@@ -621,6 +628,46 @@ MainWindow::MainWindow(QWidget *parent)
         });
     }
 
+    connect(ui->actionPerformance_counters, &QAction::triggered, this, [this] {
+        const auto dialog = new QDialog(this);
+        dialog->setAttribute(Qt::WA_DeleteOnClose);
+        dialog->setWindowTitle(tr("Performance counters"));
+
+        const auto layout = new QVBoxLayout(dialog);
+        const auto text   = new QPlainTextEdit(dialog);
+        text->setReadOnly(true);
+        layout->addWidget(text);
+
+        const auto dumpButton = new QPushButton(tr("Dump to log"), dialog);
+        connect(dumpButton, &QPushButton::clicked, dialog, [] { perf_dump(); });
+        layout->addWidget(dumpButton);
+
+        const auto ramButton = new QPushButton(tr("Dump RAM"), dialog);
+        connect(ramButton, &QPushButton::clicked, dialog, [] {
+            /* Only the arming of the dump needs the machine paused; the
+               pages stream out in the background after resume. */
+            plat_pause(1);
+            mem_dump_start(nullptr);
+            plat_pause(0);
+        });
+        layout->addWidget(ramButton);
+
+        const auto refresh = [text] {
+            QString str;
+            for (int i = 0; i < PERF_MAX; i++)
+                str += QString("%1: %2\n").arg(perf_label(i)).arg(perf_read(i));
+            text->setPlainText(str);
+        };
+        refresh();
+
+        const auto timer = new QTimer(dialog);
+        connect(timer, &QTimer::timeout, text, refresh);
+        timer->start(1000);
+
+        dialog->resize(320, 240);
+        dialog->show();
+    });
+
 #ifdef MTR_ENABLED
     {
         ui->actionBegin_trace->setVisible(true);
@@ -946,10 +993,11 @@ MainWindow::on_actionSettings_triggered()
         default:
             break;
         case QDialog::Accepted:
-            pc_reset_hard_close();
+            /* Diff the dialog's changes against the running state:
+               swap-safe changes are applied without the hard reset. */
+            config_snapshot();
             settings.save();
-            config_changed = 2;
-            pc_reset_hard_init();
+            config_apply();
             break;
         case QDialog::Rejected:
             break;
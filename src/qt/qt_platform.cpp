@@ -41,6 +41,7 @@
 
 #include <QLibrary>
 #include <QElapsedTimer>
+#include <QThread>
 
 #include <QScreen>
 
@@ -52,6 +53,8 @@
 #ifdef Q_OS_UNIX
 #    include <pthread.h>
 #    include <sys/mman.h>
+#    include <fcntl.h>
+#    include <unistd.h>
 #endif
 
 #if 0
@@ -96,6 +99,7 @@ extern "C" {
 #        define NOMINMAX
 #    endif
 #    include <windows.h>
+#    include <io.h>
 #    include <86box/win.h>
 #else
 #    include <strings.h>
@@ -358,6 +362,13 @@ plat_mmap(size_t size, uint8_t executable)
     void *ret = mmap(0, size, PROT_READ | PROT_WRITE | (executable ? PROT_EXEC : 0), MAP_ANON | MAP_PRIVATE | (executable ? MAP_JIT : 0), -1, 0);
 #    else
     void *ret = mmap(0, size, PROT_READ | PROT_WRITE | (executable ? PROT_EXEC : 0), MAP_ANON | MAP_PRIVATE, -1, 0);
+#    endif
+#    ifdef MADV_HUGEPAGE
+    /*Ask for transparent huge pages on large data allocations (guest RAM,
+      VRAM) to cut down host TLB pressure; code caches are left on regular
+      pages, as they are mprotect()ed and flushed piecemeal.*/
+    if ((ret != MAP_FAILED) && !executable && (size >= (2 << 20)))
+        madvise(ret, size, MADV_HUGEPAGE);
 #    endif
     return (ret == MAP_FAILED) ? nullptr : ret;
 #endif
@@ -373,6 +384,92 @@ plat_munmap(void *ptr, size_t size)
 #endif
 }
 
+void *
+plat_mmap_file(FILE *fp, uint64_t size, uint8_t readonly)
+{
+    /* Make sure anything still sitting in the stdio buffer is visible
+       through the mapping. */
+    if (fflush(fp))
+        return nullptr;
+#if defined Q_OS_WINDOWS
+    HANDLE mapping = CreateFileMapping((HANDLE) _get_osfhandle(_fileno(fp)), NULL,
+                                       readonly ? PAGE_READONLY : PAGE_READWRITE,
+                                       (DWORD) (size >> 32), (DWORD) size, NULL);
+    if (mapping == NULL)
+        return nullptr;
+    void *ret = MapViewOfFile(mapping, readonly ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, (SIZE_T) size);
+    /* The view keeps the mapping object alive. */
+    CloseHandle(mapping);
+    return ret;
+#else
+    void *ret = mmap(nullptr, (size_t) size, PROT_READ | (readonly ? 0 : PROT_WRITE), MAP_SHARED, fileno(fp), 0);
+    return (ret == MAP_FAILED) ? nullptr : ret;
+#endif
+}
+
+void
+plat_msync_file(void *ptr, uint64_t size)
+{
+#if defined Q_OS_WINDOWS
+    FlushViewOfFile(ptr, (SIZE_T) size);
+#else
+    msync(ptr, (size_t) size, MS_ASYNC);
+#endif
+}
+
+void
+plat_munmap_file(void *ptr, uint64_t size)
+{
+#if defined Q_OS_WINDOWS
+    (void) size;
+    UnmapViewOfFile(ptr);
+#else
+    munmap(ptr, (size_t) size);
+#endif
+}
+
+int
+plat_fpunch(FILE *fp, uint64_t offset, uint64_t size)
+{
+    /* The range must not linger in the stdio buffer past the punch. */
+    if (fflush(fp))
+        return 0;
+#if defined Q_OS_WINDOWS
+    HANDLE                     h    = (HANDLE) _get_osfhandle(_fileno(fp));
+    FILE_ZERO_DATA_INFORMATION zero = {};
+    DWORD                      ret  = 0;
+    zero.FileOffset.QuadPart      = offset;
+    zero.BeyondFinalZero.QuadPart = offset + size;
+    return DeviceIoControl(h, FSCTL_SET_ZERO_DATA, &zero, sizeof(zero), NULL, 0, &ret, NULL) != 0;
+#elif defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+    return !fallocate(fileno(fp), FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                      (off_t) offset, (off_t) size);
+#else
+    (void) fp;
+    (void) offset;
+    (void) size;
+    return 0;
+#endif
+}
+
+int
+plat_fextend(FILE *fp, uint64_t size)
+{
+    /* Pending stdio output must land before the size changes under it. */
+    if (fflush(fp))
+        return 0;
+#if defined Q_OS_WINDOWS
+    HANDLE h   = (HANDLE) _get_osfhandle(_fileno(fp));
+    DWORD  ret = 0;
+    /* Mark the file sparse first, so that writes into the grown range do
+       not make the filesystem materialize every zero in front of them. */
+    DeviceIoControl(h, FSCTL_SET_SPARSE, NULL, 0, NULL, 0, &ret, NULL);
+    return _chsize_s(_fileno(fp), (int64_t) size) == 0;
+#else
+    return !ftruncate(fileno(fp), (off_t) size);
+#endif
+}
+
 void
 plat_pause(int p)
 {
@@ -762,6 +859,14 @@ plat_get_cpu_string(char *outbuf, uint8_t len) {
 
 }
 
+int
+plat_get_cpu_count(void)
+{
+    int count = QThread::idealThreadCount();
+
+    return (count > 0) ? count : 1;
+}
+
 void
 plat_set_thread_name(void *thread, const char *name)
 {
@@ -315,6 +315,12 @@ RendererStack::createRenderer(Renderer renderer)
                 auto hw        = new HardwareRenderer(this);
                 rendererWindow = hw;
                 connect(this, &RendererStack::blitToRenderer, hw, &HardwareRenderer::onBlit, Qt::QueuedConnection);
+                connect(hw, &HardwareRenderer::initialized, [=]() {
+                    /* Buffers are available only after initialization. */
+                    imagebufs = rendererWindow->getBuffers();
+                    endblit();
+                    emit rendererChanged();
+                });
                 current.reset(this->createWindowContainer(hw, this));
                 break;
             }
@@ -324,6 +330,12 @@ RendererStack::createRenderer(Renderer renderer)
                 auto hw        = new HardwareRenderer(this, HardwareRenderer::RenderType::OpenGLES);
                 rendererWindow = hw;
                 connect(this, &RendererStack::blitToRenderer, hw, &HardwareRenderer::onBlit, Qt::QueuedConnection);
+                connect(hw, &HardwareRenderer::initialized, [=]() {
+                    /* Buffers are available only after initialization. */
+                    imagebufs = rendererWindow->getBuffers();
+                    endblit();
+                    emit rendererChanged();
+                });
                 current.reset(this->createWindowContainer(hw, this));
                 break;
             }
@@ -396,7 +408,7 @@ RendererStack::createRenderer(Renderer renderer)
 
     currentBuf = 0;
 
-    if (renderer != Renderer::OpenGL3 && renderer != Renderer::Vulkan) {
+    if (renderer != Renderer::OpenGL && renderer != Renderer::OpenGLES && renderer != Renderer::OpenGL3 && renderer != Renderer::Vulkan) {
         imagebufs = rendererWindow->getBuffers();
         endblit();
         emit rendererChanged();
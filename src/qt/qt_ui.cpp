@@ -272,21 +272,33 @@ ui_sb_update_icon(int tag, int active)
             break;
         case SB_FLOPPY:
             machine_status.fdd[item].active = active > 0 ? true : false;
+            if (active > 0)
+                machine_status.fdd[item].was_active = true;
             break;
         case SB_CDROM:
             machine_status.cdrom[item].active = active > 0 ? true : false;
+            if (active > 0)
+                machine_status.cdrom[item].was_active = true;
             break;
         case SB_ZIP:
             machine_status.zip[item].active = active > 0 ? true : false;
+            if (active > 0)
+                machine_status.zip[item].was_active = true;
             break;
         case SB_MO:
             machine_status.mo[item].active = active > 0 ? true : false;
+            if (active > 0)
+                machine_status.mo[item].was_active = true;
             break;
         case SB_HDD:
             machine_status.hdd[item].active = active > 0 ? true : false;
+            if (active > 0)
+                machine_status.hdd[item].was_active = true;
             break;
         case SB_NETWORK:
             machine_status.net[item].active = active > 0 ? true : false;
+            if (active > 0)
+                machine_status.net[item].was_active = true;
             break;
         case SB_SOUND:
         case SB_TEXT:
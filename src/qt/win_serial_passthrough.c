@@ -142,6 +142,22 @@ plat_serpt_write(void *priv, uint8_t data)
     }
 }
 
+void
+plat_serpt_write_bulk(void *priv, const uint8_t *data, int len)
+{
+    serial_passthrough_t *dev = (serial_passthrough_t *) priv;
+    DWORD                 bytesWritten = 0;
+
+    switch (dev->mode) {
+        case SERPT_MODE_VCON:
+        case SERPT_MODE_HOSTSER:
+            WriteFile((HANDLE) dev->master_fd, data, len, &bytesWritten, NULL);
+            break;
+        default:
+            break;
+    }
+}
+
 uint8_t
 plat_serpt_read_vcon(serial_passthrough_t *dev, uint8_t *data)
 {
@@ -167,6 +183,23 @@ plat_serpt_read(void *priv, uint8_t *data)
     return res;
 }
 
+int
+plat_serpt_read_bulk(void *priv, uint8_t *data, int max)
+{
+    serial_passthrough_t *dev       = (serial_passthrough_t *) priv;
+    DWORD                 bytesRead = 0;
+
+    switch (dev->mode) {
+        case SERPT_MODE_VCON:
+        case SERPT_MODE_HOSTSER:
+            ReadFile((HANDLE) dev->master_fd, data, max, &bytesRead, NULL);
+            break;
+        default:
+            break;
+    }
+    return (int) bytesRead;
+}
+
 static int
 open_pseudo_terminal(serial_passthrough_t *dev)
 {
@@ -0,0 +1,361 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          The rewind subsystem: a ring of incremental checkpoints
+ *          taken every few seconds while the machine runs. A full copy
+ *          of guest RAM (the base) holds the state at the oldest
+ *          checkpoint; each ring entry holds the pages dirtied since
+ *          the previous one, copied into a preallocated arena, plus
+ *          the CPU/device chunk stream from the savestate subsystem.
+ *          Evicting the oldest entry folds its pages into the base, so
+ *          the steady-state cost on the emulation thread is bounded by
+ *          the guest's dirtying rate: page copies and nothing else.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#define HAVE_STDARG_H
+#include <86box/86box.h>
+#include "cpu.h"
+#include <86box/mem.h>
+#include <86box/plat.h>
+#include <86box/savestate.h>
+#include <86box/rewind.h>
+
+/* One checkpoint every 4 seconds (the tick runs per 10 ms block), up
+   to 16 of them: a bit over a minute of history. */
+#define REWIND_INTERVAL_TICKS 400
+#define REWIND_MAX_POINTS     16
+
+/* Page arena budget; if the guest dirties more than this across the
+   whole ring, old checkpoints are folded away sooner. */
+#define REWIND_ARENA_SLOTS ((64 << 20) / 4096)
+
+typedef struct rewind_point_t {
+    uint64_t  first_slot; /* running slot counter; arena index is mod REWIND_ARENA_SLOTS */
+    uint32_t  num_pages;
+    uint32_t *pages;      /* guest page numbers */
+    uint8_t  *chunks;     /* CPU + device chunk stream */
+    uint32_t  chunks_len;
+} rewind_point_t;
+
+int rewind_enabled = 0;
+
+static rewind_point_t points[REWIND_MAX_POINTS];
+static uint64_t       point_head = 0; /* running counters; ring index is mod REWIND_MAX_POINTS */
+static uint64_t       point_tail = 0;
+static uint8_t       *arena      = NULL;
+static uint64_t       slot_head  = 0;
+static uint64_t       slot_tail  = 0;
+static uint8_t       *base_ram   = NULL; /* guest RAM at the oldest checkpoint */
+static uint64_t       ram_bytes  = 0;
+static int            client     = -1;
+static FILE          *chunk_fp   = NULL; /* scratch file for the chunk stream */
+static int            tick_cnt   = 0;
+
+#ifdef ENABLE_REWIND_LOG
+int rewind_do_log = ENABLE_REWIND_LOG;
+
+static void
+rewind_log(const char *fmt, ...)
+{
+    va_list ap;
+
+    if (rewind_do_log) {
+        va_start(ap, fmt);
+        pclog_ex(fmt, ap);
+        va_end(ap);
+    }
+}
+#else
+#    define rewind_log(fmt, ...)
+#endif
+
+static uint8_t *
+rewind_slot_ptr(uint64_t slot)
+{
+    return &arena[(slot % REWIND_ARENA_SLOTS) << 12];
+}
+
+static uint64_t
+rewind_page_size(uint64_t addr)
+{
+    return ((ram_bytes - addr) < 4096) ? (ram_bytes - addr) : 4096;
+}
+
+void
+rewind_reset(void)
+{
+    while (point_tail < point_head) {
+        rewind_point_t *pt = &points[point_tail % REWIND_MAX_POINTS];
+
+        free(pt->pages);
+        free(pt->chunks);
+        pt->pages  = NULL;
+        pt->chunks = NULL;
+        point_tail++;
+    }
+    point_head = point_tail = 0;
+    slot_head = slot_tail = 0;
+
+    free(arena);
+    arena = NULL;
+    free(base_ram);
+    base_ram = NULL;
+
+    if (client != -1) {
+        mem_dirty_unregister(client);
+        client = -1;
+    }
+    if (chunk_fp != NULL) {
+        fclose(chunk_fp);
+        chunk_fp = NULL;
+    }
+
+    tick_cnt = 0;
+}
+
+/* Capture the CPU/device chunk stream into a fresh buffer, by way of
+   the scratch file. */
+static int
+rewind_capture_chunks(rewind_point_t *pt)
+{
+    long len;
+
+    rewind(chunk_fp);
+    if (!savestate_write_chunks(chunk_fp))
+        return 0;
+    len = ftell(chunk_fp);
+
+    pt->chunks = (uint8_t *) malloc(len);
+    if (pt->chunks == NULL)
+        return 0;
+    rewind(chunk_fp);
+    if (fread(pt->chunks, 1, len, chunk_fp) != (size_t) len) {
+        free(pt->chunks);
+        pt->chunks = NULL;
+        return 0;
+    }
+    pt->chunks_len = len;
+
+    return 1;
+}
+
+/* Fold the oldest checkpoint into the base image and drop it. */
+static void
+rewind_evict_oldest(void)
+{
+    rewind_point_t *pt = &points[point_tail % REWIND_MAX_POINTS];
+
+    for (uint32_t i = 0; i < pt->num_pages; i++) {
+        uint64_t addr = ((uint64_t) pt->pages[i]) << 12;
+
+        memcpy(&base_ram[addr], rewind_slot_ptr(pt->first_slot + i), rewind_page_size(addr));
+    }
+    slot_tail = pt->first_slot + pt->num_pages;
+
+    free(pt->pages);
+    free(pt->chunks);
+    pt->pages  = NULL;
+    pt->chunks = NULL;
+    point_tail++;
+}
+
+/* Arm the ring: full RAM copy as the base, plus a first, empty
+   checkpoint so the starting point itself is a restore target. */
+static int
+rewind_start(void)
+{
+    const uint32_t *dirty_pages;
+    rewind_point_t *pt;
+
+    ram_bytes = ((uint64_t) mem_size) << 10;
+
+    base_ram = (uint8_t *) malloc(ram_bytes);
+    arena    = (uint8_t *) malloc((uint64_t) REWIND_ARENA_SLOTS << 12);
+    chunk_fp = tmpfile();
+    if ((base_ram == NULL) || (arena == NULL) || (chunk_fp == NULL))
+        goto fail;
+
+    client = mem_dirty_register();
+    if (client == -1)
+        goto fail;
+
+    for (uint64_t addr = 0; addr < ram_bytes; addr += 4096)
+        memcpy(&base_ram[addr], savestate_ram_ptr(addr), rewind_page_size(addr));
+    (void) mem_dirty_get(client, &dirty_pages);
+
+    pt = &points[point_head % REWIND_MAX_POINTS];
+    memset(pt, 0x00, sizeof(*pt));
+    if (!rewind_capture_chunks(pt))
+        goto fail;
+    point_head++;
+
+    rewind_log("REWIND: armed, %" PRIu64 " bytes of RAM\n", ram_bytes);
+
+    return 1;
+
+fail:
+    rewind_reset();
+    return 0;
+}
+
+static void
+rewind_checkpoint(void)
+{
+    const uint32_t *dirty_pages;
+    uint32_t        num = mem_dirty_get(client, &dirty_pages);
+    rewind_point_t *pt;
+    uint32_t        kept = 0;
+
+    /* A delta bigger than the whole arena cannot be kept; start over
+       from a fresh base instead. */
+    if (num > REWIND_ARENA_SLOTS) {
+        rewind_reset();
+        return;
+    }
+
+    /* Make room: fold old checkpoints into the base as needed. */
+    while (((point_head - point_tail) >= REWIND_MAX_POINTS) || ((REWIND_ARENA_SLOTS - (slot_head - slot_tail)) < num))
+        rewind_evict_oldest();
+
+    pt = &points[point_head % REWIND_MAX_POINTS];
+    memset(pt, 0x00, sizeof(*pt));
+    pt->first_slot = slot_head;
+    pt->pages      = (uint32_t *) malloc(num ? (num * sizeof(uint32_t)) : sizeof(uint32_t));
+
+    for (uint32_t i = 0; i < num; i++) {
+        uint64_t addr = ((uint64_t) dirty_pages[i]) << 12;
+
+        if (addr >= ram_bytes)
+            continue;
+        memcpy(rewind_slot_ptr(slot_head + kept), savestate_ram_ptr(addr), rewind_page_size(addr));
+        pt->pages[kept++] = dirty_pages[i];
+    }
+    pt->num_pages = kept;
+    slot_head += kept;
+
+    if (!rewind_capture_chunks(pt)) {
+        /* Roll the slots back and drop the whole ring; it is no longer
+           anchored to a consistent machine state. */
+        rewind_reset();
+        return;
+    }
+    point_head++;
+
+    rewind_log("REWIND: checkpoint, %u pages, %u held\n", kept, (uint32_t) (point_head - point_tail));
+}
+
+void
+rewind_tick(void)
+{
+    if (!rewind_enabled) {
+        if (base_ram != NULL)
+            rewind_reset();
+        return;
+    }
+
+    if (++tick_cnt < REWIND_INTERVAL_TICKS)
+        return;
+    tick_cnt = 0;
+
+    if (base_ram == NULL) {
+        (void) rewind_start();
+        return;
+    }
+
+    /* The memory layout changed under us (soft path); re-arm. */
+    if (ram_bytes != (((uint64_t) mem_size) << 10)) {
+        rewind_reset();
+        return;
+    }
+
+    rewind_checkpoint();
+}
+
+int
+rewind_steps_available(void)
+{
+    return (int) (point_head - point_tail);
+}
+
+int
+rewind_back(int steps)
+{
+    const uint32_t *dirty_pages;
+    rewind_point_t *pt;
+    uint64_t        target;
+
+    if ((steps < 1) || (point_head == point_tail))
+        return 0;
+
+    target = point_head - steps;
+    if (target < point_tail)
+        target = point_tail;
+
+    /* Rebuild RAM: the base image, then every delta up to and
+       including the target. */
+    for (uint64_t addr = 0; addr < ram_bytes; addr += 4096)
+        memcpy(savestate_ram_ptr(addr), &base_ram[addr], rewind_page_size(addr));
+    for (uint64_t t = point_tail; t <= target; t++) {
+        pt = &points[t % REWIND_MAX_POINTS];
+        for (uint32_t i = 0; i < pt->num_pages; i++) {
+            uint64_t addr = ((uint64_t) pt->pages[i]) << 12;
+
+            memcpy(savestate_ram_ptr(addr), rewind_slot_ptr(pt->first_slot + i), rewind_page_size(addr));
+        }
+    }
+
+    /* Restore the CPU and the devices from the target's chunk stream. */
+    pt = &points[target % REWIND_MAX_POINTS];
+    rewind(chunk_fp);
+    if (fwrite(pt->chunks, 1, pt->chunks_len, chunk_fp) != pt->chunks_len) {
+        rewind_reset();
+        return 0;
+    }
+    rewind(chunk_fp);
+    if (!savestate_read_chunks(chunk_fp)) {
+        rewind_reset();
+        return 0;
+    }
+
+    /* Discard the checkpoints we rewound past. */
+    while (point_head > (target + 1)) {
+        point_head--;
+        pt = &points[point_head % REWIND_MAX_POINTS];
+        free(pt->pages);
+        free(pt->chunks);
+        pt->pages  = NULL;
+        pt->chunks = NULL;
+    }
+    pt        = &points[target % REWIND_MAX_POINTS];
+    slot_head = pt->first_slot + pt->num_pages;
+
+    /* Anything dirtied after the target is gone from RAM now. */
+    (void) mem_dirty_get(client, &dirty_pages);
+    tick_cnt = 0;
+
+    /* All of RAM changed under the CPU; see savestate_load(). */
+    flushmmucache();
+    mem_invalidate_range(0, (uint32_t) (ram_bytes - 1));
+
+    /* The on-disk incremental baseline no longer matches RAM. */
+    savestate_invalidate();
+
+    rewind_log("REWIND: went back %d step(s)\n", steps);
+
+    return 1;
+}
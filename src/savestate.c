@@ -0,0 +1,495 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          The savestate subsystem: serializes the CPU, the guest RAM
+ *          and any device that implements the save_state/load_state
+ *          callbacks. Guest RAM lives at a fixed offset in the state
+ *          file, so saving repeatedly to the same file only rewrites
+ *          the pages the guest dirtied since the previous save.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#define HAVE_STDARG_H
+#include <86box/86box.h>
+#include "cpu.h"
+#include "x86.h"
+#include <86box/device.h>
+#include <86box/machine.h>
+#include <86box/mem.h>
+#include <86box/timer.h>
+#include <86box/plat.h>
+#include <86box/rewind.h>
+#include <86box/savestate.h>
+#include "crcspeed/crc64speed.h"
+
+#define SAVESTATE_MAGIC   "86SS"
+#define SAVESTATE_VERSION 1
+
+/* Guest RAM starts here in the file; the chunk stream follows it. */
+#define SAVESTATE_RAM_OFFSET 4096
+
+typedef struct savestate_header_t {
+    char     magic[4];
+    uint32_t version;
+    uint64_t ram_offset;
+    uint64_t ram_size;
+    char     machine[40];
+} savestate_header_t;
+
+/* Everything the CPU cores keep outside of cpu_state. */
+typedef struct savestate_cpu_t {
+    uint32_t cpu_state_size; /* build layout guards */
+    uint32_t x86seg_size;
+    uint32_t msr_size;
+
+    uint32_t cr2;
+    uint32_t cr3;
+    uint32_t cr4;
+    uint32_t dr[8];
+    uint32_t tr[8];
+    uint32_t use32;
+    int32_t  stack32;
+    uint32_t cur_status;
+    uint64_t tsc;
+} savestate_cpu_t;
+
+/* Incremental-save state: the file the baseline lives in and our
+   dirty-page tracking client in mem.c. */
+static char baseline_fn[1024] = { 0 };
+static int  dirty_client      = -1;
+
+#ifdef ENABLE_SAVESTATE_LOG
+int savestate_do_log = ENABLE_SAVESTATE_LOG;
+
+static void
+savestate_log(const char *fmt, ...)
+{
+    va_list ap;
+
+    if (savestate_do_log) {
+        va_start(ap, fmt);
+        pclog_ex(fmt, ap);
+        va_end(ap);
+    }
+}
+#else
+#    define savestate_log(fmt, ...)
+#endif
+
+/* A guest physical RAM pointer; the block above 1 GB may live in a
+   separate allocation. */
+uint8_t *
+savestate_ram_ptr(uint64_t addr)
+{
+    if ((addr >= (1 << 30)) && (ram2 != NULL))
+        return &ram2[addr - (1 << 30)];
+
+    return &ram[addr];
+}
+
+void
+savestate_invalidate(void)
+{
+    baseline_fn[0] = '\0';
+
+    if (dirty_client != -1) {
+        mem_dirty_unregister(dirty_client);
+        dirty_client = -1;
+    }
+}
+
+static void
+savestate_write_chunk_cpu(FILE *fp)
+{
+    savestate_cpu_t extra;
+    uint32_t        len = sizeof(cpu_state) + (4 * sizeof(x86seg)) + sizeof(msr_t) + sizeof(extra);
+
+    fwrite("CPU ", 1, 4, fp);
+    fwrite(&len, sizeof(len), 1, fp);
+
+    fwrite(&cpu_state, sizeof(cpu_state), 1, fp);
+    fwrite(&gdt, sizeof(x86seg), 1, fp);
+    fwrite(&ldt, sizeof(x86seg), 1, fp);
+    fwrite(&idt, sizeof(x86seg), 1, fp);
+    fwrite(&tr, sizeof(x86seg), 1, fp);
+    fwrite(&msr, sizeof(msr_t), 1, fp);
+
+    memset(&extra, 0x00, sizeof(extra));
+    extra.cpu_state_size = sizeof(cpu_state);
+    extra.x86seg_size    = sizeof(x86seg);
+    extra.msr_size       = sizeof(msr_t);
+    extra.cr2            = cr2;
+    extra.cr3            = cr3;
+    extra.cr4            = cr4;
+    memcpy(extra.dr, dr, sizeof(extra.dr));
+    memcpy(extra.tr, _tr, sizeof(extra.tr));
+    extra.use32      = use32;
+    extra.stack32    = stack32;
+    extra.cur_status = cpu_cur_status;
+    extra.tsc        = tsc;
+    fwrite(&extra, sizeof(extra), 1, fp);
+}
+
+static int
+savestate_read_chunk_cpu(FILE *fp, uint32_t len)
+{
+    savestate_cpu_t extra;
+
+    if (len != (sizeof(cpu_state) + (4 * sizeof(x86seg)) + sizeof(msr_t) + sizeof(extra)))
+        return 0;
+
+    if (fread(&cpu_state, sizeof(cpu_state), 1, fp) != 1)
+        return 0;
+    if (fread(&gdt, sizeof(x86seg), 1, fp) != 1)
+        return 0;
+    if (fread(&ldt, sizeof(x86seg), 1, fp) != 1)
+        return 0;
+    if (fread(&idt, sizeof(x86seg), 1, fp) != 1)
+        return 0;
+    if (fread(&tr, sizeof(x86seg), 1, fp) != 1)
+        return 0;
+    if (fread(&msr, sizeof(msr_t), 1, fp) != 1)
+        return 0;
+    if (fread(&extra, sizeof(extra), 1, fp) != 1)
+        return 0;
+
+    /* The CPU blob layout depends on the build configuration. */
+    if ((extra.cpu_state_size != sizeof(cpu_state)) || (extra.x86seg_size != sizeof(x86seg)) || (extra.msr_size != sizeof(msr_t)))
+        return 0;
+
+    cr2 = extra.cr2;
+    cr3 = extra.cr3;
+    cr4 = extra.cr4;
+    memcpy(dr, extra.dr, sizeof(extra.dr));
+    memcpy(_tr, extra.tr, sizeof(extra.tr));
+    use32          = extra.use32;
+    stack32        = extra.stack32;
+    cpu_cur_status = extra.cur_status;
+
+    /* The effective-address segment pointer is transient state that
+       only holds between decode and execute; just reset it. */
+    cpu_state.ea_seg = &cpu_state.seg_ds;
+
+    /* Rebase the timer queue onto the restored time stamp counter. */
+    timer_set_new_tsc(extra.tsc);
+
+    return 1;
+}
+
+/* CRC-64 of the file bytes in [start, end), leaving the position at end. */
+static int
+savestate_crc_range(FILE *fp, long start, long end, uint64_t *crc)
+{
+    uint8_t buf[4096];
+
+    *crc = 0;
+    if (fseek(fp, start, SEEK_SET) == -1)
+        return 0;
+    for (long pos = start; pos < end;) {
+        size_t n = ((end - pos) > (long) sizeof(buf)) ? sizeof(buf) : (size_t) (end - pos);
+
+        if (fread(buf, 1, n, fp) != n)
+            return 0;
+        *crc = crc64speed_auto(*crc, buf, n);
+        pos += (long) n;
+    }
+
+    return 1;
+}
+
+/* Write the full chunk stream: CPU, devices, checksum, end marker. */
+int
+savestate_write_chunks(FILE *fp)
+{
+    long     start = ftell(fp);
+    long     end;
+    uint64_t crc;
+    uint32_t len;
+
+    savestate_write_chunk_cpu(fp);
+    if (!device_state_save_all(fp))
+        return 0;
+
+    /* Checksum every chunk byte written above, so that a truncated or
+       corrupted state file fails loudly instead of restoring a subtly
+       wrong machine. */
+    end = ftell(fp);
+    if (!savestate_crc_range(fp, start, end, &crc))
+        return 0;
+    if (fseek(fp, end, SEEK_SET) == -1)
+        return 0;
+    fwrite("CSM ", 1, 4, fp);
+    len = sizeof(crc);
+    fwrite(&len, sizeof(len), 1, fp);
+    fwrite(&crc, sizeof(crc), 1, fp);
+
+    fwrite("END ", 1, 4, fp);
+    len = 0;
+    fwrite(&len, sizeof(len), 1, fp);
+
+    return 1;
+}
+
+/* Scan a chunk stream for the checksum chunk and verify it before anything
+   is restored; streams from older files without one pass trivially. The
+   position is left back at the start of the stream. */
+static int
+savestate_verify_chunks(FILE *fp)
+{
+    long start = ftell(fp);
+    int  ret   = 1;
+
+    while (1) {
+        char     tag[4];
+        uint32_t len;
+        long     next;
+
+        if (fread(tag, 1, 4, fp) != 4)
+            return 0;
+        if (fread(&len, sizeof(len), 1, fp) != 1)
+            return 0;
+        next = ftell(fp) + (long) len;
+
+        if (!memcmp(tag, "END ", 4))
+            break;
+
+        if (!memcmp(tag, "CSM ", 4)) {
+            uint64_t stored;
+            uint64_t crc;
+            long     tag_pos = next - (long) len - 8;
+
+            if ((len != sizeof(stored)) || (fread(&stored, sizeof(stored), 1, fp) != 1))
+                return 0;
+            if (!savestate_crc_range(fp, start, tag_pos, &crc))
+                return 0;
+            if (crc != stored) {
+                savestate_log("Savestate: chunk stream checksum mismatch\n");
+                ret = 0;
+            }
+            break;
+        }
+
+        if (fseek(fp, next, SEEK_SET) == -1)
+            return 0;
+    }
+
+    if (fseek(fp, start, SEEK_SET) == -1)
+        return 0;
+
+    return ret;
+}
+
+/* Walk a chunk stream until the end marker, restoring each chunk. */
+int
+savestate_read_chunks(FILE *fp)
+{
+    if (!savestate_verify_chunks(fp))
+        return 0;
+
+    while (1) {
+        char     tag[4];
+        uint32_t len;
+        long     next;
+
+        if (fread(tag, 1, 4, fp) != 4)
+            return 0;
+        if (fread(&len, sizeof(len), 1, fp) != 1)
+            return 0;
+        next = ftell(fp) + (long) len;
+
+        if (!memcmp(tag, "END ", 4))
+            break;
+
+        if (!memcmp(tag, "CPU ", 4)) {
+            if (!savestate_read_chunk_cpu(fp, len))
+                return 0;
+        } else if (!memcmp(tag, "DEV ", 4)) {
+            if (!device_state_load(fp))
+                return 0;
+        }
+        /* Unknown chunks (including "CSM ") are skipped. */
+
+        if (fseek(fp, next, SEEK_SET) == -1)
+            return 0;
+    }
+
+    return 1;
+}
+
+/* Write the guest RAM region of the state file. On the first save to a
+   file the whole of RAM goes out and a dirty-page tracking client is
+   armed; on subsequent saves to the same file only the dirtied pages
+   are rewritten in place. The low 1.5 MB always goes out in full: the
+   386+ remapping of the A0000-FFFFF area stores data at a different
+   physical address than the page that gets marked dirty. */
+static int
+savestate_write_ram(FILE *fp, const char *fn, uint64_t ram_bytes)
+{
+    uint64_t low_bytes = (ram_bytes < 0x180000ULL) ? ram_bytes : 0x180000ULL;
+
+    if ((dirty_client == -1) || strncmp(baseline_fn, fn, sizeof(baseline_fn))) {
+        /* No baseline in this file yet: full write. */
+        if (fseek(fp, SAVESTATE_RAM_OFFSET, SEEK_SET) == -1)
+            return 0;
+        for (uint64_t addr = 0; addr < ram_bytes; addr += 4096) {
+            uint64_t sz = ((ram_bytes - addr) < 4096) ? (ram_bytes - addr) : 4096;
+
+            if (fwrite(savestate_ram_ptr(addr), 1, sz, fp) != sz)
+                return 0;
+        }
+
+        if (dirty_client == -1)
+            dirty_client = mem_dirty_register();
+        if (dirty_client != -1) {
+            const uint32_t *dirty_pages;
+
+            /* Drop anything collected so far; the file is current. */
+            (void) mem_dirty_get(dirty_client, &dirty_pages);
+        }
+        strncpy(baseline_fn, fn, sizeof(baseline_fn) - 1);
+    } else {
+        const uint32_t *dirty_pages;
+        uint32_t        num = mem_dirty_get(dirty_client, &dirty_pages);
+
+        if (fseek(fp, SAVESTATE_RAM_OFFSET, SEEK_SET) == -1)
+            return 0;
+        for (uint64_t addr = 0; addr < low_bytes; addr += 4096) {
+            uint64_t sz = ((low_bytes - addr) < 4096) ? (low_bytes - addr) : 4096;
+
+            if (fwrite(savestate_ram_ptr(addr), 1, sz, fp) != sz)
+                return 0;
+        }
+
+        for (uint32_t i = 0; i < num; i++) {
+            uint64_t addr = ((uint64_t) dirty_pages[i]) << 12;
+            uint64_t sz;
+
+            if ((addr < low_bytes) || (addr >= ram_bytes))
+                continue;
+            sz = ((ram_bytes - addr) < 4096) ? (ram_bytes - addr) : 4096;
+
+            if (fseek(fp, (long) (SAVESTATE_RAM_OFFSET + addr), SEEK_SET) == -1)
+                return 0;
+            if (fwrite(savestate_ram_ptr(addr), 1, sz, fp) != sz)
+                return 0;
+        }
+
+        savestate_log("SAVESTATE: incremental save, %u dirty pages\n", num);
+    }
+
+    return 1;
+}
+
+int
+savestate_save(const char *fn)
+{
+    savestate_header_t hdr;
+    FILE              *fp;
+    uint64_t           ram_bytes   = ((uint64_t) mem_size) << 10;
+    int                incremental = (dirty_client != -1) && !strncmp(baseline_fn, fn, sizeof(baseline_fn));
+
+    fp = plat_fopen((char *) fn, incremental ? "rb+" : "wb+");
+    if ((fp == NULL) && incremental) {
+        /* The baseline file is gone; fall back to a full save. */
+        savestate_invalidate();
+        incremental = 0;
+        fp          = plat_fopen((char *) fn, "wb+");
+    }
+    if (fp == NULL)
+        return 0;
+
+    memset(&hdr, 0x00, sizeof(hdr));
+    memcpy(hdr.magic, SAVESTATE_MAGIC, 4);
+    hdr.version    = SAVESTATE_VERSION;
+    hdr.ram_offset = SAVESTATE_RAM_OFFSET;
+    hdr.ram_size   = ram_bytes;
+    strncpy(hdr.machine, machine_get_internal_name(), sizeof(hdr.machine) - 1);
+    fwrite(&hdr, sizeof(hdr), 1, fp);
+
+    if (!savestate_write_ram(fp, fn, ram_bytes)) {
+        fclose(fp);
+        savestate_invalidate();
+        return 0;
+    }
+
+    /* The chunk stream is rewritten in full on every save. */
+    if (fseek(fp, (long) (SAVESTATE_RAM_OFFSET + ram_bytes), SEEK_SET) == -1) {
+        fclose(fp);
+        savestate_invalidate();
+        return 0;
+    }
+    if (!savestate_write_chunks(fp)) {
+        fclose(fp);
+        savestate_invalidate();
+        return 0;
+    }
+
+    fclose(fp);
+
+    return 1;
+}
+
+int
+savestate_load(const char *fn)
+{
+    savestate_header_t hdr;
+    FILE              *fp;
+    uint64_t           ram_bytes = ((uint64_t) mem_size) << 10;
+    int                ret       = 0;
+
+    fp = plat_fopen((char *) fn, "rb");
+    if (fp == NULL)
+        return 0;
+
+    if (fread(&hdr, sizeof(hdr), 1, fp) != 1)
+        goto done;
+    if (memcmp(hdr.magic, SAVESTATE_MAGIC, 4) || (hdr.version != SAVESTATE_VERSION))
+        goto done;
+    hdr.machine[sizeof(hdr.machine) - 1] = '\0';
+    if (strcmp(hdr.machine, machine_get_internal_name()))
+        goto done;
+    if (hdr.ram_size != ram_bytes)
+        goto done;
+
+    if (fseek(fp, (long) hdr.ram_offset, SEEK_SET) == -1)
+        goto done;
+    for (uint64_t addr = 0; addr < ram_bytes; addr += 4096) {
+        uint64_t sz = ((ram_bytes - addr) < 4096) ? (ram_bytes - addr) : 4096;
+
+        if (fread(savestate_ram_ptr(addr), 1, sz, fp) != sz)
+            goto done;
+    }
+
+    if (!savestate_read_chunks(fp))
+        goto done;
+
+    /* All of RAM changed under the CPU: drop the translation lookups
+       and any generated code, and restart the prefetch queue. */
+    flushmmucache();
+    mem_invalidate_range(0, (uint32_t) (ram_bytes - 1));
+
+    /* This file is no longer a valid incremental baseline, and neither
+       are any rewind checkpoints taken before it was loaded. */
+    savestate_invalidate();
+    rewind_reset();
+
+    ret = 1;
+
+done:
+    fclose(fp);
+
+    return ret;
+}
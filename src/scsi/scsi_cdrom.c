@@ -1360,6 +1360,22 @@ scsi_cdrom_read_data(scsi_cdrom_t *dev, int msf, int type, int flags, int32_t *l
     dev->old_len = 0;
     *len         = 0;
 
+    /* Plain READ (6)/(10)/(12): every block is 2048 bytes of user data, so
+       pull the whole run into the command buffer in one batch instead of
+       staging each sector through the raw sector machinery. */
+    if (!msf && (type == 8) && (flags == 0x10) && (vendor_type == 0) && (dev->requested_blocks > 1)) {
+        ret = cdrom_readsector_cooked_batch(dev->drv, dev->buffer, dev->sector_pos, dev->requested_blocks);
+
+        if (!ret) {
+            scsi_cdrom_illegal_mode(dev);
+            return 0;
+        }
+
+        dev->old_len = dev->requested_blocks * 2048;
+        *len         = dev->old_len;
+        return 1;
+    }
+
     for (int i = 0; i < dev->requested_blocks; i++) {
         ret = cdrom_readsector_raw(dev->drv, dev->buffer + data_pos,
                                    dev->sector_pos + i, msf, type, flags, &temp_len, vendor_type);
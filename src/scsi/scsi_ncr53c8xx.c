@@ -1035,7 +1035,9 @@ ncr53c8xx_process_script(ncr53c8xx_t *dev)
     dev->sstop = 0;
 again:
     insn_processed++;
-    insn = read_dword(dev, dev->dsp);
+    /* Fetch both DWORDs of the instruction in one access. */
+    dma_bm_read(dev->dsp, (uint8_t *) buf, 8, 4);
+    insn = buf[0];
     if (!insn) {
         /* If we receive an empty opcode increment the DSP by 4 bytes
            instead of 8 and execute the next opcode at that location */
@@ -1047,7 +1049,7 @@ again:
             return;
         }
     }
-    addr = read_dword(dev, dev->dsp + 4);
+    addr = buf[1];
     ncr53c8xx_log("SCRIPTS dsp=%08x opcode %08x arg %08x\n", dev->dsp, insn, addr);
     dev->dsps = addr;
     dev->dcmd = insn >> 24;
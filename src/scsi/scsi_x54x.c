@@ -1210,8 +1210,26 @@ x54x_do_mail(x54x_t *dev)
     }
 
     if (aggressive) {
-        /* Search for a filled mailbox - stop if we have scanned all mailboxes. */
-        for (dev->MailboxOutPosCur = 0; dev->MailboxOutPosCur < dev->MailboxCount; dev->MailboxOutPosCur++) {
+        /* Snapshot the whole ring with one guest-memory read, then process
+           the first armed mailbox - instead of one read per scanned slot. */
+        uint8_t        ring[256 * sizeof(Mailbox32_t)];
+        const uint32_t mbsize = (dev->flags & X54X_MBX_24BIT) ? sizeof(Mailbox_t) : sizeof(Mailbox32_t);
+        const uint32_t code_offset = (dev->flags & X54X_MBX_24BIT) ? 0 : 7;
+        uint32_t       count = dev->MailboxCount;
+        uint8_t        code;
+
+        if (count > 256)
+            count = 256;
+        dma_bm_read(dev->MailboxOutAddr, ring, count * mbsize, dev->transfer_size);
+
+        for (dev->MailboxOutPosCur = 0; dev->MailboxOutPosCur < count; dev->MailboxOutPosCur++) {
+            code = ring[(dev->MailboxOutPosCur * mbsize) + code_offset];
+            if ((code != MBO_START) && (code != MBO_ABORT)) {
+                /* Keep charging the scan to the emulated transfer period. */
+                x54x_add_to_period(dev, mbsize);
+                continue;
+            }
+            /* x54x_mbo() re-reads the armed slot and accounts for it. */
             if (x54x_mbo_process(dev))
                 break;
         }
@@ -1293,7 +1311,16 @@ x54x_cmd_callback(void *priv)
     }
 
     period = (1000000.0 / dev->ha_bps) * ((double) dev->temp_period);
-    timer_on_auto(&dev->timer, dev->media_period + period + 10.0);
+
+    /* Back off the poll interval while the controller sits idle; it snaps
+       back to the base rate as soon as a mailbox is armed. */
+    if ((dev->callback_sub_phase == 0) && !mailboxes_present && !bios_mailboxes_present) {
+        if (dev->idle_period < 250.0)
+            dev->idle_period += 10.0;
+    } else
+        dev->idle_period = 10.0;
+
+    timer_on_auto(&dev->timer, dev->media_period + period + dev->idle_period);
 #if 0
     x54x_log("Temporary period: %lf us (%" PRIi64 " periods)\n", dev->timer.period, dev->temp_period);
 #endif
@@ -1509,6 +1536,12 @@ x54x_out(uint16_t port, uint8_t val, void *priv)
             /* Fast path for the mailbox execution command. */
             if ((val == CMD_START_SCSI) && (dev->Command == 0xff)) {
                 dev->MailboxReq++;
+                /* Cancel any idle back-off; the poller only backs off with
+                   sub-phase 0 pending, so re-arming it here is safe. */
+                if (dev->idle_period > 10.0) {
+                    dev->idle_period = 10.0;
+                    timer_on_auto(&dev->timer, 10.0);
+                }
                 x54x_log("Start SCSI command\n");
                 return;
             }
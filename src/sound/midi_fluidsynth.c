@@ -48,6 +48,14 @@ typedef struct fluidsynth {
 
 fluidsynth_t fsdev;
 
+/* Parsing a large soundfont dominates device init time, so the synth (and with
+ * it the parsed soundfont) is kept alive across machine restarts and reused as
+ * long as the configured soundfont path does not change. */
+static fluid_settings_t *cached_settings   = NULL;
+static fluid_synth_t    *cached_synth      = NULL;
+static int               cached_sound_font = -1;
+static char              cached_font_path[512];
+
 int
 fluidsynth_available(void)
 {
@@ -158,20 +166,43 @@ fluidsynth_init(UNUSED(const device_t *info))
 
     memset(data, 0, sizeof(fluidsynth_t));
 
-    data->settings = new_fluid_settings();
-
-    fluid_settings_setnum(data->settings, "synth.sample-rate", 44100);
-    fluid_settings_setnum(data->settings, "synth.gain", device_get_config_int("output_gain") / 100.0f);
-
-    data->synth = new_fluid_synth(data->settings);
-
     const char *sound_font = device_get_config_string("sound_font");
 #ifdef __unix__
     if (!sound_font || sound_font[0] == 0)
         sound_font = (access("/usr/share/sounds/sf2/FluidR3_GM.sf2", F_OK) == 0 ? "/usr/share/sounds/sf2/FluidR3_GM.sf2" :
                       (access("/usr/share/soundfonts/default.sf2", F_OK) == 0 ? "/usr/share/soundfonts/default.sf2" : ""));
 #endif
-    data->sound_font = fluid_synth_sfload(data->synth, sound_font, 1);
+    if (!sound_font)
+        sound_font = "";
+
+    if (cached_synth && !strcmp(cached_font_path, sound_font)) {
+        data->settings   = cached_settings;
+        data->synth      = cached_synth;
+        data->sound_font = cached_sound_font;
+
+        fluid_synth_system_reset(data->synth);
+        fluid_synth_set_gain(data->synth, device_get_config_int("output_gain") / 100.0f);
+    } else {
+        if (cached_synth) {
+            delete_fluid_synth(cached_synth);
+            delete_fluid_settings(cached_settings);
+        }
+
+        data->settings = new_fluid_settings();
+
+        fluid_settings_setnum(data->settings, "synth.sample-rate", 44100);
+        fluid_settings_setnum(data->settings, "synth.gain", device_get_config_int("output_gain") / 100.0f);
+
+        data->synth = new_fluid_synth(data->settings);
+
+        data->sound_font = fluid_synth_sfload(data->synth, sound_font, 1);
+
+        cached_settings   = data->settings;
+        cached_synth      = data->synth;
+        cached_sound_font = data->sound_font;
+        strncpy(cached_font_path, sound_font, sizeof(cached_font_path) - 1);
+        cached_font_path[sizeof(cached_font_path) - 1] = 0;
+    }
 
     if (device_get_config_int("chorus")) {
 #ifndef USE_OLD_FLUIDSYNTH_API
@@ -297,15 +328,14 @@ fluidsynth_close(void *priv)
     thread_set_event(data->event);
     thread_wait(data->thread_h);
 
+    /* The synth and its settings stay cached for the next init; just silence
+     * any voices still sounding so nothing hangs over into the next machine. */
     if (data->synth) {
-        delete_fluid_synth(data->synth);
+        fluid_synth_system_reset(data->synth);
         data->synth = NULL;
     }
 
-    if (data->settings) {
-        delete_fluid_settings(data->settings);
-        data->settings = NULL;
-    }
+    data->settings = NULL;
 
     if (data->buffer) {
         free(data->buffer);
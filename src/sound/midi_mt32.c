@@ -1,3 +1,5 @@
+#include <stdarg.h>
+#include <stdatomic.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -27,6 +29,24 @@
 extern void givealbuffer_midi(void *buf, uint32_t size);
 extern void al_set_midi(int freq, int buf_size);
 
+#ifdef ENABLE_MT32_LOG
+int mt32_do_log = ENABLE_MT32_LOG;
+
+static void
+mt32_log(const char *fmt, ...)
+{
+    va_list ap;
+
+    if (mt32_do_log) {
+        va_start(ap, fmt);
+        pclog_ex(fmt, ap);
+        va_end(ap);
+    }
+}
+#else
+#    define mt32_log(fmt, ...)
+#endif
+
 static mt32emu_report_handler_version get_mt32_report_handler_version(mt32emu_report_handler_i i);
 static void                           display_mt32_message(void *instance_data, const char *message);
 
@@ -164,6 +184,21 @@ static float   *buffer       = NULL;
 static int16_t *buffer_int16 = NULL;
 static int      midi_pos     = 0;
 
+/* Render ticks issued by mt32_poll() but not yet consumed by the synthesis thread.
+ * The wakeup event alone is not enough: if a tick fires while the thread is still
+ * rendering the previous segment, the already-set event would silently merge the
+ * two ticks and the output stream would fall one segment behind for good. */
+static atomic_int  render_ticks = 0;
+/* Synth sample clock (native 32 kHz frames), republished by the synthesis thread
+ * after each segment so the MIDI path can timestamp messages against it. */
+static atomic_uint render_clock = 0;
+/* Number of times the synthesis thread was late for a render tick. */
+static atomic_uint render_late  = 0;
+
+/* MIDI messages are scheduled this far (in native frames) past the last rendered
+ * sample, so their relative spacing survives the segment-sized render quantum. */
+#define MIDI_LATENCY_FRAMES (32000 / RENDER_RATE)
+
 static mt32emu_report_handler_version
 get_mt32_report_handler_version(UNUSED(mt32emu_report_handler_i i))
 {
@@ -204,6 +239,10 @@ mt32_poll(void)
     midi_pos++;
     if (midi_pos == SOUND_FREQ / RENDER_RATE) {
         midi_pos = 0;
+        if (atomic_fetch_add(&render_ticks, 1) > 0) {
+            atomic_fetch_add(&render_late, 1);
+            mt32_log("MT-32: synthesis thread late for %u render ticks\n", atomic_load(&render_late));
+        }
         thread_set_event(event);
     }
 }
@@ -222,40 +261,57 @@ mt32_thread(UNUSED(void *param))
         thread_wait_event(event, -1);
         thread_reset_event(event);
 
-        if (sound_is_float) {
-            buf = (float *) ((uint8_t *) buffer + buf_pos);
-            memset(buf, 0, bsize);
-            mt32_stream(buf, bsize / (2 * sizeof(float)));
-            buf_pos += bsize;
-            if (buf_pos >= buf_size) {
-                givealbuffer_midi(buffer, buf_size / sizeof(float));
-                buf_pos = 0;
-            }
-        } else {
-            buf16 = (int16_t *) ((uint8_t *) buffer_int16 + buf_pos);
-            memset(buf16, 0, bsize);
-            mt32_stream_int16(buf16, bsize / (2 * sizeof(int16_t)));
-            buf_pos += bsize;
-            if (buf_pos >= buf_size) {
-                givealbuffer_midi(buffer_int16, buf_size / sizeof(int16_t));
-                buf_pos = 0;
+        /* Render one segment per outstanding tick so the thread catches up
+         * after being late instead of leaving the stream a segment short. */
+        while (mt32_on && (atomic_load(&render_ticks) > 0)) {
+            if (sound_is_float) {
+                buf = (float *) ((uint8_t *) buffer + buf_pos);
+                memset(buf, 0, bsize);
+                mt32_stream(buf, bsize / (2 * sizeof(float)));
+                buf_pos += bsize;
+                if (buf_pos >= buf_size) {
+                    givealbuffer_midi(buffer, buf_size / sizeof(float));
+                    buf_pos = 0;
+                }
+            } else {
+                buf16 = (int16_t *) ((uint8_t *) buffer_int16 + buf_pos);
+                memset(buf16, 0, bsize);
+                mt32_stream_int16(buf16, bsize / (2 * sizeof(int16_t)));
+                buf_pos += bsize;
+                if (buf_pos >= buf_size) {
+                    givealbuffer_midi(buffer_int16, buf_size / sizeof(int16_t));
+                    buf_pos = 0;
+                }
             }
+
+            atomic_store(&render_clock, mt32emu_get_internal_rendered_sample_count(context));
+            atomic_fetch_sub(&render_ticks, 1);
         }
     }
 }
 
+/* Schedule a message one segment past the point the synthesis thread has rendered
+ * to. Untimestamped messages would be applied wherever the render happens to stand,
+ * quantizing them to segment boundaries (and bunching them up while the thread is
+ * catching up after a late tick). */
+static mt32emu_bit32u
+mt32_timestamp(void)
+{
+    return atomic_load(&render_clock) + MIDI_LATENCY_FRAMES;
+}
+
 void
 mt32_msg(uint8_t *val)
 {
     if (context)
-        mt32_check("mt32emu_play_msg", mt32emu_play_msg(context, *(uint32_t *) val), MT32EMU_RC_OK);
+        mt32_check("mt32emu_play_msg_at", mt32emu_play_msg_at(context, *(uint32_t *) val, mt32_timestamp()), MT32EMU_RC_OK);
 }
 
 void
 mt32_sysex(uint8_t *data, unsigned int len)
 {
     if (context)
-        mt32_check("mt32emu_play_sysex", mt32emu_play_sysex(context, data, len), MT32EMU_RC_OK);
+        mt32_check("mt32emu_play_sysex_at", mt32emu_play_sysex_at(context, data, len, mt32_timestamp()), MT32EMU_RC_OK);
 }
 
 void *
@@ -309,6 +365,10 @@ mt32emu_init(char *control_rom, char *pcm_rom)
 
     mt32_on = 1;
 
+    atomic_store(&render_ticks, 0);
+    atomic_store(&render_clock, 0);
+    atomic_store(&render_late, 0);
+
     start_event = thread_create_event();
 
     event    = thread_create_event();
@@ -354,6 +414,9 @@ mt32_close(void *priv)
     thread_set_event(event);
     thread_wait(thread_h);
 
+    if (atomic_load(&render_late))
+        mt32_log("MT-32: synthesis thread was late for %u render ticks total\n", atomic_load(&render_late));
+
     event       = NULL;
     start_event = NULL;
     thread_h    = NULL;
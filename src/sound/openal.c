@@ -17,6 +17,7 @@
  *           Copyright 2016-2019 Miran Grca.
  */
 #include <math.h>
+#include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -30,6 +31,7 @@
 #include "AL/alc.h"
 #include "AL/alext.h"
 #include <86box/86box.h>
+#include <86box/bench.h>
 #include <86box/midi.h>
 #include <86box/sound.h>
 #include <86box/plat_unused.h>
@@ -37,6 +39,24 @@
 #define FREQ   SOUND_FREQ
 #define BUFLEN SOUNDBUFLEN
 
+#ifdef ENABLE_OPENAL_LOG
+int openal_do_log = ENABLE_OPENAL_LOG;
+
+static void
+openal_log(const char *fmt, ...)
+{
+    va_list ap;
+
+    if (openal_do_log) {
+        va_start(ap, fmt);
+        pclog_ex(fmt, ap);
+        va_end(ap);
+    }
+}
+#else
+#    define openal_log(fmt, ...)
+#endif
+
 ALuint        buffers[4];       /* front and back buffers */
 ALuint        buffers_music[4]; /* front and back buffers */
 ALuint        buffers_wt[4];    /* front and back buffers */
@@ -90,12 +110,36 @@ alutExit(ALvoid)
     }
 }
 
+/* Per-source backpressure state: one held-over block for when the producer gets
+ * ahead of the source, plus dropped-block and underrun-restart counters. Each
+ * source has a single producer thread, so no locking is needed here. */
+static void    *held_buf[5];
+static int      held_size[5];
+static int      held_alloc[5];
+static uint32_t blocks_dropped[5];
+static uint32_t underruns[5];
+
+/* Drift tracking: smoothed queue depth per source and the pitch trim currently
+ * applied to it (in fractional rate, so 0.0005 = 500 ppm). */
+#define FILL_TARGET 2.5f
+static float fill_level[5];
+static float pitch_trim[5];
+
 void
 closeal(void)
 {
     if (!initialized)
         return;
 
+    for (uint8_t c = 0; c < 5; c++) {
+        free(held_buf[c]);
+        held_buf[c]   = NULL;
+        held_size[c]  = 0;
+        held_alloc[c] = 0;
+        fill_level[c] = FILL_TARGET;
+        pitch_trim[c] = 0.0f;
+    }
+
     alSourceStopv(sources, source);
     alDeleteSources(sources, source);
 
@@ -241,6 +285,11 @@ inital(void)
     if (init_midi)
         alSourcePlay(source[4]);
 
+    for (uint8_t c = 0; c < 5; c++) {
+        fill_level[c] = FILL_TARGET;
+        pitch_trim[c] = 0.0f;
+    }
+
     if (sound_is_float) {
         if (init_midi)
             free(midi_buf);
@@ -260,12 +309,26 @@ inital(void)
     initialized = 1;
 }
 
+static void
+al_queue_buffer(const void *buf, const uint8_t src, const int size, const int freq)
+{
+    ALuint buffer;
+
+    alSourceUnqueueBuffers(source[src], 1, &buffer);
+
+    if (sound_is_float)
+        alBufferData(buffer, AL_FORMAT_STEREO_FLOAT32, buf, size * (int) sizeof(float), freq);
+    else
+        alBufferData(buffer, AL_FORMAT_STEREO16, buf, size * (int) sizeof(int16_t), freq);
+
+    alSourceQueueBuffers(source[src], 1, &buffer);
+}
+
 void
 givealbuffer_common(const void *buf, const uint8_t src, const int size, const int freq)
 {
-    int    processed;
-    int    state;
-    ALuint buffer;
+    int processed;
+    int state;
 
     if (!initialized)
         return;
@@ -273,22 +336,69 @@ givealbuffer_common(const void *buf, const uint8_t src, const int size, const in
     alGetSourcei(source[src], AL_SOURCE_STATE, &state);
 
     if (state == 0x1014) {
+        underruns[src]++;
+        bench_audio_underruns++;
+        openal_log("OpenAL: source %d underran (%u underruns, %u dropped blocks)\n",
+                   src, underruns[src], blocks_dropped[src]);
         alSourcePlay(source[src]);
     }
 
     alGetSourcei(source[src], AL_BUFFERS_PROCESSED, &processed);
+
+    /* The host audio clock and the nominal stream rate never match exactly, so
+     * the queue depth slowly walks toward an underrun or a dropped block, and
+     * the correction is an audible hitch. Track the smoothed depth and trim
+     * the source pitch gradually (bounded at +/-500 ppm) toward the midpoint,
+     * so the rate difference is absorbed continuously and inaudibly. */
+    const float depth = (float) (4 - processed) + (held_size[src] ? 1.0f : 0.0f);
+    fill_level[src] += 0.05f * (depth - fill_level[src]);
+    float trim = (fill_level[src] - FILL_TARGET) * 0.0002f;
+    if (trim < -0.0005f)
+        trim = -0.0005f;
+    else if (trim > 0.0005f)
+        trim = 0.0005f;
+    if (fabsf(trim - pitch_trim[src]) >= 0.000005f) {
+        pitch_trim[src] = trim;
+        alSourcef(source[src], AL_PITCH, 1.0f + trim);
+        openal_log("OpenAL: source %d fill %.2f, pitch trim %+.0f ppm\n",
+                   src, (double) fill_level[src], (double) trim * 1000000.0);
+    }
+
     if (processed >= 1) {
         const double gain = pow(10.0, (double) sound_gain / 20.0);
         alListenerf(AL_GAIN, (float) gain);
 
-        alSourceUnqueueBuffers(source[src], 1, &buffer);
+        /* Flush a block held over from when the source had nothing free. */
+        if (held_size[src]) {
+            al_queue_buffer(held_buf[src], src, held_size[src], freq);
+            held_size[src] = 0;
+            processed--;
+        }
+    }
 
-        if (sound_is_float)
-            alBufferData(buffer, AL_FORMAT_STEREO_FLOAT32, buf, size * (int) sizeof(float), freq);
-        else
-            alBufferData(buffer, AL_FORMAT_STEREO16, buf, size * (int) sizeof(int16_t), freq);
+    if (processed >= 1) {
+        al_queue_buffer(buf, src, size, freq);
+        return;
+    }
 
-        alSourceQueueBuffers(source[src], 1, &buffer);
+    /* No free buffer: hold the block and retry on the next call rather than
+     * dropping it on the floor. Only when a second block arrives while one is
+     * still held does the older one get dropped. */
+    if (held_size[src]) {
+        blocks_dropped[src]++;
+        openal_log("OpenAL: source %d dropped a block (%u underruns, %u dropped blocks)\n",
+                   src, underruns[src], blocks_dropped[src]);
+    }
+
+    const int bytes = size * (int) (sound_is_float ? sizeof(float) : sizeof(int16_t));
+    if (bytes > held_alloc[src]) {
+        free(held_buf[src]);
+        held_buf[src]   = malloc(bytes);
+        held_alloc[src] = held_buf[src] ? bytes : 0;
+    }
+    if (held_buf[src]) {
+        memcpy(held_buf[src], buf, bytes);
+        held_size[src] = size;
     }
 }
 
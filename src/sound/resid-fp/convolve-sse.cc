@@ -23,6 +23,7 @@
 
 #include <xmmintrin.h>
 
+RESID_SSE_ATTR
 float convolve_sse(const float *a, const float *b, int n)
 {
     float out = 0.f;
@@ -74,10 +74,19 @@ const char* resid_version_string = VERSION;
 // Inlining on/off.
 #define RESID_INLINE inline
 
+// The SSE convolution kernel is compiled in either when the whole build
+// already targets SSE, or (gcc/clang on plain i386) by building just the
+// kernel with the target attribute. Whether it actually runs is decided at
+// runtime from the host CPU features.
 #if defined(__SSE__) || (defined(_M_IX86_FP ) && _M_IX86_FP >= 1) || defined(_M_X64)
 #define RESID_USE_SSE 1
+#define RESID_SSE_ATTR
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__i386__)
+#define RESID_USE_SSE 1
+#define RESID_SSE_ATTR __attribute__((target("sse")))
 #else
 #define RESID_USE_SSE 0
+#define RESID_SSE_ATTR
 #endif
 
 #define HAVE_LOGF
@@ -1886,8 +1886,22 @@ es1371_fetch(es1371_t *dev, int dac_nr)
     int pos    = dev->dac[dac_nr].buffer_pos & 63;
     int c;
 
+    /* Whole fetch runs are bulk-copied through a direct host pointer when the
+       run stays below the buffer wrap and inside one directly mapped block;
+       otherwise the per-sample accessors below handle wraps and MMIO pages. */
+    const uint8_t *p;
+
     switch (format) {
         case FORMAT_MONO_8:
+            if (((dev->dac[dac_nr].count + 8) <= dev->dac[dac_nr].size)
+                && ((p = mem_read_phys_ptr(dev->dac[dac_nr].addr, 32)) != NULL)) {
+                for (c = 0; c < 32; c++)
+                    dev->dac[dac_nr].buffer_l[(pos + c) & 63] = dev->dac[dac_nr].buffer_r[(pos + c) & 63] = (p[c] ^ 0x80) << 8;
+                dev->dac[dac_nr].addr += 32;
+                dev->dac[dac_nr].buffer_pos_end += 32;
+                dev->dac[dac_nr].count += 8;
+                break;
+            }
             for (c = 0; c < 32; c += 4) {
                 dev->dac[dac_nr].buffer_l[(pos + c) & 63] = dev->dac[dac_nr].buffer_r[(pos + c) & 63] = (mem_readb_phys(dev->dac[dac_nr].addr) ^ 0x80) << 8;
                 dev->dac[dac_nr].buffer_l[(pos + c + 1) & 63] = dev->dac[dac_nr].buffer_r[(pos + c + 1) & 63] = (mem_readb_phys(dev->dac[dac_nr].addr + 1) ^ 0x80) << 8;
@@ -1907,6 +1921,17 @@ es1371_fetch(es1371_t *dev, int dac_nr)
             break;
 
         case FORMAT_STEREO_8:
+            if (((dev->dac[dac_nr].count + 8) <= dev->dac[dac_nr].size)
+                && ((p = mem_read_phys_ptr(dev->dac[dac_nr].addr, 32)) != NULL)) {
+                for (c = 0; c < 16; c++) {
+                    dev->dac[dac_nr].buffer_l[(pos + c) & 63] = (p[(c * 2)] ^ 0x80) << 8;
+                    dev->dac[dac_nr].buffer_r[(pos + c) & 63] = (p[(c * 2) + 1] ^ 0x80) << 8;
+                }
+                dev->dac[dac_nr].addr += 32;
+                dev->dac[dac_nr].buffer_pos_end += 16;
+                dev->dac[dac_nr].count += 8;
+                break;
+            }
             for (c = 0; c < 16; c += 2) {
                 dev->dac[dac_nr].buffer_l[(pos + c) & 63]     = (mem_readb_phys(dev->dac[dac_nr].addr) ^ 0x80) << 8;
                 dev->dac[dac_nr].buffer_r[(pos + c) & 63]     = (mem_readb_phys(dev->dac[dac_nr].addr + 1) ^ 0x80) << 8;
@@ -1926,6 +1951,15 @@ es1371_fetch(es1371_t *dev, int dac_nr)
             break;
 
         case FORMAT_MONO_16:
+            if (((dev->dac[dac_nr].count + 8) <= dev->dac[dac_nr].size)
+                && ((p = mem_read_phys_ptr(dev->dac[dac_nr].addr, 32)) != NULL)) {
+                for (c = 0; c < 16; c++)
+                    dev->dac[dac_nr].buffer_l[(pos + c) & 63] = dev->dac[dac_nr].buffer_r[(pos + c) & 63] = *(const uint16_t *) &p[c * 2];
+                dev->dac[dac_nr].addr += 32;
+                dev->dac[dac_nr].buffer_pos_end += 16;
+                dev->dac[dac_nr].count += 8;
+                break;
+            }
             for (c = 0; c < 16; c += 2) {
                 dev->dac[dac_nr].buffer_l[(pos + c) & 63] = dev->dac[dac_nr].buffer_r[(pos + c) & 63] = mem_readw_phys(dev->dac[dac_nr].addr);
                 dev->dac[dac_nr].buffer_l[(pos + c + 1) & 63] = dev->dac[dac_nr].buffer_r[(pos + c + 1) & 63] = mem_readw_phys(dev->dac[dac_nr].addr + 2);
@@ -1943,6 +1977,17 @@ es1371_fetch(es1371_t *dev, int dac_nr)
             break;
 
         case FORMAT_STEREO_16:
+            if (((dev->dac[dac_nr].count + 4) <= dev->dac[dac_nr].size)
+                && ((p = mem_read_phys_ptr(dev->dac[dac_nr].addr, 16)) != NULL)) {
+                for (c = 0; c < 4; c++) {
+                    dev->dac[dac_nr].buffer_l[(pos + c) & 63] = *(const uint16_t *) &p[c * 4];
+                    dev->dac[dac_nr].buffer_r[(pos + c) & 63] = *(const uint16_t *) &p[(c * 4) + 2];
+                }
+                dev->dac[dac_nr].addr += 16;
+                dev->dac[dac_nr].buffer_pos_end += 4;
+                dev->dac[dac_nr].count += 4;
+                break;
+            }
             for (c = 0; c < 4; c++) {
                 dev->dac[dac_nr].buffer_l[(pos + c) & 63] = mem_readw_phys(dev->dac[dac_nr].addr);
                 dev->dac[dac_nr].buffer_r[(pos + c) & 63] = mem_readw_phys(dev->dac[dac_nr].addr + 2);
@@ -16,6 +16,7 @@
 #include <86box/rom.h>
 #include <86box/sound.h>
 #include <86box/snd_emu8k.h>
+#include <86box/thread.h>
 #include <86box/timer.h>
 #include <86box/plat_unused.h>
 
@@ -796,6 +797,9 @@ emu8k_outw(uint16_t addr, uint16_t val, void *priv)
     /*TODO: I would like to not call this here, but i found it was needed or else cubic player would not finish opening (take a looot more of time than usual).
      * Basically, being here means that the audio is generated in the emulation thread, instead of the audio thread.*/
     emu8k_update(emu8k);
+    /* Some of the registers below feed the reverb/chorus engines, which an
+       in-flight effects span still reads. */
+    emu8k_fx_sync(emu8k);
 
 #ifdef EMU8K_DEBUG_REGISTERS
     if (addr == 0xE22) {
@@ -1755,28 +1759,44 @@ int32_t old_pitch[32] = { 0 };
 int32_t old_cut[32]   = { 0 };
 int32_t old_vol[32]   = { 0 };
 #endif
-void
-emu8k_update(emu8k_t *emu8k)
+static void
+emu8k_mix_voices(emu8k_t *emu8k, int start, int end)
 {
-    if (emu8k->pos >= wavetable_pos_global)
-        return;
-
     int32_t       *buf;
     emu8k_voice_t *emu_voice;
     int            pos;
 
     /* Clean the buffers since we will accumulate into them. */
-    buf = &emu8k->buffer[emu8k->pos * 2];
-    memset(buf, 0, 2 * (wavetable_pos_global - emu8k->pos) * sizeof(emu8k->buffer[0]));
-    memset(&emu8k->chorus_in_buffer[emu8k->pos], 0, (wavetable_pos_global - emu8k->pos) * sizeof(emu8k->chorus_in_buffer[0]));
-    memset(&emu8k->reverb_in_buffer[emu8k->pos], 0, (wavetable_pos_global - emu8k->pos) * sizeof(emu8k->reverb_in_buffer[0]));
+    buf = &emu8k->buffer[start * 2];
+    memset(buf, 0, 2 * (end - start) * sizeof(emu8k->buffer[0]));
+    memset(&emu8k->chorus_in_buffer[start], 0, (end - start) * sizeof(emu8k->chorus_in_buffer[0]));
+    memset(&emu8k->reverb_in_buffer[start], 0, (end - start) * sizeof(emu8k->reverb_in_buffer[0]));
 
     /* Voices section  */
     for (uint8_t c = 0; c < 32; c++) {
         emu_voice = &emu8k->voice[c];
-        buf       = &emu8k->buffer[emu8k->pos * 2];
+        buf       = &emu8k->buffer[start * 2];
+
+        /* A voice that has faded out completely, with its envelope engine stopped and
+         * its oscillator pitch at zero, produces no output and changes no readable
+         * state: the volume slide is parked at zero and the play cursor does not
+         * advance. MIDI rarely keys all 32 channels at once, so skip the whole sample
+         * loop for such voices. The address check keeps the skip exact, as a cursor
+         * at or past the loop end would still wrap around in the full loop. */
+        if (!emu_voice->env_engine_on && !emu_voice->cvcf_curr_volume
+            && !emu_voice->volumeslide.last && !emu_voice->vtft_vol_target
+            && !emu_voice->cpf_curr_pitch && !emu_voice->ptrx_pit_target
+            && (emu_voice->cvcf_curr_filt_ctoff == emu_voice->vtft_filter_target)
+            && (emu_voice->addr.addr < emu_voice->loop_end.addr)) {
+            emu_voice->ccca               = (((uint32_t) emu_voice->ccca_qcontrol) << 24) | emu_voice->addr.int_address;
+            emu_voice->cpf_curr_frac_addr = emu_voice->addr.fract_address;
+            continue;
+        }
 
-        for (pos = emu8k->pos; pos < wavetable_pos_global; pos++) {
+        /* Neither of these can change while the sample loop runs. */
+        const int voice_output_on = (emu8k->hwcf3 & 0x04) && !CCCA_DMA_ACTIVE(emu_voice->ccca);
+
+        for (pos = start; pos < end; pos++) {
             int32_t dat;
 
             if (emu_voice->cvcf_curr_volume) {
@@ -1872,7 +1892,7 @@ emu8k_update(emu8k_t *emu8k)
 
 #endif
                 }
-                if ((emu8k->hwcf3 & 0x04) && !CCCA_DMA_ACTIVE(emu_voice->ccca)) {
+                if (voice_output_on) {
                     /*volume and pan*/
                     dat = (dat * emu_voice->cvcf_curr_volume) >> 16;
 
@@ -2119,15 +2139,97 @@ emu8k_update(emu8k_t *emu8k)
 #endif
     }
 
-    buf = &emu8k->buffer[emu8k->pos * 2];
-    emu8k_work_reverb(&emu8k->reverb_in_buffer[emu8k->pos], buf, &emu8k->reverb_engine, wavetable_pos_global - emu8k->pos);
-    emu8k_work_chorus(&emu8k->chorus_in_buffer[emu8k->pos], buf, &emu8k->chorus_engine, wavetable_pos_global - emu8k->pos);
-    emu8k_work_eq(buf, wavetable_pos_global - emu8k->pos);
+}
+
+static void
+emu8k_fx_apply(emu8k_t *emu8k, int start, int end)
+{
+    int32_t *buf = &emu8k->buffer[start * 2];
+
+    emu8k_work_reverb(&emu8k->reverb_in_buffer[start], buf, &emu8k->reverb_engine, end - start);
+    emu8k_work_chorus(&emu8k->chorus_in_buffer[start], buf, &emu8k->chorus_engine, end - start);
+    emu8k_work_eq(buf, end - start);
+}
+
+static void
+emu8k_fx_thread(void *priv)
+{
+    emu8k_t *emu8k = (emu8k_t *) priv;
+
+    for (;;) {
+        thread_wait_event(emu8k->fx_wake_event, -1);
+        thread_reset_event(emu8k->fx_wake_event);
+
+        if (emu8k->fx_closing)
+            break;
+
+        emu8k_fx_apply(emu8k, emu8k->fx_start, emu8k->fx_end);
+
+        emu8k->fx_busy = 0;
+        thread_set_event(emu8k->fx_done_event);
+    }
+}
+
+/* Hand a span of mixed voice output to the effects worker. The caller
+   must not touch that span of the buffers (or the effect engines) again
+   until emu8k_fx_sync(). */
+static void
+emu8k_fx_post(emu8k_t *emu8k, int start, int end)
+{
+    emu8k->fx_start = start;
+    emu8k->fx_end   = end;
+    emu8k->fx_busy  = 1;
+    thread_reset_event(emu8k->fx_done_event);
+    thread_set_event(emu8k->fx_wake_event);
+}
+
+/* Wait for any in-flight effects span. Needed before the rendered buffer
+   is consumed and before a register write touches the effect engines. */
+void
+emu8k_fx_sync(emu8k_t *emu8k)
+{
+    if (!emu8k->fx_thread_h)
+        return;
+
+    while (emu8k->fx_busy)
+        thread_wait_event(emu8k->fx_done_event, 10);
+}
+
+void
+emu8k_update(emu8k_t *emu8k)
+{
+    int start = emu8k->pos;
+    int end   = wavetable_pos_global;
+    int mid;
+
+    if (start >= end)
+        return;
+
+    /* Effects are an independent pipeline stage: mix the first half of
+       the span, hand it to the worker, and mix the second half while the
+       worker filters the first. The second half is left in flight so it
+       also overlaps whatever the emulation does next; every consumer of
+       the buffer syncs first. Spans are disjoint, so the worker and the
+       mixer never write the same samples. */
+    if (emu8k->fx_thread_h && ((end - start) >= 16)) {
+        mid = start + ((end - start) >> 1);
+
+        emu8k_fx_sync(emu8k);
+        emu8k_mix_voices(emu8k, start, mid);
+        emu8k_fx_post(emu8k, start, mid);
+        emu8k_mix_voices(emu8k, mid, end);
+        emu8k_fx_sync(emu8k);
+        emu8k_fx_post(emu8k, mid, end);
+    } else {
+        emu8k_fx_sync(emu8k);
+        emu8k_mix_voices(emu8k, start, end);
+        emu8k_fx_apply(emu8k, start, end);
+    }
 
     /* Update EMU clock. */
-    emu8k->wc += (wavetable_pos_global - emu8k->pos);
+    emu8k->wc += (end - start);
 
-    emu8k->pos = wavetable_pos_global;
+    emu8k->pos = end;
 }
 
 void
@@ -2369,11 +2471,30 @@ emu8k_init(emu8k_t *emu8k, uint16_t emu_addr, int onboard_ram)
     emu8k->hwcf2 = 0x20;
     /* Initial state is muted. 0x04 is unmuted. */
     emu8k->hwcf3 = 0x00;
+
+    /* Effects worker, so reverb/chorus filtering overlaps voice mixing. */
+    emu8k->fx_wake_event = thread_create_event();
+    emu8k->fx_done_event = thread_create_event();
+    emu8k->fx_busy       = 0;
+    emu8k->fx_closing    = 0;
+    emu8k->fx_thread_h   = thread_create_named(emu8k_fx_thread, emu8k, "emu8k effects");
 }
 
 void
 emu8k_close(emu8k_t *emu8k)
 {
+    if (emu8k->fx_thread_h) {
+        emu8k_fx_sync(emu8k);
+        emu8k->fx_closing = 1;
+        thread_set_event(emu8k->fx_wake_event);
+        thread_wait(emu8k->fx_thread_h);
+        thread_destroy_event(emu8k->fx_wake_event);
+        thread_destroy_event(emu8k->fx_done_event);
+        emu8k->fx_thread_h   = NULL;
+        emu8k->fx_wake_event = NULL;
+        emu8k->fx_done_event = NULL;
+    }
+
     free(emu8k->rom);
     free(emu8k->ram);
 }
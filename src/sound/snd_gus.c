@@ -84,6 +84,8 @@ typedef struct gus_t {
     int      waveirqs[32];
     int      rampirqs[32];
     int      voices;
+    uint32_t wave_run_mask;
+    uint32_t ramp_run_mask;
     uint8_t  dmactrl;
 
     int32_t out_l;
@@ -162,6 +164,25 @@ int gusfreqs[] = {
 
 double vol16bit[4096];
 
+/* Voices with both the wave and ramp generators stopped are skipped entirely by
+   gus_poll_wave(), so the per-generator run masks have to track the stop bits
+   whenever a voice control register changes. */
+static void
+gus_update_run_masks(gus_t *gus, int voice)
+{
+    const uint32_t mask = 1 << voice;
+
+    if (gus->ctrl[voice] & 3)
+        gus->wave_run_mask &= ~mask;
+    else
+        gus->wave_run_mask |= mask;
+
+    if (gus->rctrl[voice] & 3)
+        gus->ramp_run_mask &= ~mask;
+    else
+        gus->ramp_run_mask |= mask;
+}
+
 void
 gus_update_int_status(gus_t *gus)
 {
@@ -303,6 +324,7 @@ writegus(uint16_t addr, uint8_t val, void *priv)
             switch (gus->global) {
                 case 0: /*Voice control*/
                     gus->ctrl[gus->voice] = val;
+                    gus_update_run_masks(gus, gus->voice);
                     break;
                 case 1: /*Frequency control*/
                     gus->freq[gus->voice] = (gus->freq[gus->voice] & 0xFF00) | val;
@@ -358,6 +380,7 @@ writegus(uint16_t addr, uint8_t val, void *priv)
             switch (gus->global) {
                 case 0: /*Voice control*/
                     gus->ctrl[gus->voice] = val & 0x7f;
+                    gus_update_run_masks(gus, gus->voice);
 
                     old                       = gus->waveirqs[gus->voice];
                     gus->waveirqs[gus->voice] = ((val & 0xa0) == 0xa0) ? 1 : 0;
@@ -412,6 +435,7 @@ writegus(uint16_t addr, uint8_t val, void *priv)
                 case 0xD: /*Ramp control*/
                     old                       = gus->rampirqs[gus->voice];
                     gus->rctrl[gus->voice]    = val & 0x7F;
+                    gus_update_run_masks(gus, gus->voice);
                     gus->rampirqs[gus->voice] = ((val & 0xa0) == 0xa0) ? 1 : 0;
                     if (gus->rampirqs[gus->voice] != old)
                         gus_update_int_status(gus);
@@ -1041,7 +1065,13 @@ gus_poll_wave(void *priv)
 
     if ((gus->reset & 3) != 3)
         return;
+
+    const uint32_t run_mask = gus->wave_run_mask | gus->ramp_run_mask;
+
     for (uint8_t d = 0; d < 32; d++) {
+        if (!(run_mask & (1 << d)))
+            continue;
+
         if (!(gus->ctrl[d] & 3)) {
             if (gus->ctrl[d] & 4) {
                 addr = gus->cur[d] >> 9;
@@ -1171,6 +1201,9 @@ gus_poll_wave(void *priv)
                 }
             }
         }
+
+        /* The voice may have stopped itself at a loop end above. */
+        gus_update_run_masks(gus, d);
     }
 
     if (update_irqs)
@@ -1260,6 +1293,8 @@ gus_reset(void *priv)
         gus->rctrl[c] = 1;
         gus->rfreq[c] = 63 * 512;
     }
+    gus->wave_run_mask = 0;
+    gus->ramp_run_mask = 0;
 
     for (c = 4095; c >= 0; c--) {
         vol16bit[c] = out;
@@ -1360,6 +1395,8 @@ gus_init(UNUSED(const device_t *info))
         gus->rctrl[c] = 1;
         gus->rfreq[c] = 63 * 512;
     }
+    gus->wave_run_mask = 0;
+    gus->ramp_run_mask = 0;
 
     for (c = 4095; c >= 0; c--) {
         vol16bit[c] = out;
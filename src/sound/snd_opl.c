@@ -35,43 +35,47 @@
 
 static uint32_t fm_dev_inst[FM_DRV_MAX][FM_MAX];
 
+/* Per-chip driver selection: a card can pick a core for each of its
+   chips instead of inheriting the global fm_driver setting, e.g. to
+   keep Nuked on the primary OPL3 and the cheaper YMFM core on a
+   secondary one. OPL3-L, OPL4 and ESFM only have one core each. */
 uint8_t
-fm_driver_get(int chip_id, fm_drv_t *drv)
+fm_driver_get_ex(int chip_id, fm_drv_t *drv, int driver)
 {
     switch (chip_id) {
         case FM_YM3812:
-            if (fm_driver == FM_DRV_NUKED) {
+            if (driver == FM_DRV_NUKED) {
                 *drv      = nuked_opl_drv;
-                drv->priv = device_add_inst(&ym3812_nuked_device, fm_dev_inst[fm_driver][chip_id]++);
+                drv->priv = device_add_inst(&ym3812_nuked_device, fm_dev_inst[driver][chip_id]++);
             } else {
                 *drv      = ymfm_drv;
-                drv->priv = device_add_inst(&ym3812_ymfm_device, fm_dev_inst[fm_driver][chip_id]++);
+                drv->priv = device_add_inst(&ym3812_ymfm_device, fm_dev_inst[driver][chip_id]++);
             }
             break;
 
         case FM_YMF262:
-            if (fm_driver == FM_DRV_NUKED) {
+            if (driver == FM_DRV_NUKED) {
                 *drv      = nuked_opl_drv;
-                drv->priv = device_add_inst(&ymf262_nuked_device, fm_dev_inst[fm_driver][chip_id]++);
+                drv->priv = device_add_inst(&ymf262_nuked_device, fm_dev_inst[driver][chip_id]++);
             } else {
                 *drv      = ymfm_drv;
-                drv->priv = device_add_inst(&ymf262_ymfm_device, fm_dev_inst[fm_driver][chip_id]++);
+                drv->priv = device_add_inst(&ymf262_ymfm_device, fm_dev_inst[driver][chip_id]++);
             }
             break;
 
         case FM_YMF289B:
             *drv      = ymfm_drv;
-            drv->priv = device_add_inst(&ymf289b_ymfm_device, fm_dev_inst[fm_driver][chip_id]++);
+            drv->priv = device_add_inst(&ymf289b_ymfm_device, fm_dev_inst[driver][chip_id]++);
             break;
 
         case FM_YMF278B:
             *drv      = ymfm_drv;
-            drv->priv = device_add_inst(&ymf278b_ymfm_device, fm_dev_inst[fm_driver][chip_id]++);
+            drv->priv = device_add_inst(&ymf278b_ymfm_device, fm_dev_inst[driver][chip_id]++);
             break;
-        
+
         case FM_ESFM:
             *drv      = esfmu_opl_drv;
-            drv->priv = device_add_inst(&esfm_esfmu_device, fm_dev_inst[fm_driver][chip_id]++);
+            drv->priv = device_add_inst(&esfm_esfmu_device, fm_dev_inst[driver][chip_id]++);
             break;
 
         default:
@@ -80,3 +84,9 @@ fm_driver_get(int chip_id, fm_drv_t *drv)
 
     return 1;
 };
+
+uint8_t
+fm_driver_get(int chip_id, fm_drv_t *drv)
+{
+    return fm_driver_get_ex(chip_id, drv, fm_driver);
+};
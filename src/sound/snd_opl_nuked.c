@@ -1249,6 +1249,28 @@ nuked_write_reg_buffered(void *priv, uint16_t reg, uint8_t val)
     dev->wrbuf_last                  = (dev->wrbuf_last + 1) % WRBUF_SIZE;
 }
 
+/* A chip is quiet when every envelope sits fully attenuated in release with
+   no key held and the last slot outputs have decayed to zero (and rhythm
+   mode, whose slots tap the noise generator directly, is off). While that
+   holds, per-slot processing can be skipped entirely: every output is zero,
+   the envelopes stay parked at 0x1ff, and the phase accumulators are reset
+   at key-on before they can reach the output again. */
+static int
+nuked_chip_quiet(const nuked_t *dev)
+{
+    if (dev->rhy & 0x20)
+        return 0;
+
+    for (uint8_t i = 0; i < 36; i++) {
+        const slot_t *slot = &dev->slot[i];
+
+        if (slot->key || (slot->eg_gen != envelope_gen_num_release) || (slot->eg_rout != 0x1ff) || slot->out)
+            return 0;
+    }
+
+    return 1;
+}
+
 void
 nuked_generate(void *priv, int32_t *bufp)
 {
@@ -1258,6 +1280,25 @@ nuked_generate(void *priv, int32_t *bufp)
     uint8_t  i;
     uint8_t  j;
 
+    if (nuked_chip_quiet(dev)) {
+        uint32_t noise = dev->noise;
+        uint8_t  n_bit;
+
+        bufp[1] = dev->mixbuff[1];
+        bufp[0] = dev->mixbuff[0] = 0;
+        dev->mixbuff[1] = 0;
+
+        /* Advance the noise LFSR exactly as the skipped phase generators
+           would have. */
+        for (i = 0; i < 36; i++) {
+            n_bit = ((noise >> 14) ^ noise) & 0x01;
+            noise = (noise >> 1) | (n_bit << 22);
+        }
+        dev->noise = noise;
+
+        goto update_timers;
+    }
+
     bufp[1] = dev->mixbuff[1];
 
     for (i = 0; i < 15; i++) {
@@ -1311,6 +1352,7 @@ nuked_generate(void *priv, int32_t *bufp)
         slot_generate(&dev->slot[i]);
     }
 
+update_timers:
     if ((dev->timer & 0x3f) == 0x3f)
         dev->tremolopos = (dev->tremolopos + 1) % 210;
 
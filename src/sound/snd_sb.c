@@ -498,6 +498,8 @@ sb_get_wavetable_buffer_sb16_awe32(int32_t *buffer, const int len, void *priv)
     double                   bass_treble;
 
     emu8k_update(&sb->emu8k);
+    /* The tail of the block may still be on the effects worker. */
+    emu8k_fx_sync(&sb->emu8k);
 
     for (int c = 0; c < len * 2; c += 2) {
         double out_l = 0.0;
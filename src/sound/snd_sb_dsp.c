@@ -741,6 +741,47 @@ sb_8_write_dma(void *priv, uint8_t val)
     return dma_channel_write(dsp->sb_8_dmanum, val) == DMA_NODATA;
 }
 
+/* Fetch one 16-bit sample as a vectored two-byte transfer on an 8-bit
+   channel. The DSP must not pull further ahead than one whole per-sample
+   unit, as guests track the playback position by polling the DMA
+   controller's count registers. */
+static int
+sb_pair_read_dma(int dma_ch)
+{
+    uint8_t   pair[2] = { 0, 0 };
+    const int ret     = dma_channel_read_block(dma_ch, pair, 2);
+
+    if (ret == DMA_NODATA)
+        return DMA_NODATA;
+
+    /* A run cut short by terminal count yields just the low byte, like two
+       single transfers would. */
+    if ((ret & ~DMA_OVER) < 2)
+        return pair[0] | (ret & DMA_OVER);
+
+    return pair[0] | (pair[1] << 8) | (ret & DMA_OVER);
+}
+
+static int
+sb_pair_write_dma(int dma_ch, uint16_t val)
+{
+    const uint8_t pair[2] = { val & 0xff, (val >> 8) & 0xff };
+    int           ret     = dma_channel_write_block(dma_ch, pair, 2);
+
+    if (ret == DMA_NODATA)
+        return DMA_NODATA;
+
+    /* Auto-init wrapped between the two bytes; push the high byte into the
+       new cycle. */
+    if (((ret & ~DMA_OVER) < 2) && !(ret & DMA_OVER))
+        ret = dma_channel_write_block(dma_ch, &pair[1], 1);
+
+    if (ret == DMA_NODATA)
+        return DMA_NODATA;
+
+    return (ret & DMA_OVER) ? DMA_OVER : 0;
+}
+
 /*
    Supported    High DMA    Translation    Channel
    ----------------------------------------------------
@@ -771,18 +812,7 @@ sb_16_read_dma(void *priv)
         } else
             /* High DMA channel disabled, always use the first 8-bit channel. */
             dma_ch = dsp->sb_8_dmanum;
-        int temp = dma_channel_read(dma_ch);
-        ret  = temp;
-        if ((temp != DMA_NODATA) && !(temp & DMA_OVER)) {
-            temp = dma_channel_read(dma_ch);
-            if (temp == DMA_NODATA)
-                ret = DMA_NODATA;
-            else {
-                const int dma_flags = temp & DMA_OVER;
-                temp &= ~DMA_OVER;
-                ret |= (temp << 8) | dma_flags;
-            }
-        }
+        ret = sb_pair_read_dma(dma_ch);
     }
 
     return ret;
@@ -805,12 +835,7 @@ sb_16_write_dma(void *priv, uint16_t val)
         } else
             /* High DMA channel disabled, always use the first 8-bit channel. */
             dma_ch = dsp->sb_8_dmanum;
-        int temp = dma_channel_write(dma_ch, val & 0xff);
-        ret  = temp;
-        if ((temp != DMA_NODATA) && (temp != DMA_OVER)) {
-            temp = dma_channel_write(dma_ch, val >> 8);
-            ret  = temp;
-        }
+        ret = sb_pair_write_dma(dma_ch, val);
     }
 
     return ret;
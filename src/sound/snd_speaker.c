@@ -93,15 +93,23 @@ speaker_get_buffer(int32_t *buffer, int len, UNUSED(void *priv))
     speaker_update();
 
     if (!speaker_mute) {
-        for (int c = 0; c < len * 2; c += 2) {
-            val_l = val_r = (double) speaker_buffer[c >> 1];
-            /* Apply PC speaker volume and filters */
-            if (filter_pc_speaker != NULL) {
+        if (filter_pc_speaker != NULL) {
+            /* Apply PC speaker volume and filters.  The channels stay
+               interleaved per sample because the SB16 output FIR only
+               advances its delay line on the right channel. */
+            for (int c = 0; c < len * 2; c += 2) {
+                val_l = val_r = (double) speaker_buffer[c >> 1];
                 filter_pc_speaker(0, &val_l, filter_pc_speaker_p);
                 filter_pc_speaker(1, &val_r, filter_pc_speaker_p);
+                buffer[c] += (int32_t) val_l;
+                buffer[c + 1] += (int32_t) val_r;
+            }
+        } else {
+            /* No filter installed: mix the block straight in. */
+            for (int c = 0; c < len * 2; c += 2) {
+                buffer[c] += speaker_buffer[c >> 1];
+                buffer[c + 1] += speaker_buffer[c >> 1];
             }
-            buffer[c] += (int32_t) val_l;
-            buffer[c + 1] += (int32_t) val_r;
         }
     }
 
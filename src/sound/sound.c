@@ -18,6 +18,7 @@
  */
 #include <math.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -93,6 +94,31 @@ static int          cd_thread_enable = 0;
 static void (*filter_cd_audio)(int channel, double *buffer, void *priv) = NULL;
 static void *filter_cd_audio_p                                          = NULL;
 
+/* Shared audio worker pool: when more than one handler is registered on
+   a poll path, each handler (and with it the FM/PCM generation of that
+   card) renders into its own scratch buffer on a pool thread, and the
+   poll thread mixes the results. The poll thread joins before mixing,
+   so the emulated device state is never touched concurrently with the
+   emulation itself. Handlers are claimed through an atomic cursor, so
+   a dual-OPL3 setup spreads across two cores instead of serializing. */
+#define SOUND_POOL_MAX_THREADS 3
+
+typedef struct sound_pool_thread_t {
+    thread_t *thread;
+    event_t  *wake;
+} sound_pool_thread_t;
+
+static sound_pool_thread_t sound_pool_threads[SOUND_POOL_MAX_THREADS];
+static int                 sound_pool_threads_num = 0;
+static event_t            *sound_pool_done_event  = NULL;
+static sound_handler_t    *pool_handlers          = NULL;
+static int                 pool_handlers_num      = 0;
+static int                 pool_len               = 0;
+static atomic_int          pool_next;
+static atomic_int          pool_done;
+/* MUSICBUFLEN is the largest of the three poll buffer lengths. */
+static int32_t             pool_buffers[8][MUSICBUFLEN * 2];
+
 void (*filter_pc_speaker)(int channel, double *buffer, void *priv) = NULL;
 void *filter_pc_speaker_p                                          = NULL;
 
@@ -556,6 +582,80 @@ sound_set_pc_speaker_filter(void (*filter)(int channel, double *buffer, void *pr
     }
 }
 
+/* Claim and render handlers until the job's cursor runs out; the last
+   handler to finish signals the poll thread. */
+static void
+sound_pool_run(void)
+{
+    int i;
+
+    for (;;) {
+        i = atomic_fetch_add(&pool_next, 1);
+        if (i >= pool_handlers_num)
+            break;
+
+        memset(pool_buffers[i], 0x00, pool_len * 2 * sizeof(int32_t));
+        pool_handlers[i].get_buffer(pool_buffers[i], pool_len, pool_handlers[i].priv);
+
+        if ((atomic_fetch_add(&pool_done, 1) + 1) == pool_handlers_num)
+            thread_set_event(sound_pool_done_event);
+    }
+}
+
+static void
+sound_pool_thread(void *priv)
+{
+    sound_pool_thread_t *t = (sound_pool_thread_t *) priv;
+
+    for (;;) {
+        thread_wait_event(t->wake, -1);
+        thread_reset_event(t->wake);
+        sound_pool_run();
+    }
+}
+
+static void
+sound_run_handlers(sound_handler_t *handlers, int num, int32_t *buffer, int len)
+{
+    sound_pool_thread_t *t;
+    int                  c;
+    int                  d;
+
+    if (num <= 1) {
+        for (c = 0; c < num; c++)
+            handlers[c].get_buffer(buffer, len, handlers[c].priv);
+        return;
+    }
+
+    /* Grow the pool to one worker per extra handler. */
+    while ((sound_pool_threads_num < (num - 1)) && (sound_pool_threads_num < SOUND_POOL_MAX_THREADS)) {
+        if (sound_pool_done_event == NULL)
+            sound_pool_done_event = thread_create_event();
+        t         = &sound_pool_threads[sound_pool_threads_num];
+        t->wake   = thread_create_event();
+        t->thread = thread_create_named(sound_pool_thread, t, "audio worker");
+        sound_pool_threads_num++;
+    }
+
+    pool_handlers     = handlers;
+    pool_len          = len;
+    pool_handlers_num = num;
+    atomic_store(&pool_done, 0);
+    thread_reset_event(sound_pool_done_event);
+    atomic_store(&pool_next, 0);
+
+    for (c = 0; c < sound_pool_threads_num; c++)
+        thread_set_event(sound_pool_threads[c].wake);
+
+    sound_pool_run();
+
+    thread_wait_event(sound_pool_done_event, -1);
+
+    for (c = 0; c < num; c++)
+        for (d = 0; d < len * 2; d++)
+            buffer[d] += pool_buffers[c][d];
+}
+
 void
 sound_poll(UNUSED(void *priv))
 {
@@ -569,13 +669,17 @@ sound_poll(UNUSED(void *priv))
 
         memset(outbuffer, 0x00, SOUNDBUFLEN * 2 * sizeof(int32_t));
 
-        for (c = 0; c < sound_handlers_num; c++)
-            sound_handlers[c].get_buffer(outbuffer, SOUNDBUFLEN, sound_handlers[c].priv);
+        sound_run_handlers(sound_handlers, sound_handlers_num, outbuffer, SOUNDBUFLEN);
 
-        for (c = 0; c < SOUNDBUFLEN * 2; c++) {
-            if (sound_is_float)
+        /* Keep the output format check out of the per-sample loop so the
+           conversion and clamp passes stay tight enough to vectorize. */
+        if (sound_is_float) {
+            for (c = 0; c < SOUNDBUFLEN * 2; c++)
                 outbuffer_ex[c] = ((float) outbuffer[c]) / (float) 32768.0;
-            else {
+
+            givealbuffer(outbuffer_ex);
+        } else {
+            for (c = 0; c < SOUNDBUFLEN * 2; c++) {
                 if (outbuffer[c] > 32767)
                     outbuffer[c] = 32767;
                 if (outbuffer[c] < -32768)
@@ -583,12 +687,9 @@ sound_poll(UNUSED(void *priv))
 
                 outbuffer_ex_int16[c] = (int16_t) outbuffer[c];
             }
-        }
 
-        if (sound_is_float)
-            givealbuffer(outbuffer_ex);
-        else
             givealbuffer(outbuffer_ex_int16);
+        }
 
         if (cd_thread_enable) {
             cd_buf_update--;
@@ -613,13 +714,15 @@ music_poll(UNUSED(void *priv))
 
         memset(outbuffer_m, 0x00, MUSICBUFLEN * 2 * sizeof(int32_t));
 
-        for (c = 0; c < music_handlers_num; c++)
-            music_handlers[c].get_buffer(outbuffer_m, MUSICBUFLEN, music_handlers[c].priv);
+        sound_run_handlers(music_handlers, music_handlers_num, outbuffer_m, MUSICBUFLEN);
 
-        for (c = 0; c < MUSICBUFLEN * 2; c++) {
-            if (sound_is_float)
+        if (sound_is_float) {
+            for (c = 0; c < MUSICBUFLEN * 2; c++)
                 outbuffer_m_ex[c] = ((float) outbuffer_m[c]) / (float) 32768.0;
-            else {
+
+            givealbuffer_music(outbuffer_m_ex);
+        } else {
+            for (c = 0; c < MUSICBUFLEN * 2; c++) {
                 if (outbuffer_m[c] > 32767)
                     outbuffer_m[c] = 32767;
                 if (outbuffer_m[c] < -32768)
@@ -627,12 +730,9 @@ music_poll(UNUSED(void *priv))
 
                 outbuffer_m_ex_int16[c] = (int16_t) outbuffer_m[c];
             }
-        }
 
-        if (sound_is_float)
-            givealbuffer_music(outbuffer_m_ex);
-        else
             givealbuffer_music(outbuffer_m_ex_int16);
+        }
 
         music_pos_global = 0;
     }
@@ -649,13 +749,15 @@ wavetable_poll(UNUSED(void *priv))
 
         memset(outbuffer_w, 0x00, WTBUFLEN * 2 * sizeof(int32_t));
 
-        for (c = 0; c < wavetable_handlers_num; c++)
-            wavetable_handlers[c].get_buffer(outbuffer_w, WTBUFLEN, wavetable_handlers[c].priv);
+        sound_run_handlers(wavetable_handlers, wavetable_handlers_num, outbuffer_w, WTBUFLEN);
 
-        for (c = 0; c < WTBUFLEN * 2; c++) {
-            if (sound_is_float)
+        if (sound_is_float) {
+            for (c = 0; c < WTBUFLEN * 2; c++)
                 outbuffer_w_ex[c] = ((float) outbuffer_w[c]) / (float) 32768.0;
-            else {
+
+            givealbuffer_wt(outbuffer_w_ex);
+        } else {
+            for (c = 0; c < WTBUFLEN * 2; c++) {
                 if (outbuffer_w[c] > 32767)
                     outbuffer_w[c] = 32767;
                 if (outbuffer_w[c] < -32768)
@@ -663,12 +765,9 @@ wavetable_poll(UNUSED(void *priv))
 
                 outbuffer_w_ex_int16[c] = (int16_t) outbuffer_w[c];
             }
-        }
 
-        if (sound_is_float)
-            givealbuffer_wt(outbuffer_w_ex);
-        else
             givealbuffer_wt(outbuffer_w_ex_int16);
+        }
 
         wavetable_pos_global = 0;
     }
@@ -1,3 +1,4 @@
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <condition_variable>
@@ -8,9 +9,24 @@
 struct event_cpp11_t {
     std::condition_variable cond;
     std::mutex              mutex;
-    bool                    state = false;
+    std::atomic<bool>       state { false };
 };
 
+/* Spin briefly before committing to a sleeping wait: the Voodoo render
+   and FIFO threads signal events thousands of times per frame, and the
+   event is usually set again within this window. */
+static constexpr int event_spin_count = 2000;
+
+static inline void
+event_cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
 extern "C" {
 
 thread_t *
@@ -90,10 +106,17 @@ int
 thread_wait_event(event_t *handle, int timeout)
 {
     auto event = reinterpret_cast<event_cpp11_t *>(handle);
-    auto lock  = std::unique_lock<std::mutex>(event->mutex);
+
+    for (int i = 0; i < event_spin_count; i++) {
+        if (event->state.load(std::memory_order_acquire))
+            return 0;
+        event_cpu_relax();
+    }
+
+    auto lock = std::unique_lock<std::mutex>(event->mutex);
 
     if (timeout < 0) {
-        event->cond.wait(lock, [event] { return event->state; });
+        event->cond.wait(lock, [event] { return event->state.load(); });
     } else {
         auto           to = std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
         std::cv_status status;
@@ -3,85 +3,180 @@
 #include <string.h>
 #include <wchar.h>
 #include <86box/86box.h>
+#include <86box/device.h>
 #include <86box/timer.h>
+#include <86box/perfctr.h>
+#include <86box/trace.h>
+#include <86box/plat.h>
+
+#include <stdlib.h>
 
 uint64_t TIMER_USEC;
 uint32_t timer_target;
 
-/*Enabled timers are stored in a linked list, with the first timer to expire at
-  the head.*/
-pc_timer_t *timer_head = NULL;
+/*Optional per-callback cost accounting (timer_cost_budget > 0): each
+  callback run is bracketed with the host cycle counter, folded into a
+  decayed average on the timer, and a trace event is emitted when a
+  single run exceeds the configured budget. The counter frequency is
+  calibrated against the millisecond clock at runtime, so the budget is
+  configured in microseconds. The guest TSC is unrelated to any of this.*/
+uint32_t timer_cost_budget = 0;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    include <x86intrin.h>
+static __inline uint64_t
+host_ticks(void)
+{
+    return __rdtsc();
+}
+#elif defined(__GNUC__) && defined(__aarch64__)
+static __inline uint64_t
+host_ticks(void)
+{
+    uint64_t val;
+
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (val));
+    return val;
+}
+#else
+static __inline uint64_t
+host_ticks(void)
+{
+    return plat_timer_read();
+}
+#endif
+
+static uint64_t host_ticks_base   = 0;
+static uint32_t host_ms_base      = 0;
+static double   host_ticks_per_us = 0.0;
+static double   cost_budget_ticks = 0.0;
+
+static void
+timer_cost_calibrate(void)
+{
+    uint64_t ticks = host_ticks();
+    uint32_t ms    = plat_get_ticks();
+
+    if (host_ticks_base == 0) {
+        host_ticks_base = ticks;
+        host_ms_base    = ms;
+        return;
+    }
+
+    /* Too short a window gives a noisy frequency - wait for a longer one. */
+    if ((ms - host_ms_base) < 100)
+        return;
+
+    host_ticks_per_us = ((double) (ticks - host_ticks_base)) / (((double) (ms - host_ms_base)) * 1000.0);
+    cost_budget_ticks = ((double) timer_cost_budget) * host_ticks_per_us;
+}
+
+/*Enabled timers are kept in a 4-ary min-heap keyed on the 32:32 timestamp,
+  with the first timer to expire at the root. The heap is 1-based so that a
+  qidx of 0 can mean "not enqueued"; with 4 children per node the frequent
+  period reloads sift through fewer, cache-adjacent levels than a binary
+  heap or the old sorted list would touch.*/
+static pc_timer_t **timer_queue     = NULL;
+static uint32_t     timer_queue_num = 0;
+static uint32_t     timer_queue_sz  = 0;
 
 /* Are we initialized? */
 int timer_inited = 0;
 
 static void timer_advance_ex(pc_timer_t *timer, int start);
 
+#define TIMER_QUEUE_CHILD(i)  ((((i) -1) << 2) + 2)
+#define TIMER_QUEUE_PARENT(i) ((((i) -2) >> 2) + 1)
+
+static void
+timer_queue_put(uint32_t slot, pc_timer_t *timer)
+{
+    timer_queue[slot] = timer;
+    timer->qidx       = slot;
+}
+
+static void
+timer_queue_sift_up(uint32_t slot, pc_timer_t *timer)
+{
+    while (slot > 1) {
+        pc_timer_t *parent = timer_queue[TIMER_QUEUE_PARENT(slot)];
+
+        if (TIMER_LESS_THAN(parent, timer))
+            break;
+        timer_queue_put(slot, parent);
+        slot = TIMER_QUEUE_PARENT(slot);
+    }
+    timer_queue_put(slot, timer);
+}
+
+static void
+timer_queue_sift_down(uint32_t slot, pc_timer_t *timer)
+{
+    while (1) {
+        uint32_t child = TIMER_QUEUE_CHILD(slot);
+        uint32_t last  = child + 3;
+        uint32_t least;
+
+        if (child > timer_queue_num)
+            break;
+        if (last > timer_queue_num)
+            last = timer_queue_num;
+
+        least = child;
+        for (uint32_t c = child + 1; c <= last; c++) {
+            if (TIMER_LESS_THAN(timer_queue[c], timer_queue[least]))
+                least = c;
+        }
+
+        if (TIMER_LESS_THAN(timer, timer_queue[least]))
+            break;
+        timer_queue_put(slot, timer_queue[least]);
+        slot = least;
+    }
+    timer_queue_put(slot, timer);
+}
+
+/*Remove the timer at slot, refilling the hole with the last heap entry.*/
+static void
+timer_queue_remove(uint32_t slot)
+{
+    pc_timer_t *last = timer_queue[timer_queue_num];
+
+    timer_queue[slot]->qidx        = 0;
+    timer_queue[timer_queue_num--] = NULL;
+
+    if (slot <= timer_queue_num) {
+        if ((slot > 1) && TIMER_LESS_THAN(last, timer_queue[TIMER_QUEUE_PARENT(slot)]))
+            timer_queue_sift_up(slot, last);
+        else
+            timer_queue_sift_down(slot, last);
+    }
+}
+
 void
 timer_enable(pc_timer_t *timer)
 {
-    pc_timer_t *timer_node = timer_head;
-    int ret = 0;
-
     if (!timer_inited || (timer == NULL))
         return;
 
     if (timer->flags & TIMER_ENABLED)
         timer_disable(timer);
 
-    if (timer->next || timer->prev)
-        fatal("timer_enable - timer->next\n");
-
-    /*List currently empty - add to head*/
-    if (!timer_head) {
-        timer_head  = timer;
-        timer->next = timer->prev = NULL;
-        timer_target              = timer_head->ts.ts32.integer;
-        ret = 1;
-    } else if (TIMER_LESS_THAN(timer, timer_head)) {
-        timer->next      = timer_head;
-        timer->prev      = NULL;
-        timer_head->prev = timer;
-        timer_head       = timer;
-        timer_target     = timer_head->ts.ts32.integer;
-        ret = 1;
-    } else if (!timer_head->next) {
-        timer_head->next = timer;
-        timer->prev      = timer_head;
-        ret = 1;
-    }
+    if (timer->qidx)
+        fatal("timer_enable - timer already in queue\n");
 
-    if (ret == 0) {
-        pc_timer_t *prev = timer_head;
-        timer_node       = timer_head->next;
-
-        while (1) {
-            /*Timer expires before timer_node. Add to list in front of timer_node*/
-            if (TIMER_LESS_THAN(timer, timer_node)) {
-                timer->next      = timer_node;
-                timer->prev      = prev;
-                timer_node->prev = timer;
-                prev->next       = timer;
-                ret = 1;
-                break;
-            }
-
-            /*timer_node is last in the list. Add timer to end of list*/
-            if (!timer_node->next) {
-                timer_node->next = timer;
-                timer->prev      = timer_node;
-                ret = 1;
-                break;
-            }
-
-            prev       = timer_node;
-            timer_node = timer_node->next;
-        }
+    if (timer_queue_num == timer_queue_sz) {
+        timer_queue_sz = timer_queue_sz ? (timer_queue_sz << 1) : 64;
+        timer_queue    = (pc_timer_t **) realloc(timer_queue, (timer_queue_sz + 1) * sizeof(pc_timer_t *));
+        if (timer_queue == NULL)
+            fatal("timer_enable - out of memory\n");
     }
 
-    /* Do not mark it as enabled if it has failed every single condition. */
-    if (ret == 1)
-        timer->flags |= TIMER_ENABLED;
+    timer_queue_sift_up(++timer_queue_num, timer);
+    timer->flags |= TIMER_ENABLED;
+    PERF_SET(PERF_TIMER_DEPTH, timer_queue_num);
+
+    timer_target = timer_queue[1]->ts.ts32.integer;
 }
 
 void
@@ -90,19 +185,14 @@ timer_disable(pc_timer_t *timer)
     if (!timer_inited || (timer == NULL) || !(timer->flags & TIMER_ENABLED))
         return;
 
-    if (!timer->next && !timer->prev && timer != timer_head)
-        fatal("timer_disable - !timer->next\n");
+    if (!timer->qidx)
+        fatal("timer_disable - timer not in queue\n");
 
     timer->flags &= ~TIMER_ENABLED;
     timer->in_callback = 0;
 
-    if (timer->prev)
-        timer->prev->next = timer->next;
-    else
-        timer_head = timer->next;
-    if (timer->next)
-        timer->next->prev = timer->prev;
-    timer->prev = timer->next = NULL;
+    timer_queue_remove(timer->qidx);
+    PERF_SET(PERF_TIMER_DEPTH, timer_queue_num);
 }
 
 void
@@ -110,20 +200,18 @@ timer_process(void)
 {
     pc_timer_t *timer;
 
-    if (!timer_head)
+    if (!timer_queue_num)
         return;
 
-    while (1) {
-        timer = timer_head;
+    TRACE_BEGIN(TRACE_TIMER, "timer", "timer_process");
+
+    while (timer_queue_num) {
+        timer = timer_queue[1];
 
         if (!TIMER_LESS_THAN_VAL(timer, (uint32_t) tsc))
             break;
 
-        timer_head = timer->next;
-        if (timer_head)
-            timer_head->prev = NULL;
-
-        timer->next = timer->prev = NULL;
+        timer_queue_remove(1);
         timer->flags &= ~TIMER_ENABLED;
 
         if (timer->flags & TIMER_SPLIT)
@@ -134,30 +222,46 @@ timer_process(void)
                have a NULL callback when no operation
                is needed. */
             timer->in_callback = 1;
-            timer->callback(timer->priv);
+            if (UNLIKELY(timer_cost_budget)) {
+                uint64_t start = host_ticks();
+                double   cost;
+
+                timer->callback(timer->priv);
+
+                cost = (double) (host_ticks() - start);
+                timer->cost_avg += (cost - timer->cost_avg) * 0.05;
+                if (cost > timer->cost_max)
+                    timer->cost_max = cost;
+                timer->cost_calls++;
+
+                if (host_ticks_per_us == 0.0)
+                    timer_cost_calibrate();
+                else if (cost > cost_budget_ticks)
+                    TRACE_INSTANT(TRACE_TIMER, "timer", (timer->dev_name != NULL) ? timer->dev_name : "core");
+            } else
+                timer->callback(timer->priv);
             timer->in_callback = 0;
         }
     }
 
-    timer_target = timer_head->ts.ts32.integer;
+    if (timer_queue_num)
+        timer_target = timer_queue[1]->ts.ts32.integer;
+
+    TRACE_END(TRACE_TIMER, "timer", "timer_process");
 }
 
 void
 timer_close(void)
 {
-    pc_timer_t *t = timer_head;
-    pc_timer_t *r;
-
-    /* Set all timers' prev and next to NULL so it is assured that
-       timers that are not in malloc'd structs don't keep pointing
-       to timers that may be in malloc'd structs. */
-    while (t != NULL) {
-        r       = t;
-        r->prev = r->next = NULL;
-        t                 = r->next;
-    }
+    /* Clear the queue indices so it is assured that timers that are not
+       in malloc'd structs don't keep pointing into the freed queue. */
+    for (uint32_t i = 1; i <= timer_queue_num; i++)
+        timer_queue[i]->qidx = 0;
 
-    timer_head = NULL;
+    free(timer_queue);
+    timer_queue     = NULL;
+    timer_queue_num = 0;
+    timer_queue_sz  = 0;
 
     timer_inited = 0;
 }
@@ -168,23 +272,53 @@ timer_init(void)
     timer_target = 0ULL;
     tsc          = 0;
 
+    if (timer_cost_budget)
+        timer_cost_calibrate();
+
     timer_inited = 1;
 }
 
 void
 timer_add(pc_timer_t *timer, void (*callback)(void *priv), void *priv, int start_timer)
 {
+    const device_t *dev = device_context_get_device();
+
     memset(timer, 0, sizeof(pc_timer_t));
 
     timer->callback    = callback;
     timer->in_callback = 0;
     timer->priv        = priv;
     timer->flags       = 0;
-    timer->prev        = timer->next = NULL;
+    /* Attribute the timer to the device whose init we are inside of,
+       if any, for the cost accounting table. */
+    timer->dev_name    = (dev != NULL) ? dev->name : NULL;
     if (start_timer)
         timer_set_delay_u64(timer, 0);
 }
 
+/*Log the cost table for the currently enabled timers; walking the queue
+  covers everything that is actually running.*/
+void
+timer_cost_dump(void)
+{
+    if (!timer_cost_budget || (host_ticks_per_us == 0.0))
+        return;
+
+    pclog("Timer callback costs (us, budget %u, %u enabled timers):\n", timer_cost_budget, timer_queue_num);
+    for (uint32_t i = 1; i <= timer_queue_num; i++) {
+        const pc_timer_t *timer = timer_queue[i];
+
+        if (!timer->cost_calls)
+            continue;
+
+        pclog("    %-24s %10u calls  avg %10.2f  max %10.2f\n",
+              (timer->dev_name != NULL) ? timer->dev_name : "core",
+              timer->cost_calls,
+              timer->cost_avg / host_ticks_per_us,
+              timer->cost_max / host_ticks_per_us);
+    }
+}
+
 /* The API for big timer periods starts here. */
 void
 timer_stop(pc_timer_t *timer)
@@ -257,26 +391,25 @@ timer_on_auto(pc_timer_t *timer, double period)
 void
 timer_set_new_tsc(uint64_t new_tsc)
 {
-    pc_timer_t *timer = NULL;
     /* Run timers already expired. */
 #ifdef USE_DYNAREC
     if (cpu_use_dynarec)
         update_tsc();
 #endif
 
-    if (!timer_head) {
+    if (!timer_queue_num) {
         tsc = new_tsc;
         return;
     }
 
-    timer = timer_head;
-    timer_target = new_tsc + (int32_t)(timer_get_ts_int(timer_head) - (uint32_t)tsc);
+    timer_target = new_tsc + (int32_t) (timer_get_ts_int(timer_queue[1]) - (uint32_t) tsc);
 
-    while (timer) {
-        int32_t offset_from_current_tsc = (int32_t)(timer_get_ts_int(timer) - (uint32_t)tsc);
-        timer->ts.ts32.integer = new_tsc + offset_from_current_tsc;
+    /* Rebasing every timestamp by the same offset preserves the heap order. */
+    for (uint32_t i = 1; i <= timer_queue_num; i++) {
+        pc_timer_t *timer               = timer_queue[i];
+        int32_t     offset_from_current_tsc = (int32_t) (timer_get_ts_int(timer) - (uint32_t) tsc);
 
-        timer = timer->next;
+        timer->ts.ts32.integer = new_tsc + offset_from_current_tsc;
     }
 
     tsc = new_tsc;
@@ -1,4 +1,5 @@
 #ifdef __linux__
+#    define _GNU_SOURCE /* for fallocate() */
 #    define _FILE_OFFSET_BITS   64
 #    define _LARGEFILE64_SOURCE 1
 #endif
@@ -13,7 +14,9 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
+#include <sys/file.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <errno.h>
 #include <inttypes.h>
 #include <dlfcn.h>
@@ -40,6 +43,8 @@
 #include <86box/unix_sdl.h>
 #include <86box/timer.h>
 #include <86box/nvr.h>
+#include <86box/bench.h>
+#include <86box/rewind.h>
 #include <86box/version.h>
 #include <86box/video.h>
 #include <86box/ui.h>
@@ -411,6 +416,13 @@ plat_mmap(size_t size, uint8_t executable)
     void *ret = mmap(0, size, PROT_READ | PROT_WRITE | (executable ? PROT_EXEC : 0), MAP_ANON | MAP_PRIVATE | (executable ? MAP_JIT : 0), -1, 0);
 #else
     void *ret = mmap(0, size, PROT_READ | PROT_WRITE | (executable ? PROT_EXEC : 0), MAP_ANON | MAP_PRIVATE, -1, 0);
+#endif
+#ifdef MADV_HUGEPAGE
+    /*Ask for transparent huge pages on large data allocations (guest RAM,
+      VRAM) to cut down host TLB pressure; code caches are left on regular
+      pages, as they are mprotect()ed and flushed piecemeal.*/
+    if ((ret != MAP_FAILED) && !executable && (size >= (2 << 20)))
+        madvise(ret, size, MADV_HUGEPAGE);
 #endif
     return (ret < 0) ? NULL : ret;
 }
@@ -421,6 +433,179 @@ plat_munmap(void *ptr, size_t size)
     munmap(ptr, size);
 }
 
+void *
+plat_mmap_file(FILE *fp, uint64_t size, uint8_t readonly)
+{
+    void *ret;
+
+    /* Make sure anything still sitting in the stdio buffer is visible
+       through the mapping. */
+    if (fflush(fp))
+        return NULL;
+
+    ret = mmap(0, (size_t) size, PROT_READ | (readonly ? 0 : PROT_WRITE), MAP_SHARED, fileno(fp), 0);
+
+    return (ret == MAP_FAILED) ? NULL : ret;
+}
+
+void
+plat_msync_file(void *ptr, uint64_t size)
+{
+    msync(ptr, (size_t) size, MS_ASYNC);
+}
+
+void
+plat_munmap_file(void *ptr, uint64_t size)
+{
+    munmap(ptr, (size_t) size);
+}
+
+/* Creator-side shared mappings still being filled: the shm descriptor has
+   to stay open, as it carries the flock() that makes other instances wait
+   for the fill, until plat_shared_seal() swaps in a private view. Loads
+   are sequential, so a handful of slots is plenty. */
+static struct {
+    void *ptr;
+    int   fd;
+} shared_fill[4];
+
+void *
+plat_shared_map(uint64_t key, uint64_t size, int *fill)
+{
+    char        name[32];
+    struct stat st;
+    void       *ret;
+    int         fd;
+
+    *fill = 0;
+
+    /* Keep the name short - some hosts cap shm names at 31 characters. */
+    snprintf(name, sizeof(name), "/86Box.%016" PRIx64, key);
+
+    /* The first instance to ask for a key creates and fills the object;
+       everyone else maps it copy-on-write, so identical ROM and font
+       images occupy physical memory once per host. */
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+        (void) flock(fd, LOCK_EX);
+        ret = MAP_FAILED;
+        if (!ftruncate(fd, (off_t) size))
+            ret = mmap(0, (size_t) size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (ret != MAP_FAILED) {
+            for (uint8_t i = 0; i < 4; i++) {
+                if (shared_fill[i].ptr == NULL) {
+                    shared_fill[i].ptr = ret;
+                    shared_fill[i].fd  = fd;
+                    *fill = 1;
+                    return ret;
+                }
+            }
+            munmap(ret, (size_t) size);
+        }
+        close(fd);
+        shm_unlink(name);
+        return NULL;
+    }
+
+    if (errno != EEXIST)
+        return NULL;
+
+    fd = shm_open(name, O_RDWR, 0600);
+    if (fd < 0)
+        return NULL;
+
+    /* Block until the creator has dropped its exclusive fill lock. A size
+       mismatch means the creator died before finishing (or lost a race
+       with us before it could size the object) - stay private then. */
+    (void) flock(fd, LOCK_SH);
+    if (fstat(fd, &st) || ((uint64_t) st.st_size != size)) {
+        close(fd);
+        return NULL;
+    }
+
+    ret = mmap(0, (size_t) size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    /* The mapping keeps the open file description - and with it the
+       lock - alive past the close, so drop the lock explicitly. */
+    (void) flock(fd, LOCK_UN);
+    close(fd);
+
+    return (ret == MAP_FAILED) ? NULL : ret;
+}
+
+void *
+plat_shared_seal(void *ptr, uint64_t size)
+{
+    void *ret;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        if (shared_fill[i].ptr == ptr) {
+            /* Trade the writable shared view for the same copy-on-write
+               one the other instances get; dropping the fill lock lets
+               them in. */
+            munmap(ptr, (size_t) size);
+            ret = mmap(0, (size_t) size, PROT_READ | PROT_WRITE, MAP_PRIVATE, shared_fill[i].fd, 0);
+            (void) flock(shared_fill[i].fd, LOCK_UN);
+            close(shared_fill[i].fd);
+            shared_fill[i].ptr = NULL;
+            return (ret == MAP_FAILED) ? NULL : ret;
+        }
+    }
+
+    return ptr;
+}
+
+void
+plat_shared_unmap(void *ptr, uint64_t size)
+{
+    munmap(ptr, (size_t) size);
+}
+
+int
+plat_fpunch(FILE *fp, uint64_t offset, uint64_t size)
+{
+#if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+    /* The range must not linger in the stdio buffer past the punch. */
+    if (fflush(fp))
+        return 0;
+
+    return !fallocate(fileno(fp), FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                      (off_t) offset, (off_t) size);
+#else
+    (void) fp;
+    (void) offset;
+    (void) size;
+
+    return 0;
+#endif
+}
+
+int
+plat_fextend(FILE *fp, uint64_t size)
+{
+    /* Pending stdio output must land before the size changes under it. */
+    if (fflush(fp))
+        return 0;
+
+    return !ftruncate(fileno(fp), (off_t) size);
+}
+
+void
+plat_balloon_out(void *ptr, size_t size)
+{
+#if defined(MADV_PAGEOUT)
+    /* Reclaim now; the kernel compresses or swaps the pages (zram/zswap)
+       and faults them back in, contents intact, on the next access. */
+    madvise(ptr, size, MADV_PAGEOUT);
+#elif defined(MADV_COLD)
+    /* No direct reclaim on this kernel; at least mark the range as the
+       first candidate when the host comes under memory pressure. */
+    madvise(ptr, size, MADV_COLD);
+#else
+    (void) ptr;
+    (void) size;
+#endif
+}
+
 uint64_t
 plat_timer_read(void)
 {
@@ -543,6 +728,8 @@ main_thread(void *param)
     // title_update = 1;
     old_time = SDL_GetTicks();
     drawits = frames = 0;
+    if (bench_enabled)
+        bench_start();
     while (!is_quit && cpu_thread_run) {
         /* See if it is time to run a frame of code. */
         new_time = SDL_GetTicks();
@@ -551,7 +738,7 @@ main_thread(void *param)
             drawits = 10;
         else
 #endif
-            drawits += (new_time - old_time);
+            drawits += pc_governor_elapsed(new_time - old_time);
         old_time = new_time;
         if (drawits > 0 && !dopause) {
             /* Yes, so do one frame now. */
@@ -562,11 +749,17 @@ main_thread(void *param)
             /* Run a block of code. */
             pc_run();
 
+            /* End a benchmark run once the emulated deadline has passed. */
+            if (bench_enabled && bench_tick())
+                break;
+
+            /* Take a rewind checkpoint every few seconds. */
+            rewind_tick();
+
             /* Every 200 frames we save the machine status. */
             if (++frames >= 200 && nvr_dosave) {
-                nvr_save();
-                nvr_dosave = 0;
-                frames     = 0;
+                nvr_save_async();
+                frames = 0;
             }
         } else /* Just so we dont overload the host OS. */
             SDL_Delay(1);
@@ -1325,6 +1518,12 @@ main(int argc, char **argv)
                             case SDL_WINDOWEVENT_LEAVE:
                                 mouse_inside = 0;
                                 break;
+                            case SDL_WINDOWEVENT_FOCUS_GAINED:
+                                pc_in_background = 0;
+                                break;
+                            case SDL_WINDOWEVENT_FOCUS_LOST:
+                                pc_in_background = 1;
+                                break;
                         }
                     }
             }
@@ -1382,6 +1581,14 @@ plat_get_cpu_string(char *outbuf, uint8_t len) {
     strncpy(outbuf, cpu_string, len);
 }
 
+int
+plat_get_cpu_count(void)
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (count > 0) ? (int) count : 1;
+}
+
 void
 plat_set_thread_name(void *thread, const char *name)
 {
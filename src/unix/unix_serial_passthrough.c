@@ -75,6 +75,38 @@ plat_serpt_read(void *priv, uint8_t *data)
     return 0;
 }
 
+int
+plat_serpt_read_bulk(void *priv, uint8_t *data, int max)
+{
+    serial_passthrough_t *dev = (serial_passthrough_t *) priv;
+    int                   res;
+    struct timeval        tv;
+    fd_set                rdfds;
+
+    switch (dev->mode) {
+        case SERPT_MODE_VCON:
+        case SERPT_MODE_HOSTSER:
+            FD_ZERO(&rdfds);
+            FD_SET(dev->master_fd, &rdfds);
+            tv.tv_sec  = 0;
+            tv.tv_usec = 0;
+
+            res = select(dev->master_fd + 1, &rdfds, NULL, NULL, &tv);
+            if (res <= 0 || !FD_ISSET(dev->master_fd, &rdfds)) {
+                return 0;
+            }
+
+            res = read(dev->master_fd, data, max);
+            if (res > 0) {
+                return res;
+            }
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
+
 void
 plat_serpt_close(void *priv)
 {
@@ -202,6 +234,34 @@ plat_serpt_write(void *priv, uint8_t data)
     }
 }
 
+void
+plat_serpt_write_bulk(void *priv, const uint8_t *data, int len)
+{
+    serial_passthrough_t *dev = (serial_passthrough_t *) priv;
+    ssize_t               res;
+
+    switch (dev->mode) {
+        case SERPT_MODE_VCON:
+        case SERPT_MODE_HOSTSER:
+            while (len > 0) {
+                res = write(dev->master_fd, data, len);
+                if (res > 0) {
+                    data += res;
+                    len -= res;
+                } else if ((res == -1) && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                    /* Like the per-byte path: spin on a busy host port,
+                       but drop on a pty with no reader attached. */
+                    if (dev->mode != SERPT_MODE_HOSTSER)
+                        break;
+                } else
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
 static int
 open_pseudo_terminal(serial_passthrough_t *dev)
 {
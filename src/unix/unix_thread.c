@@ -3,6 +3,13 @@
 #include <time.h>
 #include <pthread.h>
 #include <inttypes.h>
+#ifdef __linux__
+#    include <limits.h>
+#    include <stdatomic.h>
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
 #include <86box/86box.h>
 #include <86box/plat.h>
 #include <86box/thread.h>
@@ -51,6 +58,101 @@ thread_wait(thread_t *arg)
     return pthread_join(*(pthread_t *) (arg), NULL);
 }
 
+#ifdef __linux__
+/* Adaptive futex-based events: the Voodoo render and FIFO threads signal
+   these thousands of times per frame, so the fast paths (setting an event
+   nobody waits on, waiting on an event that gets set within the spin
+   window) stay entirely in user space; only a genuinely idle waiter takes
+   the futex syscall. Semantics match the pthread version below: manual
+   reset, a set event wakes every waiter and stays set. */
+typedef struct event_futex_t {
+    atomic_int state;
+    atomic_int waiters;
+} event_futex_t;
+
+#    define EVENT_SPIN_COUNT 2000
+
+static inline void
+event_cpu_relax(void)
+{
+#    if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#    elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#    endif
+}
+
+static int
+event_futex(atomic_int *addr, int op, int val, const struct timespec *ts)
+{
+    return syscall(SYS_futex, addr, op, val, ts, NULL, 0);
+}
+
+event_t *
+thread_create_event(void)
+{
+    event_futex_t *event = malloc(sizeof(event_futex_t));
+
+    atomic_store(&event->state, 0);
+    atomic_store(&event->waiters, 0);
+
+    return (event_t *) event;
+}
+
+void
+thread_set_event(event_t *handle)
+{
+    event_futex_t *event = (event_futex_t *) handle;
+
+    atomic_store(&event->state, 1);
+    if (atomic_load(&event->waiters))
+        event_futex(&event->state, FUTEX_WAKE_PRIVATE, INT_MAX, NULL);
+}
+
+void
+thread_reset_event(event_t *handle)
+{
+    event_futex_t *event = (event_futex_t *) handle;
+
+    atomic_store(&event->state, 0);
+}
+
+int
+thread_wait_event(event_t *handle, int timeout)
+{
+    event_futex_t  *event = (event_futex_t *) handle;
+    struct timespec reltime;
+
+    /* Spin briefly first: at Voodoo signalling rates the event is
+       usually set again before a sleeping wait would be worth it. */
+    for (int i = 0; i < EVENT_SPIN_COUNT; i++) {
+        if (atomic_load(&event->state))
+            return 0;
+        event_cpu_relax();
+    }
+
+    reltime.tv_sec  = timeout / 1000;
+    reltime.tv_nsec = (timeout % 1000) * 1000000;
+
+    atomic_fetch_add(&event->waiters, 1);
+    while (!atomic_load(&event->state)) {
+        event_futex(&event->state, FUTEX_WAIT_PRIVATE, 0, (timeout == -1) ? NULL : &reltime);
+        if (timeout != -1)
+            break;
+    }
+    atomic_fetch_sub(&event->waiters, 1);
+
+    return 0;
+}
+
+void
+thread_destroy_event(event_t *handle)
+{
+    event_futex_t *event = (event_futex_t *) handle;
+
+    free(event);
+}
+#else
 event_t *
 thread_create_event(void)
 {
@@ -119,6 +221,7 @@ thread_destroy_event(event_t *handle)
 
     free(event);
 }
+#endif
 
 mutex_t *
 thread_create_mutex(void)
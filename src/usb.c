@@ -26,6 +26,7 @@
 #include <86box/device.h>
 #include <86box/io.h>
 #include <86box/mem.h>
+#include <86box/timer.h>
 #include <86box/usb.h>
 #include "cpu.h"
 #include <86box/plat_unused.h>
@@ -48,15 +49,31 @@ usb_log(const char *fmt, ...)
 #    define usb_log(fmt, ...)
 #endif
 
+/* The controllers are register-level dummies with no schedule walker, so
+   rather than ticking a 1 ms frame timer just to advance a counter, the
+   frame number is derived from the emulated time elapsed since the
+   controller was last started whenever the guest reads it. */
+static uint16_t
+usb_frame_count(uint64_t base_tsc, uint16_t base)
+{
+    return base + (uint16_t) ((tsc - base_tsc) / (TIMER_USEC * 1000ULL));
+}
+
 static uint8_t
 uhci_reg_read(uint16_t addr, void *priv)
 {
     const usb_t   *dev = (usb_t *) priv;
     uint8_t        ret;
     const uint8_t *regs = dev->uhci_io;
+    uint16_t       frnum;
 
     addr &= 0x0000001f;
 
+    if (((addr & 0x1e) == 0x06) && (regs[0x00] & 0x01)) {
+        frnum = usb_frame_count(dev->uhci_frame_tsc, dev->uhci_frame_base) & 0x07ff;
+        return (addr & 1) ? (frnum >> 8) : (frnum & 0xff);
+    }
+
     ret = regs[addr];
 
     return ret;
@@ -103,14 +120,23 @@ uhci_reg_writew(uint16_t addr, uint16_t val, void *priv)
 
     switch (addr) {
         case 0x00:
-            if ((val & 0x0001) && !(regs[0x00] & 0x0001))
+            if ((val & 0x0001) && !(regs[0x00] & 0x0001)) {
                 regs[0x01] &= ~0x20;
-            else if (!(val & 0x0001))
+                /* Run: rebase the lazy frame counter on FRNUM. */
+                dev->uhci_frame_tsc  = tsc;
+                dev->uhci_frame_base = regs[0x03] & 0x07ff;
+            } else if (!(val & 0x0001)) {
+                /* Stop: latch the count so FRNUM reads back frozen. */
+                if (regs[0x00] & 0x0001)
+                    regs[0x03] = usb_frame_count(dev->uhci_frame_tsc, dev->uhci_frame_base) & 0x07ff;
                 regs[0x01] |= 0x20;
+            }
             regs[0x00] = (val & 0x00ff);
             break;
         case 0x06:
-            regs[0x03] = (val & 0x07ff);
+            regs[0x03]           = (val & 0x07ff);
+            dev->uhci_frame_tsc  = tsc;
+            dev->uhci_frame_base = val & 0x07ff;
             break;
         case 0x10:
         case 0x12:
@@ -141,9 +167,16 @@ ohci_mmio_read(uint32_t addr, void *priv)
 {
     const usb_t  *dev = (usb_t *) priv;
     uint8_t       ret = 0x00;
+    uint16_t      frnum;
 
     addr &= 0x00000fff;
 
+    /* HcFmNumber while operational comes from the lazy frame counter. */
+    if (((addr & 0xffe) == 0x3c) && ((dev->ohci_mmio[0x04] & 0xc0) == 0x80)) {
+        frnum = usb_frame_count(dev->ohci_frame_tsc, dev->ohci_frame_base);
+        return (addr & 1) ? (frnum >> 8) : (frnum & 0xff);
+    }
+
     ret = dev->ohci_mmio[addr];
 
     if (addr == 0x101)
@@ -166,6 +199,16 @@ ohci_mmio_write(uint32_t addr, uint8_t val, void *priv)
                 /* UsbReset */
                 dev->ohci_mmio[0x56] = dev->ohci_mmio[0x5a] = 0x16;
             }
+            if (((val & 0xc0) == 0x80) && ((dev->ohci_mmio[0x04] & 0xc0) != 0x80)) {
+                /* UsbOperational: rebase the lazy frame counter. */
+                dev->ohci_frame_tsc  = tsc;
+                dev->ohci_frame_base = dev->ohci_mmio[0x3c] | (dev->ohci_mmio[0x3d] << 8);
+            } else if (((val & 0xc0) != 0x80) && ((dev->ohci_mmio[0x04] & 0xc0) == 0x80)) {
+                /* Leaving operational: latch HcFmNumber. */
+                uint16_t frnum       = usb_frame_count(dev->ohci_frame_tsc, dev->ohci_frame_base);
+                dev->ohci_mmio[0x3c] = frnum & 0xff;
+                dev->ohci_mmio[0x3d] = frnum >> 8;
+            }
             break;
         case 0x08: /* HCCOMMANDSTATUS */
             /* bit OwnershipChangeRequest triggers an ownership change (SMM <-> OS) */
@@ -387,6 +430,9 @@ usb_reset(void *priv)
 
     mem_mapping_disable(&dev->ohci_mmio_mapping);
     dev->ohci_enable = 0;
+
+    dev->uhci_frame_tsc = dev->ohci_frame_tsc = 0;
+    dev->uhci_frame_base = dev->ohci_frame_base = 0;
 }
 
 static void
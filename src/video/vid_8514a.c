@@ -2695,6 +2695,74 @@ rect_fill_pix:
                     }
                 } else {
 rect_fill:
+                    /* Plain solid fill - foreground color, overwrite mix, no
+                       color compare, full write mask - executed row-wise with
+                       memset/word stores instead of the per-pixel mix loop.
+                       This is the fill every GUI driver issues constantly. */
+                    if ((count == -1) && !pixcntl && ((dev->accel.multifunc[0x0a] & 6) != 4)
+                        && (mix_dat == 0xffffffff) && (frgd_mix == 1) && ((dev->accel.frgd_mix & 0x1f) == 7)
+                        && (compare_mode == 0) && (dev->accel.cmd & 0x10)
+                        && (dev->bpp ? (wrt_mask == 0xffff) : ((wrt_mask & 0xff) == 0xff))
+                        && (dev->accel.sx == (dev->accel.maj_axis_pcnt & 0x7ff))) {
+                        while (dev->accel.sy >= 0) {
+                            int x0 = (dev->accel.cmd & 0x20) ? dev->accel.cx : (dev->accel.cx - dev->accel.sx);
+                            int x1 = (dev->accel.cmd & 0x20) ? (dev->accel.cx + dev->accel.sx) : dev->accel.cx;
+
+                            if (x0 < dev->accel.clip_left)
+                                x0 = dev->accel.clip_left;
+                            if (x1 > clip_r)
+                                x1 = clip_r;
+
+                            if ((dev->accel.cy >= dev->accel.clip_top) && (dev->accel.cy <= clip_b) && (x0 <= x1)) {
+                                uint32_t fill_addr = dev->accel.dest + x0;
+                                int      fill_len  = (x1 - x0) + 1;
+
+                                if (dev->bpp) {
+                                    fill_addr &= (dev->vram_mask >> 1);
+                                    if ((fill_addr + fill_len) <= ((uint32_t) (dev->vram_mask >> 1) + 1)) {
+                                        for (int i = 0; i < fill_len; i++)
+                                            vram_w[fill_addr + i] = frgd_color;
+                                        for (uint32_t page = (fill_addr >> 11); page <= ((fill_addr + fill_len - 1) >> 11); page++)
+                                            dev->changedvram[page] = changeframecount;
+                                    } else {
+                                        for (int i = 0; i < fill_len; i++) {
+                                            WRITE(dev->accel.dest + x0 + i, frgd_color);
+                                        }
+                                    }
+                                } else {
+                                    fill_addr &= dev->vram_mask;
+                                    if ((fill_addr + fill_len) <= ((uint32_t) dev->vram_mask + 1)) {
+                                        memset(&dev->vram[fill_addr], frgd_color & 0xff, fill_len);
+                                        for (uint32_t page = (fill_addr >> 12); page <= ((fill_addr + fill_len - 1) >> 12); page++)
+                                            dev->changedvram[page] = changeframecount;
+                                    } else {
+                                        for (int i = 0; i < fill_len; i++) {
+                                            WRITE(dev->accel.dest + x0 + i, frgd_color);
+                                        }
+                                    }
+                                }
+                            }
+
+                            dev->accel.fill_state = 0;
+
+                            if (dev->accel.cmd & 0x80)
+                                dev->accel.cy++;
+                            else
+                                dev->accel.cy--;
+
+                            if (((dev->local & 0xff) >= 0x02) && dev->accel.ge_offset && ((dev->accel_bpp == 24) || (dev->accel_bpp == 8)))
+                                dev->accel.dest = (dev->accel.ge_offset << 2) + (dev->accel.cy * dev->pitch);
+                            else
+                                dev->accel.dest = dev->accel.cy * dev->pitch;
+
+                            dev->accel.sy--;
+                        }
+
+                        dev->accel.cur_x = dev->accel.cx;
+                        dev->accel.cur_y = dev->accel.cy;
+                        return;
+                    }
+
                     if (pixcntl == 1) {
                         if (dev->accel.cmd & 0x40) {
                             count               = dev->accel.maj_axis_pcnt + 1;
@@ -150,6 +150,8 @@ cga_pravetz_out(UNUSED(uint16_t addr), uint8_t val, void *priv)
     cga_t *cga = (cga_t *) priv;
 
     cga->fontbase = (((unsigned int) val) << 8);
+    if (cga->linecache)
+        linecache_invalidate(cga->linecache);
 }
 
 uint8_t
@@ -217,6 +219,77 @@ cga_recalctimings(cga_t *cga)
     _dispofftime     = _dispofftime * CGACONST;
     cga->dispontime  = (uint64_t) (_dispontime);
     cga->dispofftime = (uint64_t) (_dispofftime);
+
+    /* Mode, colour or CRTC changes can affect every line. */
+    if (cga->linecache)
+        linecache_invalidate(cga->linecache);
+}
+
+/* Snapshot everything this scanline's pixels derive from and compare against
+   the previous frame; returns whether the line has to be rendered.  The ma
+   walk mirrors cga_render exactly so cursor comparisons match. */
+static int
+cga_line_changed(cga_t *cga)
+{
+    uint32_t cells[LINECACHE_COLS];
+    uint16_t ca = (cga->crtc[15] | (cga->crtc[14] << 8)) & 0x3fff;
+    uint16_t ma = cga->ma;
+    uint32_t key;
+    int      ncells = 0;
+    uint8_t  chr;
+    uint8_t  attr;
+
+    /* Composite output is processed outside our view - always render.  Cards
+       embedding cga_t never allocate the cache (see vid_cga.h). */
+    if (!cga->linecache || cga->composite)
+        return 1;
+
+    key = (cga->sc & 31) | (cga->cgamode << 8) | (cga->cgacol << 16)
+        | ((!!cga->cgadispon) << 24) | ((!!cga->drawcursor) << 25);
+
+    if (cga->cgadispon) {
+        if (cga->crtc[1] > LINECACHE_COLS) {
+            cga->linecache->dirty = 1;
+            return 1;
+        }
+        ncells = cga->crtc[1];
+        if (cga->cgamode & 1) { /* 80-column text (snow lands in charbuffer) */
+            for (int x = 0; x < ncells; x++) {
+                if (cga->cgamode & 8) {
+                    chr  = cga->charbuffer[x << 1];
+                    attr = cga->charbuffer[(x << 1) + 1];
+                } else
+                    chr = attr = 0;
+                cells[x] = chr | (attr << 8)
+                    | ((((ma + x) == ca) && cga->con && cga->cursoron) ? (1 << 16) : 0)
+                    | (((cga->cgablink & 8) && (cga->cgamode & 0x20) && (attr & 0x80)) ? (1 << 17) : 0);
+            }
+        } else if (!(cga->cgamode & 2)) { /* 40-column text */
+            for (int x = 0; x < ncells; x++) {
+                if (cga->cgamode & 8) {
+                    chr  = cga->vram[(ma << 1) & 0x3fff];
+                    attr = cga->vram[((ma << 1) + 1) & 0x3fff];
+                } else
+                    chr = attr = 0;
+                cells[x] = chr | (attr << 8)
+                    | (((ma == ca) && cga->con && cga->cursoron) ? (1 << 16) : 0)
+                    | (((cga->cgablink & 8) && (cga->cgamode & 0x20) && (attr & 0x80)) ? (1 << 17) : 0);
+                ma++;
+            }
+        } else { /* graphics */
+            for (int x = 0; x < ncells; x++) {
+                if (cga->cgamode & 8)
+                    cells[x] = (cga->vram[((ma << 1) & 0x1fff) + ((cga->sc & 1) * 0x2000)] << 8)
+                        | cga->vram[((ma << 1) & 0x1fff) + ((cga->sc & 1) * 0x2000) + 1];
+                else
+                    cells[x] = 0;
+                ma++;
+            }
+        }
+    } else
+        cells[ncells++] = cga->crtc[1]; /* border width of the blank line */
+
+    return linecache_line_changed(cga->linecache, cga->displine, key, cells, ncells);
 }
 
 static void
@@ -488,6 +561,7 @@ cga_poll(void *priv)
     int      xs_temp;
     int      ys_temp;
     int      old_ma;
+    int      line_changed;
 
     if (!cga->linepos) {
         timer_advance_u64(&cga->timer, cga->dispofftime);
@@ -496,13 +570,14 @@ cga_poll(void *priv)
         oldsc        = cga->sc;
         if ((cga->crtc[8] & 3) == 3)
             cga->sc = ((cga->sc << 1) + cga->oddeven) & 7;
+        line_changed = cga_line_changed(cga);
         if (cga->cgadispon) {
             if (cga->displine < cga->firstline) {
                 cga->firstline = cga->displine;
                 video_wait_for_buffer();
             }
             cga->lastline = cga->displine;
-            switch (cga->double_type) {
+            if (line_changed) switch (cga->double_type) {
                 default:
                     cga_render(cga, cga->displine << 1);
                     cga_render_blank(cga, (cga->displine << 1) + 1);
@@ -516,8 +591,11 @@ cga_poll(void *priv)
                     cga->ma = old_ma;
                     cga_render(cga, (cga->displine << 1) + 1);
                     break;
-            }
-        } else {
+            } else
+                /* The target buffer still holds this line's final pixels;
+                   advance ma exactly as the render would have. */
+                cga->ma += cga->crtc[1];
+        } else if (line_changed) {
             switch (cga->double_type) {
                 default:
                     cga_render_blank(cga, cga->displine << 1);
@@ -532,7 +610,7 @@ cga_poll(void *priv)
             }
         }
 
-        switch (cga->double_type) {
+        if (line_changed) switch (cga->double_type) {
             default:
                 cga_render_process(cga, cga->displine << 1);
                 cga_render_process(cga, (cga->displine << 1) + 1);
@@ -638,8 +716,17 @@ cga_poll(void *priv)
 
                             if (video_force_resize_get())
                                 video_force_resize_set(0);
+
+                            if (cga->linecache) {
+                                linecache_invalidate(cga->linecache);
+                                cga->linecache->dirty = 1;
+                            }
                         }
 
+                        if (cga->linecache && !cga->linecache->dirty &&
+                            !monitors[monitor_index_global].mon_screenshots)
+                            goto blit_skipped;
+
                         if (cga->double_type > DOUBLE_NONE) {
                             if (enable_overscan)
                                 cga_blit_memtoscreen(cga, 0, (cga->firstline - 4) << 1,
@@ -655,6 +742,9 @@ cga_poll(void *priv)
                                 video_blit_memtoscreen(8, cga->firstline,
                                                        xsize, cga->lastline - cga->firstline);
                         }
+blit_skipped:
+                        if (cga->linecache)
+                            cga->linecache->dirty = 0;
                     }
 
                     frames++;
@@ -734,6 +824,8 @@ cga_standalone_init(UNUSED(const device_t *info))
 
     cga->double_type = device_get_config_int("double_type");
 
+    cga->linecache = linecache_alloc();
+
     for (uint16_t i = 0; i < 256; i++) {
         for (uint16_t j = 0; j < 256; j++) {
             interp_lut[0][i][j] = cga_interpolate_srgb(i, j, 0.5);
@@ -764,6 +856,8 @@ cga_close(void *priv)
 {
     cga_t *cga = (cga_t *) priv;
 
+    if (cga->linecache)
+        linecache_free(cga->linecache);
     free(cga->vram);
     free(cga);
 }
@@ -75,14 +75,17 @@ double mode_hue;
 double min_v;
 double max_v;
 
-double video_ri;
-double video_rq;
-double video_gi;
-double video_gq;
-double video_bi;
-double video_bq;
-int    video_sharpness;
-int    tandy_mode_control = 0;
+/* The decode coefficients are integers - keeping them that way makes the
+   per-sample convolution below all-integer instead of promoting every
+   multiply to double. */
+int video_ri;
+int video_rq;
+int video_gi;
+int video_gq;
+int video_bi;
+int video_bq;
+int video_sharpness;
+int tandy_mode_control = 0;
 
 static bool new_cga = 0;
 
@@ -231,9 +234,13 @@ Composite_Process(uint8_t cgamode, uint8_t border, uint32_t blocks /*, bool doub
     b    = &CGA_Composite_Table[border * 68];
     for (uint8_t x = 0; x < 4; ++x)
         OUT(b[(x + 3) & 3]);
-    OUT(CGA_Composite_Table[(border << 6) | ((*rgbi & 0x0f) << 2) | 3]);
+    /* Each sample reuses the previous sample's right pixel as its left
+       pixel, so carry the table index over instead of remasking both. */
+    x2 = (border << 6) | ((*rgbi & 0x0f) << 2);
+    OUT(CGA_Composite_Table[x2 | 3]);
     for (int x = 0; x < w - 1; ++x) {
-        OUT(CGA_Composite_Table[((rgbi[0] & 0x0f) << 6) | ((rgbi[1] & 0x0f) << 2) | (x & 3)]);
+        x2 = ((x2 << 4) & 0x3c0) | ((rgbi[1] & 0x0f) << 2);
+        OUT(CGA_Composite_Table[x2 | (x & 3)]);
         ++rgbi;
     }
     OUT(CGA_Composite_Table[((*rgbi & 0x0f) << 6) | (border << 2) | 3]);
@@ -865,6 +865,7 @@ chips_69000_recalc_banking(chips_69000_t *chips)
     svga->chain2_write = !(svga->seqregs[0x4] & 4);
     svga->chain4       = (svga->seqregs[0x4] & 8) || (chips->ext_regs[0xA] & 0x4);
     svga->fast         = (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && !svga->gdcreg[1]) && ((svga->chain4 && (svga->packed_chain4 || svga->force_old_addr)) || svga->fb_only) && !(svga->adv_flags & FLAG_ADDR_BY8);
+    svga_recalc_write_handler(svga);
 
     if (chips->ext_regs[0xA] & 1) {
         chips->svga.read_bank = chips->svga.write_bank = 0x10000 * (chips->ext_regs[0xE] & 0x7f);
@@ -1096,6 +1097,161 @@ advance:
 
 void chips_69000_bitblt_write(chips_69000_t* chips, uint8_t data);
 
+/* Returns the VRAM offset of a len-byte linear span, or -1 if any part of it
+   leaves plain VRAM (BitBLT MMIO aperture, aperture wrap, decode mask, or
+   past the end of VRAM), in which case the batch path cannot stand in for
+   the per-byte accessors.  Assumes svga->fast. */
+static int32_t
+chips_69000_batch_span(chips_69000_t* chips, uint32_t addr, uint32_t len)
+{
+    svga_t *svga = &chips->svga;
+    uint32_t offs = addr & 0x1FFFFF;
+
+    if ((addr & 0x400000) || ((addr ^ (addr + len - 1)) & ~0x3FFFFF))
+        return -1;
+    if (((offs + len - 1) & ~svga->decode_mask) || ((offs + len) > svga->vram_max))
+        return -1;
+    if ((offs + len) > (svga->vram_mask + 1))
+        return -1;
+
+    return (int32_t) offs;
+}
+
+/* ROPs whose result does not involve the source operand; for these the
+   source/destination overlap does not constrain the copy order. */
+static int
+chips_69000_rop_ignores_source(uint8_t rop)
+{
+    switch (rop) {
+        case 0x00: case 0x0F: case 0x50: case 0x55: case 0x5A: case 0x5F:
+        case 0xA0: case 0xA5: case 0xAA: case 0xAF: case 0xF0: case 0xF5:
+        case 0xFA: case 0xFF:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/* ROPs the patterned helpers implement; anything else must go through the
+   per-pixel path so its "Unknown ROP" log keeps its per-pixel cadence. */
+static int
+chips_69000_batch_rop_known(uint8_t rop)
+{
+    if ((rop & 0xF) == ((rop >> 4) & 0xF))
+        return 1;
+
+    switch (rop) {
+        case 0x05: case 0x0A: case 0x0F: case 0x1A: case 0x2A: case 0x3A:
+        case 0x4A: case 0x50: case 0x5A: case 0x5F: case 0x6A: case 0x7A:
+        case 0x8A: case 0x9A: case 0xA0: case 0xA5: case 0xAC: case 0xAF:
+        case 0xB8: case 0xBA: case 0xCA: case 0xDA: case 0xE2: case 0xEA:
+        case 0xF0: case 0xF5: case 0xFA:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/* Execute a whole rectangular BitBLT or pattern fill in one pass with
+   row-wide inner loops, instead of driving chips_69000_process_pixel() per
+   pixel.  All the ROPs are bitwise, so applying them byte by byte along a
+   row is exact at any depth.  Returns 0 without touching any state whenever
+   the per-pixel machinery could behave differently - colour keying,
+   per-pixel pattern write-masking, accesses that leave plain VRAM, or a
+   source-dependent ROP on overlapping spans - and the stepwise engine runs
+   instead. */
+static int
+chips_69000_bitblt_batch(chips_69000_t* chips)
+{
+    svga_t *svga = &chips->svga;
+    const uint32_t control = chips->bitblt_running.bitblt.bitblt_control;
+    const uint8_t rop = control & 0xFF;
+    const int bpp = chips->bitblt_running.bytes_per_pixel;
+    const int w = MAX((int) chips->bitblt_running.actual_destination_width, 1);
+    const int h = MAX((int) chips->bitblt_running.actual_destination_height, 1);
+    const uint32_t len = w * bpp;
+    const uint32_t lead = (chips->bitblt_running.x_dir == 1) ? 0 : (len - bpp);
+    int pattern_solid = 0;
+    int ignores_src;
+    uint8_t pat_bytes[3] = { 0, 0, 0 };
+    int32_t d_off;
+    int32_t s_off;
+    int cy;
+    uint32_t i;
+
+    if (!svga->fast || (bpp < 1) || (bpp > 3))
+        return 0;
+
+    if (control & (1 << 14)) /* colour/transparency keying */
+        return 0;
+
+    if (control & (1 << 18)) {
+        if (control & (1 << 19)) {
+            /* Solid pattern: every pixel expands to the background colour.
+               (All three of bits 17-19 together never get here, the setup
+               code completes those blits without drawing.) */
+            pattern_solid = 1;
+            pat_bytes[0] = chips->bitblt_running.bitblt.pattern_source_key_bg & 0xFF;
+            pat_bytes[1] = (chips->bitblt_running.bitblt.pattern_source_key_bg >> 8) & 0xFF;
+            pat_bytes[2] = (chips->bitblt_running.bitblt.pattern_source_key_bg >> 16) & 0xFF;
+            if (!chips_69000_batch_rop_known(rop))
+                return 0;
+        } else {
+            if (control & (1 << 17)) /* per-pixel write-masking */
+                return 0;
+            if ((rop & 0xF) != ((rop >> 4) & 0xF))
+                return 0; /* The ROP actually uses the pattern bits. */
+            if ((chips->bitblt_running.bitblt.pat_addr | (chips->bitblt_running.bitblt.pat_addr + 0xFF)) & 0x400000)
+                return 0; /* Skipped pattern fetches must not touch MMIO. */
+        }
+    } else {
+        /* Colour pattern: only batched when the ROP ignores it. */
+        if ((rop & 0xF) != ((rop >> 4) & 0xF))
+            return 0;
+        if ((chips->bitblt_running.bitblt.pat_addr | (chips->bitblt_running.bitblt.pat_addr + 0xFF)) & 0x400000)
+            return 0;
+    }
+
+    ignores_src = chips_69000_rop_ignores_source(rop);
+
+    /* Validate every row up front so a fallback writes nothing. */
+    for (cy = 0; cy < h; cy++) {
+        const int y = chips->bitblt_running.y_dir * cy;
+
+        d_off = chips_69000_batch_span(chips, chips->bitblt_running.bitblt.destination_addr + (y * chips->bitblt_running.bitblt.destination_span) - lead, len);
+        s_off = chips_69000_batch_span(chips, chips->bitblt_running.bitblt.source_addr + (y * chips->bitblt.source_span) - lead, len);
+        if ((d_off < 0) || (s_off < 0))
+            return 0;
+        if (!ignores_src && (d_off < (s_off + (int32_t) len)) && (s_off < (d_off + (int32_t) len)))
+            return 0;
+    }
+
+    for (cy = 0; cy < h; cy++) {
+        const int y = chips->bitblt_running.y_dir * cy;
+        uint8_t *dst;
+
+        d_off = chips_69000_batch_span(chips, chips->bitblt_running.bitblt.destination_addr + (y * chips->bitblt_running.bitblt.destination_span) - lead, len);
+        s_off = chips_69000_batch_span(chips, chips->bitblt_running.bitblt.source_addr + (y * chips->bitblt.source_span) - lead, len);
+        dst = &svga->vram[d_off];
+
+        if (rop == 0xCC)
+            memcpy(dst, &svga->vram[s_off], len);
+        else if (pattern_solid && (rop == 0xF0))
+            for (i = 0; i < len; i++)
+                dst[i] = pat_bytes[i % bpp];
+        else {
+            const uint8_t *src = &svga->vram[s_off];
+            for (i = 0; i < len; i++)
+                chips_69000_do_rop_8bpp_patterned(&dst[i], pat_bytes[i % bpp], ignores_src ? 0 : src[i], rop);
+        }
+
+        for (i = d_off >> 12; i <= (((uint32_t) d_off + len - 1) >> 12); i++)
+            svga->changedvram[i] = svga->monitor->mon_changeframecount;
+    }
+
+    return 1;
+}
+
 void
 chips_69000_setup_bitblt(chips_69000_t* chips)
 {
@@ -1269,6 +1425,12 @@ chips_69000_setup_bitblt(chips_69000_t* chips)
         return;
     }
 
+    if (chips_69000_bitblt_batch(chips)) {
+        cycles = orig_cycles;
+        chips_69000_bitblt_interrupt(chips);
+        return;
+    }
+
     do {
         do {
             uint32_t pixel = 0;
@@ -665,6 +665,8 @@ gd54xx_set_svga_fast(gd54xx_t *gd54xx)
         svga->fast = ((svga->gdcreg[8] == 0xff) && !(svga->gdcreg[3] & 0x18) &&
                      !svga->gdcreg[1]) && ((svga->chain4 && svga->packed_chain4) ||
                      svga->fb_only);
+
+    svga_recalc_write_handler(svga);
 }
 
 static void
@@ -709,6 +711,7 @@ gd54xx_out(uint16_t addr, uint8_t val, void *priv)
                         svga_recalctimings(svga);
                 } else if (svga->attraddr == 0x11) {
                     if (!(svga->seqregs[0x12] & 0x80)) {
+                        svga_pallook_flush(svga);
                         svga->overscan_color = svga->pallook[svga->attrregs[0x11]];
                         if (o != val)
                             svga_recalctimings(svga);
@@ -788,8 +791,10 @@ gd54xx_out(uint16_t addr, uint8_t val, void *priv)
                         svga->ext_overscan = !!(val & 0x80);
                         if (svga->ext_overscan && (svga->crtc[0x27] >= CIRRUS_ID_CLGD5426))
                             svga->overscan_color = gd54xx->extpallook[2];
-                        else
+                        else {
+                            svga_pallook_flush(svga);
                             svga->overscan_color = svga->pallook[svga->attrregs[0x11]];
+                        }
                         svga_recalctimings(svga);
                         svga->hwcursor.ena = val & CIRRUS_CURSOR_SHOW;
                         if (svga->crtc[0x27] >= CIRRUS_ID_CLGD5422)
@@ -970,6 +975,9 @@ gd54xx_out(uint16_t addr, uint8_t val, void *priv)
                             }
                             svga->seqregs[2] &= 0x0f;
                         }
+                        /* The write mode (and possibly set/reset) changed
+                           outside the standard GDC path. */
+                        svga_recalc_write_handler(svga);
                         fallthrough;
                     case 0x09:
                     case 0x0a:
@@ -3577,6 +3585,53 @@ gd54xx_mem_sys_src(gd54xx_t *gd54xx, uint32_t cpu_dat, uint32_t count)
     }
 }
 
+/* Whole-rectangle fast path for register-started VRAM to VRAM copies - the
+   per-byte loop below only pays off when the ROP or transparency actually
+   has to look at every pixel. Returns 0 if the blit needs the stepwise path. */
+static int
+gd54xx_normal_blit_batched(gd54xx_t *gd54xx, svga_t *svga)
+{
+    uint32_t src_addr = gd54xx->blt.src_addr;
+    uint32_t dst_addr = gd54xx->blt.dst_addr;
+    uint32_t len      = gd54xx->blt.width + 1;
+    uint32_t src_row;
+    uint32_t dst_row;
+
+    if (gd54xx->blt.mode & (CIRRUS_BLTMODE_COLOREXPAND | CIRRUS_BLTMODE_TRANSPARENTCOMP))
+        return 0;
+    if ((gd54xx->blt.rop != 0x0d) || (gd54xx->blt.pattern_x > 0))
+        return 0;
+
+    for (uint16_t y = 0; y <= gd54xx->blt.height; y++) {
+        src_addr &= gd54xx->vram_mask;
+        dst_addr &= gd54xx->vram_mask;
+
+        /* In backwards mode the addresses point at the last byte of the row. */
+        src_row = (gd54xx->blt.dir < 0) ? (src_addr - (len - 1)) : src_addr;
+        dst_row = (gd54xx->blt.dir < 0) ? (dst_addr - (len - 1)) : dst_addr;
+
+        if (((src_row + len - 1) <= gd54xx->vram_mask) && ((dst_row + len - 1) <= gd54xx->vram_mask)) {
+            memmove(&svga->vram[dst_row], &svga->vram[src_row], len);
+            for (uint32_t page = dst_row >> 12; page <= ((dst_row + len - 1) >> 12); page++)
+                svga->changedvram[page] = changeframecount;
+        } else {
+            /* Row wraps around the end of VRAM - copy it a byte at a time. */
+            for (uint32_t x = 0; x < len; x++) {
+                uint32_t dst_pos = (dst_addr + (x * gd54xx->blt.dir)) & gd54xx->vram_mask;
+
+                svga->vram[dst_pos]                = svga->vram[(src_addr + (x * gd54xx->blt.dir)) & gd54xx->vram_mask];
+                svga->changedvram[dst_pos >> 12] = changeframecount;
+            }
+        }
+
+        src_addr += gd54xx->blt.src_pitch * gd54xx->blt.dir;
+        dst_addr += gd54xx->blt.dst_pitch * gd54xx->blt.dir;
+    }
+
+    gd54xx_reset_blit(gd54xx);
+    return 1;
+}
+
 static void
 gd54xx_normal_blit(uint32_t count, gd54xx_t *gd54xx, svga_t *svga)
 {
@@ -3589,6 +3644,11 @@ gd54xx_normal_blit(uint32_t count, gd54xx_t *gd54xx, svga_t *svga)
     uint32_t src_addr = gd54xx->blt.src_addr;
     uint32_t dst_addr = gd54xx->blt.dst_addr;
 
+    /* A count of 0xffffffff means the rectangle is fully specified by the
+       blitter registers, so it can be executed as one batch. */
+    if ((count == 0xffffffff) && gd54xx_normal_blit_batched(gd54xx, svga))
+        return;
+
     x_max = gd54xx->blt.pixel_width << 3;
 
     gd54xx->blt.dst_addr_backup = gd54xx->blt.dst_addr;
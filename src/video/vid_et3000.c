@@ -242,6 +242,7 @@ et3000_out(uint16_t addr, uint8_t val, void *priv)
                 svga->fast         = (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) &&
                                      !svga->gdcreg[1]) && svga->chain4 &&
                                      !(svga->adv_flags & FLAG_ADDR_BY8);
+                svga_recalc_write_handler(svga);
                 return;
             }
 #ifdef ENABLE_ET3000_LOG
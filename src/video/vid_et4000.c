@@ -290,6 +290,7 @@ et4000_out(uint16_t addr, uint8_t val, void *priv)
                     if (old != val)
                         svga_recalctimings(svga);
                 } else if (svga->attraddr == 0x11) {
+                    svga_pallook_flush(svga);
                     svga->overscan_color = svga->pallook[svga->attrregs[0x11]];
                     if (old != val)
                         svga_recalctimings(svga);
@@ -309,6 +310,7 @@ et4000_out(uint16_t addr, uint8_t val, void *priv)
                 svga->chain2_write = !(val & 4);
                 svga->chain4       = (svga->chain4 & ~8) | (val & 8);
                 svga->fast         = (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && !svga->gdcreg[1]) && svga->chain4 && !(svga->adv_flags & FLAG_ADDR_BY8);
+                svga_recalc_write_handler(svga);
                 return;
             } else if (svga->seqaddr == 0x0e) {
                 svga->seqregs[0x0e] = val;
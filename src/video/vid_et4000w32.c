@@ -51,6 +51,9 @@
 #define ACL_XYST                               4
 #define ACL_SSO                                8
 
+/* Depth of the deferred XY operation queue. */
+#define ACL_DEFER_FIFO                         16
+
 enum {
     ET4000W32,
     ET4000W32I,
@@ -81,7 +84,7 @@ typedef struct et4000w32p_t {
 
     /* Accelerator */
     struct {
-        struct {
+        struct et4000w32p_acl_regs {
             uint8_t vbus, pixel_depth, xy_dir, pattern_wrap,
                 source_wrap, ctrl_routing, ctrl_reload, rop_fg,
                 rop_bg;
@@ -93,6 +96,12 @@ typedef struct et4000w32p_t {
             uint32_t pattern_addr, source_addr, dest_addr, mix_addr;
         } queued, internal;
 
+        /* Fully register-fed XY operations are queued here at trigger time
+           and drained in one batch at the next point the guest can observe
+           their effect. */
+        struct et4000w32p_acl_regs defer[ACL_DEFER_FIFO];
+        int                        defer_count;
+
         uint8_t  suspend_terminate, osr;
         uint8_t  status;
         uint16_t x_count, y_count;
@@ -681,6 +690,183 @@ et4000w32p_recalcmapping(et4000w32p_t *et4000)
         mem_mapping_disable(&svga->mapping);
 }
 
+/* Drain the deferred XY operation queue.  Each entry replays exactly the
+   register-triggered path: the per-operation snapshot is restored into both
+   register sets (et4000w32p_blit_start() peeks at the queued copy), the blit
+   runs to completion, and the live queued registers are put back afterwards.
+   Nothing the guest can observe happens between trigger and drain, so the
+   end state matches synchronous execution. */
+static void
+et4000w32p_acl_drain(et4000w32p_t *et4000)
+{
+    struct et4000w32p_acl_regs live;
+
+    if (!et4000->acl.defer_count)
+        return;
+
+    live = et4000->acl.queued;
+
+    for (int i = 0; i < et4000->acl.defer_count; i++) {
+        et4000->acl.queued   = et4000->acl.defer[i];
+        et4000->acl.internal = et4000->acl.defer[i];
+        if (et4000->type >= ET4000W32P_REVC) {
+            et4000w32p_blit_start(et4000);
+            if (!(et4000->acl.queued.ctrl_routing & 0x43))
+                et4000w32p_blit(0xffffff, ~0, 0, 0, et4000);
+            if ((et4000->acl.queued.ctrl_routing & 0x40) && !(et4000->acl.internal.ctrl_routing & 3))
+                et4000w32p_blit(4, ~0, 0, 0, et4000);
+        } else {
+            et4000w32_blit_start(et4000);
+            et4000->acl.cpu_input_num = 0;
+            et4000->acl.mmu_start     = 1;
+            et4000w32_blit(-1, 0, 0, 0xffffffff, et4000);
+        }
+    }
+
+    et4000->acl.defer_count = 0;
+    et4000->acl.queued      = live;
+}
+
+/* Queue the XY operation just triggered by the destination address write;
+   returns 0 when it expects CPU data and must instead start synchronously. */
+static int
+et4000w32p_acl_defer(et4000w32p_t *et4000)
+{
+    if (et4000->type >= ET4000W32P_REVC) {
+        if (et4000->acl.queued.ctrl_routing & 3)
+            return 0;
+    } else {
+        if (et4000->acl.queued.ctrl_routing & 0x37)
+            return 0;
+    }
+
+    if (et4000->acl.defer_count == ACL_DEFER_FIFO)
+        et4000w32p_acl_drain(et4000);
+
+    et4000->acl.defer[et4000->acl.defer_count++] = et4000->acl.queued;
+
+    return 1;
+}
+
+/* Framebuffer accesses must observe deferred accelerator operations, so the
+   banked and linear mappings go through these wrappers, which drain the
+   queue before falling through to the stock SVGA handlers. */
+static uint8_t
+et4000w32p_read(uint32_t addr, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    return svga_read(addr, priv);
+}
+
+static uint16_t
+et4000w32p_readw(uint32_t addr, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    return svga_readw(addr, priv);
+}
+
+static uint32_t
+et4000w32p_readl(uint32_t addr, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    return svga_readl(addr, priv);
+}
+
+static void
+et4000w32p_write(uint32_t addr, uint8_t val, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    svga_write(addr, val, priv);
+}
+
+static void
+et4000w32p_writew(uint32_t addr, uint16_t val, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    svga_writew(addr, val, priv);
+}
+
+static void
+et4000w32p_writel(uint32_t addr, uint32_t val, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    svga_writel(addr, val, priv);
+}
+
+static uint8_t
+et4000w32p_read_linear(uint32_t addr, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    return svga_read_linear(addr, priv);
+}
+
+static uint16_t
+et4000w32p_readw_linear(uint32_t addr, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    return svga_readw_linear(addr, priv);
+}
+
+static uint32_t
+et4000w32p_readl_linear(uint32_t addr, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    return svga_readl_linear(addr, priv);
+}
+
+static void
+et4000w32p_write_linear(uint32_t addr, uint8_t val, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    svga_write_linear(addr, val, priv);
+}
+
+static void
+et4000w32p_writew_linear(uint32_t addr, uint16_t val, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    svga_writew_linear(addr, val, priv);
+}
+
+static void
+et4000w32p_writel_linear(uint32_t addr, uint32_t val, void *priv)
+{
+    svga_t *svga = (svga_t *) priv;
+
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+    svga_writel_linear(addr, val, priv);
+}
+
+/* Bound the latency of deferred operations to one frame so the raster never
+   lags a burst the guest has stopped touching. */
+static void
+et4000w32p_vblank_start(svga_t *svga)
+{
+    et4000w32p_acl_drain((et4000w32p_t *) svga->priv);
+}
+
 static void
 et4000w32p_accel_write_fifo(et4000w32p_t *et4000, uint32_t addr, uint8_t val)
 {
@@ -784,6 +970,11 @@ et4000w32p_accel_write_fifo(et4000w32p_t *et4000, uint32_t addr, uint8_t val)
             break;
         case 0xa3:
             et4000->acl.queued.dest_addr = (et4000->acl.queued.dest_addr & 0x00ffffff) | (val << 24);
+            if (et4000w32p_acl_defer(et4000))
+                break;
+            /* The operation wants CPU data: run everything queued ahead of
+               it, then start it synchronously as before. */
+            et4000w32p_acl_drain(et4000);
             et4000->acl.internal = et4000->acl.queued;
             if (et4000->type >= ET4000W32P_REVC) {
                 et4000w32p_blit_start(et4000);
@@ -918,6 +1109,7 @@ et4000w32p_mmu_write(uint32_t addr, uint8_t val, void *priv)
         case 0x0000: /* MMU 0 */
         case 0x2000: /* MMU 1 */
         case 0x4000: /* MMU 2 */
+            et4000w32p_acl_drain(et4000);
             et4000->bank = (addr >> 13) & 3;
             if (et4000->mmu.ctrl & (1 << et4000->bank)) {
                 et4000w32p_accel_write_mmu(et4000, addr & 0x7fff, val, et4000->bank);
@@ -932,6 +1124,9 @@ et4000w32p_mmu_write(uint32_t addr, uint8_t val, void *priv)
             if ((addr & 0xff) >= 0x80) {
                 et4000w32p_accel_write_fifo(et4000, addr & 0x7fff, val);
             } else {
+                /* MMU base/control writes change how queued operations
+                   would execute, so they may not overtake them. */
+                et4000w32p_acl_drain(et4000);
                 switch (addr & 0xff) {
                     case 0x00:
                         et4000->mmu.base[0] = (et4000->mmu.base[0] & 0xffffff00) | val;
@@ -997,6 +1192,11 @@ et4000w32p_mmu_read(uint32_t addr, void *priv)
     const svga_t *svga   = &et4000->svga;
     uint8_t       temp;
 
+    /* Reads are how the guest synchronises with the accelerator: the status
+       register, the internal register file and the aperture must all show
+       every queued operation completed. */
+    et4000w32p_acl_drain(et4000);
+
     switch (addr & 0x6000) {
         case 0x0000: /* MMU 0 */
         case 0x2000: /* MMU 1 */
@@ -2838,8 +3038,12 @@ et4000w32p_init(const device_t *info)
     if (info->flags & DEVICE_PCI)
         mem_mapping_disable(&et4000->bios_rom.mapping);
 
-    mem_mapping_add(&et4000->linear_mapping, 0, 0, svga_read_linear, svga_readw_linear, svga_readl_linear, svga_write_linear, svga_writew_linear, svga_writel_linear, NULL, MEM_MAPPING_EXTERNAL, &et4000->svga);
+    mem_mapping_add(&et4000->linear_mapping, 0, 0, et4000w32p_read_linear, et4000w32p_readw_linear, et4000w32p_readl_linear, et4000w32p_write_linear, et4000w32p_writew_linear, et4000w32p_writel_linear, NULL, MEM_MAPPING_EXTERNAL, &et4000->svga);
     mem_mapping_add(&et4000->mmu_mapping, 0, 0, et4000w32p_mmu_read, NULL, NULL, et4000w32p_mmu_write, NULL, NULL, NULL, MEM_MAPPING_EXTERNAL, et4000);
+    mem_mapping_set_handler(&et4000->svga.mapping,
+                            et4000w32p_read, et4000w32p_readw, et4000w32p_readl,
+                            et4000w32p_write, et4000w32p_writew, et4000w32p_writel);
+    et4000->svga.vblank_start = et4000w32p_vblank_start;
 
     et4000w32p_io_set(et4000);
 
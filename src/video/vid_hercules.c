@@ -51,6 +51,10 @@ recalc_timings(hercules_t *dev)
 
     dev->dispontime  = (uint64_t) (_dispontime);
     dev->dispofftime = (uint64_t) (_dispofftime);
+
+    /* Every register change that lands here may also have redefined what
+       the scanlines put on screen - drop the line snapshots. */
+    dev->line_gen++;
 }
 
 static uint8_t crtcmask[32] = {
@@ -214,6 +218,12 @@ hercules_write(uint32_t addr, uint8_t val, void *priv)
 
     dev->vram[addr] = val;
 
+    /* Text cell changes are caught by the per-cell snapshot compare; in
+       graphics mode the scanlines derive from raw VRAM, so invalidate the
+       line snapshots instead. */
+    if (dev->ctrl & 0x02)
+        dev->line_gen++;
+
     hercules_waitstates(dev);
 }
 
@@ -275,6 +285,61 @@ hercules_render_overscan_right(hercules_t *dev)
         buffer32->line[dev->displine + 14][8 + width + i] = 0x00000000;
 }
 
+/* Compare (and stamp) the snapshot of everything this scanline's pixels
+   derive from.  Returns nonzero when the line must be rendered; zero means
+   the target buffer still holds the line's final pixels from the previous
+   frame, including palette conversion and blending. */
+static int
+hercules_line_changed(hercules_t *dev, uint16_t ca)
+{
+    int      line = dev->displine + 14;
+    uint32_t key;
+    uint32_t tuple;
+    uint16_t ma;
+    uint16_t ma_mask;
+    int      changed;
+    uint8_t  chr;
+    uint8_t  attr;
+
+    if ((line < 0) || (line >= HERC_SNAP_LINES) || (dev->crtc[1] > HERC_SNAP_COLS))
+        return 1;
+
+    key     = dev->sc | ((uint32_t) dev->ctrl << 8) | ((uint32_t) dev->ctrl2 << 16);
+    changed = (dev->line_key[line] != key) || (dev->line_vgen[line] != dev->line_gen);
+
+    dev->line_key[line]  = key;
+    dev->line_vgen[line] = dev->line_gen;
+
+    /* Graphics data changes are tracked through line_gen. */
+    if (dev->ctrl & 0x02)
+        return changed;
+
+    ma      = dev->ma;
+    ma_mask = (dev->ctrl2 & 0x01) ? 0x3fff : 0x7ff;
+
+    for (int x = 0; x < dev->crtc[1]; x++) {
+        if (dev->ctrl & 8) {
+            chr  = dev->charbuffer[x << 1];
+            attr = dev->charbuffer[(x << 1) + 1];
+        } else
+            chr = attr = 0;
+
+        tuple = chr | ((uint32_t) attr << 8);
+        if ((ma == ca) && dev->con && dev->cursoron)
+            tuple |= (1 << 16);
+        else if ((dev->blink & 16) && (dev->ctrl & 0x20) && (attr & 0x80))
+            tuple |= (1 << 17);
+        ma = (ma + 1) & ma_mask;
+
+        if (dev->line_cells[line][x] != tuple) {
+            dev->line_cells[line][x] = tuple;
+            changed = 1;
+        }
+    }
+
+    return changed;
+}
+
 static void
 hercules_poll(void *priv)
 {
@@ -314,6 +379,17 @@ hercules_poll(void *priv)
             }
             dev->lastline = dev->displine;
 
+            if (!hercules_line_changed(dev, ca)) {
+                /* Keep the address counter moving as if the line had been
+                   drawn. */
+                if (dev->ctrl & 0x02)
+                    dev->ma += dev->crtc[1];
+                else
+                    dev->ma = (dev->ma + dev->crtc[1]) & ((dev->ctrl2 & 0x01) ? 0x3fff : 0x7ff);
+                goto line_done;
+            }
+            dev->render_dirty = 1;
+
             hercules_render_overscan_left(dev);
 
             if (dev->ctrl & 0x02) {
@@ -376,6 +452,7 @@ hercules_poll(void *priv)
                 x = dev->crtc[1] * 9;
 
             video_process_8(x + 16, dev->displine + 14);
+line_done:;
         }
         dev->sc = oldsc;
 
@@ -470,29 +547,37 @@ hercules_poll(void *priv)
 
                         if (video_force_resize_get())
                             video_force_resize_set(0);
+
+                        /* The resize may have touched the target buffer -
+                           the line snapshots no longer vouch for it. */
+                        dev->line_gen++;
+                        dev->render_dirty = 1;
                     }
 
-                    if ((x >= 160) && ((y + 1) >= 120)) {
-                        /* Draw (overscan_size) lines of overscan on top and bottom. */
-                        for (yy = 0; yy < 14; yy++) {
-                            p = &(buffer32->line[(dev->firstline + yy) & 0x7ff][0]);
+                    if (dev->render_dirty || monitors[dev->monitor_index].mon_screenshots) {
+                        if ((x >= 160) && ((y + 1) >= 120)) {
+                            /* Draw (overscan_size) lines of overscan on top and bottom. */
+                            for (yy = 0; yy < 14; yy++) {
+                                p = &(buffer32->line[(dev->firstline + yy) & 0x7ff][0]);
 
-                            for (xx = 0; xx < (x + 16); xx++)
-                                p[xx] = 0x00000000;
-                        }
+                                for (xx = 0; xx < (x + 16); xx++)
+                                    p[xx] = 0x00000000;
+                            }
 
-                        for (yy = 0; yy < 14; yy++) {
-                            p = &(buffer32->line[(dev->firstline + 14 + y + yy) & 0x7ff][0]);
+                            for (yy = 0; yy < 14; yy++) {
+                                p = &(buffer32->line[(dev->firstline + 14 + y + yy) & 0x7ff][0]);
 
-                            for (xx = 0; xx < (x + 16); xx++)
-                                p[xx] = 0x00000000;
+                                for (xx = 0; xx < (x + 16); xx++)
+                                    p[xx] = 0x00000000;
+                            }
                         }
-                    }
 
-                    if (enable_overscan)
-                        video_blit_memtoscreen(0, dev->firstline, xsize + 16, ysize + 28);
-                    else
-                        video_blit_memtoscreen(8, dev->firstline + 14, xsize, ysize);
+                        if (enable_overscan)
+                            video_blit_memtoscreen(0, dev->firstline, xsize + 16, ysize + 28);
+                        else
+                            video_blit_memtoscreen(8, dev->firstline + 14, xsize, ysize);
+                    }
+                    dev->render_dirty = 0;
                     frames++;
 #if 0
                     if ((dev->ctrl & 2) && (dev->ctrl2 & 1)) {
@@ -537,6 +622,7 @@ hercules_init(UNUSED(const device_t *info))
     dev = (hercules_t *) malloc(sizeof(hercules_t));
     memset(dev, 0x00, sizeof(hercules_t));
     dev->monitor_index = monitor_index_global;
+    dev->line_gen      = 1; /* the zeroed snapshots must not match anything */
 
     overscan_x = 16;
     overscan_y = 28;
@@ -426,6 +426,7 @@ ht216_out(uint16_t addr, uint8_t val, void *priv)
 
             if (svga->gdcaddr <= 8) {
                 svga->fast = (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && !svga->gdcreg[1]) && svga->chain4 && svga->packed_chain4;
+                svga_recalc_write_handler(svga);
             }
             break;
 
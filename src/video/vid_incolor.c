@@ -71,6 +71,10 @@
 #define INCOLOR_RWCTRL_WRMODE   0x30
 #define INCOLOR_RWCTRL_POLARITY 0x40
 
+/* Per-scanline snapshot bounds - lines outside them always render */
+#define INCOLOR_SNAP_LINES 512
+#define INCOLOR_SNAP_COLS  128
+
 /* exception register */
 #define INCOLOR_EXCEPT_CURSOR  0x0F /* Cursor colour */
 #define INCOLOR_EXCEPT_PALETTE 0x10 /* Enable palette register */
@@ -178,6 +182,16 @@ typedef struct {
 
     uint32_t rgb[64];
 
+    /* Snapshot of everything each rendered scanline's pixels derive from,
+       so lines whose inputs match the previous frame can be skipped - the
+       target buffer still holds their final RGB pixels.  line_gen covers
+       inputs outside the per-cell tuples (plane data, RAMfont, palette). */
+    uint32_t line_cells[INCOLOR_SNAP_LINES][INCOLOR_SNAP_COLS];
+    uint32_t line_key[INCOLOR_SNAP_LINES];
+    uint32_t line_vgen[INCOLOR_SNAP_LINES];
+    uint32_t line_gen;
+    int      render_dirty;
+
     uint8_t *vram;
 } incolor_t;
 
@@ -198,6 +212,10 @@ recalc_timings(incolor_t *dev)
 
     dev->dispontime  = (uint64_t) (_dispontime);
     dev->dispofftime = (uint64_t) (_dispofftime);
+
+    /* Every register change that lands here may also have redefined what
+       the scanlines put on screen - drop the line snapshots. */
+    dev->line_gen++;
 }
 
 static void
@@ -224,6 +242,9 @@ incolor_out(uint16_t port, uint8_t val, void *priv)
             if (dev->crtcreg == INCOLOR_CRTC_PALETTE) {
                 dev->palette[dev->palette_idx % 16] = val;
                 ++dev->palette_idx;
+                /* The write index advances even when the register value is
+                   unchanged, so recalc_timings would not catch this. */
+                dev->line_gen++;
             }
             old                     = dev->crtc[dev->crtcreg];
             dev->crtc[dev->crtcreg] = val;
@@ -247,6 +268,7 @@ incolor_out(uint16_t port, uint8_t val, void *priv)
 
         case 0x3bf:
             dev->ctrl2 = val;
+            dev->line_gen++;
             if (val & 2)
                 mem_mapping_set_addr(&dev->mapping, 0xb0000, 0x10000);
             else
@@ -315,6 +337,11 @@ incolor_write(uint32_t addr, uint8_t val, void *priv)
         return;
     }
 
+    /* Plane writes can change graphics data or RAMfont glyphs, neither of
+       which the per-cell text snapshots see - invalidate the lines.  (Text
+       cell changes above are caught by the snapshot compare itself.) */
+    dev->line_gen++;
+
     /* There are four write modes:
      * 0: 1 => foreground,    0 => background
      * 1: 1 => foreground,    0 => source latch
@@ -851,6 +878,62 @@ graphics_line(incolor_t *dev)
     }
 }
 
+/* Compare (and stamp) the snapshot of everything this scanline's pixels
+   derive from.  Returns nonzero when the line must be rendered; zero means
+   the target buffer still holds the line's final RGB pixels from the
+   previous frame. */
+static int
+incolor_line_changed(incolor_t *dev, uint16_t ca)
+{
+    int      line = dev->displine;
+    uint32_t key;
+    uint32_t tuple;
+    uint16_t ma;
+    int      changed;
+    uint8_t  chr;
+    uint8_t  attr;
+
+    if ((line < 0) || (line >= INCOLOR_SNAP_LINES) || (dev->crtc[1] > INCOLOR_SNAP_COLS))
+        return 1;
+
+    key     = dev->sc | ((uint32_t) dev->ctrl << 8) | ((uint32_t) dev->ctrl2 << 16);
+    changed = (dev->line_key[line] != key) || (dev->line_vgen[line] != dev->line_gen);
+
+    dev->line_key[line]  = key;
+    dev->line_vgen[line] = dev->line_gen;
+
+    /* Graphics data changes are tracked through line_gen. */
+    if ((dev->ctrl & INCOLOR_CTRL_GRAPH) && (dev->ctrl2 & INCOLOR_CTRL2_GRAPH))
+        return changed;
+
+    ma = dev->ma;
+
+    for (int x = 0; x < dev->crtc[1]; x++) {
+        if (dev->ctrl & 8) {
+            chr  = dev->vram[(ma << 1) & 0x3fff];
+            attr = dev->vram[((ma << 1) + 1) & 0x3fff];
+        } else
+            chr = attr = 0;
+
+        tuple = chr | ((uint32_t) attr << 8);
+        if ((ma == ca) && dev->con && dev->cursoron)
+            tuple |= (1 << 16);
+        /* Either blink attribute bit can blank the cell, depending on the
+           font mode and alternate-attribute setting - treat both as
+           blink-sensitive rather than duplicating that logic here. */
+        else if ((dev->ctrl & INCOLOR_CTRL_BLINK) && (attr & 0xc0) && (dev->blink & 16))
+            tuple |= (1 << 17);
+        ma++;
+
+        if (dev->line_cells[line][x] != tuple) {
+            dev->line_cells[line][x] = tuple;
+            changed = 1;
+        }
+    }
+
+    return changed;
+}
+
 static void
 incolor_poll(void *priv)
 {
@@ -875,10 +958,17 @@ incolor_poll(void *priv)
                 video_wait_for_buffer();
             }
             dev->lastline = dev->displine;
-            if ((dev->ctrl & INCOLOR_CTRL_GRAPH) && (dev->ctrl2 & INCOLOR_CTRL2_GRAPH))
-                graphics_line(dev);
-            else
-                text_line(dev, ca);
+            if (incolor_line_changed(dev, ca)) {
+                dev->render_dirty = 1;
+                if ((dev->ctrl & INCOLOR_CTRL_GRAPH) && (dev->ctrl2 & INCOLOR_CTRL2_GRAPH))
+                    graphics_line(dev);
+                else
+                    text_line(dev, ca);
+            } else {
+                /* Keep the address counter moving as if the line had been
+                   drawn. */
+                dev->ma += dev->crtc[1];
+            }
         }
         dev->sc = oldsc;
         if (dev->vc == dev->crtc[7] && !dev->sc)
@@ -954,8 +1044,15 @@ incolor_poll(void *priv)
 
                         if (video_force_resize_get())
                             video_force_resize_set(0);
+
+                        /* The resize may have touched the target buffer -
+                           the line snapshots no longer vouch for it. */
+                        dev->line_gen++;
+                        dev->render_dirty = 1;
                     }
-                    video_blit_memtoscreen(0, dev->firstline, xsize, dev->lastline - dev->firstline);
+                    if (dev->render_dirty || monitors[monitor_index_global].mon_screenshots)
+                        video_blit_memtoscreen(0, dev->firstline, xsize, dev->lastline - dev->firstline);
+                    dev->render_dirty = 0;
                     frames++;
                     if ((dev->ctrl & INCOLOR_CTRL_GRAPH) && (dev->ctrl2 & INCOLOR_CTRL2_GRAPH)) {
                         video_res_x = dev->crtc[1] * 16;
@@ -990,6 +1087,7 @@ incolor_init(UNUSED(const device_t *info))
 
     dev = (incolor_t *) malloc(sizeof(incolor_t));
     memset(dev, 0x00, sizeof(incolor_t));
+    dev->line_gen = 1; /* the zeroed snapshots must not match anything */
 
     dev->vram = (uint8_t *) malloc(0x40000); /* 4 planes of 64k */
 
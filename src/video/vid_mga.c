@@ -30,6 +30,7 @@
 #include <86box/device.h>
 #include <86box/dma.h>
 #include <86box/plat.h>
+#include <86box/perfctr.h>
 #include <86box/thread.h>
 #include <86box/video.h>
 #include <86box/i2c.h>
@@ -4670,6 +4671,233 @@ blit_line_start(mystique_t *mystique, int closed, int autoline)
     }
 }
 
+/* Batched span executors for the common blit classes (solid fills, SRCCOPY
+   rects, glyph expansion); the per-pixel engine below stays the reference
+   path for the ROP and setup corner cases. Each helper either performs a
+   whole row and returns 1, or returns 0 with all state untouched so the
+   per-pixel loop can run instead. */
+static int
+blit_pattern_row_solid(const mystique_t *mystique, int yoff)
+{
+    for (uint8_t x = 0; x < 16; x++) {
+        if (!mystique->dwgreg.pattern[yoff][x])
+            return 0;
+    }
+
+    return 1;
+}
+
+/* Fill one clipped row with the foreground colour. */
+static int
+blit_trap_span(mystique_t *mystique, int16_t x_l, int len)
+{
+    svga_t *svga = &mystique->svga;
+    int     x0   = MAX(x_l, mystique->dwgreg.cxleft);
+    int     x1   = MIN(x_l + len - 1, mystique->dwgreg.cxright);
+    int     x;
+
+    if ((mystique->dwgreg.ydst_lin < mystique->dwgreg.ytop) || (mystique->dwgreg.ydst_lin > mystique->dwgreg.ybot))
+        return 1;
+
+    switch (mystique->maccess_running & MACCESS_PWIDTH_MASK) {
+        case MACCESS_PWIDTH_8:
+            for (x = x0; x <= x1; x++) {
+                svga->vram[(mystique->dwgreg.ydst_lin + x) & mystique->vram_mask]                = mystique->dwgreg.fcol & 0xff;
+                svga->changedvram[((mystique->dwgreg.ydst_lin + x) & mystique->vram_mask) >> 12] = changeframecount;
+            }
+            break;
+
+        case MACCESS_PWIDTH_16:
+            for (x = x0; x <= x1; x++) {
+                ((uint16_t *) svga->vram)[(mystique->dwgreg.ydst_lin + x) & mystique->vram_mask_w] = mystique->dwgreg.fcol & 0xffff;
+                svga->changedvram[((mystique->dwgreg.ydst_lin + x) & mystique->vram_mask_w) >> 11] = changeframecount;
+            }
+            break;
+
+        case MACCESS_PWIDTH_32:
+            for (x = x0; x <= x1; x++) {
+                ((uint32_t *) svga->vram)[(mystique->dwgreg.ydst_lin + x) & mystique->vram_mask_l] = mystique->dwgreg.fcol;
+                svga->changedvram[((mystique->dwgreg.ydst_lin + x) & mystique->vram_mask_l) >> 10] = changeframecount;
+            }
+            break;
+
+        default:
+            return 0;
+    }
+
+    return 1;
+}
+
+/* Check the source walk of one BITBLT row: a pitch wrap (AR0 hit) anywhere
+   but the last pixel needs the per-pixel engine. On success returns the
+   clipped walk indices and whether AR0 is hit at the end of the row. */
+static int
+blit_bitblt_row_setup(mystique_t *mystique, uint32_t src_addr, int16_t x_start, int16_t x_end, int x_dir, int *i0, int *i1, int *hit)
+{
+    uint32_t hit_off;
+    int      len;
+
+    if (((x_dir == 1) && (x_start > x_end)) || ((x_dir == -1) && (x_start < x_end)))
+        return 0;
+
+    len     = ABS(x_end - x_start) + 1;
+    hit_off = (x_dir == 1) ? (mystique->dwgreg.ar[0] - src_addr) : (src_addr - mystique->dwgreg.ar[0]);
+    if (hit_off < (uint32_t) (len - 1))
+        return 0;
+    *hit = (hit_off == (uint32_t) (len - 1));
+
+    if (x_dir == 1) {
+        *i0 = MAX(x_start, mystique->dwgreg.cxleft) - x_start;
+        *i1 = MIN(x_end, mystique->dwgreg.cxright) - x_start;
+    } else {
+        *i0 = x_start - MIN(x_start, mystique->dwgreg.cxright);
+        *i1 = x_start - MAX(x_end, mystique->dwgreg.cxleft);
+    }
+
+    return 1;
+}
+
+/* Advance the source registers past one fully handled BITBLT row. */
+static void
+blit_bitblt_row_advance(mystique_t *mystique, uint32_t *src_addr_p, int16_t x_start, int16_t x_end, int x_dir, int hit)
+{
+    if (hit) {
+        mystique->dwgreg.ar[0] += mystique->dwgreg.ar[5];
+        mystique->dwgreg.ar[3] += mystique->dwgreg.ar[5];
+        *src_addr_p = mystique->dwgreg.ar[3];
+    } else
+        *src_addr_p += (ABS(x_end - x_start) + 1) * x_dir;
+}
+
+/* SRCCOPY one BITBLT row of colour source data. The walk order matches the
+   per-pixel engine, so overlapping screen-to-screen copies behave the same. */
+static int
+blit_bitblt_span(mystique_t *mystique, uint32_t *src_addr_p, int16_t x_start, int16_t x_end, int x_dir)
+{
+    svga_t  *svga     = &mystique->svga;
+    uint32_t src_addr = *src_addr_p;
+    uint32_t dst_addr;
+    int      i0;
+    int      i1;
+    int      i;
+    int      hit;
+
+    if (!blit_bitblt_row_setup(mystique, src_addr, x_start, x_end, x_dir, &i0, &i1, &hit))
+        return 0;
+
+    if ((mystique->dwgreg.ydst_lin >= mystique->dwgreg.ytop) && (mystique->dwgreg.ydst_lin <= mystique->dwgreg.ybot)) {
+        switch (mystique->maccess_running & MACCESS_PWIDTH_MASK) {
+            case MACCESS_PWIDTH_8:
+                for (i = i0; i <= i1; i++) {
+                    dst_addr = (mystique->dwgreg.ydst_lin + x_start + i * x_dir) & mystique->vram_mask;
+
+                    svga->vram[dst_addr]              = svga->vram[(src_addr + i * x_dir) & mystique->vram_mask];
+                    svga->changedvram[dst_addr >> 12] = changeframecount;
+                }
+                break;
+
+            case MACCESS_PWIDTH_16:
+                for (i = i0; i <= i1; i++) {
+                    dst_addr = (mystique->dwgreg.ydst_lin + x_start + i * x_dir) & mystique->vram_mask_w;
+
+                    ((uint16_t *) svga->vram)[dst_addr] = ((uint16_t *) svga->vram)[(src_addr + i * x_dir) & mystique->vram_mask_w];
+                    svga->changedvram[dst_addr >> 11]   = changeframecount;
+                }
+                break;
+
+            case MACCESS_PWIDTH_32:
+                for (i = i0; i <= i1; i++) {
+                    dst_addr = (mystique->dwgreg.ydst_lin + x_start + i * x_dir) & mystique->vram_mask_l;
+
+                    ((uint32_t *) svga->vram)[dst_addr] = ((uint32_t *) svga->vram)[(src_addr + i * x_dir) & mystique->vram_mask_l];
+                    svga->changedvram[dst_addr >> 10]   = changeframecount;
+                }
+                break;
+
+            default:
+                return 0;
+        }
+    }
+
+    blit_bitblt_row_advance(mystique, src_addr_p, x_start, x_end, x_dir, hit);
+
+    return 1;
+}
+
+/* Expand one BITBLT row of monochrome source data (text glyphs) as a block
+   write of fcol/bcol. */
+static int
+blit_bitblt_mono_span(mystique_t *mystique, uint32_t *src_addr_p, int16_t x_start, int16_t x_end, int x_dir)
+{
+    svga_t   *svga     = &mystique->svga;
+    uint32_t  src_addr = *src_addr_p;
+    uint32_t  dst_addr;
+    uint32_t  sa;
+    const int wf       = ((mystique->dwgreg.dwgctrl_running & DWGCTRL_BLTMOD_MASK) == DWGCTRL_BLTMOD_BMONOWF);
+    const int transc   = !!(mystique->dwgreg.dwgctrl_running & DWGCTRL_TRANSC);
+    int       i0;
+    int       i1;
+    int       i;
+    int       bit;
+    int       hit;
+
+    if (!blit_bitblt_row_setup(mystique, src_addr, x_start, x_end, x_dir, &i0, &i1, &hit))
+        return 0;
+
+    if ((mystique->dwgreg.ydst_lin >= mystique->dwgreg.ytop) && (mystique->dwgreg.ydst_lin <= mystique->dwgreg.ybot)) {
+        switch (mystique->maccess_running & MACCESS_PWIDTH_MASK) {
+            case MACCESS_PWIDTH_8:
+                for (i = i0; i <= i1; i++) {
+                    sa  = src_addr + i * x_dir;
+                    bit = svga->vram[(sa >> 3) & mystique->vram_mask] & (1 << (wf ? (7 - (sa & 7)) : (sa & 7)));
+                    if (!bit && transc)
+                        continue;
+
+                    dst_addr = (mystique->dwgreg.ydst_lin + x_start + i * x_dir) & mystique->vram_mask;
+
+                    svga->vram[dst_addr]              = bit ? mystique->dwgreg.fcol : mystique->dwgreg.bcol;
+                    svga->changedvram[dst_addr >> 12] = changeframecount;
+                }
+                break;
+
+            case MACCESS_PWIDTH_16:
+                for (i = i0; i <= i1; i++) {
+                    sa  = src_addr + i * x_dir;
+                    bit = svga->vram[(sa >> 3) & mystique->vram_mask] & (1 << (wf ? (7 - (sa & 7)) : (sa & 7)));
+                    if (!bit && transc)
+                        continue;
+
+                    dst_addr = (mystique->dwgreg.ydst_lin + x_start + i * x_dir) & mystique->vram_mask_w;
+
+                    ((uint16_t *) svga->vram)[dst_addr] = bit ? mystique->dwgreg.fcol : mystique->dwgreg.bcol;
+                    svga->changedvram[dst_addr >> 11]   = changeframecount;
+                }
+                break;
+
+            case MACCESS_PWIDTH_32:
+                for (i = i0; i <= i1; i++) {
+                    sa  = src_addr + i * x_dir;
+                    bit = svga->vram[(sa >> 3) & mystique->vram_mask] & (1 << (wf ? (7 - (sa & 7)) : (sa & 7)));
+                    if (!bit && transc)
+                        continue;
+
+                    dst_addr = (mystique->dwgreg.ydst_lin + x_start + i * x_dir) & mystique->vram_mask_l;
+
+                    ((uint32_t *) svga->vram)[dst_addr] = bit ? mystique->dwgreg.fcol : mystique->dwgreg.bcol;
+                    svga->changedvram[dst_addr >> 11]   = changeframecount;
+                }
+                break;
+
+            default:
+                return 0;
+        }
+    }
+
+    blit_bitblt_row_advance(mystique, src_addr_p, x_start, x_end, x_dir, hit);
+
+    return 1;
+}
+
 static void
 blit_trap(mystique_t *mystique)
 {
@@ -4684,6 +4912,8 @@ blit_trap(mystique_t *mystique)
     int       err_l = (int32_t)mystique->dwgreg.ar[1];
     int       err_r = (int32_t)mystique->dwgreg.ar[4];
     const int trans_sel = (mystique->dwgreg.dwgctrl_running & DWGCTRL_TRANS_MASK) >> DWGCTRL_TRANS_SHIFT;
+    const int span_ok   = (trans_sel == 0);
+    const int span_rop  = ((mystique->dwgreg.dwgctrl_running & DWGCTRL_BOP_MASK) == BOP(0xc));
 
     switch (mystique->dwgreg.dwgctrl_running & DWGCTRL_ATYPE_MASK) {
         case DWGCTRL_ATYPE_BLK:
@@ -4700,6 +4930,12 @@ blit_trap(mystique_t *mystique)
                 else
                     len = x_r - x_l;
 
+                if (span_ok && blit_pattern_row_solid(mystique, yoff) && blit_trap_span(mystique, x_l, len)) {
+                    PERF_INC(PERF_BLIT_SPAN);
+                    len = 0;
+                } else if (len > 0)
+                    PERF_INC(PERF_BLIT_PIXEL);
+
                 while (len > 0) {
                     if (x_l >= mystique->dwgreg.cxleft && x_l <= mystique->dwgreg.cxright && mystique->dwgreg.ydst_lin >= mystique->dwgreg.ytop && mystique->dwgreg.ydst_lin <= mystique->dwgreg.ybot && trans[x_l & 3]) {
                         int      xoff    = (mystique->dwgreg.xoff + (x_l & 7)) & 15;
@@ -4769,6 +5005,12 @@ blit_trap(mystique_t *mystique)
                 else
                     len = x_r - x_l;
 
+                if (span_ok && span_rop && blit_pattern_row_solid(mystique, yoff) && blit_trap_span(mystique, x_l, len)) {
+                    PERF_INC(PERF_BLIT_SPAN);
+                    len = 0;
+                } else if (len > 0)
+                    PERF_INC(PERF_BLIT_PIXEL);
+
                 while (len > 0) {
                     if (x_l >= mystique->dwgreg.cxleft && x_l <= mystique->dwgreg.cxright && mystique->dwgreg.ydst_lin >= mystique->dwgreg.ytop && mystique->dwgreg.ydst_lin <= mystique->dwgreg.ybot && trans[x_l & 3]) {
                         int      xoff    = (mystique->dwgreg.xoff + (x_l & 7)) & 15;
@@ -5481,6 +5723,9 @@ blit_bitblt(mystique_t *mystique)
     int16_t   x_start   = mystique->dwgreg.sgn.scanleft ? mystique->dwgreg.fxright : mystique->dwgreg.fxleft;
     int16_t   x_end     = mystique->dwgreg.sgn.scanleft ? mystique->dwgreg.fxleft : mystique->dwgreg.fxright;
     const int trans_sel = (mystique->dwgreg.dwgctrl_running & DWGCTRL_TRANS_MASK) >> DWGCTRL_TRANS_SHIFT;
+    /* Plain SRCCOPY with no pattern, colour keying or transparency mask can
+       run whole rows through the span path. */
+    const int span_rop  = ((mystique->dwgreg.dwgctrl_running & (DWGCTRL_BOP_MASK | DWGCTRL_PATTERN | DWGCTRL_TRANSC)) == BOP(0xc)) && (trans_sel == 0);
     uint32_t  bltckey   = mystique->dwgreg.fcol;
     uint32_t  bltcmsk   = mystique->dwgreg.bcol;
 
@@ -5505,6 +5750,16 @@ blit_bitblt(mystique_t *mystique)
                     for (y = 0; y < mystique->dwgreg.length; y++) {
                         int16_t x = x_start;
 
+                        if (blit_bitblt_mono_span(mystique, &src_addr, x_start, x_end, x_dir)) {
+                            PERF_INC(PERF_BLIT_SPAN);
+                            if (mystique->dwgreg.sgn.sdy)
+                                mystique->dwgreg.ydst_lin -= (mystique->dwgreg.pitch & PITCH_MASK);
+                            else
+                                mystique->dwgreg.ydst_lin += (mystique->dwgreg.pitch & PITCH_MASK);
+                            continue;
+                        }
+                        PERF_INC(PERF_BLIT_PIXEL);
+
                         while (1) {
                             if (x >= mystique->dwgreg.cxleft && x <= mystique->dwgreg.cxright && mystique->dwgreg.ydst_lin >= mystique->dwgreg.ytop && mystique->dwgreg.ydst_lin <= mystique->dwgreg.ybot) {
                                 uint32_t byte_addr  = (src_addr >> 3) & mystique->vram_mask;
@@ -5616,6 +5871,8 @@ blit_bitblt(mystique_t *mystique)
                         uint8_t const *const trans = &trans_masks[trans_sel][(mystique->dwgreg.selline & 3) * 4];
                         int16_t              x     = x_start;
 
+                        PERF_INC(PERF_BLIT_PIXEL);
+
                         while (1) {
                             uint32_t byte_addr = src_addr & mystique->vram_mask;
 
@@ -5701,6 +5958,8 @@ blit_bitblt(mystique_t *mystique)
                         uint8_t const *const trans = &trans_masks[trans_sel][(mystique->dwgreg.selline & 3) * 4];
                         int16_t              x     = x_start;
 
+                        PERF_INC(PERF_BLIT_PIXEL);
+
                         while (1) {
                             uint32_t byte_addr  = (src_addr >> 3) & mystique->vram_mask;
                             int      bit_offset = ((mystique->dwgreg.dwgctrl_running & DWGCTRL_BLTMOD_MASK) == DWGCTRL_BLTMOD_BMONOWF) ? (7 - (src_addr & 7)) : (src_addr & 7);
@@ -5786,6 +6045,16 @@ blit_bitblt(mystique_t *mystique)
                         uint32_t             old_src_addr = src_addr;
                         int16_t              x            = x_start;
 
+                        if (span_rop && blit_bitblt_span(mystique, &src_addr, x_start, x_end, x_dir)) {
+                            PERF_INC(PERF_BLIT_SPAN);
+                            if (mystique->dwgreg.sgn.sdy)
+                                mystique->dwgreg.ydst_lin -= (mystique->dwgreg.pitch & PITCH_MASK);
+                            else
+                                mystique->dwgreg.ydst_lin += (mystique->dwgreg.pitch & PITCH_MASK);
+                            continue;
+                        }
+                        PERF_INC(PERF_BLIT_PIXEL);
+
                         while (1) {
                             if (x >= mystique->dwgreg.cxleft && x <= mystique->dwgreg.cxright && mystique->dwgreg.ydst_lin >= mystique->dwgreg.ytop && mystique->dwgreg.ydst_lin <= mystique->dwgreg.ybot && trans[x & 3]) {
                                 uint32_t src;
@@ -2264,217 +2264,163 @@ s3_hwcursor_draw(svga_t *svga, int displine)
             x = ((x) < 0) ? 0 : 0xff; \
     } while (0)
 
-#define DECODE_YCbCr()                      \
-    do {                                    \
-        int c;                              \
-                                            \
-        for (c = 0; c < 2; c++) {           \
-            uint8_t y1, y2;                 \
-            int8_t  Cr, Cb;                 \
-            int     dR, dG, dB;             \
-                                            \
-            y1 = src[0];                    \
-            Cr = src[1] - 0x80;             \
-            y2 = src[2];                    \
-            Cb = src[3] - 0x80;             \
-            src += 4;                       \
-                                            \
-            dR = (359 * Cr) >> 8;           \
-            dG = (88 * Cb + 183 * Cr) >> 8; \
-            dB = (453 * Cb) >> 8;           \
-                                            \
-            r[x_write] = y1 + dR;           \
-            CLAMP(r[x_write]);              \
-            g[x_write] = y1 - dG;           \
-            CLAMP(g[x_write]);              \
-            b[x_write] = y1 + dB;           \
-            CLAMP(b[x_write]);              \
-                                            \
-            r[x_write + 1] = y2 + dR;       \
-            CLAMP(r[x_write + 1]);          \
-            g[x_write + 1] = y2 - dG;       \
-            CLAMP(g[x_write + 1]);          \
-            b[x_write + 1] = y2 + dB;       \
-            CLAMP(b[x_write + 1]);          \
-                                            \
-            x_write = (x_write + 2) & 7;    \
-        }                                   \
-    } while (0)
+/*Per-format scanline decoders for the streams processor. Each one converts
+  a run of source pixels to xRGB in one dense loop the compiler can
+  vectorize, instead of interleaving a four-pixel format switch with the
+  scaling DDA. The decoders always work in groups of four pixels, matching
+  the granularity of the old sample ring.*/
+static void
+s3_overlay_decode_ycbcr(const uint8_t *src, uint32_t *dst, int pixels)
+{
+    for (int x = 0; x < pixels; x += 2) {
+        uint8_t y1 = src[0];
+        int8_t  Cr = src[1] - 0x80;
+        uint8_t y2 = src[2];
+        int8_t  Cb = src[3] - 0x80;
+        int     dR = (359 * Cr) >> 8;
+        int     dG = (88 * Cb + 183 * Cr) >> 8;
+        int     dB = (453 * Cb) >> 8;
+        int     r1 = y1 + dR;
+        int     g1 = y1 - dG;
+        int     b1 = y1 + dB;
+        int     r2 = y2 + dR;
+        int     g2 = y2 - dG;
+        int     b2 = y2 + dB;
+
+        src += 4;
+
+        CLAMP(r1);
+        CLAMP(g1);
+        CLAMP(b1);
+        CLAMP(r2);
+        CLAMP(g2);
+        CLAMP(b2);
+
+        dst[x]     = r1 | (g1 << 8) | (b1 << 16);
+        dst[x + 1] = r2 | (g2 << 8) | (b2 << 16);
+    }
+}
 
 /*Both YUV formats are untested*/
-#define DECODE_YUV211()                  \
-    do {                                 \
-        uint8_t y1, y2, y3, y4;          \
-        int8_t  U, V;                    \
-        int     dR, dG, dB;              \
-                                         \
-        U  = src[0] - 0x80;              \
-        y1 = (298 * (src[1] - 16)) >> 8; \
-        y2 = (298 * (src[2] - 16)) >> 8; \
-        V  = src[3] - 0x80;              \
-        y3 = (298 * (src[4] - 16)) >> 8; \
-        y4 = (298 * (src[5] - 16)) >> 8; \
-        src += 6;                        \
-                                         \
-        dR = (309 * V) >> 8;             \
-        dG = (100 * U + 208 * V) >> 8;   \
-        dB = (516 * U) >> 8;             \
-                                         \
-        r[x_write] = y1 + dR;            \
-        CLAMP(r[x_write]);               \
-        g[x_write] = y1 - dG;            \
-        CLAMP(g[x_write]);               \
-        b[x_write] = y1 + dB;            \
-        CLAMP(b[x_write]);               \
-                                         \
-        r[x_write + 1] = y2 + dR;        \
-        CLAMP(r[x_write + 1]);           \
-        g[x_write + 1] = y2 - dG;        \
-        CLAMP(g[x_write + 1]);           \
-        b[x_write + 1] = y2 + dB;        \
-        CLAMP(b[x_write + 1]);           \
-                                         \
-        r[x_write + 2] = y3 + dR;        \
-        CLAMP(r[x_write + 2]);           \
-        g[x_write + 2] = y3 - dG;        \
-        CLAMP(g[x_write + 2]);           \
-        b[x_write + 2] = y3 + dB;        \
-        CLAMP(b[x_write + 2]);           \
-                                         \
-        r[x_write + 3] = y4 + dR;        \
-        CLAMP(r[x_write + 3]);           \
-        g[x_write + 3] = y4 - dG;        \
-        CLAMP(g[x_write + 3]);           \
-        b[x_write + 3] = y4 + dB;        \
-        CLAMP(b[x_write + 3]);           \
-                                         \
-        x_write = (x_write + 4) & 7;     \
-    } while (0)
+static void
+s3_overlay_decode_yuv211(const uint8_t *src, uint32_t *dst, int pixels)
+{
+    for (int x = 0; x < pixels; x += 4) {
+        int8_t  U  = src[0] - 0x80;
+        uint8_t y1 = (298 * (src[1] - 16)) >> 8;
+        uint8_t y2 = (298 * (src[2] - 16)) >> 8;
+        int8_t  V  = src[3] - 0x80;
+        uint8_t y3 = (298 * (src[4] - 16)) >> 8;
+        uint8_t y4 = (298 * (src[5] - 16)) >> 8;
+        int     dR = (309 * V) >> 8;
+        int     dG = (100 * U + 208 * V) >> 8;
+        int     dB = (516 * U) >> 8;
+
+        src += 6;
+
+        for (int c = 0; c < 4; c++) {
+            int y = (c == 0) ? y1 : ((c == 1) ? y2 : ((c == 2) ? y3 : y4));
+            int r = y + dR;
+            int g = y - dG;
+            int b = y + dB;
+
+            CLAMP(r);
+            CLAMP(g);
+            CLAMP(b);
+
+            dst[x + c] = r | (g << 8) | (b << 16);
+        }
+    }
+}
 
-#define DECODE_YUV422()                      \
-    do {                                     \
-        int c;                               \
-                                             \
-        for (c = 0; c < 2; c++) {            \
-            uint8_t y1, y2;                  \
-            int8_t  U, V;                    \
-            int     dR, dG, dB;              \
-                                             \
-            U  = src[0] - 0x80;              \
-            y1 = (298 * (src[1] - 16)) >> 8; \
-            V  = src[2] - 0x80;              \
-            y2 = (298 * (src[3] - 16)) >> 8; \
-            src += 4;                        \
-                                             \
-            dR = (309 * V) >> 8;             \
-            dG = (100 * U + 208 * V) >> 8;   \
-            dB = (516 * U) >> 8;             \
-                                             \
-            r[x_write] = y1 + dR;            \
-            CLAMP(r[x_write]);               \
-            g[x_write] = y1 - dG;            \
-            CLAMP(g[x_write]);               \
-            b[x_write] = y1 + dB;            \
-            CLAMP(b[x_write]);               \
-                                             \
-            r[x_write + 1] = y2 + dR;        \
-            CLAMP(r[x_write + 1]);           \
-            g[x_write + 1] = y2 - dG;        \
-            CLAMP(g[x_write + 1]);           \
-            b[x_write + 1] = y2 + dB;        \
-            CLAMP(b[x_write + 1]);           \
-                                             \
-            x_write = (x_write + 2) & 7;     \
-        }                                    \
-    } while (0)
+static void
+s3_overlay_decode_yuv422(const uint8_t *src, uint32_t *dst, int pixels)
+{
+    for (int x = 0; x < pixels; x += 2) {
+        int8_t  U  = src[0] - 0x80;
+        uint8_t y1 = (298 * (src[1] - 16)) >> 8;
+        int8_t  V  = src[2] - 0x80;
+        uint8_t y2 = (298 * (src[3] - 16)) >> 8;
+        int     dR = (309 * V) >> 8;
+        int     dG = (100 * U + 208 * V) >> 8;
+        int     dB = (516 * U) >> 8;
+        int     r1 = y1 + dR;
+        int     g1 = y1 - dG;
+        int     b1 = y1 + dB;
+        int     r2 = y2 + dR;
+        int     g2 = y2 - dG;
+        int     b2 = y2 + dB;
+
+        src += 4;
+
+        CLAMP(r1);
+        CLAMP(g1);
+        CLAMP(b1);
+        CLAMP(r2);
+        CLAMP(g2);
+        CLAMP(b2);
+
+        dst[x]     = r1 | (g1 << 8) | (b1 << 16);
+        dst[x + 1] = r2 | (g2 << 8) | (b2 << 16);
+    }
+}
 
-#define DECODE_RGB555()                                                      \
-    do {                                                                     \
-        int c;                                                               \
-                                                                             \
-        for (c = 0; c < 4; c++) {                                            \
-            uint16_t dat;                                                    \
-                                                                             \
-            dat = *(uint16_t *) src;                                         \
-            src += 2;                                                        \
-                                                                             \
-            r[x_write + c] = ((dat & 0x001f) << 3) | ((dat & 0x001f) >> 2);  \
-            g[x_write + c] = ((dat & 0x03e0) >> 2) | ((dat & 0x03e0) >> 7);  \
-            b[x_write + c] = ((dat & 0x7c00) >> 7) | ((dat & 0x7c00) >> 12); \
-        }                                                                    \
-        x_write = (x_write + 4) & 7;                                         \
-    } while (0)
+static void
+s3_overlay_decode_rgb555(const uint8_t *src, uint32_t *dst, int pixels)
+{
+    for (int x = 0; x < pixels; x++) {
+        uint16_t dat = *(uint16_t *) src;
+        uint32_t r   = ((dat & 0x001f) << 3) | ((dat & 0x001f) >> 2);
+        uint32_t g   = ((dat & 0x03e0) >> 2) | ((dat & 0x03e0) >> 7);
+        uint32_t b   = ((dat & 0x7c00) >> 7) | ((dat & 0x7c00) >> 12);
+
+        src += 2;
+        dst[x] = r | (g << 8) | (b << 16);
+    }
+}
 
-#define DECODE_RGB565()                                                      \
-    do {                                                                     \
-        int c;                                                               \
-                                                                             \
-        for (c = 0; c < 4; c++) {                                            \
-            uint16_t dat;                                                    \
-                                                                             \
-            dat = *(uint16_t *) src;                                         \
-            src += 2;                                                        \
-                                                                             \
-            r[x_write + c] = ((dat & 0x001f) << 3) | ((dat & 0x001f) >> 2);  \
-            g[x_write + c] = ((dat & 0x07e0) >> 3) | ((dat & 0x07e0) >> 9);  \
-            b[x_write + c] = ((dat & 0xf800) >> 8) | ((dat & 0xf800) >> 13); \
-        }                                                                    \
-        x_write = (x_write + 4) & 7;                                         \
-    } while (0)
+static void
+s3_overlay_decode_rgb565(const uint8_t *src, uint32_t *dst, int pixels)
+{
+    for (int x = 0; x < pixels; x++) {
+        uint16_t dat = *(uint16_t *) src;
+        uint32_t r   = ((dat & 0x001f) << 3) | ((dat & 0x001f) >> 2);
+        uint32_t g   = ((dat & 0x07e0) >> 3) | ((dat & 0x07e0) >> 9);
+        uint32_t b   = ((dat & 0xf800) >> 8) | ((dat & 0xf800) >> 13);
+
+        src += 2;
+        dst[x] = r | (g << 8) | (b << 16);
+    }
+}
 
-#define DECODE_RGB888()              \
-    do {                             \
-        int c;                       \
-                                     \
-        for (c = 0; c < 4; c++) {    \
-            r[x_write + c] = src[0]; \
-            g[x_write + c] = src[1]; \
-            b[x_write + c] = src[2]; \
-            src += 3;                \
-        }                            \
-        x_write = (x_write + 4) & 7; \
-    } while (0)
+static void
+s3_overlay_decode_rgb888(const uint8_t *src, uint32_t *dst, int pixels)
+{
+    for (int x = 0; x < pixels; x++) {
+        dst[x] = src[0] | (src[1] << 8) | (src[2] << 16);
+        src += 3;
+    }
+}
 
-#define DECODE_XRGB8888()            \
-    do {                             \
-        int c;                       \
-                                     \
-        for (c = 0; c < 4; c++) {    \
-            r[x_write + c] = src[0]; \
-            g[x_write + c] = src[1]; \
-            b[x_write + c] = src[2]; \
-            src += 4;                \
-        }                            \
-        x_write = (x_write + 4) & 7; \
-    } while (0)
+static void
+s3_overlay_decode_xrgb8888(const uint8_t *src, uint32_t *dst, int pixels)
+{
+    for (int x = 0; x < pixels; x++) {
+        dst[x] = src[0] | (src[1] << 8) | (src[2] << 16);
+        src += 4;
+    }
+}
 
-#define OVERLAY_SAMPLE()            \
-    do {                            \
-        switch (s3->streams.sdif) { \
-            case 1:                 \
-                DECODE_YCbCr();     \
-                break;              \
-            case 2:                 \
-                DECODE_YUV422();    \
-                break;              \
-            case 3:                 \
-                DECODE_RGB555();    \
-                break;              \
-            case 4:                 \
-                DECODE_YUV211();    \
-                break;              \
-            case 5:                 \
-                DECODE_RGB565();    \
-                break;              \
-            case 6:                 \
-                DECODE_RGB888();    \
-                break;              \
-            case 7:                 \
-            default:                \
-                DECODE_XRGB8888();  \
-                break;              \
-        }                           \
-    } while (0)
+static void (*const s3_overlay_decode[8])(const uint8_t *src, uint32_t *dst, int pixels) = {
+    s3_overlay_decode_xrgb8888,
+    s3_overlay_decode_ycbcr,
+    s3_overlay_decode_yuv422,
+    s3_overlay_decode_rgb555,
+    s3_overlay_decode_yuv211,
+    s3_overlay_decode_rgb565,
+    s3_overlay_decode_rgb888,
+    s3_overlay_decode_xrgb8888
+};
 
 static void
 s3_trio64v_overlay_draw(svga_t *svga, int displine)
@@ -2482,14 +2428,13 @@ s3_trio64v_overlay_draw(svga_t *svga, int displine)
     const s3_t *s3     = (s3_t *) svga->priv;
     int         offset = (s3->streams.sec_x - s3->streams.pri_x) + 1;
     int         h_acc  = s3->streams.dda_horiz_accumulator;
-    int         r[8];
-    int         g[8];
-    int         b[8];
     int         x_size;
-    int         x_read = 4;
-    int         x_write = 4;
+    int         x_read = 0;
+    int         acc;
+    int         pixels;
+    uint32_t    line[2056];
     uint32_t   *p;
-    uint8_t    *src = &svga->vram[svga->overlay_latch.addr];
+    const uint8_t *src = &svga->vram[svga->overlay_latch.addr];
 
     p = &(buffer32->line[displine][offset + svga->x_add]);
 
@@ -2498,18 +2443,29 @@ s3_trio64v_overlay_draw(svga_t *svga, int displine)
     else
         x_size = s3->streams.sec_w + 1;
 
-    OVERLAY_SAMPLE();
-
-    for (int x = 0; x < x_size; x++) {
-        *p++ = r[x_read] | (g[x_read] << 8) | (b[x_read] << 16);
+    if (x_size > 0) {
+        /*Dry-run the horizontal DDA to find how many source pixels this line
+          consumes, then decode them in one pass.*/
+        pixels = 0;
+        acc    = h_acc;
+        for (int x = 0; x < x_size; x++) {
+            acc += s3->streams.k1_horiz_scale;
+            if (acc >= 0) {
+                pixels++;
+                acc += (s3->streams.k2_horiz_scale - s3->streams.k1_horiz_scale);
+            }
+        }
+        pixels = ((pixels / 4) + 1) * 4;
+        s3_overlay_decode[s3->streams.sdif](src, line, pixels);
 
-        h_acc += s3->streams.k1_horiz_scale;
-        if (h_acc >= 0) {
-            if ((x_read ^ (x_read + 1)) & ~3)
-                OVERLAY_SAMPLE();
-            x_read = (x_read + 1) & 7;
+        for (int x = 0; x < x_size; x++) {
+            *p++ = line[x_read];
 
-            h_acc += (s3->streams.k2_horiz_scale - s3->streams.k1_horiz_scale);
+            h_acc += s3->streams.k1_horiz_scale;
+            if (h_acc >= 0) {
+                x_read++;
+                h_acc += (s3->streams.k2_horiz_scale - s3->streams.k1_horiz_scale);
+            }
         }
     }
 
@@ -4445,6 +4401,7 @@ s3_updatemapping(s3_t *s3)
             svga->fb_only = 0;
             mem_mapping_disable(&s3->linear_mapping);
         }
+        svga_recalc_write_handler(svga);
 
         /* Memory mapped I/O. */
         if ((svga->crtc[0x53] & 0x10) || (s3->accel.advfunc_cntl & 0x20)) {
@@ -50,9 +50,9 @@ static int dither[4][4] = {
 #define RB_SIZE                       256
 #define RB_MASK                       (RB_SIZE - 1)
 
-#define RB_ENTRIES                    (virge->s3d_write_idx - virge->s3d_read_idx)
-#define RB_FULL                       (RB_ENTRIES == RB_SIZE)
-#define RB_EMPTY                      (!RB_ENTRIES)
+#define RB_ENTRIES(t)                 (virge->s3d_write_idx - virge->s3d_read_idx[t])
+#define RB_FULL(t)                    (RB_ENTRIES(t) == RB_SIZE)
+#define RB_EMPTY(t)                   (!RB_ENTRIES(t))
 
 #define FIFO_SIZE                     65536
 #define FIFO_MASK                     (FIFO_SIZE - 1)
@@ -185,8 +185,8 @@ typedef struct virge_t {
     uint32_t memory_size;
     uint32_t vram_mask;
 
-    thread_t *render_thread;
-    event_t  *wake_render_thread;
+    thread_t *render_thread[2];
+    event_t  *wake_render_thread[2];
     event_t  *wake_main_thread;
     event_t  *not_full_event;
 
@@ -241,8 +241,9 @@ typedef struct virge_t {
     s3d_t s3d_tri;
 
     s3d_t      s3d_buffer[RB_SIZE];
-    atomic_int s3d_read_idx, s3d_write_idx;
-    atomic_int s3d_busy;
+    atomic_int s3d_read_idx[2];
+    atomic_int s3d_write_idx;
+    atomic_int s3d_busy[2];
 
     struct
     {
@@ -279,7 +280,7 @@ typedef struct virge_t {
     uint8_t      cmd_dma;
     uint32_t     cmd_dma_base;
     uint32_t     dma_ptr;
-    uint64_t     blitter_time;
+    uint64_t     blitter_time[2];
     int          fifo_slots_num;
 
     pc_timer_t tri_timer;
@@ -306,7 +307,7 @@ static video_timings_t timing_diamond_stealth3d_3000_pci = { .type = VIDEO_PCI,
 static video_timings_t timing_virge_dx_pci               = { .type = VIDEO_PCI, .write_b = 2, .write_w = 2, .write_l = 3, .read_b = 28, .read_w = 28, .read_l = 45 };
 static video_timings_t timing_virge_agp                  = { .type = VIDEO_AGP, .write_b = 2, .write_w = 2, .write_l = 3, .read_b = 28, .read_w = 28, .read_l = 45 };
 
-static void s3_virge_triangle(virge_t *virge, s3d_t *s3d_tri);
+static void s3_virge_triangle(virge_t *virge, s3d_t *s3d_tri, int odd_even);
 
 static void s3_virge_recalctimings(svga_t *svga);
 static void s3_virge_updatemapping(virge_t *virge);
@@ -397,16 +398,17 @@ s3_virge_tri_timer(void *priv)
 {
     virge_t *virge = (virge_t *) priv;
 
-    thread_set_event(virge->wake_render_thread); /*Wake up FIFO thread if moving from idle*/
+    thread_set_event(virge->wake_render_thread[0]); /*Wake up render threads if moving from idle*/
+    thread_set_event(virge->wake_render_thread[1]);
 }
 
 static void
 queue_triangle(virge_t *virge)
 {
-    if (RB_FULL) {
+    while (RB_FULL(0) || RB_FULL(1)) {
         thread_reset_event(virge->not_full_event);
         thread_reset_event(virge->wake_main_thread);
-        if (RB_FULL) {
+        if (RB_FULL(0) || RB_FULL(1)) {
             thread_wait_event(virge->not_full_event, -1); /*Wait for room in ringbuffer*/
             thread_wait_event(virge->wake_main_thread, -1);
         }
@@ -414,7 +416,7 @@ queue_triangle(virge_t *virge)
     virge->s3d_buffer[virge->s3d_write_idx & RB_MASK] = virge->s3d_tri;
     virge->s3d_write_idx++;
 
-    if (!virge->s3d_busy) {
+    if (!virge->s3d_busy[0] && !virge->s3d_busy[1]) {
         if (!(timer_is_enabled(&virge->tri_timer)))
             timer_set_delay_u64(&virge->tri_timer, 100 * TIMER_USEC);
     }
@@ -430,28 +432,40 @@ s3_virge_update_irqs(virge_t *virge)
 }
 
 static void
-render_thread(void *param)
+render_thread(virge_t *virge, int odd_even)
 {
-    virge_t *virge = (virge_t *) param;
-
     while (virge->render_thread_run) {
-        thread_wait_event(virge->wake_render_thread, -1);
-        thread_reset_event(virge->wake_render_thread);
-        virge->s3d_busy = 1;
-        while (!RB_EMPTY) {
-            s3_virge_triangle(virge, &virge->s3d_buffer[virge->s3d_read_idx & RB_MASK]);
-            virge->s3d_read_idx++;
-            if (RB_ENTRIES == RB_MASK) {
+        thread_wait_event(virge->wake_render_thread[odd_even], -1);
+        thread_reset_event(virge->wake_render_thread[odd_even]);
+        virge->s3d_busy[odd_even] = 1;
+        while (!RB_EMPTY(odd_even)) {
+            s3_virge_triangle(virge, &virge->s3d_buffer[virge->s3d_read_idx[odd_even] & RB_MASK], odd_even);
+            virge->s3d_read_idx[odd_even]++;
+            if (RB_ENTRIES(odd_even) == RB_MASK) {
                 thread_set_event(virge->not_full_event);
                 thread_set_event(virge->wake_main_thread);
             }
         }
-        virge->s3d_busy = 0;
-        virge->subsys_stat |= INT_S3D_DONE;
-        s3_virge_update_irqs(virge);
+        virge->s3d_busy[odd_even] = 0;
+        if (!virge->s3d_busy[odd_even ^ 1] && RB_EMPTY(odd_even ^ 1)) {
+            virge->subsys_stat |= INT_S3D_DONE;
+            s3_virge_update_irqs(virge);
+        }
     }
 }
 
+static void
+render_thread_1(void *param)
+{
+    render_thread((virge_t *) param, 0);
+}
+
+static void
+render_thread_2(void *param)
+{
+    render_thread((virge_t *) param, 1);
+}
+
 static void
 s3_virge_out(uint16_t addr, uint8_t val, void *priv)
 {
@@ -1089,6 +1103,7 @@ s3_virge_updatemapping(virge_t *virge)
         mem_mapping_disable(&virge->linear_mapping);
         svga->fb_only = 0;
     }
+    svga_recalc_write_handler(svga);
 
     s3_virge_log("Memory mapped IO %02X\n", svga->crtc[0x53] & 0x38);
 
@@ -1615,7 +1630,7 @@ s3_virge_mmio_read(uint32_t addr, void *priv)
             return ret;
         case 0x8505:
             ret = 0xd0;
-            if (!virge->s3d_busy)
+            if (!virge->s3d_busy[0] && !virge->s3d_busy[1])
                 ret |= 0x20;
             return ret;
 
@@ -1706,7 +1721,7 @@ s3_virge_mmio_read_w(uint32_t addr, void *priv)
     switch (addr & 0xfffe) {
         case 0x8504:
             ret = 0xd000;
-            if (!virge->s3d_busy)
+            if (!virge->s3d_busy[0] && !virge->s3d_busy[1])
                 ret |= 0x2000;
             virge->subsys_stat |= (INT_3DF_EMP | INT_FIFO_EMP);
             ret |= virge->subsys_stat;
@@ -1806,7 +1821,7 @@ s3_virge_mmio_read_l(uint32_t addr, void *priv)
 
         case 0x8504:
             ret = 0x0000d000;
-            if (!virge->s3d_busy)
+            if (!virge->s3d_busy[0] && !virge->s3d_busy[1])
                 ret |= 0x00002000;
             virge->subsys_stat |= (INT_3DF_EMP | INT_FIFO_EMP);
             ret |= virge->subsys_stat;
@@ -2566,7 +2581,7 @@ skip_line:
 
 #define RGB15(r, g, b, dest)                                                                   \
     if (virge->dithering_enabled) {                                                            \
-        int add = dither[_y & 3][_x & 3];                                                      \
+        int add = dither[state->y & 3][x & 3];                                                      \
         int _r  = (r > 248) ? 248 : r + add;                                                   \
         int _g  = (g > 248) ? 248 : g + add;                                                   \
         int _b  = (b > 248) ? 248 : b + add;                                                   \
@@ -2580,6 +2595,13 @@ typedef struct rgba_t {
     int r, g, b, a;
 } rgba_t;
 
+typedef struct s3d_texture_state_t {
+    int level;
+    int texture_shift;
+
+    int32_t u, v;
+} s3d_texture_state_t;
+
 typedef struct s3d_state_t {
     int32_t r, g, b, a, u, v, d, w;
 
@@ -2600,25 +2622,15 @@ typedef struct s3d_state_t {
     int     y;
 
     rgba_t dest_rgba;
-} s3d_state_t;
-
-typedef struct s3d_texture_state_t {
-    int level;
-    int texture_shift;
 
-    int32_t u, v;
-} s3d_texture_state_t;
-
-static void (*tex_read)(s3d_state_t *state, s3d_texture_state_t *texture_state, rgba_t *out);
-static void (*tex_sample)(s3d_state_t *state);
-static void (*dest_pixel)(s3d_state_t *state);
+    void (*tex_read)(struct s3d_state_t *state, s3d_texture_state_t *texture_state, rgba_t *out);
+    void (*tex_sample)(struct s3d_state_t *state);
+    void (*dest_pixel)(struct s3d_state_t *state);
+} s3d_state_t;
 
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 
-static int _x;
-static int _y;
-
 static void
 tex_ARGB1555(s3d_state_t *state, s3d_texture_state_t *texture_state, rgba_t *out)
 {
@@ -2709,7 +2721,7 @@ tex_sample_normal(s3d_state_t *state)
     texture_state.u             = state->u + state->tbu;
     texture_state.v             = state->v + state->tbv;
 
-    tex_read(state, &texture_state, &state->dest_rgba);
+    state->tex_read(state, &texture_state, &state->dest_rgba);
 }
 
 static void
@@ -2728,21 +2740,21 @@ tex_sample_normal_filter(s3d_state_t *state)
 
     texture_state.u = state->u + state->tbu;
     texture_state.v = state->v + state->tbv;
-    tex_read(state, &texture_state, &tex_samples[0]);
+    state->tex_read(state, &texture_state, &tex_samples[0]);
     du = (texture_state.u >> (texture_state.texture_shift - 8)) & 0xff;
     dv = (texture_state.v >> (texture_state.texture_shift - 8)) & 0xff;
 
     texture_state.u = state->u + state->tbu + tex_offset;
     texture_state.v = state->v + state->tbv;
-    tex_read(state, &texture_state, &tex_samples[1]);
+    state->tex_read(state, &texture_state, &tex_samples[1]);
 
     texture_state.u = state->u + state->tbu;
     texture_state.v = state->v + state->tbv + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[2]);
+    state->tex_read(state, &texture_state, &tex_samples[2]);
 
     texture_state.u = state->u + state->tbu + tex_offset;
     texture_state.v = state->v + state->tbv + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[3]);
+    state->tex_read(state, &texture_state, &tex_samples[3]);
 
     d[0] = (256 - du) * (256 - dv);
     d[1] = du * (256 - dv);
@@ -2767,7 +2779,7 @@ tex_sample_mipmap(s3d_state_t *state)
     texture_state.u             = state->u + state->tbu;
     texture_state.v             = state->v + state->tbv;
 
-    tex_read(state, &texture_state, &state->dest_rgba);
+    state->tex_read(state, &texture_state, &state->dest_rgba);
 }
 
 static void
@@ -2788,21 +2800,21 @@ tex_sample_mipmap_filter(s3d_state_t *state)
 
     texture_state.u = state->u + state->tbu;
     texture_state.v = state->v + state->tbv;
-    tex_read(state, &texture_state, &tex_samples[0]);
+    state->tex_read(state, &texture_state, &tex_samples[0]);
     du = (texture_state.u >> (texture_state.texture_shift - 8)) & 0xff;
     dv = (texture_state.v >> (texture_state.texture_shift - 8)) & 0xff;
 
     texture_state.u = state->u + state->tbu + tex_offset;
     texture_state.v = state->v + state->tbv;
-    tex_read(state, &texture_state, &tex_samples[1]);
+    state->tex_read(state, &texture_state, &tex_samples[1]);
 
     texture_state.u = state->u + state->tbu;
     texture_state.v = state->v + state->tbv + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[2]);
+    state->tex_read(state, &texture_state, &tex_samples[2]);
 
     texture_state.u = state->u + state->tbu + tex_offset;
     texture_state.v = state->v + state->tbv + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[3]);
+    state->tex_read(state, &texture_state, &tex_samples[3]);
 
     d[0] = (256 - du) * (256 - dv);
     d[1] = du * (256 - dv);
@@ -2829,7 +2841,7 @@ tex_sample_persp_normal(s3d_state_t *state)
     texture_state.u             = (int32_t) (((int64_t) state->u * (int64_t) w) >> (12 + state->max_d)) + state->tbu;
     texture_state.v             = (int32_t) (((int64_t) state->v * (int64_t) w) >> (12 + state->max_d)) + state->tbv;
 
-    tex_read(state, &texture_state, &state->dest_rgba);
+    state->tex_read(state, &texture_state, &state->dest_rgba);
 }
 
 static void
@@ -2857,21 +2869,21 @@ tex_sample_persp_normal_filter(s3d_state_t *state)
 
     texture_state.u = u;
     texture_state.v = v;
-    tex_read(state, &texture_state, &tex_samples[0]);
+    state->tex_read(state, &texture_state, &tex_samples[0]);
     du = (u >> (texture_state.texture_shift - 8)) & 0xff;
     dv = (v >> (texture_state.texture_shift - 8)) & 0xff;
 
     texture_state.u = u + tex_offset;
     texture_state.v = v;
-    tex_read(state, &texture_state, &tex_samples[1]);
+    state->tex_read(state, &texture_state, &tex_samples[1]);
 
     texture_state.u = u;
     texture_state.v = v + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[2]);
+    state->tex_read(state, &texture_state, &tex_samples[2]);
 
     texture_state.u = u + tex_offset;
     texture_state.v = v + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[3]);
+    state->tex_read(state, &texture_state, &tex_samples[3]);
 
     d[0] = (256 - du) * (256 - dv);
     d[1] = du * (256 - dv);
@@ -2898,7 +2910,7 @@ tex_sample_persp_normal_375(s3d_state_t *state)
     texture_state.u             = (int32_t) (((int64_t) state->u * (int64_t) w) >> (8 + state->max_d)) + state->tbu;
     texture_state.v             = (int32_t) (((int64_t) state->v * (int64_t) w) >> (8 + state->max_d)) + state->tbv;
 
-    tex_read(state, &texture_state, &state->dest_rgba);
+    state->tex_read(state, &texture_state, &state->dest_rgba);
 }
 
 static void
@@ -2926,21 +2938,21 @@ tex_sample_persp_normal_filter_375(s3d_state_t *state)
 
     texture_state.u = u;
     texture_state.v = v;
-    tex_read(state, &texture_state, &tex_samples[0]);
+    state->tex_read(state, &texture_state, &tex_samples[0]);
     du = (u >> (texture_state.texture_shift - 8)) & 0xff;
     dv = (v >> (texture_state.texture_shift - 8)) & 0xff;
 
     texture_state.u = u + tex_offset;
     texture_state.v = v;
-    tex_read(state, &texture_state, &tex_samples[1]);
+    state->tex_read(state, &texture_state, &tex_samples[1]);
 
     texture_state.u = u;
     texture_state.v = v + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[2]);
+    state->tex_read(state, &texture_state, &tex_samples[2]);
 
     texture_state.u = u + tex_offset;
     texture_state.v = v + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[3]);
+    state->tex_read(state, &texture_state, &tex_samples[3]);
 
     d[0] = (256 - du) * (256 - dv);
     d[1] = du * (256 - dv);
@@ -2969,7 +2981,7 @@ tex_sample_persp_mipmap(s3d_state_t *state)
     texture_state.u             = (int32_t) (((int64_t) state->u * (int64_t) w) >> (12 + state->max_d)) + state->tbu;
     texture_state.v             = (int32_t) (((int64_t) state->v * (int64_t) w) >> (12 + state->max_d)) + state->tbv;
 
-    tex_read(state, &texture_state, &state->dest_rgba);
+    state->tex_read(state, &texture_state, &state->dest_rgba);
 }
 
 static void
@@ -2999,21 +3011,21 @@ tex_sample_persp_mipmap_filter(s3d_state_t *state)
 
     texture_state.u = u;
     texture_state.v = v;
-    tex_read(state, &texture_state, &tex_samples[0]);
+    state->tex_read(state, &texture_state, &tex_samples[0]);
     du = (u >> (texture_state.texture_shift - 8)) & 0xff;
     dv = (v >> (texture_state.texture_shift - 8)) & 0xff;
 
     texture_state.u = u + tex_offset;
     texture_state.v = v;
-    tex_read(state, &texture_state, &tex_samples[1]);
+    state->tex_read(state, &texture_state, &tex_samples[1]);
 
     texture_state.u = u;
     texture_state.v = v + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[2]);
+    state->tex_read(state, &texture_state, &tex_samples[2]);
 
     texture_state.u = u + tex_offset;
     texture_state.v = v + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[3]);
+    state->tex_read(state, &texture_state, &tex_samples[3]);
 
     d[0] = (256 - du) * (256 - dv);
     d[1] = du * (256 - dv);
@@ -3042,7 +3054,7 @@ tex_sample_persp_mipmap_375(s3d_state_t *state)
     texture_state.u             = (int32_t) (((int64_t) state->u * (int64_t) w) >> (8 + state->max_d)) + state->tbu;
     texture_state.v             = (int32_t) (((int64_t) state->v * (int64_t) w) >> (8 + state->max_d)) + state->tbv;
 
-    tex_read(state, &texture_state, &state->dest_rgba);
+    state->tex_read(state, &texture_state, &state->dest_rgba);
 }
 
 static void
@@ -3072,21 +3084,21 @@ tex_sample_persp_mipmap_filter_375(s3d_state_t *state)
 
     texture_state.u = u;
     texture_state.v = v;
-    tex_read(state, &texture_state, &tex_samples[0]);
+    state->tex_read(state, &texture_state, &tex_samples[0]);
     du = (u >> (texture_state.texture_shift - 8)) & 0xff;
     dv = (v >> (texture_state.texture_shift - 8)) & 0xff;
 
     texture_state.u = u + tex_offset;
     texture_state.v = v;
-    tex_read(state, &texture_state, &tex_samples[1]);
+    state->tex_read(state, &texture_state, &tex_samples[1]);
 
     texture_state.u = u;
     texture_state.v = v + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[2]);
+    state->tex_read(state, &texture_state, &tex_samples[2]);
 
     texture_state.u = u + tex_offset;
     texture_state.v = v + tex_offset;
-    tex_read(state, &texture_state, &tex_samples[3]);
+    state->tex_read(state, &texture_state, &tex_samples[3]);
 
     d[0] = (256 - du) * (256 - dv);
     d[1] = du * (256 - dv);
@@ -3150,7 +3162,7 @@ dest_pixel_gouraud_shaded_triangle(s3d_state_t *state)
 static void
 dest_pixel_unlit_texture_triangle(s3d_state_t *state)
 {
-    tex_sample(state);
+    state->tex_sample(state);
 
     if (state->cmd_set & CMD_SET_ABC_SRC)
         state->dest_rgba.a = state->a >> 7;
@@ -3159,7 +3171,7 @@ dest_pixel_unlit_texture_triangle(s3d_state_t *state)
 static void
 dest_pixel_lit_texture_decal(s3d_state_t *state)
 {
-    tex_sample(state);
+    state->tex_sample(state);
 
     if (state->cmd_set & CMD_SET_ABC_SRC)
         state->dest_rgba.a = state->a >> 7;
@@ -3168,7 +3180,7 @@ dest_pixel_lit_texture_decal(s3d_state_t *state)
 static void
 dest_pixel_lit_texture_reflection(s3d_state_t *state)
 {
-    tex_sample(state);
+    state->tex_sample(state);
 
     state->dest_rgba.r += (state->r >> 7);
     state->dest_rgba.g += (state->g >> 7);
@@ -3187,7 +3199,7 @@ dest_pixel_lit_texture_modulate(s3d_state_t *state)
     int b = state->b >> 7;
     int a = state->a >> 7;
 
-    tex_sample(state);
+    state->tex_sample(state);
 
     CLAMP_RGBA(r, g, b, a);
 
@@ -3200,7 +3212,7 @@ dest_pixel_lit_texture_modulate(s3d_state_t *state)
 }
 
 static void
-tri(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int32_t dx2)
+tri(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int32_t dx2, int odd_even)
 {
     svga_t  *svga = &virge->svga;
     uint8_t *vram = svga->vram;
@@ -3267,6 +3279,11 @@ tri(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int
     z_offset    = s3d_tri->z_base + (state->y * s3d_tri->z_str);
 
     while (y_count > 0) {
+        if ((state->y & 1) != odd_even) {
+            y_count--;
+            goto tri_skip_line;
+        }
+
         x  = (state->x1 + ((1 << 20) - 1)) >> 20;
         xe = (state->x2 + ((1 << 20) - 1)) >> 20;
         z  = (state->base_z > 0) ? (state->base_z << 1) : 0;
@@ -3349,8 +3366,6 @@ tri(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int
 
             while (x != xe) {
                 update = 1;
-                _x     = x;
-                _y     = state->y;
 
                 if (use_z) {
                     src_z = *(uint16_t *) &vram[z_addr & virge->vram_mask];
@@ -3406,7 +3421,7 @@ tri(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int
                 if (update) {
                     uint32_t dest_col;
 
-                    dest_pixel(state);
+                    state->dest_pixel(state);
 
                     if (s3d_tri->cmd_set & CMD_SET_FE) {
                         int a              = state->a >> 7;
@@ -3513,7 +3528,7 @@ static int tex_size[8] = {
 };
 
 static void
-s3_virge_triangle(virge_t *virge, s3d_t *s3d_tri)
+s3_virge_triangle(virge_t *virge, s3d_t *s3d_tri, int odd_even)
 {
     s3d_state_t state;
 
@@ -3550,19 +3565,19 @@ s3_virge_triangle(virge_t *virge, s3d_t *s3d_tri)
 
     switch ((s3d_tri->cmd_set >> 27) & 0xf) {
         case 0:
-            dest_pixel = dest_pixel_gouraud_shaded_triangle;
+            state.dest_pixel = dest_pixel_gouraud_shaded_triangle;
             break;
         case 1:
         case 5:
             switch ((s3d_tri->cmd_set >> 15) & 0x3) {
                 case 0:
-                    dest_pixel = dest_pixel_lit_texture_reflection;
+                    state.dest_pixel = dest_pixel_lit_texture_reflection;
                     break;
                 case 1:
-                    dest_pixel = dest_pixel_lit_texture_modulate;
+                    state.dest_pixel = dest_pixel_lit_texture_modulate;
                     break;
                 case 2:
-                    dest_pixel = dest_pixel_lit_texture_decal;
+                    state.dest_pixel = dest_pixel_lit_texture_decal;
                     break;
                 default:
                     s3_virge_log("bad triangle type %x\n", (s3d_tri->cmd_set >> 27) & 0xf);
@@ -3571,7 +3586,7 @@ s3_virge_triangle(virge_t *virge, s3d_t *s3d_tri)
             break;
         case 2:
         case 6:
-            dest_pixel = dest_pixel_unlit_texture_triangle;
+            state.dest_pixel = dest_pixel_unlit_texture_triangle;
             break;
         default:
             s3_virge_log("bad triangle type %x\n", (s3d_tri->cmd_set >> 27) & 0xf);
@@ -3581,47 +3596,47 @@ s3_virge_triangle(virge_t *virge, s3d_t *s3d_tri)
     switch (((s3d_tri->cmd_set >> 12) & 7) | ((s3d_tri->cmd_set & (1 << 29)) ? 8 : 0)) {
         case 0:
         case 1:
-            tex_sample = tex_sample_mipmap;
+            state.tex_sample = tex_sample_mipmap;
             break;
         case 2:
         case 3:
-            tex_sample = virge->bilinear_enabled ? tex_sample_mipmap_filter : tex_sample_mipmap;
+            state.tex_sample = virge->bilinear_enabled ? tex_sample_mipmap_filter : tex_sample_mipmap;
             break;
         case 4:
         case 5:
-            tex_sample = tex_sample_normal;
+            state.tex_sample = tex_sample_normal;
             break;
         case 6:
         case 7:
-            tex_sample = virge->bilinear_enabled ? tex_sample_normal_filter : tex_sample_normal;
+            state.tex_sample = virge->bilinear_enabled ? tex_sample_normal_filter : tex_sample_normal;
             break;
         case (0 | 8):
         case (1 | 8):
             if (virge->chip == S3_VIRGEDX || virge->chip >= S3_VIRGEGX2)
-                tex_sample = tex_sample_persp_mipmap_375;
+                state.tex_sample = tex_sample_persp_mipmap_375;
             else
-                tex_sample = tex_sample_persp_mipmap;
+                state.tex_sample = tex_sample_persp_mipmap;
             break;
         case (2 | 8):
         case (3 | 8):
             if (virge->chip == S3_VIRGEDX || virge->chip >= S3_VIRGEGX2)
-                tex_sample = virge->bilinear_enabled ? tex_sample_persp_mipmap_filter_375 : tex_sample_persp_mipmap_375;
+                state.tex_sample = virge->bilinear_enabled ? tex_sample_persp_mipmap_filter_375 : tex_sample_persp_mipmap_375;
             else
-                tex_sample = virge->bilinear_enabled ? tex_sample_persp_mipmap_filter : tex_sample_persp_mipmap;
+                state.tex_sample = virge->bilinear_enabled ? tex_sample_persp_mipmap_filter : tex_sample_persp_mipmap;
             break;
         case (4 | 8):
         case (5 | 8):
             if (virge->chip == S3_VIRGEDX || virge->chip >= S3_VIRGEGX2)
-                tex_sample = tex_sample_persp_normal_375;
+                state.tex_sample = tex_sample_persp_normal_375;
             else
-                tex_sample = tex_sample_persp_normal;
+                state.tex_sample = tex_sample_persp_normal;
             break;
         case (6 | 8):
         case (7 | 8):
             if (virge->chip == S3_VIRGEDX || virge->chip >= S3_VIRGEGX2)
-                tex_sample = virge->bilinear_enabled ? tex_sample_persp_normal_filter_375 : tex_sample_persp_normal_375;
+                state.tex_sample = virge->bilinear_enabled ? tex_sample_persp_normal_filter_375 : tex_sample_persp_normal_375;
             else
-                tex_sample = virge->bilinear_enabled ? tex_sample_persp_normal_filter : tex_sample_persp_normal;
+                state.tex_sample = virge->bilinear_enabled ? tex_sample_persp_normal_filter : tex_sample_persp_normal;
             break;
 
         default:
@@ -3630,30 +3645,30 @@ s3_virge_triangle(virge_t *virge, s3d_t *s3d_tri)
 
     switch ((s3d_tri->cmd_set >> 5) & 7) {
         case 0:
-            tex_read = (s3d_tri->cmd_set & CMD_SET_TWE) ? tex_ARGB8888 : tex_ARGB8888_nowrap;
+            state.tex_read = (s3d_tri->cmd_set & CMD_SET_TWE) ? tex_ARGB8888 : tex_ARGB8888_nowrap;
             break;
         case 1:
-            tex_read = (s3d_tri->cmd_set & CMD_SET_TWE) ? tex_ARGB4444 : tex_ARGB4444_nowrap;
+            state.tex_read = (s3d_tri->cmd_set & CMD_SET_TWE) ? tex_ARGB4444 : tex_ARGB4444_nowrap;
             break;
         case 2:
-            tex_read = (s3d_tri->cmd_set & CMD_SET_TWE) ? tex_ARGB1555 : tex_ARGB1555_nowrap;
+            state.tex_read = (s3d_tri->cmd_set & CMD_SET_TWE) ? tex_ARGB1555 : tex_ARGB1555_nowrap;
             break;
         default:
             s3_virge_log("bad texture type %i\n", (s3d_tri->cmd_set >> 5) & 7);
-            tex_read = (s3d_tri->cmd_set & CMD_SET_TWE) ? tex_ARGB1555 : tex_ARGB1555_nowrap;
+            state.tex_read = (s3d_tri->cmd_set & CMD_SET_TWE) ? tex_ARGB1555 : tex_ARGB1555_nowrap;
             break;
     }
 
     state.y  = s3d_tri->tys;
     state.x1 = s3d_tri->txs;
     state.x2 = s3d_tri->txend01;
-    tri(virge, s3d_tri, &state, s3d_tri->ty01, s3d_tri->TdXdY02, s3d_tri->TdXdY01);
+    tri(virge, s3d_tri, &state, s3d_tri->ty01, s3d_tri->TdXdY02, s3d_tri->TdXdY01, odd_even);
     state.x2 = s3d_tri->txend12;
-    tri(virge, s3d_tri, &state, s3d_tri->ty12, s3d_tri->TdXdY02, s3d_tri->TdXdY12);
+    tri(virge, s3d_tri, &state, s3d_tri->ty12, s3d_tri->TdXdY02, s3d_tri->TdXdY12, odd_even);
 
     end_time = plat_timer_read();
 
-    virge->blitter_time += end_time - start_time;
+    virge->blitter_time[odd_even] += end_time - start_time;
 }
 
 static void
@@ -4522,11 +4537,13 @@ s3_virge_init(const device_t *info)
 
     virge->svga.force_old_addr = 1;
 
-    virge->wake_render_thread = thread_create_event();
-    virge->wake_main_thread   = thread_create_event();
-    virge->not_full_event     = thread_create_event();
-    virge->render_thread_run  = 1;
-    virge->render_thread      = thread_create(render_thread, virge);
+    virge->wake_render_thread[0] = thread_create_event();
+    virge->wake_render_thread[1] = thread_create_event();
+    virge->wake_main_thread      = thread_create_event();
+    virge->not_full_event        = thread_create_event();
+    virge->render_thread_run     = 1;
+    virge->render_thread[0]      = thread_create(render_thread_1, virge);
+    virge->render_thread[1]      = thread_create(render_thread_2, virge);
 
     timer_add(&virge->tri_timer, s3_virge_tri_timer, virge, 0);
 
@@ -4543,11 +4560,14 @@ s3_virge_close(void *priv)
     virge_t *virge = (virge_t *) priv;
 
     virge->render_thread_run = 0;
-    thread_set_event(virge->wake_render_thread);
-    thread_wait(virge->render_thread);
+    for (uint8_t c = 0; c < 2; c++) {
+        thread_set_event(virge->wake_render_thread[c]);
+        thread_wait(virge->render_thread[c]);
+    }
     thread_destroy_event(virge->not_full_event);
     thread_destroy_event(virge->wake_main_thread);
-    thread_destroy_event(virge->wake_render_thread);
+    thread_destroy_event(virge->wake_render_thread[0]);
+    thread_destroy_event(virge->wake_render_thread[1]);
 
     svga_close(&virge->svga);
 
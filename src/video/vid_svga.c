@@ -109,6 +109,41 @@ svga_set_override(svga_t *svga, int val)
 #endif
 }
 
+/*DAC writes only record the new palette values and mark the entry dirty;
+  the 32-bit lookup entries are rebuilt here, immediately before anything
+  reads them. Palette fades that rewrite the whole DAC between frames thus
+  cost one dense conversion pass per frame instead of one conversion per
+  out instruction.*/
+void
+svga_pallook_flush(svga_t *svga)
+{
+    if (!svga->pallook_dirty_count)
+        return;
+
+    if (svga->pallook_dirty_count >= 256) {
+        /*Full rewrite - convert the whole palette in one branch-free pass.*/
+        if (svga->ramdac_type == RAMDAC_8BIT) {
+            for (int c = 0; c < 256; c++)
+                svga->pallook[c] = makecol32(svga->vgapal[c].r, svga->vgapal[c].g, svga->vgapal[c].b);
+        } else {
+            for (int c = 0; c < 256; c++)
+                svga->pallook[c] = makecol32(video_6to8[svga->vgapal[c].r & 0x3f], video_6to8[svga->vgapal[c].g & 0x3f], video_6to8[svga->vgapal[c].b & 0x3f]);
+        }
+        memset(svga->pallook_dirty, 0, sizeof(svga->pallook_dirty));
+    } else {
+        for (int c = 0; c < 256; c++) {
+            if (!svga->pallook_dirty[c])
+                continue;
+            if (svga->ramdac_type == RAMDAC_8BIT)
+                svga->pallook[c] = makecol32(svga->vgapal[c].r, svga->vgapal[c].g, svga->vgapal[c].b);
+            else
+                svga->pallook[c] = makecol32(video_6to8[svga->vgapal[c].r & 0x3f], video_6to8[svga->vgapal[c].g & 0x3f], video_6to8[svga->vgapal[c].b & 0x3f]);
+            svga->pallook_dirty[c] = 0;
+        }
+    }
+    svga->pallook_dirty_count = 0;
+}
+
 void
 svga_out(uint16_t addr, uint8_t val, void *priv)
 {
@@ -199,6 +234,7 @@ svga_out(uint16_t addr, uint8_t val, void *priv)
                     if (o != val)
                         svga_recalctimings(svga);
                 } else if (svga->attraddr == 0x11) {
+                    svga_pallook_flush(svga);
                     svga->overscan_color = svga->pallook[svga->attrregs[0x11]];
                     if (o != val)
                         svga_recalctimings(svga);
@@ -262,6 +298,7 @@ svga_out(uint16_t addr, uint8_t val, void *priv)
                     svga->chain2_write = !(val & 4);
                     svga->chain4       = (svga->chain4 & ~8) | (val & 8);
                     svga->fast         = (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && !svga->gdcreg[1]) && ((svga->chain4 && (svga->packed_chain4 || svga->force_old_addr)) || svga->fb_only) && !(svga->adv_flags & FLAG_ADDR_BY8);
+                    svga_recalc_write_handler(svga);
                     break;
 
                 default:
@@ -296,10 +333,10 @@ svga_out(uint16_t addr, uint8_t val, void *priv)
                     svga->vgapal[index].r = svga->dac_r;
                     svga->vgapal[index].g = svga->dac_g;
                     svga->vgapal[index].b = svga->dac_b;
-                    if (svga->ramdac_type == RAMDAC_8BIT)
-                        svga->pallook[index] = makecol32(svga->vgapal[index].r, svga->vgapal[index].g, svga->vgapal[index].b);
-                    else
-                        svga->pallook[index] = makecol32(video_6to8[svga->vgapal[index].r & 0x3f], video_6to8[svga->vgapal[index].g & 0x3f], video_6to8[svga->vgapal[index].b & 0x3f]);
+                    if (!svga->pallook_dirty[index]) {
+                        svga->pallook_dirty[index] = 1;
+                        svga->pallook_dirty_count++;
+                    }
                     svga->dac_pos  = 0;
                     svga->dac_addr = (svga->dac_addr + 1) & 255;
                     break;
@@ -359,6 +396,7 @@ svga_out(uint16_t addr, uint8_t val, void *priv)
             }
             svga->gdcreg[svga->gdcaddr & 15] = val;
             svga->fast                       = (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && !svga->gdcreg[1]) && ((svga->chain4 && (svga->packed_chain4 || svga->force_old_addr)) || svga->fb_only);
+            svga_recalc_write_handler(svga);
             if (((svga->gdcaddr & 15) == 5 && (val ^ o) & 0x70) || ((svga->gdcaddr & 15) == 6 && (val ^ o) & 1))
                 svga_recalctimings(svga);
             break;
@@ -571,6 +609,9 @@ svga_set_ramdac_type(svga_t *svga, int type)
                                              (svga->vgapal[c].g & 0x3f) * 4,
                                              (svga->vgapal[c].b & 0x3f) * 4);
         }
+        /*The full rebuild above covers any conversions still pending.*/
+        memset(svga->pallook_dirty, 0, sizeof(svga->pallook_dirty));
+        svga->pallook_dirty_count = 0;
     }
 }
 
@@ -595,6 +636,15 @@ svga_recalctimings(svga_t *svga)
     int              hsyncend;
 #endif
 
+    /* Anything that warrants a timing recalculation may also have redefined
+       what the text renderers put on screen (or left stale graphics in the
+       target buffer), so drop their cell cache. */
+    svga->text_cache_gen++;
+
+    /* Drivers flip the write mode and set/reset disable outside svga_out();
+       re-select the write handler whenever we get here. */
+    svga_recalc_write_handler(svga);
+
     svga->vtotal      = svga->crtc[6];
     svga->dispend     = svga->crtc[0x12];
     svga->vsyncstart  = svga->crtc[0x10];
@@ -787,6 +837,10 @@ svga_recalctimings(svga_t *svga)
     if (svga->recalctimings_ex)
         svga->recalctimings_ex(svga);
 
+    /* The card callback above may have flipped packed_chain4 or fb_only;
+       re-select the write map handler with the final register state. */
+    svga_recalc_write_handler(svga);
+
     if (ibm8514_active && (svga->dev8514 != NULL)) {
         if ((dev->local & 0xff) == 0x00)
             ibm8514_recalctimings(svga);
@@ -974,9 +1028,70 @@ svga_recalctimings(svga_t *svga)
     }
 }
 
+/* Composing a hardware cursor into the target buffer destroys the rendered
+   line under it, which used to force those lines through a full re-render
+   every frame just to repair the damage.  Instead, save the covered pixels
+   before each compose and put them back at the start of the next frame, so
+   an otherwise unchanged frame with a moving cursor re-renders nothing. */
+static int
+svga_cursor_save_line(svga_t *svga, int line)
+{
+    if (!svga->cursor_save || (svga->cursor_save_count >= SVGA_CURSOR_SAVE_LINES))
+        return 0;
+
+    svga->cursor_save_line[svga->cursor_save_count] = line;
+    memcpy(&svga->cursor_save[svga->cursor_save_count * svga->monitor->target_buffer->w],
+           svga->monitor->target_buffer->line[line],
+           svga->monitor->target_buffer->w * sizeof(uint32_t));
+    svga->cursor_save_count++;
+
+    return 1;
+}
+
+static void
+svga_cursor_restore(svga_t *svga)
+{
+    /* Restore in reverse so a line saved under both cursors gets back its
+       oldest - fully uncomposed - contents. */
+    while (svga->cursor_save_count > 0) {
+        svga->cursor_save_count--;
+        memcpy(svga->monitor->target_buffer->line[svga->cursor_save_line[svga->cursor_save_count]],
+               &svga->cursor_save[svga->cursor_save_count * svga->monitor->target_buffer->w],
+               svga->monitor->target_buffer->w * sizeof(uint32_t));
+    }
+}
+
+/* Fallback when the save buffer is exhausted: force the composited line to
+   re-render next frame, as the destructive path always did. */
+static void
+svga_cursor_dirty_line(svga_t *svga, uint32_t ma)
+{
+    svga->changedvram[ma >> 12] = svga->changedvram[(ma >> 12) + 1] = svga->interlace ? 3 : 2;
+
+    if (svga->text_cache) {
+        int line = svga->vertical_linedbl ? (svga->displine >> 1) : svga->displine;
+
+        if (line < SVGA_TEXT_CACHE_LINES) {
+            for (int c = 0; c < SVGA_TEXT_CACHE_COLS; c++)
+                svga->text_cache[(line * SVGA_TEXT_CACHE_COLS) + c].gen = svga->text_cache_gen - 1;
+        }
+    }
+}
+
 static void
 svga_do_render(svga_t *svga)
 {
+    uint32_t line_ma = svga->ma;
+
+    /* Shed only composition effort when the host is overloaded - the poll
+       state machine around us keeps running so guest-visible timing does
+       not change, and the dirty state is left frozen for the frame that
+       eventually renders. */
+    if (svga->render_skipped)
+        return;
+
+    svga_pallook_flush(svga);
+
     /* Always render a blank screen and nothing else while in DPMS mode. */
     if (svga->dpms) {
         svga_render_blank(svga);
@@ -992,6 +1107,18 @@ svga_do_render(svga_t *svga)
         svga->x_add = (svga->monitor->mon_overscan_x >> 1) - svga->scrollcache;
     }
 
+    if (svga->overlay_on && svga->text_cache) {
+        /* An overlay is being composited over this line after the renderer
+           ran - the text cell cache no longer describes what is in the
+           target buffer here, so force these cells to repaint. */
+        int line = svga->vertical_linedbl ? (svga->displine >> 1) : svga->displine;
+
+        if (line < SVGA_TEXT_CACHE_LINES) {
+            for (int c = 0; c < SVGA_TEXT_CACHE_COLS; c++)
+                svga->text_cache[(line * SVGA_TEXT_CACHE_COLS) + c].gen = svga->text_cache_gen - 1;
+        }
+    }
+
     if (svga->overlay_on) {
         if (!svga->override && svga->overlay_draw)
             svga->overlay_draw(svga, svga->displine + svga->y_add);
@@ -1001,16 +1128,26 @@ svga_do_render(svga_t *svga)
     }
 
     if (svga->dac_hwcursor_on) {
-        if (!svga->override && svga->dac_hwcursor_draw)
-            svga->dac_hwcursor_draw(svga, (svga->displine + svga->y_add + ((svga->dac_hwcursor_latch.y >= 0) ? 0 : svga->dac_hwcursor_latch.y)) & 2047);
+        if (!svga->override && svga->dac_hwcursor_draw) {
+            int line = (svga->displine + svga->y_add + ((svga->dac_hwcursor_latch.y >= 0) ? 0 : svga->dac_hwcursor_latch.y)) & 2047;
+
+            if (!svga_cursor_save_line(svga, line))
+                svga_cursor_dirty_line(svga, line_ma);
+            svga->dac_hwcursor_draw(svga, line);
+        }
         svga->dac_hwcursor_on--;
         if (svga->dac_hwcursor_on && svga->interlace)
             svga->dac_hwcursor_on--;
     }
 
     if (svga->hwcursor_on) {
-        if (!svga->override && svga->hwcursor_draw)
-            svga->hwcursor_draw(svga, (svga->displine + svga->y_add + ((svga->hwcursor_latch.y >= 0) ? 0 : svga->hwcursor_latch.y)) & 2047);
+        if (!svga->override && svga->hwcursor_draw) {
+            int line = (svga->displine + svga->y_add + ((svga->hwcursor_latch.y >= 0) ? 0 : svga->hwcursor_latch.y)) & 2047;
+
+            if (!svga_cursor_save_line(svga, line))
+                svga_cursor_dirty_line(svga, line_ma);
+            svga->hwcursor_draw(svga, line);
+        }
         svga->hwcursor_on--;
         if (svga->hwcursor_on && svga->interlace)
             svga->hwcursor_on--;
@@ -1080,9 +1217,10 @@ svga_poll(void *priv)
             if (svga->firstline == 2000) {
                 svga->firstline = svga->displine;
                 video_wait_for_buffer_monitor(svga->monitor_index);
+                svga_cursor_restore(svga);
             }
 
-            if (svga->hwcursor_on || svga->dac_hwcursor_on || svga->overlay_on) {
+            if (svga->overlay_on) {
                 svga->changedvram[svga->ma >> 12] = svga->changedvram[(svga->ma >> 12) + 1] = svga->interlace ? 3 : 2;
             }
 
@@ -1198,12 +1336,35 @@ svga_poll(void *priv)
 
             svga->blink = (svga->blink + 1) & 0x7f;
 
-            for (x = 0; x < ((svga->vram_mask + 1) >> 12); x++) {
-                if (svga->changedvram[x])
-                    svga->changedvram[x]--;
+            if (svga->render_skipped) {
+                /* Nothing was composed this frame - the target buffer holds
+                   the last rendered frame, and the dirty state is carried
+                   over untouched so no pending change can expire unseen. */
+                svga->frame_unchanged     = 1;
+                svga->text_render_active  = 0;
+                svga->text_render_changed = 0;
+            } else {
+                /* If no VRAM page or full-change tick was live this frame, the
+                   render functions skipped every line and the target buffer still
+                   holds the previous frame - remember that so the blit below can
+                   be skipped too. */
+                svga->frame_unchanged = !svga->fullchange;
+                /* If a cell-caching text renderer ran and found every character
+                   cell identical to the previous frame, the full-change tick
+                   (usually just the blink counter) produced no new pixels. */
+                if (svga->text_render_active && !svga->text_render_changed)
+                    svga->frame_unchanged = 1;
+                svga->text_render_active  = 0;
+                svga->text_render_changed = 0;
+                for (x = 0; x < ((svga->vram_mask + 1) >> 12); x++) {
+                    if (svga->changedvram[x]) {
+                        svga->changedvram[x]--;
+                        svga->frame_unchanged = 0;
+                    }
+                }
+                if (svga->fullchange)
+                    svga->fullchange--;
             }
-            if (svga->fullchange)
-                svga->fullchange--;
         }
         if (svga->vc == svga->vsyncstart) {
             svga->dispon = 0;
@@ -1217,7 +1378,9 @@ svga_poll(void *priv)
 
             wx = x;
 
-            if (!svga->override) {
+            /* Keep blitting while a screenshot is pending - it is taken on
+               the blit side. */
+            if (!svga->override && (!svga->frame_unchanged || svga->monitor->mon_screenshots)) {
                 if (svga->vertical_linedbl) {
                     wy = (svga->lastline - svga->firstline) << 1;
                     svga_doblit(wx, wy, svga);
@@ -1291,6 +1454,18 @@ svga_poll(void *priv)
 
             svga->overlay_on    = 0;
             svga->overlay_latch = svga->overlay;
+
+            /* Adaptive degradation under host overload: compose only every
+               Nth frame as reported by the blit path, never when a screenshot
+               is pending.  Everything else in this state machine still runs. */
+            ret = video_get_render_skip_monitor(svga->monitor_index);
+            if (ret && !svga->override && !svga->monitor->mon_screenshots && (svga->render_skip_count < ret)) {
+                svga->render_skip_count++;
+                svga->render_skipped = 1;
+            } else {
+                svga->render_skip_count = 0;
+                svga->render_skipped    = 0;
+            }
         }
         if (svga->sc == (svga->crtc[10] & 31))
             svga->con = 1;
@@ -1344,6 +1519,8 @@ svga_init(const device_t *info, svga_t *svga, void *priv, int memsize,
     svga->vram_display_mask = svga->vram_mask = memsize - 1;
     svga->decode_mask                         = 0x7fffff;
     svga->changedvram                         = calloc(memsize >> 12, 1);
+    svga->text_cache                          = calloc(SVGA_TEXT_CACHE_LINES * SVGA_TEXT_CACHE_COLS, sizeof(svga_text_cell_t));
+    svga->cursor_save                         = calloc(SVGA_CURSOR_SAVE_LINES * svga->monitor->target_buffer->w, sizeof(uint32_t));
     svga->recalctimings_ex                    = recalctimings_ex;
     svga->video_in                            = video_in;
     svga->video_out                           = video_out;
@@ -1352,6 +1529,8 @@ svga_init(const device_t *info, svga_t *svga, void *priv, int memsize,
     svga->conv_16to32                         = svga_conv_16to32;
     svga->render                              = svga_render_blank;
 
+    svga_recalc_write_handler(svga);
+
     svga->hwcursor.cur_xsize = svga->hwcursor.cur_ysize = 32;
 
     svga->dac_hwcursor.cur_xsize = svga->dac_hwcursor.cur_ysize = 32;
@@ -1392,6 +1571,8 @@ svga_init(const device_t *info, svga_t *svga, void *priv, int memsize,
 void
 svga_close(svga_t *svga)
 {
+    free(svga->cursor_save);
+    free(svga->text_cache);
     free(svga->changedvram);
     free(svga->vram);
 
@@ -1438,17 +1619,285 @@ svga_decode_addr(svga_t *svga, uint32_t addr, int write)
     return addr;
 }
 
+/* Specialized plane write handlers for write modes 0-3, selected by
+   svga_recalc_write_handler() whenever the registers they depend on change,
+   so the per-byte path runs straight-line code instead of re-evaluating the
+   write mode, fast path conditions and ALU function on every access. The
+   write mask here always carries plane 0 in bit 0; the MSB-first Cirrus
+   extended mask is folded over before dispatch. */
+static void
+svga_write_alu_set(svga_t *svga, uint32_t addr, const latch_t *vall, uint32_t writemask2, uint8_t count)
+{
+    uint8_t i;
+
+    for (i = 0; i < count; i++) {
+        if (writemask2 & (1 << i))
+            svga->vram[addr | i] = (vall->b[i] & svga->gdcreg[8]) | (svga->latch.b[i] & ~svga->gdcreg[8]);
+    }
+}
+
+static void
+svga_write_alu_and(svga_t *svga, uint32_t addr, const latch_t *vall, uint32_t writemask2, uint8_t count)
+{
+    uint8_t i;
+
+    for (i = 0; i < count; i++) {
+        if (writemask2 & (1 << i))
+            svga->vram[addr | i] = (vall->b[i] | ~svga->gdcreg[8]) & svga->latch.b[i];
+    }
+}
+
+static void
+svga_write_alu_or(svga_t *svga, uint32_t addr, const latch_t *vall, uint32_t writemask2, uint8_t count)
+{
+    uint8_t i;
+
+    for (i = 0; i < count; i++) {
+        if (writemask2 & (1 << i))
+            svga->vram[addr | i] = (vall->b[i] & svga->gdcreg[8]) | svga->latch.b[i];
+    }
+}
+
+static void
+svga_write_alu_xor(svga_t *svga, uint32_t addr, const latch_t *vall, uint32_t writemask2, uint8_t count)
+{
+    uint8_t i;
+
+    for (i = 0; i < count; i++) {
+        if (writemask2 & (1 << i))
+            svga->vram[addr | i] = (vall->b[i] & svga->gdcreg[8]) ^ svga->latch.b[i];
+    }
+}
+
+/* Write mode 0 with an all-ones bit mask, Set function and set/reset not in
+   effect - plain byte stores, the dominant case for planar blits. */
+static void
+svga_write_mode0_fast(svga_t *svga, uint32_t addr, uint8_t val, uint32_t writemask2, uint8_t count)
+{
+    uint8_t i;
+
+    val = ((val >> (svga->gdcreg[3] & 7)) | (val << (8 - (svga->gdcreg[3] & 7))));
+
+    for (i = 0; i < count; i++) {
+        if (writemask2 & (1 << i))
+            svga->vram[addr | i] = val;
+    }
+}
+
+static void
+svga_write_mode0(svga_t *svga, uint32_t addr, uint8_t val, uint32_t writemask2, uint8_t count)
+{
+    latch_t vall;
+    uint8_t i;
+
+    val = ((val >> (svga->gdcreg[3] & 7)) | (val << (8 - (svga->gdcreg[3] & 7))));
+
+    for (i = 0; i < count; i++) {
+        if (svga->gdcreg[1] & (1 << i))
+            vall.b[i] = !!(svga->gdcreg[0] & (1 << i)) * 0xff;
+        else
+            vall.b[i] = val;
+    }
+
+    svga->plane_alu(svga, addr, &vall, writemask2, count);
+}
+
+static void
+svga_write_mode1(svga_t *svga, uint32_t addr, UNUSED(uint8_t val), uint32_t writemask2, uint8_t count)
+{
+    uint8_t i;
+
+    for (i = 0; i < count; i++) {
+        if (writemask2 & (1 << i))
+            svga->vram[addr | i] = svga->latch.b[i];
+    }
+}
+
+/* Write mode 2 with Set function and set/reset not in effect. */
+static void
+svga_write_mode2_fast(svga_t *svga, uint32_t addr, uint8_t val, uint32_t writemask2, uint8_t count)
+{
+    latch_t vall;
+    uint8_t i;
+
+    for (i = 0; i < count; i++)
+        vall.b[i] = !!(val & (1 << i)) * 0xff;
+
+    for (i = 0; i < count; i++) {
+        if (writemask2 & (1 << i))
+            svga->vram[addr | i] = (vall.b[i] & svga->gdcreg[8]) | (svga->latch.b[i] & ~svga->gdcreg[8]);
+    }
+}
+
+static void
+svga_write_mode2(svga_t *svga, uint32_t addr, uint8_t val, uint32_t writemask2, uint8_t count)
+{
+    latch_t vall;
+    uint8_t i;
+
+    for (i = 0; i < count; i++)
+        vall.b[i] = !!(val & (1 << i)) * 0xff;
+
+    svga->plane_alu(svga, addr, &vall, writemask2, count);
+}
+
+static void
+svga_write_mode3(svga_t *svga, uint32_t addr, uint8_t val, uint32_t writemask2, uint8_t count)
+{
+    latch_t vall;
+    uint8_t wm = svga->gdcreg[8];
+    uint8_t i;
+
+    val = ((val >> (svga->gdcreg[3] & 7)) | (val << (8 - (svga->gdcreg[3] & 7))));
+    svga->gdcreg[8] &= val;
+
+    for (i = 0; i < count; i++)
+        vall.b[i] = !!(svga->gdcreg[0] & (1 << i)) * 0xff;
+
+    svga->plane_alu(svga, addr, &vall, writemask2, count);
+
+    svga->gdcreg[8] = wm;
+}
+
+/* Fold an MSB-first write mask over so the plane loops can test (1 << i). */
+static __inline uint32_t
+svga_mask_msb(uint32_t mask)
+{
+    mask = ((mask & 0x0f) << 4) | ((mask & 0xf0) >> 4);
+    mask = ((mask & 0x33) << 2) | ((mask & 0xcc) >> 2);
+    mask = ((mask & 0x55) << 1) | ((mask & 0xaa) >> 1);
+
+    return mask;
+}
+
+/* Specialized write map handlers, one per combination reachable from the
+   old svga_write_common() dispatch chain, expanded from the template in
+   vid_svga_write.h and installed by svga_recalc_write_handler(). */
+#define WRITE_MAP_NAME svga_write_map_by16_ven
+#define WRITE_MAP_SETUP(svga, addr, writemask2, linear) \
+    addr <<= 4
+#define WRITE_MAP_VEN
+#include "vid_svga_write.h"
+
+#define WRITE_MAP_NAME svga_write_map_by8
+#define WRITE_MAP_SETUP(svga, addr, writemask2, linear) \
+    addr <<= 3
+#define WRITE_MAP_BY8
+#include "vid_svga_write.h"
+
+#define WRITE_MAP_NAME svga_write_map_packed
+#define WRITE_MAP_SETUP(svga, addr, writemask2, linear) \
+    do {                                                \
+        writemask2 = 1 << (addr & 3);                   \
+        addr &= ~3;                                     \
+    } while (0)
+#include "vid_svga_write.h"
+
+#define WRITE_MAP_NAME svga_write_map_chain4
+#define WRITE_MAP_SETUP(svga, addr, writemask2, linear)                            \
+    do {                                                                           \
+        writemask2 = 1 << (addr & 3);                                              \
+        if (!linear)                                                               \
+            addr &= ~3;                                                            \
+        addr = ((addr & 0xfffc) << 2) | ((addr & 0x30000) >> 14) | (addr & ~0x3ffff); \
+    } while (0)
+#include "vid_svga_write.h"
+
+#define WRITE_MAP_NAME svga_write_map_chain2
+#define WRITE_MAP_SETUP(svga, addr, writemask2, linear) \
+    do {                                                \
+        writemask2 &= ~0xa;                             \
+        if (addr & 1)                                   \
+            writemask2 <<= 1;                           \
+        addr &= ~1;                                     \
+        addr <<= 2;                                     \
+    } while (0)
+#include "vid_svga_write.h"
+
+#define WRITE_MAP_NAME svga_write_map_chain2_ven
+#define WRITE_MAP_SETUP(svga, addr, writemask2, linear) \
+    do {                                                \
+        writemask2 &= ~0xa;                             \
+        if (addr & 1)                                   \
+            writemask2 <<= 1;                           \
+        addr &= ~1;                                     \
+        addr <<= 2;                                     \
+    } while (0)
+#define WRITE_MAP_VEN
+#include "vid_svga_write.h"
+
+#define WRITE_MAP_NAME svga_write_map_planar
+#define WRITE_MAP_SETUP(svga, addr, writemask2, linear) \
+    addr <<= 2
+#include "vid_svga_write.h"
+
+#define WRITE_MAP_NAME svga_write_map_planar_ven
+#define WRITE_MAP_SETUP(svga, addr, writemask2, linear) \
+    addr <<= 2
+#define WRITE_MAP_VEN
+#include "vid_svga_write.h"
+
+void
+svga_recalc_write_handler(svga_t *svga)
+{
+    switch (svga->writemode) {
+        case 0:
+            if ((svga->gdcreg[8] == 0xff) && !(svga->gdcreg[3] & 0x18) && (!svga->gdcreg[1] || svga->set_reset_disabled))
+                svga->plane_write = svga_write_mode0_fast;
+            else
+                svga->plane_write = svga_write_mode0;
+            break;
+        case 1:
+            svga->plane_write = svga_write_mode1;
+            break;
+        case 2:
+            if (!(svga->gdcreg[3] & 0x18) && (!svga->gdcreg[1] || svga->set_reset_disabled))
+                svga->plane_write = svga_write_mode2_fast;
+            else
+                svga->plane_write = svga_write_mode2;
+            break;
+        default:
+            svga->plane_write = svga_write_mode3;
+            break;
+    }
+
+    switch (svga->gdcreg[3] & 0x18) {
+        case 0x08:
+            svga->plane_alu = svga_write_alu_and;
+            break;
+        case 0x10:
+            svga->plane_alu = svga_write_alu_or;
+            break;
+        case 0x18:
+            svga->plane_alu = svga_write_alu_xor;
+            break;
+        default:
+            svga->plane_alu = svga_write_alu_set;
+            break;
+    }
+
+    /* Mirror the priority of the old per-access dispatch chain when
+       installing the specialized address map handler. */
+    if ((svga->adv_flags & FLAG_ADDR_BY16) && (svga->writemode >= 4))
+        svga->write_map = svga_write_map_by16_ven;
+    else if ((svga->adv_flags & FLAG_ADDR_BY8) && (svga->writemode < 4))
+        svga->write_map = svga_write_map_by8;
+    else if (((svga->chain4 && (svga->packed_chain4 || svga->force_old_addr)) || svga->fb_only) && (svga->writemode < 4))
+        svga->write_map = svga_write_map_packed;
+    else if (svga->chain4 && (svga->writemode < 4))
+        svga->write_map = svga_write_map_chain4;
+    else if (svga->chain2_write)
+        svga->write_map = (svga->writemode >= 4) ? svga_write_map_chain2_ven : svga_write_map_chain2;
+    else
+        svga->write_map = (svga->writemode >= 4) ? svga_write_map_planar_ven : svga_write_map_planar;
+}
+
 static __inline void
 svga_write_common(uint32_t addr, uint8_t val, uint8_t linear, void *priv)
 {
     svga_t *svga       = (svga_t *) priv;
     xga_t  *xga        = (xga_t *) svga->xga;
     int     writemask2 = svga->writemask;
-    int     reset_wm   = 0;
-    latch_t vall;
-    uint8_t wm         = svga->writemask;
-    uint8_t count;
-    uint8_t i;
 
     if (svga->adv_flags & FLAG_ADDR_BY8)
         writemask2 = svga->seqregs[2];
@@ -1499,165 +1948,7 @@ svga_write_common(uint32_t addr, uint8_t val, uint8_t linear, void *priv)
     if (!(svga->gdcreg[6] & 1))
         svga->fullchange = 2;
 
-    if ((svga->adv_flags & FLAG_ADDR_BY16) && (svga->writemode == 4 || svga->writemode == 5))
-        addr <<= 4;
-    else if ((svga->adv_flags & FLAG_ADDR_BY8) && (svga->writemode < 4))
-        addr <<= 3;
-    else if (((svga->chain4 && (svga->packed_chain4 || svga->force_old_addr)) || svga->fb_only) && (svga->writemode < 4)) {
-        writemask2 = 1 << (addr & 3);
-        addr &= ~3;
-    } else if (svga->chain4 && (svga->writemode < 4)) {
-        writemask2 = 1 << (addr & 3);
-        if (!linear)
-            addr &= ~3;
-        addr = ((addr & 0xfffc) << 2) | ((addr & 0x30000) >> 14) | (addr & ~0x3ffff);
-    } else if (svga->chain2_write) {
-        writemask2 &= ~0xa;
-        if (addr & 1)
-            writemask2 <<= 1;
-        addr &= ~1;
-        addr <<= 2;
-    } else
-        addr <<= 2;
-
-    addr &= svga->decode_mask;
-
-    if (svga->translate_address)
-        addr = svga->translate_address(addr, priv);
-
-    if (addr >= svga->vram_max)
-        return;
-
-    addr &= svga->vram_mask;
-
-    svga->changedvram[addr >> 12] = svga->monitor->mon_changeframecount;
-
-    count = 4;
-    if (svga->adv_flags & FLAG_LATCH8)
-        count = 8;
-
-    /* Undocumented Cirrus Logic behavior: The datasheet says that, with EXT_WRITE and FLAG_ADDR_BY8, the write mask only
-       changes meaning in write modes 4 and 5, as well as write mode 1. In reality, however, all other write modes are also
-       affected, as proven by the Windows 3.1 CL-GD 5422/4 drivers in 8bpp modes. */
-    switch (svga->writemode) {
-        case 0:
-            val = ((val >> (svga->gdcreg[3] & 7)) | (val << (8 - (svga->gdcreg[3] & 7))));
-            if ((svga->gdcreg[8] == 0xff) && !(svga->gdcreg[3] & 0x18) && (!svga->gdcreg[1] || svga->set_reset_disabled)) {
-                for (i = 0; i < count; i++) {
-                    if ((svga->adv_flags & FLAG_EXT_WRITE) && (svga->adv_flags & FLAG_ADDR_BY8)) {
-                        if (writemask2 & (0x80 >> i))
-                            svga->vram[addr | i] = val;
-                    } else {
-                        if (writemask2 & (1 << i))
-                            svga->vram[addr | i] = val;
-                    }
-                }
-                return;
-            } else {
-                for (i = 0; i < count; i++) {
-                    if (svga->gdcreg[1] & (1 << i))
-                        vall.b[i] = !!(svga->gdcreg[0] & (1 << i)) * 0xff;
-                    else
-                        vall.b[i] = val;
-                }
-            }
-            break;
-        case 1:
-            for (i = 0; i < count; i++) {
-                if ((svga->adv_flags & FLAG_EXT_WRITE) && (svga->adv_flags & FLAG_ADDR_BY8)) {
-                    if (writemask2 & (0x80 >> i))
-                        svga->vram[addr | i] = svga->latch.b[i];
-                } else {
-                    if (writemask2 & (1 << i))
-                        svga->vram[addr | i] = svga->latch.b[i];
-                }
-            }
-            return;
-        case 2:
-            for (i = 0; i < count; i++)
-                vall.b[i] = !!(val & (1 << i)) * 0xff;
-
-            if (!(svga->gdcreg[3] & 0x18) && (!svga->gdcreg[1] || svga->set_reset_disabled)) {
-                for (i = 0; i < count; i++) {
-                    if ((svga->adv_flags & FLAG_EXT_WRITE) && (svga->adv_flags & FLAG_ADDR_BY8)) {
-                        if (writemask2 & (0x80 >> i))
-                            svga->vram[addr | i] = (vall.b[i] & svga->gdcreg[8]) | (svga->latch.b[i] & ~svga->gdcreg[8]);
-                    } else {
-                        if (writemask2 & (1 << i))
-                            svga->vram[addr | i] = (vall.b[i] & svga->gdcreg[8]) | (svga->latch.b[i] & ~svga->gdcreg[8]);
-                    }
-                }
-                return;
-            }
-            break;
-        case 3:
-            val = ((val >> (svga->gdcreg[3] & 7)) | (val << (8 - (svga->gdcreg[3] & 7))));
-            wm  = svga->gdcreg[8];
-            svga->gdcreg[8] &= val;
-
-            for (i = 0; i < count; i++)
-                vall.b[i] = !!(svga->gdcreg[0] & (1 << i)) * 0xff;
-
-            reset_wm = 1;
-            break;
-        default:
-            if (svga->ven_write)
-                svga->ven_write(svga, val, addr);
-            return;
-    }
-
-    switch (svga->gdcreg[3] & 0x18) {
-        case 0x00: /* Set */
-            for (i = 0; i < count; i++) {
-                if ((svga->adv_flags & FLAG_EXT_WRITE) && (svga->adv_flags & FLAG_ADDR_BY8)) {
-                    if (writemask2 & (0x80 >> i))
-                        svga->vram[addr | i] = (vall.b[i] & svga->gdcreg[8]) | (svga->latch.b[i] & ~svga->gdcreg[8]);
-                } else {
-                    if (writemask2 & (1 << i))
-                        svga->vram[addr | i] = (vall.b[i] & svga->gdcreg[8]) | (svga->latch.b[i] & ~svga->gdcreg[8]);
-                }
-            }
-            break;
-        case 0x08: /* AND */
-            for (i = 0; i < count; i++) {
-                if ((svga->adv_flags & FLAG_EXT_WRITE) && (svga->adv_flags & FLAG_ADDR_BY8)) {
-                    if (writemask2 & (0x80 >> i))
-                        svga->vram[addr | i] = (vall.b[i] | ~svga->gdcreg[8]) & svga->latch.b[i];
-                } else {
-                    if (writemask2 & (1 << i))
-                        svga->vram[addr | i] = (vall.b[i] | ~svga->gdcreg[8]) & svga->latch.b[i];
-                }
-            }
-            break;
-        case 0x10: /* OR */
-            for (i = 0; i < count; i++) {
-                if ((svga->adv_flags & FLAG_EXT_WRITE) && (svga->adv_flags & FLAG_ADDR_BY8)) {
-                    if (writemask2 & (0x80 >> i))
-                        svga->vram[addr | i] = (vall.b[i] & svga->gdcreg[8]) | svga->latch.b[i];
-                } else {
-                    if (writemask2 & (1 << i))
-                        svga->vram[addr | i] = (vall.b[i] & svga->gdcreg[8]) | svga->latch.b[i];
-                }
-            }
-            break;
-        case 0x18: /* XOR */
-            for (i = 0; i < count; i++) {
-                if ((svga->adv_flags & FLAG_EXT_WRITE) && (svga->adv_flags & FLAG_ADDR_BY8)) {
-                    if (writemask2 & (0x80 >> i))
-                        svga->vram[addr | i] = (vall.b[i] & svga->gdcreg[8]) ^ svga->latch.b[i];
-                } else {
-                    if (writemask2 & (1 << i))
-                        svga->vram[addr | i] = (vall.b[i] & svga->gdcreg[8]) ^ svga->latch.b[i];
-                }
-            }
-            break;
-
-        default:
-            break;
-    }
-
-    if (reset_wm)
-        svga->gdcreg[8] = wm;
+    svga->write_map(svga, addr, val, writemask2, linear);
 }
 
 static __inline uint8_t
@@ -44,6 +44,19 @@ svga_lookup_lut_ram(svga_t* svga, uint32_t val)
 
 #define lookup_lut(val) svga_lookup_lut_ram(svga, val)
 
+/*
+   The stock conv_16to32 handler is a plain table lookup - resolve the table
+   once per scanline so the 15/16bpp loops do not pay an indirect call per
+   pixel. Cards that install their own handler keep the indirect path.
+ */
+static __inline uint32_t
+svga_conv16(svga_t *svga, const uint32_t *conv, uint32_t color, uint8_t bpp)
+{
+    if (conv)
+        return conv[color];
+    return svga->conv_16to32(svga, color, bpp);
+}
+
 void
 svga_render_null(svga_t *svga)
 {
@@ -132,6 +145,48 @@ svga_render_overscan_right(svga_t *svga)
         *line_ptr++ = svga->overscan_color;
 }
 
+/* Resolve the text cache slice for the current scanline, bumping the cache
+   generation whenever a global input that is not part of the per-cell tuple
+   (character width, line graphics enable, panning, display width) changed. */
+static svga_text_cell_t *
+svga_text_cache_line(svga_t *svga)
+{
+    uint32_t key;
+    int      line;
+
+    svga->text_render_active = 1;
+
+    if (!svga->text_cache)
+        return NULL;
+
+    key = (svga->seqregs[1] & 1) | ((svga->attrregs[0x10] & 4) ? 2 : 0) | ((svga->scrollcache & 0x3f) << 2) | ((svga->x_add & 0xff) << 8) | (svga->hdisp << 16);
+    if (key != svga->text_cache_key) {
+        svga->text_cache_key = key;
+        svga->text_cache_gen++;
+    }
+
+    line = svga->vertical_linedbl ? (svga->displine >> 1) : svga->displine;
+    if (line >= SVGA_TEXT_CACHE_LINES)
+        return NULL;
+
+    return &svga->text_cache[line * SVGA_TEXT_CACHE_COLS];
+}
+
+/* The cached tuple covers every input the cell's pixels depend on - the font
+   scanline byte, the resolved colors (which fold in the attribute, palette,
+   cursor and blink state) and the character code for the 9th-column rule -
+   so a matching cell is guaranteed to produce the pixels already in the
+   target buffer. */
+static int
+svga_text_cell_unchanged(svga_t *svga, const svga_text_cell_t *cache, int col, uint8_t chr, uint8_t dat, uint32_t fg, uint32_t bg)
+{
+    if (cache && (col < SVGA_TEXT_CACHE_COLS) && (cache[col].gen == svga->text_cache_gen) && (cache[col].chr == chr) && (cache[col].dat == dat) && (cache[col].fg == fg) && (cache[col].bg == bg))
+        return 1;
+
+    svga->text_render_changed = 1;
+    return 0;
+}
+
 void
 svga_render_text_40(svga_t *svga)
 {
@@ -155,6 +210,10 @@ svga_render_text_40(svga_t *svga)
     svga->lastline_draw = svga->displine;
 
     if (svga->fullchange) {
+        svga_text_cell_t *cache     = svga_text_cache_line(svga);
+        int               cache_upd = !svga->vertical_linedbl || (svga->displine & 1);
+        int               col       = 0;
+
         p    = &svga->monitor->target_buffer->line[svga->displine + svga->y_add][svga->x_add];
         xinc = (svga->seqregs[1] & 1) ? 16 : 18;
 
@@ -192,19 +251,29 @@ svga_render_text_40(svga_t *svga)
             }
 
             dat = svga->vram[charaddr + (svga->sc << 2)];
-            if (svga->seqregs[1] & 1) {
-                for (xx = 0; xx < 16; xx += 2)
-                    p[xx] = p[xx + 1] = (dat & (0x80 >> (xx >> 1))) ? fg : bg;
-            } else {
-                for (xx = 0; xx < 16; xx += 2)
-                    p[xx] = p[xx + 1] = (dat & (0x80 >> (xx >> 1))) ? fg : bg;
-                if ((chr & ~0x1f) != 0xc0 || !(svga->attrregs[0x10] & 4))
-                    p[16] = p[17] = bg;
-                else
-                    p[16] = p[17] = (dat & 1) ? fg : bg;
+            if (!svga_text_cell_unchanged(svga, cache, col, chr, dat, fg, bg)) {
+                if (cache && cache_upd && (col < SVGA_TEXT_CACHE_COLS)) {
+                    cache[col].chr = chr;
+                    cache[col].dat = dat;
+                    cache[col].fg  = fg;
+                    cache[col].bg  = bg;
+                    cache[col].gen = svga->text_cache_gen;
+                }
+                if (svga->seqregs[1] & 1) {
+                    for (xx = 0; xx < 16; xx += 2)
+                        p[xx] = p[xx + 1] = (dat & (0x80 >> (xx >> 1))) ? fg : bg;
+                } else {
+                    for (xx = 0; xx < 16; xx += 2)
+                        p[xx] = p[xx + 1] = (dat & (0x80 >> (xx >> 1))) ? fg : bg;
+                    if ((chr & ~0x1f) != 0xc0 || !(svga->attrregs[0x10] & 4))
+                        p[16] = p[17] = bg;
+                    else
+                        p[16] = p[17] = (dat & 1) ? fg : bg;
+                }
             }
             svga->ma += 4;
             p += xinc;
+            col++;
         }
         svga->ma &= svga->vram_display_mask;
     }
@@ -233,6 +302,10 @@ svga_render_text_80(svga_t *svga)
     svga->lastline_draw = svga->displine;
 
     if (svga->fullchange) {
+        svga_text_cell_t *cache     = svga_text_cache_line(svga);
+        int               cache_upd = !svga->vertical_linedbl || (svga->displine & 1);
+        int               col       = 0;
+
         p    = &svga->monitor->target_buffer->line[svga->displine + svga->y_add][svga->x_add];
         xinc = (svga->seqregs[1] & 1) ? 8 : 9;
 
@@ -269,19 +342,29 @@ svga_render_text_80(svga_t *svga)
             }
 
             dat = svga->vram[charaddr + (svga->sc << 2)];
-            if (svga->seqregs[1] & 1) {
-                for (xx = 0; xx < 8; xx++)
-                    p[xx] = (dat & (0x80 >> xx)) ? fg : bg;
-            } else {
-                for (xx = 0; xx < 8; xx++)
-                    p[xx] = (dat & (0x80 >> xx)) ? fg : bg;
-                if ((chr & ~0x1F) != 0xC0 || !(svga->attrregs[0x10] & 4))
-                    p[8] = bg;
-                else
-                    p[8] = (dat & 1) ? fg : bg;
+            if (!svga_text_cell_unchanged(svga, cache, col, chr, dat, fg, bg)) {
+                if (cache && cache_upd && (col < SVGA_TEXT_CACHE_COLS)) {
+                    cache[col].chr = chr;
+                    cache[col].dat = dat;
+                    cache[col].fg  = fg;
+                    cache[col].bg  = bg;
+                    cache[col].gen = svga->text_cache_gen;
+                }
+                if (svga->seqregs[1] & 1) {
+                    for (xx = 0; xx < 8; xx++)
+                        p[xx] = (dat & (0x80 >> xx)) ? fg : bg;
+                } else {
+                    for (xx = 0; xx < 8; xx++)
+                        p[xx] = (dat & (0x80 >> xx)) ? fg : bg;
+                    if ((chr & ~0x1F) != 0xC0 || !(svga->attrregs[0x10] & 4))
+                        p[8] = bg;
+                    else
+                        p[8] = (dat & 1) ? fg : bg;
+                }
             }
             svga->ma += 4;
             p += xinc;
+            col++;
         }
         svga->ma &= svga->vram_display_mask;
     }
@@ -551,6 +634,31 @@ svga_render_indexed_gfx(svga_t *svga, bool highres, bool combine8bits)
         svga->firstline_draw = svga->displine;
     svga->lastline_draw = svga->displine;
 
+    /*
+       Packed 8bpp with the shifter bypassed and no plane masking or blinking
+       in effect - every VRAM byte maps straight through map8, so the planar
+       shifter emulation below is not needed. This covers the usual SVGA 8bpp
+       modes.
+     */
+    if (combine8bits && highres && !svga->ati_4color && !svga->packed_4bpp
+        && !svga->force_old_addr && !svga->remap_required
+        && (incbypow2 == 0) && (incevery == 1) && (loadevery == 1)
+        && !attrblink && (planemask == 0xffffffff)) {
+        for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 4) {
+            const uint32_t dat = *(uint32_t *) &svga->vram[svga->ma & svga->vram_display_mask];
+
+            p[0] = svga->map8[dat & 0xff];
+            p[1] = svga->map8[(dat >> 8) & 0xff];
+            p[2] = svga->map8[(dat >> 16) & 0xff];
+            p[3] = svga->map8[dat >> 24];
+
+            svga->ma += 4;
+            svga->ma &= svga->vram_display_mask;
+            p += 4;
+        }
+        return;
+    }
+
     uint32_t incr_counter = 0;
     uint32_t load_counter = 0;
     uint32_t edat         = 0;
@@ -1065,6 +1173,8 @@ svga_render_15bpp_lowres(svga_t *svga)
     uint32_t  changed_addr;
     uint32_t  addr;
 
+    const uint32_t *conv = (svga->conv_16to32 == svga_conv_16to32) ? video_15to32 : NULL;
+
     if ((svga->displine + svga->y_add) < 0)
         return;
 
@@ -1079,13 +1189,13 @@ svga_render_15bpp_lowres(svga_t *svga)
             for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 4) {
                 dat = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1)) & svga->vram_display_mask]);
 
-                p[x << 1] = p[(x << 1) + 1] = svga->conv_16to32(svga, dat & 0xffff, 15);
-                p[(x << 1) + 2] = p[(x << 1) + 3] = svga->conv_16to32(svga, dat >> 16, 15);
+                p[x << 1] = p[(x << 1) + 1] = svga_conv16(svga, conv, dat & 0xffff, 15);
+                p[(x << 1) + 2] = p[(x << 1) + 3] = svga_conv16(svga, conv, dat >> 16, 15);
 
                 dat = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 4) & svga->vram_display_mask]);
 
-                p[(x << 1) + 4] = p[(x << 1) + 5] = svga->conv_16to32(svga, dat & 0xffff, 15);
-                p[(x << 1) + 6] = p[(x << 1) + 7] = svga->conv_16to32(svga, dat >> 16, 15);
+                p[(x << 1) + 4] = p[(x << 1) + 5] = svga_conv16(svga, conv, dat & 0xffff, 15);
+                p[(x << 1) + 6] = p[(x << 1) + 7] = svga_conv16(svga, conv, dat >> 16, 15);
             }
             svga->ma += x << 1;
             svga->ma &= svga->vram_display_mask;
@@ -1104,13 +1214,13 @@ svga_render_15bpp_lowres(svga_t *svga)
                 for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 4) {
                     dat = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1)) & svga->vram_display_mask]);
 
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 15);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 15);
 
                     dat = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 4) & svga->vram_display_mask]);
 
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 15);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 15);
                 }
                 svga->ma += x << 1;
             } else {
@@ -1118,8 +1228,8 @@ svga_render_15bpp_lowres(svga_t *svga)
                     addr = svga->remap_func(svga, svga->ma);
                     dat  = *(uint32_t *) (&svga->vram[addr & svga->vram_display_mask]);
 
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 15);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 15);
                     svga->ma += 4;
                 }
             }
@@ -1137,6 +1247,8 @@ svga_render_15bpp_highres(svga_t *svga)
     uint32_t  changed_addr;
     uint32_t  addr;
 
+    const uint32_t *conv = (svga->conv_16to32 == svga_conv_16to32) ? video_15to32 : NULL;
+
     if ((svga->displine + svga->y_add) < 0)
         return;
 
@@ -1150,20 +1262,20 @@ svga_render_15bpp_highres(svga_t *svga)
 
             for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 8) {
                 dat      = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1)) & svga->vram_display_mask]);
-                p[x]     = svga->conv_16to32(svga, dat & 0xffff, 15);
-                p[x + 1] = svga->conv_16to32(svga, dat >> 16, 15);
+                p[x]     = svga_conv16(svga, conv, dat & 0xffff, 15);
+                p[x + 1] = svga_conv16(svga, conv, dat >> 16, 15);
 
                 dat      = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 4) & svga->vram_display_mask]);
-                p[x + 2] = svga->conv_16to32(svga, dat & 0xffff, 15);
-                p[x + 3] = svga->conv_16to32(svga, dat >> 16, 15);
+                p[x + 2] = svga_conv16(svga, conv, dat & 0xffff, 15);
+                p[x + 3] = svga_conv16(svga, conv, dat >> 16, 15);
 
                 dat      = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 8) & svga->vram_display_mask]);
-                p[x + 4] = svga->conv_16to32(svga, dat & 0xffff, 15);
-                p[x + 5] = svga->conv_16to32(svga, dat >> 16, 15);
+                p[x + 4] = svga_conv16(svga, conv, dat & 0xffff, 15);
+                p[x + 5] = svga_conv16(svga, conv, dat >> 16, 15);
 
                 dat      = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 12) & svga->vram_display_mask]);
-                p[x + 6] = svga->conv_16to32(svga, dat & 0xffff, 15);
-                p[x + 7] = svga->conv_16to32(svga, dat >> 16, 15);
+                p[x + 6] = svga_conv16(svga, conv, dat & 0xffff, 15);
+                p[x + 7] = svga_conv16(svga, conv, dat >> 16, 15);
             }
             svga->ma += x << 1;
             svga->ma &= svga->vram_display_mask;
@@ -1181,20 +1293,20 @@ svga_render_15bpp_highres(svga_t *svga)
             if (!svga->remap_required) {
                 for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 8) {
                     dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1)) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 15);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 15);
 
                     dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 4) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 15);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 15);
 
                     dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 8) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 15);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 15);
 
                     dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 12) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 15);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 15);
                 }
                 svga->ma += x << 1;
             } else {
@@ -1202,8 +1314,8 @@ svga_render_15bpp_highres(svga_t *svga)
                     addr = svga->remap_func(svga, svga->ma);
                     dat  = *(uint32_t *) (&svga->vram[addr & svga->vram_display_mask]);
 
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 15);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 15);
                     svga->ma += 4;
                 }
             }
@@ -1299,6 +1411,8 @@ svga_render_16bpp_lowres(svga_t *svga)
     uint32_t  changed_addr;
     uint32_t  addr;
 
+    const uint32_t *conv = (svga->conv_16to32 == svga_conv_16to32) ? video_16to32 : NULL;
+
     if ((svga->displine + svga->y_add) < 0)
         return;
 
@@ -1312,12 +1426,12 @@ svga_render_16bpp_lowres(svga_t *svga)
 
             for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 4) {
                 dat       = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1)) & svga->vram_display_mask]);
-                p[x << 1] = p[(x << 1) + 1] = svga->conv_16to32(svga, dat & 0xffff, 16);
-                p[(x << 1) + 2] = p[(x << 1) + 3] = svga->conv_16to32(svga, dat >> 16, 16);
+                p[x << 1] = p[(x << 1) + 1] = svga_conv16(svga, conv, dat & 0xffff, 16);
+                p[(x << 1) + 2] = p[(x << 1) + 3] = svga_conv16(svga, conv, dat >> 16, 16);
 
                 dat             = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 4) & svga->vram_display_mask]);
-                p[(x << 1) + 4] = p[(x << 1) + 5] = svga->conv_16to32(svga, dat & 0xffff, 16);
-                p[(x << 1) + 6] = p[(x << 1) + 7] = svga->conv_16to32(svga, dat >> 16, 16);
+                p[(x << 1) + 4] = p[(x << 1) + 5] = svga_conv16(svga, conv, dat & 0xffff, 16);
+                p[(x << 1) + 6] = p[(x << 1) + 7] = svga_conv16(svga, conv, dat >> 16, 16);
             }
             svga->ma += x << 1;
             svga->ma &= svga->vram_display_mask;
@@ -1336,13 +1450,13 @@ svga_render_16bpp_lowres(svga_t *svga)
                 for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 4) {
                     dat = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1)) & svga->vram_display_mask]);
 
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 16);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 16);
 
                     dat = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 4) & svga->vram_display_mask]);
 
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 16);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 16);
                 }
                 svga->ma += x << 1;
             } else {
@@ -1350,8 +1464,8 @@ svga_render_16bpp_lowres(svga_t *svga)
                     addr = svga->remap_func(svga, svga->ma);
                     dat  = *(uint32_t *) (&svga->vram[addr & svga->vram_display_mask]);
 
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 16);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 16);
                 }
                 svga->ma += 4;
             }
@@ -1369,6 +1483,8 @@ svga_render_16bpp_highres(svga_t *svga)
     uint32_t  changed_addr;
     uint32_t  addr;
 
+    const uint32_t *conv = (svga->conv_16to32 == svga_conv_16to32) ? video_16to32 : NULL;
+
     if ((svga->displine + svga->y_add) < 0)
         return;
 
@@ -1382,20 +1498,20 @@ svga_render_16bpp_highres(svga_t *svga)
 
             for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 8) {
                 uint32_t dat = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1)) & svga->vram_display_mask]);
-                p[x]         = svga->conv_16to32(svga, dat & 0xffff, 16);
-                p[x + 1]     = svga->conv_16to32(svga, dat >> 16, 16);
+                p[x]         = svga_conv16(svga, conv, dat & 0xffff, 16);
+                p[x + 1]     = svga_conv16(svga, conv, dat >> 16, 16);
 
                 dat      = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 4) & svga->vram_display_mask]);
-                p[x + 2] = svga->conv_16to32(svga, dat & 0xffff, 16);
-                p[x + 3] = svga->conv_16to32(svga, dat >> 16, 16);
+                p[x + 2] = svga_conv16(svga, conv, dat & 0xffff, 16);
+                p[x + 3] = svga_conv16(svga, conv, dat >> 16, 16);
 
                 dat      = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 8) & svga->vram_display_mask]);
-                p[x + 4] = svga->conv_16to32(svga, dat & 0xffff, 16);
-                p[x + 5] = svga->conv_16to32(svga, dat >> 16, 16);
+                p[x + 4] = svga_conv16(svga, conv, dat & 0xffff, 16);
+                p[x + 5] = svga_conv16(svga, conv, dat >> 16, 16);
 
                 dat      = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 12) & svga->vram_display_mask]);
-                p[x + 6] = svga->conv_16to32(svga, dat & 0xffff, 16);
-                p[x + 7] = svga->conv_16to32(svga, dat >> 16, 16);
+                p[x + 6] = svga_conv16(svga, conv, dat & 0xffff, 16);
+                p[x + 7] = svga_conv16(svga, conv, dat >> 16, 16);
             }
             svga->ma += x << 1;
             svga->ma &= svga->vram_display_mask;
@@ -1413,20 +1529,20 @@ svga_render_16bpp_highres(svga_t *svga)
             if (!svga->remap_required) {
                 for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 8) {
                     dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1)) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 16);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 16);
 
                     dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 4) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 16);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 16);
 
                     dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 8) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 16);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 16);
 
                     dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 1) + 12) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 16);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 16);
                 }
                 svga->ma += x << 1;
             } else {
@@ -1434,8 +1550,8 @@ svga_render_16bpp_highres(svga_t *svga)
                     addr = svga->remap_func(svga, svga->ma);
                     dat  = *(uint32_t *) (&svga->vram[addr & svga->vram_display_mask]);
 
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+                    *p++ = svga_conv16(svga, conv, dat & 0xffff, 16);
+                    *p++ = svga_conv16(svga, conv, dat >> 16, 16);
 
                     svga->ma += 4;
                 }
@@ -1682,9 +1798,15 @@ svga_render_32bpp_highres(svga_t *svga)
                 svga->firstline_draw = svga->displine;
             svga->lastline_draw = svga->displine;
 
-            for (x = 0; x <= (svga->hdisp + svga->scrollcache); x++) {
-                dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 2)) & svga->vram_display_mask]);
-                p[x] = lookup_lut(dat & 0xffffff);
+            if (!svga->lut_map) {
+                /* No RAMDAC LUT remap active - plain masked copy. */
+                for (x = 0; x <= (svga->hdisp + svga->scrollcache); x++)
+                    p[x] = *(uint32_t *) (&svga->vram[(svga->ma + (x << 2)) & svga->vram_display_mask]) & 0xffffff;
+            } else {
+                for (x = 0; x <= (svga->hdisp + svga->scrollcache); x++) {
+                    dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 2)) & svga->vram_display_mask]);
+                    p[x] = lookup_lut(dat & 0xffffff);
+                }
             }
             svga->ma += 4;
             svga->ma &= svga->vram_display_mask;
@@ -1700,9 +1822,15 @@ svga_render_32bpp_highres(svga_t *svga)
             svga->lastline_draw = svga->displine;
 
             if (!svga->remap_required) {
-                for (x = 0; x <= (svga->hdisp + svga->scrollcache); x++) {
-                    dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 2)) & svga->vram_display_mask]);
-                    *p++ = lookup_lut(dat & 0xffffff);
+                if (!svga->lut_map) {
+                    /* No RAMDAC LUT remap active - plain masked copy. */
+                    for (x = 0; x <= (svga->hdisp + svga->scrollcache); x++)
+                        *p++ = *(uint32_t *) (&svga->vram[(svga->ma + (x << 2)) & svga->vram_display_mask]) & 0xffffff;
+                } else {
+                    for (x = 0; x <= (svga->hdisp + svga->scrollcache); x++) {
+                        dat  = *(uint32_t *) (&svga->vram[(svga->ma + (x << 2)) & svga->vram_display_mask]);
+                        *p++ = lookup_lut(dat & 0xffffff);
+                    }
                 }
                 svga->ma += (x * 4);
             } else {
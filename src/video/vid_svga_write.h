@@ -0,0 +1,90 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Template for the specialized SVGA write map handlers. It is
+ *          included by vid_svga.c once per (address map, data path)
+ *          combination actually reachable from svga_write_common()'s
+ *          old dispatch chain, with:
+ *
+ *              WRITE_MAP_NAME   the name of the emitted handler;
+ *              WRITE_MAP_SETUP  the statements translating the CPU
+ *                               address into a VRAM address and write
+ *                               mask for that map;
+ *              WRITE_MAP_VEN    defined when the handler serves write
+ *                               modes 4/5, which hand the byte to the
+ *                               card's ven_write instead of the planar
+ *                               pipeline;
+ *              WRITE_MAP_BY8    defined for the doubleword-mapped
+ *                               Cirrus path, the only one where the
+ *                               MSB-first extended write mask needs
+ *                               folding.
+ *
+ *          The common tail (decode masking, address translation, dirty
+ *          marking and the plane write dispatch) is expanded around the
+ *          setup, so each emitted handler is straight-line code for its
+ *          combination. svga_recalc_write_handler() installs the right
+ *          one whenever a register feeding the old dispatch chain
+ *          changes.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+
+static void
+WRITE_MAP_NAME(svga_t *svga, uint32_t addr, uint8_t val, uint32_t writemask2, uint8_t linear)
+{
+#ifndef WRITE_MAP_VEN
+    uint8_t count;
+#endif
+
+    (void) linear;
+
+    WRITE_MAP_SETUP(svga, addr, writemask2, linear);
+
+    addr &= svga->decode_mask;
+
+    if (svga->translate_address)
+        addr = svga->translate_address(addr, svga);
+
+    if (addr >= svga->vram_max)
+        return;
+
+    addr &= svga->vram_mask;
+
+    svga->changedvram[addr >> 12] = svga->monitor->mon_changeframecount;
+
+#ifdef WRITE_MAP_VEN
+    if (svga->ven_write)
+        svga->ven_write(svga, val, addr);
+#else
+    count = 4;
+    if (svga->adv_flags & FLAG_LATCH8)
+        count = 8;
+
+#    ifdef WRITE_MAP_BY8
+    /* Undocumented Cirrus Logic behavior: The datasheet says that, with EXT_WRITE and FLAG_ADDR_BY8, the write mask only
+       changes meaning in write modes 4 and 5, as well as write mode 1. In reality, however, all other write modes are also
+       affected, as proven by the Windows 3.1 CL-GD 5422/4 drivers in 8bpp modes. The MSB-first mask is folded over here
+       once so the plane loops in the handlers do not have to special-case it per byte. */
+    if (svga->adv_flags & FLAG_EXT_WRITE)
+        writemask2 = svga_mask_msb(writemask2);
+#    endif
+
+    svga->plane_write(svga, addr, val, writemask2, count);
+#endif
+}
+
+#undef WRITE_MAP_NAME
+#undef WRITE_MAP_SETUP
+#ifdef WRITE_MAP_VEN
+#    undef WRITE_MAP_VEN
+#endif
+#ifdef WRITE_MAP_BY8
+#    undef WRITE_MAP_BY8
+#endif
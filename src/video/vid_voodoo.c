@@ -57,6 +57,13 @@ rgba8_t ai88[0x10000];
 
 int tris = 0;
 
+static void (*const voodoo_render_thread_funcs[MAX_RENDER_THREADS])(void *param) = {
+    voodoo_render_thread_1, voodoo_render_thread_2,
+    voodoo_render_thread_3, voodoo_render_thread_4,
+    voodoo_render_thread_5, voodoo_render_thread_6,
+    voodoo_render_thread_7, voodoo_render_thread_8
+};
+
 #ifdef ENABLE_VOODOO_LOG
 int voodoo_do_log = ENABLE_VOODOO_LOG;
 
@@ -907,6 +914,28 @@ voodoo_force_blit(void *priv)
     }
 }
 
+/* Resolve the configured render thread count against the host: "Auto" (0)
+   targets half the logical cores, so several instances and the FIFO and
+   audio threads still fit, and explicit settings are clamped to the core
+   count. The result stays a power of two for odd_even_mask. */
+static int
+voodoo_resolve_render_threads(int threads)
+{
+    int cores = plat_get_cpu_count();
+    int limit = 1;
+
+    if (threads <= 0)
+        cores /= 2;
+
+    while (((limit * 2) <= cores) && ((limit * 2) <= MAX_RENDER_THREADS))
+        limit *= 2;
+
+    if ((threads <= 0) || (threads > limit))
+        threads = limit;
+
+    return threads;
+}
+
 void *
 voodoo_card_init(void)
 {
@@ -921,7 +950,7 @@ voodoo_card_init(void)
     voodoo->texture_mask      = (voodoo->texture_size << 20) - 1;
     voodoo->fb_size           = device_get_config_int("framebuffer_memory");
     voodoo->fb_mask           = (voodoo->fb_size << 20) - 1;
-    voodoo->render_threads    = device_get_config_int("render_threads");
+    voodoo->render_threads    = voodoo_resolve_render_threads(device_get_config_int("render_threads"));
     voodoo->odd_even_mask     = voodoo->render_threads - 1;
 #ifndef NO_CODEGEN
     voodoo->use_recompiler = device_get_config_int("recompiler");
@@ -974,30 +1003,18 @@ voodoo_card_init(void)
     voodoo->svga     = svga_get_pri();
     voodoo->fbiInit0 = 0;
 
-    voodoo->wake_fifo_thread         = thread_create_event();
-    voodoo->wake_render_thread[0]    = thread_create_event();
-    voodoo->wake_render_thread[1]    = thread_create_event();
-    voodoo->wake_render_thread[2]    = thread_create_event();
-    voodoo->wake_render_thread[3]    = thread_create_event();
-    voodoo->wake_main_thread         = thread_create_event();
-    voodoo->fifo_not_full_event      = thread_create_event();
-    voodoo->render_not_full_event[0] = thread_create_event();
-    voodoo->render_not_full_event[1] = thread_create_event();
-    voodoo->render_not_full_event[2] = thread_create_event();
-    voodoo->render_not_full_event[3] = thread_create_event();
-    voodoo->fifo_thread_run          = 1;
-    voodoo->fifo_thread              = thread_create(voodoo_fifo_thread, voodoo);
-    voodoo->render_thread_run[0]     = 1;
-    voodoo->render_thread[0]         = thread_create(voodoo_render_thread_1, voodoo);
-    if (voodoo->render_threads >= 2) {
-        voodoo->render_thread_run[1] = 1;
-        voodoo->render_thread[1]     = thread_create(voodoo_render_thread_2, voodoo);
+    voodoo->wake_fifo_thread    = thread_create_event();
+    voodoo->wake_main_thread    = thread_create_event();
+    voodoo->fifo_not_full_event = thread_create_event();
+    for (c = 0; c < MAX_RENDER_THREADS; c++) {
+        voodoo->wake_render_thread[c]    = thread_create_event();
+        voodoo->render_not_full_event[c] = thread_create_event();
     }
-    if (voodoo->render_threads == 4) {
-        voodoo->render_thread_run[2] = 1;
-        voodoo->render_thread[2]     = thread_create(voodoo_render_thread_3, voodoo);
-        voodoo->render_thread_run[3] = 1;
-        voodoo->render_thread[3]     = thread_create(voodoo_render_thread_4, voodoo);
+    voodoo->fifo_thread_run = 1;
+    voodoo->fifo_thread     = thread_create(voodoo_fifo_thread, voodoo);
+    for (c = 0; c < voodoo->render_threads; c++) {
+        voodoo->render_thread_run[c] = 1;
+        voodoo->render_thread[c]     = thread_create(voodoo_render_thread_funcs[c], voodoo);
     }
     voodoo->swap_mutex = thread_create_mutex();
     timer_add(&voodoo->wake_timer, voodoo_wake_timer, (void *) voodoo, 0);
@@ -1072,7 +1089,7 @@ voodoo_2d3d_card_init(int type)
     voodoo->bilinear_enabled  = device_get_config_int("bilinear");
     voodoo->dithersub_enabled = device_get_config_int("dithersub");
     voodoo->scrfilter         = device_get_config_int("dacfilter");
-    voodoo->render_threads    = device_get_config_int("render_threads");
+    voodoo->render_threads    = voodoo_resolve_render_threads(device_get_config_int("render_threads"));
     voodoo->odd_even_mask     = voodoo->render_threads - 1;
 #ifndef NO_CODEGEN
     voodoo->use_recompiler = device_get_config_int("recompiler");
@@ -1098,30 +1115,18 @@ voodoo_2d3d_card_init(int type)
 
     voodoo->fbiInit0 = 0;
 
-    voodoo->wake_fifo_thread         = thread_create_event();
-    voodoo->wake_render_thread[0]    = thread_create_event();
-    voodoo->wake_render_thread[1]    = thread_create_event();
-    voodoo->wake_render_thread[2]    = thread_create_event();
-    voodoo->wake_render_thread[3]    = thread_create_event();
-    voodoo->wake_main_thread         = thread_create_event();
-    voodoo->fifo_not_full_event      = thread_create_event();
-    voodoo->render_not_full_event[0] = thread_create_event();
-    voodoo->render_not_full_event[1] = thread_create_event();
-    voodoo->render_not_full_event[2] = thread_create_event();
-    voodoo->render_not_full_event[3] = thread_create_event();
-    voodoo->fifo_thread_run          = 1;
-    voodoo->fifo_thread              = thread_create(voodoo_fifo_thread, voodoo);
-    voodoo->render_thread_run[0]     = 1;
-    voodoo->render_thread[0]         = thread_create(voodoo_render_thread_1, voodoo);
-    if (voodoo->render_threads >= 2) {
-        voodoo->render_thread_run[1] = 1;
-        voodoo->render_thread[1]     = thread_create(voodoo_render_thread_2, voodoo);
+    voodoo->wake_fifo_thread    = thread_create_event();
+    voodoo->wake_main_thread    = thread_create_event();
+    voodoo->fifo_not_full_event = thread_create_event();
+    for (c = 0; c < MAX_RENDER_THREADS; c++) {
+        voodoo->wake_render_thread[c]    = thread_create_event();
+        voodoo->render_not_full_event[c] = thread_create_event();
     }
-    if (voodoo->render_threads == 4) {
-        voodoo->render_thread_run[2] = 1;
-        voodoo->render_thread[2]     = thread_create(voodoo_render_thread_3, voodoo);
-        voodoo->render_thread_run[3] = 1;
-        voodoo->render_thread[3]     = thread_create(voodoo_render_thread_4, voodoo);
+    voodoo->fifo_thread_run = 1;
+    voodoo->fifo_thread     = thread_create(voodoo_fifo_thread, voodoo);
+    for (c = 0; c < voodoo->render_threads; c++) {
+        voodoo->render_thread_run[c] = 1;
+        voodoo->render_thread[c]     = thread_create(voodoo_render_thread_funcs[c], voodoo);
     }
     voodoo->swap_mutex = thread_create_mutex();
     timer_add(&voodoo->wake_timer, voodoo_wake_timer, (void *) voodoo, 0);
@@ -1249,29 +1254,18 @@ voodoo_card_close(voodoo_t *voodoo)
     voodoo->fifo_thread_run = 0;
     thread_set_event(voodoo->wake_fifo_thread);
     thread_wait(voodoo->fifo_thread);
-    voodoo->render_thread_run[0] = 0;
-    thread_set_event(voodoo->wake_render_thread[0]);
-    thread_wait(voodoo->render_thread[0]);
-    if (voodoo->render_threads >= 2) {
-        voodoo->render_thread_run[1] = 0;
-        thread_set_event(voodoo->wake_render_thread[1]);
-        thread_wait(voodoo->render_thread[1]);
-    }
-    if (voodoo->render_threads == 4) {
-        voodoo->render_thread_run[2] = 0;
-        thread_set_event(voodoo->wake_render_thread[2]);
-        thread_wait(voodoo->render_thread[2]);
-        voodoo->render_thread_run[3] = 0;
-        thread_set_event(voodoo->wake_render_thread[3]);
-        thread_wait(voodoo->render_thread[3]);
+    for (uint8_t i = 0; i < voodoo->render_threads; i++) {
+        voodoo->render_thread_run[i] = 0;
+        thread_set_event(voodoo->wake_render_thread[i]);
+        thread_wait(voodoo->render_thread[i]);
     }
     thread_destroy_event(voodoo->fifo_not_full_event);
     thread_destroy_event(voodoo->wake_main_thread);
     thread_destroy_event(voodoo->wake_fifo_thread);
-    thread_destroy_event(voodoo->wake_render_thread[0]);
-    thread_destroy_event(voodoo->wake_render_thread[1]);
-    thread_destroy_event(voodoo->render_not_full_event[0]);
-    thread_destroy_event(voodoo->render_not_full_event[1]);
+    for (uint8_t i = 0; i < MAX_RENDER_THREADS; i++) {
+        thread_destroy_event(voodoo->wake_render_thread[i]);
+        thread_destroy_event(voodoo->render_not_full_event[i]);
+    }
 
     for (uint8_t c = 0; c < TEX_CACHE_MAX; c++) {
         if (voodoo->dual_tmus)
@@ -1290,6 +1284,7 @@ voodoo_card_close(voodoo_t *voodoo)
 
     thread_close_mutex(voodoo->force_blit_mutex);
 
+    free(voodoo->cmdfifo_bounce);
     free(voodoo);
 }
 
@@ -1391,6 +1386,10 @@ static const device_config_t voodoo_config[] = {
         .description = "Render threads",
         .type = CONFIG_SELECTION,
         .selection = {
+            {
+                .description = "Auto",
+                .value = 0
+            },
             {
                 .description = "1",
                 .value = 1
@@ -1403,6 +1402,10 @@ static const device_config_t voodoo_config[] = {
                 .description = "4",
                 .value = 4
             },
+            {
+                .description = "8",
+                .value = 8
+            },
             {
                 .description = ""
             }
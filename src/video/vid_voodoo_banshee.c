@@ -844,6 +844,7 @@ banshee_ext_outl(uint16_t addr, uint32_t val, void *priv)
             svga->write_bank    = (val & 0x3ff) << 15;
             svga->read_bank     = ((val >> 10) & 0x3ff) << 15;
             svga->packed_chain4 = !!(val & 0x00100000);
+            svga_recalc_write_handler(svga);
             break;
 
         case PLL_pllCtrl0:
@@ -865,6 +866,9 @@ banshee_ext_outl(uint16_t addr, uint32_t val, void *priv)
             banshee->dacAddr = val & 0x1ff;
             break;
         case DAC_dacData:
+            /*Apply any pending VGA DAC conversions first so they can not
+              overwrite this direct CLUT write on a later flush.*/
+            svga_pallook_flush(svga);
             svga->pallook[banshee->dacAddr] = val & 0xffffff;
             svga->fullchange                = changeframecount;
             break;
@@ -1190,6 +1194,7 @@ banshee_ext_inl(uint16_t addr, void *priv)
             ret = banshee->dacAddr;
             break;
         case DAC_dacData:
+            svga_pallook_flush(&banshee->svga);
             ret = svga->pallook[banshee->dacAddr];
             break;
 
@@ -3072,6 +3077,10 @@ static const device_config_t banshee_sgram_config[] = {
         .description = "Render threads",
         .type = CONFIG_SELECTION,
         .selection = {
+            {
+                .description = "Auto",
+                .value = 0
+            },
             {
                 .description = "1",
                 .value = 1
@@ -3084,6 +3093,10 @@ static const device_config_t banshee_sgram_config[] = {
                 .description = "4",
                 .value = 4
             },
+            {
+                .description = "8",
+                .value = 8
+            },
             {
                 .description = ""
             }
@@ -3127,6 +3140,10 @@ static const device_config_t banshee_sgram_16mbonly_config[] = {
         .description = "Render threads",
         .type = CONFIG_SELECTION,
         .selection = {
+            {
+                .description = "Auto",
+                .value = 0
+            },
             {
                 .description = "1",
                 .value = 1
@@ -3139,6 +3156,10 @@ static const device_config_t banshee_sgram_16mbonly_config[] = {
                 .description = "4",
                 .value = 4
             },
+            {
+                .description = "8",
+                .value = 8
+            },
             {
                 .description = ""
             }
@@ -3182,6 +3203,10 @@ static const device_config_t banshee_sdram_config[] = {
         .description = "Render threads",
         .type = CONFIG_SELECTION,
         .selection = {
+            {
+                .description = "Auto",
+                .value = 0
+            },
             {
                 .description = "1",
                 .value = 1
@@ -3194,6 +3219,10 @@ static const device_config_t banshee_sdram_config[] = {
                 .description = "4",
                 .value = 4
             },
+            {
+                .description = "8",
+                .value = 8
+            },
             {
                 .description = ""
             }
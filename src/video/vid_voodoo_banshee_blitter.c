@@ -549,6 +549,101 @@ DECODE_YUYV422_16BPP(uint16_t *buf, uint8_t *src)
     } while (0);
 }
 
+
+/*Bulk row copy for plain SRCCOPY screen-to-screen rows - no colour keying,
+  no pattern transparency, no tiling, matching source and destination
+  formats. Returns 0 if the row needs the per-pixel path. 24bpp is excluded
+  as destination writes there preserve the existing alpha byte.*/
+static int
+screen_to_screen_row_copy(voodoo_t *voodoo, const uint8_t *src_p, int use_x_dir, int src_x, int src_tiled)
+{
+    const clip_t *clip  = &voodoo->banshee_blt.clip[(voodoo->banshee_blt.command & COMMAND_CLIP_SEL) ? 1 : 0];
+    int           dst_y = voodoo->banshee_blt.dstY;
+    int           dst_x = voodoo->banshee_blt.dstX;
+    int           xdir  = (use_x_dir && (voodoo->banshee_blt.command & COMMAND_DX)) ? -1 : 1;
+    int           count = voodoo->banshee_blt.dstSizeX;
+    int           bytes_pp;
+    int           skip;
+    int           dst_first;
+    int           src_first;
+    uint32_t      dst_raw;
+    intptr_t      src_off;
+    uint32_t      len;
+
+    if (voodoo->banshee_blt.rops[0] != 0xcc)
+        return 0;
+    if (voodoo->banshee_blt.commandExtra & (CMDEXTRA_SRC_COLORKEY | CMDEXTRA_DST_COLORKEY))
+        return 0;
+    if ((voodoo->banshee_blt.command & (COMMAND_PATTERN_MONO | COMMAND_TRANS_MONO)) == (COMMAND_PATTERN_MONO | COMMAND_TRANS_MONO))
+        return 0;
+    if (src_tiled || voodoo->banshee_blt.dstBaseAddr_tiled)
+        return 0;
+
+    switch (voodoo->banshee_blt.dstFormat & DST_FORMAT_COL_MASK) {
+        case DST_FORMAT_COL_8_BPP:
+            bytes_pp = 1;
+            break;
+        case DST_FORMAT_COL_16_BPP:
+            bytes_pp = 2;
+            break;
+        case DST_FORMAT_COL_32_BPP:
+            bytes_pp = 4;
+            break;
+        default:
+            return 0;
+    }
+
+    /*Clip the row to the destination window.*/
+    if (xdir > 0) {
+        if (dst_x < clip->x_min) {
+            skip = clip->x_min - dst_x;
+            dst_x += skip;
+            src_x += skip;
+            count -= skip;
+        }
+        if ((dst_x + count) > clip->x_max)
+            count = clip->x_max - dst_x;
+        dst_first = dst_x;
+        src_first = src_x;
+    } else {
+        if (dst_x >= clip->x_max) {
+            skip = dst_x - (clip->x_max - 1);
+            dst_x -= skip;
+            src_x -= skip;
+            count -= skip;
+        }
+        if ((dst_x - (count - 1)) < clip->x_min)
+            count = (dst_x - clip->x_min) + 1;
+        dst_first = dst_x - (count - 1);
+        src_first = src_x - (count - 1);
+    }
+    if (count <= 0)
+        return 1;
+
+    len     = count * bytes_pp;
+    dst_raw = voodoo->banshee_blt.dstBaseAddr + dst_first * bytes_pp + dst_y * voodoo->banshee_blt.dst_stride;
+    src_off = (intptr_t) src_first * bytes_pp;
+
+    /*Fall back if either row would run off the end of its buffer (VRAM rows
+      could otherwise wrap through fb_mask).*/
+    if ((dst_raw + len) > (voodoo->fb_mask + 1))
+        return 0;
+    if ((src_p >= voodoo->vram) && (src_p <= &voodoo->vram[voodoo->fb_mask])) {
+        if (((src_p - voodoo->vram) + src_off < 0) || (((src_p - voodoo->vram) + src_off + len) > (voodoo->fb_mask + 1)))
+            return 0;
+    } else {
+        /*Host-to-screen rows come from the staging buffer.*/
+        if (((src_p - voodoo->banshee_blt.host_data) + src_off < 0) || (((src_p - voodoo->banshee_blt.host_data) + src_off + len) > (intptr_t) sizeof(voodoo->banshee_blt.host_data)))
+            return 0;
+    }
+
+    memmove(&voodoo->vram[dst_raw], src_p + src_off, len);
+    for (uint32_t page = dst_raw >> 12; page <= ((dst_raw + len - 1) >> 12); page++)
+        voodoo->changedvram[page] = changeframecount;
+
+    return 1;
+}
+
 static void
 do_screen_to_screen_line(voodoo_t *voodoo, uint8_t *src_p, int use_x_dir, int src_x, int src_tiled)
 {
@@ -576,7 +671,7 @@ do_screen_to_screen_line(voodoo_t *voodoo, uint8_t *src_p, int use_x_dir, int sr
 #endif
     if ((voodoo->banshee_blt.srcFormat & SRC_FORMAT_COL_MASK) == (voodoo->banshee_blt.dstFormat & DST_FORMAT_COL_MASK)) {
         /*No conversion required*/
-        if (dst_y >= clip->y_min && dst_y < clip->y_max) {
+        if ((dst_y >= clip->y_min) && (dst_y < clip->y_max) && !screen_to_screen_row_copy(voodoo, src_p, use_x_dir, src_x, src_tiled)) {
             int     dst_x        = voodoo->banshee_blt.dstX;
             int     pat_x        = voodoo->banshee_blt.patoff_x + voodoo->banshee_blt.dstX;
             uint8_t pattern_mask = pattern_mono[pat_y & 7];
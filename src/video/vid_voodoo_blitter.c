@@ -179,6 +179,34 @@ voodoo_v2_blit_start(voodoo_t *voodoo)
                 int             src_x = voodoo->bltSrcX;
                 int             dst_x = voodoo->bltDstX;
 
+                /*With no chroma keying the ROP select is always zero; if that
+                  ROP is SRCCOPY the row is a plain overlapping copy.*/
+                if (!(voodoo->bltCommand & (BLIT_SRC_CHROMA | BLIT_DST_CHROMA)) && (voodoo->bltRop[0] == 0xc)) {
+                    int count = size_x + 1;
+
+                    if (x_dir < 0) {
+                        src_x -= size_x;
+                        dst_x -= size_x;
+                    }
+                    if (voodoo->bltCommand & BLIT_CLIPPING_ENABLED) {
+                        if (dst_y < voodoo->bltClipLowY || dst_y >= voodoo->bltClipHighY)
+                            count = 0;
+                        if (dst_x < voodoo->bltClipLeft) {
+                            src_x += voodoo->bltClipLeft - dst_x;
+                            count -= voodoo->bltClipLeft - dst_x;
+                            dst_x = voodoo->bltClipLeft;
+                        }
+                        if ((dst_x + count) > voodoo->bltClipRight)
+                            count = voodoo->bltClipRight - dst_x;
+                    }
+                    if (count > 0)
+                        memmove(&dst[dst_x], &src[src_x], count * sizeof(uint16_t));
+
+                    src_y += y_dir;
+                    dst_y += y_dir;
+                    continue;
+                }
+
                 for (int x = 0; x <= size_x; x++) {
                     uint16_t src_dat = src[src_x];
                     uint16_t dst_dat = dst[dst_x];
@@ -28,10 +28,12 @@
 #include <86box/machine.h>
 #include <86box/device.h>
 #include <86box/mem.h>
+#include <86box/perfctr.h>
 #include <86box/timer.h>
 #include <86box/device.h>
 #include <86box/plat.h>
 #include <86box/thread.h>
+#include <86box/trace.h>
 #include <86box/video.h>
 #include <86box/vid_svga.h>
 #include <86box/vid_voodoo_common.h>
@@ -65,6 +67,13 @@ voodoo_fifo_log(const char *fmt, ...)
 void
 voodoo_wake_fifo_thread(voodoo_t *voodoo)
 {
+    if (voodoo->set && voodoo->set->voodoos[1] == voodoo && voodoo->type != VOODOO_2 && (voodoo->set->voodoos[0]->fbiInit1 & FBIINIT1_SLI_ENABLE) && timer_is_enabled(&voodoo->set->voodoos[0]->wake_timer)) {
+        /*In SLI the master's pending wake timer signals the slave as well (see
+          voodoo_wake_timer), and our work is already queued by the time we are
+          called, so its tick is guaranteed to see it. Don't arm a second timer
+          for the same wake window.*/
+        return;
+    }
     if (!timer_is_enabled(&voodoo->wake_timer)) {
         /*Don't wake FIFO thread immediately - if we do that it will probably
           process one word and go back to sleep, requiring it to be woken on
@@ -77,6 +86,7 @@ voodoo_wake_fifo_thread(voodoo_t *voodoo)
 void
 voodoo_wake_fifo_thread_now(voodoo_t *voodoo)
 {
+    TRACE_INSTANT(TRACE_VIDEO, "voodoo", "wake_fifo_thread");
     thread_set_event(voodoo->wake_fifo_thread); /*Wake up FIFO thread if moving from idle*/
 }
 
@@ -85,7 +95,19 @@ voodoo_wake_timer(void *priv)
 {
     voodoo_t *voodoo = (voodoo_t *) priv;
 
+    TRACE_INSTANT(TRACE_VIDEO, "voodoo", "wake_fifo_thread");
     thread_set_event(voodoo->wake_fifo_thread); /*Wake up FIFO thread if moving from idle*/
+
+    if (SLI_ENABLED && voodoo->type != VOODOO_2 && voodoo->set && voodoo->set->voodoos[0] == voodoo) {
+        voodoo_t *voodoo_slave = voodoo->set->voodoos[1];
+
+        /*In SLI the master's timer wakes both chips, so the pair shares one
+          tick per wake window instead of arming two timers back to back. Only
+          signal the slave if it actually has queued work, otherwise its FIFO
+          thread would wake just to find an empty FIFO and go back to sleep.*/
+        if ((voodoo_slave->fifo_write_idx != voodoo_slave->fifo_read_idx) || (voodoo_slave->cmdfifo_depth_rd != voodoo_slave->cmdfifo_depth_wr))
+            thread_set_event(voodoo_slave->wake_fifo_thread);
+    }
 }
 
 void
@@ -93,6 +115,9 @@ voodoo_queue_command(voodoo_t *voodoo, uint32_t addr_type, uint32_t val)
 {
     fifo_entry_t *fifo = &voodoo->fifo[voodoo->fifo_write_idx & FIFO_MASK];
 
+    if (FIFO_FULL)
+        PERF_INC(PERF_FIFO_STALL);
+
     while (FIFO_FULL) {
         thread_reset_event(voodoo->fifo_not_full_event);
         if (FIFO_FULL) {
@@ -176,15 +201,48 @@ cmdfifo_get(voodoo_t *voodoo)
     return val;
 }
 
+/*Pull a whole packet payload out of the FIFO as one contiguous block. Blocks
+  until the full payload has been written, consumes it in one go, and returns
+  a pointer straight into framebuffer memory; the rare payload that wraps the
+  framebuffer mask is reassembled into a bounce buffer first, so the packet
+  decoders below only ever see contiguous data.*/
+static const uint32_t *
+cmdfifo_get_block(voodoo_t *voodoo, int num)
+{
+    uint32_t offset = voodoo->cmdfifo_rp & voodoo->fb_mask;
+    uint32_t first;
+
+    if (!voodoo->cmdfifo_in_sub) {
+        while (voodoo->fifo_thread_run && ((voodoo->cmdfifo_depth_wr - voodoo->cmdfifo_depth_rd) < num)) {
+            thread_wait_event(voodoo->wake_fifo_thread, -1);
+            thread_reset_event(voodoo->wake_fifo_thread);
+        }
+        voodoo->cmdfifo_depth_rd += num;
+    }
+    voodoo->cmdfifo_rp += num * 4;
+
+    if ((offset + (num * 4)) <= (voodoo->fb_mask + 1))
+        return (const uint32_t *) &voodoo->fb_mem[offset];
+
+    if (num > voodoo->cmdfifo_bounce_size) {
+        voodoo->cmdfifo_bounce      = realloc(voodoo->cmdfifo_bounce, num * 4);
+        voodoo->cmdfifo_bounce_size = num;
+    }
+    first = (voodoo->fb_mask + 1) - offset;
+    memcpy(voodoo->cmdfifo_bounce, &voodoo->fb_mem[offset], first);
+    memcpy((uint8_t *) voodoo->cmdfifo_bounce + first, voodoo->fb_mem, (num * 4) - first);
+    return voodoo->cmdfifo_bounce;
+}
+
 static inline float
-cmdfifo_get_f(voodoo_t *voodoo)
+cmdfifo_f(uint32_t val)
 {
     union {
         uint32_t i;
         float    f;
     } tempif;
 
-    tempif.i = cmdfifo_get(voodoo);
+    tempif.i = val;
     return tempif.f;
 }
 
@@ -201,6 +259,177 @@ enum {
     CMDFIFO3_PC = (1 << 28)
 };
 
+static void
+cmdfifo_reg_write(voodoo_t *voodoo, uint32_t addr, uint32_t val)
+{
+    if ((addr & (1 << 13)) && voodoo->type >= VOODOO_BANSHEE)
+        voodoo_2d_reg_writel(voodoo, addr, val);
+    else {
+        if ((addr & 0x3ff) == SST_triangleCMD || (addr & 0x3ff) == SST_ftriangleCMD || (addr & 0x3ff) == SST_fastfillCMD || (addr & 0x3ff) == SST_nopCMD)
+            voodoo->cmd_written_fifo++;
+
+        if (voodoo->type >= VOODOO_BANSHEE && (addr & 0x3ff) == SST_swapbufferCMD)
+            voodoo->cmd_written_fifo++;
+        voodoo_reg_writel(addr, val, voodoo);
+    }
+}
+
+/*Packet type 1: a run of register writes, optionally auto-incrementing.*/
+static void
+cmdfifo_exec_1(voodoo_t *voodoo, uint32_t header, const uint32_t *p)
+{
+    int      num  = header >> 16;
+    uint32_t addr = (header & 0x7ff8) >> 1;
+
+    while (num--) {
+        cmdfifo_reg_write(voodoo, addr, *p++);
+
+        if (header & (1 << 15))
+            addr += 4;
+    }
+}
+
+/*Packet type 2: masked 2D register writes starting at register 8.*/
+static void
+cmdfifo_exec_2(voodoo_t *voodoo, uint32_t header, const uint32_t *p)
+{
+    uint32_t mask = header >> 3;
+    uint32_t addr = 8;
+
+    while (mask) {
+        if (mask & 1)
+            voodoo_2d_reg_writel(voodoo, addr, *p++);
+
+        addr += 4;
+        mask >>= 1;
+    }
+}
+
+/*Packet type 3: setup-mode vertex streams.*/
+static void
+cmdfifo_exec_3(voodoo_t *voodoo, uint32_t header, const uint32_t *p)
+{
+    uint32_t mask          = header;
+    int      smode         = (header >> 22) & 0xf;
+    int      num_verticies = (header >> 6) & 0xf;
+    int      v_num         = 0;
+
+    voodoo_reg_writel(SST_sSetupMode, ((header >> 10) & 0xff) | (smode << 16), voodoo);
+    if (((header >> 3) & 7) == 2)
+        v_num = 1;
+
+    while (num_verticies--) {
+        voodoo->verts[3].sVx = cmdfifo_f(*p++);
+        voodoo->verts[3].sVy = cmdfifo_f(*p++);
+        if (mask & CMDFIFO3_PC_MASK_RGB) {
+            if (header & CMDFIFO3_PC) {
+                uint32_t val            = *p++;
+                voodoo->verts[3].sBlue  = (float) (val & 0xff);
+                voodoo->verts[3].sGreen = (float) ((val >> 8) & 0xff);
+                voodoo->verts[3].sRed   = (float) ((val >> 16) & 0xff);
+                voodoo->verts[3].sAlpha = (float) ((val >> 24) & 0xff);
+            } else {
+                voodoo->verts[3].sRed   = cmdfifo_f(*p++);
+                voodoo->verts[3].sGreen = cmdfifo_f(*p++);
+                voodoo->verts[3].sBlue  = cmdfifo_f(*p++);
+            }
+        }
+        if ((mask & CMDFIFO3_PC_MASK_ALPHA) && !(header & CMDFIFO3_PC))
+            voodoo->verts[3].sAlpha = cmdfifo_f(*p++);
+        if (mask & CMDFIFO3_PC_MASK_Z)
+            voodoo->verts[3].sVz = cmdfifo_f(*p++);
+        if (mask & CMDFIFO3_PC_MASK_Wb)
+            voodoo->verts[3].sWb = cmdfifo_f(*p++);
+        if (mask & CMDFIFO3_PC_MASK_W0)
+            voodoo->verts[3].sW0 = cmdfifo_f(*p++);
+        if (mask & CMDFIFO3_PC_MASK_S0_T0) {
+            voodoo->verts[3].sS0 = cmdfifo_f(*p++);
+            voodoo->verts[3].sT0 = cmdfifo_f(*p++);
+        }
+        if (mask & CMDFIFO3_PC_MASK_W1)
+            voodoo->verts[3].sW1 = cmdfifo_f(*p++);
+        if (mask & CMDFIFO3_PC_MASK_S1_T1) {
+            voodoo->verts[3].sS1 = cmdfifo_f(*p++);
+            voodoo->verts[3].sT1 = cmdfifo_f(*p++);
+        }
+        if (v_num)
+            voodoo_reg_writel(SST_sDrawTriCMD, 0, voodoo);
+        else
+            voodoo_reg_writel(SST_sBeginTriCMD, 0, voodoo);
+        v_num++;
+        if (v_num == 3 && ((header >> 3) & 7) == 0)
+            v_num = 0;
+    }
+}
+
+/*Packet type 4: masked register writes.*/
+static void
+cmdfifo_exec_4(voodoo_t *voodoo, uint32_t header, const uint32_t *p)
+{
+    uint32_t mask = (header >> 15) & 0x3fff;
+    uint32_t addr = (header & 0x7ff8) >> 1;
+
+    while (mask) {
+        if (mask & 1)
+            cmdfifo_reg_write(voodoo, addr, *p++);
+
+        addr += 4;
+        mask >>= 1;
+    }
+}
+
+/*Packet type 5: bulk data transfer to framebuffer or texture memory.*/
+static void
+cmdfifo_exec_5(voodoo_t *voodoo, uint32_t header, const uint32_t *p)
+{
+    int      num  = (header >> 3) & 0x7ffff;
+    uint32_t addr = *p++ & 0xffffff;
+
+    if (!num)
+        num = 1;
+#if 0
+    voodoo_fifo_log("CMDFIFO5 addr=%08x num=%i\n", addr, num);
+#endif
+    switch (header >> 30) {
+        case 0: /*Linear framebuffer (Banshee)*/
+        case 1: /*Planar YUV*/
+            if (voodoo->texture_present[0][(addr & voodoo->texture_mask) >> TEX_DIRTY_SHIFT]) {
+#if 0
+                voodoo_fifo_log("texture_present at %08x %i\n", addr, (addr & voodoo->texture_mask) >> TEX_DIRTY_SHIFT);
+#endif
+                flush_texture_cache(voodoo, addr & voodoo->texture_mask, 0);
+            }
+            if (voodoo->texture_present[1][(addr & voodoo->texture_mask) >> TEX_DIRTY_SHIFT]) {
+#if 0
+                voodoo_fifo_log("texture_present at %08x %i\n", addr, (addr & voodoo->texture_mask) >> TEX_DIRTY_SHIFT);
+#endif
+                flush_texture_cache(voodoo, addr & voodoo->texture_mask, 1);
+            }
+            while (num--) {
+                if (addr <= voodoo->fb_mask)
+                    *(uint32_t *) &voodoo->fb_mem[addr] = *p;
+                p++;
+                addr += 4;
+            }
+            break;
+        case 2: /*Framebuffer*/
+            while (num--) {
+                voodoo_fb_writel(addr, *p++, voodoo);
+                addr += 4;
+            }
+            break;
+        case 3: /*Texture*/
+            while (num--) {
+                voodoo_tex_writel(addr, *p++, voodoo);
+                addr += 4;
+            }
+            break;
+
+        default:
+            fatal("CMDFIFO packet 5 bad space %08x %08x\n", header, voodoo->cmdfifo_rp);
+    }
+}
+
 void
 voodoo_fifo_thread(void *param)
 {
@@ -214,17 +443,24 @@ voodoo_fifo_thread(void *param)
         while (!FIFO_EMPTY) {
             uint64_t      start_time = plat_timer_read();
             uint64_t      end_time;
-            fifo_entry_t *fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
+            /* Drain against a snapshot of the write index - the indices are
+               atomic, so touching them once per run instead of once per entry
+               keeps the shared cache line quiet during register bursts. The
+               producer publishes the entry before bumping the write index,
+               so everything below the snapshot is safe to read. */
+            int           read_idx  = voodoo->fifo_read_idx;
+            int           write_idx = voodoo->fifo_write_idx;
+            fifo_entry_t *fifo      = &voodoo->fifo[read_idx & FIFO_MASK];
 
             switch (fifo->addr_type & FIFO_TYPE) {
                 case FIFO_WRITEL_REG:
                     while ((fifo->addr_type & FIFO_TYPE) == FIFO_WRITEL_REG) {
                         voodoo_reg_writel(fifo->addr_type & FIFO_ADDR, fifo->val, voodoo);
                         fifo->addr_type = FIFO_INVALID;
-                        voodoo->fifo_read_idx++;
-                        if (FIFO_EMPTY)
+                        read_idx++;
+                        if (read_idx == write_idx)
                             break;
-                        fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
+                        fifo = &voodoo->fifo[read_idx & FIFO_MASK];
                     }
                     break;
                 case FIFO_WRITEW_FB:
@@ -232,10 +468,10 @@ voodoo_fifo_thread(void *param)
                     while ((fifo->addr_type & FIFO_TYPE) == FIFO_WRITEW_FB) {
                         voodoo_fb_writew(fifo->addr_type & FIFO_ADDR, fifo->val, voodoo);
                         fifo->addr_type = FIFO_INVALID;
-                        voodoo->fifo_read_idx++;
-                        if (FIFO_EMPTY)
+                        read_idx++;
+                        if (read_idx == write_idx)
                             break;
-                        fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
+                        fifo = &voodoo->fifo[read_idx & FIFO_MASK];
                     }
                     break;
                 case FIFO_WRITEL_FB:
@@ -243,10 +479,10 @@ voodoo_fifo_thread(void *param)
                     while ((fifo->addr_type & FIFO_TYPE) == FIFO_WRITEL_FB) {
                         voodoo_fb_writel(fifo->addr_type & FIFO_ADDR, fifo->val, voodoo);
                         fifo->addr_type = FIFO_INVALID;
-                        voodoo->fifo_read_idx++;
-                        if (FIFO_EMPTY)
+                        read_idx++;
+                        if (read_idx == write_idx)
                             break;
-                        fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
+                        fifo = &voodoo->fifo[read_idx & FIFO_MASK];
                     }
                     break;
                 case FIFO_WRITEL_TEX:
@@ -254,20 +490,20 @@ voodoo_fifo_thread(void *param)
                         if (!(fifo->addr_type & 0x400000))
                             voodoo_tex_writel(fifo->addr_type & FIFO_ADDR, fifo->val, voodoo);
                         fifo->addr_type = FIFO_INVALID;
-                        voodoo->fifo_read_idx++;
-                        if (FIFO_EMPTY)
+                        read_idx++;
+                        if (read_idx == write_idx)
                             break;
-                        fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
+                        fifo = &voodoo->fifo[read_idx & FIFO_MASK];
                     }
                     break;
                 case FIFO_WRITEL_2DREG:
                     while ((fifo->addr_type & FIFO_TYPE) == FIFO_WRITEL_2DREG) {
                         voodoo_2d_reg_writel(voodoo, fifo->addr_type & FIFO_ADDR, fifo->val);
                         fifo->addr_type = FIFO_INVALID;
-                        voodoo->fifo_read_idx++;
-                        if (FIFO_EMPTY)
+                        read_idx++;
+                        if (read_idx == write_idx)
                             break;
-                        fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
+                        fifo = &voodoo->fifo[read_idx & FIFO_MASK];
                     }
                     break;
 
@@ -275,6 +511,8 @@ voodoo_fifo_thread(void *param)
                     fatal("Unknown fifo entry %08x\n", fifo->addr_type);
             }
 
+            voodoo->fifo_read_idx = read_idx;
+
             if (FIFO_ENTRIES > 0xe000)
                 thread_set_event(voodoo->fifo_not_full_event);
 
@@ -288,12 +526,9 @@ voodoo_fifo_thread(void *param)
             uint64_t start_time = plat_timer_read();
             uint64_t end_time;
             uint32_t header = cmdfifo_get(voodoo);
-            uint32_t addr;
             uint32_t mask;
-            int      smode;
-            int      num;
-            int      num_verticies;
-            int      v_num;
+            int      len;
+            int      words;
 
 #if 0
             voodoo_fifo_log(" CMDFIFO header %08x at %08x\n", header, voodoo->cmdfifo_rp);
@@ -340,148 +575,58 @@ voodoo_fifo_thread(void *param)
                     break;
 
                 case 1:
-                    num  = header >> 16;
-                    addr = (header & 0x7ff8) >> 1;
-#if 0
-                    voodoo_fifo_log("CMDFIFO1 addr=%08x\n",addr);
-#endif
-                    while (num--) {
-                        uint32_t val = cmdfifo_get(voodoo);
-                        if ((addr & (1 << 13)) && voodoo->type >= VOODOO_BANSHEE) {
-#if 0
-                            if (voodoo->type != VOODOO_BANSHEE)
-                                fatal("CMDFIFO1: Not Banshee\n");
-#endif
-
 #if 0
-                            voodoo_fifo_log("CMDFIFO1: write %08x %08x\n", addr, val);
+                    voodoo_fifo_log("CMDFIFO1 addr=%08x\n", (header & 0x7ff8) >> 1);
 #endif
-                            voodoo_2d_reg_writel(voodoo, addr, val);
-                        } else {
-                            if ((addr & 0x3ff) == SST_triangleCMD || (addr & 0x3ff) == SST_ftriangleCMD || (addr & 0x3ff) == SST_fastfillCMD || (addr & 0x3ff) == SST_nopCMD)
-                                voodoo->cmd_written_fifo++;
-
-                            if (voodoo->type >= VOODOO_BANSHEE && (addr & 0x3ff) == SST_swapbufferCMD)
-                                voodoo->cmd_written_fifo++;
-                            voodoo_reg_writel(addr, val, voodoo);
-                        }
-
-                        if (header & (1 << 15))
-                            addr += 4;
-                    }
+                    cmdfifo_exec_1(voodoo, header, cmdfifo_get_block(voodoo, header >> 16));
                     break;
 
                 case 2:
                     if (voodoo->type < VOODOO_2)
                         fatal("CMDFIFO2: Not Voodoo 2\n");
-                    mask = (header >> 3);
-                    addr = 8;
-                    while (mask) {
-                        if (mask & 1) {
-                            uint32_t val = cmdfifo_get(voodoo);
-
-                            voodoo_2d_reg_writel(voodoo, addr, val);
-                        }
-
-                        addr += 4;
-                        mask >>= 1;
-                    }
+                    len = 0;
+                    for (mask = header >> 3; mask; mask >>= 1)
+                        len += mask & 1;
+                    cmdfifo_exec_2(voodoo, header, cmdfifo_get_block(voodoo, len));
                     break;
 
                 case 3:
-                    num   = (header >> 29) & 7;
-                    mask  = header; //(header >> 10) & 0xff;
-                    smode = (header >> 22) & 0xf;
-                    voodoo_reg_writel(SST_sSetupMode, ((header >> 10) & 0xff) | (smode << 16), voodoo);
-                    num_verticies = (header >> 6) & 0xf;
-                    v_num         = 0;
-                    if (((header >> 3) & 7) == 2)
-                        v_num = 1;
+                    words = 2;
+                    if (header & CMDFIFO3_PC_MASK_RGB)
+                        words += (header & CMDFIFO3_PC) ? 1 : 3;
+                    if ((header & CMDFIFO3_PC_MASK_ALPHA) && !(header & CMDFIFO3_PC))
+                        words++;
+                    if (header & CMDFIFO3_PC_MASK_Z)
+                        words++;
+                    if (header & CMDFIFO3_PC_MASK_Wb)
+                        words++;
+                    if (header & CMDFIFO3_PC_MASK_W0)
+                        words++;
+                    if (header & CMDFIFO3_PC_MASK_S0_T0)
+                        words += 2;
+                    if (header & CMDFIFO3_PC_MASK_W1)
+                        words++;
+                    if (header & CMDFIFO3_PC_MASK_S1_T1)
+                        words += 2;
+                    /*Vertex data plus the trailing pad words.*/
+                    len = (((header >> 6) & 0xf) * words) + ((header >> 29) & 7);
 #if 0
-                    voodoo_fifo_log("CMDFIFO3: num=%i verts=%i mask=%02x\n", num, num_verticies, (header >> 10) & 0xff);
+                    voodoo_fifo_log("CMDFIFO3: num=%i verts=%i mask=%02x\n", (header >> 29) & 7, (header >> 6) & 0xf, (header >> 10) & 0xff);
                     voodoo_fifo_log("CMDFIFO3 %02x %i\n", (header >> 10), (header >> 3) & 7);
 #endif
-
-                    while (num_verticies--) {
-                        voodoo->verts[3].sVx = cmdfifo_get_f(voodoo);
-                        voodoo->verts[3].sVy = cmdfifo_get_f(voodoo);
-                        if (mask & CMDFIFO3_PC_MASK_RGB) {
-                            if (header & CMDFIFO3_PC) {
-                                uint32_t val            = cmdfifo_get(voodoo);
-                                voodoo->verts[3].sBlue  = (float) (val & 0xff);
-                                voodoo->verts[3].sGreen = (float) ((val >> 8) & 0xff);
-                                voodoo->verts[3].sRed   = (float) ((val >> 16) & 0xff);
-                                voodoo->verts[3].sAlpha = (float) ((val >> 24) & 0xff);
-                            } else {
-                                voodoo->verts[3].sRed   = cmdfifo_get_f(voodoo);
-                                voodoo->verts[3].sGreen = cmdfifo_get_f(voodoo);
-                                voodoo->verts[3].sBlue  = cmdfifo_get_f(voodoo);
-                            }
-                        }
-                        if ((mask & CMDFIFO3_PC_MASK_ALPHA) && !(header & CMDFIFO3_PC))
-                            voodoo->verts[3].sAlpha = cmdfifo_get_f(voodoo);
-                        if (mask & CMDFIFO3_PC_MASK_Z)
-                            voodoo->verts[3].sVz = cmdfifo_get_f(voodoo);
-                        if (mask & CMDFIFO3_PC_MASK_Wb)
-                            voodoo->verts[3].sWb = cmdfifo_get_f(voodoo);
-                        if (mask & CMDFIFO3_PC_MASK_W0)
-                            voodoo->verts[3].sW0 = cmdfifo_get_f(voodoo);
-                        if (mask & CMDFIFO3_PC_MASK_S0_T0) {
-                            voodoo->verts[3].sS0 = cmdfifo_get_f(voodoo);
-                            voodoo->verts[3].sT0 = cmdfifo_get_f(voodoo);
-                        }
-                        if (mask & CMDFIFO3_PC_MASK_W1)
-                            voodoo->verts[3].sW1 = cmdfifo_get_f(voodoo);
-                        if (mask & CMDFIFO3_PC_MASK_S1_T1) {
-                            voodoo->verts[3].sS1 = cmdfifo_get_f(voodoo);
-                            voodoo->verts[3].sT1 = cmdfifo_get_f(voodoo);
-                        }
-                        if (v_num)
-                            voodoo_reg_writel(SST_sDrawTriCMD, 0, voodoo);
-                        else
-                            voodoo_reg_writel(SST_sBeginTriCMD, 0, voodoo);
-                        v_num++;
-                        if (v_num == 3 && ((header >> 3) & 7) == 0)
-                            v_num = 0;
-                    }
-                    while (num--)
-                        cmdfifo_get(voodoo);
+                    cmdfifo_exec_3(voodoo, header, cmdfifo_get_block(voodoo, len));
                     break;
 
                 case 4:
-                    num  = (header >> 29) & 7;
-                    mask = (header >> 15) & 0x3fff;
-                    addr = (header & 0x7ff8) >> 1;
 #if 0
-                    voodoo_fifo_log("CMDFIFO4 addr=%08x\n",addr);
+                    voodoo_fifo_log("CMDFIFO4 addr=%08x\n", (header & 0x7ff8) >> 1);
 #endif
-                    while (mask) {
-                        if (mask & 1) {
-                            uint32_t val = cmdfifo_get(voodoo);
-
-                            if ((addr & (1 << 13)) && voodoo->type >= VOODOO_BANSHEE) {
-                                if (voodoo->type < VOODOO_BANSHEE)
-                                    fatal("CMDFIFO1: Not Banshee\n");
-#if 0
-                                voodoo_fifo_log("CMDFIFO1: write %08x %08x\n", addr, val);
-#endif
-
-                                voodoo_2d_reg_writel(voodoo, addr, val);
-                            } else {
-                                if ((addr & 0x3ff) == SST_triangleCMD || (addr & 0x3ff) == SST_ftriangleCMD || (addr & 0x3ff) == SST_fastfillCMD || (addr & 0x3ff) == SST_nopCMD)
-                                    voodoo->cmd_written_fifo++;
-
-                                if (voodoo->type >= VOODOO_BANSHEE && (addr & 0x3ff) == SST_swapbufferCMD)
-                                    voodoo->cmd_written_fifo++;
-                                voodoo_reg_writel(addr, val, voodoo);
-                            }
-                        }
-
-                        addr += 4;
-                        mask >>= 1;
-                    }
-                    while (num--)
-                        cmdfifo_get(voodoo);
+                    len = 0;
+                    for (mask = (header >> 15) & 0x3fff; mask; mask >>= 1)
+                        len += mask & 1;
+                    /*Register data plus the trailing pad words.*/
+                    len += (header >> 29) & 7;
+                    cmdfifo_exec_4(voodoo, header, cmdfifo_get_block(voodoo, len));
                     break;
 
                 case 5:
@@ -489,53 +634,11 @@ voodoo_fifo_thread(void *param)
                     if (header & 0x3fc00000)
                         fatal("CMDFIFO packet 5 has byte disables set %08x\n", header);
 #endif
-                    num  = (header >> 3) & 0x7ffff;
-                    addr = cmdfifo_get(voodoo) & 0xffffff;
-                    if (!num)
-                        num = 1;
-#if 0
-                    voodoo_fifo_log("CMDFIFO5 addr=%08x num=%i\n", addr, num);
-#endif
-                    switch (header >> 30) {
-                        case 0: /*Linear framebuffer (Banshee)*/
-                        case 1: /*Planar YUV*/
-                            if (voodoo->texture_present[0][(addr & voodoo->texture_mask) >> TEX_DIRTY_SHIFT]) {
-#if 0
-                                voodoo_fifo_log("texture_present at %08x %i\n", addr, (addr & voodoo->texture_mask) >> TEX_DIRTY_SHIFT);
-#endif
-                                flush_texture_cache(voodoo, addr & voodoo->texture_mask, 0);
-                            }
-                            if (voodoo->texture_present[1][(addr & voodoo->texture_mask) >> TEX_DIRTY_SHIFT]) {
-#if 0
-                                voodoo_fifo_log("texture_present at %08x %i\n", addr, (addr & voodoo->texture_mask) >> TEX_DIRTY_SHIFT);
-#endif
-                                flush_texture_cache(voodoo, addr & voodoo->texture_mask, 1);
-                            }
-                            while (num--) {
-                                uint32_t val = cmdfifo_get(voodoo);
-                                if (addr <= voodoo->fb_mask)
-                                    *(uint32_t *) &voodoo->fb_mem[addr] = val;
-                                addr += 4;
-                            }
-                            break;
-                        case 2: /*Framebuffer*/
-                            while (num--) {
-                                uint32_t val = cmdfifo_get(voodoo);
-                                voodoo_fb_writel(addr, val, voodoo);
-                                addr += 4;
-                            }
-                            break;
-                        case 3: /*Texture*/
-                            while (num--) {
-                                uint32_t val = cmdfifo_get(voodoo);
-                                voodoo_tex_writel(addr, val, voodoo);
-                                addr += 4;
-                            }
-                            break;
-
-                        default:
-                            fatal("CMDFIFO packet 5 bad space %08x %08x\n", header, voodoo->cmdfifo_rp);
-                    }
+                    /*Address word plus the data words.*/
+                    len = (header >> 3) & 0x7ffff;
+                    if (!len)
+                        len = 1;
+                    cmdfifo_exec_5(voodoo, header, cmdfifo_get_block(voodoo, len + 1));
                     break;
 
                 default:
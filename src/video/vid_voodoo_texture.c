@@ -276,6 +276,7 @@ voodoo_use_texture(voodoo_t *voodoo, voodoo_params_t *params, int tmu)
         if (voodoo->texture_cache[tmu][c].base == addr && voodoo->texture_cache[tmu][c].tLOD == (params->tLOD[tmu] & 0xf00fff) && voodoo->texture_cache[tmu][c].palette_checksum == palette_checksum) {
             params->tex_entry[tmu] = c;
             voodoo->texture_cache[tmu][c].refcount++;
+            voodoo->tex_cache_hit[tmu]++;
             return;
         }
     }
@@ -283,9 +284,15 @@ voodoo_use_texture(voodoo_t *voodoo, voodoo_params_t *params, int tmu)
     /*Texture not found, search for unused texture*/
     do {
         for (c = 0; c < TEX_CACHE_MAX; c++) {
+            int in_use = 0;
+
             voodoo->texture_last_removed++;
             voodoo->texture_last_removed &= (TEX_CACHE_MAX - 1);
-            if (voodoo->texture_cache[tmu][voodoo->texture_last_removed].refcount == voodoo->texture_cache[tmu][voodoo->texture_last_removed].refcount_r[0] && (voodoo->render_threads == 1 || voodoo->texture_cache[tmu][voodoo->texture_last_removed].refcount == voodoo->texture_cache[tmu][voodoo->texture_last_removed].refcount_r[1]))
+            for (int i = 0; i < voodoo->render_threads; i++) {
+                if (voodoo->texture_cache[tmu][voodoo->texture_last_removed].refcount != voodoo->texture_cache[tmu][voodoo->texture_last_removed].refcount_r[i])
+                    in_use = 1;
+            }
+            if (!in_use)
                 break;
         }
         if (c == TEX_CACHE_MAX)
@@ -296,6 +303,13 @@ voodoo_use_texture(voodoo_t *voodoo, voodoo_params_t *params, int tmu)
 
     c = voodoo->texture_last_removed;
 
+    voodoo->tex_cache_miss[tmu]++;
+    if (voodoo->texture_cache[tmu][c].base != (uint32_t) -1)
+        voodoo->tex_cache_evict[tmu]++;
+    voodoo_texture_log("tex cache tmu=%i entry=%i: %i hits, %i misses, %i evictions\n",
+                       tmu, c, voodoo->tex_cache_hit[tmu], voodoo->tex_cache_miss[tmu],
+                       voodoo->tex_cache_evict[tmu]);
+
     if ((voodoo->params.tLOD[tmu] & LOD_SPLIT) && (voodoo->params.tLOD[tmu] & LOD_ODD) && (voodoo->params.tLOD[tmu] & LOD_TMULTIBASEADDR))
         voodoo->texture_cache[tmu][c].base = params->texBaseAddr1[tmu];
     else
@@ -576,8 +590,10 @@ flush_texture_cache(voodoo_t *voodoo, uint32_t dirty_addr, int tmu)
                         voodoo_texture_log("  Evict texture %i %08x\n", c, voodoo->texture_cache[tmu][c].base);
 #endif
 
-                        if (voodoo->texture_cache[tmu][c].refcount != voodoo->texture_cache[tmu][c].refcount_r[0] || (voodoo->render_threads == 2 && voodoo->texture_cache[tmu][c].refcount != voodoo->texture_cache[tmu][c].refcount_r[1]))
-                            wait_for_idle = 1;
+                        for (int i = 0; i < voodoo->render_threads; i++) {
+                            if (voodoo->texture_cache[tmu][c].refcount != voodoo->texture_cache[tmu][c].refcount_r[i])
+                                wait_for_idle = 1;
+                        }
 
                         voodoo->texture_cache[tmu][c].base = -1;
                     } else {
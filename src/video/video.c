@@ -61,6 +61,7 @@
 #define HAVE_STDARG_H
 #include <86box/86box.h>
 #include "cpu.h"
+#include <86box/bench.h>
 #include <86box/device.h>
 #include <86box/io.h>
 #include <86box/mem.h>
@@ -88,6 +89,8 @@ uint8_t      fontdat8x12[256][16];        /* MDSI Genius font */
 uint8_t      fontdat12x18[256][36];       /* IM1024 font */
 dbcs_font_t *fontdatksc5601       = NULL; /* Korean KSC-5601 font */
 dbcs_font_t *fontdatksc5601_user  = NULL; /* Korean KSC-5601 user defined font */
+
+static uint8_t fontdatksc5601_shared = 0; /* Font mapped from the shared image cache */
 int          herc_blend           = 0;
 int          frames               = 0;
 int          fullchange           = 0;
@@ -235,11 +238,12 @@ const uint32_t shade[5][256] = {
 };
 
 typedef struct blit_data_struct {
-    int x, y, w, h;
-    int busy;
-    int buffer_in_use;
-    int thread_run;
-    int monitor_index;
+    int        x, y, w, h;
+    atomic_int busy;
+    atomic_int buffer_in_use;
+    int        thread_run;
+    int        monitor_index;
+    int        overload; /* rises on missed blits, decays on completed ones */
 
     thread_t *blit_thread;
     event_t  *wake_blit_thread;
@@ -304,75 +308,92 @@ video_wait_for_buffer_monitor(int monitor_index)
     thread_reset_event(blit_data_ptr->buffer_not_in_use);
 }
 
-static png_structp png_ptr[MONITORS_NUM];
-static png_infop   info_ptr[MONITORS_NUM];
+/* Screenshots are encoded asynchronously: the capture side only copies the
+   frame into a ring slot and the worker thread below does the PNG writing,
+   so neither the emulation nor the blit thread stalls on the encoder. */
+#define SCREENSHOT_RING_SIZE 4
+#define SCREENSHOT_RING_MASK (SCREENSHOT_RING_SIZE - 1)
+
+typedef struct screenshot_job_struct {
+    char      path[1024];
+    int       w, h;
+    uint32_t *frame;
+    uint32_t  frame_size;
+} screenshot_job_t;
+
+static screenshot_job_t screenshot_ring[SCREENSHOT_RING_SIZE];
+static atomic_int       screenshot_read_idx;
+static atomic_int       screenshot_write_idx;
+static thread_t        *screenshot_thread;
+static event_t         *wake_screenshot_thread;
+static event_t         *screenshot_ring_not_full;
+static int              screenshot_thread_run = 0;
 
 static void
-video_take_screenshot_monitor(const char *fn, uint32_t *buf, int start_x, int start_y, int row_len, int monitor_index)
+video_write_screenshot(const screenshot_job_t *job)
 {
-    png_bytep         *b_rgb         = NULL;
-    FILE              *fp            = NULL;
-    uint32_t           temp          = 0x00000000;
-    const blit_data_t *blit_data_ptr = monitors[monitor_index].mon_blit_data_ptr;
+    png_structp png_ptr;
+    png_infop   info_ptr;
+    png_bytep  *b_rgb = NULL;
+    FILE       *fp    = NULL;
+    uint32_t    temp  = 0x00000000;
 
     /* create file */
-    fp = plat_fopen(fn, (const char *) "wb");
+    fp = plat_fopen(job->path, (const char *) "wb");
     if (!fp) {
-        video_log("[video_take_screenshot] File %s could not be opened for writing", fn);
+        video_log("[video_write_screenshot] File %s could not be opened for writing", job->path);
         return;
     }
 
     /* initialize stuff */
-    png_ptr[monitor_index] = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
 
-    if (!png_ptr[monitor_index]) {
-        video_log("[video_take_screenshot] png_create_write_struct failed");
+    if (!png_ptr) {
+        video_log("[video_write_screenshot] png_create_write_struct failed");
         fclose(fp);
         return;
     }
 
-    info_ptr[monitor_index] = png_create_info_struct(png_ptr[monitor_index]);
-    if (!info_ptr[monitor_index]) {
-        video_log("[video_take_screenshot] png_create_info_struct failed");
+    info_ptr = png_create_info_struct(png_ptr);
+    if (!info_ptr) {
+        video_log("[video_write_screenshot] png_create_info_struct failed");
         fclose(fp);
         return;
     }
 
-    png_init_io(png_ptr[monitor_index], fp);
+    png_init_io(png_ptr, fp);
 
-    png_set_IHDR(png_ptr[monitor_index], info_ptr[monitor_index], blit_data_ptr->w, blit_data_ptr->h,
+    png_set_IHDR(png_ptr, info_ptr, job->w, job->h,
                  8, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE,
                  PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
 
-    b_rgb = (png_bytep *) malloc(sizeof(png_bytep) * blit_data_ptr->h);
+    b_rgb = (png_bytep *) malloc(sizeof(png_bytep) * job->h);
     if (b_rgb == NULL) {
-        video_log("[video_take_screenshot] Unable to Allocate RGB Bitmap Memory");
+        video_log("[video_write_screenshot] Unable to Allocate RGB Bitmap Memory");
         fclose(fp);
         return;
     }
 
-    for (int y = 0; y < blit_data_ptr->h; ++y) {
-        b_rgb[y] = (png_byte *) malloc(png_get_rowbytes(png_ptr[monitor_index], info_ptr[monitor_index]));
-        for (int x = 0; x < blit_data_ptr->w; ++x) {
-            if (buf == NULL)
-                memset(&(b_rgb[y][x * 3]), 0x00, 3);
-            else {
-                temp                  = buf[((start_y + y) * row_len) + start_x + x];
-                b_rgb[y][x * 3]       = (temp >> 16) & 0xff;
-                b_rgb[y][(x * 3) + 1] = (temp >> 8) & 0xff;
-                b_rgb[y][(x * 3) + 2] = temp & 0xff;
-            }
+    for (int y = 0; y < job->h; ++y) {
+        b_rgb[y] = (png_byte *) malloc(png_get_rowbytes(png_ptr, info_ptr));
+        for (int x = 0; x < job->w; ++x) {
+            temp                  = job->frame[(y * job->w) + x];
+            b_rgb[y][x * 3]       = (temp >> 16) & 0xff;
+            b_rgb[y][(x * 3) + 1] = (temp >> 8) & 0xff;
+            b_rgb[y][(x * 3) + 2] = temp & 0xff;
         }
     }
 
-    png_write_info(png_ptr[monitor_index], info_ptr[monitor_index]);
+    png_write_info(png_ptr, info_ptr);
 
-    png_write_image(png_ptr[monitor_index], b_rgb);
+    png_write_image(png_ptr, b_rgb);
 
-    png_write_end(png_ptr[monitor_index], NULL);
+    png_write_end(png_ptr, NULL);
+
+    png_destroy_write_struct(&png_ptr, &info_ptr);
 
     /* cleanup heap allocation */
-    for (int i = 0; i < blit_data_ptr->h; i++)
+    for (int i = 0; i < job->h; i++)
         if (b_rgb[i])
             free(b_rgb[i]);
 
@@ -383,31 +404,73 @@ video_take_screenshot_monitor(const char *fn, uint32_t *buf, int start_x, int st
         fclose(fp);
 }
 
+static void
+screenshot_thread_func(UNUSED(void *param))
+{
+    while (screenshot_thread_run) {
+        thread_wait_event(wake_screenshot_thread, -1);
+        thread_reset_event(wake_screenshot_thread);
+        while (screenshot_read_idx != screenshot_write_idx) {
+            video_write_screenshot(&screenshot_ring[screenshot_read_idx & SCREENSHOT_RING_MASK]);
+            screenshot_read_idx++;
+            thread_set_event(screenshot_ring_not_full);
+        }
+    }
+}
+
 void
 video_screenshot_monitor(uint32_t *buf, int start_x, int start_y, int row_len, int monitor_index)
 {
-    char path[1024];
-    char fn[256];
+    const blit_data_t *blit_data_ptr = monitors[monitor_index].mon_blit_data_ptr;
+    screenshot_job_t  *job;
+    char               fn[256];
+    int                w = blit_data_ptr->w;
+    int                h = blit_data_ptr->h;
+
+    /* Several shots still pending - wait for the encoder to free a slot. */
+    while ((screenshot_write_idx - screenshot_read_idx) == SCREENSHOT_RING_SIZE) {
+        thread_reset_event(screenshot_ring_not_full);
+        if ((screenshot_write_idx - screenshot_read_idx) == SCREENSHOT_RING_SIZE)
+            thread_wait_event(screenshot_ring_not_full, -1);
+    }
+
+    job = &screenshot_ring[screenshot_write_idx & SCREENSHOT_RING_MASK];
 
     memset(fn, 0, sizeof(fn));
-    memset(path, 0, sizeof(path));
+    memset(job->path, 0, sizeof(job->path));
 
-    path_append_filename(path, usr_path, SCREENSHOT_PATH);
+    path_append_filename(job->path, usr_path, SCREENSHOT_PATH);
 
-    if (!plat_dir_check(path))
-        plat_dir_create(path);
+    if (!plat_dir_check(job->path))
+        plat_dir_create(job->path);
 
-    path_slash(path);
-    strcat(path, "Monitor_");
-    snprintf(&path[strlen(path)], 42, "%d_", monitor_index + 1);
+    path_slash(job->path);
+    strcat(job->path, "Monitor_");
+    snprintf(&job->path[strlen(job->path)], 42, "%d_", monitor_index + 1);
 
     plat_tempfile(fn, NULL, ".png");
-    strcat(path, fn);
+    strcat(job->path, fn);
+
+    video_log("taking screenshot to: %s\n", job->path);
+
+    if (job->frame_size < (uint32_t) (w * h * sizeof(uint32_t))) {
+        free(job->frame);
+        job->frame_size = w * h * sizeof(uint32_t);
+        job->frame      = malloc(job->frame_size);
+    }
+
+    if (buf == NULL)
+        memset(job->frame, 0x00, w * h * sizeof(uint32_t));
+    else {
+        for (int y = 0; y < h; ++y)
+            memcpy(&job->frame[y * w], &buf[((start_y + y) * row_len) + start_x], w * sizeof(uint32_t));
+    }
 
-    video_log("taking screenshot to: %s\n", path);
+    job->w = w;
+    job->h = h;
 
-    video_take_screenshot_monitor((const char *) path, buf, start_x, start_y, row_len, monitor_index);
-    png_destroy_write_struct(&png_ptr[monitor_index], &info_ptr[monitor_index]);
+    screenshot_write_idx++;
+    thread_set_event(wake_screenshot_thread);
 
     atomic_fetch_sub(&monitors[monitor_index].mon_screenshots, 1);
 }
@@ -418,6 +481,55 @@ video_screenshot(uint32_t *buf, int start_x, int start_y, int row_len)
     video_screenshot_monitor(buf, start_x, start_y, row_len, 0);
 }
 
+/* Table-driven form of video_color_transform() for the blit path: the
+   per-channel luminance contributions and the luminance-to-color mapping
+   (shade curve or replication, with inversion folded in) are precomputed,
+   so converting a pixel is three lookups, two adds and an exact
+   reciprocal divide instead of three multiplies and a division.  The
+   tables are rebuilt whenever the settings they bake in change; settings
+   only change between frames (the UI brackets them with startblit()/
+   endblit()), so the lazy rebuild below is safe. */
+static uint32_t transform_lum_r[256];
+static uint32_t transform_lum_g[256];
+static uint32_t transform_lum_b[256];
+static uint32_t transform_color[256];
+static int      transform_key = -1;
+
+static void
+video_transform_rebuild(int key)
+{
+    /* Weights scaled so that the shared /255 below is exact; 85/255
+       reduces to the /3 average of graytype 2. */
+    int wr = 76;
+    int wg = 150;
+    int wb = 29;
+
+    if (video_graytype == 1) {
+        wr = 54;
+        wg = 183;
+        wb = 18;
+    } else if (video_graytype == 2)
+        wr = wg = wb = 85;
+
+    for (int c = 0; c < 256; c++) {
+        uint32_t color;
+
+        transform_lum_r[c] = wr * c;
+        transform_lum_g[c] = wg * c;
+        transform_lum_b[c] = wb * c;
+
+        if ((video_grayscale >= 2) && (video_grayscale <= 4))
+            color = shade[video_grayscale][c];
+        else
+            color = c * 0x00010101;
+        if (invert_display)
+            color ^= 0x00ffffff;
+        transform_color[c] = color;
+    }
+
+    transform_key = key;
+}
+
 #ifdef _WIN32
 void *__cdecl video_transform_copy(void *_Dst, const void *_Src, size_t _Size)
 #else
@@ -427,15 +539,29 @@ video_transform_copy(void *__restrict _Dst, const void *__restrict _Src, size_t
 {
     uint32_t       *dest_ex = (uint32_t *) _Dst;
     const uint32_t *src_ex  = (const uint32_t *) _Src;
+    int             key     = video_grayscale | (video_graytype << 3) | (invert_display << 6);
 
     _Size /= sizeof(uint32_t);
 
-    if ((dest_ex != NULL) && (src_ex != NULL)) {
-        for (size_t i = 0; i < _Size; i++) {
-            *dest_ex = video_color_transform(*src_ex);
-            dest_ex++;
-            src_ex++;
-        }
+    if ((dest_ex == NULL) || (src_ex == NULL))
+        return _Dst;
+
+    if (!video_grayscale) {
+        /* Invert only - no luminance step. */
+        for (size_t i = 0; i < _Size; i++)
+            dest_ex[i] = src_ex[i] ^ 0x00ffffff;
+        return _Dst;
+    }
+
+    if (key != transform_key)
+        video_transform_rebuild(key);
+
+    for (size_t i = 0; i < _Size; i++) {
+        uint32_t color = src_ex[i];
+        uint32_t lum   = transform_lum_r[(color >> 16) & 0xff] + transform_lum_g[(color >> 8) & 0xff] + transform_lum_b[color & 0xff];
+
+        /* (x + 1 + (x >> 8)) >> 8 is exactly x / 255 over this range. */
+        dest_ex[i] = transform_color[(lum + 1 + (lum >> 8)) >> 8];
     }
 
     return _Dst;
@@ -468,7 +594,22 @@ video_blit_memtoscreen_monitor(int x, int y, int w, int h, int monitor_index)
     if ((w <= 0) || (h <= 0))
         return;
 
-    video_wait_for_blit_monitor(monitor_index);
+    /* Never stall the emulation thread behind the renderer: if the previous
+       frame is still being blitted, drop this one - the renderer keeps the
+       latest frame it has and the next vsync will deliver a fresh one. */
+    if (monitors[monitor_index].mon_blit_data_ptr->busy) {
+        monitors[monitor_index].mon_frames_skipped++;
+        if (monitors[monitor_index].mon_blit_data_ptr->overload < 6)
+            monitors[monitor_index].mon_blit_data_ptr->overload++;
+        MTR_END("video", "video_blit_memtoscreen");
+        return;
+    }
+    if (monitors[monitor_index].mon_blit_data_ptr->overload > 0)
+        monitors[monitor_index].mon_blit_data_ptr->overload--;
+    if (bench_enabled && (monitor_index == 0))
+        bench_frame();
+
+    thread_reset_event(monitors[monitor_index].mon_blit_data_ptr->blit_complete);
 
     monitors[monitor_index].mon_blit_data_ptr->busy          = 1;
     monitors[monitor_index].mon_blit_data_ptr->buffer_in_use = 1;
@@ -481,6 +622,73 @@ video_blit_memtoscreen_monitor(int x, int y, int w, int h, int monitor_index)
     MTR_END("video", "video_blit_memtoscreen");
 }
 
+linecache_t *
+linecache_alloc(void)
+{
+    linecache_t *lc = (linecache_t *) calloc(1, sizeof(linecache_t));
+
+    /* The zeroed snapshots must never match a real line. */
+    lc->gen   = 1;
+    lc->dirty = 1;
+
+    return lc;
+}
+
+void
+linecache_free(linecache_t *lc)
+{
+    free(lc);
+}
+
+void
+linecache_invalidate(linecache_t *lc)
+{
+    lc->gen++;
+}
+
+/* Compare (and stamp) one line's snapshot; returns whether it differs from
+   the previous frame and the line therefore has to be rendered.  Lines out
+   of cache bounds always render. */
+int
+linecache_line_changed(linecache_t *lc, int line, uint32_t key, const uint32_t *cells, int ncells)
+{
+    int changed;
+
+    if ((line < 0) || (line >= LINECACHE_LINES) || (ncells < 0) || (ncells > LINECACHE_COLS)) {
+        lc->dirty = 1;
+        return 1;
+    }
+
+    changed          = (lc->key[line] != key) || (lc->vgen[line] != lc->gen) || (lc->ncells[line] != ncells);
+    lc->key[line]    = key;
+    lc->vgen[line]   = lc->gen;
+    lc->ncells[line] = ncells;
+
+    if (ncells > 0) {
+        if (changed)
+            memcpy(lc->cells[line], cells, ncells * sizeof(uint32_t));
+        else if (memcmp(lc->cells[line], cells, ncells * sizeof(uint32_t))) {
+            changed = 1;
+            memcpy(lc->cells[line], cells, ncells * sizeof(uint32_t));
+        }
+    }
+
+    if (changed)
+        lc->dirty = 1;
+
+    return changed;
+}
+
+/* How many frames a renderer may skip composing between rendered ones. Zero
+   while the host keeps up; under overload (frames dropped because the blitter
+   was still busy) it rises to a cap of 3, i.e. compose every 4th frame. Only
+   rendering effort is shed - card timing must be unaffected by this. */
+int
+video_get_render_skip_monitor(int monitor_index)
+{
+    return monitors[monitor_index].mon_blit_data_ptr->overload >> 1;
+}
+
 uint8_t
 pixels8(uint32_t *pixels)
 {
@@ -537,11 +745,14 @@ video_blend_monitor(int x, int y, int monitor_index)
 void
 video_process_8_monitor(int x, int y, int monitor_index)
 {
+    uint32_t       *line = monitors[monitor_index].target_buffer->line[y];
+    const uint32_t *pal  = monitors[monitor_index].mon_pal_lookup;
+
     for (int xx = 0; xx < x; xx++) {
-        if (monitors[monitor_index].target_buffer->line[y][xx] <= 0xff)
-            monitors[monitor_index].target_buffer->line[y][xx] = monitors[monitor_index].mon_pal_lookup[monitors[monitor_index].target_buffer->line[y][xx]];
+        if (line[xx] <= 0xff)
+            line[xx] = pal[line[xx]];
         else
-            monitors[monitor_index].target_buffer->line[y][xx] = 0x00000000;
+            line[xx] = 0x00000000;
     }
 }
 
@@ -870,6 +1081,7 @@ video_monitor_init(int index)
     monitors[index].mon_vid_type                         = VIDEO_FLAG_TYPE_NONE;
     atomic_init(&doresize_monitors[index], 0);
     atomic_init(&monitors[index].mon_screenshots, 0);
+    atomic_init(&monitors[index].mon_frames_skipped, 0);
     if (index >= 1)
         ui_init_monitor(index);
     monitors[index].mon_blit_data_ptr->blit_thread = thread_create(blit_thread, monitors[index].mon_blit_data_ptr);
@@ -968,6 +1180,12 @@ video_init(void)
         video_16to32[c] = calc_16to32(c);
 
     memset(monitors, 0, sizeof(monitors));
+
+    wake_screenshot_thread   = thread_create_event();
+    screenshot_ring_not_full = thread_create_event();
+    screenshot_thread_run    = 1;
+    screenshot_thread        = thread_create(screenshot_thread_func, NULL);
+
     video_monitor_init(0);
 }
 
@@ -976,6 +1194,19 @@ video_close(void)
 {
     video_monitor_close(0);
 
+    /* The blit thread is gone, so no more screenshots can be queued; the
+       worker drains whatever is still pending before it exits. */
+    screenshot_thread_run = 0;
+    thread_set_event(wake_screenshot_thread);
+    thread_wait(screenshot_thread);
+    thread_destroy_event(screenshot_ring_not_full);
+    thread_destroy_event(wake_screenshot_thread);
+    for (uint8_t c = 0; c < SCREENSHOT_RING_SIZE; c++) {
+        free(screenshot_ring[c].frame);
+        screenshot_ring[c].frame      = NULL;
+        screenshot_ring[c].frame_size = 0;
+    }
+
     free(video_16to32);
     free(video_15to32);
     free(video_8to32);
@@ -983,8 +1214,12 @@ video_close(void)
     free(video_6to8);
 
     if (fontdatksc5601) {
-        free(fontdatksc5601);
-        fontdatksc5601 = NULL;
+        if (fontdatksc5601_shared)
+            plat_shared_unmap(fontdatksc5601, 16384 * sizeof(dbcs_font_t));
+        else
+            free(fontdatksc5601);
+        fontdatksc5601        = NULL;
+        fontdatksc5601_shared = 0;
     }
 
     if (fontdatksc5601_user) {
@@ -1081,15 +1316,31 @@ loadfont_common(FILE *f, int format)
             break;
 
         case 6: /* Korean KSC-5601 */
-            if (!fontdatksc5601)
-                fontdatksc5601 = malloc(16384 * sizeof(dbcs_font_t));
+            if (!fontdatksc5601) {
+                uint8_t shared = 0;
+
+                /* The whole font is half a megabyte of verbatim file
+                   content, so try the host's shared image cache first:
+                   instances using the same font then map it once per
+                   host. The user-defined glyphs stay private, as the
+                   guest can redefine them. */
+                fontdatksc5601        = (dbcs_font_t *) rom_load_shared(f, 0, 16384 * sizeof(dbcs_font_t), &shared);
+                fontdatksc5601_shared = shared;
+
+                if (!fontdatksc5601)
+                    fontdatksc5601 = malloc(16384 * sizeof(dbcs_font_t));
+            }
 
             if (!fontdatksc5601_user)
                 fontdatksc5601_user = malloc(192 * sizeof(dbcs_font_t));
 
-            for (c = 0; c < 16384; c++) {
-                for (d = 0; d < 32; d++)
-                    fontdatksc5601[c].chr[d] = fgetc(f) & 0xff;
+            if (!fontdatksc5601_shared) {
+                /* Short or unshareable file - read it the plain way. */
+                (void) fseek(f, 0, SEEK_SET);
+                for (c = 0; c < 16384; c++) {
+                    for (d = 0; d < 32; d++)
+                        fontdatksc5601[c].chr[d] = fgetc(f) & 0xff;
+                }
             }
             break;
 
@@ -37,6 +37,10 @@
 #define VNC_MIN_Y 200
 #define VNC_MAX_Y 2048
 
+/* Change detection tile size, in pixels and scanlines. */
+#define VNC_TILE_W 64
+#define VNC_TILE_H 16
+
 static rfbScreenInfoPtr rfb = NULL;
 static int              clients;
 static int              updatingSize;
@@ -183,16 +187,41 @@ vnc_blit(int x, int y, int w, int h, int monitor_index)
         return;
     }
 
-    for (int row = 0; row < h; ++row)
-        video_copy(&(((uint8_t *) rfb->frameBuffer)[row * 2048 * sizeof(uint32_t)]), &(buffer32->line[y + row][x]), w * sizeof(uint32_t));
+    /* The video core hands us the full frame every time, and the encoder
+       cost of the resulting full-screen updates dominates host CPU on
+       headless setups. Compare the incoming frame tile by tile against
+       what the clients already have and copy + mark only what actually
+       changed, so LibVNCServer only encodes the changed region. */
+    for (int ty = 0; ty < h; ty += VNC_TILE_H) {
+        const int th = MIN(VNC_TILE_H, h - ty);
+        int       x1 = w;
+        int       x2 = 0;
+
+        for (int row = ty; row < (ty + th); ++row) {
+            uint32_t       *dst = &((uint32_t *) rfb->frameBuffer)[row * VNC_MAX_X];
+            const uint32_t *src = &(buffer32->line[y + row][x]);
+
+            for (int tx = 0; tx < w; tx += VNC_TILE_W) {
+                const int tw = MIN(VNC_TILE_W, w - tx);
+
+                if (memcmp(&dst[tx], &src[tx], tw * sizeof(uint32_t))) {
+                    video_copy(&dst[tx], &src[tx], tw * sizeof(uint32_t));
+                    if (tx < x1)
+                        x1 = tx;
+                    if ((tx + tw) > x2)
+                        x2 = tx + tw;
+                }
+            }
+        }
+
+        if ((x2 > x1) && !updatingSize)
+            rfbMarkRectAsModified(rfb, x1, ty, x2, ty + th);
+    }
 
     if (screenshots)
         video_screenshot((uint32_t *) rfb->frameBuffer, 0, 0, VNC_MAX_X);
 
     video_blit_complete_monitor(monitor_index);
-
-    if (!updatingSize)
-        rfbMarkRectAsModified(rfb, 0, 0, allowedX, allowedY);
 }
 
 /* Initialize VNC for operation. */